@@ -106,4 +106,8 @@ ie_option(ENABLE_CLANG_FORMAT "Enable clang-format checks during the build" ON)
 
 set(IE_EXTRA_PLUGINS "" CACHE STRING "Extra paths for plugins to include into DLDT build tree")
 
+set(SELECTIVE_BUILD_OPS "" CACHE STRING "Layer types the CPU plugin extension layers are built for, all of them when empty")
+
+set(SELECTIVE_BUILD_MODELS "" CACHE STRING "IR .xml files whose layer types the CPU plugin extension layers are built for")
+
 ie_dependent_option(ENABLE_TBB_RELEASE_ONLY "Only Release TBB libraries are linked to the Inference Engine binaries" ON "THREADING MATCHES TBB;LINUX" OFF)
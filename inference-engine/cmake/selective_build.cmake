@@ -0,0 +1,35 @@
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+#
+# ie_selective_build_ops(<output variable>)
+#
+# Collects the layer types listed in SELECTIVE_BUILD_OPS and the ones used by the IR models
+# listed in SELECTIVE_BUILD_MODELS. The list is empty when the build is not selective.
+#
+function(ie_selective_build_ops output)
+    set(ops ${SELECTIVE_BUILD_OPS})
+
+    foreach(model IN LISTS SELECTIVE_BUILD_MODELS)
+        if(NOT EXISTS "${model}")
+            message(FATAL_ERROR "SELECTIVE_BUILD_MODELS: ${model} does not exist")
+        endif()
+        # the build is configured again when a model changes
+        set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${model}")
+
+        file(READ "${model}" content)
+        # the layers of the TensorIterator bodies are nested into the same <layer> tags
+        string(REGEX MATCHALL "<layer [^>]*type=\"[A-Za-z0-9_]+\"" layers "${content}")
+        foreach(layer IN LISTS layers)
+            string(REGEX REPLACE ".*type=\"([A-Za-z0-9_]+)\"$" "\\1" type "${layer}")
+            list(APPEND ops ${type})
+        endforeach()
+    endforeach()
+
+    if(ops)
+        list(REMOVE_DUPLICATES ops)
+        list(SORT ops)
+    endif()
+    set(${output} ${ops} PARENT_SCOPE)
+endfunction()
@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -294,6 +295,16 @@ typedef struct ie_complete_call_back {
     void *args;
 }ie_complete_call_back_t;
 
+/**
+ * @struct ie_completion
+ * @brief Describes an asynchronous request finished on a completion queue
+ */
+typedef struct ie_completion {
+    ie_infer_request_t *request;
+    void *user_data;
+    IEStatusCode status;
+}ie_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -643,6 +654,64 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * Set of functions collecting the completions of many asynchronous infer requests
+ * in one queue, so they are received in batches instead of one callback per request.
+ * Bind the input and output memory of each request once with ie_blob_make_memory_from_preallocated()
+ * and ie_infer_request_set_blob() to avoid copies on every submission.
+ * @{
+ */
+
+/**
+ * @brief Constructs an empty completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance.
+ * No request submitted to the queue may be running when it is released.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Starts asynchronous inference of the infer request and reports its completion to the queue.
+ * The queue replaces the completion callback set with ie_infer_set_completion_callback().
+ * @ingroup CompletionQueue
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance receiving the completion.
+ * @param user_data Any value returned along with the completion.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_infer_async_to_queue(ie_infer_request_t *infer_request,
+    ie_completion_queue_t *queue, void *user_data);
+
+/**
+ * @brief Takes up to max_count finished requests from the queue. Blocks until at least one request is finished
+ * or specified timeout elapses, whichever comes first.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param completions An array of at least max_count elements receiving the completions.
+ * @param max_count Maximum number of completions to take.
+ * @param timeout Maximum duration in milliseconds to block for
+ * @note There are special cases when timeout is equal some value of the WaitMode enum:
+ * * 0 - Immediately returns the completions available. It does not block.
+ * * -1 - waits until at least one request is finished
+ * @param count A pointer to the number of completions taken.
+ * @return Status code of the operation: OK(0) if completions were taken, RESULT_NOT_READY if the timeout elapsed.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_wait(ie_completion_queue_t *queue, ie_completion_t *completions,
+    size_t max_count, const int64_t timeout, size_t *count);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
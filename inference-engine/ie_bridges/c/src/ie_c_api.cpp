@@ -14,6 +14,9 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -44,6 +47,18 @@ struct ie_executable {
  */
 struct ie_infer_request {
     IE::InferRequest object;
+    ie_completion_queue_t *queue = nullptr;
+    void *user_data = nullptr;
+};
+
+/**
+ * @struct ie_completion_queue
+ * @brief This struct collects completions of asynchronous infer requests
+ */
+struct ie_completion_queue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<ie_completion_t> completed;
 };
 
 /**
@@ -1336,6 +1351,7 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
             callback->completeCallBackFunc(callback->args);
         };
         infer_request->object.SetCompletionCallback(fun);
+        infer_request->queue = nullptr;
     } catch (const IE::details::InferenceEngineException& e) {
         return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
     } catch (...) {
@@ -1345,6 +1361,95 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        *queue = new ie_completion_queue_t;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+static void queue_completion_callback(IE::IInferRequest::Ptr request, IE::StatusCode code) {
+    ie_infer_request_t *infer_request = nullptr;
+    IE::ResponseDesc resp;
+    request->GetUserData(reinterpret_cast<void **>(&infer_request), &resp);
+
+    // status_map is only read here, operator[] may insert from the plugin threads
+    auto status = status_map.find(code);
+    ie_completion_t completion = {infer_request, infer_request->user_data,
+                                  status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED};
+
+    ie_completion_queue_t *queue = infer_request->queue;
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->completed.push_back(completion);
+    }
+    queue->cv.notify_one();
+}
+
+IEStatusCode ie_infer_request_infer_async_to_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data) {
+    if (infer_request == nullptr || queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        // the callback is installed on the first submission to the queue only
+        if (infer_request->queue != queue) {
+            IE::IInferRequest::Ptr &request = infer_request->object;
+            IE::ResponseDesc resp;
+            IE::StatusCode status_code = request->SetUserData(infer_request, &resp);
+            if (status_code == IE::StatusCode::OK)
+                status_code = request->SetCompletionCallback(queue_completion_callback);
+            if (status_code != IE::StatusCode::OK)
+                return status_map[status_code];
+            infer_request->queue = queue;
+        }
+        infer_request->user_data = user_data;
+        infer_request->object.StartAsync();
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_wait(ie_completion_queue_t *queue, ie_completion_t *completions,
+    size_t max_count, const int64_t timeout, size_t *count) {
+    if (queue == nullptr || completions == nullptr || max_count == 0 || count == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto ready = [queue]() { return !queue->completed.empty(); };
+    if (timeout < 0) {
+        queue->cv.wait(lock, ready);
+    } else if (timeout > 0) {
+        queue->cv.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+    }
+
+    size_t taken = std::min(max_count, queue->completed.size());
+    std::copy(queue->completed.begin(), queue->completed.begin() + taken, completions);
+    queue->completed.erase(queue->completed.begin(), queue->completed.begin() + taken);
+    *count = taken;
+
+    return taken ? IEStatusCode::OK : IEStatusCode::RESULT_NOT_READY;
+}
+
 IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1495,6 +1495,79 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue, inferAsyncToQueue) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_EXPECT_OK(ie_completion_queue_create(&queue));
+    EXPECT_NE(nullptr, queue);
+
+    const size_t num_requests = 2;
+    ie_infer_request_t *infer_requests[num_requests] = {nullptr, nullptr};
+    cv::Mat image = cv::imread(input_image);
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        EXPECT_NE(nullptr, infer_requests[i]);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+    }
+
+    size_t count = 0;
+    ie_completion_t completions[num_requests];
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_wait(queue, completions, num_requests, 0, &count));
+    EXPECT_EQ(0, count);
+
+    // every request goes through the queue twice, the second time with the callback already installed
+    for (size_t round = 0; round < 2 && !HasFatalFailure(); ++round) {
+        for (size_t i = 0; i < num_requests; ++i) {
+            IE_EXPECT_OK(ie_infer_request_infer_async_to_queue(infer_requests[i], queue, &infer_requests[i]));
+        }
+
+        size_t finished = 0;
+        while (finished < num_requests) {
+            IE_ASSERT_OK(ie_completion_queue_wait(queue, completions, num_requests, -1, &count));
+            for (size_t c = 0; c < count; ++c) {
+                IE_EXPECT_OK(completions[c].status);
+                EXPECT_EQ(*static_cast<ie_infer_request_t **>(completions[c].user_data), completions[c].request);
+
+                ie_blob_t *output_blob = nullptr;
+                IE_EXPECT_OK(ie_infer_request_get_blob(completions[c].request, "fc_out", &output_blob));
+                ie_blob_buffer_t buffer;
+                IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+                float *output_data = (float *)(buffer.buffer);
+                EXPECT_NEAR(output_data[9], 0.f, 1.e-5);
+                ie_blob_free(&output_blob);
+            }
+            finished += count;
+        }
+    }
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
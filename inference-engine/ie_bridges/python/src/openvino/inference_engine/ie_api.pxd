@@ -37,6 +37,15 @@ cdef class InferRequest:
     cdef public:
         _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
 
+cdef class InferQueue:
+    cdef unique_ptr[C.InferQueue] impl
+    cdef void _on_completed(self, int status) with gil
+    cdef _run_pending(self)
+    cdef _start(self, int index, inputs, task)
+    cdef _finish(self, int index, int status, error = ?)
+    cdef public:
+        _exec_net, _requests, _tasks, _pending, _callback, _in_flight
+
 cdef class IENetwork:
     cdef C.IENetwork impl
 
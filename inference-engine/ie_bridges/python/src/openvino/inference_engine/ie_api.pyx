@@ -10,14 +10,16 @@ from libc.stdlib cimport malloc, free
 from libc.stdint cimport int64_t, uint8_t, int8_t, int32_t, uint16_t, int16_t
 from libc.stddef cimport size_t
 from libc.string cimport memcpy
+from cpython.ref cimport Py_INCREF, Py_DECREF
 
+import asyncio
 import os
 from fnmatch import fnmatch
 from pathlib import Path
 import threading
 import warnings
 from copy import deepcopy
-from collections import OrderedDict, namedtuple
+from collections import OrderedDict, namedtuple, deque
 
 from .cimport ie_api_impl_defs as C
 from .ie_api_impl_defs cimport SizeVector, Precision
@@ -193,7 +195,9 @@ cdef class Blob:
 
     def __deepcopy__(self, memodict):
         res = Blob(deepcopy(self.tensor_desc, memodict), deepcopy(self._array_data, memodict))
-        res.buffer[:] = deepcopy(self.buffer[:], memodict)
+        # A blob created over a copy of the user array already holds the data
+        if self._array_data is None:
+            res.buffer[:] = self.buffer
         return res
 
     ## Blob's memory as numpy.ndarray representation
@@ -821,8 +825,11 @@ cdef class ExecutableNetwork:
         current_request = self.requests[0]
         current_request.infer(inputs)
         res = {}
-        for name, value in current_request.output_blobs.items():
-            res[name] = deepcopy(value.buffer)
+        for name in current_request._outputs_list:
+            if name in current_request._user_blobs:
+                res[name] = current_request._user_blobs[name].buffer
+            else:
+                res[name] = current_request._get_blob_buffer(name.encode()).to_numpy().copy()
         return res
 
 
@@ -972,7 +979,12 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef int c_num_requests = num_requests
+        cdef int64_t c_timeout = timeout
+        cdef int c_status
+        with nogil:
+            c_status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return c_status
 
     ## Get idle request ID
     #  @return Request index
@@ -1048,13 +1060,17 @@ cdef class InferRequest:
         return input_blobs
 
     ## Dictionary that maps output layer names to corresponding Blobs
+    #  \note Outputs set with `set_blob()` are returned as the user Blob itself, other outputs are copies
     @property
     def output_blobs(self):
         output_blobs = {}
         for output in self._outputs_list:
-            blob = Blob()
-            deref(self.impl).getBlobPtr(output.encode(), blob._ptr)
-            output_blobs[output] = deepcopy(blob)
+            if output in self._user_blobs:
+                output_blobs[output] = self._user_blobs[output]
+            else:
+                blob = Blob()
+                deref(self.impl).getBlobPtr(output.encode(), blob._ptr)
+                output_blobs[output] = deepcopy(blob)
         return output_blobs
 
     ## Dictionary that maps input layer names to corresponding preprocessing information
@@ -1072,7 +1088,12 @@ cdef class InferRequest:
         return preprocess_info
 
     ## Sets user defined Blob for the infer request
-    #  @param blob_name: A name of input blob
+    #
+    #  A Blob created over a `numpy.ndarray` shares memory with the array, so the data is neither copied to
+    #  the request inputs nor from its outputs: the network reads and writes the array directly.
+    #  The Blob keeps the array alive while it is set to the request.
+    #
+    #  @param blob_name: A name of input or output blob
     #  @param blob: Blob object to set for the infer request
     #  @param preprocess_info: PreProcessInfo object to set for the infer request.
     #  @return None
@@ -1096,7 +1117,8 @@ cdef class InferRequest:
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
-    #                 input data for the layer
+    #                 input data for the layer. A `Blob` value is set to the request with `set_blob()`
+    #                 instead of being copied
     #  @return None
     #
     #  Usage example:\n
@@ -1113,7 +1135,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1132,7 +1155,8 @@ cdef class InferRequest:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1166,7 +1190,11 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = timeout
+        cdef int c_status
+        with nogil:
+            c_status = deref(self.impl).wait(c_timeout)
+        return c_status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1255,9 +1283,160 @@ cdef class InferRequest:
         deref(self.impl).setBatch(size)
 
     def _fill_inputs(self, inputs):
+        input_blobs = self.input_blobs
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.input_blobs[k].buffer[:] = v
+            if isinstance(v, Blob):
+                # Blob is checked against the network input once, when it is set for the first time
+                if self._user_blobs.get(k) is not v:
+                    self.set_blob(k, v)
+            else:
+                input_blobs[k].buffer[:] = v
+
+
+def _set_future_result(future, result):
+    if not future.cancelled():
+        future.set_result(result)
+
+
+def _set_future_exception(future, error):
+    if not future.cancelled():
+        future.set_exception(error)
+
+
+## This class manages the infer requests of an `ExecutableNetwork` as a pool. Jobs are started on idle requests
+#  or queued until one becomes idle, so neither submitting nor finishing a job blocks the caller.
+#  Finished requests are collected on the plugin threads and handled in batches with a single GIL acquisition.
+#
+#  Usage example:\n
+#  ```python
+#  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=4)
+#  infer_queue = InferQueue(exec_net)
+#  # asyncio
+#  results = await asyncio.gather(*[infer_queue.infer_async({'data': img}) for img in images])
+#  # callbacks
+#  infer_queue.set_callback(lambda request, status, userdata: print(userdata, status))
+#  for i, img in enumerate(images):
+#      infer_queue.start_async({'data': img}, userdata=i)
+#  infer_queue.wait_all()
+#  ```
+cdef class InferQueue:
+    ## Class constructor
+    #  @param network: `ExecutableNetwork` whose infer requests are used by the queue.
+    #                  The infer requests of a network can be managed by one queue at a time.
+    #  @return Instance of InferQueue class
+    def __init__(self, ExecutableNetwork network):
+        self._exec_net = network
+        self._requests = network.requests
+        self._tasks = [None] * len(self._requests)
+        self._pending = deque()
+        self._callback = None
+        self._in_flight = 0
+        self.impl.reset(new C.InferQueue(deref(network.impl)))
+        deref(self.impl).setCyCallback(<cb_type> self._on_completed, <void *> self)
+
+    ## Sets a function called for every finished job which was started with `start_async()`
+    #  @param callback: Function taking the `InferRequest`, its status code and the `userdata` of the job.
+    #                   The outputs of the request can be read in the callback.
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Starts inference on an idle infer request or queues the job until a request becomes idle
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` or `Blob` objects
+    #  @param userdata: Any object passed to the callback set with `set_callback()`
+    #  @return None
+    def start_async(self, inputs=None, userdata=None):
+        self._pending.append((inputs, (userdata, None, None)))
+        self._run_pending()
+
+    ## Starts inference like `start_async()` and returns an `asyncio.Future` completed in the event loop
+    #  with a dictionary that maps output layer names to `numpy.ndarray` objects with the results
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` or `Blob` objects
+    #  @param loop: Event loop of the future, the current event loop by default
+    #  @return `asyncio.Future` object
+    def infer_async(self, inputs=None, loop=None):
+        if loop is None:
+            loop = asyncio.get_event_loop()
+        future = loop.create_future()
+        self._pending.append((inputs, (None, loop, future)))
+        self._run_pending()
+        return future
+
+    ## Waits until all jobs are finished, including the queued ones
+    #  @param timeout: Time to wait in milliseconds, -1 waits until the jobs are finished (default value)
+    #  @return Status code: OK or RESULT_NOT_READY
+    def wait_all(self, timeout=None):
+        if timeout is None:
+            timeout = WaitMode.RESULT_READY
+        cdef int64_t c_timeout = timeout
+        cdef int c_status
+        with nogil:
+            c_status = deref(self.impl).waitAll(c_timeout)
+        return c_status
+
+    cdef void _on_completed(self, int status) with gil:
+        cdef vector[pair[int, int]] completed = deref(self.impl).popCompleted()
+        cdef bool finished = not completed.empty()
+        while not completed.empty():
+            for job in completed:
+                self._finish(job.first, job.second)
+            completed = deref(self.impl).popCompleted()
+        if finished and self._in_flight == 0:
+            # the last reference may go away here, nothing must touch self after it
+            Py_DECREF(self)
+
+    cdef _run_pending(self):
+        cdef int index
+        while self._pending:
+            index = deref(self.impl).getIdleRequestId()
+            if index < 0:
+                return
+            inputs, task = self._pending.popleft()
+            self._start(index, inputs, task)
+
+    cdef _start(self, int index, inputs, task):
+        # keep the queue alive while the plugin may call it back
+        if self._in_flight == 0:
+            Py_INCREF(self)
+        self._in_flight += 1
+        self._tasks[index] = task
+        try:
+            if inputs is not None:
+                self._requests[index]._fill_inputs(inputs)
+            deref(self.impl).startAsync(index)
+        except Exception as error:
+            self._finish(index, StatusCode.GENERAL_ERROR, error)
+            if self._in_flight == 0:
+                Py_DECREF(self)
+
+    cdef _finish(self, int index, int status, error=None):
+        userdata, loop, future = self._tasks[index]
+        self._tasks[index] = None
+        request = self._requests[index]
+        if future is not None:
+            if status == StatusCode.OK:
+                outputs = {name: blob.buffer for name, blob in request.output_blobs.items()}
+                loop.call_soon_threadsafe(_set_future_result, future, outputs)
+            else:
+                if error is None:
+                    error = RuntimeError("Infer request failed with status code {}".format(status))
+                loop.call_soon_threadsafe(_set_future_exception, future, error)
+        elif self._callback is not None:
+            try:
+                self._callback(request, status, userdata)
+            except Exception as callback_error:
+                warnings.warn("InferQueue callback raised an exception: {}".format(callback_error), RuntimeWarning)
+        elif error is not None:
+            warnings.warn("InferQueue job failed: {}".format(error), RuntimeWarning)
+
+        # the outputs are consumed, the request can take the next job
+        if self._pending:
+            inputs, task = self._pending.popleft()
+            self._start(index, inputs, task)
+        else:
+            deref(self.impl).setRequestIdle(index)
+        self._in_flight -= 1
 
 
 ## This class represents a main layer information and providing setters allowing to modify layer properties
@@ -399,9 +399,6 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
@@ -409,6 +406,13 @@ void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngi
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
     requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    if (requestWrap->infer_queue) {
+        // the queue reports failed requests to Python as well
+        requestWrap->infer_queue->onCompleted(requestWrap->index, static_cast<int>(code));
+    }
+    if (code != InferenceEngine::StatusCode::OK) {
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
@@ -512,6 +516,91 @@ int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t
     return static_cast<int>(InferenceEngine::StatusCode::OK);
 }
 
+InferenceEnginePython::InferQueue::InferQueue(IEExecNetwork &network) : requests(network.infer_requests) {
+    for (auto &request : requests) {
+        if (request.infer_queue) {
+            THROW_IE_EXCEPTION << "Infer requests of the network are already managed by another InferQueue";
+        }
+        request.infer_queue = this;
+        idle_ids.emplace_back(request.index);
+    }
+}
+
+InferenceEnginePython::InferQueue::~InferQueue() {
+    waitAll(-1);
+    for (auto &request : requests) {
+        request.infer_queue = nullptr;
+    }
+}
+
+int InferenceEnginePython::InferQueue::getIdleRequestId() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (idle_ids.empty())
+        return -1;
+    int index = idle_ids.front();
+    idle_ids.pop_front();
+    return index;
+}
+
+void InferenceEnginePython::InferQueue::setRequestIdle(int index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    idle_ids.emplace_back(index);
+    cv.notify_all();
+}
+
+int InferenceEnginePython::InferQueue::waitAll(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto all_idle = [this]() { return idle_ids.size() == requests.size(); };
+    if (timeout > 0) {
+        if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), all_idle))
+            return static_cast<int>(InferenceEngine::StatusCode::RESULT_NOT_READY);
+    } else {
+        cv.wait(lock, all_idle);
+    }
+    return static_cast<int>(InferenceEngine::StatusCode::OK);
+}
+
+void InferenceEnginePython::InferQueue::startAsync(int index) {
+    requests[index].infer_async();
+}
+
+void InferenceEnginePython::InferQueue::setCyCallback(cy_callback callback, void *data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    user_callback = callback;
+    user_data = data;
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::InferQueue::popCompleted() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::pair<int, int>> batch;
+    batch.swap(completed);
+    // an empty batch ends the drain, the next completion starts a new one
+    if (batch.empty())
+        draining = false;
+    return batch;
+}
+
+void InferenceEnginePython::InferQueue::onCompleted(int index, int code) {
+    cy_callback callback;
+    void *data;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!user_callback) {
+            idle_ids.emplace_back(index);
+            cv.notify_all();
+            return;
+        }
+        completed.emplace_back(index, code);
+        // completions coming while the callback drains the list are picked up by the running drain
+        if (draining)
+            return;
+        draining = true;
+        callback = user_callback;
+        data = user_data;
+    }
+    callback(data, code);
+}
+
 void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
    std::unique_lock<std::mutex> lock(mutex);
    idle_ids.emplace_back(index);
@@ -93,6 +93,8 @@ struct IdleInferRequestQueue {
 };
 
 
+struct InferQueue;
+
 struct InferRequestWrap {
     int index;
     using cy_callback = void (*)(void*, int);
@@ -103,6 +105,7 @@ struct InferRequestWrap {
     cy_callback user_callback;
     void *user_data;
     IdleInferRequestQueue::Ptr  request_queue_ptr;
+    InferQueue *infer_queue = nullptr;
 
     void infer();
 
@@ -154,6 +157,39 @@ struct IEExecNetwork {
 };
 
 
+/**
+ * Pool of the infer requests of an executable network. Completions are collected on the plugin threads
+ * and handed to a single callback which drains them in batches, so the GIL is taken once per batch.
+ * A request stays busy until the owner marks it idle, which lets the callback read its outputs first.
+ */
+struct InferQueue {
+    using cy_callback = InferRequestWrap::cy_callback;
+
+    explicit InferQueue(IEExecNetwork &network);
+    ~InferQueue();
+
+    int getIdleRequestId();
+    void setRequestIdle(int index);
+    int waitAll(int64_t timeout);
+
+    void startAsync(int index);
+
+    void setCyCallback(cy_callback callback, void *data);
+    std::vector<std::pair<int, int>> popCompleted();
+    void onCompleted(int index, int code);
+
+private:
+    std::vector<InferRequestWrap> &requests;
+    std::list<int> idle_ids;
+    std::vector<std::pair<int, int>> completed;
+    bool draining = false;
+    cy_callback user_callback = nullptr;
+    void *user_data = nullptr;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+
 struct IECore {
     InferenceEngine::Core actual;
     explicit IECore(const std::string & xmlConfigFile = std::string());
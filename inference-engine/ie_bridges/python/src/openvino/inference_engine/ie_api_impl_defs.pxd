@@ -169,7 +169,7 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void exportNetwork(const string & model_file) except +
         object getMetric(const string & metric_name) except +
         object getConfig(const string & metric_name) except +
-        int wait(int num_requests, int64_t timeout)
+        int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId()
 
     cdef cppclass IENetwork:
@@ -203,12 +203,21 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBlob(const string &blob_name, const CBlob.Ptr &blob_ptr, CPreProcessInfo& info) except +
         void getPreProcess(const string& blob_name, const CPreProcessInfo** info) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
+    cdef cppclass InferQueue:
+        InferQueue(IEExecNetwork & network) except +
+        int getIdleRequestId()
+        void setRequestIdle(int index)
+        int waitAll(int64_t timeout) nogil
+        void startAsync(int index) except +
+        void setCyCallback(void (*)(void*, int), void *)
+        vector[pair[int, int]] popCompleted()
+
     cdef cppclass IECore:
         IECore() except +
         IECore(const string & xml_config_file) except +
@@ -0,0 +1,83 @@
+import asyncio
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+path_to_image = image_path()
+test_net_xml, test_net_bin = model_path(is_myriad)
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_image)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1))
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def test_start_async_with_callback(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=2)
+    infer_queue = ie.InferQueue(exec_net)
+    img = read_image()
+    results = {}
+
+    def callback(request, status, userdata):
+        assert status == ie.StatusCode.OK
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue.set_callback(callback)
+    for i in range(8):
+        infer_queue.start_async({'data': img}, userdata=i)
+    assert infer_queue.wait_all() == ie.StatusCode.OK
+    assert results == {i: 2 for i in range(8)}
+    del infer_queue
+    del exec_net
+    del ie_core
+
+
+def test_infer_async_futures(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=2)
+    infer_queue = ie.InferQueue(exec_net)
+    img = read_image()
+
+    async def run():
+        return await asyncio.gather(*[infer_queue.infer_async({'data': img}) for _ in range(5)])
+
+    loop = asyncio.new_event_loop()
+    try:
+        results = loop.run_until_complete(run())
+    finally:
+        loop.close()
+    assert len(results) == 5
+    for res in results:
+        assert np.argmax(res['fc_out']) == 2
+    del infer_queue
+    del exec_net
+    del ie_core
+
+
+def test_one_queue_per_network(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(model=test_net_xml, weights=test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    infer_queue = ie.InferQueue(exec_net)
+    with pytest.raises(RuntimeError) as e:
+        ie.InferQueue(exec_net)
+    assert "already managed by another InferQueue" in str(e.value)
+    del infer_queue
+    del exec_net
+    del ie_core
@@ -512,3 +512,20 @@ def test_resize_algorithm_work(device):
     res_2 = np.sort(request.output_blobs['fc_out'].buffer)
 
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
+
+
+def test_blob_setter_output_shares_memory(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(network=net, device_name=device, num_requests=1)
+
+    img = read_image()
+    img_blob = ie.Blob(ie.TensorDesc("FP32", [1, 3, 32, 32], "NCHW"), img)
+    out = np.zeros(shape=(1, 10), dtype=np.float32)
+    out_blob = ie.Blob(ie.TensorDesc("FP32", [1, 10], "NC"), out)
+    request = exec_net.requests[0]
+    request.set_blob('fc_out', out_blob)
+    request.infer({'data': img_blob})
+    assert np.argmax(out) == 2
+    assert request.output_blobs['fc_out'] is out_blob
+    assert request.input_blobs['data'] is img_blob
@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+#define DECLARE_AUTO_BATCH_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(AUTO_BATCH_##name)
+
+/**
+ * @brief The device to collect batches for, with an optional batch size in brackets, e.g. "CPU(8)".
+ * The `BATCH:CPU(8)` device name is a shortcut for this option
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief Time in milliseconds to wait for the batch to be filled before running a partially filled one.
+ * Default value is "1000"
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+}  // namespace InferenceEngine
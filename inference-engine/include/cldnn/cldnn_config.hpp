@@ -32,6 +32,9 @@ namespace CLDNNConfigParams {
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf
 * this option should be used with an unsigned integer value (1 is lowest priority)
 * 0 means no priority hint is set and default queue is created.
+* The key can be passed to LoadNetwork: the network gets its own queue with the hint, so the kernels
+* of a network with a higher priority preempt the ones of the networks loaded with a lower priority.
+* Loading fails if the device does not support cl_khr_priority_hints.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 
@@ -40,6 +43,8 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_PRIORITY);
 * as defined in https://www.khronos.org/registry/OpenCL/specs/opencl-2.1-extensions.pdf,
 * chapter 9.19. This option should be used with an unsigned integer value (1 is lowest energy consumption)
 * 0 means no throttle hint is set and default queue created.
+* Like KEY_CLDNN_PLUGIN_PRIORITY, the key can be passed to LoadNetwork to set the hint for the queue of one network.
+* Loading fails if the device does not support cl_khr_throttle_hints.
 */
 DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 
@@ -49,6 +54,13 @@ DECLARE_CLDNN_CONFIG_KEY(PLUGIN_THROTTLE);
 */
 DECLARE_CLDNN_CONFIG_KEY(MEM_POOL);
 
+/**
+* @brief This key allows networks loaded to the same remote context to reuse intermediate buffers of each other.
+* Inference requests of all such networks are executed one at a time by a shared executor,
+* so the option can not be combined with several GPU throughput streams. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(SHARED_MEM_POOL);
+
 /**
 * @brief This key defines the directory name to which clDNN graph visualization will be dumped.
 */
@@ -64,12 +76,105 @@ DECLARE_CLDNN_CONFIG_KEY(SOURCES_DUMPS_DIR);
 */
 DECLARE_CLDNN_CONFIG_KEY(INT8_ENABLED);
 
+/**
+* @brief This key turns on storing FP32 weights of convolutions and fully connected layers in FP16,
+* which halves their memory and bandwidth. The computation stays in FP32: the kernels which support it
+* up-convert the weights in registers, for the others the weights are converted back to FP32 on the device.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(FP16_WEIGHTS);
+
+/**
+* @brief This key lists the layers which keep FP32 weights when KEY_CLDNN_FP16_WEIGHTS is turned on,
+* e.g. the layers sensitive to the precision of the weights.
+* This option should be used with a space separated list of layer names. Empty by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(FP32_WEIGHTS_LAYERS);
+
+/**
+* @brief This key turns on running DetectionOutput layers with OpenCL kernels, so their inputs are not copied
+* to the host. The layers with decrease_label_id, clip_before_nms or clip_after_nms attributes still run on the host.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(GPU_DETECTION_OUTPUT);
+
+/**
+* @brief This key loads a network to several GPUs, each of them infers a part of the batch of every request and
+* the outputs are merged. The batch of the network inputs and outputs must be divisible by the number of devices.
+* Compiled kernels are shared between the devices of the same kind through KEY_CLDNN_KERNELS_CACHE_DIR.
+* This option should be used with a space separated list of device ids, e.g. "0 1". Empty by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DATA_PARALLEL_DEVICES);
+
+/**
+* @brief This key turns on completing inference requests without waiting for the outputs set as remote blobs.
+* The blobs get the event of the inference in GPU_PARAM_KEY(OCL_EVENT), the next GPU networks of the same
+* context wait for it on the device, so chained networks are executed without host synchronization.
+* Mapping of such a blob to the host waits for the event. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(NON_BLOCKING_REMOTE_OUTPUTS);
+
+/**
+* @brief With KEY_DYN_BATCH_ENABLED, this key makes the plugin compile one network for the maximal batch
+* with the kernels which take the batch at runtime, instead of a network per power of two of the batch.
+* The plugin compiles the networks per power of two if some layer of the network has no such kernel.
+* Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(RUNTIME_BATCH);
+
 /**
 * @brief This key should be set to correctly handle NV12 input without pre-processing.
 * Turned off by default.
 */
 DECLARE_CLDNN_CONFIG_KEY(NV12_TWO_INPUTS);
 
+/**
+* @brief This key sets the size of NV12 frames given to the plugin as two inputs (see KEY_CLDNN_NV12_TWO_INPUTS).
+* This option should be used with a value in the "<width>x<height>" form, e.g. "1920x1080".
+* If the size differs from the network input one and a resize algorithm is set in the input pre-processing info,
+* the frames are resized by the device right after the color conversion. Empty by default (means the network size).
+*/
+DECLARE_CLDNN_CONFIG_KEY(NV12_SOURCE_SIZE);
+
+/**
+* @brief This key sets the max number of host threads used to compile OpenCL programs in parallel.
+* This option should be used with a positive integer value. By default all the host cores are used.
+*/
+DECLARE_CLDNN_CONFIG_KEY(COMPILATION_THREADS);
+
+/**
+* @brief This key sets the max number of kernels compiled in a single OpenCL program.
+* Smaller programs give more parallelism to the compilation but each of them has its own build overhead.
+* This option should be used with a positive integer value. 10 by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_PER_PROGRAM);
+
+/**
+* @brief This key defines the directory where compiled OpenCL programs are cached between runs.
+* Programs are looked up by their sources, build options, device and driver version,
+* so the directory can be shared by several networks. Empty by default (means no caching).
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR);
+
+/**
+* @brief This key defines the directory where the weights reordered to the formats of the selected kernels
+* (e.g. the blocked INT8 formats) are cached between network loads. A network loaded with the same weights
+* uploads the cached weights instead of reordering them on the device. Empty by default (means no caching).
+*/
+DECLARE_CLDNN_CONFIG_KEY(WEIGHTS_CACHE_DIR);
+
+/**
+* @brief This key defines the OpenCL queue type and how dependencies between primitives are enforced in it:
+* CLDNN_QUEUE_IN_ORDER - in-order queue, primitives are executed one after another,
+* CLDNN_QUEUE_OUT_OF_ORDER - out-of-order queue synchronized with barriers (default),
+* CLDNN_QUEUE_OUT_OF_ORDER_EVENTS - out-of-order queue where every primitive waits for its own dependencies only,
+* so independent branches of a network (e.g. heads of detection models) are executed concurrently.
+*/
+DECLARE_CLDNN_CONFIG_KEY(QUEUE_MODE);
+DECLARE_CLDNN_CONFIG_VALUE(QUEUE_IN_ORDER);
+DECLARE_CLDNN_CONFIG_VALUE(QUEUE_OUT_OF_ORDER);
+DECLARE_CLDNN_CONFIG_VALUE(QUEUE_OUT_OF_ORDER_EVENTS);
+
 
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
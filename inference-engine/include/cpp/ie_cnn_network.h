@@ -231,9 +231,10 @@ public:
     /**
      * @brief Serialize network to IR and weights files.
      *
-     * @param xmlPath Path to output IR file.
+     * @param xmlPath Path to output IR file. A path with the `.bir` extension writes the network
+     * in nGraph representation to the binary IR which keeps the graph and the weights in one file.
      * @param binPath Path to output weights file. The parameter is skipped in case
-     * of executable graph info serialization.
+     * of executable graph info serialization and of the binary IR.
      */
     void serialize(const std::string& xmlPath, const std::string& binPath = "") const {
         CALL_STATUS_FNC(serialize, xmlPath, binPath);
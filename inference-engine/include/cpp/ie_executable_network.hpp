@@ -241,6 +241,30 @@ public:
         return pContext;
     }
 
+    /**
+     * @copybrief IExecutableNetwork::InferBatch
+     *
+     * Wraps IExecutableNetwork::InferBatch.
+     * @param inputs The input blobs of each set, every set must contain all the network inputs
+     * @param outputs The output blobs of each set, the missing ones are allocated
+     */
+    void InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs) {
+        CALL_STATUS_FNC(InferBatch, inputs, outputs);
+    }
+
+    /**
+     * @copybrief IExecutableNetwork::InferBatch
+     *
+     * Wraps IExecutableNetwork::InferBatch.
+     * @param inputs The input blobs of each set, every set must contain all the network inputs
+     * @return The output blobs of each set
+     */
+    std::vector<BlobMap> InferBatch(const std::vector<BlobMap>& inputs) {
+        std::vector<BlobMap> outputs;
+        CALL_STATUS_FNC(InferBatch, inputs, outputs);
+        return outputs;
+    }
+
     /**
      * @brief A smart pointer to the ExecutableNetwork object
      */
@@ -206,6 +206,37 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @copybrief IInferRequest::SetPriority
+     *
+     * Wraps IInferRequest::SetPriority
+     * @param priority The priority of the request, 0 is the default
+     * @param deadlineUs The latency budget of every inference in microseconds, 0 means no deadline
+     */
+    void SetPriority(const int priority, const int64_t deadlineUs = 0) {
+        CALL_STATUS_FNC(SetPriority, priority, deadlineUs);
+    }
+
+    /**
+     * @copybrief IInferRequest::SetStateSession
+     *
+     * Wraps IInferRequest::SetStateSession
+     * @param sessionId The identifier of the session, a negative value binds the request to the states of the network
+     */
+    void SetStateSession(const int64_t sessionId) {
+        CALL_STATUS_FNC(SetStateSession, sessionId);
+    }
+
+    /**
+     * @copybrief IInferRequest::ReleaseStateSession
+     *
+     * Wraps IInferRequest::ReleaseStateSession
+     * @param sessionId The identifier of the session
+     */
+    void ReleaseStateSession(const int64_t sessionId) {
+        CALL_STATUS_FNC(ReleaseStateSession, sessionId);
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
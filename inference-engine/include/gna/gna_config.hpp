@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include "ie_plugin_config.hpp"
 
@@ -109,5 +110,24 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief If turned on, the batch of the network inputs is treated as consecutive frames of a stream,
+* which are computed in order by one GNA request, so the state of memory layers is passed from frame to frame.
+* Supported for 2D inputs and outputs, default value is NO
+*/
+DECLARE_GNA_CONFIG_KEY(UNROLL_FRAMES);
 }  // namespace GNAConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of the executable network to get the numbers of the helper layers the plugin inserted into
+ * the network, by their kind: Copy, Identity, Diagonal, ConcatAlignFilter, AffineFilter.
+ * Every helper layer is an additional GNA operation, connectivity and alignment of the concat and split buffers
+ * cause most of them
+ */
+DECLARE_METRIC_KEY(GNA_INSERTED_LAYERS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -247,6 +247,27 @@ static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, RemoteContext::
     return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
 }
 
+/**
+* @brief This function is used to obtain remote blob object over host memory which the GPU accesses directly.
+* On integrated GPU neither inference nor locking of such a blob copies the data
+* @param ptr A user host buffer aligned to 4096 bytes which outlives the blob,
+* or nullptr to let the plugin allocate the host memory
+*/
+static inline Blob::Ptr make_shared_host_blob(const TensorDesc& desc, RemoteContext::Ptr ctx, void* ptr = nullptr) {
+    auto casted = std::dynamic_pointer_cast<ClContext>(ctx);
+    if (nullptr == casted) {
+        THROW_IE_EXCEPTION << "Invalid remote context passed";
+    }
+
+    ParamMap params = {
+        { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(HOST_BUFFER) }
+    };
+    if (ptr != nullptr) {
+        params[GPU_PARAM_KEY(MEM_HANDLE)] = static_cast<gpu_handle_param>(ptr);
+    }
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
+}
+
 /**
 * @brief This function is used to obtain remote blob object from user-supplied cl::Image2D wrapper object
 */
@@ -90,6 +90,11 @@ DECLARE_GPU_PARAM_VALUE(VA_SURFACE);
 * @brief Shared D3D buffer blob
 */
 DECLARE_GPU_PARAM_VALUE(DX_BUFFER);
+/**
+* @brief Host memory blob the device accesses directly (zero copy on integrated GPU).
+* MEM_HANDLE is a user host pointer aligned to 4096 bytes. Without MEM_HANDLE the plugin allocates the memory
+*/
+DECLARE_GPU_PARAM_VALUE(HOST_BUFFER);
 
 /**
 * @brief This key identifies OpenCL memory handle
@@ -113,5 +118,12 @@ DECLARE_GPU_PARAM_KEY(DEV_OBJECT_HANDLE, uint32_t);
 */
 DECLARE_GPU_PARAM_KEY(VA_PLANE, uint32_t);
 
+/**
+* @brief This key identifies OpenCL event handle of the last inference which used a shared memory blob.
+* It is set when KEY_CLDNN_NON_BLOCKING_REMOTE_OUTPUTS is turned on, the users of the blob memory
+* outside of the plugin must wait for it
+*/
+DECLARE_GPU_PARAM_KEY(OCL_EVENT, gpu_handle_param);
+
 }  // namespace GPUContextParams
 }  // namespace InferenceEngine
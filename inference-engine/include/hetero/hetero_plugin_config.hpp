@@ -31,6 +31,12 @@ namespace HeteroConfigParams {
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 /**
  * @brief The key for enabling of dumping the topology with details of layers and details how
  * this network would be executed on different devices to the disk in GraphViz format.
@@ -38,5 +44,17 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key to choose how layers are assigned to devices if the network has no affinities set.
+ * This option should be used with values:
+ * HETERO_CONFIG_VALUE(PARTITIONING_PRIORITY) (default) - a layer is executed on the first device
+ * from TARGET_FALLBACK which supports it
+ * HETERO_CONFIG_VALUE(PARTITIONING_COST) - layers are moved between the devices which support them
+ * if it reduces the estimated latency, which includes the cost of moving tensors between subgraphs
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING);
+DECLARE_HETERO_CONFIG_VALUE(PARTITIONING_PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(PARTITIONING_COST);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
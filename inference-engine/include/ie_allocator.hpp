@@ -13,6 +13,9 @@
 
 #include <details/ie_irelease.hpp>
 
+#include <limits>
+#include <memory>
+
 namespace InferenceEngine {
 
 /**
@@ -70,8 +73,35 @@ protected:
 /**
  * @brief Creates the default implementation of the Inference Engine allocator per plugin.
  *
+ * The blobs created without an allocator, including the input and output blobs of the infer requests, use it.
+ * It allocates the memory with the allocator set by SetDefaultAllocator or with the system one.
+ *
  * @return The Inference Engine IAllocator* instance
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Sets the allocator used by the default allocators which are created after the call.
+ *
+ * The allocator is shared by all the plugins and Core objects of the process and must be thread-safe.
+ * The blobs which are already allocated keep their memory.
+ *
+ * @param allocator The allocator, nullptr restores the system one
+ */
+INFERENCE_ENGINE_API(void) SetDefaultAllocator(const std::shared_ptr<IAllocator>& allocator) noexcept;
+
+/**
+ * @brief Creates a thread-safe allocator which keeps the freed memory for the next allocations of the same size.
+ *
+ * Repeated creation of infer requests and blobs of the same shapes reuses the memory instead of
+ * returning it to the system. The kept memory is released with the allocator.
+ *
+ * @param upstream The allocator of the memory, nullptr means the system one
+ * @param capacity The maximal size in bytes of the kept memory, the rest of the freed memory is released
+ * @return The Inference Engine IAllocator* instance or nullptr on failure
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*) CreatePooledAllocator(
+    const std::shared_ptr<IAllocator>& upstream = nullptr,
+    size_t capacity = std::numeric_limits<size_t>::max()) noexcept;
+
 }  // namespace InferenceEngine
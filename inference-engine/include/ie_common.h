@@ -201,6 +201,27 @@ struct InferenceEngineProfileInfo {
      * @brief An execution index of the unit
      */
     unsigned execution_index;
+
+    /**
+     * @brief The hardware counters of the layer per execution, collected by the CPU plugin with
+     *        KEY_CPU_HW_PERF_COUNTERS. Zeros if they are not collected.
+     */
+    unsigned long long cycles = 0;
+    unsigned long long instructions = 0;  //!< Instructions retired
+    unsigned long long llc_misses = 0;  //!< Last level cache misses
+    unsigned long long bytes_read = 0;  //!< Bytes loaded from the memory, the lines missed in the last level cache
+    unsigned long long bytes_written = 0;  //!< Bytes stored to the memory, the lines missed in the last level cache
+
+    /**
+     * @brief The memory bandwidth achieved by the layer in GB/s, the bytes read and written per the real time
+     */
+    float bandwidth_GBps = 0.f;
+
+    /**
+     * @brief The compute throughput achieved by the layer in GFLOP/s, zero for the layers without a known number
+     *        of floating point operations
+     */
+    float compute_GFLOPs = 0.f;
 };
 
 /**
@@ -343,4 +343,46 @@ public:
      */
     const Blob::Ptr& v() const noexcept;
 };
+
+/**
+ * @brief Represents a batch of images to be pre-processed into the batch of a network input in one inference
+ *
+ * The images are usually ROI blobs of one source image (e.g. the detections to be classified) and may have
+ * different sizes. Every image is resized and converted into its own item of the network input batch.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A virtual destructor. It is made out of line for RTTI to
+     * work correctly on some platforms.
+     */
+    virtual ~BatchedBlob();
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * The images are memory blobs, NV12 blobs or I420 blobs with the batch size 1, all of them of the same kind,
+     * precision and layout.
+     *
+     * @param blobs A vector of images that is copied to this object
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * @param blobs A vector of images that is moved to this object
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+};
 }  // namespace InferenceEngine
@@ -43,6 +43,31 @@ struct QueryNetworkResult {
     ResponseDesc resp;
 };
 
+/**
+ * @brief A model to read and load to a device with Core::LoadNetworks
+ */
+struct NetworkLoadEntry {
+    /**
+     * @brief A path to the model in IR or ONNX format
+     */
+    std::string modelPath;
+
+    /**
+     * @brief A path to the weights, see Core::ReadNetwork
+     */
+    std::string binPath;
+
+    /**
+     * @brief A name of the device to load the network to
+     */
+    std::string deviceName;
+
+    /**
+     * @brief A map of pairs: (config parameter name, config parameter value) relevant only for this load
+     */
+    std::map<std::string, std::string> config;
+};
+
 /**
  * @brief This class represents Inference Engine Core entity.
  *
@@ -124,6 +149,24 @@ public:
         const CNNNetwork& network, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Reads and loads a list of models in parallel
+     *
+     * Every worker thread reads a model and loads it to its device, so reading and transformation of one model
+     * overlap with the device compilation of others. The call is safe to run concurrently with other loads, but not
+     * with registration of plugins or extensions.
+     *
+     * @param entries The models to load
+     * @param numThreads The number of models loaded at once, 0 to use the number of CPU cores
+     * @param memoryLimit The limit of the total size in bytes of the model files loaded at once, 0 for no limit.
+     * A model larger than the limit is loaded alone.
+     * @return Executable networks in the order of the entries
+     * @throws If a model fails, the remaining ones are not started and the error of the first failed model is
+     * thrown with its path after the started loads finish
+     */
+    std::vector<ExecutableNetwork> LoadNetworks(const std::vector<NetworkLoadEntry>& entries,
+                                                unsigned int numThreads = 0, size_t memoryLimit = 0);
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
@@ -238,6 +281,8 @@ public:
      *
      * @return A vector of devices. The devices are returned as { CPU, FPGA.0, FPGA.1, MYRIAD }
        If there more than one device of specific type, they are enumerated with .# suffix.
+     * @note The method loads the plugins of all the registered devices to query them, so applications which
+     * know their device should not call it on startup
      */
     std::vector<std::string> GetAvailableDevices() const;
 
@@ -285,7 +330,8 @@ public:
      * - `location` specifies absolute path to dynamic library with plugin. A path can also be relative to inference
      * engine shared library. It allows to have common config for different systems with different configurations.
      * - Properties are set to plugin via the `SetConfig` method.
-     * - Extensions are set to plugin via the `AddExtension` method.
+     * - Extensions are set to plugin via the `AddExtension` method when the plugin loads, imports or queries
+     * a network for the first time, the plugins themselves are loaded on the first use of their devices.
      *
      * @param xmlConfigFile A path to .xml file with plugins to register.
      */
@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the blobs which read the host-mappable DMA-BUF memory without copying it
+ *
+ * @file ie_dmabuf_blob.hpp
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "ie_compound_blob.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Describes an image plane stored in a DMA-BUF object
+ */
+struct DmaBufPlane {
+    /**
+     * @brief The offset in bytes of the plane from the start of the object
+     */
+    size_t offset;
+    /**
+     * @brief The distance in bytes between the starts of two consecutive rows of the plane
+     */
+    size_t pitch;
+};
+
+/**
+ * @brief Creates a NV12 compound blob which reads the Y and UV planes from the linear DMA-BUF object.
+ *
+ * The object is mapped into the host memory at the first access of the planes, so the
+ * preprocessing reads the decoded frame in place instead of a copy made by the application.
+ * The blob keeps its own duplicate of the descriptor, the caller may close @p fd after the call.
+ * The planes are mapped for reading only and must not be written.
+ * @note Available on Linux only
+ *
+ * @param height Height of the image
+ * @param width Width of the image
+ * @param fd The DMA-BUF file descriptor
+ * @param size The size in bytes of the DMA-BUF object
+ * @param y The Y plane of the image
+ * @param uv The interleaved UV plane of the image
+ * @return A shared pointer to the NV12 blob
+ */
+INFERENCE_ENGINE_API_CPP(NV12Blob::Ptr) make_shared_blob_nv12(size_t height, size_t width, int fd, size_t size,
+                                                              const DmaBufPlane& y, const DmaBufPlane& uv);
+
+}  // namespace InferenceEngine
@@ -164,8 +164,9 @@ public:
     /**
      * @brief Serialize network to IR and weights files.
      *
-     * @param xmlPath Path to output IR file.
-     * @param binPath Path to output weights file.
+     * @param xmlPath Path to output IR file. A path with the `.bir` extension writes the binary IR,
+     * the single file format read by the binary IR reader
+     * @param binPath Path to output weights file. Skipped for the binary IR
      * @param resp Pointer to the response message that holds a description of an error if any occurred
      * @return Status code of the operation
      */
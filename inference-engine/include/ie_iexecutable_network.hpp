@@ -165,6 +165,22 @@ public:
      * @return code of the operation. InferenceEngine::OK if succeeded
      */
     virtual StatusCode GetContext(RemoteContext::Ptr& pContext, ResponseDesc* resp) const noexcept = 0;
+
+    /**
+     * @brief Infers several independent sets of inputs in one call.
+     *
+     * The call returns when all the sets are inferred. The sets are spread over the streams of the device, the devices
+     * which support it infer them without an asynchronous request and a callback per set, so the call suits small
+     * networks with many inferences, e.g. embedding lookups. An error of any set fails the call.
+     *
+     * @param inputs The input blobs of each set, every set must contain all the network inputs
+     * @param outputs Resized to the number of the sets. The output blobs found in the map of a set receive its results,
+     * the missing ones are allocated
+     * @param resp Pointer to the response message that holds a description of an error if any occurred
+     * @return code of the operation. InferenceEngine::OK if succeeded
+     */
+    virtual StatusCode InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs,
+                                  ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -178,6 +178,50 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Sets the scheduling priority of the following asynchronous inferences of the request.
+     *
+     * Requests of a higher priority waiting for the same executor are executed first, among the requests of the same
+     * priority the one with the earliest deadline goes first. Requests with the default priority (0) and without
+     * a deadline are executed in the order they were started, requests with a negative priority only when no other
+     * requests wait. Devices which do not reorder requests ignore the hints.
+     *
+     * @param priority The priority of the request, 0 is the default
+     * @param deadline_us The latency budget of every inference in microseconds, counted from its start. 0 means no deadline
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode SetPriority(int priority, int64_t deadline_us, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Binds the following inferences of the request to the states of a session.
+     *
+     * The states of stateful networks, e.g. of the Memory layers, are kept per session instead of per request, so
+     * a few requests can serve many independent streams of data by switching between their sessions. The states
+     * of a session are created with zeros by its first inference, a session can be used by one request at a time.
+     * Binding a request to a session does not copy the states.
+     *
+     * @param session_id The identifier of the session, a negative value binds the request back to the states of the
+     * executable network reported by IExecutableNetwork::QueryState
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode SetStateSession(int64_t session_id, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Releases the states of a session to the pool of the executable network of the request.
+     *
+     * The next inference with the identifier starts a new session with zero states.
+     *
+     * @param session_id The identifier of the session
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual InferenceEngine::StatusCode ReleaseStateSession(int64_t session_id, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -12,6 +12,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -158,6 +160,142 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a bool value which is `true` if the device supports ExportNetwork / ImportNetwork.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". Core uses the metric to decide whether compiled networks
+ * can be stored in the cache directory set via KEY_CACHE_DIR.
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get a number of inferences in which the device used the memory of a user blob directly
+ * instead of copying the data to / from the internal memory.
+ *
+ * String value is "ZERO_COPY_INFERENCES". The map is keyed by the names of network inputs and outputs.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ZERO_COPY_INFERENCES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get a number of bytes of the executable network memory resident on each NUMA node.
+ *
+ * String value is "NUMA_NODES_MEMORY_PLACEMENT". The pages which were not touched yet are not counted.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT, std::map<int, uint64_t>);
+
+/**
+ * @brief Metric to get a number of bytes of the executable network memory by the type of the pages backing it.
+ *
+ * String value is "MEMORY_PAGE_TYPES". The types are DEFAULT_PAGES, TRANSPARENT_HUGE_PAGES (regular pages which
+ * the system merges into 2MB pages when it can), HUGE_PAGES_2MB and HUGE_PAGES_1GB, see KEY_CPU_HUGE_PAGES.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_PAGE_TYPES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the max number of bytes of device memory allocated by the memory pool of the executable network.
+ *
+ * String value is "MEMORY_POOL_PEAK". If the pool is shared by several networks (e.g. all GPU networks of
+ * a remote context), the value covers all of them.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_POOL_PEAK, uint64_t);
+
+/**
+ * @brief Metric to get a share of memory pool requests served by already allocated buffers, in the range [0, 1].
+ *
+ * String value is "MEMORY_POOL_REUSE_RATE".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_POOL_REUSE_RATE, float);
+
+/**
+ * @brief Metric to get a share of reused buffers memory which is not used by the requests they served, in the range [0, 1].
+ *
+ * String value is "MEMORY_POOL_FRAGMENTATION".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_POOL_FRAGMENTATION, float);
+
+/**
+ * @brief Metric to get a number of primitives which were taken from the primitives cache instead of being created.
+ *
+ * String value is "PRIMITIVES_CACHE_HITS".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(PRIMITIVES_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get a number of primitives which were not found in the primitives cache and were created.
+ *
+ * String value is "PRIMITIVES_CACHE_MISSES".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(PRIMITIVES_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get time spent in phases of the network load, in microseconds.
+ *
+ * String value is "LOAD_TIME_PHASES". Nested phases are named after their parents, e.g. "load/transformations/common".
+ * Time of phases executed by several threads in parallel is summed over the threads.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LOAD_TIME_PHASES, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the peak resident memory of the process during the network load, in bytes.
+ *
+ * String value is "LOAD_PEAK_MEMORY". On Linux the peak is reset when the load starts, so the value does not
+ * depend on what the process did before; on other systems it is the peak of the process lifetime. Memory of other
+ * threads of the process is included. 0 if the system does not report it.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LOAD_PEAK_MEMORY, uint64_t);
+
+/**
+ * @brief Metric to get whether every stream of the network has already run an inference, so the lazy
+ * initialization of kernels and memory is done and next inferences run at the steady state speed.
+ *
+ * String value is "NETWORK_HOT". Networks loaded with WARMUP set to YES are hot once they are loaded.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_HOT, bool);
+
+/**
+ * @brief Metric to get the counters of the task queue and the workers of the network executor, and of the
+ * stages of the infer requests pipelines.
+ *
+ * String value is "EXECUTOR_STATISTICS". The counters are cheap enough to be always on and only grow, so the rates are
+ * differences of two queries:
+ * - "queued_tasks", "started_tasks", "stolen_tasks" (taken from the queue of another stream) and "queue_depth"
+ * - "wait_time_us" - the time the tasks spent in the queue including the ones waiting at the moment
+ * - "stream_<i>_busy_time_us" and "stream_<i>_idle_time_us" - the time every stream executed and waited for tasks
+ * - "stage_<i>_runs" and "stage_<i>_wait_time_us" - the time the stages of the pipelines waited for their executors,
+ *   the first stage one is the time the inferences were queued
+ * - with KEY_MAX_QUEUED_INFER_REQUESTS set: "admitted_requests", "rejected_requests", "blocked_requests",
+ *   "admission_wait_time_us" - the time the blocked starts waited, and "pending_requests" - the inferences
+ *   started and not completed at the moment
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(EXECUTOR_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the histograms of the execution times of the layers sampled with PERF_COUNT_SAMPLING.
+ *
+ * String value is "LAYER_TIME_HISTOGRAMS". Every layer name maps to the number of samples, the sum of the times in
+ * microseconds and 32 buckets: the first one counts the times below a microsecond, the i-th one the times in
+ * [2^(i-1), 2^i) microseconds. The histograms accumulate the samples of all the streams since the network was loaded.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LAYER_TIME_HISTOGRAMS, std::map<std::string, std::vector<uint64_t>>);
+
+/**
+ * @brief Metric to get the histogram of the latencies of the inferences.
+ *
+ * String value is "INFER_LATENCY_HISTOGRAM". The number of inferences, the sum of their latencies in microseconds
+ * and 32 buckets as of LAYER_TIME_HISTOGRAMS. The latency is the time of the inference in a stream, without the
+ * time the request waited for the stream. The histogram accumulates the inferences of all the streams.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(INFER_LATENCY_HISTOGRAM, std::vector<uint64_t>);
+
+/**
+ * @brief Metric to get the streams configuration the network is executed with.
+ *
+ * String value is "STREAMS_CONFIGURATION". The map contains "streams", "threads_per_stream" and
+ * "optimal_infer_requests". With KEY_CPU_THROUGHPUT_STREAMS set to CPU_THROUGHPUT_AUTO the number of streams
+ * is picked by the arithmetic intensity of the network, reported as "flops_per_byte", which is 0 otherwise.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_CONFIGURATION, std::map<std::string, float>);
+
 }  // namespace Metrics
 
 /**
@@ -219,6 +357,189 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The key defines the logical processors the CPU streams are bound to
+ *
+ * The value is a list of CPU lists separated with ';', a CPU list has the sysfs format, e.g. "0-15;16-31,48".
+ * The streams are divided evenly between the lists in their order, and threads of the streams sharing a list are
+ * bound to their own processors of the list. The lists take the place of the binding chosen by KEY_CPU_BIND_THREAD.
+ * "" (default) binds the threads as KEY_CPU_BIND_THREAD defines.
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_CPU_LISTS);
+
+/**
+ * @brief The key defines the logical processors the CPU streams are never bound to, e.g. the ones of I/O threads
+ *
+ * The value is a CPU list in the sysfs format, e.g. "0,1,30-31". It is applied to the KEY_CPU_STREAMS_CPU_LISTS and to
+ * the binding of PluginConfigParams::YES of KEY_CPU_BIND_THREAD. "" (default) reserves no processors.
+ */
+DECLARE_CONFIG_KEY(CPU_RESERVED_CPUS);
+
+/**
+ * @brief The key defines whether the CPU streams threads are bound to the hyper-threading siblings of the cores
+ *
+ * PluginConfigParams::YES (default) uses all the logical processors, PluginConfigParams::NO only the first one of
+ * every physical core. It is applied together with KEY_CPU_RESERVED_CPUS.
+ */
+DECLARE_CONFIG_KEY(CPU_BIND_SMT_SIBLINGS);
+
+/**
+ * @brief The key defines the weight of the network in the division of the CPU_THREADS_BUDGET between networks
+ *
+ * It is a positive integer, the default is 1. Active networks get parts of the budget proportional to their weights.
+ */
+DECLARE_CONFIG_KEY(CPU_NETWORK_PRIORITY);
+
+/**
+ * @brief The key defines the number of CPU threads which all the CPU executable networks of the process may use at once
+ *
+ * The key is handled by Core for the whole process and is not passed to plugins. The budget is divided between the
+ * networks which have requests in flight in proportion to their CPU_NETWORK_PRIORITY, a network gets at most all of its
+ * streams and at least one. Idle networks lend their part to the busy ones. The budget limits the number of streams
+ * which execute requests at once, the threads of a stream are not changed. "0" (default) disables the limits,
+ * so every network uses its streams as if it owned the machine.
+ */
+DECLARE_CONFIG_KEY(CPU_THREADS_BUDGET);
+
+/**
+ * @brief The maximal number of input shapes the CPU plugin keeps compiled graphs for in each stream
+ *
+ * When it is a positive integer, infer requests accept input blobs with dimensions which differ from the network
+ * ones, and the plugin reshapes the already transformed network and creates the graph for the new shape once.
+ * The least recently used graph is released when the limit is exceeded. Weights are shared by all the graphs.
+ * Output blobs are reallocated when their dimensions change, so they must be got by GetBlob() after the inference.
+ * Zero (default) disables the mode.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The maximal number of unused primitives the CPU plugin keeps for an executable network
+ *
+ * Primitives of destroyed graphs are kept in the cache, so graphs created later for the same input shapes
+ * (see KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) in any stream take them instead of generating the code again.
+ * The primitives are identified by the node, its attributes and memory descriptors. The least recently
+ * released primitives are destroyed when the limit is exceeded. Zero (default) disables the cache.
+ */
+DECLARE_CONFIG_KEY(CPU_PRIMITIVES_CACHE_SIZE);
+
+/**
+ * @brief The directory where the CPU plugin keeps the weights reordered into the layouts of the primitives
+ *
+ * The weights are stored once and memory mapped by every executable network of every process loading a network
+ * with the same weights on the same CPU, so they are neither reordered nor duplicated in memory again. Files are
+ * identified by the content of the weights, the layout and the ISA of the primitive, they can be removed at any
+ * time. The directory must exist. Empty string (default) disables the store.
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief The name for setting the sharing of the reordered weights between the executable networks of the CPU plugin
+ *
+ * The weights are identified by their content, the layout and the ISA of the primitive, so the networks sharing a part
+ * of the weights, e.g. multi-task heads with the same backbone loaded as separate networks, keep a single copy of it
+ * in memory, whatever the names of their layers. The option should be used with values:
+ * - PluginConfigParams::NO (default) the weights are shared only between the streams of an executable network
+ * - PluginConfigParams::YES the weights are shared between all executable networks, a single stream one included
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS);
+
+/**
+ * @brief The name for setting the number of the implementations the CPU plugin times per convolution at load time
+ *
+ * The convolutions are executed with each of the implementations supported for the actual shapes of the network,
+ * e.g. the direct, the winograd and the GEMM ones, and the fastest of them is used by all the streams. The choice
+ * is kept by Export, so an imported network is not tuned again. The layers with PrimitivesPriority set are not tuned.
+ * The value is a non-negative integer, 0 (default) disables the tuning.
+ */
+DECLARE_CONFIG_KEY(CPU_CONVOLUTION_TUNING);
+
+/**
+ * @brief The name for setting the strategy the CPU plugin uses to place intermediate tensors in the reused memory
+ *
+ * Tensors are placed in order of decreasing size, this option should be used with values:
+ * - CPU_MEMORY_SOLVER_FIRST_FIT (default) lifts a tensor over every tensor it lives together with
+ * - CPU_MEMORY_SOLVER_BEST_FIT puts a tensor into the smallest fitting gap between the tensors it lives together with
+ * The allocated size is reported by the "memoryReuse" parameter of the executable graph inputs.
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_SOLVER);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_FIRST_FIT);
+DECLARE_CONFIG_VALUE(CPU_MEMORY_SOLVER_BEST_FIT);
+
+/**
+ * @brief The name for setting the pages the CPU plugin backs the weights and the intermediate tensors with
+ *
+ * It reduces TLB misses of the networks with large weights or intermediate tensors, this option should be used with values:
+ * - PluginConfigParams::NO (default) regular pages
+ * - PluginConfigParams::YES the intermediate tensors are allocated with 2MB pages of the reserved huge page pool
+ *   or with transparent huge pages if the pool has not enough free pages
+ * - CPU_HUGE_PAGES_1GB as YES, but 1GB pages of the reserved pool are tried first for the intermediate tensors of
+ *   at least 512MB
+ * The weights are filled during the load, so they are advised to be merged into transparent huge pages.
+ * The system falls back to regular pages silently, the result is reported by the MEMORY_PAGE_TYPES metric.
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_1GB);
+
+/**
+ * @brief The minimal share of zero weights which makes the CPU plugin keep the weights of a layer in a sparse format
+ *
+ * The value is a float number in the range [0, 1]. FullyConnected layers with constant FP32 weights which have at
+ * least this share of zeros skip the zero weights instead of multiplying them. Zero (default) disables the mode.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_RATE);
+
+/**
+ * @brief The minimal size of the weights, in megabytes, which makes the CPU plugin split a layer across NUMA nodes
+ *
+ * The value is a non-negative integer. On a multi-socket host a network executed by a single stream splits the
+ * constant FP32 weights of each FullyConnected layer that is at least this large along the output channels. Every
+ * NUMA node keeps its slice in the local memory and computes the matching outputs with its own threads, so the layer
+ * is bound by the memory bandwidth of all the sockets. The slices are copies, so the split layers take twice the
+ * memory for their weights. It is used only by the plugin built with TBB threading. Zero (default) disables the split.
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_SPLIT_WEIGHTS_SIZE);
+
+/**
+ * @brief The name for setting the depth first execution of the CPU plugin
+ *
+ * When it is YES, chains of consecutive convolutions, poolings, activations and eltwises are executed image after
+ * image of the batch, so the intermediate tensors of an image stay in L2 cache. Chains are only formed when the
+ * tensors of the whole batch do not fit the cache. NO (default) executes every layer for the whole batch.
+ */
+DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_EXECUTION);
+
+/**
+ * @brief The name for setting the selective INT8 execution of the CPU plugin
+ *
+ * When it is YES, low precision transformations keep depthwise convolutions and fully connected layers with less
+ * than 16 output channels in FP32: for them the INT8 kernels do not fill a vector register, and the requantization
+ * and reorders cost more than the INT8 computations save. The transformed network, ExportNetwork stores, keeps
+ * the choice. NO (default) quantizes every layer that can be quantized.
+ */
+DECLARE_CONFIG_KEY(CPU_SELECTIVE_INT8);
+
+/**
+ * @brief The name for setting the concurrent execution of independent nodes by the CPU plugin
+ *
+ * When it is YES, consecutive nodes of the topological order which do not depend on each other and do not share
+ * memory are executed at the same time by one stream, each of them by a part of the stream threads. It speeds up
+ * networks with parallel branches of small layers (e.g. Inception like blocks) that do not load all the threads.
+ * It is used only by the plugin built with TBB threading. NO (default) executes the nodes one after another.
+ */
+DECLARE_CONFIG_KEY(CPU_CONCURRENT_NODES_EXECUTION);
+
+/**
+ * @brief The name for setting the early exits of the CPU plugin for the cascaded networks
+ *
+ * The value is a comma separated list of "output:threshold" pairs, e.g. "exit1/prob:0.9,exit2/prob:0.8", of the FP32
+ * network outputs computed by the cheap intermediate heads. The nodes the early exits depend on are executed first,
+ * and the inference stops right after an exit whose every image has an element not less than the threshold (e.g.
+ * the probability of the top class). The outputs which are not computed by the stopped inference have undefined
+ * content. Networks with memory states do not support the early exits. Empty string (default) always executes
+ * the whole network.
+ */
+DECLARE_CONFIG_KEY(CPU_EARLY_EXITS);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -239,6 +560,56 @@ DECLARE_CONFIG_KEY(GPU_THROUGHPUT_STREAMS);
  */
 DECLARE_CONFIG_KEY(PERF_COUNT);
 
+/**
+ * @brief The name for setting the sampling of the per layer execution times.
+ *
+ * A non-negative integer N, every N-th inference of a stream times its layers and adds the times to the histograms
+ * reported by the LAYER_TIME_HISTOGRAMS metric. The other inferences do not time the layers, so a large N keeps the
+ * overhead negligible. Zero (default) disables the sampling. It is independent of PERF_COUNT and can be changed
+ * for a loaded network with ExecutableNetwork::SetConfig(). Supported by the CPU plugin.
+ */
+DECLARE_CONFIG_KEY(PERF_COUNT_SAMPLING);
+
+/**
+ * @brief The name for setting the hardware performance counters of the layers in the CPU plugin.
+ *
+ * With PluginConfigParams::YES and PERF_COUNT set to YES the cycles, instructions, last level cache misses and
+ * the bytes read and written by the threads of the stream are counted for every layer and reported by
+ * InferRequest::GetPerformanceCounts() together with the achieved GB/s and GFLOP/s. The counters are opened with
+ * perf_event_open, so they are available on Linux only and depend on /proc/sys/kernel/perf_event_paranoid.
+ * The layers executed concurrently (CPU_CONCURRENT_NODES_EXECUTION) count the events of each other.
+ * PluginConfigParams::NO (default) disables the counters.
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
+/**
+ * @brief The size of the tiles, in pixels, the CPU plugin splits the large input images of fully convolutional networks into
+ *
+ * When it is a positive integer, the network is compiled for a window of the tile and the halo computed from the
+ * receptive field of the outputs, and infer requests accept NCHW input blobs of any height and width which are
+ * multiples of the product of the strides and are not smaller than the window. The tiles are inferred by all the
+ * streams of the executable network, each of them copies its window of the input, and their outputs are stitched
+ * into the output blobs, which are the same as of the network reshaped for the whole image. The memory of the
+ * graphs is limited by the window size. Output blobs are reallocated when their dimensions change, so they must
+ * be got by GetBlob() after the inference. The network must have a single 4D input and only convolutions,
+ * deconvolutions, poolings and the layers computing each pixel from the same pixel of their inputs.
+ * Zero (default) disables the mode.
+ */
+DECLARE_CONFIG_KEY(CPU_TILE_SIZE);
+
+/**
+ * @brief The name for setting the latency critical mode of the CPU plugin, for the bounded worst case latency
+ *
+ * With PluginConfigParams::YES the idle threads of the streams spin for the inferences instead of sleeping, and all
+ * the memory of the graphs is touched when the network is loaded (at least as with WARMUP_MEMORY) and locked in RAM,
+ * so the inferences neither wait for the threads to wake up nor take page faults. The ie_parallel loops of the
+ * nodes already divide the work statically. Combine it with KEY_CPU_STREAMS_CPU_LISTS set to the isolated cores,
+ * the spinning threads keep their cores busy. The memory is locked up to RLIMIT_MEMLOCK. The latency of every
+ * inference is reported by the INFER_LATENCY_HISTOGRAM metric regardless of the mode.
+ * PluginConfigParams::NO (default) disables the mode.
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_CRITICAL);
+
 /**
  * @brief The key defines dynamic limit of batch processing.
  *
@@ -290,8 +661,11 @@ DECLARE_CONFIG_KEY(DUMP_KERNELS);
  * PluginConfigParams::TUNING_CREATE - create tuning data for parameters not present in tuning file
  * PluginConfigParams::TUNING_UPDATE - perform non-tuning updates like removal of invalid/deprecated data
  * PluginConfigParams::TUNING_RETUNE - create tuning data for all parameters, even if already present
+ * PluginConfigParams::TUNING_BACKGROUND - use existing data from tuning file and create the missing data in a
+ * low-priority background task, so the network is loaded without waiting for the tuning
  *
- * For values TUNING_CREATE and TUNING_RETUNE the file will be created if it does not exist.
+ * For values TUNING_CREATE, TUNING_RETUNE and TUNING_BACKGROUND the file will be created if it does not exist.
+ * With TUNING_BACKGROUND the tuned kernels are used by the networks loaded after the tuning of a network is done.
  */
 DECLARE_CONFIG_KEY(TUNING_MODE);
 
@@ -300,6 +674,7 @@ DECLARE_CONFIG_VALUE(TUNING_USE_EXISTING);
 DECLARE_CONFIG_VALUE(TUNING_DISABLED);
 DECLARE_CONFIG_VALUE(TUNING_UPDATE);
 DECLARE_CONFIG_VALUE(TUNING_RETUNE);
+DECLARE_CONFIG_VALUE(TUNING_BACKGROUND);
 
 /**
  * @brief This key defines the tuning data filename to be created/used
@@ -341,6 +716,28 @@ DECLARE_CONFIG_KEY(DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
 
+/**
+ * @brief This key limits the number of the inferences which wait for the streams of an executable network
+ *
+ * When all the streams are busy, the started inferences wait in the queue of the network, and under bursts
+ * the queue and the latency grow without a bound. A positive value N allows at most N inferences more than
+ * the number of streams to be started and not completed yet. 0 (default) does not limit the queue.
+ * The inferences over the limit are handled as KEY_QUEUED_INFER_REQUESTS_POLICY defines.
+ */
+DECLARE_CONFIG_KEY(MAX_QUEUED_INFER_REQUESTS);
+
+/**
+ * @brief This key defines what happens to the inferences over KEY_MAX_QUEUED_INFER_REQUESTS
+ *
+ * - CONFIG_VALUE(QUEUE_REJECT) (default) - StartAsync and Infer fail with REQUEST_BUSY status at once,
+ *   so the load can be shed to another device or server
+ * - CONFIG_VALUE(QUEUE_BLOCK) - StartAsync and Infer wait for another inference to complete. The completion
+ *   callbacks may start the next inferences, as the inference is completed before its callback is called
+ */
+DECLARE_CONFIG_KEY(QUEUED_INFER_REQUESTS_POLICY);
+DECLARE_CONFIG_VALUE(QUEUE_REJECT);
+DECLARE_CONFIG_VALUE(QUEUE_BLOCK);
+
 /**
  * @brief This key enables dumping of the internal primitive graph.
  *
@@ -362,5 +759,39 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief This key defines the directory which will be used to store compiled networks
+ *
+ * The key is handled by Core and is not passed to plugins. When it is set, Core::LoadNetwork computes a hash
+ * of the network, device name and compile configuration, and imports the compiled network from the
+ * directory on a hit. On a miss the network is compiled as usual and exported to the directory.
+ * Devices which do not report the IMPORT_EXPORT_SUPPORT metric always compile networks.
+ * An empty value (default) disables the cache.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
+/**
+ * @brief This key defines the file to record a timeline of inference in the Chrome trace format
+ *
+ * The key is handled by Core for the whole process and is not passed to plugins. When it is set, plugins record
+ * events of infer requests, their pipeline stages and layers, and the file is written when tracing is stopped
+ * by setting an empty value (default) or on the process exit. The file can be opened with chrome://tracing.
+ */
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
+/**
+ * @brief This key defines the work done by LoadNetwork to avoid the slow first inference
+ *
+ * The first inference of a stream is slower than the next ones: memory of the network is backed by physical pages
+ * on the first access only, and kernels may be finalized by the first execution. The values are:
+ * - CONFIG_VALUE(NO) (default) - nothing is done in advance
+ * - CONFIG_VALUE(WARMUP_MEMORY) - all the memory of the network is touched by the threads of the streams
+ * - CONFIG_VALUE(YES) - the memory is touched and every stream runs an inference on zero inputs. Networks with
+ *   memory states are not inferred, so the states are kept intact.
+ * The NETWORK_HOT metric reports if the streams of the network ran an inference.
+ */
+DECLARE_CONFIG_KEY(WARMUP);
+DECLARE_CONFIG_VALUE(WARMUP_MEMORY);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines the host blobs which read Video Acceleration surfaces without copying them.
+ * Unlike the remote blobs of gpu_context_api_va.hpp, they can be used by any plugin which runs
+ * the preprocessing on the host, e.g. CPU.
+ *
+ * @file ie_va_blob.hpp
+ */
+#pragma once
+
+#include <unistd.h>
+
+#include <va/va.h>
+#include <va/va_drmcommon.h>
+
+#include "ie_dmabuf_blob.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief This function is used to obtain a NV12 compound blob object from NV12 VA decoder output.
+ * The surface is exported as a DMA-BUF object which is mapped into the host memory at the first access.
+ * @note The surface must have the linear memory layout, and requires libva 2.1 or newer
+ */
+static inline NV12Blob::Ptr make_shared_blob_nv12(size_t height, size_t width,
+                                                  VADisplay display, VASurfaceID nv12_surf) {
+    if (vaSyncSurface(display, nv12_surf) != VA_STATUS_SUCCESS) {
+        THROW_IE_EXCEPTION << "Failed to synchronize VA surface " << nv12_surf;
+    }
+
+    VADRMPRIMESurfaceDescriptor prime = {};
+    if (vaExportSurfaceHandle(display, nv12_surf, VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2,
+                              VA_EXPORT_SURFACE_READ_ONLY | VA_EXPORT_SURFACE_COMPOSED_LAYERS,
+                              &prime) != VA_STATUS_SUCCESS) {
+        THROW_IE_EXCEPTION << "Failed to export VA surface " << nv12_surf;
+    }
+    auto closeObjects = [&prime] {
+        for (uint32_t i = 0; i < prime.num_objects; ++i) {
+            ::close(prime.objects[i].fd);
+        }
+    };
+
+    // both planes of a linear NV12 surface are stored in a single object
+    const auto& layer = prime.layers[0];
+    if (prime.fourcc != VA_FOURCC_NV12 || prime.num_objects != 1 || prime.objects[0].drm_format_modifier != 0
+        || prime.num_layers != 1 || layer.num_planes != 2 || layer.object_index[0] != 0 || layer.object_index[1] != 0) {
+        closeObjects();
+        THROW_IE_EXCEPTION << "VA surface " << nv12_surf << " is not a linear NV12 surface";
+    }
+
+    NV12Blob::Ptr blob;
+    try {
+        blob = make_shared_blob_nv12(height, width, prime.objects[0].fd, prime.objects[0].size,
+                                     DmaBufPlane{layer.offset[0], layer.pitch[0]},
+                                     DmaBufPlane{layer.offset[1], layer.pitch[1]});
+    } catch (...) {
+        closeObjects();
+        throw;
+    }
+    // the blob keeps its own descriptor
+    closeObjects();
+    return blob;
+}
+
+}  // namespace InferenceEngine
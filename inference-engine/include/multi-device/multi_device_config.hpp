@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include "ie_plugin_config.hpp"
 
@@ -27,6 +28,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -35,5 +42,34 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy for the infer requests:
+ * MULTI_CONFIG_VALUE(PRIORITY) (default) - an idle device request is taken in the device priority order
+ * MULTI_CONFIG_VALUE(LATENCY) - a request is sent to the device with the earliest expected completion,
+ *                               estimated from the moving average of the device inference latency and its load
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY);
+
+/**
+ * @brief Tuning of the number of the worker requests of the devices at runtime, PluginConfigParams::YES or
+ * PluginConfigParams::NO (default). The devices without the number of requests set in the device priorities start
+ * with their OPTIMAL_NUMBER_OF_INFER_REQUESTS and get one more request while the throughput of the device grows.
+ * The tuning stops when a request only increases the latency. Up to twice the optimal number of requests is created
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUESTS_AUTO_TUNING);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of the executable network to get the number of the worker requests that every device currently uses
+ *
+ * String value is "MULTI_DEVICE_REQUESTS"
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_REQUESTS, std::map<std::string, unsigned int>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
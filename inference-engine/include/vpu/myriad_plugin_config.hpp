@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include "ie_plugin_config.hpp"
 #include "ie_api.h"
@@ -30,6 +32,13 @@
 #define DECLARE_VPU_MYRIAD_CONFIG_KEY(name) DECLARE_CONFIG_KEY(VPU_MYRIAD_##name)
 #define DECLARE_VPU_MYRIAD_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(VPU_MYRIAD_##name)
 
+/**
+ * @def VPU_MYRIAD_METRIC(name)
+ * @brief Shortcut for defining VPU MYRIAD metric key
+ */
+#define VPU_MYRIAD_METRIC(name) METRIC_KEY(VPU_MYRIAD_##name)
+#define DECLARE_VPU_MYRIAD_METRIC(name, ...)  DECLARE_METRIC_KEY(VPU_MYRIAD_##name, __VA_ARGS__)
+
 namespace InferenceEngine {
 
 namespace VPUConfigParams {
@@ -66,6 +75,44 @@ DECLARE_VPU_MYRIAD_CONFIG_VALUE(SAMSUNG_2GB);
 DECLARE_VPU_MYRIAD_CONFIG_VALUE(HYNIX_2GB);
 DECLARE_VPU_MYRIAD_CONFIG_VALUE(MICRON_1GB);
 
+/**
+ * @brief The number of devices the compiled network is replicated to.
+ * Inference requests are dispatched to the least busy replica.
+ * The value 0 means all available devices, default is 1.
+ * The option is ignored if CONFIG_KEY(DEVICE_ID) is set.
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(DEVICE_POOL_SIZE);
+
 }  // namespace VPUConfigParams
 
+namespace Metrics {
+
+/**
+ * @brief Metric to get the names of the devices a network is loaded to, String value is "VPU_MYRIAD_DEVICE_NAMES"
+ */
+DECLARE_VPU_MYRIAD_METRIC(DEVICE_NAMES, std::vector<std::string>);
+
+/**
+ * @brief Metric to get the fraction of time each device of a network was busy with inference,
+ * String value is "VPU_MYRIAD_DEVICE_UTILIZATION"
+ */
+DECLARE_VPU_MYRIAD_METRIC(DEVICE_UTILIZATION, std::vector<float>);
+
+/**
+ * @brief Metric to get the number of inferences completed on each device of a network,
+ * String value is "VPU_MYRIAD_DEVICE_INFER_COUNT"
+ */
+DECLARE_VPU_MYRIAD_METRIC(DEVICE_INFER_COUNT, std::vector<unsigned int>);
+
+/**
+ * @brief Metric to get the memory allocation statistics of a compiled network,
+ * String value is "VPU_MYRIAD_MEMORY_STATISTICS".
+ * The keys are BSS_USED, BSS_PEAK_LIVE, BSS_FRAGMENTATION (percent), CMX_USED, CMX_PEAK_LIVE,
+ * CMX_FRAGMENTATION (percent) and CMX_SPILLED, sizes are in bytes.
+ * The map is empty for imported networks.
+ */
+DECLARE_VPU_MYRIAD_METRIC(MEMORY_STATISTICS, std::map<std::string, unsigned int>);
+
+}  // namespace Metrics
+
 }  // namespace InferenceEngine
@@ -100,6 +100,34 @@ static const char dump_config_message[] = "Optional. Path to XML/YAML/JSON file
 static const char shape_message[] = "Optional. Set shape for input. For example, \"input1[1,3,224,224],input2[1,4]\" or \"[1,3,224,224]\""
                                     " in case of one input size.";
 
+// @brief message for request rate option
+static const char rate_message[] = "Optional. Start infer requests at a fixed rate (requests per second) instead of as soon as "
+                                   "a request becomes idle. Latency is measured from the scheduled start time, so it includes "
+                                   "the time spent waiting for an idle request. Only for the async API.";
+
+// @brief message for io_threads option
+static const char io_threads_message[] = "Optional. Number of host producer threads, which copy fresh input data from a pool of the "
+                                         "prepared inputs to a request before every start, and of consumer threads, which read all "
+                                         "the outputs of a request after it completes. The throughput then includes the host I/O work "
+                                         "of a service. Default is 0 (the inputs are filled once). Only for the async API.";
+
+// @brief message for models option
+static const char models_message[] = "Optional. Comma-separated list of models to load to the same device and run concurrently, "
+                                     "instead of the single model set by -m. Throughput and latency are reported per model. "
+                                     "Only for the async API.";
+
+// @brief message for models_nireq option
+static const char models_nireq_message[] = "Optional. Comma-separated number of infer requests for every model from -models. "
+                                           "If not specified, the optimal number of requests of each network is used.";
+
+// @brief message for models_nstreams option
+static const char models_nstreams_message[] = "Optional. Comma-separated number of streams for every model from -models. "
+                                              "Supported for a single CPU or GPU device only.";
+
+// @brief message for models_weights option
+static const char models_weights_message[] = "Optional. Comma-separated relative weights of the models from -models. "
+                                             "Used together with -rate to split the request rate between the models.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -184,6 +212,25 @@ DEFINE_string(load_config, "", load_config_message);
 DEFINE_string(dump_config, "", dump_config_message);
 #endif
 
+/// @brief Define flag for open-loop request rate <br>
+/// Default is 0 (that means closed loop)
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Define flag for number of host input/output threads <br>
+DEFINE_uint32(io_threads, 0, io_threads_message);
+
+/// @brief Define flag for models running concurrently <br>
+DEFINE_string(models, "", models_message);
+
+/// @brief Define flag for number of infer requests of every model <br>
+DEFINE_string(models_nireq, "", models_nireq_message);
+
+/// @brief Define flag for number of streams of every model <br>
+DEFINE_string(models_nstreams, "", models_nstreams_message);
+
+/// @brief Define flag for request rate weights of every model <br>
+DEFINE_string(models_weights, "", models_weights_message);
+
 /// @brief Define flag for input shape <br>
 DEFINE_string(shape, "", shape_message);
 
@@ -213,6 +260,13 @@ static void showUsage() {
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -io_threads \"<integer>\"   " << io_threads_message << std::endl;
+    std::cout << std::endl << "  Concurrent models options:" << std::endl;
+    std::cout << "    -models \"<paths>\"         " << models_message << std::endl;
+    std::cout << "    -models_nireq \"<list>\"    " << models_nireq_message << std::endl;
+    std::cout << "    -models_nstreams \"<list>\" " << models_nstreams_message << std::endl;
+    std::cout << "    -models_weights \"<list>\"  " << models_weights_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
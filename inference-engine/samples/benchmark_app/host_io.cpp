@@ -0,0 +1,145 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "host_io.hpp"
+
+using namespace InferenceEngine;
+
+HostIOWorkers::Workers::Workers(size_t threads) {
+    for (size_t i = 0; i < threads; i++) {
+        _threads.emplace_back([this] {
+            while (true) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+                    if (_tasks.empty())
+                        return;
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        });
+    }
+}
+
+HostIOWorkers::Workers::~Workers() {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void HostIOWorkers::Workers::run(std::function<void()> task) {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+}
+
+HostIOWorkers::HostIOWorkers(size_t threads,
+                             InferRequestsQueue& queue,
+                             const ConstInputsDataMap& inputs,
+                             const ConstOutputsDataMap& outputs) :
+    _queue(queue), _producers(threads), _consumers(threads) {
+    for (auto& input : inputs) {
+        _inputNames.push_back(input.first);
+    }
+    for (auto& output : outputs) {
+        _outputNames.push_back(output.first);
+    }
+
+    for (auto& request : _queue.requests) {
+        std::vector<std::vector<uint8_t>> requestInputs;
+        for (auto& name : _inputNames) {
+            auto blob = as<MemoryBlob>(request->getBlob(name));
+            if (!blob) {
+                THROW_IE_EXCEPTION << "Input " << name << " is not a memory blob";
+            }
+            auto holder = blob->rmap();
+            auto data = holder.as<const uint8_t*>();
+            requestInputs.emplace_back(data, data + blob->byteSize());
+        }
+        _pool.push_back(std::move(requestInputs));
+    }
+
+    _queue.setCompletionHandler([this](size_t id, const double latency) {
+        _consumers.run([this, id, latency] {
+            try {
+                readOutputs(*_queue.requests.at(id));
+            } catch (...) {
+                fail();
+            }
+            _queue.putIdleRequest(id, latency);
+        });
+    });
+}
+
+HostIOWorkers::~HostIOWorkers() {
+    _queue.setCompletionHandler(nullptr);
+}
+
+void HostIOWorkers::startAsync(InferReqWrap::Ptr request, Time::time_point startTime) {
+    _producers.run([this, request, startTime] {
+        try {
+            fillInputs(*request);
+            request->startAsync(startTime);
+        } catch (...) {
+            fail();
+            // the request is not started, so it is returned to the idle ones to not block the measurement
+            _queue.putIdleRequest(request->getId(), 0.0);
+        }
+    });
+}
+
+void HostIOWorkers::rethrowIfFailed() {
+    std::unique_lock<std::mutex> lock(_errorMutex);
+    if (_error) {
+        std::rethrow_exception(_error);
+    }
+}
+
+void HostIOWorkers::fillInputs(InferReqWrap& request) {
+    auto& inputs = _pool[_nextInputs++ % _pool.size()];
+    for (size_t i = 0; i < _inputNames.size(); i++) {
+        auto blob = as<MemoryBlob>(request.getBlob(_inputNames[i]));
+        auto holder = blob->wmap();
+        std::memcpy(holder.as<uint8_t*>(), inputs[i].data(), inputs[i].size());
+    }
+}
+
+void HostIOWorkers::readOutputs(InferReqWrap& request) {
+    size_t checksum = 0;
+    for (auto& name : _outputNames) {
+        auto blob = as<MemoryBlob>(request.getBlob(name));
+        if (!blob) {
+            THROW_IE_EXCEPTION << "Output " << name << " is not a memory blob";
+        }
+        auto holder = blob->rmap();
+        auto data = holder.as<const uint8_t*>();
+        for (size_t i = 0; i < blob->byteSize(); i++) {
+            checksum += data[i];
+        }
+    }
+    _outputsChecksum += checksum;
+}
+
+void HostIOWorkers::fail() {
+    std::unique_lock<std::mutex> lock(_errorMutex);
+    if (!_error) {
+        _error = std::current_exception();
+    }
+}
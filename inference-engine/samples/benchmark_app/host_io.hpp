@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Host threads doing the input and output work of a service around the inferences.
+/// Producers copy the next inputs from the pool to a request and start it, consumers read all the outputs
+/// of a completed request before it becomes idle again.
+class HostIOWorkers final {
+public:
+    /// @param threads Number of the producer threads and of the consumer threads
+    /// @param queue The queue of the requests, the inputs they are filled with become the pool of the inputs
+    HostIOWorkers(size_t threads,
+                  InferRequestsQueue& queue,
+                  const InferenceEngine::ConstInputsDataMap& inputs,
+                  const InferenceEngine::ConstOutputsDataMap& outputs);
+
+    ~HostIOWorkers();
+
+    /// @brief Fills the inputs of the request and starts it on a producer thread
+    void startAsync(InferReqWrap::Ptr request, Time::time_point startTime);
+
+    /// @brief Rethrows the first error of the producers or consumers
+    void rethrowIfFailed();
+
+private:
+    class Workers {
+    public:
+        explicit Workers(size_t threads);
+        ~Workers();
+        void run(std::function<void()> task);
+
+    private:
+        std::vector<std::thread> _threads;
+        std::deque<std::function<void()>> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _stop = false;
+    };
+
+    void fillInputs(InferReqWrap& request);
+    void readOutputs(InferReqWrap& request);
+    void fail();
+
+    InferRequestsQueue& _queue;
+    std::vector<std::string> _inputNames;
+    std::vector<std::string> _outputNames;
+    // the inputs of every request as they were filled before the measurement
+    std::vector<std::vector<std::vector<uint8_t>>> _pool;
+    std::atomic<size_t> _nextInputs{0};
+    // keeps the outputs read, so reading them is not optimized away
+    std::atomic<size_t> _outputsChecksum{0};
+
+    std::mutex _errorMutex;
+    std::exception_ptr _error;
+
+    Workers _producers;
+    Workers _consumers;
+};
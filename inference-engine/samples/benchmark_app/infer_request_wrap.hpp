@@ -42,7 +42,11 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    void startAsync(Time::time_point startTime) {
+        _startTime = startTime;
         _request.StartAsync();
     }
 
@@ -61,6 +65,10 @@ public:
         return _request.GetPerformanceCounts();
     }
 
+    size_t getId() const {
+        return _id;
+    }
+
     InferenceEngine::Blob::Ptr getBlob(const std::string &name) {
         return _request.GetBlob(name);
     }
@@ -82,7 +90,7 @@ class InferRequestsQueue final {
 public:
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
         for (size_t id = 0; id < nireq; id++) {
-            requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this,
+            requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::completeRequest, this,
                                                                                  std::placeholders::_1,
                                                                                  std::placeholders::_2)));
             _idleIds.push(id);
@@ -102,18 +110,41 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _completionTimes.clear();
     }
 
     double getDurationInMilliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
+    /// @brief Completed requests are passed to the handler instead of becoming idle, the handler calls putIdleRequest()
+    void setCompletionHandler(QueueCallbackFunction handler) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _completionHandler = handler;
+    }
+
+    void completeRequest(size_t id,
+                         const double latency) {
+        QueueCallbackFunction handler;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            handler = _completionHandler;
+        }
+        if (handler) {
+            handler(id, latency);
+        } else {
+            putIdleRequest(id, latency);
+        }
+    }
+
     void putIdleRequest(size_t id,
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
+        auto now = Time::now();
         _latencies.push_back(latency);
+        _completionTimes.push_back(now);
         _idleIds.push(id);
-        _endTime = std::max(Time::now(), _endTime);
+        _endTime = std::max(now, _endTime);
         _cv.notify_one();
     }
 
@@ -135,6 +166,16 @@ public:
         return _latencies;
     }
 
+    /// @brief Completion times of the requests, in the order of getLatencies(), relative to the first start
+    std::vector<double> getCompletionTimesInMilliseconds() {
+        std::vector<double> times;
+        times.reserve(_completionTimes.size());
+        for (auto& time : _completionTimes) {
+            times.push_back(std::chrono::duration_cast<ns>(time - _startTime).count() * 0.000001);
+        }
+        return times;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +185,6 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<Time::time_point> _completionTimes;
+    QueueCallbackFunction _completionHandler;
 };
@@ -6,7 +6,10 @@
 #include <chrono>
 #include <memory>
 #include <map>
+#include <numeric>
+#include <exception>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -23,6 +26,7 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "host_io.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
@@ -47,14 +51,35 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models.empty()) {
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_m.empty() && !FLAGS_models.empty()) {
+        throw std::logic_error("Please set either -m or -models option, not both.");
+    }
+
+    if (!FLAGS_models.empty() && FLAGS_api != "async") {
+        throw std::logic_error("Concurrent models are supported only for the async API (-models option).");
+    }
+
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_rate < 0.0) {
+        throw std::logic_error("Incorrect request rate. Please set -rate option to a positive value.");
+    }
+
+    if (FLAGS_rate > 0.0 && FLAGS_api != "async") {
+        throw std::logic_error("Fixed request rate is supported only for the async API (-rate option).");
+    }
+
+    if (FLAGS_io_threads > 0 && (FLAGS_api != "async" || !FLAGS_models.empty())) {
+        throw std::logic_error("Host input/output threads are supported only for the async API with a single model "
+                               "(-io_threads option).");
+    }
+
     if (!FLAGS_report_type.empty() &&
         FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -93,13 +118,296 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+static std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+/// @brief Prints time of the load phases and the peak memory of the load recorded by the device,
+/// if it supports the LOAD_TIME_PHASES and LOAD_PEAK_MEMORY metrics
+static void reportLoadTimePhases(ExecutableNetwork& exeNetwork, const std::shared_ptr<StatisticsReport>& statistics) {
+    std::map<std::string, uint64_t> phases;
+    uint64_t peakMemory = 0;
+    try {
+        std::vector<std::string> metrics = exeNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(LOAD_PEAK_MEMORY)) != metrics.end())
+            peakMemory = exeNetwork.GetMetric(METRIC_KEY(LOAD_PEAK_MEMORY)).as<uint64_t>();
+        if (std::find(metrics.begin(), metrics.end(), METRIC_KEY(LOAD_TIME_PHASES)) != metrics.end())
+            phases = exeNetwork.GetMetric(METRIC_KEY(LOAD_TIME_PHASES)).as<std::map<std::string, uint64_t>>();
+    } catch (const std::exception&) {
+        return;
+    }
+    if (peakMemory != 0) {
+        auto peak_mb = double_to_string(peakMemory / (1024.0 * 1024.0));
+        slog::info << "Load network peak memory: " << peak_mb << " MB" << slog::endl;
+        if (statistics)
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {"load peak memory (MB)", peak_mb}
+                                      });
+    }
+    if (phases.empty())
+        return;
+    // nested phases are named after their parents, so the sorted names make a tree
+    slog::info << "Load network phases:" << slog::endl;
+    for (auto& phase : phases) {
+        auto depth = std::count(phase.first.begin(), phase.first.end(), '/');
+        auto duration_ms = double_to_string(phase.second * 0.001);
+        slog::info << std::string(2 * depth + 2, ' ') << phase.first.substr(phase.first.rfind('/') + 1)
+                   << ": " << duration_ms << " ms" << slog::endl;
+        if (statistics)
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {"load phase " + phase.first + " (ms)", duration_ms}
+                                      });
+    }
+}
+
+/// @brief Per-model option from a comma-separated list, or the default value if the list is empty
+static std::string getModelOption(const std::vector<std::string>& values, size_t index,
+                                  size_t modelsCount, const std::string& option, const std::string& defaultValue) {
+    if (values.empty())
+        return defaultValue;
+    if (values.size() != modelsCount)
+        throw std::logic_error("Number of values of -" + option + " option doesn't match the number of models in -models option");
+    return values.at(index);
+}
+
+/**
+* @brief Loads several models to the same device and measures them while they run concurrently.
+* Every model gets its own infer requests, driven by a dedicated thread, so the models compete for
+* the device as they would in a co-located deployment.
+*/
+static void runModelsConcurrently(Core& ie, const std::string& device_name,
+                                  const std::vector<std::string>& inputFiles,
+                                  const std::shared_ptr<StatisticsReport>& statistics) {
+    struct Model {
+        std::string path;
+        std::string label;
+        ExecutableNetwork exeNetwork;
+        size_t batchSize = 1;
+        uint32_t nireq = 0;
+        double weight = 1.0;
+        std::unique_ptr<InferRequestsQueue> queue;
+        size_t iteration = 0;
+        std::exception_ptr error;
+    };
+
+    auto paths = split(FLAGS_models, ',');
+    auto nireqs = split(FLAGS_models_nireq, ',');
+    auto nstreams = split(FLAGS_models_nstreams, ',');
+    auto weights = split(FLAGS_models_weights, ',');
+    auto devices = parseDevices(device_name);
+    if (!nstreams.empty() && (devices.size() != 1 || devices.front() != device_name ||
+                              (device_name != "CPU" && device_name != "GPU"))) {
+        throw std::logic_error("-models_nstreams option is supported for a single CPU or GPU device only");
+    }
+
+    std::vector<Model> models(paths.size());
+    double weightsSum = 0.0;
+    for (size_t i = 0; i < models.size(); i++) {
+        models[i].path = paths[i];
+        models[i].nireq = std::stoul(getModelOption(nireqs, i, models.size(), "models_nireq", "0"));
+        models[i].weight = std::stod(getModelOption(weights, i, models.size(), "models_weights", "1"));
+        if (models[i].weight <= 0.0)
+            throw std::logic_error("Weights of -models_weights option should be positive");
+        weightsSum += models[i].weight;
+    }
+
+    // ----------------- 4-7. Reading the networks and loading them to the device ----------------------------------
+    next_step("for " + std::to_string(models.size()) + " models");
+    next_step();
+    next_step();
+    next_step();
+    for (size_t i = 0; i < models.size(); i++) {
+        auto& model = models[i];
+        std::map<std::string, std::string> loadConfig;
+        auto modelNStreams = getModelOption(nstreams, i, models.size(), "models_nstreams", "");
+        if (!modelNStreams.empty())
+            loadConfig[device_name + "_THROUGHPUT_STREAMS"] = modelNStreams;
+
+        auto startTime = Time::now();
+        if (fileExt(model.path) == "blob") {
+            model.exeNetwork = ie.ImportNetwork(model.path, device_name, loadConfig);
+            model.label = fileNameNoExt(model.path);
+        } else {
+            CNNNetwork cnnNetwork = ie.ReadNetwork(model.path);
+            const InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+            if ((FLAGS_b != 0) && (cnnNetwork.getBatchSize() != FLAGS_b)) {
+                InferenceEngine::ICNNNetwork::InputShapes shapes = cnnNetwork.getInputShapes();
+                if (adjustShapesBatch(shapes, FLAGS_b, inputInfo))
+                    cnnNetwork.reshape(shapes);
+            }
+            for (auto& item : inputInfo) {
+                if (isImage(item.second))
+                    item.second->setPrecision(Precision::U8);
+            }
+            model.batchSize = cnnNetwork.getBatchSize();
+            model.label = cnnNetwork.getName();
+            model.exeNetwork = ie.LoadNetwork(cnnNetwork, device_name, loadConfig);
+        }
+        model.label = "model " + std::to_string(i) + " (" + model.label + ")";
+        auto duration_ms = double_to_string(std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001);
+        slog::info << "Load of " << model.label << " took " << duration_ms << " ms" << slog::endl;
+        if (statistics)
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {model.label + " load network time (ms)", duration_ms}
+                                      });
+    }
+
+    // ----------------- 8. Setting optimal runtime parameters -----------------------------------------------------
+    next_step();
+    for (auto& model : models) {
+        if (model.nireq == 0)
+            model.nireq = model.exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        if (statistics)
+            statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                      {
+                                              {model.label + " path", model.path},
+                                              {model.label + " batch size", std::to_string(model.batchSize)},
+                                              {model.label + " number of parallel infer requests", std::to_string(model.nireq)},
+                                              {model.label + " weight", double_to_string(model.weight)},
+                                      });
+    }
+
+    uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t :
+                                (FLAGS_niter == 0 ? deviceDefaultDeviceDurationInSeconds(device_name) : 0);
+    auto duration = std::chrono::nanoseconds(getDurationInNanoseconds(duration_seconds));
+    if (statistics)
+        statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                  {
+                                          {"target device", device_name},
+                                          {"number of models", std::to_string(models.size())},
+                                          {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                  });
+
+    // ----------------- 9. Creating infer requests and filling input blobs ----------------------------------------
+    next_step();
+    for (auto& model : models) {
+        model.queue.reset(new InferRequestsQueue(model.exeNetwork, model.nireq));
+        fillBlobs(inputFiles, model.batchSize, model.exeNetwork.GetInputsInfo(), model.queue->requests);
+    }
+
+    // ----------------- 10. Measuring performance ------------------------------------------------------------------
+    next_step("Start inference of " + std::to_string(models.size()) + " models concurrently");
+
+    // warming up - out of scope
+    for (auto& model : models) {
+        model.queue->getIdleRequest()->startAsync();
+    }
+    for (auto& model : models) {
+        model.queue->waitAll();
+        model.queue->resetTimes();
+    }
+
+    auto startTime = Time::now();
+    auto runModel = [&] (Model& model) {
+        try {
+            // with -rate, the rate is split between the models proportionally to their weights
+            double rate = FLAGS_rate * model.weight / weightsSum;
+            auto rateInterval = rate > 0.0 ? std::chrono::duration<double>(1.0 / rate) : std::chrono::duration<double>(0.0);
+            auto& queue = *model.queue;
+            while ((FLAGS_niter != 0 && model.iteration < FLAGS_niter) ||
+                   (duration.count() != 0 && Time::now() - startTime < duration) ||
+                   (model.iteration % model.nireq != 0)) {
+                auto scheduledTime = startTime + std::chrono::duration_cast<Time::duration>(rateInterval * model.iteration);
+                if (rate > 0.0) {
+                    std::this_thread::sleep_until(scheduledTime);
+                }
+                auto inferRequest = queue.getIdleRequest();
+                inferRequest->wait();
+                if (rate > 0.0) {
+                    inferRequest->startAsync(scheduledTime);
+                } else {
+                    inferRequest->startAsync();
+                }
+                model.iteration++;
+            }
+            queue.waitAll();
+        } catch (...) {
+            model.error = std::current_exception();
+            model.queue->waitAll();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (auto& model : models) {
+        threads.emplace_back(runModel, std::ref(model));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+    for (auto& model : models) {
+        if (model.error)
+            std::rethrow_exception(model.error);
+    }
+
+    // ----------------- 11. Dumping statistics report -------------------------------------------------------------
+    next_step();
+
+    bool reportLatency = device_name.find("MULTI") == std::string::npos;
+    double totalFps = 0.0;
+    double totalInFlight = 0.0;
+    for (size_t i = 0; i < models.size(); i++) {
+        auto& model = models[i];
+        auto latencies = model.queue->getLatencies();
+        LatencyMetrics latency(latencies);
+        double modelDuration = model.queue->getDurationInMilliseconds();
+        double fps = model.batchSize * 1000.0 * model.iteration / modelDuration;
+        // average number of requests of the model executed at the same time
+        double inFlight = std::accumulate(latencies.begin(), latencies.end(), 0.0) / modelDuration;
+        totalFps += fps;
+        totalInFlight += inFlight;
+
+        std::cout << model.label << ":" << std::endl;
+        std::cout << "    Count:      " << model.iteration << " iterations" << std::endl;
+        std::cout << "    Duration:   " << double_to_string(modelDuration) << " ms" << std::endl;
+        if (reportLatency) {
+            std::cout << "    Latency:    " << double_to_string(latency.median) << " ms (p90 " << double_to_string(latency.p90)
+                      << ", p95 " << double_to_string(latency.p95) << ", p99 " << double_to_string(latency.p99)
+                      << ", max " << double_to_string(latency.max) << ")" << std::endl;
+        }
+        std::cout << "    Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        std::cout << "    In flight:  " << double_to_string(inFlight) << " requests on average" << std::endl;
+
+        if (statistics) {
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {model.label + " total execution time (ms)", double_to_string(modelDuration)},
+                                              {model.label + " total number of iterations", std::to_string(model.iteration)},
+                                              {model.label + " throughput", double_to_string(fps)},
+                                              {model.label + " average requests in flight", double_to_string(inFlight)},
+                                      });
+            if (reportLatency) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {model.label + " latency (ms)", double_to_string(latency.median)},
+                                                  {model.label + " latency p90 (ms)", double_to_string(latency.p90)},
+                                                  {model.label + " latency p95 (ms)", double_to_string(latency.p95)},
+                                                  {model.label + " latency p99 (ms)", double_to_string(latency.p99)},
+                                                  {model.label + " latency max (ms)", double_to_string(latency.max)},
+                                          });
+                statistics->dumpLatencies(latencies, model.queue->getCompletionTimesInMilliseconds(),
+                                          "model" + std::to_string(i));
+            }
+        }
+    }
+
+    std::cout << "Total:" << std::endl;
+    std::cout << "    Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
+    std::cout << "    Throughput: " << double_to_string(totalFps) << " FPS" << std::endl;
+    std::cout << "    In flight:  " << double_to_string(totalInFlight) << " requests on average" << std::endl;
+    if (statistics) {
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                          {"total execution time (ms)", double_to_string(totalDuration)},
+                                          {"aggregate throughput", double_to_string(totalFps)},
+                                          {"aggregate requests in flight", double_to_string(totalInFlight)},
+                                  });
+        statistics->dump();
+    }
 }
 
 /**
@@ -290,11 +598,11 @@ int main(int argc, char *argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
-        auto double_to_string = [] (const double number) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(2) << number;
-            return ss.str();
-        };
+        if (!FLAGS_models.empty()) {
+            runModelsConcurrently(ie, device_name, inputFiles, statistics);
+            return 0;
+        }
+
         auto get_total_ms_time = [] (Time::time_point& startTime) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
@@ -371,6 +679,7 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"load network time (ms)", duration_ms}
                                           });
+            reportLoadTimePhases(exeNetwork, statistics);
         } else {
             next_step();
             slog::info << "Skipping the step for compiled network" << slog::endl;
@@ -453,6 +762,18 @@ int main(int argc, char *argv[]) {
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (FLAGS_rate > 0.0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"request rate (requests/s)", double_to_string(FLAGS_rate)},
+                                          });
+            }
+            if (FLAGS_io_threads > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"host I/O threads", std::to_string(FLAGS_io_threads)},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -506,6 +827,12 @@ int main(int argc, char *argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (FLAGS_rate > 0.0) {
+            ss << ", " << FLAGS_rate << " requests per second";
+        }
+        if (FLAGS_io_threads > 0) {
+            ss << ", " << FLAGS_io_threads << " host input and " << FLAGS_io_threads << " host output threads";
+        }
         next_step(ss.str());
 
         // warming up - out of scope
@@ -520,10 +847,29 @@ int main(int argc, char *argv[]) {
             inferRequest->startAsync();
         }
         inferRequestsQueue.waitAll();
+        auto firstInferenceLatencies = inferRequestsQueue.getLatencies();
+        if (!firstInferenceLatencies.empty()) {
+            // the first inference includes lazy initialization of the device, so it is a part of the startup time
+            auto duration_ms = double_to_string(firstInferenceLatencies.front());
+            slog::info << "First inference took " << duration_ms << " ms" << slog::endl;
+            if (statistics)
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"first inference time (ms)", duration_ms}
+                                          });
+        }
         inferRequestsQueue.resetTimes();
 
+        // the inputs filled above become the pool the host threads copy fresh inputs from before every start
+        std::unique_ptr<HostIOWorkers> hostIO;
+        if (FLAGS_io_threads > 0) {
+            hostIO.reset(new HostIOWorkers(FLAGS_io_threads, inferRequestsQueue, info, exeNetwork.GetOutputsInfo()));
+        }
+
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        // interval between scheduled starts of the open-loop mode
+        auto rateInterval = FLAGS_rate > 0.0 ? std::chrono::duration<double>(1.0 / FLAGS_rate) : std::chrono::duration<double>(0.0);
 
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
@@ -532,6 +878,13 @@ int main(int argc, char *argv[]) {
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            // In the open-loop mode requests are started on schedule, regardless of how fast previous ones complete.
+            // The wait for an idle request belongs to the latency of the scheduled one.
+            auto scheduledTime = startTime + std::chrono::duration_cast<Time::duration>(rateInterval * iteration);
+            if (FLAGS_rate > 0.0) {
+                std::this_thread::sleep_until(scheduledTime);
+            }
+
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -539,6 +892,13 @@ int main(int argc, char *argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (hostIO) {
+                hostIO->rethrowIfFailed();
+                inferRequest->wait();
+                hostIO->startAsync(inferRequest, FLAGS_rate > 0.0 ? scheduledTime : Time::now());
+            } else if (FLAGS_rate > 0.0) {
+                inferRequest->wait();
+                inferRequest->startAsync(scheduledTime);
             } else {
                 // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
                 // The primary reason for calling the method is exception checking/re-throwing.
@@ -567,10 +927,13 @@ int main(int argc, char *argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
+        if (hostIO) {
+            hostIO->rethrowIfFailed();
+        }
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        LatencyMetrics latency(inferRequestsQueue.getLatencies());
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
+        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency.median :
                      batchSize * 1000.0 * iteration / totalDuration;
 
         if (statistics) {
@@ -582,7 +945,13 @@ int main(int argc, char *argv[]) {
             if (device_name.find("MULTI") == std::string::npos) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
-                                                  {"latency (ms)", double_to_string(latency)},
+                                                  {"latency (ms)", double_to_string(latency.median)},
+                                                  {"latency avg (ms)", double_to_string(latency.avg)},
+                                                  {"latency min (ms)", double_to_string(latency.min)},
+                                                  {"latency p90 (ms)", double_to_string(latency.p90)},
+                                                  {"latency p95 (ms)", double_to_string(latency.p95)},
+                                                  {"latency p99 (ms)", double_to_string(latency.p99)},
+                                                  {"latency max (ms)", double_to_string(latency.max)},
                                           });
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -628,13 +997,25 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        if (statistics)
+        if (statistics) {
+            if (device_name.find("MULTI") == std::string::npos) {
+                statistics->dumpLatencies(inferRequestsQueue.getLatencies(),
+                                          inferRequestsQueue.getCompletionTimesInMilliseconds());
+            }
             statistics->dump();
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
-            std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+        if (device_name.find("MULTI") == std::string::npos) {
+            std::cout << "Latency:    " << double_to_string(latency.median) << " ms" << std::endl;
+            std::cout << "    avg:    " << double_to_string(latency.avg) << " ms" << std::endl;
+            std::cout << "    min:    " << double_to_string(latency.min) << " ms" << std::endl;
+            std::cout << "    p90:    " << double_to_string(latency.p90) << " ms" << std::endl;
+            std::cout << "    p95:    " << double_to_string(latency.p95) << " ms" << std::endl;
+            std::cout << "    p99:    " << double_to_string(latency.p99) << " ms" << std::endl;
+            std::cout << "    max:    " << double_to_string(latency.max) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -7,9 +7,32 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 #include "statistics_report.hpp"
 
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) : count(latencies.size()) {
+    if (latencies.empty())
+        return;
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    // nearest-rank percentile
+    auto percentile = [&sorted] (double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+    };
+    median = (sorted.size() % 2 != 0) ?
+             sorted[sorted.size() / 2] :
+             (sorted[sorted.size() / 2] + sorted[sorted.size() / 2 - 1]) / 2.0;
+    avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    min = sorted.front();
+    p90 = percentile(90.0);
+    p95 = percentile(95.0);
+    p99 = percentile(99.0);
+    max = sorted.back();
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -132,3 +155,57 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Pefromance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLatencies(const std::vector<double> &latencies, const std::vector<double> &completionTimes,
+                                     const std::string &name) {
+    if (latencies.empty()) {
+        slog::info << "Latencies are empty. No latency report is dumped." << slog::endl;
+        return;
+    }
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_latency_report" +
+                           (name.empty() ? "" : "_" + name) + ".csv");
+
+    // Buckets of the histogram grow geometrically from min to max latency, so the tail gets
+    // as much resolution as the bulk of the distribution
+    static const size_t histogramBuckets = 20;
+    LatencyMetrics total(latencies);
+    double ratio = total.min > 0.0 ? std::pow(total.max / total.min, 1.0 / histogramBuckets) : 1.0;
+    std::vector<size_t> histogram(histogramBuckets, 0);
+    for (auto latency : latencies) {
+        size_t bucket = ratio > 1.0 ? static_cast<size_t>(std::log(latency / total.min) / std::log(ratio)) : 0;
+        histogram[std::min(bucket, histogramBuckets - 1)]++;
+    }
+
+    dumper << "Latency histogram";
+    dumper.endLine();
+    dumper << "from (ms)" << "to (ms)" << "count";
+    dumper.endLine();
+    double bound = total.min;
+    for (size_t i = 0; i < histogramBuckets; i++) {
+        double next = (i + 1 == histogramBuckets) ? total.max : bound * ratio;
+        dumper << bound << next << histogram[i];
+        dumper.endLine();
+        bound = next;
+    }
+    dumper.endLine();
+
+    std::vector<std::vector<double>> perSecond;
+    for (size_t i = 0; i < latencies.size() && i < completionTimes.size(); i++) {
+        size_t second = static_cast<size_t>(std::max(completionTimes[i], 0.0) / 1000.0);
+        if (perSecond.size() <= second)
+            perSecond.resize(second + 1);
+        perSecond[second].push_back(latencies[i]);
+    }
+
+    dumper << "Latency over time";
+    dumper.endLine();
+    dumper << "second" << "count" << "median (ms)" << "p90 (ms)" << "p95 (ms)" << "p99 (ms)" << "max (ms)";
+    dumper.endLine();
+    for (size_t second = 0; second < perSecond.size(); second++) {
+        LatencyMetrics metrics(perSecond[second]);
+        dumper << second << metrics.count;
+        dumper << metrics.median << metrics.p90 << metrics.p95 << metrics.p99 << metrics.max;
+        dumper.endLine();
+    }
+    slog::info << "Latency report is stored to " << dumper.getFilename() << slog::endl;
+}
@@ -19,6 +19,21 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Latency statistics of a set of executed infer requests, in milliseconds
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    size_t count = 0;
+    double median = 0.0;
+    double avg = 0.0;
+    double min = 0.0;
+    double p90 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -57,6 +72,13 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    /// @brief Dumps latency histogram and latency over time in one second buckets
+    /// @param latencies latency of every executed infer request
+    /// @param completionTimes completion time of every request relative to the start of measurements
+    /// @param name optional suffix of the report file name, to tell apart reports of concurrent models
+    void dumpLatencies(const std::vector<double> &latencies, const std::vector<double> &completionTimes,
+                       const std::string &name = "");
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
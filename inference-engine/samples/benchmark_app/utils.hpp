@@ -8,6 +8,7 @@
 #include <vector>
 #include <map>
 
+std::vector<std::string> split(const std::string &s, char delim);
 std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
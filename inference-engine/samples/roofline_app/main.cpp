@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <inference_engine.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "roofline_app.hpp"
+#include "roofline.hpp"
+
+using namespace InferenceEngine;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validating input arguments--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        showAvailableDevices();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Model is required but not set. Please set -m option.");
+    }
+    if (FLAGS_peak_gflops <= 0.0 || FLAGS_peak_gbps <= 0.0) {
+        throw std::logic_error("Peak compute throughput and memory bandwidth of the device are required. "
+                               "Please set positive -peak_gflops and -peak_gbps options.");
+    }
+    if (FLAGS_niter == 0) {
+        throw std::logic_error("Incorrect number of iterations. Please set -niter option to a positive value.");
+    }
+    return true;
+}
+
+/**
+* @brief The entry point of the roofline analysis application
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        // ----------------- 1. Reading the network and computing the costs of its operations --------------------
+        Core ie;
+        slog::info << "Loading network files" << slog::endl;
+        CNNNetwork network = ie.ReadNetwork(FLAGS_m);
+        auto function = network.getFunction();
+        if (!function) {
+            throw std::logic_error("The network is not represented as an nGraph function, the costs of the layers are unknown");
+        }
+        const auto costs = getOpCosts(function);
+
+        // ----------------- 2. Loading the network with the performance counters enabled ------------------------
+        slog::info << "Loading network to " << FLAGS_d << slog::endl;
+        std::map<std::string, std::string> config = {{ CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES) }};
+        ExecutableNetwork exeNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+        InferRequest request = exeNetwork.CreateInferRequest();
+
+        // the values of the inputs do not matter for the time of the most of the layers
+        for (const auto& input : network.getInputsInfo()) {
+            auto blob = as<MemoryBlob>(request.GetBlob(input.first));
+            if (!blob) {
+                throw std::logic_error("Input blob " + input.first + " is not a memory blob");
+            }
+            auto holder = blob->wmap();
+            std::memset(holder.as<uint8_t*>(), 0, blob->byteSize());
+        }
+
+        // ----------------- 3. Measuring the layers ------------------------------------------------------------
+        slog::info << "Running " << FLAGS_niter << " inferences" << slog::endl;
+        // the first inference initializes the primitives and is not a steady state
+        request.Infer();
+        for (uint32_t i = 0; i < FLAGS_niter; i++) {
+            request.Infer();
+        }
+        const auto perfCounts = request.GetPerformanceCounts();
+        CNNNetwork execGraph = exeNetwork.GetExecGraphInfo();
+
+        // ----------------- 4. Placing the layers on the roofline ----------------------------------------------
+        RooflineDevice device;
+        device.peakGflops = FLAGS_peak_gflops;
+        device.peakGbps = FLAGS_peak_gbps;
+        device.threshold = FLAGS_threshold;
+        const auto layers = getRooflineLayers(costs, execGraph, perfCounts, device);
+
+        std::cout << std::endl;
+        printRooflineReport(layers, device, std::cout);
+        if (!FLAGS_report_path.empty()) {
+            dumpRooflineReport(layers, FLAGS_report_path);
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return 3;
+    }
+
+    return 0;
+}
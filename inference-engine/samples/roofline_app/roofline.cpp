@@ -0,0 +1,267 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roofline.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <samples/slog.hpp>
+#include <samples/csv_dumper.hpp>
+
+namespace {
+
+// the key of the executable graph layers runtime info, see ExecGraphInfoSerialization in the plugin API
+const char originalNamesKey[] = "originalLayersNames";
+
+double product(const ngraph::Shape& shape, size_t begin) {
+    double value = 1.0;
+    for (size_t i = begin; i < shape.size(); i++)
+        value *= static_cast<double>(shape[i]);
+    return value;
+}
+
+double tensorBytes(const ngraph::element::Type& type, const ngraph::PartialShape& shape) {
+    if (shape.is_dynamic())
+        return 0.0;
+    return static_cast<double>(type.size()) * static_cast<double>(ngraph::shape_size(shape.to_shape()));
+}
+
+bool isStatic(const std::shared_ptr<const ngraph::Node>& op) {
+    for (size_t i = 0; i < op->get_input_size(); i++) {
+        if (op->get_input_partial_shape(i).is_dynamic())
+            return false;
+    }
+    for (size_t i = 0; i < op->get_output_size(); i++) {
+        if (op->get_output_partial_shape(i).is_dynamic())
+            return false;
+    }
+    return op->get_output_size() > 0;
+}
+
+double getFlops(const std::shared_ptr<const ngraph::Node>& op) {
+    if (!isStatic(op))
+        return 0.0;
+    const double outElements = static_cast<double>(ngraph::shape_size(op->get_output_shape(0)));
+    const std::string type = op->get_type_info().name;
+
+    // every output point of a convolution gathers its kernel over the input channels of its group,
+    // the filters are [O, I, K...] or [G, O/G, I/G, K...]
+    if (type == "Convolution" || type == "BinaryConvolution")
+        return 2.0 * outElements * product(op->get_input_shape(1), 1);
+    if (type == "GroupConvolution")
+        return 2.0 * outElements * product(op->get_input_shape(1), 2);
+    // every input point of a transposed convolution is scattered to its kernel over the output channels
+    const double inElements = op->get_input_size() > 0 ? static_cast<double>(ngraph::shape_size(op->get_input_shape(0))) : 0.0;
+    if (type == "ConvolutionBackpropData")
+        return 2.0 * inElements * product(op->get_input_shape(1), 1);
+    if (type == "GroupConvolutionBackpropData")
+        return 2.0 * inElements * product(op->get_input_shape(1), 2);
+
+    if (auto matMul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(op)) {
+        const auto& a = op->get_input_shape(0);
+        if (a.empty())
+            return 0.0;
+        const auto k = a.size() > 1 && matMul->get_transpose_a() ? a[a.size() - 2] : a.back();
+        return 2.0 * outElements * static_cast<double>(k);
+    }
+    if (auto pool = std::dynamic_pointer_cast<const ngraph::opset1::MaxPool>(op))
+        return outElements * product(pool->get_kernel(), 0);
+    if (auto pool = std::dynamic_pointer_cast<const ngraph::opset1::AvgPool>(op))
+        return outElements * product(pool->get_kernel(), 0);
+
+    if (std::dynamic_pointer_cast<const ngraph::op::util::BinaryElementwiseArithmetic>(op) ||
+        std::dynamic_pointer_cast<const ngraph::op::util::UnaryElementwiseArithmetic>(op))
+        return outElements;
+    return 0.0;
+}
+
+std::vector<std::string> split(const std::string& names) {
+    std::vector<std::string> values;
+    std::stringstream stream(names);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (!name.empty())
+            values.push_back(name);
+    }
+    return values;
+}
+
+struct ExecLayer {
+    std::vector<std::string> originals;
+    double ioBytes = 0.0;
+};
+
+std::map<std::string, ExecLayer> getExecLayers(InferenceEngine::CNNNetwork& execGraph) {
+    std::map<std::string, ExecLayer> layers;
+    auto function = execGraph.getFunction();
+    if (!function) {
+        slog::warn << "The executable graph is not an nGraph function, its layers are matched to the original "
+                      "operations by names" << slog::endl;
+        return layers;
+    }
+    for (const auto& op : function->get_ops()) {
+        auto& layer = layers[op->get_friendly_name()];
+        const auto& rtInfo = op->get_rt_info();
+        auto it = rtInfo.find(originalNamesKey);
+        if (it != rtInfo.end()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second))
+                layer.originals = split(value->get());
+        }
+        for (size_t i = 0; i < op->get_input_size(); i++)
+            layer.ioBytes += tensorBytes(op->get_input_element_type(i), op->get_input_partial_shape(i));
+        for (size_t i = 0; i < op->get_output_size(); i++)
+            layer.ioBytes += tensorBytes(op->get_output_element_type(i), op->get_output_partial_shape(i));
+    }
+    return layers;
+}
+
+}  // namespace
+
+std::map<std::string, OpCost> getOpCosts(const std::shared_ptr<const ngraph::Function>& function) {
+    std::map<std::string, OpCost> costs;
+    for (const auto& op : function->get_ops()) {
+        auto& cost = costs[op->get_friendly_name()];
+        cost.flops = getFlops(op);
+        for (size_t i = 0; i < op->get_input_size(); i++) {
+            auto bytes = tensorBytes(op->get_input_element_type(i), op->get_input_partial_shape(i));
+            auto producer = op->input_value(i).get_node_shared_ptr();
+            if (std::dynamic_pointer_cast<ngraph::opset1::Constant>(producer))
+                cost.constants[producer->get_friendly_name()] = bytes;
+            else
+                cost.ioBytes += bytes;
+        }
+        for (size_t i = 0; i < op->get_output_size(); i++)
+            cost.ioBytes += tensorBytes(op->get_output_element_type(i), op->get_output_partial_shape(i));
+    }
+    return costs;
+}
+
+std::vector<RooflineLayer> getRooflineLayers(const std::map<std::string, OpCost>& costs,
+                                             InferenceEngine::CNNNetwork& execGraph,
+                                             const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfCounts,
+                                             const RooflineDevice& device) {
+    const auto execLayers = getExecLayers(execGraph);
+    const double ridge = device.peakGflops / device.peakGbps;
+
+    std::vector<RooflineLayer> layers;
+    for (const auto& perfCount : perfCounts) {
+        const auto& info = perfCount.second;
+        if (info.status != InferenceEngine::InferenceEngineProfileInfo::EXECUTED || info.realTime_uSec <= 0)
+            continue;
+
+        RooflineLayer layer;
+        layer.name = perfCount.first;
+        layer.type = info.layer_type;
+        layer.timeUs = static_cast<double>(info.realTime_uSec);
+
+        auto exec = execLayers.find(layer.name);
+        std::vector<std::string> originals;
+        if (exec != execLayers.end())
+            originals = exec->second.originals;
+        if (originals.empty())
+            originals.push_back(layer.name);
+
+        for (const auto& original : originals) {
+            auto cost = costs.find(original);
+            if (cost == costs.end())
+                continue;
+            layer.flops += cost->second.flops;
+            if (exec == execLayers.end())
+                layer.bytes += cost->second.ioBytes;
+            // the constants which are not layers of the executable graph are read by the layer itself
+            for (const auto& constant : cost->second.constants) {
+                if (execLayers.count(constant.first) == 0)
+                    layer.bytes += constant.second;
+            }
+        }
+        if (exec != execLayers.end())
+            layer.bytes += exec->second.ioBytes;
+
+        layer.computeBound = layer.flops > 0.0 && layer.intensity() >= ridge;
+        if (layer.flops > 0.0) {
+            const double attainable = std::min(device.peakGflops, layer.intensity() * device.peakGbps);
+            layer.efficiency = attainable > 0.0 ? layer.gflops() / attainable : 0.0;
+        } else {
+            layer.efficiency = layer.gbps() / device.peakGbps;
+        }
+
+        if (layer.efficiency < device.threshold)
+            layer.flags.push_back("far_from_roofline");
+        if (layer.type == "Reorder")
+            layer.flags.push_back("reorder");
+        if (layer.type == "Eltwise" && originals.size() <= 1)
+            layer.flags.push_back("unfused_eltwise");
+        layers.push_back(layer);
+    }
+
+    std::sort(layers.begin(), layers.end(), [](const RooflineLayer& lhs, const RooflineLayer& rhs) {
+        return lhs.timeUs > rhs.timeUs;
+    });
+    return layers;
+}
+
+void printRooflineReport(const std::vector<RooflineLayer>& layers, const RooflineDevice& device, std::ostream& stream) {
+    double timeUs = 0.0, flops = 0.0, bytes = 0.0, idealTimeUs = 0.0;
+    for (const auto& layer : layers) {
+        timeUs += layer.timeUs;
+        flops += layer.flops;
+        bytes += layer.bytes;
+        // the time the layer would take on its roofline
+        idealTimeUs += std::max(layer.flops / device.peakGflops, layer.bytes / device.peakGbps) * 1e-3;
+    }
+
+    stream << std::left << std::setw(40) << "layer" << std::setw(16) << "type" << std::right
+           << std::setw(10) << "time_us" << std::setw(10) << "GFLOP" << std::setw(10) << "MB"
+           << std::setw(10) << "FLOP/B" << std::setw(10) << "GFLOP/s" << std::setw(10) << "GB/s"
+           << std::setw(9) << "bound" << std::setw(8) << "eff,%" << "  flags" << std::endl;
+    stream << std::fixed;
+    for (const auto& layer : layers) {
+        std::string flags;
+        for (const auto& flag : layer.flags)
+            flags += (flags.empty() ? "" : ",") + flag;
+        stream << std::left << std::setw(40) << layer.name.substr(0, 39) << std::setw(16) << layer.type.substr(0, 15)
+               << std::right << std::setprecision(0) << std::setw(10) << layer.timeUs
+               << std::setprecision(3) << std::setw(10) << layer.flops * 1e-9 << std::setw(10) << layer.bytes * 1e-6
+               << std::setprecision(2) << std::setw(10) << layer.intensity()
+               << std::setprecision(1) << std::setw(10) << layer.gflops() << std::setw(10) << layer.gbps()
+               << std::setw(9) << (layer.computeBound ? "compute" : "memory")
+               << std::setw(8) << layer.efficiency * 100.0 << "  " << flags << std::endl;
+    }
+
+    if (timeUs <= 0.0) {
+        stream << "No executed layers with performance counters" << std::endl;
+        return;
+    }
+    stream << std::endl << std::setprecision(1);
+    stream << "Total layers time:    " << timeUs << " us" << std::endl;
+    stream << "Compute throughput:   " << flops / timeUs * 1e-3 << " GFLOP/s, "
+           << flops / timeUs * 1e-3 / device.peakGflops * 100.0 << "% of peak" << std::endl;
+    stream << "Memory bandwidth:     " << bytes / timeUs * 1e-3 << " GB/s, "
+           << bytes / timeUs * 1e-3 / device.peakGbps * 100.0 << "% of peak" << std::endl;
+    stream << "Roofline efficiency:  " << idealTimeUs / timeUs * 100.0
+           << "% (time of the layers on their rooflines to the measured time)" << std::endl;
+    stream.unsetf(std::ios_base::floatfield);
+}
+
+void dumpRooflineReport(const std::vector<RooflineLayer>& layers, const std::string& path) {
+    CsvDumper dumper(true, path);
+    dumper << "layer" << "type" << "time_us" << "flops" << "bytes" << "flops_per_byte" << "gflops_per_s"
+           << "gb_per_s" << "bound" << "efficiency" << "flags";
+    dumper.endLine();
+    for (const auto& layer : layers) {
+        std::string flags;
+        for (const auto& flag : layer.flags)
+            flags += (flags.empty() ? "" : ",") + flag;
+        dumper << layer.name << layer.type << layer.timeUs << layer.flops << layer.bytes << layer.intensity()
+               << layer.gflops() << layer.gbps() << (layer.computeBound ? "compute" : "memory")
+               << layer.efficiency << flags;
+        dumper.endLine();
+    }
+    if (dumper.dumpEnabled())
+        slog::info << "Roofline report is stored to " << dumper.getFilename() << slog::endl;
+}
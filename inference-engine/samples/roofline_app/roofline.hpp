@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <ngraph/function.hpp>
+
+/**
+ * @brief The work of an operation: floating point operations and the bytes of its tensors
+ */
+struct OpCost {
+    double flops = 0.0;
+    /// the bytes of the inputs which are not constants and of the outputs
+    double ioBytes = 0.0;
+    /// the bytes of the constant inputs, e.g. weights, by the names of the constants
+    std::map<std::string, double> constants;
+};
+
+/**
+ * @brief Computes the costs of the operations of the function, the keys are the friendly names
+ * @details The FLOPs are counted for convolutions, matrix multiplications, pooling and element-wise
+ * arithmetic, a multiply-add counts as two operations. Other operations are treated as data movement only.
+ */
+std::map<std::string, OpCost> getOpCosts(const std::shared_ptr<const ngraph::Function>& function);
+
+/**
+ * @brief A layer of the executable graph placed on the roofline of the device
+ */
+struct RooflineLayer {
+    std::string name;
+    std::string type;
+    double timeUs = 0.0;
+    double flops = 0.0;
+    double bytes = 0.0;
+    /// the fraction of the roofline the layer achieves: of the peak compute throughput for the compute bound layers,
+    /// of the peak bandwidth for the memory bound ones
+    double efficiency = 0.0;
+    bool computeBound = false;
+    std::vector<std::string> flags;
+
+    double intensity() const { return bytes > 0.0 ? flops / bytes : 0.0; }
+    double gflops() const { return timeUs > 0.0 ? flops / timeUs * 1e-3 : 0.0; }
+    double gbps() const { return timeUs > 0.0 ? bytes / timeUs * 1e-3 : 0.0; }
+};
+
+/**
+ * @brief Peak capabilities of the device
+ */
+struct RooflineDevice {
+    double peakGflops = 0.0;
+    double peakGbps = 0.0;
+    /// layers achieving less of their roofline are flagged
+    double threshold = 0.3;
+};
+
+/**
+ * @brief Places the executed layers on the roofline
+ * @param costs The costs of the operations of the original network
+ * @param execGraph The executable graph, its layers are mapped to the original operations they were fused from
+ * @param perfCounts The performance counters of the executable layers
+ */
+std::vector<RooflineLayer> getRooflineLayers(const std::map<std::string, OpCost>& costs,
+                                             InferenceEngine::CNNNetwork& execGraph,
+                                             const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfCounts,
+                                             const RooflineDevice& device);
+
+/**
+ * @brief Prints the layers sorted by time and the device level efficiency
+ */
+void printRooflineReport(const std::vector<RooflineLayer>& layers, const RooflineDevice& device, std::ostream& stream);
+
+/**
+ * @brief Stores the layers to a CSV file
+ */
+void dumpRooflineReport(const std::vector<RooflineLayer>& layers, const std::string& path);
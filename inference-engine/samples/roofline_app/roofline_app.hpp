@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml/.onnx/.prototxt file with a trained model.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Optional. Specify a target device to infer on. Default value is CPU. "
+                                            "The device must report the per layer performance counters.";
+
+/// @brief message for iterations count
+static const char iterations_count_message[] = "Optional. Number of inferences the layer times are averaged over. Default value is 100.";
+
+/// @brief message for peak compute throughput
+static const char peak_gflops_message[] = "Required. Peak compute throughput of the device in GFLOP/s for the precision of the model.";
+
+/// @brief message for peak memory bandwidth
+static const char peak_gbps_message[] = "Required. Peak memory bandwidth of the device in GB/s.";
+
+/// @brief message for efficiency threshold
+static const char threshold_message[] = "Optional. Layers which achieve less than this fraction of their roofline are flagged. "
+                                        "Default value is 0.3.";
+
+/// @brief message for report path
+static const char report_path_message[] = "Optional. Path to a CSV file where the per layer report is stored.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Number of iterations <br>
+DEFINE_uint32(niter, 100, iterations_count_message);
+
+/// @brief Peak compute throughput of the device <br>
+DEFINE_double(peak_gflops, 0.0, peak_gflops_message);
+
+/// @brief Peak memory bandwidth of the device <br>
+DEFINE_double(peak_gbps, 0.0, peak_gbps_message);
+
+/// @brief Fraction of the roofline below which layers are flagged <br>
+DEFINE_double(threshold, 0.3, threshold_message);
+
+/// @brief Path to the CSV report <br>
+DEFINE_string(report_path, "", report_path_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "roofline_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help                " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+    std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
+    std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
+    std::cout << "    -peak_gflops \"<float>\"    " << peak_gflops_message << std::endl;
+    std::cout << "    -peak_gbps \"<float>\"      " << peak_gbps_message << std::endl;
+    std::cout << "    -threshold \"<float>\"      " << threshold_message << std::endl;
+    std::cout << "    -report_path \"<path>\"     " << report_path_message << std::endl;
+}
@@ -0,0 +1,191 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "speech_benchmark_app.hpp"
+#include "streaming.hpp"
+
+using namespace InferenceEngine;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    // ---------------------------Parsing and validating input arguments--------------------------------------
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        showAvailableDevices();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::logic_error("Model is required but not set. Please set -m option.");
+    }
+    if (FLAGS_i.empty()) {
+        throw std::logic_error("Input features are required but not set. Please set -i option.");
+    }
+    if (FLAGS_streams == 0) {
+        throw std::logic_error("Incorrect number of streams. Please set -streams option to a positive value.");
+    }
+    if (FLAGS_frame_ms <= 0.0) {
+        throw std::logic_error("Incorrect frame duration. Please set -frame_ms option to a positive value.");
+    }
+    if (FLAGS_t < 0.0) {
+        throw std::logic_error("Incorrect duration. Please set -t option to a non negative value.");
+    }
+    if (FLAGS_latency_budget_ms > 0.0 && !FLAGS_realtime) {
+        throw std::logic_error("The capacity search needs the frames to arrive at the frame rate. Please add -realtime option.");
+    }
+    if (FLAGS_percentile <= 0.0 || FLAGS_percentile > 100.0) {
+        throw std::logic_error("Incorrect percentile. Please set -percentile option to a value in (0, 100].");
+    }
+    return true;
+}
+
+void printResult(const StreamingResult& result) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Streams:                 " << result.streams << std::endl;
+    std::cout << "Frames:                  " << result.frames << std::endl;
+    std::cout << "Audio per stream:        " << result.audioMs / 1000.0 << " s" << std::endl;
+    std::cout << "Wall time:               " << result.wallMs / 1000.0 << " s" << std::endl;
+    std::cout << "Real time factor:        " << std::setprecision(4) << result.realTimeFactor() << std::setprecision(2)
+              << " (wall time to the audio of a stream)" << std::endl;
+    std::cout << "Throughput:              " << result.framesPerSecond() << " frames/s" << std::endl;
+    std::cout << "Frame latency p50:       " << result.percentile(50.0) << " ms" << std::endl;
+    std::cout << "Frame latency p90:       " << result.percentile(90.0) << " ms" << std::endl;
+    std::cout << "Frame latency p99:       " << result.percentile(99.0) << " ms" << std::endl;
+    std::cout << "Frame latency max:       " << result.percentile(100.0) << " ms" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+}
+
+/**
+* @brief Searches for the maximum number of streams whose latency percentile stays within the budget
+* @details The latency grows with the number of streams, so the number is doubled until the budget is exceeded and
+* then bisected
+*/
+size_t searchCapacity(StreamingBenchmark& benchmark, StreamingConfig config) {
+    std::cout << std::setw(10) << "streams" << std::setw(14) << "p" + std::to_string(static_cast<int>(FLAGS_percentile)) + ",ms"
+              << std::setw(12) << "max,ms" << std::setw(10) << "RTF" << std::setw(12) << "frames/s" << "  fits" << std::endl;
+    auto fits = [&](size_t streams) {
+        config.streams = streams;
+        const auto result = benchmark.run(config);
+        const double latency = result.percentile(FLAGS_percentile);
+        const bool value = latency <= FLAGS_latency_budget_ms;
+        std::cout << std::fixed << std::setprecision(2) << std::setw(10) << streams << std::setw(14) << latency
+                  << std::setw(12) << result.percentile(100.0) << std::setprecision(4) << std::setw(10) << result.realTimeFactor()
+                  << std::setprecision(1) << std::setw(12) << result.framesPerSecond() << "  " << (value ? "yes" : "no") << std::endl;
+        std::cout.unsetf(std::ios_base::floatfield);
+        return value;
+    };
+
+    const size_t limit = std::max<size_t>(FLAGS_max_streams, 1);
+    size_t good = 0, bad = 0;
+    for (size_t streams = 1; streams <= limit; streams *= 2) {
+        if (!fits(streams)) {
+            bad = streams;
+            break;
+        }
+        good = streams;
+    }
+    if (bad == 0) {
+        if (good < limit && fits(limit))
+            return limit;
+        return good;
+    }
+    while (bad - good > 1) {
+        const size_t middle = good + (bad - good) / 2;
+        if (fits(middle))
+            good = middle;
+        else
+            bad = middle;
+    }
+    return good;
+}
+
+/**
+* @brief The entry point of the streaming speech benchmark application
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        // ----------------- 1. Reading the utterances and the network ------------------------------------------
+        const auto utterances = readKaldiArk(FLAGS_i);
+        size_t numFrames = 0;
+        for (const auto& utterance : utterances)
+            numFrames += utterance.numFrames;
+        slog::info << "Read " << utterances.size() << " utterances with " << numFrames << " frames from " << FLAGS_i << slog::endl;
+
+        Core ie;
+        slog::info << "Loading network files" << slog::endl;
+        CNNNetwork network = ie.ReadNetwork(FLAGS_m);
+        // every inference takes one frame of one stream
+        network.setBatchSize(1);
+        network.getInputsInfo().begin()->second->setPrecision(Precision::FP32);
+
+        // ----------------- 2. Loading the network -------------------------------------------------------------
+        std::map<std::string, std::string> config;
+        if (FLAGS_d.find("CPU") != std::string::npos) {
+            if (!FLAGS_nstreams.empty())
+                config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = FLAGS_nstreams;
+            if (FLAGS_nthreads != 0)
+                config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(FLAGS_nthreads);
+        }
+        slog::info << "Loading network to " << FLAGS_d << slog::endl;
+        ExecutableNetwork exeNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+
+        StreamingBenchmark benchmark(exeNetwork, utterances, FLAGS_nireq);
+        if (benchmark.usesSessions()) {
+            slog::info << "The device keeps the states per session, a pool of infer requests serves the streams" << slog::endl;
+        } else {
+            slog::warn << "The device does not keep the states per session, every stream gets its own infer request "
+                          "and the streams may share the states of the device" << slog::endl;
+        }
+
+        // ----------------- 3. Replaying the streams -----------------------------------------------------------
+        StreamingConfig streaming;
+        streaming.streams = FLAGS_streams;
+        streaming.frameMs = FLAGS_frame_ms;
+        streaming.realtime = FLAGS_realtime;
+        streaming.framesPerStream = FLAGS_t > 0.0 ? static_cast<size_t>(std::ceil(FLAGS_t * 1000.0 / FLAGS_frame_ms)) : 0;
+
+        // the first frames initialize the primitives and are not a steady state
+        StreamingConfig warmUp = streaming;
+        warmUp.streams = 1;
+        warmUp.realtime = false;
+        warmUp.framesPerStream = std::min<size_t>(numFrames, 10);
+        benchmark.run(warmUp);
+
+        slog::info << "Replaying " << streaming.streams << " streams " << (streaming.realtime ? "in real time" : "as fast as possible")
+                   << slog::endl;
+        std::cout << std::endl;
+        printResult(benchmark.run(streaming));
+
+        if (FLAGS_latency_budget_ms > 0.0) {
+            slog::info << "Searching for the maximum number of streams with p" << FLAGS_percentile << " frame latency within "
+                       << FLAGS_latency_budget_ms << " ms" << slog::endl;
+            std::cout << std::endl;
+            const size_t capacity = searchCapacity(benchmark, streaming);
+            std::cout << std::endl << "Maximum number of streams within the latency budget: " << capacity << std::endl;
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return 3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief message for model argument
+static const char model_message[] = "Required. Path to an .xml file with a trained streaming model with one input.";
+
+/// @brief message for input argument
+static const char input_message[] = "Required. Path to an .ark file with the features of the utterances the streams replay.";
+
+/// @brief message for assigning cnn calculation to device
+static const char target_device_message[] = "Optional. Specify a target device to infer on: CPU, GNA_AUTO, GNA_HW, GNA_SW_EXACT "
+                                            "and so on. Default value is CPU.";
+
+/// @brief message for the number of streams
+static const char streams_message[] = "Optional. Number of concurrent streaming sessions. Default value is 1.";
+
+/// @brief message for the number of requests
+static const char nireq_message[] = "Optional. Number of infer requests serving the sessions if the device keeps the states "
+                                    "per session, by default the optimal number of the device. Otherwise every session "
+                                    "gets its own request.";
+
+/// @brief message for the frame period
+static const char frame_ms_message[] = "Optional. Duration of a frame of the features in milliseconds. Default value is 10.";
+
+/// @brief message for the real time mode
+static const char realtime_message[] = "Optional. Feed the frames of every session at the frame rate as a live source does, "
+                                       "by default the frames are fed as fast as possible.";
+
+/// @brief message for the duration of a run
+static const char time_message[] = "Optional. Duration of the audio every session replays in seconds, by default every "
+                                   "session replays all the utterances once.";
+
+/// @brief message for the latency budget
+static const char latency_budget_message[] = "Optional. Searches for the maximum number of sessions in the real time mode "
+                                             "whose frame latency percentile stays within this budget in milliseconds.";
+
+/// @brief message for the latency percentile
+static const char percentile_message[] = "Optional. Latency percentile the budget applies to. Default value is 99.";
+
+/// @brief message for the search limit
+static const char max_streams_message[] = "Optional. Maximum number of sessions tried by the capacity search. Default value is 4096.";
+
+/// @brief message for #streams for CPU inference
+static const char infer_num_streams_message[] = "Optional. Number of CPU streams, see CPU_THROUGHPUT_STREAMS.";
+
+/// @brief message for #threads for CPU inference
+static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set model file <br>
+/// It is a required parameter
+DEFINE_string(m, "", model_message);
+
+/// @brief Define parameter for set the features file <br>
+/// It is a required parameter
+DEFINE_string(i, "", input_message);
+
+/// @brief Define parameter for set target device to infer on <br>
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Number of concurrent sessions <br>
+DEFINE_uint32(streams, 1, streams_message);
+
+/// @brief Number of infer requests <br>
+DEFINE_uint32(nireq, 0, nireq_message);
+
+/// @brief Duration of a frame <br>
+DEFINE_double(frame_ms, 10.0, frame_ms_message);
+
+/// @brief Real time mode <br>
+DEFINE_bool(realtime, false, realtime_message);
+
+/// @brief Duration of the replayed audio <br>
+DEFINE_double(t, 0.0, time_message);
+
+/// @brief Latency budget of the capacity search <br>
+DEFINE_double(latency_budget_ms, 0.0, latency_budget_message);
+
+/// @brief Latency percentile <br>
+DEFINE_double(percentile, 99.0, percentile_message);
+
+/// @brief Limit of the capacity search <br>
+DEFINE_uint32(max_streams, 4096, max_streams_message);
+
+/// @brief Number of CPU streams <br>
+DEFINE_string(nstreams, "", infer_num_streams_message);
+
+/// @brief Number of CPU threads <br>
+DEFINE_uint32(nthreads, 0, infer_num_threads_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "speech_benchmark_app [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help                    " << help_message << std::endl;
+    std::cout << "    -m \"<path>\"                   " << model_message << std::endl;
+    std::cout << "    -i \"<path>\"                   " << input_message << std::endl;
+    std::cout << "    -d \"<device>\"                 " << target_device_message << std::endl;
+    std::cout << "    -streams \"<integer>\"          " << streams_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"            " << nireq_message << std::endl;
+    std::cout << "    -frame_ms \"<float>\"           " << frame_ms_message << std::endl;
+    std::cout << "    -realtime                     " << realtime_message << std::endl;
+    std::cout << "    -t \"<float>\"                  " << time_message << std::endl;
+    std::cout << "    -latency_budget_ms \"<float>\"  " << latency_budget_message << std::endl;
+    std::cout << "    -percentile \"<float>\"         " << percentile_message << std::endl;
+    std::cout << "    -max_streams \"<integer>\"      " << max_streams_message << std::endl;
+    std::cout << "    -nstreams \"<integer>\"         " << infer_num_streams_message << std::endl;
+    std::cout << "    -nthreads \"<integer>\"         " << infer_num_threads_message << std::endl;
+}
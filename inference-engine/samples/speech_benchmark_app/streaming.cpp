@@ -0,0 +1,278 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streaming.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+/**
+ * @brief The position of a session in the utterances and the arrival time of its next frame
+ */
+struct Stream {
+    size_t utterance = 0;
+    size_t frame = 0;
+    size_t framesDone = 0;
+    Clock::time_point start;
+    Clock::time_point arrival;
+};
+
+}  // namespace
+
+std::vector<Utterance> readKaldiArk(const std::string& fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file.good()) {
+        throw std::logic_error("Failed to open " + fileName + " for reading");
+    }
+    std::vector<Utterance> utterances;
+    while (file.peek() != std::ifstream::traits_type::eof()) {
+        Utterance utterance;
+        std::string token;
+        std::getline(file, token, '\0');  // the name followed by a space and NUL
+        utterance.name = token.substr(0, token.find(' '));
+        std::getline(file, token, '\4');  // "BFM " followed by control-D
+        if (token != "BFM ") {
+            if (utterances.empty()) {
+                throw std::logic_error(fileName + " is not a binary Kaldi .ark file of float matrices");
+            }
+            break;
+        }
+        file.read(reinterpret_cast<char*>(&utterance.numFrames), sizeof(uint32_t));
+        std::getline(file, token, '\4');  // control-D
+        file.read(reinterpret_cast<char*>(&utterance.numColumns), sizeof(uint32_t));
+        utterance.features.resize(static_cast<size_t>(utterance.numFrames) * utterance.numColumns);
+        file.read(reinterpret_cast<char*>(utterance.features.data()), utterance.features.size() * sizeof(float));
+        if (!file.good()) {
+            throw std::logic_error("The utterance " + utterance.name + " of " + fileName + " is truncated");
+        }
+        if (utterance.numFrames > 0)
+            utterances.push_back(std::move(utterance));
+    }
+    if (utterances.empty()) {
+        throw std::logic_error(fileName + " has no utterances");
+    }
+    return utterances;
+}
+
+double StreamingResult::percentile(double value) const {
+    if (latenciesMs.empty())
+        return 0.0;
+    const double rank = std::ceil(value / 100.0 * latenciesMs.size());
+    const size_t index = static_cast<size_t>(std::max(rank, 1.0)) - 1;
+    return latenciesMs[std::min(index, latenciesMs.size() - 1)];
+}
+
+StreamingBenchmark::StreamingBenchmark(ExecutableNetwork& network, const std::vector<Utterance>& utterances, size_t requests)
+    : network(network), utterances(utterances) {
+    auto inputs = network.GetInputsInfo();
+    if (inputs.size() != 1) {
+        throw std::logic_error("The sample supports networks with one input, the network has " + std::to_string(inputs.size()));
+    }
+    inputName = inputs.begin()->first;
+    const auto& desc = inputs.begin()->second->getTensorDesc();
+    if (desc.getPrecision() != Precision::FP32) {
+        throw std::logic_error("The input " + inputName + " of the network is not FP32");
+    }
+    size_t inputSize = 1;
+    for (auto dim : desc.getDims())
+        inputSize *= dim;
+    for (const auto& utterance : utterances) {
+        if (utterance.numColumns != inputSize) {
+            throw std::logic_error("The frames of the utterance " + utterance.name + " have " + std::to_string(utterance.numColumns) +
+                                   " features, the input of the network takes " + std::to_string(inputSize));
+        }
+    }
+
+    // a device which does not keep the states per session refuses to bind a session
+    try {
+            request(0).SetStateSession(0);
+            request(0).SetStateSession(-1);
+            request(0).ReleaseStateSession(0);
+            sessions = true;
+        } catch (const std::exception&) {
+            sessions = false;
+        }
+        if (sessions) {
+            poolSize = requests;
+            if (poolSize == 0) {
+                try {
+                    poolSize = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+                } catch (const std::exception&) {
+                    poolSize = 1;
+                }
+            }
+            poolSize = std::max<size_t>(poolSize, 1);
+        }
+    }
+
+    InferRequest& StreamingBenchmark::request(size_t index) {
+        while (requests.size() <= index)
+            requests.push_back(network.CreateInferRequest());
+        return requests[index];
+    }
+
+    void StreamingBenchmark::resetStates(size_t streams) {
+        if (sessions) {
+            for (size_t i = 0; i < streams; i++)
+                request(0).ReleaseStateSession(static_cast<int64_t>(i));
+        } else {
+            for (auto& state : network.QueryState())
+                state.Reset();
+        }
+    }
+
+    StreamingResult StreamingBenchmark::run(const StreamingConfig& config) {
+        if (config.streams == 0) {
+            throw std::logic_error("The number of streams must be positive");
+        }
+        size_t allFrames = 0;
+        for (const auto& utterance : utterances)
+            allFrames += utterance.numFrames;
+        const size_t framesPerStream = config.framesPerStream > 0 ? config.framesPerStream : allFrames;
+        const size_t numRequests = sessions ? std::min(poolSize, config.streams) : config.streams;
+        const auto framePeriod = std::chrono::duration_cast<Clock::duration>(ms(config.frameMs));
+
+        resetStates(config.streams);
+        for (size_t i = 0; i < numRequests; i++)
+            request(i).SetStateSession(-1);
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<Stream> streams(config.streams);
+        // the sessions whose next frame is not in flight, by the arrival time of the frame
+        typedef std::pair<Clock::time_point, size_t> Pending;
+        std::priority_queue<Pending, std::vector<Pending>, std::greater<Pending>> pending;
+        std::deque<size_t> freeRequests;
+        std::vector<size_t> inFlight(numRequests);
+        std::vector<double> latencies;
+        latencies.reserve(config.streams * framesPerStream);
+        size_t finished = 0;
+
+        for (size_t i = 0; i < numRequests; i++) {
+            freeRequests.push_back(i);
+            request(i).SetCompletionCallback([&, i] {
+                const auto now = Clock::now();
+                std::lock_guard<std::mutex> lock{mutex};
+                auto& stream = streams[inFlight[i]];
+                latencies.push_back(std::chrono::duration_cast<ms>(now - stream.arrival).count());
+                stream.framesDone++;
+                if (++stream.frame == utterances[stream.utterance].numFrames) {
+                    stream.frame = 0;
+                    stream.utterance = (stream.utterance + 1) % utterances.size();
+                }
+                if (stream.framesDone == framesPerStream) {
+                    finished++;
+                } else {
+                    // a live source captures the frames at the frame rate whether or not the results are late
+                    stream.arrival = config.realtime ? stream.start + framePeriod * static_cast<Clock::rep>(stream.framesDone) : now;
+                    pending.emplace(stream.arrival, inFlight[i]);
+                }
+                freeRequests.push_back(i);
+                cv.notify_one();
+            });
+        }
+
+        const auto start = Clock::now();
+        for (size_t s = 0; s < config.streams; s++) {
+            auto& stream = streams[s];
+            // the sessions replay different utterances and capture their frames at different phases of the frame period
+            stream.utterance = s % utterances.size();
+            stream.start = config.realtime ? start + framePeriod * static_cast<Clock::rep>(s) / static_cast<Clock::rep>(config.streams) : start;
+            stream.arrival = stream.start;
+            pending.emplace(stream.arrival, s);
+        }
+
+        std::unique_lock<std::mutex> lock{mutex};
+        try {
+        while (finished < config.streams) {
+            if (pending.empty() || freeRequests.empty()) {
+                cv.wait(lock);
+                continue;
+            }
+            if (pending.top().first > Clock::now()) {
+                cv.wait_until(lock, pending.top().first);
+                continue;
+            }
+            const size_t s = pending.top().second;
+            pending.pop();
+            // without the sessions every stream has its own request which holds the states on the device
+            size_t index;
+            if (sessions) {
+                index = freeRequests.front();
+                freeRequests.pop_front();
+            } else {
+                auto it = std::find(freeRequests.begin(), freeRequests.end(), s);
+                index = s;
+                freeRequests.erase(it);
+            }
+            auto& stream = streams[s];
+            const auto& utterance = utterances[stream.utterance];
+            const bool newUtterance = stream.frame == 0;
+            inFlight[index] = s;
+            lock.unlock();
+
+            auto& inferRequest = request(index);
+            if (sessions) {
+                // the sessions are restarted with every utterance as the decoder of a server does
+                if (newUtterance)
+                    inferRequest.ReleaseStateSession(static_cast<int64_t>(s));
+                inferRequest.SetStateSession(static_cast<int64_t>(s));
+            }
+            auto blob = as<MemoryBlob>(inferRequest.GetBlob(inputName));
+            if (!blob) {
+                throw std::logic_error("The input " + inputName + " is not a memory blob");
+            }
+            {
+                auto holder = blob->wmap();
+                const float* frame = utterance.features.data() + stream.frame * utterance.numColumns;
+                std::copy(frame, frame + utterance.numColumns, holder.as<float*>());
+            }
+            inferRequest.StartAsync();
+            lock.lock();
+        }
+    } catch (...) {
+        // the callbacks of the requests in flight refer to the state of the run
+        if (lock.owns_lock())
+            lock.unlock();
+        for (size_t i = 0; i < numRequests; i++) {
+            try {
+                request(i).Wait(IInferRequest::WaitMode::RESULT_READY);
+            } catch (...) {}
+        }
+        throw;
+    }
+    const auto end = Clock::now();
+    lock.unlock();
+
+    // the completion callbacks do not get the status, a failed inference rethrows its error here
+    for (size_t i = 0; i < numRequests; i++) {
+        request(i).Wait(IInferRequest::WaitMode::RESULT_READY);
+        request(i).SetCompletionCallback([] {});
+    }
+
+    StreamingResult result;
+    result.streams = config.streams;
+    result.frames = config.streams * framesPerStream;
+    result.wallMs = std::chrono::duration_cast<ms>(end - start).count();
+    result.audioMs = framesPerStream * config.frameMs;
+    result.latenciesMs = std::move(latencies);
+    std::sort(result.latenciesMs.begin(), result.latenciesMs.end());
+    return result;
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+/**
+ * @brief The features of an utterance: a matrix of frames
+ */
+struct Utterance {
+    std::string name;
+    uint32_t numFrames = 0;
+    uint32_t numColumns = 0;
+    std::vector<float> features;
+};
+
+/**
+ * @brief Reads all the matrices of a Kaldi .ark file
+ */
+std::vector<Utterance> readKaldiArk(const std::string& fileName);
+
+/**
+ * @brief A replay of concurrent streaming sessions
+ */
+struct StreamingConfig {
+    size_t streams = 1;
+    double frameMs = 10.0;
+    /// feed the frames at the frame rate, the sessions are spread evenly over a frame period
+    bool realtime = false;
+    /// the frames every session replays, 0 for all the frames of all the utterances
+    size_t framesPerStream = 0;
+};
+
+/**
+ * @brief The result of a replay, the latency of a frame is the time from its arrival to its result
+ */
+struct StreamingResult {
+    size_t streams = 0;
+    size_t frames = 0;
+    double wallMs = 0.0;
+    /// the duration of the audio replayed by every session
+    double audioMs = 0.0;
+    /// sorted
+    std::vector<double> latenciesMs;
+
+    /// the wall time to process the audio of a session to its duration
+    double realTimeFactor() const { return audioMs > 0.0 ? wallMs / audioMs : 0.0; }
+    double framesPerSecond() const { return wallMs > 0.0 ? frames / wallMs * 1000.0 : 0.0; }
+    double percentile(double value) const;
+};
+
+/**
+ * @brief Replays the utterances by the sessions of an executable network
+ * @details If the device keeps the states per session, see InferRequest::SetStateSession, a pool of requests serves
+ * all the sessions and a session is restarted at every utterance. Otherwise every session gets its own request
+ * and keeps its state across the utterances.
+ */
+class StreamingBenchmark {
+public:
+    /**
+     * @param requests The number of requests serving the sessions if the device keeps the states per session
+     */
+    StreamingBenchmark(InferenceEngine::ExecutableNetwork& network, const std::vector<Utterance>& utterances, size_t requests);
+
+    StreamingResult run(const StreamingConfig& config);
+
+    bool usesSessions() const { return sessions; }
+
+private:
+    InferenceEngine::InferRequest& request(size_t index);
+
+    void resetStates(size_t streams);
+
+    InferenceEngine::ExecutableNetwork& network;
+    const std::vector<Utterance>& utterances;
+    std::string inputName;
+    bool sessions = false;
+    size_t poolSize = 0;
+    std::vector<InferenceEngine::InferRequest> requests;
+};
@@ -0,0 +1,530 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstring>
+
+#include "ie_metric_helpers.hpp"
+#include <ie_api.h>
+#include <blob_factory.hpp>
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <threading/ie_immediate_executor.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_util_internal.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+Blob::Ptr MakeBatchedBlobSlice(const Blob::Ptr& batchedBlob, int batchId, int batchSize) {
+    auto memoryBlob = as<MemoryBlob>(batchedBlob);
+    if (nullptr == memoryBlob) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Only memory blobs of the device request can be batched";
+    }
+    const auto& desc = memoryBlob->getTensorDesc();
+    auto dims = desc.getDims();
+    dims[0] = 1;
+    auto ptr = memoryBlob->rwmap().as<uint8_t*>() + memoryBlob->byteSize() / batchSize * batchId;
+    return make_blob_with_precision(TensorDesc{desc.getPrecision(), dims, desc.getLayout()}, ptr);
+}
+
+void CopyBlobData(const Blob::Ptr& dst, const Blob::Ptr& src) {
+    auto dstBlob = as<MemoryBlob>(dst);
+    auto srcBlob = as<MemoryBlob>(src);
+    if (nullptr == dstBlob || nullptr == srcBlob) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Only memory blobs are supported by the BATCH device";
+    }
+    if (dstBlob->byteSize() != srcBlob->byteSize()) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob size " << srcBlob->byteSize()
+                           << " does not match the size of the batch element " << dstBlob->byteSize();
+    }
+    auto srcPtr = srcBlob->rmap().as<const uint8_t*>();
+    auto dstPtr = dstBlob->wmap().as<uint8_t*>();
+    if (srcPtr != dstPtr) {
+        std::memcpy(dstPtr, srcPtr, srcBlob->byteSize());
+    }
+}
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&                                       networkInputs,
+                                             const OutputsDataMap&                                      networkOutputs,
+                                             const AutoBatchExecutableNetwork::WorkerInferRequest::Ptr& workerRequest,
+                                             int                                                        batchId)
+        : InferRequestInternal(networkInputs, networkOutputs),
+          _workerInferRequest{workerRequest},
+          _batchId{batchId} {
+    // Inputs are written by the user directly to the slot of the request in the batched blobs
+    for (const auto &it : networkInputs) {
+        auto slice = MakeBatchedBlobSlice(_workerInferRequest->_inferRequest.GetBlob(it.first),
+                                          _batchId, _workerInferRequest->_batchSize);
+        _batchedInputs[it.first] = slice;
+        _inputs[it.first] = slice;
+    }
+    // Outputs own the memory, as the batched request may be reused by the other requests before the results are read
+    for (const auto &it : networkOutputs) {
+        _batchedOutputs[it.first] = MakeBatchedBlobSlice(_workerInferRequest->_inferRequest.GetBlob(it.first),
+                                                          _batchId, _workerInferRequest->_batchSize);
+        const auto& desc = it.second->getTensorDesc();
+        _outputs[it.first] = make_blob_with_precision(TensorDesc{desc.getPrecision(), desc.getDims(), desc.getLayout()});
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    // this request is already in BUSY state, so using the internal functions safely
+    execDataPreprocessing(_inputs);
+    for (const auto &it : _networkInputs) {
+        CopyBlobData(_batchedInputs[it.first], _inputs[it.first]);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputs() {
+    for (const auto &it : _networkOutputs) {
+        CopyBlobData(_outputs[it.first], _batchedOutputs[it.first]);
+    }
+}
+
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const bool                                  needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters} {
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_inferRequest->CopyInputsIfNeeded();
+            auto& workerInferRequest = *(_this->_inferRequest->_workerInferRequest);
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                workerInferRequest._tasks.emplace_back(std::move(task));
+            }
+            workerInferRequest._cond.notify_one();
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            auto& workerInferRequest = *(_inferRequest->_workerInferRequest);
+            auto status = workerInferRequest._status;
+            if (InferenceEngine::StatusCode::OK != status) {
+                if (nullptr != InferenceEngine::CurrentException()) {
+                    std::rethrow_exception(InferenceEngine::CurrentException());
+                } else {
+                    THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+                }
+            }
+            _inferRequest->CopyOutputs();
+            if (_needPerfCounters) {
+                _perfMap = workerInferRequest._inferRequest.GetPerformanceCounts();
+            }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+void AutoBatchAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap = _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                         networkForDevice,
+                                                       const DeviceInformation&                                          networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                                       const std::chrono::milliseconds                                   timeout,
+                                                       const bool                                                        needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _device{networkDevice},
+    _network{networkForDevice},
+    _config{config},
+    _timeout{timeout},
+    _needPerfCounters{needPerfCounters} {
+}
+
+AutoBatchExecutableNetwork::WorkerInferRequest::Ptr AutoBatchExecutableNetwork::CreateWorkerInferRequest() {
+    auto workerRequest = std::make_shared<WorkerInferRequest>();
+    auto* workerRequestPtr = workerRequest.get();
+    workerRequest->_batchSize = _device.batchForDevice;
+    workerRequest->_inferRequest = _network.CreateInferRequest();
+    workerRequest->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [workerRequestPtr] (InferRequest , StatusCode status) mutable {
+            workerRequestPtr->_status = status;
+            {
+                // each task finishes a stage of the user request that was collected into the batch
+                auto completionTasks = std::move(workerRequestPtr->_completionTasks);
+                for (auto&& task : completionTasks) {
+                    task();
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                workerRequestPtr->_busy = false;
+            }
+            workerRequestPtr->_cond.notify_one();
+        });
+    auto timeout = _timeout;
+    workerRequest->_thread = std::thread([workerRequestPtr, timeout] {
+        for (;;) {
+            std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
+            workerRequestPtr->_cond.wait(lock, [&] {
+                return workerRequestPtr->_terminate || (!workerRequestPtr->_busy && !workerRequestPtr->_tasks.empty());
+            });
+            if (workerRequestPtr->_terminate) {
+                break;
+            }
+            // give the rest of the requests a chance to join the batch
+            workerRequestPtr->_cond.wait_for(lock, timeout, [&] {
+                return workerRequestPtr->_terminate ||
+                       (workerRequestPtr->_tasks.size() >= static_cast<std::size_t>(workerRequestPtr->_batchSize));
+            });
+            if (workerRequestPtr->_terminate) {
+                break;
+            }
+            workerRequestPtr->_completionTasks = std::move(workerRequestPtr->_tasks);
+            workerRequestPtr->_tasks.clear();
+            workerRequestPtr->_busy = true;
+            lock.unlock();
+            try {
+                workerRequestPtr->_inferRequest.StartAsync();
+            } catch (...) {
+                workerRequestPtr->_status = StatusCode::GENERAL_ERROR;
+                auto completionTasks = std::move(workerRequestPtr->_completionTasks);
+                for (auto&& task : completionTasks) {
+                    task();
+                }
+                lock.lock();
+                workerRequestPtr->_busy = false;
+            }
+        }
+    });
+    return workerRequest;
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    /* NOTE: AsyncInferRequest objects hold the executable network, so all of them are already destroyed
+     *       and there are no user tasks waiting for a batch
+     */
+    for (auto&& workerRequest : _workerRequests) {
+        {
+            std::lock_guard<std::mutex> lock(workerRequest->_mutex);
+            workerRequest->_terminate = true;
+        }
+        workerRequest->_cond.notify_all();
+        if (workerRequest->_thread.joinable()) {
+            workerRequest->_thread.join();
+        }
+    }
+    _workerRequests.clear();
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    // every batched request of the device serves `batchForDevice` user requests, each one has a fixed slot in the batch
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto batchId = static_cast<int>(_numRequestsCreated % _device.batchForDevice);
+    if (0 == batchId) {
+        _workerRequests.push_back(CreateWorkerInferRequest());
+    }
+    ++_numRequestsCreated;
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, _workerRequests.back(), batchId);
+}
+
+void AutoBatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           _needPerfCounters,
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void AutoBatchExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result,
+        InferenceEngine::ResponseDesc * /* resp */) const {
+    auto res = _config.find(name);
+    if (res != _config.end()) {
+        result =  res->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+void AutoBatchExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const details::InferenceEngineException &iie) {
+            THROW_IE_EXCEPTION
+                << "Every device used with the Auto-Batching should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every batched request needs `batchForDevice` user requests to be filled
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * _device.batchForDevice);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        result = IE_SET_METRIC(NETWORK_NAME, _network.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        result = IE_SET_METRIC(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+                                                AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+
+namespace {
+
+std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                const std::map<std::string, std::string> & local) {
+    for (auto && kvp : local) {
+        config[kvp.first] = kvp.second;
+    }
+    return config;
+}
+
+constexpr int defaultBatchSize = 8;
+constexpr int defaultTimeout = 1000;
+
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = defaultBatchSize;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batch = std::stol(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+
+        if (batch <= 0) {
+            THROW_IE_EXCEPTION << "Batch value for '" << deviceName << "' must be > 0, while " << batch
+                << "is passed";
+        }
+    }
+
+    DeviceIDParser deviceParser(deviceName);
+    auto tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceParser.getDeviceName()), batch };
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) || name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+INFERENCE_PLUGIN_API(InferenceEngine::StatusCode) CreatePluginEngine(
+        InferenceEngine::IInferencePlugin *&plugin,
+        InferenceEngine::ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin(
+                {{2, 1},
+                 CI_BUILD_NUMBER,
+                 "AutoBatchPlugin"}, std::make_shared<AutoBatchInferencePlugin>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+                                                AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const ICNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+
+    auto timeoutConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    int timeout = defaultTimeout;
+    if (timeoutConfig != fullConfig.end()) {
+        try {
+            timeout = std::stoi(timeoutConfig->second);
+        } catch (const std::exception&) {
+            timeout = -1;
+        }
+        if (timeout < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << timeoutConfig->second << " for property key "
+                               << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT << ". Expected non-negative number of milliseconds";
+        }
+    }
+
+    // Every input and output is expected to hold the batch in the outermost dimension, otherwise the network
+    // is loaded as is and the requests are executed one by one
+    auto isBatchedLayout = [] (const TensorDesc& desc) {
+        switch (desc.getLayout()) {
+        case Layout::NC: case Layout::NCHW: case Layout::NHWC: case Layout::NCDHW: case Layout::NDHWC:
+            return true;
+        default:
+            return false;
+        }
+    };
+    CNNNetwork clonedNetwork{cloneNetwork(network)};
+    bool batchable = metaDevice.batchForDevice > 1;
+    auto shapes = clonedNetwork.getInputShapes();
+    for (auto&& input : clonedNetwork.getInputsInfo()) {
+        batchable = batchable && isBatchedLayout(input.second->getTensorDesc()) &&
+                    1 == input.second->getTensorDesc().getDims()[0];
+        shapes[input.first][0] = metaDevice.batchForDevice;
+    }
+    if (batchable) {
+        try {
+            clonedNetwork.reshape(shapes);
+        } catch (const details::InferenceEngineException&) {
+            batchable = false;
+        }
+    }
+    if (batchable) {
+        for (auto&& output : clonedNetwork.getOutputsInfo()) {
+            const auto& desc = output.second->getTensorDesc();
+            batchable = batchable && isBatchedLayout(desc) &&
+                        static_cast<std::size_t>(metaDevice.batchForDevice) == desc.getDims()[0];
+        }
+    }
+    if (!batchable) {
+        metaDevice.batchForDevice = 1;
+        clonedNetwork = CNNNetwork{cloneNetwork(network)};
+    }
+
+    auto executableNetworkForDevice = GetCore()->LoadNetwork(clonedNetwork, metaDevice.deviceName, metaDevice.config);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*deviceConfig);
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = std::to_string(timeout);
+    networkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
+
+    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkForDevice,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        std::chrono::milliseconds(timeout),
+                                                        enablePerfCounters);
+}
+
+void AutoBatchInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
+                                            const std::map<std::string, std::string>& config,
+                                            QueryNetworkResult&                       queryResult) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    queryResult.rc = StatusCode::OK;
+    queryResult.supportedLayersMap.clear();
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+
+    auto clonedNetwork = cloneNetwork(network);
+    auto deviceQr = GetCore()->QueryNetwork(*clonedNetwork, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : deviceQr.supportedLayersMap) {
+        queryResult.supportedLayersMap[layerQr.first] = GetName();
+    }
+}
+}  // namespace AutoBatchPlugin
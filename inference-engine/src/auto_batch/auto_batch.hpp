@@ -0,0 +1,150 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <map>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <string>
+
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "ie_iinfer_request.hpp"
+#include "details/ie_exception_conversion.hpp"
+
+namespace AutoBatchPlugin {
+
+struct DeviceInformation {
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    /**
+     * @brief A batched request of the underlying device and the tasks of the user requests collected into it
+     */
+    struct WorkerInferRequest {
+        using Ptr = std::shared_ptr<WorkerInferRequest>;
+        InferenceEngine::InferRequest   _inferRequest;
+        InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        int                             _batchSize = 1;
+        std::vector<Task>               _tasks;
+        std::vector<Task>               _completionTasks;
+        std::mutex                      _mutex;
+        std::condition_variable         _cond;
+        bool                            _busy = false;
+        bool                            _terminate = false;
+        std::thread                     _thread;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                         networkForDevice,
+                                        const DeviceInformation&                                          networkDevices,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                        const std::chrono::milliseconds                                   timeout,
+                                        const bool                                                        needPerfCounters = false);
+
+    void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+protected:
+    WorkerInferRequest::Ptr CreateWorkerInferRequest();
+
+    std::mutex                                                  _mutex;
+    DeviceInformation                                           _device;
+    InferenceEngine::ExecutableNetwork                          _network;
+    std::vector<WorkerInferRequest::Ptr>                        _workerRequests;
+    unsigned int                                                _numRequestsCreated = 0;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    std::chrono::milliseconds                                   _timeout;
+    bool                                                        _needPerfCounters = false;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&                   networkInputs,
+                                   const InferenceEngine::OutputsDataMap&                  networkOutputs,
+                                   const AutoBatchExecutableNetwork::WorkerInferRequest::Ptr& workerRequest,
+                                   int                                                     batchId);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // Auto-Batch impl specific: copies the data of the user blobs to the slot of the request in the batched blobs
+    void CopyInputsIfNeeded();
+    // Auto-Batch impl specific: scatters the results of the batched request to the request outputs
+    void CopyOutputs();
+
+    AutoBatchExecutableNetwork::WorkerInferRequest::Ptr _workerInferRequest;
+
+protected:
+    InferenceEngine::BlobMap    _batchedInputs;
+    InferenceEngine::BlobMap    _batchedOutputs;
+    int                         _batchId = 0;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &_perfMap) const override;
+    ~AutoBatchAsyncInferRequest() override;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::InferencePluginInternal {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork& network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    Parameter GetConfig(const std::string& name,
+                        const std::map<std::string, Parameter> & options) const override;
+    void QueryNetwork(const InferenceEngine::ICNNNetwork&       network,
+                      const std::map<std::string, std::string>& config,
+                      InferenceEngine::QueryNetworkResult&      res) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string & deviceWithBatch,
+                                      const std::map<std::string, std::string> & config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const std::string & deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -5,11 +5,24 @@
 #include "cldnn_async_infer_request.h"
 #include <memory>
 
-CLDNNPlugin::CLDNNAsyncInferRequest::CLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
+CLDNNPlugin::CLDNNAsyncInferRequest::CLDNNAsyncInferRequest(const CLDNNInferRequest::Ptr &inferRequest,
                                                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                                                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
+                                                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                                                            const InferenceEngine::ITaskExecutor::Ptr &uploadExecutor)
         : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor)
-        { }
+        , _inferRequest(inferRequest) {
+    if (uploadExecutor != nullptr) {
+        _pipeline = {
+            {uploadExecutor, [this] {
+                _inferRequest->checkBlobs();
+                _inferRequest->UploadInputs();
+            }},
+            {_requestExecutor, [this] {
+                _inferRequest->ExecuteNetwork();
+            }}
+        };
+    }
+}
 
 void CLDNNPlugin::CLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
@@ -13,13 +13,21 @@ namespace CLDNNPlugin {
 
 class CLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
-    CLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
+    /**
+     * @param uploadExecutor If not null, inputs are uploaded to the device by this executor as a separate
+     * pipeline stage, so the upload of the next request overlaps the execution of the current one
+     */
+    CLDNNAsyncInferRequest(const CLDNNInferRequest::Ptr &inferRequest,
                            const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                           const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                           const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                           const InferenceEngine::ITaskExecutor::Ptr &uploadExecutor = nullptr);
 
     void Infer_ThreadUnsafe() override;
 
     ~CLDNNAsyncInferRequest() override;
+
+private:
+    CLDNNInferRequest::Ptr _inferRequest;
 };
 
 }  // namespace CLDNNPlugin
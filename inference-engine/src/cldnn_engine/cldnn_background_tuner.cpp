@@ -0,0 +1,119 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cldnn_background_tuner.h"
+#include "cldnn_program.h"
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace CLDNNPlugin {
+
+namespace {
+
+void LowerCurrentThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 19);
+#endif
+}
+
+cldnn::engine_configuration MakeEngineConfiguration(const Config& config, cldnn::priority_mode_types priority) {
+    return cldnn::engine_configuration(true,
+                                       false,
+                                       false,
+                                       std::string(),
+                                       std::string(),
+                                       true,
+                                       std::string(),
+                                       std::string(),
+                                       priority,
+                                       cldnn::throttle_mode_types::disabled,
+                                       config.memory_pool_on,
+                                       1,
+                                       "cache.json",
+                                       1,
+                                       config.kernels_per_program,
+                                       config.kernels_cache_dir);
+}
+
+}  // namespace
+
+BackgroundTuner::BackgroundTuner(const cldnn::device& device, const Config& config)
+    : m_device(device)
+    , m_engineConfig(config) {
+}
+
+BackgroundTuner::~BackgroundTuner() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+        m_queue.clear();
+    }
+    m_queueCondVar.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void BackgroundTuner::Tune(const std::shared_ptr<InferenceEngine::ICNNNetwork>& network, const Config& config) {
+    if (config.tuningConfig.cache_file_path.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.emplace_back(network, config);
+        if (!m_thread.joinable()) {
+            m_thread = std::thread([this] { Run(); });
+        }
+    }
+    m_queueCondVar.notify_one();
+}
+
+void BackgroundTuner::Run() {
+    LowerCurrentThreadPriority();
+    for (;;) {
+        std::pair<std::shared_ptr<InferenceEngine::ICNNNetwork>, Config> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queueCondVar.wait(lock, [&] { return m_stop || !m_queue.empty(); });
+            if (m_stop) {
+                return;
+            }
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        try {
+            if (nullptr == m_engine) {
+                try {
+                    m_engine = std::make_shared<cldnn::engine>(m_device,
+                        MakeEngineConfiguration(m_engineConfig, cldnn::priority_mode_types::low));
+                } catch (...) {
+                    // the device does not support priority hints
+                    m_engine = std::make_shared<cldnn::engine>(m_device,
+                        MakeEngineConfiguration(m_engineConfig, cldnn::priority_mode_types::disabled));
+                }
+            }
+            auto& config = job.second;
+            config.tuningConfig.mode = cldnn::tuning_mode::tuning_tune_and_cache;
+            config.backgroundTuning = false;
+            config.graph_dumps_dir.clear();
+            // the tuning data are stored to the file by the kernel selector while the programs are built
+            Program program(*job.first, m_engine, config);
+        } catch (...) {
+            // the tuning is best effort: the served networks do not depend on it
+        }
+    }
+}
+
+}  // namespace CLDNNPlugin
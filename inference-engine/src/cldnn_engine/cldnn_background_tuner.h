@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <ie_icnn_network.hpp>
+#include <api/device.hpp>
+#include <api/engine.hpp>
+#include "cldnn_config.h"
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Creates the missing tuning data of the loaded networks while they are served.
+ * The networks are compiled again with the TUNING_CREATE mode on a separate engine of the same device: the kernels
+ * are benchmarked with profiling enabled and the serving engine keeps its configuration. The tuning runs on a single
+ * low-priority thread and a low-priority queue (if the device supports priority hints), one network at a time.
+ * The kernels are chosen when a network is compiled and they define the layouts of its weights, so the served
+ * networks keep their kernels and the tuned ones are used by the networks loaded after the tuning.
+ */
+class BackgroundTuner {
+public:
+    using Ptr = std::shared_ptr<BackgroundTuner>;
+
+    BackgroundTuner(const cldnn::device& device, const Config& config);
+    /**
+     * @brief Drops the queued networks and waits for the network being tuned
+     */
+    ~BackgroundTuner();
+
+    /**
+     * @brief Queues the network for the tuning
+     * @param network A copy of the network taken before the plugin transformations, owned by the tuner
+     * @param config The configuration the network is loaded with
+     */
+    void Tune(const std::shared_ptr<InferenceEngine::ICNNNetwork>& network, const Config& config);
+
+private:
+    void Run();
+
+    cldnn::device m_device;
+    Config m_engineConfig;
+    std::shared_ptr<cldnn::engine> m_engine;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queueCondVar;
+    std::deque<std::pair<std::shared_ptr<InferenceEngine::ICNNNetwork>, Config>> m_queue;
+    bool m_stop = false;
+    std::thread m_thread;
+};
+
+}  // namespace CLDNNPlugin
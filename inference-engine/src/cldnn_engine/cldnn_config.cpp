@@ -4,6 +4,9 @@
 
 #include <sys/stat.h>
 
+#include <cerrno>
+#include <limits>
+
 #include <cldnn/cldnn_config.hpp>
 #include "cldnn_config.h"
 #include "cpp_interfaces/exception2status.hpp"
@@ -94,6 +97,16 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                 default:
                     THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Unsupported queue throttle value: " << uVal;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_QUEUE_MODE) == 0) {
+            if (val.compare(CLDNNConfigParams::CLDNN_QUEUE_IN_ORDER) == 0) {
+                queueSyncMode = cldnn::queue_sync_mode_types::in_order;
+            } else if (val.compare(CLDNNConfigParams::CLDNN_QUEUE_OUT_OF_ORDER) == 0) {
+                queueSyncMode = cldnn::queue_sync_mode_types::barriers;
+            } else if (val.compare(CLDNNConfigParams::CLDNN_QUEUE_OUT_OF_ORDER_EVENTS) == 0) {
+                queueSyncMode = cldnn::queue_sync_mode_types::events;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported queue mode value: " << val;
+            }
         } else if (key.compare(PluginConfigParams::KEY_CONFIG_FILE) == 0) {
             std::stringstream ss(val);
             std::istream_iterator<std::string> begin(ss);
@@ -103,6 +116,7 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                 CLDNNCustomLayer::LoadFromFile(file, customLayers);
             }
         } else if (key.compare(PluginConfigParams::KEY_TUNING_MODE) == 0) {
+            backgroundTuning = false;
             if (val.compare(PluginConfigParams::TUNING_DISABLED) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_disabled;
             } else if (val.compare(PluginConfigParams::TUNING_CREATE) == 0) {
@@ -113,11 +127,65 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                 tuningConfig.mode = cldnn::tuning_mode::tuning_use_and_update;
             } else if (val.compare(PluginConfigParams::TUNING_RETUNE) == 0) {
                 tuningConfig.mode = cldnn::tuning_mode::tuning_retune_and_cache;
+            } else if (val.compare(PluginConfigParams::TUNING_BACKGROUND) == 0) {
+                tuningConfig.mode = cldnn::tuning_mode::tuning_use_cache;
+                backgroundTuning = true;
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported tuning mode value by plugin: " << val;
             }
         } else if (key.compare(PluginConfigParams::KEY_TUNING_FILE) == 0) {
             tuningConfig.cache_file_path = val;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_FP16_WEIGHTS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                fp16Weights = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                fp16Weights = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported FP16 weights flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_FP32_WEIGHTS_LAYERS) == 0) {
+            std::stringstream ss(val);
+            std::istream_iterator<std::string> begin(ss);
+            std::istream_iterator<std::string> end;
+            fp32WeightsLayers = std::set<std::string>(begin, end);
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_GPU_DETECTION_OUTPUT) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                gpuDetectionOutput = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                gpuDetectionOutput = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported GPU DetectionOutput flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DATA_PARALLEL_DEVICES) == 0) {
+            std::stringstream ss(val);
+            std::istream_iterator<std::string> begin(ss);
+            std::istream_iterator<std::string> end;
+            std::vector<std::string> devices(begin, end);
+            for (auto& device : devices) {
+                try {
+                    std::stoi(device);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_DATA_PARALLEL_DEVICES
+                        << ". DeviceIDs are only represented by positive numbers";
+                }
+            }
+            dataParallelDevices = devices;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_NON_BLOCKING_REMOTE_OUTPUTS) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                nonBlockingRemoteOutputs = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                nonBlockingRemoteOutputs = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported non blocking remote outputs flag value: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_RUNTIME_BATCH) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                runtimeBatch = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                runtimeBatch = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported runtime batch flag value: " << val;
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MEM_POOL) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 memory_pool_on = true;
@@ -126,6 +194,14 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported memory pool flag value: " << val;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SHARED_MEM_POOL) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                shared_memory_pool = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                shared_memory_pool = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported shared memory pool flag value: " << val;
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR) == 0) {
             if (!val.empty()) {
                 graph_dumps_dir = val;
@@ -189,6 +265,64 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             } else {
                 THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported NV12 flag value: " << val;
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_NV12_SOURCE_SIZE) == 0) {
+            int width = 0, height = 0;
+            if (!val.empty()) {
+                char delim = 0;
+                std::stringstream ss(val);
+                ss >> width >> delim >> height;
+                if (ss.fail() || !ss.eof() || delim != 'x' || width <= 0 || height <= 0) {
+                    THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_NV12_SOURCE_SIZE
+                                       << ". Expected <width>x<height>, got " << val;
+                }
+            }
+            nv12_source_width = width;
+            nv12_source_height = height;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_COMPILATION_THREADS) == 0) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i <= 0 || val_i > std::numeric_limits<uint16_t>::max()) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_COMPILATION_THREADS
+                                   << ". Expected only positive numbers (#threads)";
+            }
+            compilation_threads = static_cast<uint16_t>(val_i);
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_PER_PROGRAM) == 0) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i <= 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CLDNNConfigParams::KEY_CLDNN_KERNELS_PER_PROGRAM
+                                   << ". Expected only positive numbers (#kernels)";
+            }
+            kernels_per_program = static_cast<uint32_t>(val_i);
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                // the cache is shared between runs, so the directory may already exist
+                if (mkdir(val.c_str(), 0755) != 0 && errno != EEXIST) {
+                    THROW_IE_EXCEPTION << "Couldn't create clDNN kernels cache directory!";
+                }
+            }
+            kernels_cache_dir = val;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_WEIGHTS_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                if (mkdir(val.c_str(), 0755) != 0 && errno != EEXIST) {
+                    THROW_IE_EXCEPTION << "Couldn't create clDNN weights cache directory!";
+                }
+            }
+            weights_cache_dir = val;
+        } else if (key.compare(PluginConfigParams::KEY_WARMUP) == 0) {
+            // buffers are allocated by the driver on their first use, so there's nothing to touch without running
+            // the kernels and the memory warmup is the full one
+            if (val.compare(PluginConfigParams::YES) == 0 || val.compare(PluginConfigParams::WARMUP_MEMORY) == 0) {
+                warmup = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                warmup = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property key by plugin: " << key;
         }
@@ -218,6 +352,47 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_MEM_POOL] = PluginConfigParams::NO;
 
+    if (fp16Weights)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_FP16_WEIGHTS] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_FP16_WEIGHTS] = PluginConfigParams::NO;
+
+    {
+        std::string layers;
+        for (auto& layer : fp32WeightsLayers) {
+            layers += (layers.empty() ? "" : " ") + layer;
+        }
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_FP32_WEIGHTS_LAYERS] = layers;
+    }
+
+    if (gpuDetectionOutput)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_GPU_DETECTION_OUTPUT] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_GPU_DETECTION_OUTPUT] = PluginConfigParams::NO;
+
+    {
+        std::string devices;
+        for (auto& device : dataParallelDevices) {
+            devices += (devices.empty() ? "" : " ") + device;
+        }
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DATA_PARALLEL_DEVICES] = devices;
+    }
+
+    if (nonBlockingRemoteOutputs)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_NON_BLOCKING_REMOTE_OUTPUTS] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_NON_BLOCKING_REMOTE_OUTPUTS] = PluginConfigParams::NO;
+
+    if (runtimeBatch)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_RUNTIME_BATCH] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_RUNTIME_BATCH] = PluginConfigParams::NO;
+
+    if (shared_memory_pool)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_SHARED_MEM_POOL] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_SHARED_MEM_POOL] = PluginConfigParams::NO;
+
     if (enableDynamicBatch)
         key_config_map[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
     else
@@ -228,6 +403,12 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_TWO_INPUTS] = PluginConfigParams::NO;
 
+    if (nv12_source_width > 0 && nv12_source_height > 0)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_SOURCE_SIZE] =
+            std::to_string(nv12_source_width) + "x" + std::to_string(nv12_source_height);
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_SOURCE_SIZE] = "";
+
     {
         std::string qp = "0";
         switch (queuePriority) {
@@ -248,6 +429,15 @@ void Config::adjustKeyMapValues() {
         }
         key_config_map[CLDNNConfigParams::KEY_CLDNN_PLUGIN_THROTTLE] = qt;
     }
+    {
+        std::string qm = CLDNNConfigParams::CLDNN_QUEUE_OUT_OF_ORDER;
+        switch (queueSyncMode) {
+        case cldnn::queue_sync_mode_types::in_order: qm = CLDNNConfigParams::CLDNN_QUEUE_IN_ORDER; break;
+        case cldnn::queue_sync_mode_types::events: qm = CLDNNConfigParams::CLDNN_QUEUE_OUT_OF_ORDER_EVENTS; break;
+        default: break;
+        }
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_QUEUE_MODE] = qm;
+    }
     {
         std::string tm = PluginConfigParams::TUNING_DISABLED;
         switch (tuningConfig.mode) {
@@ -257,15 +447,23 @@ void Config::adjustKeyMapValues() {
         case cldnn::tuning_mode::tuning_retune_and_cache: tm = PluginConfigParams::TUNING_RETUNE; break;
         default: break;
         }
+        if (backgroundTuning) {
+            tm = PluginConfigParams::TUNING_BACKGROUND;
+        }
         key_config_map[PluginConfigParams::KEY_TUNING_MODE] = tm;
         key_config_map[PluginConfigParams::KEY_TUNING_FILE] = tuningConfig.cache_file_path;
     }
 
     key_config_map[CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR] = graph_dumps_dir;
     key_config_map[CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR] = sources_dumps_dir;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR] = kernels_cache_dir;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_WEIGHTS_CACHE_DIR] = weights_cache_dir;
+    key_config_map[PluginConfigParams::KEY_WARMUP] = warmup ? PluginConfigParams::YES : PluginConfigParams::NO;
 
     key_config_map[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(throughput_streams);
     key_config_map[PluginConfigParams::KEY_DEVICE_ID] = device_id;
     key_config_map[PluginConfigParams::KEY_CONFIG_FILE] = "";
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_COMPILATION_THREADS] = std::to_string(compilation_threads);
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_PER_PROGRAM] = std::to_string(kernels_per_program);
 }
 }  // namespace CLDNNPlugin
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ie_blob.h"
@@ -24,17 +27,31 @@ struct Config {
                dumpCustomKernels(false),
                exclusiveAsyncRequests(false),
                memory_pool_on(true),
+               shared_memory_pool(false),
                enableDynamicBatch(false),
                enableInt8(true),
+               fp16Weights(false),
+               gpuDetectionOutput(false),
+               nonBlockingRemoteOutputs(false),
+               runtimeBatch(false),
                nv12_two_inputs(false),
+               nv12_source_width(0),
+               nv12_source_height(0),
                queuePriority(cldnn::priority_mode_types::disabled),
                queueThrottle(cldnn::throttle_mode_types::disabled),
+               queueSyncMode(cldnn::queue_sync_mode_types::barriers),
                max_dynamic_batch(1),
                customLayers({}),
                tuningConfig(),
+               backgroundTuning(false),
                graph_dumps_dir(""),
                sources_dumps_dir(""),
-               device_id("") {
+               device_id(""),
+               compilation_threads(static_cast<uint16_t>(std::max(std::thread::hardware_concurrency(), 1u))),
+               kernels_per_program(10),
+               kernels_cache_dir(""),
+               weights_cache_dir(""),
+               warmup(false) {
         adjustKeyMapValues();
     }
 
@@ -46,17 +63,33 @@ struct Config {
     bool dumpCustomKernels;
     bool exclusiveAsyncRequests;
     bool memory_pool_on;
+    bool shared_memory_pool;
     bool enableDynamicBatch;
     bool enableInt8;
+    bool fp16Weights;
+    std::set<std::string> fp32WeightsLayers;
+    bool gpuDetectionOutput;
+    std::vector<std::string> dataParallelDevices;
+    bool nonBlockingRemoteOutputs;
+    bool runtimeBatch;
     bool nv12_two_inputs;
+    int nv12_source_width;
+    int nv12_source_height;
     cldnn::priority_mode_types queuePriority;
     cldnn::throttle_mode_types queueThrottle;
+    cldnn::queue_sync_mode_types queueSyncMode;
     int max_dynamic_batch;
     CLDNNCustomLayerMap customLayers;
     cldnn::tuning_config_options tuningConfig;
+    bool backgroundTuning;
     std::string graph_dumps_dir;
     std::string sources_dumps_dir;
     std::string device_id;
+    uint16_t compilation_threads;
+    uint32_t kernels_per_program;
+    std::string kernels_cache_dir;
+    std::string weights_cache_dir;
+    bool warmup;
 
     std::map<std::string, std::string> key_config_map;
 };
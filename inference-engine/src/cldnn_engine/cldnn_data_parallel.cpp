@@ -0,0 +1,187 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ie_metric_helpers.hpp"
+#include <blob_factory.hpp>
+#include <cldnn/cldnn_config.hpp>
+#include "threading/ie_cpu_streams_executor.hpp"
+#include "cldnn_data_parallel.h"
+
+using namespace InferenceEngine;
+
+namespace CLDNNPlugin {
+
+namespace {
+
+// Returns the part of the blob with the given index when its batch is split into the given number of parts.
+// The slice points to the memory of the blob, so the batch has to be the outermost dense dimension
+Blob::Ptr SliceBatch(const Blob::Ptr& blob, size_t index, size_t parts) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& blocking = desc.getBlockingDesc();
+    const auto& dims = desc.getDims();
+    if (desc.getLayout() == Layout::SCALAR || dims.empty() || blocking.getOrder().empty() ||
+        blocking.getOrder()[0] != 0 || blocking.getOffsetPadding() != 0 ||
+        blocking.getStrides()[0] * dims[0] != blob->size() || dims[0] % parts != 0) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Blob with dims " << details::dumpVec(dims)
+                           << " can not be split into " << parts << " parts by batch";
+    }
+
+    auto blockDims = blocking.getBlockDims();
+    blockDims[0] /= parts;
+    auto sliceDims = dims;
+    sliceDims[0] /= parts;
+    TensorDesc sliceDesc(desc.getPrecision(), sliceDims, BlockingDesc(blockDims, blocking.getOrder()));
+
+    auto memory = as<MemoryBlob>(blob);
+    if (memory == nullptr) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Only memory blobs can be split by batch";
+    }
+    auto data = memory->rwmap().as<uint8_t*>() + index * (memory->byteSize() / parts);
+    return make_blob_with_precision(sliceDesc, data);
+}
+
+}  // namespace
+
+CLDNNDataParallelExecNetwork::CLDNNDataParallelExecNetwork(std::vector<CLDNNExecNetwork::Ptr> replicas, Config config) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"CLDNNPlugin data parallel executor", config.throughput_streams})},
+    m_replicas(std::move(replicas)),
+    m_config(std::move(config)) {
+    if (m_replicas.empty()) {
+        THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
+    }
+}
+
+InferRequestInternal::Ptr CLDNNDataParallelExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                               OutputsDataMap networkOutputs) {
+    std::vector<InferRequest> replicaRequests;
+    for (auto& replica : m_replicas) {
+        IInferRequest::Ptr request;
+        replica->CreateInferRequest(request);
+        replicaRequests.emplace_back(request);
+    }
+    return std::make_shared<CLDNNDataParallelInferRequest>(networkInputs, networkOutputs, std::move(replicaRequests));
+}
+
+void CLDNNDataParallelExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
+    m_replicas.front()->GetExecGraphInfo(graphPtr);
+}
+
+void CLDNNDataParallelExecNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result,
+                                             InferenceEngine::ResponseDesc *resp) const {
+    auto option = m_config.key_config_map.find(name);
+    if (option != m_config.key_config_map.end()) {
+        result = option->second;
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork config key: " << name;
+    }
+}
+
+void CLDNNDataParallelExecNetwork::GetMetric(const std::string &name, InferenceEngine::Parameter &result,
+                                             InferenceEngine::ResponseDesc *resp) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(NETWORK_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(LOAD_TIME_PHASES));
+        metrics.push_back(METRIC_KEY(LOAD_PEAK_MEMORY));
+        metrics.push_back(METRIC_KEY(NETWORK_HOT));
+        result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys;
+        for (auto && value : m_config.key_config_map)
+            configKeys.push_back(value.first);
+        result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int nr = m_config.throughput_streams * 2u;
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(LOAD_TIME_PHASES)) {
+        result = IE_SET_METRIC(LOAD_TIME_PHASES, _loadTimeProfile ? _loadTimeProfile->GetPhases() : LoadTimeProfile::Phases{});
+    } else if (name == METRIC_KEY(LOAD_PEAK_MEMORY)) {
+        result = IE_SET_METRIC(LOAD_PEAK_MEMORY, _loadTimeProfile ? _loadTimeProfile->GetPeakMemory() : 0);
+    } else if (name == METRIC_KEY(NETWORK_HOT)) {
+        bool hot = true;
+        for (auto& replica : m_replicas) {
+            Parameter replicaHot;
+            replica->GetMetric(name, replicaHot, resp);
+            hot = hot && replicaHot.as<bool>();
+        }
+        result = IE_SET_METRIC(NETWORK_HOT, hot);
+    } else {
+        // the other metrics are the same for all the replicas
+        m_replicas.front()->GetMetric(name, result, resp);
+    }
+}
+
+CLDNNDataParallelInferRequest::CLDNNDataParallelInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                                                             std::vector<InferRequest> replicaRequests)
+        : InferRequestInternal(networkInputs, networkOutputs)
+        , _replicaRequests(std::move(replicaRequests)) {
+    for (auto& input : _networkInputs) {
+        auto blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+        _inputs[input.first] = blob;
+    }
+    for (auto& output : _networkOutputs) {
+        auto blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+        _outputs[output.first] = blob;
+    }
+}
+
+void CLDNNDataParallelInferRequest::SetSlices(const std::string& name, const Blob::Ptr& blob) {
+    auto& sliced = _slicedBlobs[name];
+    if (sliced == blob) {
+        return;
+    }
+    for (size_t i = 0; i < _replicaRequests.size(); i++) {
+        _replicaRequests[i].SetBlob(name, SliceBatch(blob, i, _replicaRequests.size()));
+    }
+    sliced = blob;
+}
+
+void CLDNNDataParallelInferRequest::InferImpl() {
+    execDataPreprocessing(_inputs);
+    for (auto& input : _inputs) {
+        SetSlices(input.first, input.second);
+    }
+    for (auto& output : _outputs) {
+        SetSlices(output.first, output.second);
+    }
+
+    for (auto& request : _replicaRequests) {
+        request.StartAsync();
+    }
+    // all the replicas are waited for even if one of them fails, as they write to the user memory
+    std::exception_ptr error;
+    for (auto& request : _replicaRequests) {
+        try {
+            request.Wait(IInferRequest::WaitMode::RESULT_READY);
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void CLDNNDataParallelInferRequest::GetPerformanceCounts(
+        std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    // the replicas execute the same program, so the counters of the first one describe the others
+    perfMap = _replicaRequests.front().GetPerformanceCounts();
+}
+
+}  // namespace CLDNNPlugin
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include "cldnn_executable_network.h"
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Executes a network on several devices, each replica of the network gets a part of the batch.
+ * The requests slice the batch of the user blobs in place, so the replicas read the inputs from
+ * and write the outputs to the user memory and the outputs are merged without copies
+ */
+class CLDNNDataParallelExecNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    typedef std::shared_ptr<CLDNNDataParallelExecNetwork> Ptr;
+
+    CLDNNDataParallelExecNetwork(std::vector<CLDNNExecNetwork::Ptr> replicas, Config config);
+
+    void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+
+    std::vector<CLDNNExecNetwork::Ptr> m_replicas;
+    Config m_config;
+};
+
+class CLDNNDataParallelInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    typedef std::shared_ptr<CLDNNDataParallelInferRequest> Ptr;
+
+    CLDNNDataParallelInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                  InferenceEngine::OutputsDataMap networkOutputs,
+                                  std::vector<InferenceEngine::InferRequest> replicaRequests);
+
+    void InferImpl() override;
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
+
+private:
+    // passes the slices of the blob to the replicas if the blob differs from the one they have
+    void SetSlices(const std::string& name, const InferenceEngine::Blob::Ptr& blob);
+
+    std::vector<InferenceEngine::InferRequest> _replicaRequests;
+    std::map<std::string, InferenceEngine::Blob::Ptr> _slicedBlobs;
+};
+
+}  // namespace CLDNNPlugin
@@ -12,6 +12,7 @@
 #include <cmath>
 #include <tuple>
 #include <cctype>
+#include <future>
 
 #include "ie_metric_helpers.hpp"
 #include <ie_data.h>
@@ -19,7 +20,10 @@
 #include <description_buffer.hpp>
 #include <memory>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <xml_parse_utils.h>
 #include "ie_plugin_config.hpp"
+#include <cldnn/cldnn_config.hpp>
 #include "details/caseless.hpp"
 #include <details/ie_cnn_network_tools.h>
 #include <ngraph/opsets/opset2.hpp>
@@ -31,12 +35,14 @@
 #include <transformations/convert_opset2_to_opset1/convert_opset2_to_opset1.hpp>
 #include <transformations/convert_opset3_to_opset2/convert_opset3_to_opset2.hpp>
 #include "convert_function_to_cnn_network.hpp"
+#include <ie_load_time_profile.hpp>
 
 #undef min
 #undef max
 
 #include "cldnn_engine.h"
 #include "cldnn_executable_network.h"
+#include "cldnn_data_parallel.h"
 #include "cldnn_custom_layer.h"
 
 #ifdef __linux__
@@ -70,8 +76,13 @@ cldnn::device_info clDNNEngine::GetDeviceInfo(const std::map<std::string, std::s
 }
 
 InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneNetwork(const InferenceEngine::ICNNNetwork& network) const {
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
+    std::shared_ptr<ICNNNetwork> clonedNetwork;
+    {
+        IE_LOAD_PHASE("clone");
+        clonedNetwork = cloneNetwork(network);
+    }
     if (clonedNetwork->getFunction()) {
+        IE_LOAD_PHASE("transformations");
         const auto transformations_callback = [](const std::shared_ptr<const ::ngraph::Node> &node) -> bool {
             // DepthToSpace node implementation supports only equal input/output tensors with rank <= 5
             // Reshape->Permute->Reshape pattern in theory can change output rank, so this check is added to be sure
@@ -90,15 +101,23 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneNetwork(const InferenceEngin
         ::ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
 
         // Note: instead of running all Conversion Transformations you can make up your own transformation pipeline
-        ngraph::pass::CommonOptimizations(transformations_callback).run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
-        ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
+        {
+            IE_LOAD_PHASE("common_optimizations");
+            ngraph::pass::CommonOptimizations(transformations_callback).run_on_function(nGraphFunc);
+        }
+        {
+            IE_LOAD_PHASE("opset_conversion");
+            ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
+            ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
+            ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
+        }
+        IE_LOAD_PHASE("legacy_conversion");
         clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
     }
 
     auto implNetwork = std::dynamic_pointer_cast<InferenceEngine::details::CNNNetworkImpl>(clonedNetwork);
     if (implNetwork) {
+        IE_LOAD_PHASE("constant_folding");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
@@ -155,24 +174,7 @@ auto check_inputs = [](InferenceEngine::InputsDataMap _networkInputs) {
     }
 };
 
-ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
-                                                               const std::map<std::string, std::string> &config) {
-    // verification of supported input
-    InferenceEngine::InputsDataMap _networkInputs;
-    network.getInputsInfo(_networkInputs);
-    check_inputs(_networkInputs);
-
-    CLDNNPlugin::Config conf = _impl->m_config;
-    auto device_info = GetDeviceInfo(config);
-    conf.enableInt8 = device_info.supports_imad || device_info.supports_immad;
-    conf.UpdateFromMap(config);
-
-    if (conf.enableDynamicBatch) {
-        conf.max_dynamic_batch = static_cast<int>(network.getBatchSize());
-    }
-
-    CLDNNRemoteCLContext::Ptr context;
-
+CLDNNRemoteCLContext::Ptr clDNNEngine::GetContextForConfig(const Config& conf) {
     auto canReuseDefaultContext = [&]() -> bool {
         if (m_defaultContext == nullptr)
             return false;
@@ -184,12 +186,18 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
                context_config.useProfiling == current_config.useProfiling &&
                context_config.dumpCustomKernels == current_config.dumpCustomKernels &&
                context_config.memory_pool_on == current_config.memory_pool_on &&
+               context_config.shared_memory_pool == current_config.shared_memory_pool &&
                context_config.queueThrottle == current_config.queueThrottle &&
                context_config.queuePriority == current_config.queuePriority &&
+               context_config.queueSyncMode == current_config.queueSyncMode &&
                context_config.sources_dumps_dir == current_config.sources_dumps_dir &&
                context_config.tuningConfig.mode == current_config.tuningConfig.mode &&
+               context_config.backgroundTuning == current_config.backgroundTuning &&
                context_config.tuningConfig.cache_file_path == current_config.tuningConfig.cache_file_path &&
-               context_config.device_id == current_config.device_id;
+               context_config.device_id == current_config.device_id &&
+               context_config.compilation_threads == current_config.compilation_threads &&
+               context_config.kernels_per_program == current_config.kernels_per_program &&
+               context_config.kernels_cache_dir == current_config.kernels_cache_dir;
     };
 
     {
@@ -199,9 +207,123 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
         }
     }
 
-    context = m_defaultContext;
+    return m_defaultContext;
+}
+
+ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
+                                                               const std::map<std::string, std::string> &config) {
+    // verification of supported input
+    InferenceEngine::InputsDataMap _networkInputs;
+    network.getInputsInfo(_networkInputs);
+    check_inputs(_networkInputs);
+
+    CLDNNPlugin::Config conf = _impl->m_config;
+    auto device_info = GetDeviceInfo(config);
+    conf.enableInt8 = device_info.supports_imad || device_info.supports_immad;
+    conf.UpdateFromMap(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.max_dynamic_batch = static_cast<int>(network.getBatchSize());
+    }
+
+    if (conf.dataParallelDevices.size() > 1) {
+        return LoadDataParallelNetwork(network, conf);
+    }
+
+    auto clonedNetwork = CloneNetwork(network);
+    IE_LOAD_PHASE("compile");
+    return std::make_shared<CLDNNExecNetwork>(clonedNetwork, GetContextForConfig(conf), conf);
+}
+
+ExecutableNetworkInternal::Ptr clDNNEngine::LoadDataParallelNetwork(const InferenceEngine::ICNNNetwork &network,
+                                                                    const Config& conf) {
+    const auto& devices = conf.dataParallelDevices;
+    for (auto& device : devices) {
+        if (device_map.find(device) == device_map.end()) {
+            THROW_IE_EXCEPTION << "Invalid device ID: " << device;
+        }
+    }
+    if (conf.enableDynamicBatch) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << CLDNNConfigParams::KEY_CLDNN_DATA_PARALLEL_DEVICES
+                           << " can not be used with dynamic batch";
+    }
+
+    // every replica is the network reshaped to its part of the batch
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    ICNNNetwork::InputShapes shapes;
+    size_t batch = 0;
+    for (auto& input : inputs) {
+        auto dims = input.second->getTensorDesc().getDims();
+        if (dims.empty() || (batch != 0 && dims[0] != batch)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Inputs of the network loaded to several devices must have the same batch";
+        }
+        batch = dims[0];
+        dims[0] /= devices.size();
+        shapes[input.first] = dims;
+    }
+    if (batch == 0 || batch % devices.size() != 0) {
+        THROW_IE_EXCEPTION << "Batch " << batch << " can not be split between " << devices.size() << " devices";
+    }
+
+    std::shared_ptr<ICNNNetwork> splitNetwork;
+    {
+        IE_LOAD_PHASE("clone");
+        splitNetwork = cloneNetwork(network);
+        ResponseDesc resp;
+        if (splitNetwork->reshape(shapes, &resp) != OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+    }
+
+    OutputsDataMap outputs, splitOutputs;
+    network.getOutputsInfo(outputs);
+    splitNetwork->getOutputsInfo(splitOutputs);
+    for (auto& output : outputs) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        const auto& splitDims = splitOutputs.at(output.first)->getTensorDesc().getDims();
+        if (dims.empty() || splitDims.empty() || splitDims[0] * devices.size() != dims[0]) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Output " << output.first
+                               << " can not be merged from the parts of the batch";
+        }
+    }
+
+    // the plugin transformations are run once, each replica builds its own programs from a copy of the result
+    auto transformedNetwork = CloneNetwork(*splitNetwork);
+    InputsDataMap replicaInputs;
+    splitNetwork->getInputsInfo(replicaInputs);
+
+    IE_LOAD_PHASE("compile");
+    auto profile = LoadTimeProfile::GetCurrent();
+    auto phase = LoadTimeProfile::GetCurrentPhase();
+    auto loadReplica = [&](size_t idx) {
+        LoadTimeProfile::Scope scope(profile, phase);
+        Config replicaConf = conf;
+        replicaConf.device_id = devices[idx];
+        replicaConf.dataParallelDevices.clear();
+        replicaConf.adjustKeyMapValues();
+        // contexts of the replicas are not shared with the single device networks
+        auto context = std::make_shared<CLDNNRemoteCLContext>(shared_from_this(), ParamMap(), replicaConf);
+        auto replica = std::make_shared<CLDNNExecNetwork>(cloneNet(*transformedNetwork), context, replicaConf);
+        InputsDataMap inputsCopy;
+        OutputsDataMap outputsCopy;
+        copyInputOutputInfo(replicaInputs, splitOutputs, inputsCopy, outputsCopy);
+        replica->setNetworkInputs(inputsCopy);
+        replica->setNetworkOutputs(outputsCopy);
+        return replica;
+    };
+
+    // the first replica is built alone, so the others find its kernels in KEY_CLDNN_KERNELS_CACHE_DIR
+    std::vector<CLDNNExecNetwork::Ptr> replicas{loadReplica(0)};
+    std::vector<std::future<CLDNNExecNetwork::Ptr>> loads;
+    for (size_t i = 1; i < devices.size(); i++) {
+        loads.push_back(std::async(std::launch::async, loadReplica, i));
+    }
+    for (auto& load : loads) {
+        replicas.push_back(load.get());
+    }
 
-    return std::make_shared<CLDNNExecNetwork>(*CloneNetwork(network), context, conf);
+    return std::make_shared<CLDNNDataParallelExecNetwork>(replicas, conf);
 }
 
 ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
@@ -216,16 +338,126 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
         THROW_IE_EXCEPTION << "Invalid context";
     }
 
-    CLDNNPlugin::Config conf = getContextImpl(casted)->GetConfig();
+    const Config& context_config = getContextImpl(casted)->GetConfig();
+    CLDNNPlugin::Config conf = context_config;
     auto device_info = GetDeviceInfo(config);
     conf.enableInt8 = device_info.supports_imad || device_info.supports_immad;
     conf.UpdateFromMap(config);
 
+    // the queues of the network are created by the engine of the context
+    if (conf.queuePriority != context_config.queuePriority || conf.queueThrottle != context_config.queueThrottle) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << CLDNNConfigParams::KEY_CLDNN_PLUGIN_PRIORITY << " and "
+                           << CLDNNConfigParams::KEY_CLDNN_PLUGIN_THROTTLE
+                           << " of a network loaded to a remote context must be the same as the ones of the context";
+    }
+
+    if (conf.dataParallelDevices.size() > 1) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << CLDNNConfigParams::KEY_CLDNN_DATA_PARALLEL_DEVICES
+                           << " can not be used with a remote context";
+    }
+
     if (conf.enableDynamicBatch) {
         conf.max_dynamic_batch = static_cast<int>(network.getBatchSize());
     }
 
-    return std::make_shared<CLDNNExecNetwork>(*CloneNetwork(network), casted, conf);
+    auto clonedNetwork = CloneNetwork(network);
+    IE_LOAD_PHASE("compile");
+    return std::make_shared<CLDNNExecNetwork>(clonedNetwork, casted, conf);
+}
+
+ExecutableNetwork clDNNEngine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with GPU device via InferencEngine::Core object";
+    }
+
+    std::string gpuXmlStr;
+    std::getline(networkModel, gpuXmlStr);
+
+    pugi::xml_document gpuXmlDoc;
+    pugi::xml_parse_result res = gpuXmlDoc.load(gpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading GPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node gpuNode = gpuXmlDoc.document_element();
+
+    // configuration of the exported network is overridden by the import configuration
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = gpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+         configNode = configNode.next_sibling("config")) {
+        importedConfig.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& value : config) {
+        importedConfig[value.first] = value.second;
+    }
+
+    CLDNNPlugin::Config conf = _impl->m_config;
+    GetDeviceInfo(importedConfig);
+    conf.UpdateFromMap(importedConfig);
+    // low precision transformations have been already applied to the exported network
+    conf.enableInt8 = false;
+
+    // read transformed network
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading GPU plugin exported network";
+    }
+
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = gpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported GPU network does not contain input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+    }
+    check_inputs(inputs);
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = gpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported GPU network does not contain output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    if (conf.enableDynamicBatch) {
+        conf.max_dynamic_batch = static_cast<int>(cnnnetwork.getBatchSize());
+    }
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(inputs, outputs, networkInputs, networkOutputs);
+
+    auto impl = std::make_shared<CLDNNExecNetwork>(static_cast<ICNNNetwork::Ptr>(cnnnetwork), GetContextForConfig(conf), conf);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl),
+                            [](InferenceEngine::details::IRelease *p) {p->Release();});
+
+    return ExecutableNetwork{executableNetwork};
 }
 
 RemoteContext::Ptr clDNNEngine::CreateContext(const ParamMap& params) {
@@ -375,6 +607,7 @@ Parameter clDNNEngine::GetMetric(const std::string& name, const std::map<std::st
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { };
@@ -405,6 +638,8 @@ Parameter clDNNEngine::GetMetric(const std::string& name, const std::map<std::st
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, 2);
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
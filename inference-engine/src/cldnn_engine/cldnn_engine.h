@@ -28,6 +28,9 @@ class clDNNEngine : public InferenceEngine::InferencePluginInternal,
 
     cldnn::device_info GetDeviceInfo(const std::map<std::string, std::string> &config) const;
     InferenceEngine::ICNNNetwork::Ptr CloneNetwork(const InferenceEngine::ICNNNetwork& network) const;
+    CLDNNRemoteCLContext::Ptr GetContextForConfig(const Config& conf);
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadDataParallelNetwork(const InferenceEngine::ICNNNetwork &network,
+                                                                            const Config& conf);
 public:
     clDNNEngine();
 
@@ -38,6 +41,9 @@ public:
                                                                        InferenceEngine::RemoteContext::Ptr context,
                                                                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
     void SetConfig(const std::map<std::string, std::string> &config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
     InferenceEngine::Parameter GetMetric(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
@@ -19,6 +19,7 @@
 #include <graph_tools.hpp>
 #include <ie_layers_internal.hpp>
 #include <net_pass.h>
+#include <ie_util_internal.hpp>
 #include "cldnn_infer_request.h"
 #include <threading/ie_executor_manager.hpp>
 #include "details/caseless.hpp"
@@ -28,8 +29,11 @@
 #include <sys/types.h>
 
 #include <exec_graph_info.hpp>
+#include <network_serializer.h>
+#include <pugixml.hpp>
 #include "cldnn_executable_network.h"
 #include "threading/ie_cpu_streams_executor.hpp"
+#include <ie_load_time_profile.hpp>
 
 
 using namespace InferenceEngine;
@@ -37,9 +41,16 @@ using namespace InferenceEngine::details;
 
 namespace CLDNNPlugin {
 
-CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, RemoteContext::Ptr context, Config config) :
+CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork::Ptr network, RemoteContext::Ptr context, Config config) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{[&]()->InferenceEngine::ITaskExecutor::Ptr {
-        if (config.throughput_streams > 1) {
+        if (config.shared_memory_pool) {
+            // networks sharing intermediate buffers must not be executed concurrently
+            if (config.throughput_streams > 1) {
+                THROW_IE_EXCEPTION << CLDNNConfigParams::KEY_CLDNN_SHARED_MEM_POOL << " can not be used with "
+                                   << PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS << " greater than 1";
+            }
+            return ExecutorManager::getInstance()->getExecutor("GPU");
+        } else if (config.throughput_streams > 1) {
             return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
                 IStreamsExecutor::Config{"CLDNNPlugin executor", config.throughput_streams});
         } else if (config.exclusiveAsyncRequests) {
@@ -49,6 +60,7 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
                 IStreamsExecutor::Config{"CLDNNPlugin executor", 1});
         }
     }()},
+    m_network(network),
     m_config(config),
     m_taskExecutor{_taskExecutor} {
     auto casted_context = std::dynamic_pointer_cast<gpu::ClContext>(context);
@@ -59,11 +71,28 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
 
     m_context = casted_context;
 
-    auto graph_base = std::make_shared<CLDNNGraph>(network, m_context, m_config, 0);
+    // the plugin transformations change the network, so the tuner gets a copy of the original one
+    auto tuner = m_config.backgroundTuning ? getContextImpl(m_context)->GetBackgroundTuner() : nullptr;
+    auto tuningNetwork = tuner ? cloneNet(*m_network) : nullptr;
+
+    auto graph_base = std::make_shared<CLDNNGraph>(*m_network, m_context, m_config, 0);
     for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
         auto graph = n == 0 ? graph_base : std::make_shared<CLDNNGraph>(graph_base, n);
+        if (m_config.warmup)
+            graph->Warmup();
         m_graphs.push_back(graph);
     }
+
+    if (tuner) {
+        tuner->Tune(tuningNetwork, m_config);
+    }
+
+    // With several streams the requests already overlap each other, and a dynamic batch network
+    // uses the user memory directly, so only a single stream of the static network has a separate upload stage
+    if (m_config.throughput_streams == 1 && graph_base->GetMaxDynamicBatchSize() <= 1) {
+        m_uploadExecutor = std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"CLDNNPlugin upload executor", 1});
+    }
 }
 
 InferRequestInternal::Ptr CLDNNExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
@@ -98,7 +127,8 @@ void CLDNNExecNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = this->CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
 
-    auto asyncTreadSafeImpl = std::make_shared<CLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncTreadSafeImpl = std::make_shared<CLDNNAsyncInferRequest>(std::static_pointer_cast<CLDNNInferRequest>(syncRequestImpl),
+                                                                       _taskExecutor, _callbackExecutor, m_uploadExecutor);
 
     asyncRequest.reset(new InferRequestBase<CLDNNAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
@@ -130,6 +160,12 @@ void CLDNNExecNetwork::GetMetric(const std::string &name, InferenceEngine::Param
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_POOL_PEAK));
+        metrics.push_back(METRIC_KEY(MEMORY_POOL_REUSE_RATE));
+        metrics.push_back(METRIC_KEY(MEMORY_POOL_FRAGMENTATION));
+        metrics.push_back(METRIC_KEY(LOAD_TIME_PHASES));
+        metrics.push_back(METRIC_KEY(LOAD_PEAK_MEMORY));
+        metrics.push_back(METRIC_KEY(NETWORK_HOT));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -139,6 +175,29 @@ void CLDNNExecNetwork::GetMetric(const std::string &name, InferenceEngine::Param
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int nr = m_config.throughput_streams * 2u;
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(MEMORY_POOL_PEAK)) {
+        auto statistics = getContextImpl(m_context)->GetEngine()->get_memory_pool_statistics();
+        result = IE_SET_METRIC(MEMORY_POOL_PEAK, statistics.peak_bytes);
+    } else if (name == METRIC_KEY(MEMORY_POOL_REUSE_RATE)) {
+        auto statistics = getContextImpl(m_context)->GetEngine()->get_memory_pool_statistics();
+        float rate = statistics.pooled_requests == 0 ? 0.f :
+            static_cast<float>(statistics.reused_requests) / statistics.pooled_requests;
+        result = IE_SET_METRIC(MEMORY_POOL_REUSE_RATE, rate);
+    } else if (name == METRIC_KEY(MEMORY_POOL_FRAGMENTATION)) {
+        auto statistics = getContextImpl(m_context)->GetEngine()->get_memory_pool_statistics();
+        float fragmentation = statistics.reused_bytes_allocated == 0 ? 0.f :
+            1.f - static_cast<float>(statistics.reused_bytes_requested) / statistics.reused_bytes_allocated;
+        result = IE_SET_METRIC(MEMORY_POOL_FRAGMENTATION, fragmentation);
+    } else if (name == METRIC_KEY(LOAD_TIME_PHASES)) {
+        result = IE_SET_METRIC(LOAD_TIME_PHASES, _loadTimeProfile ? _loadTimeProfile->GetPhases() : LoadTimeProfile::Phases{});
+    } else if (name == METRIC_KEY(LOAD_PEAK_MEMORY)) {
+        result = IE_SET_METRIC(LOAD_PEAK_MEMORY, _loadTimeProfile ? _loadTimeProfile->GetPeakMemory() : 0);
+    } else if (name == METRIC_KEY(NETWORK_HOT)) {
+        bool hot = !m_graphs.empty();
+        for (auto& graph : m_graphs) {
+            hot = hot && graph->IsHot();
+        }
+        result = IE_SET_METRIC(NETWORK_HOT, hot);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -148,4 +207,56 @@ void CLDNNExecNetwork::GetContext(RemoteContext::Ptr &pContext, ResponseDesc *re
     pContext = m_context;
 }
 
+void CLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    // clDNN programs can not be serialized, so the network is stored after all the plugin transformations
+    // and ImportNetwork only builds clDNN programs. Kernels compilation is avoided with KEY_CLDNN_KERNELS_CACHE_DIR
+    if (m_config.max_dynamic_batch > 1) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with dynamic batch is not supported";
+    }
+
+    pugi::xml_document doc;
+    auto gpuNode = doc.append_child("gpu");
+    gpuNode.append_attribute("name").set_value(m_network->getName().c_str());
+
+    auto inputsNode = gpuNode.append_child("inputs");
+    for (auto&& input : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+    }
+
+    auto outputsNode = gpuNode.append_child("outputs");
+    for (auto&& output : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    // debug dump directories are not properties of the network, so they are not exported.
+    // Custom kernels configuration files have to be passed to ImportNetwork again
+    auto configsNode = gpuNode.append_child("configs");
+    for (auto&& config : m_config.key_config_map) {
+        if (config.first == CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR ||
+            config.first == CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR ||
+            config.first == PluginConfigParams::KEY_CONFIG_FILE) {
+            continue;
+        }
+        auto configNode = configsNode.append_child("config");
+        configNode.append_attribute("key").set_value(config.first.c_str());
+        configNode.append_attribute("value").set_value(config.second.c_str());
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    pugi::xml_document networkDoc;
+    auto dataSize = static_cast<std::uint64_t>(Serialization::FillXmlDoc(*m_network, networkDoc));
+    networkDoc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    Serialization::SerializeBlobs(networkModel, *m_network);
+}
+
 };  // namespace CLDNNPlugin
@@ -24,7 +24,7 @@ class CLDNNExecNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<CLDNNExecNetwork> Ptr;
 
-    explicit CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, RemoteContext::Ptr context, Config config);
+    explicit CLDNNExecNetwork(InferenceEngine::ICNNNetwork::Ptr network, RemoteContext::Ptr context, Config config);
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
@@ -34,12 +34,17 @@ public:
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
     void GetContext(RemoteContext::Ptr &pContext, ResponseDesc *resp) const override;
+    void ExportImpl(std::ostream& networkModel) override;
 
 
+    // network after all the plugin transformations (including the ones applied by Program), kept for ExportImpl
+    InferenceEngine::ICNNNetwork::Ptr m_network;
     std::vector<std::shared_ptr<CLDNNGraph>> m_graphs;
     gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
+    // runs input uploads of the next request while the current one is executed, null if they are not pipelined
+    InferenceEngine::ITaskExecutor::Ptr m_uploadExecutor;
 };
 
 };  // namespace CLDNNPlugin
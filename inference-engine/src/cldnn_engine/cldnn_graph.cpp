@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <exec_graph_info.hpp>
+#include <ie_load_time_profile.hpp>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -49,23 +50,21 @@ CLDNNGraph::CLDNNGraph(std::shared_ptr<CLDNNGraph> graph, uint16_t stream_id)
         , m_networkName(graph->m_networkName)
         , m_config(graph->m_config)
         , m_stream_id(stream_id) {
+    // the replica executes the same compiled program, so its implementations are known without parsing
+    implementationsMap = graph->implementationsMap;
     Build();
 }
 
 void CLDNNGraph::UpdateLayersMaps() {
-    primitiveIDs = m_program->primitiveIDs;
-    primitivesToIRLayersMap = m_program->primitivesToIRLayersMap;
-    IRToNgraphLayersMap = m_program->IRToNgraphLayersMap;
-    prevPrimitiveIDs = m_program->prevPrimitiveIDs;
-    profilingIDs = m_program->profilingIDs;
+    // the other layer maps are read from the program shared by the stream replicas,
+    // only the performance counters are collected per graph
     perfMap = m_program->perfMap;
-    outputDims = m_program->outputDims;
 }
 
 void CLDNNGraph::Build() {
     UpdateLayersMaps();
 
-    if (GetMaxDynamicBatchSize() > 1) {
+    if (GetMaxDynamicBatchSize() > 1 && !HasRuntimeBatch()) {
         int m_bv_sz = m_program->GetMaxBatchSizeForSingleProgram();
         for (int b = m_bv_sz - 1; b >= 0; b--) {
             auto network = BuildNetwork(m_program->getCompiledProgram(b));
@@ -78,10 +77,12 @@ void CLDNNGraph::Build() {
         GetEngine()->release_pending_memory(network->get_id());
     }
 
-    UpdateImplementationsMap();
+    if (implementationsMap.empty())
+        UpdateImplementationsMap();
 }
 
 std::shared_ptr<cldnn::network> CLDNNGraph::BuildNetwork(std::shared_ptr<cldnn::program> program) {
+    IE_LOAD_PHASE("network");
     auto network = std::make_shared<cldnn::network>(*program, m_stream_id);
 
     if (!m_config.graph_dumps_dir.empty() && m_stream_id == 0) {
@@ -235,15 +236,15 @@ InferenceEngine::ICNNNetwork::Ptr CLDNNGraph::GetExecGraphInfoByPrimitivesInfo(s
     };
 
     auto find_origin_layers = [&](const std::string& name) -> std::vector<std::string> {
-        if (primitivesToIRLayersMap.find(name) == primitivesToIRLayersMap.end())
+        if (m_program->primitivesToIRLayersMap.find(name) == m_program->primitivesToIRLayersMap.end())
             return {};
 
-        auto cnn_names = primitivesToIRLayersMap.at(name);
+        auto cnn_names = m_program->primitivesToIRLayersMap.at(name);
         std::vector<std::string> res;
 
         for (auto& cnn_name : cnn_names) {
-            if (IRToNgraphLayersMap.find(cnn_name) != IRToNgraphLayersMap.end()) {
-                auto ngraph_names = split_string(IRToNgraphLayersMap.at(cnn_name));
+            if (m_program->IRToNgraphLayersMap.find(cnn_name) != m_program->IRToNgraphLayersMap.end()) {
+                auto ngraph_names = split_string(m_program->IRToNgraphLayersMap.at(cnn_name));
                 res.insert(res.end(), ngraph_names.begin(), ngraph_names.end());
             } else {
                 res.push_back(cnn_name);
@@ -498,7 +499,7 @@ void CLDNNGraph::UpdatePerfStatistics() {
     auto allPrimitives = GetNetwork()->get_all_primitives();
 
     // Get profiling info for all layers
-    for (auto &profiledID : profilingIDs) {
+    for (auto &profiledID : m_program->profilingIDs) {
         auto pcIter = perfMap.find(profiledID);
 
         if (pcIter == perfMap.end())  continue;
@@ -572,7 +573,7 @@ void CLDNNGraph::UpdateImplementationsMap() {
         };
 
         // Parse primitive info and extract implementation name.
-        for (auto& id : profilingIDs) {
+        for (auto& id : m_program->profilingIDs) {
             std::string prim_info = "";
             try {
                 prim_info = GetNetwork()->get_primitive_info(id);
@@ -629,7 +630,7 @@ void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::Inf
         if (combinePrimByIRLayers) {
             std::string kernelId = "";
             long long kernelTime = 0;  // used for finding the most complex computation kernel in sub_graph for perf stat
-            for (auto &id : profilingIDs) {
+            for (auto &id : m_program->profilingIDs) {
                 auto iter = perfMap.find(id);
                 if (iter == perfMap.end())  continue;
 
@@ -653,7 +654,7 @@ void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::Inf
     };
 
     // Step 1. Get all primitives in execution order which was added by clDNNPlugin
-    for (auto& primId : profilingIDs) {
+    for (auto& primId : m_program->profilingIDs) {
         getFromProfiling(primId);
     }
 
@@ -662,7 +663,7 @@ void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::Inf
         auto perfIter = perfMap.find(primId);
         if (perfIter == perfMap.end())  continue;
 
-        bool existInProfiling = std::find(profilingIDs.begin(), profilingIDs.end(), primId) != profilingIDs.end();
+        bool existInProfiling = std::find(m_program->profilingIDs.begin(), m_program->profilingIDs.end(), primId) != m_program->profilingIDs.end();
         if ((!existInProfiling || (existInProfiling && perfIter->second.first.length() == 0)) &&
             executedPrimitives.find(primId) != executedPrimitives.end()) {
             auto event = executedPrimitives.at(primId);
@@ -725,12 +726,31 @@ void CLDNNGraph::GetPerformanceCounts(std::map<std::string, InferenceEngine::Inf
     }
 
     // Step 3. Checking primitives which has been deleted from execution order but added by clDNNPlugin
-    for (auto& primId : profilingIDs)
+    for (auto& primId : m_program->profilingIDs)
         if (std::find(allIds.begin(), allIds.end(), primId) == allIds.end()) {
             getFromProfiling(primId);
         }
 }
 
+void CLDNNGraph::Warmup() {
+    IE_LOAD_PHASE("warmup");
+    for (size_t nb = 0; nb < GetNetworksCount(); nb++) {
+        auto network = GetNetwork(nb);
+        for (auto& input : GetInputLayouts()) {
+            auto layout = input.second;
+            // the networks of a dynamic batch graph process 2^nb images
+            if (GetMaxDynamicBatchSize() > 1 && !HasRuntimeBatch())
+                layout.size.batch[0] = 1 << nb;
+            network->set_input_data("input:" + input.first, cldnn::memory::allocate(*GetEngine(), layout, network->get_id()));
+        }
+        auto outputs = network->execute();
+        for (auto& output : outputs) {
+            output.second.get_event().wait();
+        }
+    }
+    SetHot();
+}
+
 std::shared_ptr<cldnn::network> CLDNNGraph::GetNetwork(size_t idx) const {
     if (idx >= GetNetworksCount())
         THROW_IE_EXCEPTION << "Unable to find network with id=" << idx << ". Stored networks count: " << GetNetworksCount();
@@ -744,7 +764,7 @@ std::string CLDNNGraph::MapOutputName(std::string outName) const {
     auto allPrimitiveIds = GetNetwork()->get_all_primitives();
 
     // Find correct output ID. Start with name stored in IR.
-    std::string outputID = primitiveIDs.at(outName);
+    std::string outputID = m_program->primitiveIDs.at(outName);
     while (std::find(networkOutputsIDs.begin(), networkOutputsIDs.end(), outputID) == networkOutputsIDs.end()) {
         // If current ID isn't found in cldnn network outputs, get previous primitive id and try again.
         auto prim = allPrimitiveIds.find(outputID);
@@ -752,23 +772,23 @@ std::string CLDNNGraph::MapOutputName(std::string outName) const {
             THROW_IE_EXCEPTION << "Unknown primitive id " << outputID;
         }
 
-        if (prevPrimitiveIDs.at(outputID).size() != 1 || prim->second != "_optimized_") {
+        if (m_program->prevPrimitiveIDs.at(outputID).size() != 1 || prim->second != "_optimized_") {
             THROW_IE_EXCEPTION << "Unable to find parent for output primitive " << outputID;
         }
-        outputID = prevPrimitiveIDs.at(outputID)[0];
+        outputID = m_program->prevPrimitiveIDs.at(outputID)[0];
     }
 
     return outputID;
 }
 
 InferenceEngine::SizeVector CLDNNGraph::GetOutputSize(std::string outName) const {
-    auto res_output = outputDims.find(outName);
+    auto res_output = m_program->outputDims.find(outName);
 
     InferenceEngine::SizeVector sz;
-    if (res_output != outputDims.end())
+    if (res_output != m_program->outputDims.end())
         sz = res_output->second;
     else
-        sz = outputDims.at(primitiveIDs.at(outName));
+        sz = m_program->outputDims.at(m_program->primitiveIDs.at(outName));
 
     return sz;
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <map>
 #include <set>
@@ -54,30 +55,32 @@ public:
     int GetMaxDynamicBatchSize() const { return getConfig().max_dynamic_batch; }
     const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->getInputLayouts(); }
     size_t GetNetworksCount() const { return m_networks.size(); }
+    bool HasRuntimeBatch() const { return m_program->HasRuntimeBatch(); }
     std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
     InferenceEngine::SizeVector GetOutputSize(std::string outName) const;
     std::string MapOutputName(std::string outName) const;
     std::string getName() const { return m_networkName; }
 
+    /**
+     * @brief Runs every network of the graph once on zero inputs, so the device buffers are allocated
+     * and the kernels are loaded by the driver before the first inference
+     */
+    void Warmup();
+    bool IsHot() const { return m_hot.load(std::memory_order_relaxed); }
+    void SetHot() { if (!IsHot()) m_hot.store(true, std::memory_order_relaxed); }
+
 protected:
     std::string m_networkName;
     Config m_config;
 
     gpu::ClContext::Ptr m_context;
     std::vector<std::shared_ptr<cldnn::network>> m_networks;
-    std::map<std::string, cldnn::primitive_id> primitiveIDs;
-    std::map<cldnn::primitive_id, std::vector<std::string>> primitivesToIRLayersMap;
-    std::map<cldnn::primitive_id, std::string> IRToNgraphLayersMap;
-    std::map<std::string, std::vector<cldnn::primitive_id>> prevPrimitiveIDs;
-
     std::map<cldnn::primitive_id, std::pair<std::string, PerfCounter>> perfMap;
     std::map<cldnn::primitive_id, std::string> implementationsMap;
-    std::vector<cldnn::primitive_id> profilingIDs;
-
-    std::map<std::string, InferenceEngine::SizeVector> outputDims;
 
     std::shared_ptr<Program> m_program;
     uint16_t m_stream_id;
+    std::atomic<bool> m_hot{false};
 
     std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program);
     void Build();
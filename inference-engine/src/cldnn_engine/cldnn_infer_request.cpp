@@ -7,6 +7,7 @@
 #include <map>
 #include <functional>
 #include <utility>
+#include <cstdint>
 #include <api/detection_output.hpp>  // todo: find a way to remove this
 #include <description_buffer.hpp>
 #include "cldnn_infer_request.h"
@@ -558,17 +559,22 @@ void CLDNNInferRequest::AllocateInputs() {
             cldnn::primitive_id YName(name + "_Y");
             cldnn::primitive_id UVName(name + "_UV");
 
-            input_alloc(YName, m_graph->GetInputLayouts().at(YName));
+            const cldnn::layout& yLayout = m_graph->GetInputLayouts().at(YName);
+            input_alloc(YName, yLayout);
             input_alloc(UVName, m_graph->GetInputLayouts().at(UVName));
 
-            size_t height = desc.getDims()[2], width = desc.getDims()[3];
+            // the planes have the source frame size, which differs from the network one
+            // when the program resizes the frames itself (the layouts are { 1, 1, height, width })
+            size_t height = yLayout.size.spatial[0], width = yLayout.size.spatial[1];
             cldnn::pointer<uint8_t> input_mem_ptr_Y = inputsMemory.at(YName).pointer<uint8_t>();
             TensorDesc ydesc(Precision::U8, { 1, 1, height, width }, Layout::NHWC);
             auto blobY = createInputBlob(ydesc, input_mem_ptr_Y.data());
+            inputsHostPtr[YName] = input_mem_ptr_Y.data();
 
             cldnn::pointer<uint8_t> input_mem_ptr_UV = inputsMemory.at(UVName).pointer<uint8_t>();
             TensorDesc uvdesc(Precision::U8, { 1, 2, height / 2, width / 2 }, Layout::NHWC);
             auto blobUV = createInputBlob(uvdesc, input_mem_ptr_UV.data());
+            inputsHostPtr[UVName] = input_mem_ptr_UV.data();
 
             _inputs[name] = make_shared_blob<NV12Blob>(blobY, blobUV);
         } else {
@@ -576,6 +582,7 @@ void CLDNNInferRequest::AllocateInputs() {
             input_alloc(name, layout);
             cldnn::pointer<uint8_t> mem_ptr = inputsMemory.at(name).pointer<uint8_t>();
             _inputs[name] = createInputBlob(desc, mem_ptr.data());
+            inputsHostPtr[name] = mem_ptr.data();
 
             if (desc.getPrecision() == Precision::I16) {
                 cldnn::layout layout_fp32 = layout;
@@ -694,6 +701,12 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
         size_t single_batch = std::accumulate(std::begin(sz), std::end(sz), (size_t)1, std::multiplies<size_t>());
         std::vector<buf_info> in_buf;
 
+        // the single network of a runtime batch graph takes the whole blob
+        if (m_graph->HasRuntimeBatch()) {
+            batchInputs[input.first] = { { 0, single_batch * static_cast<size_t>(m_graph->GetMaxDynamicBatchSize()) } };
+            continue;
+        }
+
         size_t offset = 0;
         size_t bsz = single_batch;
 
@@ -719,6 +732,11 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
         size_t single_batch = std::accumulate(std::begin(sz), std::end(sz), (size_t)1, std::multiplies<size_t>());
         std::vector<buf_info> out_buf;
 
+        if (m_graph->HasRuntimeBatch()) {
+            batchOutputs[no.first] = { { 0, single_batch * static_cast<size_t>(new_batch) } };
+            continue;
+        }
+
         size_t offset = 0;
         size_t bsz = single_batch;
         // calculate metadata for output buffers
@@ -749,19 +767,64 @@ CLDNNInferRequest::CLDNNInferRequest(InputsDataMap networkInputs, OutputsDataMap
     streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(execNetwork->m_taskExecutor.get());
 }
 
+void CLDNNInferRequest::TraceExecution(tracing::TimePoint executeStart) {
+    auto executeEnd = tracing::Clock::now();
+    tracing::AddEvent("request", "CLDNN execute", executeStart, executeEnd);
+    if (!m_useProfiling) {
+        return;
+    }
+    // clDNN reports only durations of primitives, but an in-order queue executes them one by one,
+    // so they are laid out back-to-back from the submission time on a separate device track
+    auto network = m_graph->GetNetwork();
+    auto executedPrimitives = network->get_executed_primitives();
+    auto primitiveStart = executeStart;
+    for (auto&& primitiveId : network->get_executed_primitive_ids()) {
+        auto itPrimitive = executedPrimitives.find(primitiveId);
+        if (itPrimitive == executedPrimitives.end()) {
+            continue;
+        }
+        for (auto& interval : itPrimitive->second.get_profiling_info()) {
+            if (interval.name == "executing") {
+                auto primitiveEnd = primitiveStart +
+                    std::chrono::duration_cast<tracing::Clock::duration>(interval.value->value());
+                tracing::AddAsyncEvent("layer", primitiveId, reinterpret_cast<std::uintptr_t>(network.get()),
+                                       primitiveStart, primitiveEnd);
+                primitiveStart = primitiveEnd;
+            }
+        }
+    }
+}
+
 void CLDNNInferRequest::execAndParse() {
+    const auto executeStart = tracing::IsEnabled() ? tracing::Clock::now() : tracing::TimePoint{};
+    auto remoteBlobs = GetRemoteBlobs();
+    WaitRemoteBlobs(remoteBlobs);
     auto networkOutputs = m_graph->GetNetwork()->execute();
+    m_graph->SetHot();
+
+    // the remote blobs get the marker of this inference, so the request does not wait for the remote outputs
+    // and the next networks wait for the inference on the device
+    const bool nonBlockingRemoteOutputs = m_graph->getConfig().nonBlockingRemoteOutputs;
+    if (nonBlockingRemoteOutputs && !remoteBlobs.empty()) {
+        auto marker = m_graph->GetNetwork()->enqueue_marker();
+        for (auto& blob : remoteBlobs) {
+            blob->setPendingEvent(marker);
+        }
+    }
 
     // Collect outputs as requested by the model
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
 
-        std::string outputID = outputsMap[no.first];
-        auto outputMemory = networkOutputs.at(outputID).get_memory();
-
         // mapping remote blobs not needed -
         // let the user take care of them explicitly
-        if (!bptr->is<gpu::ClBlob>()) {
+        if (bptr->is<gpu::ClBlob>()) {
+            if (!nonBlockingRemoteOutputs) {
+                networkOutputs.at(outputsMap[no.first]).get_event().wait();
+            }
+        } else {
+            std::string outputID = outputsMap[no.first];
+            auto outputMemory = networkOutputs.at(outputID).get_memory();
             auto out_ptr = outputMemory.pointer<uint8_t>();
             auto blob_ptr = bptr->buffer().as<uint8_t*>();
 
@@ -777,9 +840,26 @@ void CLDNNInferRequest::execAndParse() {
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
     }
+
+    if (tracing::IsEnabled() && executeStart != tracing::TimePoint{}) {
+        TraceExecution(executeStart);
+    }
 }
 
 void CLDNNInferRequest::execAndParseDyn() {
+    if (m_graph->HasRuntimeBatch()) {
+        auto network = m_graph->GetNetwork();
+        network->set_runtime_batch(m_curBatch);
+        auto networkOutputs = network->execute();
+        m_graph->SetHot();
+
+        for (auto& no : _networkOutputs) {
+            auto outputMemory = networkOutputs.at(m_graph->MapOutputName(no.first)).get_memory();
+            copyOutputData(outputMemory, _outputs[no.first], &batchOutputs[no.first][0]);
+        }
+        return;
+    }
+
     std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> networkOutputs(m_graph->GetNetworksCount());
 
     // set up exection and put all graphs into driver queue
@@ -790,6 +870,7 @@ void CLDNNInferRequest::execAndParseDyn() {
             networkOutputs[nb] = m_graph->GetNetwork(nb)->execute();
         }
     }
+    m_graph->SetHot();
 
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
@@ -814,35 +895,117 @@ void CLDNNInferRequest::InferImpl() {
         streamID = streamExecutor->GetStreamId();
     }
     m_graph = static_cast<CLDNNExecNetwork*>(_exeNetwork.get())->m_graphs[streamID];
+
+    if (m_graph->GetMaxDynamicBatchSize() > 1) {
+        // execute input pre-processing.
+        execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
+
+        for (auto &item : _inputs) {
+            PrepareInputDyn(item.first, *item.second);
+        }
+
+        // The actual inference
+        execAndParseDyn();
+    } else {
+        UploadInputs();
+        ExecuteNetwork();
+    }
+}
+
+void CLDNNInferRequest::UploadInputs() {
+    // a previous upload could be interrupted by an exception, its copies must not race with the new ones
+    WaitUploads();
+
     // execute input pre-processing.
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
 
     for (auto &item : _inputs) {
         std::string name = item.first;
         Blob::Ptr inputBlob = item.second;
+        auto nv12_ptr = inputBlob->as<NV12Blob>();
 
-        if (m_graph->GetMaxDynamicBatchSize() > 1) {
-            PrepareInputDyn(name, *inputBlob);
+        if (nv12_ptr == nullptr) {
+            // regular blob
+            UploadInput(name, *inputBlob);
         } else {
-            auto nv12_ptr = inputBlob->as<NV12Blob>();
+            // special case for NV12 input blob
+            UploadInput(name + "_Y", *nv12_ptr->y());
+            UploadInput(name + "_UV", *nv12_ptr->uv());
+        }
+    }
+}
 
-            if (nv12_ptr == nullptr) {
-                // regular blob
-                PrepareInput(name, *inputBlob);
-            } else {
-                // special case for NV12 input blob
-                PrepareInput(name + "_Y", *nv12_ptr->y());
-                PrepareInput(name + "_UV", *nv12_ptr->uv());
-            }
+void CLDNNInferRequest::ExecuteNetwork() {
+    WaitUploads();
+
+    for (auto &item : _inputs) {
+        std::string name = item.first;
+        Blob::Ptr inputBlob = item.second;
+        auto nv12_ptr = inputBlob->as<NV12Blob>();
+
+        if (nv12_ptr == nullptr) {
+            BindInput(name, *inputBlob);
+        } else {
+            BindInput(name + "_Y", *nv12_ptr->y());
+            BindInput(name + "_UV", *nv12_ptr->uv());
         }
     }
 
     // The actual inference
-    if (m_graph->GetMaxDynamicBatchSize() > 1) {
-        execAndParseDyn();
-    } else {
-        execAndParse();
+    execAndParse();
+}
+
+std::vector<CLDNNRemoteBlobImpl*> CLDNNInferRequest::GetRemoteBlobs() {
+    std::vector<CLDNNRemoteBlobImpl*> blobs;
+    auto addRemote = [&](const Blob::Ptr& blob) {
+        auto remote = blob ? blob->as<gpu::ClBlob>() : nullptr;
+        auto impl = remote ? getBlobImpl(remote) : nullptr;
+        if (impl != nullptr) {
+            blobs.push_back(impl);
+        }
+    };
+    for (auto& input : _inputs) {
+        auto nv12_ptr = input.second->as<NV12Blob>();
+        if (nv12_ptr == nullptr) {
+            addRemote(input.second);
+        } else {
+            addRemote(nv12_ptr->y());
+            addRemote(nv12_ptr->uv());
+        }
+    }
+    for (auto& output : _outputs) {
+        addRemote(output.second);
+    }
+    return blobs;
+}
+
+void CLDNNInferRequest::WaitRemoteBlobs(const std::vector<CLDNNRemoteBlobImpl*>& blobs) {
+    // the previous users of the remote blobs may still be in flight. The inferences of the same engine
+    // are waited for on the device, the events of other engines can only be waited for by the host
+    auto engine = m_graph->GetEngine();
+    std::vector<cldnn::event> dependencies;
+    for (auto& blob : blobs) {
+        auto pending = blob->getPendingEvent();
+        if (pending == nullptr) {
+            continue;
+        }
+        auto context = std::dynamic_pointer_cast<gpu::ClContext>(blob->getContext());
+        if (context != nullptr && getContextImpl(context)->GetEngine()->get() == engine->get()) {
+            dependencies.push_back(*pending);
+        } else {
+            pending->wait();
+        }
     }
+    if (!dependencies.empty()) {
+        m_graph->GetNetwork()->enqueue_wait(dependencies);
+    }
+}
+
+void CLDNNInferRequest::WaitUploads() {
+    for (auto& event : uploadEvents) {
+        event.wait();
+    }
+    uploadEvents.clear();
 }
 
 void CLDNNInferRequest::GetPerformanceCounts(
@@ -876,59 +1039,77 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
 
 }  // namespace
 
-void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
-    // Get input layout
+void CLDNNInferRequest::UploadInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     if (m_graph->GetInputLayouts().find(inputName) == m_graph->GetInputLayouts().end()) {
         THROW_IE_EXCEPTION << "Input name mismatch.";
     }
-    auto inputLayout = m_graph->GetInputLayouts().at(inputName);
-    auto is_same_buffer = [](const Blob& blob, const cldnn::memory& memory) -> bool {
-        const std::string str_not_allocated("Input data was not allocated.");
-        cldnn::pointer<const uint8_t> ptr = memory.pointer<const uint8_t>();
-        const uint8_t* blob_ptr = blob.cbuffer().as<const uint8_t*>();
-        const uint8_t* mem_ptr = ptr.data();
-        if (blob_ptr == nullptr || mem_ptr == nullptr) {
-            THROW_IE_EXCEPTION << str_not_allocated;
-        }
-        return (blob_ptr == mem_ptr) && (blob.byteSize() == memory.size());
-    };
-
-    cldnn::primitive_id internalName = "input:" + inputName;
-    const cldnn::memory& memory = inputsMemory.at(inputName);
-    auto _nw_ptr = m_graph->GetNetwork();
-    auto prec = inputBlob.getTensorDesc().getPrecision();
 
     if (inputBlob.is<gpu::ClBlob>()) {
-        // no need to check for reuse
-        _nw_ptr->set_input_data(internalName, memory);
-    } else if (prec == Precision::I16) {
+        // remote blobs are attached to inputsMemory by SetBlob, the data is on the device already
+        return;
+    }
+
+    auto prec = inputBlob.getTensorDesc().getPrecision();
+    if (prec == Precision::I16) {
         // clDNN doesn't support I16 input precision, so we always have to convert input data to fp32 precision
         const cldnn::memory& fp32_mem = inputsMemory.at(inputName+fp32_suffix);
         cldnn::pointer<float> ptr = fp32_mem.pointer<float>();
         copyToFloat<int16_t>(ptr.data(), &inputBlob);
-        _nw_ptr->set_input_data(internalName, fp32_mem);
-    } else if (is_same_buffer(inputBlob, memory)) {
-        // If input memory was allocated by cldnn engine and wasn't overwritten by user set_input_data method won't copy input data.
-        switch (prec) {
-            case Precision::FP32:
-            case Precision::FP16:
-            case Precision::U8:
-            case Precision::BOOL:
-            case Precision::I32:
-            case Precision::I64: {
-                _nw_ptr->set_input_data(internalName, memory);
-                break;
-            }
-            default:
-                THROW_IE_EXCEPTION << "Unsupported input precision " << prec;
-        }
+        return;
+    }
+
+    switch (prec) {
+        case Precision::FP32:
+        case Precision::FP16:
+        case Precision::U8:
+        case Precision::BOOL:
+        case Precision::I32:
+        case Precision::I64:
+            break;
+        default:
+            THROW_IE_EXCEPTION << "The plugin does not support input " << prec << " precision";
+    }
+
+    const void* blob_ptr = inputBlob.cbuffer().as<const void*>();
+    if (blob_ptr == nullptr) {
+        THROW_IE_EXCEPTION << str_not_allocated;
+    }
+
+    auto hostPtr = inputsHostPtr.find(inputName);
+    if (hostPtr != inputsHostPtr.end() && hostPtr->second == blob_ptr) {
+        // the blob was allocated by the request over the input memory, so the data is in place
+        return;
+    }
+
+    // Otherwise, copy the user data to the input memory. The copy is not waited for here,
+    // so preprocessing and uploading the rest of inputs overlap the transfer
+    const cldnn::memory& memory = inputsMemory.at(inputName);
+    if (inputBlob.byteSize() != memory.size()) {
+        THROW_IE_EXCEPTION << "The input blob size is not equal to the network input size: got "
+                           << inputBlob.byteSize() << " bytes expecting " << memory.size();
+    }
+    uploadEvents.push_back(memory.copy_from(blob_ptr));
+}
+
+void CLDNNInferRequest::BindInput(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    cldnn::primitive_id internalName = "input:" + inputName;
+    auto _nw_ptr = m_graph->GetNetwork();
+
+    if (!inputBlob.is<gpu::ClBlob>() && inputBlob.getTensorDesc().getPrecision() == Precision::I16) {
+        _nw_ptr->set_input_data(internalName, inputsMemory.at(inputName+fp32_suffix));
     } else {
-        // Otherwise, we have to attach to user memory and then copy the data.
-        copyInputData(_nw_ptr, inputName, inputLayout, inputBlob);
+        // inputsMemory is allocated by the engine, so set_input_data does not copy it
+        _nw_ptr->set_input_data(internalName, inputsMemory.at(inputName));
     }
 }
 
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    if (m_graph->HasRuntimeBatch()) {
+        copyInputData(m_graph->GetNetwork(), inputName, m_graph->GetInputLayouts().at(inputName), inputBlob,
+                      &batchInputs[inputName][0]);
+        return;
+    }
+
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
         unsigned int mask = 1 << nb;
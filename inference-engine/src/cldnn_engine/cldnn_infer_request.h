@@ -10,6 +10,7 @@
 #include <memory>
 #include <atomic>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <ie_tracing.hpp>
 #include "cldnn_graph.h"
 #include <threading/ie_istreams_executor.hpp>
 
@@ -24,11 +25,18 @@ class CLDNNExecNetwork;
 
 class CLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
+    using Ptr = std::shared_ptr<CLDNNInferRequest>;
+
     // make sure all blobs and cldnn::memory objects
     // are in place and valid
     void checkBlobs() override;
     void InferImpl() override;
 
+    // InferImpl() for a network without dynamic batch split in two stages,
+    // so the asynchronous pipeline can upload inputs of one request while another one is executed
+    void UploadInputs();
+    void ExecuteNetwork();
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     CLDNNInferRequest(InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs,
@@ -48,6 +56,10 @@ public:
 
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
+    // host pointers of the input blobs allocated over inputsMemory, such inputs need no upload
+    std::map<std::string, const void*> inputsHostPtr;
+    // pending non-blocking copies of user input blobs to inputsMemory
+    std::vector<cldnn::event> uploadEvents;
     std::map<std::string, cldnn::primitive_id> outputsMap;
 
     bool m_useProfiling;
@@ -74,8 +86,13 @@ protected:
     void AllocateOutputsDyn();
     void execAndParse();
     void execAndParseDyn();
+    void TraceExecution(InferenceEngine::tracing::TimePoint executeStart);
 
-    void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void UploadInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void BindInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void WaitUploads();
+    std::vector<CLDNNRemoteBlobImpl*> GetRemoteBlobs();
+    void WaitRemoteBlobs(const std::vector<CLDNNRemoteBlobImpl*>& blobs);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
 
 private:
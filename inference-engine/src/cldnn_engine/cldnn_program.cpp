@@ -85,6 +85,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <exec_graph_info.hpp>
+#include <precision_utils.h>
 
 #include "low_precision_transformations/transformer.hpp"
 #include "low_precision_transformations/eltwise.hpp"
@@ -94,6 +95,7 @@
 #include <iostream>
 #include <iomanip>
 #include "cldnn_common_utils.h"
+#include <ie_load_time_profile.hpp>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -240,7 +242,9 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
 
         auto transforms = LowPrecisionTransformer::getAllTransformations(params)
                 .add<FullyConnectedTransformation>(LayerTransformation::Params(params).setSupportAsymmetricQuantization(false), "FullyConnected")
-                .add<FullyConnectedTransformation>(LayerTransformation::Params(params).setSupportAsymmetricQuantization(false), "GEMM");
+                .add<FullyConnectedTransformation>(LayerTransformation::Params(params).setSupportAsymmetricQuantization(false), "GEMM")
+                // quantized Interp inputs are supported by CPU plugin only
+                .remove("Interp");
 
         auto it = details::CNNNetworkIterator(&network);
         auto end = details::CNNNetworkIterator();
@@ -263,6 +267,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
             NetPass::ConvertPrecision(network, Precision::FP16, Precision::FP32);
         }
 
+        IE_LOAD_PHASE("low_precision");
         LowPrecisionTransformer transformer(transforms);
         transformer.transform(network);
     }
@@ -296,7 +301,20 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
 
     m_max_batch = config.max_dynamic_batch;
 
-    if (config.max_dynamic_batch > 1) {
+    // one program for the maximal batch if all its primitives can run for a part of the batch,
+    // a program per power of two of the batch otherwise
+    if (config.max_dynamic_batch > 1 && config.runtimeBatch) {
+        changeInputBatch(config.max_dynamic_batch);
+        m_runtimeBatch = true;
+        auto program = BuildProgram(network);
+        m_engine->release_pending_memory(0);
+        m_runtimeBatch = program->supports_runtime_batch();
+        if (m_runtimeBatch) {
+            m_programs.emplace_back(program);
+        }
+    }
+
+    if (config.max_dynamic_batch > 1 && !m_runtimeBatch) {
         for (int b = m_bv_sz - 1; b >= 0; b--) {
             inputLayouts.clear();
             outputDims.clear();
@@ -307,7 +325,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
             m_programs.insert(m_programs.begin(), BuildProgram(network));
             m_engine->release_pending_memory(0);
         }
-    } else {
+    } else if (config.max_dynamic_batch <= 1) {
         m_programs.emplace_back(BuildProgram(network));
         m_engine->release_pending_memory(0);
     }
@@ -386,16 +404,28 @@ void Program::InitFormat(InferenceEngine::ICNNNetwork &network) {
 }
 
 std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwork &network) {
+    IE_LOAD_PHASE("program");
     cldnn::build_options options;
     if (!m_config.graph_dumps_dir.empty()) {
         options.set_option(cldnn::build_option::graph_dumps_dir(m_config.graph_dumps_dir));
     }
+    if (!m_config.weights_cache_dir.empty()) {
+        options.set_option(cldnn::build_option::weights_cache_dir(m_config.weights_cache_dir));
+    }
     options.set_option(cldnn::build_option::optimize_data(true));
-    options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    options.set_option(cldnn::build_option::detection_output_gpu(m_config.gpuDetectionOutput));
+    options.set_option(cldnn::build_option::runtime_batch(m_runtimeBatch));
+    auto tuningConfig = m_config.tuningConfig;
+    if (m_config.backgroundTuning && !std::ifstream(tuningConfig.cache_file_path).good()) {
+        // nothing is tuned yet, the background tuning creates the file
+        tuningConfig.mode = cldnn::tuning_mode::tuning_disabled;
+    }
+    options.set_option(cldnn::build_option::tuning_config(tuningConfig));
 
     cldnn::topology topology;
 
     // 1. create inputs
+    std::unique_ptr<LoadTimeProfile::Phase> topologyPhase(new LoadTimeProfile::Phase("topology"));
     InferenceEngine::InputsDataMap networkInputs;
     network.getInputsInfo(networkInputs);
 
@@ -478,7 +508,10 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwo
     // 4. ???
     // 5. profit
     p_currentOutputs.clear();
+    topologyPhase.reset();
 
+    // graph optimizations and compilation of kernels are done by clDNN
+    IE_LOAD_PHASE("build");
     return std::make_shared<cldnn::program>(*m_engine, topology, options);
 }
 
@@ -709,7 +742,7 @@ cldnn::primitive_id Program::CreatePrimitiveFromBlob(cldnn::topology& topology,
 
     auto data = static_cast<const char *>(pBlob->buffer()) + blobByteOffset;
 
-    auto bufIter = blobMemCache.find(data);
+    auto bufIter = blobMemCache.find({data, blobLayout.data_type});
 
     if (bufIter != blobMemCache.end()) {
         return bufIter->second;
@@ -769,13 +802,19 @@ cldnn::primitive_id Program::CreatePrimitiveFromBlob(cldnn::topology& topology,
                 }
             }
         }
+    } else if (pBlob->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+               blobLayout.data_type == cldnn::data_types::f16) {
+        // compressed weights
+        InferenceEngine::PrecisionUtils::f32tof16Arrays(reinterpret_cast<InferenceEngine::ie_fp16*>(buf),
+                                                        reinterpret_cast<const float*>(data),
+                                                        blobLayout.count());
     } else {
         for (size_t i = 0; i < bufSize; i++) {
             buf[i] = data[i];
         }
     }
     topology.add(cldnn::data(primID, mem));
-    blobMemCache[data] = primID;
+    blobMemCache[{data, blobLayout.data_type}] = primID;
     return primID;
 }
 
@@ -796,6 +835,7 @@ void Program::CreateWeightAndBiasPrimitives(cldnn::topology& topology,
     unsigned groupSize = 1;
     WeightRearrangeType rearrange = NO_REARRANGE;
     size_t inputs_count = 0;
+    bool compressibleWeights = false;
 
     switch (LayerTypeFromStr(layer->type)) {
     case Convolution: {
@@ -817,6 +857,7 @@ void Program::CreateWeightAndBiasPrimitives(cldnn::topology& topology,
         pWeightsBlob = getBlobOrNull(layer, "weights");
         pBiasBlob = getBlobOrNull(layer, "biases");
         inputs_count = 1;
+        compressibleWeights = true;
         break;
     }
     case Deconvolution: {
@@ -884,6 +925,7 @@ void Program::CreateWeightAndBiasPrimitives(cldnn::topology& topology,
         inputs_count = 1;
         pWeightsBlob = getBlobOrNull(layer, "weights");
         pBiasBlob = getBlobOrNull(layer, "biases");
+        compressibleWeights = true;
         break;
     }
     default:
@@ -922,8 +964,13 @@ void Program::CreateWeightAndBiasPrimitives(cldnn::topology& topology,
             weightsPrimID.push_back(wei_name);
         }
     } else {
+        auto weightsType = DataTypeFromPrecision(pWeightsBlob->getTensorDesc().getPrecision());
+        if (compressibleWeights && m_config.fp16Weights && weightsType == cldnn::data_types::f32 &&
+            m_config.fp32WeightsLayers.count(layer->name) == 0) {
+            weightsType = cldnn::data_types::f16;
+        }
         cldnn::layout weightsLayout = cldnn::layout(
-            DataTypeFromPrecision(pWeightsBlob->getTensorDesc().getPrecision()),
+            weightsType,
             wFmt,
             cldnn::tensor(wFmt, weightDimsVec));
         cldnn::primitive_id weightID = layer_type_name_ID(layer) + m_weightsTag;
@@ -5213,13 +5260,35 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         int height = inputDims[2];
         int width = inputDims[3];
 
+        // the frames may come in a size different from the network input one (e.g. decoded VA surfaces),
+        // in that case the resize is done by the program itself right after the color conversion
+        const int srcHeight = m_config.nv12_source_height;
+        const int srcWidth = m_config.nv12_source_width;
+        const bool resizeOnDevice = preProcess.getResizeAlgorithm() != NO_RESIZE &&
+                                    srcWidth > 0 && srcHeight > 0 &&
+                                    (srcWidth != width || srcHeight != height);
+        if (resizeOnDevice) {
+            if ((srcWidth % 2) != 0 || (srcHeight % 2) != 0) {
+                THROW_CLDNN_EXCEPTION("Odd NV12 source size (" << srcWidth << "x" << srcHeight
+                    << ") for input " + inputInfo->name());
+            }
+            if (preProcess.getResizeAlgorithm() == RESIZE_AREA &&
+                ((srcWidth % width) != 0 || (srcHeight % height) != 0)) {
+                THROW_CLDNN_EXCEPTION("Area resize is supported only for integer downscale factors, got "
+                    << srcWidth << "x" << srcHeight << " to " << width << "x" << height
+                    << " for input " + inputInfo->name());
+            }
+        }
+
         std::string y_name = inputName + "_Y";
         std::string uv_name = inputName + "_UV";
 
+        const int lumaHeight = resizeOnDevice ? srcHeight : height;
+        const int lumaWidth = resizeOnDevice ? srcWidth : width;
         cldnn::layout y_layout(DataTypeFromPrecision(ip),
-                                cldnn::format::nv12, { 1, 1, height, width });
+                                cldnn::format::nv12, { 1, 1, lumaHeight, lumaWidth });
         cldnn::layout uv_layout(DataTypeFromPrecision(ip),
-                                cldnn::format::nv12, { 1, 2, height / 2, width / 2 });
+                                cldnn::format::nv12, { 1, 2, lumaHeight / 2, lumaWidth / 2 });
         auto inputY = cldnn::input_layout(y_name, y_layout);
         auto inputUV = cldnn::input_layout(uv_name, uv_layout);
 
@@ -5227,25 +5296,71 @@ void Program::AddInputPrimitive(cldnn::topology& topology, InputInfo::Ptr inputI
         inputLayouts.insert({ inputInfo->name() + "_Y", y_layout });
         topology.add(inputUV);
         inputLayouts.insert({ inputInfo->name() + "_UV", uv_layout });
-        switch (preProcess.getMeanVariant()) {
-        case NONE:
-        case MEAN_VALUE: {
-            topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanValues));
-            break;
-        }
-        case MEAN_IMAGE: {
-            topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanBlobID));
-            break;
-        }
-        default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
-            break;
+
+        if (!resizeOnDevice) {
+            switch (preProcess.getMeanVariant()) {
+            case NONE:
+            case MEAN_VALUE: {
+                topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanValues));
+                break;
+            }
+            case MEAN_IMAGE: {
+                topology.add(cldnn::reorder(preprocessPrimID, y_name, uv_name, networkInputLayout, meanBlobID));
+                break;
+            }
+            default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
+                break;
+            }
+        } else {
+            // convert the color at the source size, the mean values are subtracted here as well
+            // since both resize algorithms keep the per-channel constants unchanged.
+            // The mean image has the network size and therefore is subtracted after the resize.
+            cldnn::layout convertedLayout(networkInputLayout);
+            convertedLayout.size.spatial[0] = srcWidth;
+            convertedLayout.size.spatial[1] = srcHeight;
+            cldnn::primitive_id convertPrimID = preprocessPrimID + "_nv12";
+            cldnn::primitive_id resizePrimID = preprocessPrimID;
+
+            switch (preProcess.getMeanVariant()) {
+            case NONE:
+            case MEAN_VALUE:
+                topology.add(cldnn::reorder(convertPrimID, y_name, uv_name, convertedLayout, meanValues));
+                break;
+            case MEAN_IMAGE:
+                topology.add(cldnn::reorder(convertPrimID, y_name, uv_name, convertedLayout, std::vector<float>()));
+                resizePrimID = preprocessPrimID + "_resize";
+                break;
+            default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
+                break;
+            }
+
+            if (preProcess.getResizeAlgorithm() == RESIZE_AREA) {
+                // integer factors make the area interpolation an average over non-overlapping windows
+                auto window = (cldnn::tensor) cldnn::spatial(srcWidth / width, srcHeight / height);
+                topology.add(cldnn::pooling(resizePrimID, convertPrimID, cldnn::pooling_mode::average, window, window));
+            } else {
+                // half-pixel centers without aligned corners, the same as RESIZE_BILINEAR on the host does
+                topology.add(cldnn::resample(resizePrimID, convertPrimID, networkInputLayout.size,
+                                             0, 0, 0, cldnn::resample_type::caffe_bilinear));
+            }
+
+            if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+                topology.add(cldnn::reorder(preprocessPrimID, resizePrimID, networkInputLayout, meanBlobID));
+                primitivesToIRLayersMap[resizePrimID] = { inputInfo->name() };
+                profilingIDs.push_back(resizePrimID);
+                InitProfileInfo(resizePrimID, "Resize");
+            }
+
+            primitivesToIRLayersMap[convertPrimID] = { inputInfo->name() };
+            profilingIDs.push_back(convertPrimID);
+            InitProfileInfo(convertPrimID, "Reorder");
         }
 
         primitivesToIRLayersMap[preprocessPrimID] = { inputInfo->name() };
         primitivesToIRLayersMap[y_name] = { inputInfo->name() };
         primitivesToIRLayersMap[uv_name] = { inputInfo->name() };
         profilingIDs.push_back(preprocessPrimID);
-        InitProfileInfo(preprocessPrimID, "Reorder");
+        InitProfileInfo(preprocessPrimID, resizeOnDevice && preProcess.getMeanVariant() != MEAN_IMAGE ? "Resize" : "Reorder");
     } else {
         cldnn::layout inputLayout(networkInputLayout);
         inputLayout.data_type = DataTypeFromPrecision(ip);
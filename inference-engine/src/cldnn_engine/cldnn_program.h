@@ -98,16 +98,19 @@ public:
 
     std::map<std::string, InferenceEngine::SizeVector> outputDims;
     std::map<std::string, cldnn::layout> inputLayouts;
-    std::map<const char *, cldnn::primitive_id> blobMemCache;
+    std::map<std::pair<const char *, cldnn::data_types>, cldnn::primitive_id> blobMemCache;
 
     int m_max_batch;
     int m_curBatch;
+    bool m_runtimeBatch = false;
 
     InferenceEngine::OutputsDataMap p_currentOutputs;
 
     std::vector<cldnn::primitive_id> GetPrevLayersPrimitives(const InferenceEngine::CNNLayerPtr layer) const;
     const std::map<std::string, cldnn::layout>& getInputLayouts() const { return inputLayouts; }
     int GetMaxBatchSizeForSingleProgram();
+    // one program serves any dynamic batch, its networks run for the first images of the batch
+    bool HasRuntimeBatch() const { return m_runtimeBatch; }
 
     void AddPrimitiveToProfiler(cldnn::primitive_id id, const InferenceEngine::CNNLayerPtr &layer,
                                 cldnn::primitive_id customOutputId = "");
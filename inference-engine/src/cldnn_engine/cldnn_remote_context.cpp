@@ -24,12 +24,32 @@ CLDNNRemoteBlobImpl::CLDNNRemoteBlobImpl(ClContext::Ptr context,
 }
 
 ParamMap CLDNNRemoteBlobImpl::getParams() const {
+    auto params = getMemoryParams();
+    auto pending = getPendingEvent();
+    if (pending != nullptr && pending->get_ocl_handle() != nullptr) {
+        params[GPU_PARAM_KEY(OCL_EVENT)] = static_cast<gpu_handle_param>(pending->get_ocl_handle());
+    }
+    return params;
+}
+
+void CLDNNRemoteBlobImpl::setPendingEvent(const cldnn::event& event) {
+    std::lock_guard<std::mutex> lock(m_pendingEventMutex);
+    m_pendingEvent = std::make_shared<cldnn::event>(event);
+}
+
+std::shared_ptr<cldnn::event> CLDNNRemoteBlobImpl::getPendingEvent() const {
+    std::lock_guard<std::mutex> lock(m_pendingEventMutex);
+    return m_pendingEvent;
+}
+
+ParamMap CLDNNRemoteBlobImpl::getMemoryParams() const {
     assert(m_memObject != nullptr);
     auto params = m_memObject->get_internal_params();
 
     switch (m_mem_type) {
     case BT_BUF_INTERNAL:
     case BT_BUF_SHARED:
+    case BT_HOST_SHARED:
         return{
             { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(OCL_BUFFER) },
             { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
@@ -92,6 +112,9 @@ void CLDNNRemoteBlobImpl::allocate_if_needed() {
         case BlobType::BT_BUF_SHARED:
             m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
             break;
+        case BlobType::BT_HOST_SHARED:
+            m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_host_buffer(*eng, m_layout, m_mem)));
+            break;
 #ifdef WIN32
         case BlobType::BT_SURF_SHARED:
             m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_surface(*eng, m_layout, m_mem, m_plane)));
@@ -127,6 +150,9 @@ void CLDNNRemoteBlobImpl::allocate() noexcept {
     case BlobType::BT_BUF_SHARED:
         m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
         break;
+    case BlobType::BT_HOST_SHARED:
+        m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_host_buffer(*eng, m_layout, m_mem)));
+        break;
 #ifdef WIN32
     case BlobType::BT_SURF_SHARED:
         m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_surface(*eng, m_layout, m_mem, m_plane)));
@@ -163,6 +189,11 @@ std::shared_ptr<RemoteContext> CLDNNRemoteBlobImpl::getContext() const noexcept
 }
 
 void CLDNNRemoteBlobImpl::lock() const {
+    // the memory is mapped by another queue, which is not ordered with the inference writing it
+    auto pending = getPendingEvent();
+    if (pending != nullptr) {
+        pending->wait();
+    }
     lockedHolder = std::unique_ptr<cldnn::pointer<uint8_t>>(new cldnn::pointer<uint8_t>(m_memObject->pointer<uint8_t>()));
     auto ptr = lockedHolder->data();
     _handle = reinterpret_cast<void*>(ptr);
@@ -262,7 +293,17 @@ CLDNNExecutionContextImpl::CLDNNExecutionContextImpl(const std::shared_ptr<Infer
             m_config.queuePriority,
             m_config.queueThrottle,
             m_config.memory_pool_on,
-            m_config.throughput_streams));
+            m_config.throughput_streams,
+            "cache.json",
+            m_config.compilation_threads,
+            m_config.kernels_per_program,
+            m_config.kernels_cache_dir,
+            m_config.queueSyncMode,
+            m_config.shared_memory_pool));
+
+    if (m_config.backgroundTuning) {
+        m_tuner = std::make_shared<BackgroundTuner>(dev, m_config);
+    }
 }
 
 ParamMap CLDNNExecutionContextImpl::getParams() const {
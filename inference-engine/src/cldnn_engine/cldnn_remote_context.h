@@ -8,10 +8,13 @@
 #include <map>
 #include <memory>
 #include <atomic>
+#include <mutex>
 #include <ie_parameter.hpp>
 #include <cpp_interfaces/impl/ie_plugin_internal.hpp>
 #include "cldnn_config.h"
+#include "cldnn_background_tuner.h"
 #include <api/memory.hpp>
+#include <api/event.hpp>
 #include <api/engine.hpp>
 #include "cldnn_common_utils.h"
 #ifdef WIN32
@@ -33,6 +36,7 @@ public:
         BT_IMG_SHARED,
         BT_SURF_SHARED,
         BT_DX_BUF_SHARED,
+        BT_HOST_SHARED,
     };
 
     explicit CLDNNRemoteBlobImpl(gpu::ClContext::Ptr context,
@@ -60,6 +64,10 @@ public:
     void allocate_if_needed();
     cldnn::memory& getMemory() { return *m_memObject; }
 
+    // the marker of the last inference which used the blob, the next users of the memory wait for it
+    void setPendingEvent(const cldnn::event& event);
+    std::shared_ptr<cldnn::event> getPendingEvent() const;
+
 protected:
     static CLDNNRemoteAllocator m_allocator;
     std::weak_ptr<gpu::ClContext> m_context;
@@ -78,6 +86,10 @@ protected:
     mutable void* _handle;
     mutable std::shared_ptr<IAllocator> _allocator;
 
+    mutable std::mutex m_pendingEventMutex;
+    std::shared_ptr<cldnn::event> m_pendingEvent;
+
+    ParamMap getMemoryParams() const;
     void  lock() const;
     void  unlock() const;
 };
@@ -218,6 +230,7 @@ public:
     std::shared_ptr<cldnn::engine> GetEngine() const { return m_engine; }
     Config& GetConfig() { return m_config; }
     ContextType GetType() const { return m_type; }
+    BackgroundTuner::Ptr GetBackgroundTuner() const { return m_tuner; }
     const std::weak_ptr<InferencePluginInternal> GetPlugin() const { return m_plugin; }
 
     void acquire_lock() {
@@ -236,6 +249,7 @@ protected:
     ContextType m_type;
     std::weak_ptr<InferencePluginInternal> m_plugin;
     std::atomic_flag lock;
+    BackgroundTuner::Ptr m_tuner;
 };
 
 template<typename TpublicContextAPI>
@@ -324,6 +338,7 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
 
             switch (blob_type) {
             case CLDNNRemoteBlobImpl::BlobType::BT_BUF_SHARED:
+            case CLDNNRemoteBlobImpl::BlobType::BT_HOST_SHARED:
                 ret = std::make_shared<CLDNNRemoteCLbuffer>(smart_this,
                     tensorDesc, layout, mem, 0, 0, blob_type);
                 break;
@@ -348,7 +363,8 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
         return ret;
     }
 
-    RemoteBlob::Ptr create_buffer(const TensorDesc& tensorDesc) {
+    RemoteBlob::Ptr create_buffer(const TensorDesc& tensorDesc,
+        CLDNNRemoteBlobImpl::BlobType blob_type = CLDNNRemoteBlobImpl::BlobType::BT_BUF_INTERNAL) {
         cldnn::layout layout(DataTypeFromPrecision(tensorDesc.getPrecision()),
             FormatFromLayout(tensorDesc.getLayout()),
             CldnnTensorFromIEDims(tensorDesc.getDims()));
@@ -358,7 +374,7 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
             tensorDesc,
             layout,
             nullptr, 0, 0,
-            CLDNNRemoteBlobImpl::BlobType::BT_BUF_INTERNAL);
+            blob_type);
     }
 
     void check_if_shared() {
@@ -388,6 +404,16 @@ public:
             if (GPU_PARAM_VALUE(VA_SURFACE) == memTypeStr) {
                 check_if_shared();
                 return reuse_surf(tensorDesc, params);
+            } else if (GPU_PARAM_VALUE(HOST_BUFFER) == memTypeStr) {
+                if (params.find(GPU_PARAM_KEY(MEM_HANDLE)) == params.end()) {
+                    // user wants clDNN to allocate host memory by itself
+                    return create_buffer(tensorDesc, CLDNNRemoteBlobImpl::BlobType::BT_HOST_SHARED);
+                }
+                auto mem = gpu::details::param_map_obj_getter::_ObjFromParamSimple<cldnn::shared_handle>(params, GPU_PARAM_KEY(MEM_HANDLE));
+                if (reinterpret_cast<uintptr_t>(mem) % cldnn::host_buffer_alignment != 0) {
+                    THROW_IE_EXCEPTION << "Host buffer must be aligned to " << cldnn::host_buffer_alignment << " bytes";
+                }
+                return reuse_obj(tensorDesc, mem, CLDNNRemoteBlobImpl::BlobType::BT_HOST_SHARED);
             } else {
                 CLDNNRemoteBlobImpl::BlobType blob_type;
                 cldnn::shared_handle mem = nullptr;
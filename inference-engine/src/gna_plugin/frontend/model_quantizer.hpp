@@ -98,14 +98,10 @@ class ModelQuantizer {
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net, int weightsBytesSize) const {
         ScaleFactorCalculator sf(net, weightsBytesSize);
 
+        // single pass in topological order, when an output scale is updated due to situation in downstream layer
+        // the pass resumes from the updated layer instead of starting over
         while (!sf.allLayersProcessed()) {
-            for (auto &&layer : sf.getStartLayers()) {
-                transformLayer(layer, sf);
-                // transforming until we reached cases where output scale updated due to situation in downstream layer
-                if (sf.needToRestart()) {
-                    break;
-                }
-            }
+            transformLayer(sf.getCurrentLayer(), sf);
         }
     }
 };
@@ -2,11 +2,45 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
 #include "quantization.h"
 
+namespace {
+
+// the largest absolute weight, the reduction has no branches to let the compiler vectorize it
+float MaxAbsWeight(const float *ptr_float_weights, size_t num_elements) {
+    float max_weight = -1e20f;
+    for (size_t i = 0; i < num_elements; i++) {
+        max_weight = std::max(max_weight, std::fabs(ptr_float_weights[i]));
+    }
+    return max_weight;
+}
+
+// quantizes one row of weights and zeroes the padding, returns the number of saturations
+template <typename T>
+uint32_t QuantizeRow(const float *ptr_float_row, T *ptr_int_row, float scale_factor,
+                     uint32_t num_columns, uint32_t num_columns_padded) {
+    const float max_value = static_cast<float>(std::numeric_limits<T>::max());
+    const float min_value = static_cast<float>(std::numeric_limits<T>::min());
+    uint32_t num_saturate = 0;
+    for (uint32_t col = 0; col < num_columns; col++) {
+        float rounding_value = (ptr_float_row[col] > 0) ? 0.5f : -0.5f;
+        float value = ptr_float_row[col] * scale_factor + rounding_value;
+        num_saturate += (value > max_value) | (value < min_value);
+        ptr_int_row[col] = static_cast<T>(std::min(std::max(value, min_value), max_value));
+    }
+    std::fill(ptr_int_row + num_columns, ptr_int_row + num_columns_padded, T(0));
+    return num_saturate;
+}
+
+}  // namespace
+
 void QuantizeAffine16(float *ptr_float_weights,
                       float *ptr_float_biases,
                       int16_t *ptr_int_weights,
@@ -18,31 +52,9 @@ void QuantizeAffine16(float *ptr_float_weights,
                       uint32_t num_columns,
                       uint32_t num_rows_padded,
                       uint32_t num_columns_padded) {
-    uint32_t num_saturate = 0;
-
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i * num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsWeight(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         if (max_weight != 0.0f) {
             *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_2B_WEIGHT) / max_weight;
@@ -50,32 +62,15 @@ void QuantizeAffine16(float *ptr_float_weights,
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
 
-    for (uint32_t row = 0; row < num_rows; row++) {
-        for (uint32_t col = 0; col < num_columns; col++) {
-            float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            if (value > 32767.0) {
-                *ptr_weight_16 = 32767;
-                num_saturate++;
-            } else if (value < -32768.0) {
-                *ptr_weight_16 = -32768;
-                num_saturate++;
-            } else {
-                *ptr_weight_16 = (int16_t) value;
-            }
-        }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
-    for (uint32_t row = num_rows; row < num_rows_padded; row++) {
-        for (uint32_t col = 0; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
+    // rows are independent, each one is quantized by its own thread
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    uint32_t num_saturate = InferenceEngine::parallel_sum(num_rows, 0u, [&](uint32_t row) {
+        return QuantizeRow(ptr_float_weights + static_cast<size_t>(row) * num_columns,
+                           ptr_int_weights + static_cast<size_t>(row) * num_columns_padded,
+                           weight_scale_factor, num_columns, num_columns_padded);
+    });
+    std::fill(ptr_int_weights + static_cast<size_t>(num_rows) * num_columns_padded,
+              ptr_int_weights + static_cast<size_t>(num_rows_padded) * num_columns_padded, int16_t(0));
 
     // case for element wise layer
     if (ptr_float_biases != nullptr && ptr_int_biases != nullptr) {
@@ -156,31 +151,9 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
     if (ptr_int_biases == nullptr) {
         THROW_IE_EXCEPTION << "Int biases are empty";
     }
-    uint32_t num_saturate = 0;
-
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i*num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsWeight(ptr_float_weights, static_cast<size_t>(num_rows) * num_columns);
 
         *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_1B_WEIGHT) / max_weight;
 
@@ -192,46 +165,24 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
         *ptr_weight_scale_factor = MAX_OUT_MULTIPLIER * *ptr_weight_scale_factor;  //  increase dynamic range by max multiplier
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
-    float valueAcc = 0.0;
-    for (uint32_t row = 0; row < num_rows; row++) {
+
+    // rows are independent, each one is quantized by its own thread
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    uint32_t num_saturate = InferenceEngine::parallel_sum(num_rows, 0u, [&](uint32_t row) {
+        const float *ptr_float_row = ptr_float_weights + static_cast<size_t>(row) * num_columns;
         float scaled_row_max = 0;
-        float rounding_value, value;
         for (uint32_t col = 0; col < num_columns; col++) {
-            value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
-            if (fabs(value) > scaled_row_max) {
-                scaled_row_max = fabs(value);
-            }
+            scaled_row_max = std::max(scaled_row_max, std::fabs(ptr_float_row[col] * weight_scale_factor));
         }
 
-        value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
+        float value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
         ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
-        for (uint32_t col = 0; col < num_columns; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
-            rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-
-
-            value = ptr_float_weights[row * num_columns + col] * (*ptr_weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
-            if (value > 127.0) {
-                *ptr_weight_8 = 127;
-                num_saturate++;
-            } else if (value < -128.0) {
-                *ptr_weight_8 = -128;
-                num_saturate++;
-            } else {
-                *ptr_weight_8 = (int8_t) value;
-            }
-        }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_8 = 0;
-        }
-    }
+        return QuantizeRow(ptr_float_row, ptr_int_weights + static_cast<size_t>(row) * num_columns_padded,
+                           weight_scale_factor / ptr_int_biases[row].multiplier, num_columns, num_columns_padded);
+    });
+    std::fill(ptr_int_weights + static_cast<size_t>(num_rows) * num_columns_padded,
+              ptr_int_weights + static_cast<size_t>(num_rows_padded) * num_columns_padded, int8_t(0));
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
-        for (uint32_t col = 0; col < num_columns_padded; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
-            *ptr_weight_8 = 0;
-        }
         ptr_int_biases[row].multiplier = 0;
     }
 
@@ -10,6 +10,7 @@
 #include <limits>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <ie_layers.h>
 #include "gna_upstream_iterator.hpp"
@@ -627,23 +628,32 @@ class ScaleFactorPerLayer<InferenceEngine::ConvolutionLayer*> : public ScaleFact
 class ScaleFactorCalculator {
     using Cnt = std::vector<InferenceEngine::CNNLayerPtr>;
     Cnt  net;
-    mutable Cnt::const_iterator idx;
+    // positions of the layers in the sorted net, a restart resumes right after the restart layer
+    std::unordered_map<InferenceEngine::CNNLayer *, size_t> positions;
+    mutable size_t idx = 0;
     mutable bool needRestart = false;
     int weightsBytesSize;
 
  public:
     ScaleFactorCalculator(Cnt &net, int weightsBytesSize)
             : net(net), weightsBytesSize(weightsBytesSize) {
-        idx = std::begin(this->net);
+        positions.reserve(this->net.size());
+        for (size_t i = 0; i < this->net.size(); i++) {
+            positions.emplace(this->net[i].get(), i);
+        }
     }
     bool needToRestart() const {
         return needRestart;
     }
     bool allLayersProcessed() const {
-        return idx == std::end(net);
+        return idx == net.size();
     }
-    std::vector<InferenceEngine::CNNLayerPtr> getStartLayers() const {
-        return std::vector<InferenceEngine::CNNLayerPtr>(idx, std::end(net));
+    /**
+     * @brief the layer to calculate next, every call of the calculator either moves to the following layer
+     * or goes back to the layer after the one whose output scale factor was updated
+     */
+    InferenceEngine::CNNLayerPtr getCurrentLayer() const {
+        return net[idx];
     }
     template<class T>
     bool operator()(T ptr) const {
@@ -657,15 +667,8 @@ class ScaleFactorCalculator {
             return true;
         }
 
-        idx = std::find_if(net.begin(), net.end(), [&](InferenceEngine::CNNLayerPtr cnnLayer) {
-            if (!result) {
-                return result.restartLayer == cnnLayer.get();
-            }
-            return ptr == cnnLayer.get();
-        });
-        if (idx != net.end()) {
-            idx++;
-        }
+        auto restartPosition = positions.find(result.restartLayer);
+        idx = restartPosition == positions.end() ? net.size() : restartPosition->second + 1;
         needRestart = true;
         return true;
     }
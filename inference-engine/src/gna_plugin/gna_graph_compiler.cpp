@@ -17,6 +17,7 @@
 #include <ie_layers.h>
 #include <gna-api-types-xnn.h>
 #include <ie_algorithm.hpp>
+#include <ie_data_hash.hpp>
 #include <debug.h>
 
 #include "gna_graph_compiler.hpp"
@@ -976,7 +977,11 @@ void GNAGraphCompiler::AffinePrimitive(InferenceEngine::CNNLayerPtr layer, bool
         transposedCols = connectionInfo.permute->input()->getDims()[1];
     }
 
-    if (num_padding == 0) {
+    // the layout of the weights depends on the padding, transposed weights are not shared
+    auto weightsLayout = (static_cast<size_t>(num_padding) << 1 | (isDiag ? 1 : 0)) * 31 + num_rows_out;
+    if (!transpose && bindSharedWeights(ptr_weights, weightable._weights, weightsLayout)) {
+        gnalog() << "Layer " << layer->name << " shares weights with a layer placed before\n";
+    } else if (num_padding == 0) {
         if (!transpose) {
             gnamem->readonly().push_ptr(ptr_weights,
                 weightable._weights->cbuffer().as<const void*>(),
@@ -1908,6 +1913,24 @@ GNAPluginNS::ConnectionDetails GNAGraphCompiler::connectInput(CNNLayerPtr layer,
     THROW_GNA_EXCEPTION << "Cannot connect input for: " << layer->name;
 }
 
+bool GNAGraphCompiler::bindSharedWeights(void *ptr_weights, const InferenceEngine::Blob::Ptr &weights, size_t layout) {
+    auto data = weights->cbuffer().as<const uint8_t*>();
+    auto size = weights->byteSize();
+    auto key = static_cast<size_t>(InferenceEngine::computeDataHash(data, size, layout));
+
+    auto candidates = sharedWeights.equal_range(key);
+    for (auto it = candidates.first; it != candidates.second; ++it) {
+        auto &shared = it->second;
+        if (shared.layout != layout || shared.weights->byteSize() != size) continue;
+        if (shared.weights != weights && std::memcmp(shared.weights->cbuffer().as<const void*>(), data, size) != 0) continue;
+
+        gnamem->readonly().bind_ptr(ptr_weights, shared.ptr_weights);
+        return true;
+    }
+    sharedWeights.emplace(key, SharedWeights{weights, layout, ptr_weights});
+    return false;
+}
+
 void GNAGraphCompiler::Reset() {
     for (auto && memLayer : memory_connection) {
         std::memset(memLayer.second.gna_ptr, 0, memLayer.second.reserved_size);
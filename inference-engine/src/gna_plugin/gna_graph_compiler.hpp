@@ -46,6 +46,28 @@ private:
 
     intel_dnn_component_t * find_first_unused_input(InferenceEngine::CNNLayerPtr current);
 
+    /**
+     * @brief weights already requested in the read only memory, keys are hashes of the weights data and layout.
+     * Layers with equal weights, e.g. the iterations of an unrolled TensorIterator or LSTMCell, share the memory
+     * so the size of the model does not depend on the number of iterations
+     */
+    struct SharedWeights {
+        InferenceEngine::Blob::Ptr weights;
+        size_t layout;
+        void *ptr_weights;
+    };
+    std::unordered_multimap<size_t, SharedWeights> sharedWeights;
+
+    /**
+     * @brief binds the weights pointer to the memory of equal weights requested before,
+     * otherwise remembers the weights for the following layers
+     * @param ptr_weights - pointer that holds current layer weights pointer in gna_mem request
+     * @param weights - weights of the layer
+     * @param layout - hash of the parameters affecting the layout of the weights in memory, e.g. padding
+     * @return true if the weights were bound and no memory has to be requested
+     */
+    bool bindSharedWeights(void *ptr_weights, const InferenceEngine::Blob::Ptr &weights, size_t layout);
+
 public:
     GNAPluginNS::backend::DnnComponents dnnComponents;
     MemoryConnection memory_connection;
@@ -5,10 +5,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <map>
 
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
+#include "threading/ie_executor_manager.hpp"
 #include "gna_plugin.hpp"
 
 namespace GNAPluginNS {
@@ -16,12 +18,17 @@ namespace GNAPluginNS {
 class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // the request is synced by a user and by the callback task, only the first one exports the outputs
+    std::mutex syncMutex;
+    bool synced = true;
+    InferenceEngine::ITaskExecutor::Ptr callbackExecutor;
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
                     InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg),
+          callbackExecutor(InferenceEngine::ExecutorManager::getInstance()->getExecutor("GNA")) {
         // TODO: internal connection API - better to generalize
         if (networkOutputs.empty()) {
             THROW_GNA_EXCEPTION << "GNAInferRequest :: network has zero outputs";
@@ -68,13 +75,24 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     void StartAsyncImpl() override {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        inferRequestIdx = plg->QueueInference(_inputs, _outputs);
-        // workaround to unblock callback-based flows
+        {
+            std::lock_guard<std::mutex> lock{syncMutex};
+            inferRequestIdx = plg->QueueInference(_inputs, _outputs);
+            synced = false;
+        }
+        // the callback waits for the device in the executor, so the calling thread can queue other requests
         if (_callback) {
             auto infer_request = _publicInterface.lock();
             IE_ASSERT(infer_request != nullptr);
-            auto res = Wait(0);
-            _callback(infer_request, res);
+            callbackExecutor->run([this, infer_request] {
+                InferenceEngine::StatusCode res;
+                try {
+                    res = Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+                } catch (...) {
+                    res = InferenceEngine::GENERAL_ERROR;
+                }
+                _callback(infer_request, res);
+            });
         }
     }
 
@@ -85,7 +103,11 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str;
         }
 
-        plg->Wait(inferRequestIdx);
+        std::lock_guard<std::mutex> lock{syncMutex};
+        if (!synced) {
+            synced = true;
+            plg->Wait(inferRequestIdx);
+        }
         return InferenceEngine::OK;
     }
 };
@@ -25,6 +25,8 @@
 #include <gna/gna_config.hpp>
 #include "gna_plugin_config.hpp"
 #include <ie_util_internal.hpp>
+#include <ie_blob_stream.hpp>
+#include <mmap_object.hpp>
 #include "gna_plugin.hpp"
 #include "optimizer/gna_pass_manager.hpp"
 #include "layers/gna_layer_type.hpp"
@@ -61,6 +63,7 @@ uint32_t ToByteSize(const Gna2DataType type) {
 
 constexpr uint32_t GNAPluginNS::GNAPlugin::FAKE_REQUEST_CONFIG_ID;
 #endif
+constexpr int32_t GNAPluginNS::GNAPlugin::REQUEST_CONFIG_RESERVED;
 using namespace InferenceEngine;
 using namespace std;
 using namespace GNAPluginNS;
@@ -349,6 +352,15 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     NetPass::ConvertPrecision(network, Precision::U64, Precision::I32);
     NetPass::ConvertPrecision(network, Precision::U32, Precision::I32);
 
+    // the model is compiled for one frame and repeated for every frame of the batch
+    if (gnaFlags->unroll_frames && network.getBatchSize() > 1) {
+        framesPerRequest = static_cast<uint32_t>(network.getBatchSize());
+        ResponseDesc resp;
+        if (network.setBatchSize(1, &resp) != OK) {
+            THROW_GNA_EXCEPTION << "Cannot unroll frames of the batch: " << resp.msg;
+        }
+    }
+
     // move blobs from Constant layers to Convolution, Deconvolution, FullyConnected layers attributes
     BlobTransformation blobsTransformation;
     blobsTransformation.transform(network, true);
@@ -433,6 +445,25 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
 
     auto sortedNet = CNNNetSortTopologicallyEx(*newNet, make_fuzed_order);
 
+    insertedLayers.clear();
+    for (auto &layer : sortedNet) {
+        LayerInfo layerInfo(layer);
+        if (layerInfo.isCopy()) {
+            insertedLayers["Copy"]++;
+        } else if (layerInfo.isIdentity()) {
+            insertedLayers["Identity"]++;
+        } else if (layerInfo.isConcatAlignFilter()) {
+            insertedLayers["ConcatAlignFilter"]++;
+        } else if (layerInfo.isAffineFilter()) {
+            insertedLayers["AffineFilter"]++;
+        } else if (layerInfo.isScaleShift() && layer->name.find("SyntheticScaleShift_") == 0) {
+            insertedLayers["Diagonal"]++;
+        }
+    }
+    for (auto &&inserted : insertedLayers) {
+        gnalog() << "Inserted " << inserted.second << " " << inserted.first << " layers\n";
+    }
+
     // passing policy to compiler
     graphCompiler.setPolicy(policy);
 
@@ -603,6 +634,19 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     gnamem->reserve_ptr(nullptr,
         ALIGN64(outputsDesc.front().num_bytes_per_element * outputsDesc.front().num_elements), 64);
 
+    // the next frames of the batch have their own copies of the inputs and outputs
+    void *pFramesData = nullptr;
+    if (framesPerRequest > 1) {
+        size_t frameBytes = 0;
+        for (auto &&input : inputsDataMap) {
+            frameBytes += ALIGN64(inputsDesc->bytes_allocated_for_input[input.first]);
+        }
+        for (auto &&outputDesc : outputsDesc) {
+            frameBytes += ALIGN64(outputDesc.num_bytes_per_element * outputDesc.num_elements);
+        }
+        gnamem->reserve_ptr(&pFramesData, frameBytes * (framesPerRequest - 1), 64);
+    }
+
     void *pParallelExecutionData  = nullptr;
 
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
@@ -613,6 +657,10 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
 
     gnamem->commit();
 
+    if (framesPerRequest > 1) {
+        InitFrameRegions(pFramesData);
+    }
+
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
              gnaFlags->sw_fp32 ? kDnnFloat : kDnnInt,
@@ -622,6 +670,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     for (auto &element : graphCompiler.dnnComponents.components) {
         dnn->component.push_back(element.second);
     }
+    UnrollFrames();
 
     // in fp32 mode last PWL cannot be computed without that
     dnn->InitActiveList(NULL);
@@ -744,6 +793,21 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     num_rotate_rows = dnn->num_rotate_rows;
     num_rotate_columns = dnn->num_rotate_columns;
 
+    // infer requests accept all frames of the batch
+    if (framesPerRequest > 1) {
+        auto setBatch = [this](const DataPtr &data) {
+            auto dims = data->getTensorDesc().getDims();
+            dims[0] = framesPerRequest;
+            data->setDims(dims);
+        };
+        for (auto &&input : inputsDataMap) {
+            setBatch(input.second->getInputData());
+        }
+        for (auto &&output : outputsDataMap) {
+            setBatch(output.second);
+        }
+    }
+
     DumpXNNToFile();
 
 #ifdef PLOT
@@ -754,6 +818,81 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
 #endif
 }
 
+void GNAPlugin::InitFrameRegions(void *ptrFramesData) {
+    auto framesData = reinterpret_cast<uint8_t *>(ptrFramesData);
+    auto addRegion = [&](void *ptr, size_t size, const std::string &name) {
+        auto begin = reinterpret_cast<uint8_t *>(ptr);
+        if (begin == nullptr || size == 0) {
+            THROW_GNA_EXCEPTION << "Cannot unroll frames: " << name << " is not allocated in GNA memory";
+        }
+        for (auto &&region : frameRegions) {
+            if (begin < region.begin + region.size && region.begin < begin + size) {
+                THROW_GNA_EXCEPTION << "Cannot unroll frames: " << name << " shares GNA memory with another input or output";
+            }
+        }
+        // the state of memory layers is kept in one place for all frames
+        for (auto &&memory : graphCompiler.memory_connection) {
+            auto state = reinterpret_cast<uint8_t *>(memory.second.gna_ptr);
+            if (begin < state + memory.second.reserved_size && state < begin + size) {
+                THROW_GNA_EXCEPTION << "Cannot unroll frames: " << name << " is the state of memory layer " << memory.first;
+            }
+        }
+        size_t stride = ALIGN64(size);
+        frameRegions.push_back({begin, size, stride, framesData - begin});
+        framesData += stride * (framesPerRequest - 1);
+    };
+
+    for (auto &&input : inputsDataMap) {
+        if (input.second->getTensorDesc().getDims().size() != 2) {
+            THROW_GNA_EXCEPTION << "Cannot unroll frames: input " << input.first << " is not 2D";
+        }
+        addRegion(inputsDesc->getPtrInputsGlobal(input.first).front(), inputsDesc->bytes_allocated_for_input[input.first],
+                  "input " + input.first);
+    }
+    int outputIdx = 0;
+    for (auto &&output : outputsDataMap) {
+        if (output.second->getTensorDesc().getDims().size() != 2) {
+            THROW_GNA_EXCEPTION << "Cannot unroll frames: output " << output.first << " is not 2D";
+        }
+        auto &outputDesc = outputsDesc[outputIdx++];
+        addRegion(outputDesc.ptrs.front(), outputDesc.num_bytes_per_element * outputDesc.num_elements, "output " + output.first);
+    }
+}
+
+ptrdiff_t GNAPlugin::FrameOffset(const void *ptr, uint32_t frame) const {
+    if (frame == 0) {
+        return 0;
+    }
+    auto p = reinterpret_cast<const uint8_t *>(ptr);
+    for (auto &&region : frameRegions) {
+        if (p >= region.begin && p < region.begin + region.size) {
+            return region.nextFrameOffset + static_cast<ptrdiff_t>(region.stride * (frame - 1));
+        }
+    }
+    // intermediate buffers are reused by all the frames
+    return 0;
+}
+
+void GNAPlugin::UnrollFrames() {
+    if (framesPerRequest <= 1) {
+        return;
+    }
+    auto atFrame = [this](void *ptr, uint32_t frame) -> void * {
+        return ptr == nullptr ? nullptr : reinterpret_cast<uint8_t *>(ptr) + FrameOffset(ptr, frame);
+    };
+    const auto frameComponents = dnn->component;
+    for (uint32_t frame = 1; frame < framesPerRequest; frame++) {
+        for (auto component : frameComponents) {
+            component.ptr_inputs = atFrame(component.ptr_inputs, frame);
+            component.ptr_outputs = atFrame(component.ptr_outputs, frame);
+            if (component.operation == kDnnRecurrentOp) {
+                component.op.recurrent.ptr_feedbacks = atFrame(component.op.recurrent.ptr_feedbacks, frame);
+            }
+            dnn->component.push_back(component);
+        }
+    }
+}
+
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice) {
@@ -852,25 +991,60 @@ void RotateFeatures(uint8_t *ptr_feat,
     }
 }
 
+namespace {
+/**
+ * @brief Frees the request config on destruction, so the config is not lost if the inference throws
+ */
+template <typename RequestId>
+class RequestConfigGuard {
+ public:
+    RequestConfigGuard(std::mutex& mutex, RequestId& requestId) : mutex(mutex), requestId(&requestId) {}
+    RequestConfigGuard(const RequestConfigGuard&) = delete;
+    RequestConfigGuard& operator=(const RequestConfigGuard&) = delete;
+    ~RequestConfigGuard() {
+        if (requestId != nullptr) {
+            std::lock_guard<std::mutex> lock{mutex};
+            *requestId = -1;
+        }
+    }
+    /**
+     * @brief Keeps the config busy, must be called with the mutex locked
+     */
+    void dismiss() {
+        requestId = nullptr;
+    }
+
+ private:
+    std::mutex& mutex;
+    RequestId* requestId;
+};
+}  // namespace
+
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
 #if GNA_LIB_VER == 2
     auto& nnets = gnaRequestConfigToRequestIdMap;
 #endif
+    if (!graphCompiler.memory_connection.empty()) {
+        // memory layers keep the state in the only request config, so the requests are executed one by one
+        Wait(0);
+    }
+
+    std::unique_lock<std::mutex> lock{requestConfigsMutex};
     auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
         return std::get<1>(item) == -1;
     });
 
     if (freeNnet == nnets.end()) {
-        if (!graphCompiler.memory_connection.empty()) {
-            Wait(0);
-            freeNnet = nnets.begin();
-        } else {
-            THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
-                               << "GNA executable network has max of "
-                               << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
-                               << " parallel infer requests, please sync one of already running";
-        }
+        THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
+                           << "GNA executable network has max of "
+                           << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
+                           << " parallel infer requests, please sync one of already running";
     }
+    // the inputs of the config are filled in without the lock, so other requests are queued meanwhile
+    using RequestIdType = std::remove_reference<decltype(std::get<1>(*freeNnet))>::type;
+    std::get<1>(*freeNnet) = REQUEST_CONFIG_RESERVED;
+    lock.unlock();
+    RequestConfigGuard<RequestIdType> configGuard{requestConfigsMutex, std::get<1>(*freeNnet)};
 
     auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
 
@@ -911,6 +1085,26 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
 
         auto dims = input.second->getTensorDesc().getDims();
 
+        if (framesPerRequest > 1) {
+            // every frame goes to the input of its copy of the model
+            auto inputPtrs = inputsDesc->getPtrInputsGlobal(input.first);
+            auto frameSize = static_cast<uint32_t>(dims.back());
+            auto frameBytes = frameSize * input.second->getTensorDesc().getPrecision().size();
+            for (uint32_t frame = 0; frame < framesPerRequest; frame++) {
+                ImportFrames(reinterpret_cast<uint8_t *>(inputPtrs[idx]) + FrameOffset(inputPtrs.front(), frame),
+                             input.second->cbuffer().as<uint8_t *>() + frame * frameBytes,
+                             input.second->getTensorDesc().getPrecision(),
+                             gnaFlags->sw_fp32 ? 1.0f : inputsDesc->getScaleFactor(inputNum),
+                             inputsDesc->getOrientation(input.first),
+                             1,
+                             1,
+                             frameSize,
+                             frameSize);
+            }
+            ++inputNum;
+            continue;
+        }
+
         ImportFrames(inputsDesc->getPtrInputsGlobal(input.first)[idx],
                      input.second->cbuffer().as<float *>(),
                      input.second->getTensorDesc().getPrecision(),
@@ -936,20 +1130,19 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
         ++inputNum;
     }
 
+    RequestIdType requestId = -1;
     if (!gnadevice) {
         dnn->Propagate();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
-        }
+        requestId = 1;
     } else {
 #if GNA_LIB_VER == 1
         auto nnet = std::get<0>(*freeNnet).get();
-        std::get<1>(*freeNnet) = gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices, config.gna_proc_type);
+        requestId = gnadevice->propagate(&nnet->obj, ptr_active_indices, num_active_indices, config.gna_proc_type);
 #else
         const auto reqConfigId = std::get<0>(*freeNnet);
         if (ptr_active_indices != nullptr && num_active_indices > 0 && activeLayerIndex != 0xffffffff)
             gnadevice->setUpActiveList(reqConfigId, activeLayerIndex, ptr_active_indices, num_active_indices);
-        std::get<1>(*freeNnet) = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
+        requestId = gnadevice->propagate(reqConfigId, config.pluginGna2AccMode);
 #endif
     }
 
@@ -960,10 +1153,11 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     dnn_dump_write_index++;
 #endif
-    if (freeNnet != nnets.end()) {
-        // TODO: GNA2: Substitute properly when using GNA 2.0 Library setting and CPU
-        std::get<2>(*freeNnet) = result;
-    }
+    lock.lock();
+    std::get<1>(*freeNnet) = requestId;
+    // TODO: GNA2: Substitute properly when using GNA 2.0 Library setting and CPU
+    std::get<2>(*freeNnet) = result;
+    configGuard.dismiss();
     return idx;
 }
 
@@ -972,14 +1166,20 @@ void GNAPlugin::Wait(uint32_t request_idx) {
     auto& nnets = gnaRequestConfigToRequestIdMap;
 #endif
     if (nnets.size() <= request_idx) return;    // TODO: GNA2: check whether necessary
+    // GNA completes the requests in the queue order, so waiting one by one does not delay them
+    std::lock_guard<std::mutex> waitLock{waitMutex};
+    std::unique_lock<std::mutex> lock{requestConfigsMutex};
     // already synced TODO: might be copy required ???
-    if (std::get<1>(nnets[request_idx]) == -1) return;
+    auto requestId = std::get<1>(nnets[request_idx]);
+    if (requestId == -1 || requestId == REQUEST_CONFIG_RESERVED) return;
+    lock.unlock();
 
     if (gnadevice) {
-        gnadevice->wait(std::get<1>(nnets[request_idx]));
+        gnadevice->wait(requestId);
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
+    // the config is released after its outputs are exported, since the next request writes to the same memory
+    RequestConfigGuard<decltype(requestId)> configGuard{requestConfigsMutex, std::get<1>(nnets[request_idx])};
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -1012,16 +1212,32 @@ void GNAPlugin::Wait(uint32_t request_idx) {
 //                           dims[dims.size() - 1]);
 //        }
             auto& exportOutputDims = outputBlob->getTensorDesc().getDims();
-            ExportScores(outputBlob->buffer(),
-                         outputDesc.ptrs[request_idx],
-                         outputDesc.orientation,
-                         exportOutputDims[0],
-                         exportOutputDims[exportOutputDims.size() - 2],
-                         exportOutputDims[exportOutputDims.size() - 1],
-                         exportOutputDims[exportOutputDims.size() - 1],
-                         exportOutputDims[exportOutputDims.size() - 1],
-                         outputDesc.num_bytes_per_element,
-                         sizeof(float));
+            if (framesPerRequest > 1) {
+                auto frameSize = static_cast<uint32_t>(exportOutputDims.back());
+                for (uint32_t frame = 0; frame < framesPerRequest; frame++) {
+                    ExportScores(outputBlob->buffer().as<uint8_t *>() + frame * frameSize * sizeof(float),
+                                 reinterpret_cast<uint8_t *>(outputDesc.ptrs[request_idx]) + FrameOffset(outputDesc.ptrs.front(), frame),
+                                 outputDesc.orientation,
+                                 1,
+                                 1,
+                                 frameSize,
+                                 frameSize,
+                                 frameSize,
+                                 outputDesc.num_bytes_per_element,
+                                 sizeof(float));
+                }
+            } else {
+                ExportScores(outputBlob->buffer(),
+                             outputDesc.ptrs[request_idx],
+                             outputDesc.orientation,
+                             exportOutputDims[0],
+                             exportOutputDims[exportOutputDims.size() - 2],
+                             exportOutputDims[exportOutputDims.size() - 1],
+                             exportOutputDims[exportOutputDims.size() - 1],
+                             exportOutputDims[exportOutputDims.size() - 1],
+                             outputDesc.num_bytes_per_element,
+                             sizeof(float));
+            }
         } else if (outputBlob->getTensorDesc().getLayout() != Layout::CN) {
             THROW_GNA_EXCEPTION << "Expected output blob to have Layout::NC or Layout::CN. But was "
                 << outputBlob->getTensorDesc().getLayout();
@@ -1129,12 +1345,21 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
 }
 
 InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::string &modelFileName) {
-    // no need to return anything dueto weird design of internal base classes
+    // the mapped model is parsed in place, so the GNA memory is filled by a single copy from the page cache
+    if (auto mapping = InferenceEngine::details::mapFile(modelFileName)) {
+        InferenceEngine::details::BlobStream inputStream(InferenceEngine::details::make_mapped_blob(mapping));
+        return ImportNetwork(inputStream);
+    }
+
     std::fstream inputStream(modelFileName, ios_base::in | ios_base::binary);
     if (inputStream.fail()) {
         THROW_GNA_EXCEPTION << "Cannot open file to import model: " << modelFileName;
     }
+    return ImportNetwork(inputStream);
+}
 
+InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(std::istream &inputStream) {
+    // no need to return anything dueto weird design of internal base classes
     auto header = GNAModelSerial::ReadHeader(inputStream);
 
     InitGNADevice();
@@ -1209,6 +1434,10 @@ void GNAPlugin::Export(const std::string &fileName) {
         THROW_GNA_EXCEPTION << " network not loaded";
     }
 
+    if (framesPerRequest > 1) {
+        THROW_GNA_EXCEPTION << " exporting network with unrolled frames not supported";
+    }
+
 #if GNA_LIB_VER == 1
     if (inputsDesc->ptr_inputs_global_id.size() != 1) {
         THROW_GNA_EXCEPTION << " exporting network with multiple inputs not supported";
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <cstddef>
 #include <map>
 #include <unordered_map>
 #include <list>
+#include <istream>
 #include <string>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <tuple>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
@@ -52,6 +55,17 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
 #endif
 
+    /**
+     * @brief - the request configs are picked and released by the infer requests of different threads,
+     * a config being filled in by QueueInference is marked with REQUEST_CONFIG_RESERVED
+     */
+    std::mutex requestConfigsMutex;
+    static constexpr int32_t REQUEST_CONFIG_RESERVED = -2;
+    /**
+     * @brief - serializes waits, so a config is synced and its outputs are exported once
+     */
+    std::mutex waitMutex;
+
 #if GNA_LIB_VER == 2
     uint32_t activeLayerIndex = 0xffffffff;
 #endif
@@ -81,6 +95,26 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief number of consecutive frames of the batch computed by one request, see KEY_GNA_UNROLL_FRAMES
+     */
+    uint32_t framesPerRequest = 1;
+    /**
+     * @brief an input or output buffer of the first frame, the copies for the next frames are stride bytes apart
+     */
+    struct FrameRegion {
+        uint8_t *begin;
+        size_t size;
+        size_t stride;
+        ptrdiff_t nextFrameOffset;
+    };
+    std::vector<FrameRegion> frameRegions;
+
+    /**
+     * @brief numbers of the helper layers inserted by the passes, see GNA_INSERTED_LAYERS metric
+     */
+    std::map<std::string, uint64_t> insertedLayers;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::MemoryStateInternal::Ptr> memoryStates;
@@ -143,6 +177,7 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     }
 
     InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName);
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(std::istream &inputStream);
 
     /**
      * utility to provide input and output blobs externally to be used by InferenceEngine request API clients
@@ -178,6 +213,13 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
 
     void DumpXNNToFile() const;
 
+    /**
+     * @brief offset of the frame copy of a buffer, ptr belongs to the first request config
+     */
+    ptrdiff_t FrameOffset(const void *ptr, uint32_t frame) const;
+    void InitFrameRegions(void *ptrFramesData);
+    void UnrollFrames();
+
     void ImportFrames(void *ptr_dst,
                      const void *ptr_src,
                      InferenceEngine::Precision input_precision,
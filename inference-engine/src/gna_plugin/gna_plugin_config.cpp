@@ -166,6 +166,17 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                 THROW_GNA_EXCEPTION << "GNA performance counter enabling parameter "
                                     << "should be equal to YES/NO, but not" << value;
             }
+        } else if (key == GNA_CONFIG_KEY(UNROLL_FRAMES)) {
+            if (value == PluginConfigParams::YES) {
+                gnaFlags.unroll_frames = true;
+            } else if (value == PluginConfigParams::NO) {
+                gnaFlags.unroll_frames = false;
+            } else {
+                log << "GNA unroll frames parameter "
+                    << "should be equal to YES/NO, but not" << value;
+                THROW_GNA_EXCEPTION << "GNA unroll frames parameter "
+                                    << "should be equal to YES/NO, but not" << value;
+            }
         } else if (key == GNA_CONFIG_KEY(LIB_N_THREADS)) {
             uint64_t lib_threads;
             try {
@@ -253,6 +264,8 @@ void Config::AdjustKeyMapValues() {
     key_config_map[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
+    key_config_map[GNA_CONFIG_KEY(UNROLL_FRAMES)] =
+            gnaFlags.unroll_frames ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
 }
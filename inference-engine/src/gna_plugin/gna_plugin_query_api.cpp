@@ -24,8 +24,11 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
     const std::unordered_map<std::string, std::function<Parameter()>> queryApiSupported = {
         {METRIC_KEY(AVAILABLE_DEVICES), [this]() {return GetAvailableDevices();}},
         {METRIC_KEY(SUPPORTED_CONFIG_KEYS), [this]() {return config.GetSupportedKeys();}},
+        {METRIC_KEY(IMPORT_EXPORT_SUPPORT), []() {return true;}},
+        {METRIC_KEY(GNA_INSERTED_LAYERS), [this]() {return insertedLayers;}},
         {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), [this]() {
-            uint32_t nireq = 1;
+            // every request config has its own copy of the inputs and outputs, so that many requests are in the device queue
+            uint32_t nireq = gnaFlags->gna_lib_async_threads_num;
             return nireq;
         }},
         {METRIC_KEY(FULL_DEVICE_NAME), [&options, this]() {
@@ -871,7 +871,8 @@ void InsertSplitAligningFilterPass::run() {
         for (auto &&splitOutput  : l->outData) {
             auto outputSize = product(++begin(splitOutput->getDims()), end(splitOutput->getDims()));
 
-            if (currentOffset != ALIGN64(currentOffset)) {
+            // an unused output is never read, so it does not need a filter
+            if (currentOffset != ALIGN64(currentOffset) && !getInputTo(splitOutput).empty()) {
                 // this split output not beginning from 64 bytes aligned boundary - need to correct by aligning filter layer
 #ifdef PLOT
                 // getting list of layers attached to current split output
@@ -8,6 +8,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "float_kernels.hpp"
 #include "backend/dnn_types.h"
 
 
@@ -26,15 +27,13 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter32!";
     }
 
+    const auto &kernels = GNAPluginNS::runtime::GetFloatKernels();
     for (uint32_t j = 0; j < num_filter_outputs; j++) {
         float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
         for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
             float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+            ptr_outputs[j * component->op.conv1D.num_filters + i] =
+                ptr_biases[i] + kernels.dot_product(ptr_in, ptr_coef, num_filter_coefficients);
         }
     }
 }
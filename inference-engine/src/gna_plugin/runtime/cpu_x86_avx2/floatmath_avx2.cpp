@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+float dot_product(const float *a, const float *b, uint32_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+    acc0 = _mm256_add_ps(acc0, acc1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    float result = _mm_cvtss_f32(sum);
+    for (; i < n; i++) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+void axpy(float alpha, const float *x, float *y, uint32_t n) {
+    const __m256 valpha = _mm256_set1_ps(alpha);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(valpha, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void multiply_add(const float *a, const float *x, float *y, uint32_t n) {
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; i++) {
+        y[i] += a[i] * x[i];
+    }
+}
+
+void relu(const float *in, float *out, uint32_t n, float negative_slope) {
+    const __m256 vzero = _mm256_setzero_ps();
+    const __m256 vslope = _mm256_set1_ps(negative_slope);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(in + i);
+        __m256 negative = _mm256_cmp_ps(v, vzero, _CMP_LT_OQ);
+        _mm256_storeu_ps(out + i, _mm256_blendv_ps(v, _mm256_mul_ps(v, vslope), negative));
+    }
+    for (; i < n; i++) {
+        out[i] = (in[i] < 0.0f) ? in[i] * negative_slope : in[i];
+    }
+}
+
+void clamp(const float *in, float *out, uint32_t n, float lower, float upper) {
+    const __m256 vlower = _mm256_set1_ps(lower);
+    const __m256 vupper = _mm256_set1_ps(upper);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(in + i);
+        // comparisons instead of min/max keep NaN values as the reference implementation does
+        v = _mm256_blendv_ps(v, vupper, _mm256_cmp_ps(v, vupper, _CMP_GT_OQ));
+        v = _mm256_blendv_ps(v, vlower, _mm256_cmp_ps(v, vlower, _CMP_LT_OQ));
+        _mm256_storeu_ps(out + i, v);
+    }
+    for (; i < n; i++) {
+        out[i] = (in[i] > upper) ? upper : ((in[i] < lower) ? lower : in[i]);
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx512.hpp"
+
+#include <immintrin.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+namespace {
+// the tails are processed with masked loads and stores instead of scalar loops
+inline __mmask16 tail_mask(uint32_t n) {
+    return static_cast<__mmask16>((1u << n) - 1u);
+}
+}  // namespace
+
+float dot_product(const float *a, const float *b, uint32_t n) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+    }
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+    }
+    if (i < n) {
+        auto mask = tail_mask(n - i);
+        acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+void axpy(float alpha, const float *x, float *y, uint32_t n) {
+    const __m512 valpha = _mm512_set1_ps(alpha);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(valpha, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n) {
+        auto mask = tail_mask(n - i);
+        __m512 result = _mm512_fmadd_ps(valpha, _mm512_maskz_loadu_ps(mask, x + i), _mm512_maskz_loadu_ps(mask, y + i));
+        _mm512_mask_storeu_ps(y + i, mask, result);
+    }
+}
+
+void multiply_add(const float *a, const float *x, float *y, uint32_t n) {
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n) {
+        auto mask = tail_mask(n - i);
+        __m512 result = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, x + i),
+                                        _mm512_maskz_loadu_ps(mask, y + i));
+        _mm512_mask_storeu_ps(y + i, mask, result);
+    }
+}
+
+void relu(const float *in, float *out, uint32_t n, float negative_slope) {
+    const __m512 vzero = _mm512_setzero_ps();
+    const __m512 vslope = _mm512_set1_ps(negative_slope);
+    for (uint32_t i = 0; i < n; i += 16) {
+        auto mask = (n - i >= 16) ? static_cast<__mmask16>(0xFFFF) : tail_mask(n - i);
+        __m512 v = _mm512_maskz_loadu_ps(mask, in + i);
+        __mmask16 negative = _mm512_cmp_ps_mask(v, vzero, _CMP_LT_OQ);
+        _mm512_mask_storeu_ps(out + i, mask, _mm512_mask_mul_ps(v, negative, v, vslope));
+    }
+}
+
+void clamp(const float *in, float *out, uint32_t n, float lower, float upper) {
+    const __m512 vlower = _mm512_set1_ps(lower);
+    const __m512 vupper = _mm512_set1_ps(upper);
+    for (uint32_t i = 0; i < n; i += 16) {
+        auto mask = (n - i >= 16) ? static_cast<__mmask16>(0xFFFF) : tail_mask(n - i);
+        __m512 v = _mm512_maskz_loadu_ps(mask, in + i);
+        // comparisons instead of min/max keep NaN values as the reference implementation does
+        v = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(v, vupper, _CMP_GT_OQ), v, vupper);
+        v = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(v, vlower, _CMP_LT_OQ), v, vlower);
+        _mm512_mask_storeu_ps(out + i, mask, v);
+    }
+}
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,28 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Vector primitives of the software emulation, selected once for the instruction set of the CPU
+ */
+struct FloatKernels {
+    float (*dot_product)(const float *a, const float *b, uint32_t n);
+    // y += alpha * x
+    void (*axpy)(float alpha, const float *x, float *y, uint32_t n);
+    // y += a * x elementwise
+    void (*multiply_add)(const float *a, const float *x, float *y, uint32_t n);
+    void (*relu)(const float *in, float *out, uint32_t n, float negative_slope);
+    void (*clamp)(const float *in, float *out, uint32_t n, float lower, float upper);
+};
+
+const FloatKernels &GetFloatKernels();
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -1,13 +1,113 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software emulation
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include <ie_system_conf.h>
 
 #include "floatmath.h"
+#include "float_kernels.hpp"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace {
+
+float reference_dot_product(const float *a, const float *b, uint32_t n) {
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void reference_axpy(float alpha, const float *x, float *y, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] += alpha * x[i];
+    }
+}
+
+void reference_multiply_add(const float *a, const float *x, float *y, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        y[i] += a[i] * x[i];
+    }
+}
+
+void reference_relu(const float *in, float *out, uint32_t n, float negative_slope) {
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = (in[i] < 0.0f) ? in[i] * negative_slope : in[i];
+    }
+}
+
+void reference_clamp(const float *in, float *out, uint32_t n, float lower, float upper) {
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = (in[i] > upper) ? upper : ((in[i] < lower) ? lower : in[i]);
+    }
+}
+
+GNAPluginNS::runtime::FloatKernels SelectFloatKernels() {
+#ifdef HAVE_AVX512
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        using namespace GNAPluginNS::runtime::avx512;
+        return {dot_product, axpy, multiply_add, relu, clamp};
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        using namespace GNAPluginNS::runtime::avx2;
+        return {dot_product, axpy, multiply_add, relu, clamp};
+    }
+#endif
+    return {reference_dot_product, reference_axpy, reference_multiply_add, reference_relu, reference_clamp};
+}
+
+// a few grouped frames are too narrow for vectors, so the input columns are copied out for dot products instead
+constexpr int kMinColumnsToVectorize = 16;
+
+// C[l] = C[l] + A[rows[l]] * B, B is K x N
+void sgemm_nn(const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT lda, const float *B, const MKL_INT ldb,
+              float *C, const MKL_INT ldc, const uint32_t *rows, const MKL_INT L) {
+    const auto &kernels = GNAPluginNS::runtime::GetFloatKernels();
+    if (N >= kMinColumnsToVectorize) {
+        for (MKL_INT l = 0; l < L; l++) {
+            const float *a = A + (rows ? rows[l] : l) * lda;
+            for (MKL_INT k = 0; k < K; k++) {
+                kernels.axpy(a[k], B + k * ldb, C + l * ldc, N);
+            }
+        }
+        return;
+    }
+    std::vector<float> column;
+    for (MKL_INT j = 0; j < N; j++) {
+        const float *b = B + j;
+        if (ldb != 1) {
+            column.resize(K);
+            for (MKL_INT k = 0; k < K; k++) {
+                column[k] = B[k * ldb + j];
+            }
+            b = column.data();
+        }
+        for (MKL_INT l = 0; l < L; l++) {
+            const float *a = A + (rows ? rows[l] : l) * lda;
+            C[l * ldc + j] += kernels.dot_product(a, b, K);
+        }
+    }
+}
+
+}  // namespace
+
+const GNAPluginNS::runtime::FloatKernels &GNAPluginNS::runtime::GetFloatKernels() {
+    static const FloatKernels kernels = SelectFloatKernels();
+    return kernels;
+}
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +127,14 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                for (j = 0; j < N; j++) {
+                    C[i * ldc + j] = 0;
                 }
-                C[i * ldc + j] = sum;
             }
         }
+        sgemm_nn(N, K, A, lda, B, ldb, C, ldc, nullptr, M);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -66,8 +165,6 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
                   const MKL_INT N, const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *X, const MKL_INT incX,
                   const float beta, float *Y, const MKL_INT incY) {
-    int i;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_ssbmv!\n");
         throw -1;
@@ -81,9 +178,7 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        GNAPluginNS::runtime::GetFloatKernels().multiply_add(A, X, Y, N);
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -105,16 +200,14 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (beta != 1.0) {
+            for (l = 0; l < L; l++) {
+                for (j = 0; j < N; j++) {
+                    C[l * ldc + j] = 0;
                 }
-                C[l * ldc + j] = sum;
             }
         }
+        sgemm_nn(N, K, A, lda, B, ldb, C, ldc, OutputList, L);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,19 +246,13 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
+    const auto &kernels = GNAPluginNS::runtime::GetFloatKernels();
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+    for (uint32_t i = 0; i < num_rows; i++) {
+        const float *x = X + i * num_columns;
+        C[i] = B[i] + kernels.dot_product(A1, x, K1) + kernels.dot_product(A2, x + K1, K2);
     }
 }
 
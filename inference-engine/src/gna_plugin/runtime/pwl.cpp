@@ -25,6 +25,7 @@
 #endif
 
 #include "pwl.h"
+#include "float_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -963,12 +964,10 @@ void PwlApply32(intel_dnn_component_t *component,
             break;
         case kActRelu:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
+                GNAPluginNS::runtime::GetFloatKernels().relu(ptr_in + i * num_columns + num_col_start,
+                                                             ptr_out + i * num_columns + num_col_start,
+                                                             num_col_end - num_col_start + 1,
+                                                             transform->func_id.args.lrelu.negative_slope);
             }
             break;
         case kActIdentity:
@@ -980,16 +979,10 @@ void PwlApply32(intel_dnn_component_t *component,
             break;
         case kActKaldiLstmClipping:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
+                GNAPluginNS::runtime::GetFloatKernels().clamp(ptr_in + i * num_columns + num_col_start,
+                                                              ptr_out + i * num_columns + num_col_start,
+                                                              num_col_end - num_col_start + 1,
+                                                              KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER);
             }
             break;
         case kActExp:
@@ -16,6 +16,12 @@
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Runs each subgraph as a separate pipeline stage on the device of the subgraph.
+ * A stage starts the asynchronous request of its subgraph and the next stage is started from its completion
+ * callback, so no thread is blocked while a device works and the subgraphs of different in-flight requests
+ * run on their devices concurrently.
+ */
 class HeteroAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
     using Ptr = std::shared_ptr<HeteroAsyncInferRequest>;
@@ -8,6 +8,7 @@
 #include "ie_util_internal.hpp"
 #include "hetero_graph_splitter.hpp"
 #include "xml_parse_utils.h"
+#include "exec_graph_info.hpp"
 
 #include <vector>
 #include <deque>
@@ -176,6 +177,17 @@ void dumpGraph(InferenceEngine::ICNNNetwork&                                netw
     saveGraphToDot(const_cast<InferenceEngine::ICNNNetwork&>(network), stream, split_color);
 }
 
+std::map<std::string, std::string> getExecGraphInfo(const std::string& name,
+                                                    const std::string& affinity,
+                                                    std::size_t subgraph) {
+    return {
+        {ExecGraphInfoSerialization::ORIGINAL_NAMES, name},
+        {ExecGraphInfoSerialization::PERF_COUNTER, "not_executed"},
+        {ExecGraphInfoSerialization::EXECUTION_ORDER, std::to_string(subgraph)},
+        {ExecGraphInfoSerialization::AFFINITY, affinity}
+    };
+}
+
 }   // namespace
 
 void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& network_) {
@@ -272,6 +284,23 @@ void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& ne
         dumpGraph(network, subgraphs, file);
     }
 
+    // the executable graph shows the original layers with the devices and subgraphs they are executed in
+    std::unordered_map<std::string, std::size_t> layerSubgraphs;
+    for (auto&& subgraph : subgraphs) {
+        for (auto&& layer : subgraph) {
+            layerSubgraphs.emplace(layer->name, std::distance(subgraphs.data(), &subgraph));
+        }
+    }
+    auto execGraph = cloneNet(network);
+    for (details::CNNNetworkIterator itLayer(execGraph.get()); itLayer != details::CNNNetworkIterator(); itLayer++) {
+        CNNLayer::Ptr layer = *itLayer;
+        auto itSubgraph = layerSubgraphs.find(layer->name);
+        layer->params = getExecGraphInfo(layer->name, layer->affinity,
+                                         itSubgraph != layerSubgraphs.end() ? itSubgraph->second : 0);
+        layer->blobs.clear();
+    }
+    _execGraph = execGraph;
+
     std::vector<NetworkDesc> descs;
     std::vector<CNNLayerPtr> tempLayers;
     for (auto &&subgraph : subgraphs) {
@@ -695,6 +724,62 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
         std::ofstream ofstream{"hetero_subgraphs_" + _name + ".dot"};
         dumpGraph(*convertedNetwork, subFunctions, ofstream);
     }
+
+    // the executable graph shows the original layers with the devices and subgraphs they are executed in.
+    // The parameters and results inserted between subgraphs are replaced by direct connections.
+    NodeSet subgraphResults;
+    for (auto&& result : results) {
+        subgraphResults.insert(result.get());
+    }
+    NodeMap<ngraph::OutputVector> execOutputs;
+    ngraph::ResultVector execResults;
+    ngraph::ParameterVector execParameters;
+    for (std::size_t subgraphId = 0; subgraphId < subFunctions.size(); ++subgraphId) {
+        for (auto&& node : subFunctions[subgraphId]->get_ordered_ops()) {
+            // constants used by several subgraphs
+            if (contains(execOutputs, node.get())) {
+                continue;
+            }
+            ngraph::OutputVector inputs;
+            for (auto&& input : node->input_values()) {
+                inputs.emplace_back(execOutputs.at(input.get_node())[input.get_index()]);
+            }
+            std::shared_ptr<ngraph::Node> execNode;
+            if (ngraph::op::is_parameter(node)) {
+                if (!contains(graphInputNodes, node.get())) {
+                    execOutputs.emplace(node.get(), execOutputs.at(subgraphParameterToPrevResult.at(node.get())));
+                    continue;
+                }
+                auto parameter = std::make_shared<ngraph::op::Parameter>(node->get_output_element_type(0),
+                                                                         node->get_output_partial_shape(0));
+                execParameters.emplace_back(parameter);
+                execNode = parameter;
+            } else if (ngraph::op::is_output(node)) {
+                if (contains(subgraphResults, node.get())) {
+                    execOutputs.emplace(node.get(), inputs);
+                    continue;
+                }
+                auto result = std::make_shared<ngraph::op::Result>(inputs.front());
+                execResults.emplace_back(result);
+                execNode = result;
+            } else {
+                execNode = std::make_shared<ExecGraphInfoSerialization::ExecutionNode>(inputs, node->get_output_size());
+                for (std::size_t port = 0; port < node->get_output_size(); ++port) {
+                    execNode->set_output_type(port, node->get_output_element_type(port),
+                                              node->get_output_partial_shape(port));
+                }
+            }
+            auto execInfo = getExecGraphInfo(node->get_friendly_name(), networks[subgraphId]._device, subgraphId);
+            execInfo[ExecGraphInfoSerialization::LAYER_TYPE] = node->get_type_name();
+            for (auto&& info : execInfo) {
+                execNode->get_rt_info()[info.first] = std::make_shared<ngraph::VariantWrapper<std::string>>(info.second);
+            }
+            execNode->set_friendly_name(node->get_friendly_name());
+            execOutputs.emplace(node.get(), execNode->outputs());
+        }
+    }
+    CNNNetwork execGraph{std::make_shared<ngraph::Function>(execResults, execParameters, _name)};
+    _execGraph = execGraph;
     for (auto&& network : networks) {
         auto cfg = _config;
         cfg[CONFIG_KEY_INTERNAL(SUBNETWORK_WITH_NETWORK_INPUTS)]
@@ -947,11 +1032,19 @@ void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncReques
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
     auto asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, _taskExecutor, _callbackExecutor);
+    asyncThreadSafeImpl->SetPipelineStatistics(_pipelineStatistics);
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncThreadSafeImpl),
                        [](IInferRequest *p) { p->Release(); });
     asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
 }
 
+void HeteroExecutableNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
+    if (nullptr == _execGraph) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The executable graph is not available for the imported network";
+    }
+    graphPtr = _execGraph;
+}
+
 void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *) const {
     if (name == "TARGET_FALLBACK") {
         auto it = _config.find(name);
@@ -1025,7 +1118,8 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(EXECUTOR_STATISTICS)
         };
 
         {
@@ -1070,11 +1164,29 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         result = IE_SET_METRIC(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // subgraphs are the stages of the asynchronous pipeline, so each of them needs
+        // its own requests in flight to keep the devices busy concurrently
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (METRIC_KEY(EXECUTOR_STATISTICS) == name) {
+        // the stages of the pipeline are the subgraphs, their executors are the ones of the subgraph networks
+        auto counters = GetExecutorStatistics();
+        for (std::size_t i = 0; i < networks.size(); ++i) {
+            auto execNetwork = networks[i]._network;
+            auto supported = execNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+            if (std::find(supported.begin(), supported.end(), METRIC_KEY(EXECUTOR_STATISTICS)) == supported.end()) {
+                continue;
+            }
+            auto subnetworkCounters = execNetwork.GetMetric(METRIC_KEY(EXECUTOR_STATISTICS))
+                                          .as<std::map<std::string, uint64_t>>();
+            for (auto&& counter : subnetworkCounters) {
+                counters["subgraph_" + std::to_string(i) + "_" + counter.first] = counter.second;
+            }
+        }
+        result = IE_SET_METRIC(EXECUTOR_STATISTICS, counters);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
@@ -61,6 +61,8 @@ public:
 
     void ExportImpl(std::ostream& modelFile) override;
 
+    void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
+
 private:
     void InitCNNImpl(const InferenceEngine::ICNNNetwork&    network);
 
@@ -77,6 +79,7 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    InferenceEngine::ICNNNetwork::Ptr   _execGraph;
 };
 
 }  // namespace HeteroPlugin
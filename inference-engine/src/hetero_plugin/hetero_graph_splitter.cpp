@@ -5,7 +5,9 @@
 #include "hetero_graph_splitter.hpp"
 #include "hetero_ade_util.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -164,6 +166,164 @@ ISplitChecker::GraphSelectionResult DefaultSplitChecker::selectSubgraph(
     return ret;
 }
 
+namespace {
+struct PartitionEdge {
+    std::size_t producer;
+    std::size_t consumer;
+    double      cost;
+};
+
+double devicePenalty(const std::vector<std::string>& devices,
+                     const std::string& device,
+                     const PartitionCostModel& model) {
+    auto priority = std::distance(devices.begin(), std::find(devices.begin(), devices.end(), device));
+    return 1.0 + model.devicePriorityPenalty * priority;
+}
+}  // namespace
+
+PartitionPlan partitionByCost(const std::vector<PartitionLayer>& layers,
+                              const std::vector<std::string>& devices,
+                              const PartitionCostModel& model) {
+    PartitionPlan plan;
+    auto& affinities = plan.affinities;
+    affinities.resize(layers.size());
+    for (auto i : ade::util::iota(layers.size())) {
+        for (auto&& device : devices) {
+            if (ade::util::contains(layers[i].devices, device)) {
+                affinities[i] = device;
+                break;
+            }
+        }
+    }
+
+    std::vector<PartitionEdge> edges;
+    std::vector<std::vector<std::size_t>> layerEdges(layers.size());
+    for (auto consumer : ade::util::iota(layers.size())) {
+        for (auto producer : layers[consumer].inputs) {
+            assert(producer < layers.size());
+            layerEdges[producer].push_back(edges.size());
+            layerEdges[consumer].push_back(edges.size());
+            edges.push_back({producer, consumer,
+                             model.transferLatency + model.transferCostPerByte * layers[producer].outputBytes});
+        }
+    }
+
+    auto computeCost = [&](std::size_t layer, const std::string& device) {
+        return device.empty() ? 0.0 : layers[layer].work * devicePenalty(devices, device, model);
+    };
+    // layers without a device do not create subgraph boundaries
+    auto transferCost = [&](const PartitionEdge& edge, const std::string& producerDevice, const std::string& consumerDevice) {
+        return (producerDevice.empty() || consumerDevice.empty() || producerDevice == consumerDevice) ? 0.0 : edge.cost;
+    };
+
+    static const constexpr std::size_t NoIsland = static_cast<std::size_t>(-1);
+    // each move reduces the cost, so the bound is never reached in practice
+    for (auto step : ade::util::iota(layers.size() * devices.size())) {
+        (void)step;
+        // connected islands of layers executed on the same device
+        std::vector<std::size_t> layerIsland(layers.size(), NoIsland);
+        std::vector<std::vector<std::size_t>> islands;
+        for (auto start : ade::util::iota(layers.size())) {
+            if (affinities[start].empty() || layerIsland[start] != NoIsland) {
+                continue;
+            }
+            std::vector<std::size_t> island;
+            std::deque<std::size_t> toVisit{start};
+            layerIsland[start] = islands.size();
+            while (!toVisit.empty()) {
+                auto layer = toVisit.front();
+                toVisit.pop_front();
+                island.push_back(layer);
+                for (auto edgeId : layerEdges[layer]) {
+                    auto& edge = edges[edgeId];
+                    auto other = edge.producer == layer ? edge.consumer : edge.producer;
+                    if (layerIsland[other] == NoIsland && affinities[other] == affinities[layer]) {
+                        layerIsland[other] = islands.size();
+                        toVisit.push_back(other);
+                    }
+                }
+            }
+            islands.emplace_back(std::move(island));
+        }
+
+        // the cheapest islands are tried first, they are the ones which do not pay for their transfers
+        std::vector<std::pair<double, std::size_t>> islandsOrder;
+        for (auto islandId : ade::util::iota(islands.size())) {
+            double work = 0;
+            for (auto layer : islands[islandId]) {
+                work += layers[layer].work;
+            }
+            islandsOrder.emplace_back(work, islandId);
+        }
+        std::sort(islandsOrder.begin(), islandsOrder.end());
+
+        bool moved = false;
+        for (auto&& islandOrder : islandsOrder) {
+            auto islandId = islandOrder.second;
+            auto& island = islands[islandId];
+            const auto current = affinities[island.front()];
+            std::unordered_set<std::string> neighbourDevices;
+            for (auto layer : island) {
+                for (auto edgeId : layerEdges[layer]) {
+                    auto& edge = edges[edgeId];
+                    auto other = edge.producer == layer ? edge.consumer : edge.producer;
+                    if (layerIsland[other] != islandId && !affinities[other].empty()) {
+                        neighbourDevices.insert(affinities[other]);
+                    }
+                }
+            }
+
+            std::string bestDevice;
+            double bestDelta = 0;
+            for (auto&& device : devices) {
+                if (!ade::util::contains(neighbourDevices, device) ||
+                    !std::all_of(island.begin(), island.end(), [&] (std::size_t layer) {
+                        return ade::util::contains(layers[layer].devices, device);
+                    })) {
+                    continue;
+                }
+                double delta = 0;
+                for (auto layer : island) {
+                    delta += computeCost(layer, device) - computeCost(layer, current);
+                    for (auto edgeId : layerEdges[layer]) {
+                        auto& edge = edges[edgeId];
+                        if (edge.producer == layer && layerIsland[edge.consumer] != islandId) {
+                            delta += transferCost(edge, device, affinities[edge.consumer]) -
+                                     transferCost(edge, current, affinities[edge.consumer]);
+                        } else if (edge.consumer == layer && layerIsland[edge.producer] != islandId) {
+                            delta += transferCost(edge, affinities[edge.producer], device) -
+                                     transferCost(edge, affinities[edge.producer], current);
+                        }
+                    }
+                }
+                if (delta < bestDelta) {
+                    bestDelta = delta;
+                    bestDevice = device;
+                }
+            }
+
+            if (!bestDevice.empty()) {
+                for (auto layer : island) {
+                    affinities[layer] = bestDevice;
+                }
+                moved = true;
+                break;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+
+    for (auto layer : ade::util::iota(layers.size())) {
+        plan.cost += computeCost(layer, affinities[layer]);
+    }
+    for (auto&& edge : edges) {
+        plan.cost += transferCost(edge, affinities[edge.producer], affinities[edge.consumer]);
+    }
+    return plan;
+}
+
 namespace {
 struct SubgraphDesc {
     std::size_t topoIndex = static_cast<std::size_t>(-1);
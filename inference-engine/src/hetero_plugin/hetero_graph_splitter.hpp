@@ -7,6 +7,7 @@
 #include <ie_blob.h>
 #include <ie_layers.h>
 
+#include <cstddef>
 #include <string>
 #include <functional>
 #include <unordered_set>
@@ -35,5 +36,50 @@ splitGraph(ICNNNetwork& network,
 void
 sortSubgraphs(std::vector<LayersSet>& subgraphs);
 
+/// Layer of the network as it is seen by the cost based partitioning
+struct PartitionLayer {
+    std::string name;
+    /// Indices of the layers which produce inputs of the layer
+    std::vector<std::size_t> inputs;
+    /// Size of the layer outputs in bytes, they are moved if a consumer is executed on another device
+    std::size_t outputBytes = 0;
+    /// Estimated amount of computations, e.g. multiply-accumulate operations
+    double work = 0;
+    /// Devices which support the layer. The layer has no device if the set is empty
+    std::unordered_set<std::string> devices;
+};
+
+/// Estimates used by the cost based partitioning, the costs are in units of PartitionLayer::work
+struct PartitionCostModel {
+    /// Slowdown of each next device of the priority list, the first device is considered the fastest one
+    double devicePriorityPenalty = 1.0;
+    /// Cost of moving one byte of a tensor between devices
+    double transferCostPerByte = 4.0;
+    /// Fixed cost of a tensor passed between subgraphs: synchronization and start of the next request
+    double transferLatency = 200000.0;
+};
+
+struct PartitionPlan {
+    /// Device of each layer, empty for layers which are not supported by any device
+    std::vector<std::string> affinities;
+    /// Estimated cost of the plan
+    double cost = 0;
+};
+
+/// Assigns layers to devices taking into account the cost of tensors moved between devices
+/// Starting from the assignment by device priority, the connected islands of layers executed on the same
+/// device are moved to a neighbour device while it reduces the estimated cost. So small subgraphs
+/// are merged into the neighbour ones if computations there are cheaper than moving of their tensors.
+///
+/// @param layers - layers of the network
+/// @param devices - devices in priority order
+/// @param model - cost estimates
+///
+/// @return plan with the lowest found cost
+PartitionPlan
+partitionByCost(const std::vector<PartitionLayer>& layers,
+                const std::vector<std::string>& devices,
+                const PartitionCostModel& model = {});
+
 }  // namespace InferenceEngine
 
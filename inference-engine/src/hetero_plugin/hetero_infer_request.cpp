@@ -8,9 +8,13 @@
 #include <description_buffer.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
+#include <ie_remote_context.hpp>
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -26,17 +30,59 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::InferRequest::Ptr r) {
-        std::string intermediateBlobName = blobName;
+    auto getIntermediateBlobName = [&](const std::string& blobName) {
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
-        if (itName != subgraphInputToOutputBlobNames.end()) {
-            intermediateBlobName = itName->second;
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : blobName;
+    };
+
+    auto getContext = [](const InferenceEngine::ExecutableNetwork& network) -> RemoteContext::Ptr {
+        try {
+            return network.GetContext();
+        } catch (const InferenceEngine::details::InferenceEngineException&) {
+            return nullptr;
+        }
+    };
+
+    // the contexts of all subgraphs which produce or consume an intermediate blob
+    std::unordered_map<std::string, std::vector<RemoteContext::Ptr>> blobContexts;
+    for (auto&& desc : _inferRequests) {
+        auto context = getContext(desc._network);
+        for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
+            blobContexts[getIntermediateBlobName(outputInfo.first)].push_back(context);
+        }
+        for (auto&& inputInfo : desc._network.GetInputsInfo()) {
+            blobContexts[getIntermediateBlobName(inputInfo.first)].push_back(context);
+        }
+    }
+
+    // a blob passed between subgraphs which share a remote context is allocated on the device,
+    // so the tensor does not go through the host memory
+    auto getSharedContext = [&](const std::string& blobName, const std::string& intermediateBlobName) -> RemoteContext::Ptr {
+        if (contains(networkInputs, blobName) || contains(networkOutputs, blobName)) {
+            return nullptr;
         }
+        auto& contexts = blobContexts[intermediateBlobName];
+        if (contexts.size() < 2 || nullptr == contexts.front() ||
+            !std::all_of(contexts.begin(), contexts.end(), [&](const RemoteContext::Ptr& context) {
+                return context == contexts.front();
+            })) {
+            return nullptr;
+        }
+        return contexts.front();
+    };
+
+    auto requestBlob([&](const std::string& blobName, InferenceEngine::InferRequest::Ptr r) {
+        std::string intermediateBlobName = getIntermediateBlobName(blobName);
         BlobMap::iterator itBlob;
         bool emplaced = false;
         std::tie(itBlob, emplaced) = _blobs.emplace(intermediateBlobName, Blob::Ptr{});
         if (emplaced) {
             itBlob->second = r->GetBlob(blobName);
+            auto sharedContext = getSharedContext(blobName, intermediateBlobName);
+            if (nullptr != sharedContext) {
+                itBlob->second = sharedContext->CreateBlob(itBlob->second->getTensorDesc());
+                r->SetBlob(blobName, itBlob->second);
+            }
             if (contains(networkInputs, blobName)) {
                 _inputs[blobName] = itBlob->second;
             } else if (contains(networkOutputs, blobName)) {
@@ -11,10 +11,17 @@
 #include <utility>
 #include <fstream>
 #include <unordered_set>
+#include <unordered_map>
+#include <algorithm>
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
 #include "hetero_executable_network.hpp"
+#include "hetero_graph_splitter.hpp"
+#include "ie_algorithm.hpp"
+
+#include <ngraph/function.hpp>
+#include <ngraph/op/util/op_types.hpp>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::PluginConfigParams;
@@ -32,6 +39,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING)] = HETERO_CONFIG_VALUE(PARTITIONING_PRIORITY);
 }
 
 namespace {
@@ -43,6 +51,110 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs & loc
     return config;
 }
 
+double estimateWork(std::size_t outputElements, std::size_t weightsElements, std::size_t outputChannels) {
+    // each output element of convolutions and fully connected layers uses the weights of its channel
+    return static_cast<double>(outputElements) *
+           std::max(1.0, static_cast<double>(weightsElements) / std::max<std::size_t>(outputChannels, 1));
+}
+
+std::unordered_set<std::string> getLayerDevices(const std::string& layerName,
+                                                const std::map<std::string, QueryNetworkResult>& queryResults) {
+    std::unordered_set<std::string> devices;
+    for (auto&& queryResult : queryResults) {
+        if (details::contains(queryResult.second.supportedLayersMap, layerName)) {
+            devices.insert(queryResult.first);
+        }
+    }
+    return devices;
+}
+
+std::vector<PartitionLayer> getPartitionLayers(const ngraph::Function& function,
+                                               const std::map<std::string, QueryNetworkResult>& queryResults) {
+    std::vector<PartitionLayer> layers;
+    std::unordered_map<ngraph::Node*, std::size_t> layerIds;
+    for (auto&& node : function.get_ordered_ops()) {
+        // constants are cloned to each subgraph which uses them
+        if (ngraph::op::is_constant(node)) {
+            continue;
+        }
+        PartitionLayer layer;
+        layer.name = node->get_friendly_name();
+        layer.devices = getLayerDevices(layer.name, queryResults);
+        std::size_t weightsElements = 0;
+        for (auto&& input : node->input_values()) {
+            if (ngraph::op::is_constant(input.get_node())) {
+                weightsElements += ngraph::shape_size(input.get_shape());
+            } else {
+                layer.inputs.push_back(layerIds.at(input.get_node()));
+            }
+        }
+        std::size_t outputElements = 0;
+        for (auto&& output : node->outputs()) {
+            if (output.get_partial_shape().is_static()) {
+                auto elements = ngraph::shape_size(output.get_shape());
+                outputElements += elements;
+                layer.outputBytes += elements * output.get_element_type().size();
+            }
+        }
+        std::size_t outputChannels = 1;
+        if (node->get_output_size() > 0 && node->get_output_partial_shape(0).is_static() &&
+            node->get_output_shape(0).size() > 1) {
+            outputChannels = node->get_output_shape(0)[1];
+        }
+        layer.work = estimateWork(outputElements, weightsElements, outputChannels);
+        layerIds.emplace(node.get(), layers.size());
+        layers.emplace_back(std::move(layer));
+    }
+    return layers;
+}
+
+std::vector<PartitionLayer> getPartitionLayers(const ICNNNetwork& network,
+                                               const std::map<std::string, QueryNetworkResult>& queryResults) {
+    std::vector<CNNLayerPtr> cnnLayers;
+    std::unordered_map<CNNLayer*, std::size_t> layerIds;
+    for (details::CNNNetworkIterator itLayer(const_cast<ICNNNetwork*>(&network));
+         itLayer != details::CNNNetworkIterator(); itLayer++) {
+        layerIds.emplace((*itLayer).get(), cnnLayers.size());
+        cnnLayers.push_back(*itLayer);
+    }
+
+    std::vector<PartitionLayer> layers(cnnLayers.size());
+    for (std::size_t i = 0; i < cnnLayers.size(); ++i) {
+        auto& cnnLayer = cnnLayers[i];
+        auto& layer = layers[i];
+        layer.name = cnnLayer->name;
+        layer.devices = getLayerDevices(layer.name, queryResults);
+        std::size_t weightsElements = 0;
+        for (auto&& blob : cnnLayer->blobs) {
+            weightsElements += blob.second->size();
+        }
+        for (auto&& insData : cnnLayer->insData) {
+            auto data = insData.lock();
+            auto creatorLayer = data ? getCreatorLayer(data).lock() : nullptr;
+            if (nullptr != creatorLayer && details::contains(layerIds, creatorLayer.get())) {
+                layer.inputs.push_back(layerIds[creatorLayer.get()]);
+                if (CaselessEq<std::string>()(creatorLayer->type, "const")) {
+                    auto& dims = data->getTensorDesc().getDims();
+                    weightsElements += details::product(dims.begin(), dims.end());
+                }
+            }
+        }
+        std::size_t outputElements = 0;
+        for (auto&& data : cnnLayer->outData) {
+            auto& dims = data->getTensorDesc().getDims();
+            auto elements = details::product(dims.begin(), dims.end());
+            outputElements += elements;
+            layer.outputBytes += elements * data->getPrecision().size();
+        }
+        std::size_t outputChannels = 1;
+        if (!cnnLayer->outData.empty() && cnnLayer->outData[0]->getTensorDesc().getDims().size() > 1) {
+            outputChannels = cnnLayer->outData[0]->getTensorDesc().getDims()[1];
+        }
+        layer.work = estimateWork(outputElements, weightsElements, outputChannels);
+    }
+    return layers;
+}
+
 }  // namespace
 
 InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork&    network,
@@ -207,6 +319,17 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
     std::string fallbackDevicesStr = it->second;
     DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
 
+    auto itPartitioning = tconfig.find(HETERO_CONFIG_KEY(PARTITIONING));
+    bool costPartitioning = false;
+    if (itPartitioning != tconfig.end()) {
+        if (itPartitioning->second == HETERO_CONFIG_VALUE(PARTITIONING_COST)) {
+            costPartitioning = true;
+        } else if (itPartitioning->second != HETERO_CONFIG_VALUE(PARTITIONING_PRIORITY)) {
+            THROW_IE_EXCEPTION << "Wrong value " << itPartitioning->second << " for property key "
+                               << HETERO_CONFIG_KEY(PARTITIONING);
+        }
+    }
+
     std::map<std::string, QueryNetworkResult> queryResults;
     auto queryNetwork = [&] (const InferenceEngine::ICNNNetwork & networkObject) {
         // go over devices and call query network
@@ -218,6 +341,8 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
         return queryResults;
     };
 
+    // the legacy representation which is queried if some of devices do not support nGraph
+    std::shared_ptr<ICNNNetwork> queriedNetwork;
     if (network.getFunction()) {
         auto allSupportsNgraph =
         std::all_of(std::begin(metaDevices), std::end(metaDevices),
@@ -232,8 +357,8 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
                         return true;
                     });
         if (!allSupportsNgraph) {
-            auto cnnNetworkImpl = std::make_shared<details::CNNNetworkImpl>(network);
-            queryNetwork(*cnnNetworkImpl);
+            queriedNetwork = std::make_shared<details::CNNNetworkImpl>(network);
+            queryNetwork(*queriedNetwork);
         } else {
             queryNetwork(network);
         }
@@ -250,6 +375,18 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
         }
     }
 
+    if (costPartitioning) {
+        auto layers = (nullptr == queriedNetwork && network.getFunction())
+                      ? getPartitionLayers(*network.getFunction(), queryResults)
+                      : getPartitionLayers(queriedNetwork ? *queriedNetwork : network, queryResults);
+        auto plan = InferenceEngine::partitionByCost(layers, fallbackDevices);
+        for (std::size_t i = 0; i < layers.size(); ++i) {
+            if (!plan.affinities[i].empty()) {
+                qr.supportedLayersMap[layers[i].name] = plan.affinities[i];
+            }
+        }
+    }
+
     // set OK status
     qr.rc = StatusCode::OK;
 }
@@ -263,6 +400,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITIONING),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -278,6 +416,10 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PARTITIONING));
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -9,35 +9,39 @@
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "precision_utils.h"
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+#ifdef HAVE_SSE
+// The manually vectorized kernels interleaving and deinterleaving the 3 channel images
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_4d_sse42(const Blob::Ptr& src, const Blob::Ptr& dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
-    auto* src_ptr = src->buffer().as<data_t*>();
-    auto* dst_ptr = dst->buffer().as<data_t*>();
-
     SizeVector dims = src->getTensorDesc().getDims();
-
-    size_t N = dims[0];
-    size_t C = dims[1];
-    size_t H = dims[2];
-    size_t W = dims[3];
+    const size_t N = dims[0];
+    const size_t C = dims[1];
+    const size_t H = dims[2];
+    const size_t W = dims[3];
 
     const Layout src_l = src->getTensorDesc().getLayout();
-    const auto& src_blk_dsc = src->getTensorDesc().getBlockingDesc();
-    const auto& src_strides = src_blk_dsc.getStrides();
+    const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
+    const auto& src_strides = src_blk_desc.getStrides();
     const auto N_src_stride = src_strides[0];
     const auto C_src_stride = src_l == NHWC ? src_strides[3] : src_strides[1];
     const auto H_src_stride = src_l == NHWC ? src_strides[1] : src_strides[2];
     const auto W_src_stride = src_l == NHWC ? src_strides[2] : src_strides[3];
-    src_ptr += src_blk_dsc.getOffsetPadding();
 
     const Layout dst_l = dst->getTensorDesc().getLayout();
     const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
@@ -47,117 +51,49 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    auto* src_ptr = src->buffer().as<data_t*>() + src_blk_desc.getOffsetPadding();
+    auto* dst_ptr = dst->buffer().as<data_t*>() + dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NHWC && dst_l == NCHW && C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
             blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
                                      N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NCHW && dst_l == NHWC && C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
             blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
                                      N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
-#endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
+            return true;
         }
     }
-}
-
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
 
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
-
-    default:
-        THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
-    }
+    return false;
 }
 
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_5d_sse42(const Blob::Ptr& src, const Blob::Ptr& dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
-    const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
-    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
-
-    data_t* src_ptr = src->buffer().as<data_t*>() + src_blk_desc.getOffsetPadding();
-    data_t* dst_ptr = dst->buffer().as<data_t*>() + dst_blk_desc.getOffsetPadding();
-
-    SizeVector dims = src->getTensorDesc().getDims();  // == dst's dims
-
+    SizeVector dims = src->getTensorDesc().getDims();
     const size_t N = dims[0];
     const size_t C = dims[1];
     const size_t D = dims[2];
@@ -165,6 +101,7 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const size_t W = dims[4];
 
     const Layout src_l = src->getTensorDesc().getLayout();
+    const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
     const auto& src_strides = src_blk_desc.getStrides();
     const auto N_src_stride = src_strides[0];
     const auto C_src_stride = src_l == NDHWC ? src_strides[4] : src_strides[1];
@@ -173,6 +110,7 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto W_src_stride = src_l == NDHWC ? src_strides[3] : src_strides[4];
 
     const Layout dst_l = dst->getTensorDesc().getLayout();
+    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
     const auto& dst_strides = dst_blk_desc.getStrides();
     const auto N_dst_stride = dst_strides[0];
     const auto C_dst_stride = dst_l == NDHWC ? dst_strides[4] : dst_strides[1];
@@ -180,15 +118,16 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+    auto* src_ptr = src->buffer().as<data_t*>() + src_blk_desc.getOffsetPadding();
+    auto* dst_ptr = dst->buffer().as<data_t*>() + dst_blk_desc.getOffsetPadding();
+
+    if (src_l == NDHWC && dst_l == NCDHW && C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -196,18 +135,17 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
                                      C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NCDHW && dst_l == NDHWC && C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -215,93 +153,275 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
                                      H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
+
+    return false;
+}
+
+static bool blob_copy_sse42(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (!with_cpu_x86_sse42())
+        return false;
+
+    const auto precision = src->getTensorDesc().getPrecision();
+    if (precision != dst->getTensorDesc().getPrecision())
+        return false;
+
+    const auto rank = src->getTensorDesc().getDims().size();
+    if (precision == Precision::U8 || precision == Precision::I8) {
+        return rank == 4 ? blob_copy_4d_sse42<Precision::U8>(src, dst)
+                         : rank == 5 && blob_copy_5d_sse42<Precision::U8>(src, dst);
+    }
+    if (precision == Precision::FP32 || precision == Precision::I32 || precision == Precision::U32) {
+        return rank == 4 ? blob_copy_4d_sse42<Precision::FP32>(src, dst)
+                         : rank == 5 && blob_copy_5d_sse42<Precision::FP32>(src, dst);
+    }
+    return false;
+}
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
+
+//----------------------------------------------------------------------
+//
+// The generic copy: both blobs are walked in the order of the destination dimensions, the dimensions dense in both
+// blobs are merged first. When the innermost destination dimension is strided in the source the rows are transposed
+// by square tiles, so the source cache lines of a tile are reused.
+//
+//----------------------------------------------------------------------
+
+namespace {
+
+struct CopyPlan {
+    SizeVector dims;                 // from the outermost to the innermost dimension of the destination
+    std::vector<size_t> srcStrides;  // in elements
+    std::vector<size_t> dstStrides;  // in elements
+};
+
+// The blobs of the ANY layout have no blocking, their data is dense in the order of the dimensions
+BlockingDesc blockingOf(const TensorDesc& desc) {
+    if (desc.getBlockingDesc().getBlockDims().empty() && !desc.getDims().empty()) {
+        SizeVector order(desc.getDims().size());
+        for (size_t i = 0; i < order.size(); i++)
+            order[i] = i;
+        return BlockingDesc(desc.getDims(), order);
+    }
+    return desc.getBlockingDesc();
+}
+
+CopyPlan makeCopyPlan(const TensorDesc& srcDesc, const TensorDesc& dstDesc) {
+    const auto srcBlk = blockingOf(srcDesc);
+    const auto dstBlk = blockingOf(dstDesc);
+    const auto& dims = srcDesc.getDims();
+
+    CopyPlan plan;
+    if (srcBlk.getBlockDims() == dstBlk.getBlockDims() && srcBlk.getOrder() == dstBlk.getOrder()) {
+        // The same blocking (e.g. the blocked layouts): only the strides may differ
+        plan.dims = dstBlk.getBlockDims();
+        plan.srcStrides = srcBlk.getStrides();
+        plan.dstStrides = dstBlk.getStrides();
+    } else if (srcBlk.getBlockDims().size() == dims.size() && dstBlk.getBlockDims().size() == dims.size()) {
+        // Permutations of the dimensions: the strides are taken in the logical order of the dimensions
+        std::vector<size_t> srcStrides(dims.size()), dstStrides(dims.size());
+        for (size_t i = 0; i < dims.size(); i++) {
+            srcStrides[srcBlk.getOrder()[i]] = srcBlk.getStrides()[i];
+            dstStrides[dstBlk.getOrder()[i]] = dstBlk.getStrides()[i];
         }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
+        for (auto d : dstBlk.getOrder()) {
+            plan.dims.push_back(dims[d]);
+            plan.srcStrides.push_back(srcStrides[d]);
+            plan.dstStrides.push_back(dstStrides[d]);
         }
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from layout " << srcDesc.getLayout() << " to "
+                           << dstDesc.getLayout();
+    }
+
+    CopyPlan merged;
+    for (size_t i = 0; i < plan.dims.size(); i++) {
+        if (plan.dims[i] == 1)
+            continue;
+        if (!merged.dims.empty() && merged.srcStrides.back() == plan.srcStrides[i] * plan.dims[i] &&
+            merged.dstStrides.back() == plan.dstStrides[i] * plan.dims[i]) {
+            merged.dims.back() *= plan.dims[i];
+            merged.srcStrides.back() = plan.srcStrides[i];
+            merged.dstStrides.back() = plan.dstStrides[i];
+            continue;
         }
+        merged.dims.push_back(plan.dims[i]);
+        merged.srcStrides.push_back(plan.srcStrides[i]);
+        merged.dstStrides.push_back(plan.dstStrides[i]);
+    }
+    if (merged.dims.empty()) {
+        merged.dims.push_back(1);
+        merged.srcStrides.push_back(1);
+        merged.dstStrides.push_back(1);
     }
+    return merged;
 }
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
+template <typename src_t, typename dst_t>
+struct CastConvert {
+    dst_t operator()(src_t value) const {
+        return static_cast<dst_t>(value);
+    }
+};
+
+struct F16ToF32Convert {
+    float operator()(ie_fp16 value) const {
+        return PrecisionUtils::f16tof32(value);
+    }
+};
+
+template <typename src_t, typename dst_t, typename Convert>
+void blob_copy_nd(const src_t* src, dst_t* dst, const CopyPlan& plan, Convert convert) {
+    const size_t tile = 16;
+    const size_t rank = plan.dims.size();
+    const size_t inner = rank - 1;
+
+    // The dimension in which the source is dense, rows of the destination gather it when it is not the inner one
+    size_t srcInner = inner;
+    for (size_t d = 0; d < rank; d++) {
+        if (plan.srcStrides[d] < plan.srcStrides[srcInner])
+            srcInner = d;
+    }
+    const bool transpose = srcInner != inner && plan.srcStrides[inner] != 1 && plan.dims[srcInner] > 1;
+
+    // The work items enumerate the outer dimensions, the tiled dimensions are enumerated by tiles
+    std::vector<size_t> extents(rank), steps(rank, 1);
+    size_t items = 1;
+    for (size_t d = 0; d < rank; d++) {
+        if (d == inner || (transpose && d == srcInner))
+            steps[d] = transpose ? tile : plan.dims[d];
+        extents[d] = (plan.dims[d] + steps[d] - 1) / steps[d];
+        items *= extents[d];
+    }
+
+    const size_t srcStep = plan.srcStrides[inner];
+    const size_t dstStep = plan.dstStrides[inner];
+    const size_t rowsStrideSrc = plan.srcStrides[srcInner];
+    const size_t rowsStrideDst = plan.dstStrides[srcInner];
+
+    auto copyItem = [&](size_t item) {
+        size_t srcOffset = 0, dstOffset = 0;
+        size_t innerBegin = 0, rowsBegin = 0;
+        for (size_t d = rank; d-- > 0;) {
+            const size_t begin = (item % extents[d]) * steps[d];
+            item /= extents[d];
+            srcOffset += begin * plan.srcStrides[d];
+            dstOffset += begin * plan.dstStrides[d];
+            if (d == inner)
+                innerBegin = begin;
+            else if (d == srcInner)
+                rowsBegin = begin;
+        }
+
+        const size_t len = std::min(steps[inner], plan.dims[inner] - innerBegin);
+        const size_t rows = transpose ? std::min(tile, plan.dims[srcInner] - rowsBegin) : 1;
+        for (size_t r = 0; r < rows; r++) {
+            const src_t* s = src + srcOffset + r * rowsStrideSrc;
+            dst_t* d = dst + dstOffset + r * rowsStrideDst;
+            if (std::is_same<src_t, dst_t>::value && std::is_same<Convert, CastConvert<src_t, dst_t>>::value &&
+                srcStep == 1 && dstStep == 1) {
+                std::memcpy(d, s, len * sizeof(src_t));
+            } else if (srcStep == 1 && dstStep == 1) {
+                for (size_t i = 0; i < len; i++)
+                    d[i] = convert(s[i]);
+            } else {
+                for (size_t i = 0; i < len; i++)
+                    d[i * dstStep] = convert(s[i * srcStep]);
+            }
+        }
+    };
+
+    // Small blobs are not worth waking up the threads
+    size_t total = 1;
+    for (auto dim : plan.dims)
+        total *= dim;
+    if (items > 1 && total * (sizeof(src_t) + sizeof(dst_t)) >= (1 << 17)) {
+        parallel_for(items, copyItem);
+    } else {
+        for (size_t item = 0; item < items; item++)
+            copyItem(item);
+    }
+}
+
+template <typename src_t, typename dst_t, typename Convert = CastConvert<src_t, dst_t>>
+void blob_copy_nd(const Blob::Ptr& src, const Blob::Ptr& dst, Convert convert = Convert()) {
+    const auto& srcDesc = src->getTensorDesc();
+    const auto& dstDesc = dst->getTensorDesc();
+    const auto* src_ptr = src->cbuffer().as<const src_t*>() + srcDesc.getBlockingDesc().getOffsetPadding();
+    auto* dst_ptr = dst->buffer().as<dst_t*>() + dstDesc.getBlockingDesc().getOffsetPadding();
+    blob_copy_nd(src_ptr, dst_ptr, makeCopyPlan(srcDesc, dstDesc), convert);
+}
+
+template <typename dst_t>
+void blob_convert_nd(const Blob::Ptr& src, const Blob::Ptr& dst) {
     switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_5d_t<Precision::FP32>(src, dst);
+    case Precision::U8:
+        blob_copy_nd<uint8_t, dst_t>(src, dst);
+        break;
+    case Precision::I8:
+        blob_copy_nd<int8_t, dst_t>(src, dst);
         break;
-
-    case Precision::FP16:
     case Precision::U16:
+        blob_copy_nd<uint16_t, dst_t>(src, dst);
+        break;
     case Precision::I16:
-        blob_copy_5d_t<Precision::U16>(src, dst);
+        blob_copy_nd<int16_t, dst_t>(src, dst);
         break;
-
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_5d_t<Precision::U8>(src, dst);
+    case Precision::I32:
+        blob_copy_nd<int32_t, dst_t>(src, dst);
         break;
-
     default:
-        THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
+                           << " to " << dst->getTensorDesc().getPrecision();
     }
 }
 
+}  // namespace
+
 void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->buffer() == nullptr) THROW_IE_EXCEPTION << "Cannot copy blob data. Source is not allocated.";
 
     if (dst->buffer() == nullptr) THROW_IE_EXCEPTION << "Cannot copy blob data. Destination is not allocated.";
 
-    if (src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << src->getTensorDesc().getPrecision()
-                           << " to " << src->getTensorDesc().getPrecision();
-
     if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
         THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
 
-    if (src->getTensorDesc().getDims().size() == 4)
-        blob_copy_4d(src, dst);
-    else if (src->getTensorDesc().getDims().size() == 5)
-        blob_copy_5d(src, dst);
-    else
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation. Only 4d or 5d supported.";
+    const auto srcPrecision = src->getTensorDesc().getPrecision();
+    const auto dstPrecision = dst->getTensorDesc().getPrecision();
+
+#ifdef HAVE_SSE
+    if (blob_copy_sse42(src, dst))
+        return;
+#endif  // HAVE_SSE
+
+    if (srcPrecision == dstPrecision) {
+        // The bits are copied as they are, so only the size of the elements matters
+        switch (srcPrecision.size()) {
+        case 1:
+            blob_copy_nd<uint8_t, uint8_t>(src, dst);
+            break;
+        case 2:
+            blob_copy_nd<uint16_t, uint16_t>(src, dst);
+            break;
+        case 4:
+            blob_copy_nd<uint32_t, uint32_t>(src, dst);
+            break;
+        case 8:
+            blob_copy_nd<uint64_t, uint64_t>(src, dst);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << srcPrecision;
+        }
+    } else if (srcPrecision == Precision::FP16 && dstPrecision == Precision::FP32) {
+        blob_copy_nd<ie_fp16, float>(src, dst, F16ToF32Convert());
+    } else if (dstPrecision == Precision::FP32) {
+        blob_convert_nd<float>(src, dst);
+    } else {
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation from precision " << srcPrecision << " to "
+                           << dstPrecision;
+    }
 }
 
 }  // namespace InferenceEngine
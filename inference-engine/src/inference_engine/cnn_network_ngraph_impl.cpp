@@ -9,6 +9,7 @@
 #include <math.h>
 
 #include <cassert>
+#include <fstream>
 #include <details/caseless.hpp>
 #include <map>
 #include <memory>
@@ -28,6 +29,7 @@
 #include "ie_util_internal.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_profiling.hpp"
+#include "ie_bin_ir_serializer.hpp"
 #include "network_serializer.h"
 #include "generic_ie.hpp"
 #include <shape_infer/built-in/ie_built_in_holder.hpp>
@@ -40,7 +42,8 @@ using ngraph::Function;
 
 static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<const ngraph::Function>& func,
                                                       bool constFolding,
-                                                      const std::map<std::string, std::vector<size_t>>& inputShapes) {
+                                                      const std::map<std::string, std::vector<size_t>>& inputShapes,
+                                                      const ngraph::pass::ShapeProgram* shapeProgram = nullptr) {
     ::ngraph::op::GenericIE::DisableReshape noReshape(func);
     auto original_parameters = func->get_parameters();
 
@@ -60,7 +63,8 @@ static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<cons
 
     // TODO: remove const cast if specialize function works with constant ngraph function
     auto specialized_function = ::ngraph::specialize_function(std::const_pointer_cast<ngraph::Function>(func), new_types, new_shapes,
-                                                              std::vector<void*>(new_shapes.size(), nullptr), constFolding, true);
+                                                              std::vector<void*>(new_shapes.size(), nullptr), constFolding, true,
+                                                              shapeProgram);
     // TODO: remove this code after the fix on the nGraph side
     ::ngraph::pass::GetOutputElementElimination goe_elimination;
     for (auto n : specialized_function->get_ops()) {
@@ -269,7 +273,7 @@ size_t CNNNetworkNGraphImpl::getBatchSize() const noexcept {
 }
 
 std::shared_ptr<ngraph::Function> CNNNetworkNGraphImpl::cloneFunction(bool constFolding, const std::map<std::string, std::vector<size_t>>& inputShapes) const {
-    return copyFunction(_ngraph_function, constFolding, inputShapes);
+    return copyFunction(_ngraph_function, constFolding, inputShapes, constFolding ? _shapeProgram.get() : nullptr);
 }
 
 void CNNNetworkNGraphImpl::reshape() {
@@ -291,16 +295,30 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
     try {
         auto params = _ngraph_function->get_parameters();
 
+        ::ngraph::ParameterVector changedParams;
         for (size_t i = 0; i < params.size(); i++) {
             const auto& param = params[i];
             if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
                 continue;
             ::ngraph::PartialShape shape(inputShapes.at(param->get_friendly_name()));
+            if (param->get_partial_shape().same_scheme(shape))
+                continue;
             auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
             newParam->set_friendly_name(param->get_friendly_name());
             _ngraph_function->replace_parameter(i, newParam);
+            changedParams.push_back(newParam);
+        }
+
+        if (!_shapeProgram) {
+            _ngraph_function->validate_nodes_and_infer_types();
+            IE_PROFILING_AUTO_SCOPE(BuildShapeProgram);
+            _shapeProgram = std::make_shared<::ngraph::pass::ShapeProgram>(*_ngraph_function);
+        } else {
+            // the function was validated by the previous reshape, only the nodes which depend on
+            // the new input shapes are revalidated
+            IE_PROFILING_AUTO_SCOPE(IncrementalValidation);
+            _ngraph_function->validate_nodes_and_infer_types(changedParams);
         }
-        _ngraph_function->validate_nodes_and_infer_types();
 
         {
             auto specialized_ngraph_function = cloneFunction(true, inputShapes);
@@ -380,6 +398,25 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
 
 StatusCode CNNNetworkNGraphImpl::serialize(const std::string& xmlPath, const std::string& binPath,
                                            ResponseDesc* resp) const noexcept {
+    if (details::IsBinaryIRPath(xmlPath)) {
+        if (cnnNetwork) {
+            return DescriptionBuffer(NOT_IMPLEMENTED, resp) << "Only a network in nGraph representation can be written "
+                                                            << "to the binary IR";
+        }
+        try {
+            std::ofstream stream(xmlPath, std::ios::binary);
+            if (!stream.is_open()) {
+                THROW_IE_EXCEPTION << "File " << xmlPath << " cannot be opened!";
+            }
+            details::SerializeBinaryIR(*_ngraph_function, stream);
+            return OK;
+        } catch (const InferenceEngineException& e) {
+            return DescriptionBuffer(GENERAL_ERROR, resp) << e.what();
+        } catch (const std::exception& e) {
+            return DescriptionBuffer(UNEXPECTED, resp) << e.what();
+        }
+    }
+
     auto network = cnnNetwork;
     if (!network) {
         // TODO: once Serialization::Serialize supports true IR v10
@@ -17,6 +17,7 @@
 #include <ngraph/attribute_visitor.hpp>
 #include <ngraph/function.hpp>
 #include <ngraph/node.hpp>
+#include <ngraph/pass/shape_relevance.hpp>
 #include <string>
 #include <vector>
 
@@ -97,6 +98,8 @@ private:
     InferenceEngine::InputsDataMap _inputData;
     std::map<std::string, DataPtr> _outputData;
     std::shared_ptr<CNNNetworkImpl> cnnNetwork;
+    // the shape subgraphs of the function compiled on the first reshape, the next reshapes only run their arithmetic
+    std::shared_ptr<::ngraph::pass::ShapeProgram> _shapeProgram;
 
     /**
      * @brief Create DataPtr for nGraph operation
@@ -0,0 +1,181 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <ie_data_hash.hpp>
+#include <ie_version.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Chains the hashes of the consecutive values. The result must be stable between processes,
+ * so std::hash is not used here.
+ */
+class StableHasher {
+    uint64_t _hash = 0;
+
+public:
+    void update(const void* data, size_t size) {
+        _hash = computeDataHash(data, size, _hash);
+    }
+
+    void update(const std::string& value) {
+        update(value.size());
+        update(value.data(), value.size());
+    }
+
+    template <typename T>
+    void update(const T& value) {
+        static_assert(std::is_arithmetic<T>::value, "Only arithmetic types are hashed by value");
+        update(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void update(const std::vector<T>& values) {
+        update(values.size());
+        for (auto&& value : values) {
+            update(value);
+        }
+    }
+
+    uint64_t value() const {
+        return _hash;
+    }
+};
+
+/**
+ * @brief Feeds every node attribute (including Constant data) into the hasher
+ */
+class HashingAttributeVisitor : public ngraph::AttributeVisitor {
+    StableHasher& _hasher;
+
+    template <typename T>
+    void hashValue(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        _hasher.update(name);
+        _hasher.update(adapter.get());
+    }
+
+public:
+    explicit HashingAttributeVisitor(StableHasher& hasher) : _hasher(hasher) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        // the value is not accessible, take the attribute type into account at least
+        _hasher.update(name);
+        _hasher.update(std::string(adapter.get_type_info().name));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hasher.update(name);
+        _hasher.update(adapter.size());
+        _hasher.update(adapter.get_ptr(), adapter.size());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { hashValue(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override { hashValue(name, adapter); }
+};
+
+}  // namespace
+
+bool NetworkCompilationContext::isCacheable(const CNNNetwork& network) {
+    return network.getFunction() != nullptr;
+}
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::string& deviceName,
+                                                   const std::map<std::string, std::string>& config) {
+    if (!isCacheable(network)) {
+        THROW_IE_EXCEPTION << "Cannot compute hash for the network " << network.getName()
+                           << " which is not represented by nGraph function";
+    }
+
+    StableHasher hasher;
+    HashingAttributeVisitor visitor(hasher);
+
+    // compiled blobs are not compatible between different Inference Engine builds
+    hasher.update(std::string(GetInferenceEngineVersion()->buildNumber));
+    hasher.update(deviceName);
+    for (auto&& item : config) {
+        hasher.update(item.first);
+        hasher.update(item.second);
+    }
+
+    // topology, attributes and weights
+    auto function = network.getFunction();
+    for (auto&& constNode : function->get_ordered_ops()) {
+        auto node = std::const_pointer_cast<ngraph::Node>(constNode);
+        hasher.update(std::string(node->get_type_info().name));
+        hasher.update(node->get_type_info().version);
+        hasher.update(node->get_friendly_name());
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            hasher.update(source.get_node()->get_friendly_name());
+            hasher.update(source.get_index());
+        }
+        for (auto&& output : node->outputs()) {
+            hasher.update(output.get_element_type().get_type_name());
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            hasher.update(shape.str());
+        }
+        node->visit_attributes(visitor);
+    }
+
+    // user-defined precisions and layouts of inputs and outputs
+    for (auto&& input : network.getInputsInfo()) {
+        hasher.update(input.first);
+        hasher.update(std::string(input.second->getPrecision().name()));
+        hasher.update(static_cast<int>(input.second->getLayout()));
+        hasher.update(input.second->getTensorDesc().getDims());
+        const auto& preProcess = input.second->getPreProcess();
+        hasher.update(static_cast<int>(preProcess.getResizeAlgorithm()));
+        hasher.update(static_cast<int>(preProcess.getColorFormat()));
+        hasher.update(static_cast<int>(preProcess.getMeanVariant()));
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        hasher.update(output.first);
+        hasher.update(std::string(output.second->getPrecision().name()));
+        hasher.update(static_cast<int>(output.second->getLayout()));
+    }
+
+    std::stringstream result;
+    result << std::hex << std::setw(16) << std::setfill('0') << hasher.value();
+    return result.str();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,44 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Helpers to identify a compiled network in the Core-level network cache
+ * @file compilation_context.hpp
+ */
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_api.h>
+
+#include <map>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes keys for the persistent compiled network cache (see KEY_CACHE_DIR)
+ */
+struct INFERENCE_ENGINE_API_CLASS(NetworkCompilationContext) {
+    /**
+     * @brief Checks whether a stable hash can be computed for the network
+     * @param network A network to check
+     * @return `true` if the network is represented by an nGraph function
+     */
+    static bool isCacheable(const CNNNetwork& network);
+
+    /**
+     * @brief Computes a hash of the network topology, attributes, weights, inputs / outputs info,
+     * target device and compile configuration
+     * @param network A network to compute hash for. Must satisfy isCacheable()
+     * @param deviceName A target device name
+     * @param config A compile configuration passed to LoadNetwork
+     * @return A hex string which can be used as a cache file name
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::string& deviceName,
+                                   const std::map<std::string, std::string>& config);
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,309 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_weights.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+constexpr char magic[8] = {'I', 'E', 'W', 'G', 'T', 'Z', '0', '1'};
+
+struct Header {
+    char magic[8];
+    uint64_t rawSize;
+    uint64_t chunkSize;
+    uint64_t chunksCount;
+};
+
+enum Codec : uint8_t {
+    Stored = 0,
+    LZ = 1
+};
+
+struct ChunkEntry {
+    uint64_t offset;  // from the beginning of the file
+    uint32_t size;
+    uint8_t codec;
+    uint8_t elementSize;  // the bytes are shuffled by it, 1 keeps them as they are
+    uint16_t reserved;
+};
+
+// The LZ codec uses the LZ4 block layout: a token with the literals and match lengths, the literals,
+// a 16-bit offset and the extensions of the lengths in bytes of 255
+constexpr size_t minMatch = 4;
+constexpr size_t lastLiterals = 5;
+constexpr size_t matchFindLimit = 12;
+constexpr size_t maxOffset = 65535;
+constexpr int hashLog = 14;
+
+inline uint32_t read32(const uint8_t* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t hash32(uint32_t value) {
+    return (value * 2654435761U) >> (32 - hashLog);
+}
+
+void writeLength(std::vector<uint8_t>& out, size_t length) {
+    for (; length >= 255; length -= 255)
+        out.push_back(255);
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void writeSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalsLength,
+                   size_t offset, size_t matchLength) {
+    const size_t matchCode = matchLength - minMatch;
+    out.push_back(static_cast<uint8_t>((std::min<size_t>(literalsLength, 15) << 4) | std::min<size_t>(matchCode, 15)));
+    if (literalsLength >= 15)
+        writeLength(out, literalsLength - 15);
+    out.insert(out.end(), literals, literals + literalsLength);
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15)
+        writeLength(out, matchCode - 15);
+}
+
+void writeLastLiterals(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalsLength) {
+    out.push_back(static_cast<uint8_t>(std::min<size_t>(literalsLength, 15) << 4));
+    if (literalsLength >= 15)
+        writeLength(out, literalsLength - 15);
+    out.insert(out.end(), literals, literals + literalsLength);
+}
+
+std::vector<uint8_t> lzCompress(const uint8_t* src, size_t size) {
+    std::vector<uint8_t> out;
+    out.reserve(size + size / 255 + 16);
+    size_t anchor = 0;
+    if (size > matchFindLimit) {
+        // positions are stored plus one, so zero means an empty slot
+        std::vector<uint32_t> table(size_t(1) << hashLog, 0);
+        const size_t matchLimit = size - lastLiterals;
+        size_t pos = 0;
+        size_t misses = 0;
+        while (pos < size - matchFindLimit) {
+            const uint32_t sequence = read32(src + pos);
+            auto& slot = table[hash32(sequence)];
+            const size_t candidate = slot;
+            slot = static_cast<uint32_t>(pos + 1);
+            if (candidate == 0 || pos + 1 - candidate > maxOffset || read32(src + candidate - 1) != sequence) {
+                // the incompressible data is skipped faster and faster
+                pos += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+            const size_t match = candidate - 1;
+            size_t length = minMatch;
+            while (pos + length < matchLimit && src[match + length] == src[pos + length])
+                length++;
+            writeSequence(out, src + anchor, pos - anchor, pos - match, length);
+            pos += length;
+            anchor = pos;
+        }
+    }
+    writeLastLiterals(out, src + anchor, size - anchor);
+    return out;
+}
+
+bool readLength(const uint8_t* src, size_t size, size_t& pos, size_t& length) {
+    uint8_t value = 0;
+    do {
+        if (pos >= size)
+            return false;
+        value = src[pos++];
+        length += value;
+    } while (value == 255);
+    return true;
+}
+
+bool lzDecompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    size_t in = 0, out = 0;
+    while (in < srcSize) {
+        const uint8_t token = src[in++];
+        size_t literalsLength = token >> 4;
+        if (literalsLength == 15 && !readLength(src, srcSize, in, literalsLength))
+            return false;
+        if (literalsLength > srcSize - in || literalsLength > dstSize - out)
+            return false;
+        std::memcpy(dst + out, src + in, literalsLength);
+        in += literalsLength;
+        out += literalsLength;
+        // the last sequence has literals only
+        if (in == srcSize)
+            break;
+
+        if (srcSize - in < 2)
+            return false;
+        const size_t offset = src[in] | (static_cast<size_t>(src[in + 1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > out)
+            return false;
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(src, srcSize, in, matchLength))
+            return false;
+        matchLength += minMatch;
+        if (matchLength > dstSize - out)
+            return false;
+        const uint8_t* match = dst + out - offset;
+        if (offset >= matchLength) {
+            std::memcpy(dst + out, match, matchLength);
+        } else {
+            // the match overlaps the output, e.g. a run of the same bytes
+            for (size_t i = 0; i < matchLength; i++)
+                dst[out + i] = match[i];
+        }
+        out += matchLength;
+    }
+    return out == dstSize;
+}
+
+// element i byte j goes to position j * count + i, the tail shorter than an element stays in place
+void shuffle(const uint8_t* src, uint8_t* dst, size_t size, size_t elementSize) {
+    const size_t count = size / elementSize;
+    for (size_t i = 0; i < count; i++)
+        for (size_t j = 0; j < elementSize; j++)
+            dst[j * count + i] = src[i * elementSize + j];
+    std::memcpy(dst + count * elementSize, src + count * elementSize, size - count * elementSize);
+}
+
+void unshuffle(const uint8_t* src, uint8_t* dst, size_t size, size_t elementSize) {
+    const size_t count = size / elementSize;
+    for (size_t j = 0; j < elementSize; j++)
+        for (size_t i = 0; i < count; i++)
+            dst[i * elementSize + j] = src[j * count + i];
+    std::memcpy(dst + count * elementSize, src + count * elementSize, size - count * elementSize);
+}
+
+size_t chunkRawSize(const Header& header, size_t chunk) {
+    return static_cast<size_t>(std::min<uint64_t>(header.chunkSize, header.rawSize - chunk * header.chunkSize));
+}
+
+}  // namespace
+
+bool isCompressedWeights(const void* data, size_t size) noexcept {
+    return data != nullptr && size >= sizeof(Header) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+Blob::Ptr decompressWeights(const void* data, size_t size) {
+    if (!isCompressedWeights(data, size))
+        THROW_IE_EXCEPTION << "The weights are not compressed";
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    Header header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.chunkSize == 0 || header.chunkSize > UINT32_MAX ||
+        header.chunksCount != (header.rawSize + header.chunkSize - 1) / header.chunkSize ||
+        header.chunksCount > (size - sizeof(Header)) / sizeof(ChunkEntry))
+        THROW_IE_EXCEPTION << "The header of the compressed weights is corrupted";
+
+    std::vector<ChunkEntry> entries(static_cast<size_t>(header.chunksCount));
+    if (!entries.empty())
+        std::memcpy(entries.data(), bytes + sizeof(Header), entries.size() * sizeof(ChunkEntry));
+
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {static_cast<size_t>(header.rawSize)}, Layout::C));
+    blob->allocate();
+    auto* raw = blob->buffer().as<uint8_t*>();
+
+    std::atomic<bool> corrupted{false};
+    parallel_for(entries.size(), [&](size_t chunk) {
+        const auto& entry = entries[chunk];
+        const size_t rawSize = chunkRawSize(header, chunk);
+        auto* dst = raw + chunk * header.chunkSize;
+        if (entry.offset > size || entry.size > size - entry.offset || entry.elementSize == 0) {
+            corrupted = true;
+            return;
+        }
+        const auto* src = bytes + entry.offset;
+        if (entry.codec == Stored) {
+            if (entry.size != rawSize) {
+                corrupted = true;
+                return;
+            }
+            std::memcpy(dst, src, rawSize);
+        } else if (entry.codec == LZ) {
+            if (entry.elementSize == 1) {
+                if (!lzDecompress(src, entry.size, dst, rawSize))
+                    corrupted = true;
+            } else {
+                std::vector<uint8_t> shuffled(rawSize);
+                if (!lzDecompress(src, entry.size, shuffled.data(), rawSize)) {
+                    corrupted = true;
+                    return;
+                }
+                unshuffle(shuffled.data(), dst, rawSize, entry.elementSize);
+            }
+        } else {
+            corrupted = true;
+        }
+    });
+    if (corrupted)
+        THROW_IE_EXCEPTION << "The compressed weights are corrupted";
+    return blob;
+}
+
+void compressWeights(const void* data, size_t size, std::ostream& stream, size_t chunkSize) {
+    if (chunkSize == 0 || chunkSize > UINT32_MAX)
+        THROW_IE_EXCEPTION << "Wrong size of the compressed weights chunks: " << chunkSize;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+
+    Header header;
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.rawSize = size;
+    header.chunkSize = chunkSize;
+    header.chunksCount = (size + chunkSize - 1) / chunkSize;
+
+    std::vector<ChunkEntry> entries(static_cast<size_t>(header.chunksCount));
+    std::vector<std::vector<uint8_t>> chunks(entries.size());
+    parallel_for(entries.size(), [&](size_t chunk) {
+        const size_t rawSize = chunkRawSize(header, chunk);
+        const auto* src = bytes + chunk * chunkSize;
+        auto& entry = entries[chunk];
+        entry = {0, static_cast<uint32_t>(rawSize), Stored, 1, 0};
+
+        std::vector<uint8_t> shuffled(rawSize);
+        for (size_t elementSize : {1, 2, 4}) {
+            const uint8_t* input = src;
+            if (elementSize > 1) {
+                shuffle(src, shuffled.data(), rawSize, elementSize);
+                input = shuffled.data();
+            }
+            auto compressed = lzCompress(input, rawSize);
+            if (compressed.size() < entry.size) {
+                entry.size = static_cast<uint32_t>(compressed.size());
+                entry.codec = LZ;
+                entry.elementSize = static_cast<uint8_t>(elementSize);
+                chunks[chunk] = std::move(compressed);
+            }
+        }
+        if (entry.codec == Stored)
+            chunks[chunk].assign(src, src + rawSize);
+    });
+
+    uint64_t offset = sizeof(Header) + entries.size() * sizeof(ChunkEntry);
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset += entry.size;
+    }
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!entries.empty())
+        stream.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ChunkEntry));
+    for (const auto& chunk : chunks)
+        stream.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+    if (!stream.good())
+        THROW_IE_EXCEPTION << "Cannot write the compressed weights";
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,265 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_bin_ir_serializer.hpp"
+
+#include <details/ie_exception.hpp>
+#include <ie_bin_ir_format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/op/tensor_iterator.hpp>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void Pad(std::vector<char>& bytes, uint64_t alignment) {
+    bytes.resize(AlignUp(bytes.size(), alignment), '\0');
+}
+
+template <typename T>
+uint32_t Count(const std::vector<T>& records) {
+    return static_cast<uint32_t>(records.size());
+}
+
+template <typename T>
+BinaryIR::Section Bytes(const std::vector<T>& records) {
+    return {0, records.size() * sizeof(T)};
+}
+
+// Collects the sections of the file, the weights are referred and written directly from the nodes
+struct Writer {
+    uint32_t String(const std::string& value) {
+        auto it = _stringIds.find(value);
+        if (it != _stringIds.end()) {
+            return it->second;
+        }
+        auto id = Count(_strings);
+        _strings.insert(_strings.end(), value.begin(), value.end());
+        _strings.push_back('\0');
+        _stringIds.emplace(value, id);
+        return id;
+    }
+
+    template <typename T>
+    uint64_t Data(const T* values, size_t count) {
+        Pad(_data, BinaryIR::DataAlignment);
+        auto offset = _data.size();
+        auto bytes = reinterpret_cast<const char*>(values);
+        _data.insert(_data.end(), bytes, bytes + count * sizeof(T));
+        return offset;
+    }
+
+    uint64_t Weights(const void* data, size_t size) {
+        auto offset = AlignUp(_weightsSize, BinaryIR::WeightsAlignment);
+        _buffers.emplace_back(offset, std::make_pair(static_cast<const char*>(data), size));
+        _weightsSize = offset + size;
+        return offset;
+    }
+
+    void Write(const std::string& name, std::ostream& stream) {
+        BinaryIR::Header header{};
+        std::memcpy(header.magic, BinaryIR::Magic, sizeof(header.magic));
+        header.version = BinaryIR::Version;
+        header.name = String(name);
+        header.nodes = Bytes(_nodes);
+        header.inputs = Bytes(_inputs);
+        header.attributes = Bytes(_attributes);
+        header.data = Bytes(_data);
+        header.strings = Bytes(_strings);
+        header.parameters = Bytes(_parameters);
+        header.results = Bytes(_results);
+        header.weights = {0, _weightsSize};
+
+        // every section starts at the weights alignment, so its records are aligned in a mapped file
+        uint64_t offset = sizeof(header);
+        for (auto section : {&header.nodes, &header.inputs, &header.attributes, &header.data,
+                             &header.strings, &header.parameters, &header.results, &header.weights}) {
+            section->offset = AlignUp(offset, BinaryIR::WeightsAlignment);
+            offset = section->offset + section->size;
+        }
+
+        uint64_t written = 0;
+        auto write = [&] (uint64_t offset, const void* data, uint64_t size) {
+            static const char zeros[BinaryIR::WeightsAlignment] = {};
+            while (written < offset) {
+                auto padding = std::min<uint64_t>(offset - written, sizeof(zeros));
+                stream.write(zeros, padding);
+                written += padding;
+            }
+            stream.write(static_cast<const char*>(data), size);
+            written += size;
+        };
+        write(0, &header, sizeof(header));
+        write(header.nodes.offset, _nodes.data(), header.nodes.size);
+        write(header.inputs.offset, _inputs.data(), header.inputs.size);
+        write(header.attributes.offset, _attributes.data(), header.attributes.size);
+        write(header.data.offset, _data.data(), header.data.size);
+        write(header.strings.offset, _strings.data(), header.strings.size);
+        write(header.parameters.offset, _parameters.data(), header.parameters.size);
+        write(header.results.offset, _results.data(), header.results.size);
+        for (const auto& buffer : _buffers) {
+            write(header.weights.offset + buffer.first, buffer.second.first, buffer.second.second);
+        }
+        if (!stream.good()) {
+            THROW_IE_EXCEPTION << "Cannot write the binary IR";
+        }
+    }
+
+    std::vector<BinaryIR::Node>         _nodes;
+    std::vector<BinaryIR::Input>        _inputs;
+    std::vector<BinaryIR::Attribute>    _attributes;
+    std::vector<uint32_t>               _parameters;
+    std::vector<uint32_t>               _results;
+
+private:
+    std::vector<char>                           _data;
+    std::vector<char>                           _strings;
+    std::unordered_map<std::string, uint32_t>   _stringIds;
+    std::vector<std::pair<uint64_t, std::pair<const char*, size_t>>> _buffers;
+    uint64_t                                    _weightsSize = 0;
+};
+
+class AttributeWriter : public ngraph::AttributeVisitor {
+public:
+    AttributeWriter(Writer& writer, const ngraph::Node& node) : _writer(writer), _node(node) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        THROW_IE_EXCEPTION << "Binary IR does not support the attribute " << name << " of the type "
+                           << adapter.get_type_info().name << " of the " << _node.get_type_name()
+                           << " operation " << _node.get_friendly_name();
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        Add(name, BinaryIR::AttributeType::Buffer, _writer.Weights(adapter.get_ptr(), adapter.size()), adapter.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        Add(name, BinaryIR::AttributeType::String, _writer.String(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        Add(name, BinaryIR::AttributeType::Bool, adapter.get() ? 1 : 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        Add(name, BinaryIR::AttributeType::Int64, static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        double value = adapter.get();
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        Add(name, BinaryIR::AttributeType::Double, bits);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        const auto& values = adapter.get();
+        Add(name, BinaryIR::AttributeType::Int64s, _writer.Data(values.data(), values.size()), values.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        AddInts(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        const auto& values = adapter.get();
+        Add(name, BinaryIR::AttributeType::Floats, _writer.Data(values.data(), values.size()), values.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        const auto& values = adapter.get();
+        Add(name, BinaryIR::AttributeType::Doubles, _writer.Data(values.data(), values.size()), values.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        std::vector<uint32_t> strings;
+        for (const auto& value : adapter.get()) {
+            strings.push_back(_writer.String(value));
+        }
+        Add(name, BinaryIR::AttributeType::Strings, _writer.Data(strings.data(), strings.size()), strings.size());
+    }
+
+private:
+    void Add(const std::string& name, BinaryIR::AttributeType type, uint64_t value, uint64_t count = 1) {
+        _writer._attributes.push_back({_writer.String(name), type, value, count});
+    }
+
+    template <typename T>
+    void AddInts(const std::string& name, const std::vector<T>& values) {
+        std::vector<int64_t> ints(values.begin(), values.end());
+        Add(name, BinaryIR::AttributeType::Int64s, _writer.Data(ints.data(), ints.size()), ints.size());
+    }
+
+    Writer&             _writer;
+    const ngraph::Node& _node;
+};
+
+}  // namespace
+
+bool details::IsBinaryIRPath(const std::string& path) {
+    auto pos = path.find_last_of('.');
+    return pos != std::string::npos && path.substr(pos + 1) == BinaryIR::FileExtension;
+}
+
+void details::SerializeBinaryIR(const ngraph::Function& function, std::ostream& stream) {
+    Writer writer;
+    std::unordered_map<const ngraph::Node*, uint32_t> indices;
+    for (const auto& node : function.get_ordered_ops()) {
+        if (ngraph::is_type<ngraph::op::TensorIterator>(node)) {
+            THROW_IE_EXCEPTION << "Binary IR does not support operations with sub-graphs like "
+                               << node->get_type_name() << " " << node->get_friendly_name();
+        }
+        BinaryIR::Node record{};
+        record.type = writer.String(node->get_type_info().name);
+        record.version = node->get_type_info().version;
+        record.name = writer.String(node->get_friendly_name());
+
+        record.firstInput = Count(writer._inputs);
+        for (const auto& input : node->inputs()) {
+            auto output = input.get_source_output();
+            writer._inputs.push_back({indices.at(output.get_node()), static_cast<uint32_t>(output.get_index())});
+        }
+        record.inputsCount = Count(writer._inputs) - record.firstInput;
+
+        record.firstAttribute = Count(writer._attributes);
+        AttributeWriter visitor(writer, *node);
+        if (!node->visit_attributes(visitor)) {
+            THROW_IE_EXCEPTION << "Binary IR does not support the " << node->get_type_name() << " operation "
+                               << node->get_friendly_name() << " which does not visit its attributes";
+        }
+        record.attributesCount = Count(writer._attributes) - record.firstAttribute;
+
+        indices.emplace(node.get(), Count(writer._nodes));
+        writer._nodes.push_back(record);
+    }
+    for (const auto& parameter : function.get_parameters()) {
+        writer._parameters.push_back(indices.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        writer._results.push_back(indices.at(result.get()));
+    }
+    writer.Write(function.get_friendly_name(), stream);
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with the writer of the binary IR
+ * @file ie_bin_ir_serializer.hpp
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+namespace ngraph {
+class Function;
+}  // namespace ngraph
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Checks whether the path has the extension of the binary IR files
+ * @param path A path to the model file
+ * @return `True` if the model has to be written as the binary IR
+ */
+bool IsBinaryIRPath(const std::string& path);
+
+/**
+ * @brief Writes the function to the binary IR, the graph and the weights go to one stream.
+ * Attributes of the operations are written through ngraph::AttributeVisitor,
+ * so all the operations which visit their attributes are supported except the operations with sub-graphs
+ * @param function A function to write
+ * @param stream A binary stream
+ */
+void SerializeBinaryIR(const ngraph::Function& function, std::ostream& stream);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_blob_transfer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "blob_factory.hpp"
+#include "blob_transform.hpp"
+#include "details/ie_exception.hpp"
+#include "threading/ie_immediate_executor.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+// the pages are mapped for DMA as a whole, so the staging blobs do not share them with other allocations
+constexpr size_t pageSize = 4096;
+}  // namespace
+
+bool BlobTransfer::IsSameMemory(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (src == dst)
+        return true;
+    auto srcMemory = as<MemoryBlob>(src);
+    auto dstMemory = as<MemoryBlob>(dst);
+    if (!srcMemory || !dstMemory || srcMemory->getTensorDesc() != dstMemory->getTensorDesc())
+        return false;
+    auto srcData = srcMemory->rmap().as<const void*>();
+    return srcData != nullptr && srcData == dstMemory->rmap().as<const void*>();
+}
+
+bool BlobTransfer::Copy(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (IsSameMemory(src, dst))
+        return false;
+    blob_copy(src, dst);
+    return true;
+}
+
+Blob::Ptr BlobTransfer::GetStagingBlob(const std::string& name, const TensorDesc& desc) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& buffer = _staging[name];
+    if (buffer.blob && buffer.blob->getTensorDesc() == desc)
+        return buffer.blob;
+
+    size_t size = desc.getPrecision().size();
+    for (auto dim : desc.getBlockingDesc().getBlockDims())
+        size *= dim;
+    size += desc.getBlockingDesc().getOffsetPadding() * desc.getPrecision().size();
+
+    buffer.blob = nullptr;
+    buffer.storage.reset(new uint8_t[size + pageSize]);
+    auto data = buffer.storage.get() + (pageSize - reinterpret_cast<uintptr_t>(buffer.storage.get()) % pageSize) % pageSize;
+    buffer.blob = make_blob_with_precision(desc, data);
+    return buffer.blob;
+}
+
+void BlobTransfer::Add(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (src == nullptr || dst == nullptr)
+        THROW_IE_EXCEPTION << "Cannot transfer an empty blob";
+    std::lock_guard<std::mutex> lock{_mutex};
+    _copies.emplace_back(src, dst);
+}
+
+void BlobTransfer::Run() {
+    std::vector<std::pair<Blob::Ptr, Blob::Ptr>> copies;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        std::swap(copies, _copies);
+    }
+    // the large copies are parallel inside, the small ones are not worth waking up the threads
+    for (auto& copy : copies)
+        Copy(copy.first, copy.second);
+}
+
+std::pair<ITaskExecutor::Ptr, Task> BlobTransfer::GetStage(const ITaskExecutor::Ptr& executor) {
+    return {executor ? executor : std::make_shared<ImmediateExecutor>(), [this] {Run();}};
+}
+
+}  // namespace InferenceEngine
@@ -9,6 +9,7 @@
 
 #include "ie_compound_blob.h"
 
+#include <algorithm>
 #include <initializer_list>
 #include <memory>
 #include <utility>
@@ -189,6 +190,55 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
                            << yDims[3] << "(Y plane) and " << vDims[3] << "(V plane)";
     }
 }
+
+TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from an empty vector of images";
+    }
+
+    if (std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob == nullptr;
+        })) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from nullptr Blob objects";
+    }
+
+    // the images are either all memory blobs or all NV12/I420 blobs, the Y plane gives the batch of a YUV blob
+    auto imageDesc = [](const Blob::Ptr& blob) -> TensorDesc {
+        if (blob->is<NV12Blob>()) {
+            return blob->as<NV12Blob>()->y()->getTensorDesc();
+        }
+        if (blob->is<I420Blob>()) {
+            return blob->as<I420Blob>()->y()->getTensorDesc();
+        }
+        if (blob->is<MemoryBlob>()) {
+            return blob->getTensorDesc();
+        }
+        THROW_IE_EXCEPTION << "Images of a batched blob must be MemoryBlob, NV12Blob or I420Blob objects";
+    };
+
+    const auto& first = blobs.front();
+    for (const auto& blob : blobs) {
+        if (blob->is<NV12Blob>() != first->is<NV12Blob>() || blob->is<I420Blob>() != first->is<I420Blob>()) {
+            THROW_IE_EXCEPTION << "Images of a batched blob must be blobs of the same kind";
+        }
+
+        const auto desc = imageDesc(blob);
+        if (desc.getDims().size() != 4 || desc.getDims()[0] != 1) {
+            THROW_IE_EXCEPTION << "Images of a batched blob must be 4D blobs with the batch size 1";
+        }
+        if (blob->getTensorDesc().getPrecision() != first->getTensorDesc().getPrecision() ||
+            blob->getTensorDesc().getLayout() != first->getTensorDesc().getLayout()) {
+            THROW_IE_EXCEPTION << "Images of a batched blob must have the same precision and layout";
+        }
+    }
+
+    if (first->is<CompoundBlob>()) {
+        return first->getTensorDesc();
+    }
+    auto dims = first->getTensorDesc().getDims();
+    dims[0] = blobs.size();
+    return TensorDesc(first->getTensorDesc().getPrecision(), dims, first->getTensorDesc().getLayout());
+}
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -371,4 +421,16 @@ const Blob::Ptr& I420Blob::v() const noexcept {
     return _blobs[2];
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    _blobs = blobs;
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    _blobs = std::move(blobs);
+}
+
+BatchedBlob::~BatchedBlob() {}
+
 }  // namespace InferenceEngine
@@ -5,6 +5,9 @@
 #include "ie_core.hpp"
 
 #include <unordered_set>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <limits>
 #include <map>
@@ -14,18 +17,27 @@
 #include <vector>
 #include <istream>
 #include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <thread>
 
 #include <ngraph/opsets/opset.hpp>
 #include "ie_plugin_cpp.hpp"
 #include "cpp_interfaces/base/ie_plugin_base.hpp"
+#include "compilation_context.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "details/ie_so_pointer.hpp"
 #include "ie_icore.hpp"
+#include "ie_load_time_profile.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_profiling.hpp"
+#include "ie_system_conf.h"
+#include "ie_tracing.hpp"
 #include "ie_util_internal.hpp"
 #include "ie_network_reader.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "threading/ie_executor_manager.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -62,6 +74,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -179,6 +194,78 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    // created plugins which got the Core and their own extensions, the extensions are loaded only when
+    // a plugin is used to compile networks, so querying versions, metrics or configs of devices stays cheap
+    mutable std::unordered_set<std::string> pluginsWithExtensions;
+
+    std::string cacheDir;  // a directory for compiled networks, protected by pluginsMutex
+
+    /**
+     * @brief Checks whether compiled networks of a plugin can be stored in cache
+     * @param plugin A plugin to check
+     * @return `true` if plugin reports IMPORT_EXPORT_SUPPORT metric
+     */
+    static bool DeviceSupportsImportExport(InferencePlugin& plugin) {
+        auto pluginAPIInterface = getInferencePluginAPIInterface(plugin);
+        if (pluginAPIInterface == nullptr) {
+            return false;
+        }
+
+        try {
+            auto supportedMetrics = pluginAPIInterface->GetMetric(METRIC_KEY(SUPPORTED_METRICS), {})
+                .as<std::vector<std::string>>();
+            auto it = std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+            return it != supportedMetrics.end() &&
+                pluginAPIInterface->GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Compiles a network or imports it from the cache directory if it was compiled before
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network,
+                                           const std::string& deviceName, const std::string& cacheDirectory,
+                                           const std::map<std::string, std::string>& config) {
+        auto hash = NetworkCompilationContext::computeHash(network, deviceName, config);
+        auto blobFileName = FileUtils::makePath(cacheDirectory, hash + ".blob");
+
+        if (FileUtils::fileExist(blobFileName)) {
+            try {
+                IE_PROFILING_AUTO_SCOPE(Core::ImportNetworkFromCache)
+                std::ifstream networkStream(blobFileName, std::ios_base::binary);
+                return getInferencePluginAPIInterface(plugin)->ImportNetwork(networkStream, config);
+            } catch (...) {
+                // cached blob is corrupted or created by incompatible plugin, recompile and overwrite it
+            }
+        }
+
+        auto execNetwork = plugin.LoadNetwork(network, config);
+
+        // write into a temporary file first to not expose partially written blobs to other processes
+        auto tmpFileName = blobFileName + ".tmp";
+        IE_LOAD_PHASE("cache_export");
+        try {
+            {
+                std::ofstream networkStream(tmpFileName, std::ios_base::binary);
+                if (!networkStream.is_open()) {
+                    THROW_IE_EXCEPTION << "Cannot open " << tmpFileName << " for writing";
+                }
+                execNetwork.Export(networkStream);
+            }
+            std::remove(blobFileName.c_str());
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+                std::remove(tmpFileName.c_str());
+            }
+        } catch (...) {
+            // cache is best-effort, the compiled network is still valid
+            std::remove(tmpFileName.c_str());
+        }
+
+        return execNetwork;
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -274,8 +361,141 @@ public:
     ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
                                   const std::map<std::string, std::string>& config) override {
         IE_PROFILING_AUTO_SCOPE(Core::LoadNetwork)
+        // the plugin adds its phases to this profile, so the network reports them together with the cache export
+        auto profile = LoadTimeProfile::GetCurrent();
+        const bool ownProfile = profile == nullptr;
+        if (ownProfile) {
+            profile = std::make_shared<LoadTimeProfile>();
+            resetPeakMemoryUsage();
+        }
+        LoadTimeProfile::Scope profileScope(profile, LoadTimeProfile::GetCurrentPhase());
+        auto execNetwork = LoadNetworkToDevice(network, deviceName, config);
+        if (ownProfile) {
+            // the network shares the profile, so the peak covers the whole load including the cache export
+            profile->SetPeakMemory(getPeakMemoryUsage());
+        }
+        return execNetwork;
+    }
+
+    std::vector<ExecutableNetwork> LoadNetworks(const std::vector<NetworkLoadEntry>& entries, unsigned int numThreads,
+                                                size_t memoryLimit) {
+        IE_PROFILING_AUTO_SCOPE(Core::LoadNetworks)
+        std::vector<ExecutableNetwork> execNetworks(entries.size());
+        if (entries.empty()) {
+            return execNetworks;
+        }
+
+        // the files of a model approximate the memory its network takes while it is read and compiled
+        std::vector<size_t> modelSizes(entries.size(), 0);
+        if (memoryLimit != 0) {
+            for (size_t i = 0; i < entries.size(); i++) {
+                std::string binPath = entries[i].binPath;
+                if (binPath.empty()) {
+                    auto pos = entries[i].modelPath.rfind('.');
+                    binPath = entries[i].modelPath.substr(0, pos) + ".bin";
+                }
+                for (const auto& path : {entries[i].modelPath, binPath}) {
+                    auto size = FileUtils::fileSize(path);
+                    if (size > 0) modelSizes[i] += static_cast<size_t>(size);
+                }
+            }
+        }
+
+        if (numThreads == 0) {
+            numThreads = static_cast<unsigned int>(std::max(getNumberOfCPUCores(), 1));
+        }
+        numThreads = std::min<unsigned int>(numThreads, static_cast<unsigned int>(entries.size()));
+
+        std::mutex mutex;
+        std::condition_variable memoryReleased;
+        size_t next = 0;
+        size_t memoryInUse = 0;
+        size_t loadsInFlight = 0;
+        std::exception_ptr error;
+
+        auto fail = [&](const NetworkLoadEntry& entry, const char* message) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (error) {
+                return;
+            }
+            try {
+                THROW_IE_EXCEPTION << "Failed to load " << entry.modelPath << " to " << entry.deviceName << ": " << message;
+            } catch (...) {
+                error = std::current_exception();
+            }
+        };
+
+        auto worker = [&] {
+            for (;;) {
+                size_t index;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    // the entries start in order, so a large model is not starved by the small ones after it
+                    memoryReleased.wait(lock, [&] {
+                        return error || next == entries.size() || memoryLimit == 0 || loadsInFlight == 0 ||
+                               memoryInUse + modelSizes[next] <= memoryLimit;
+                    });
+                    if (error || next == entries.size()) {
+                        return;
+                    }
+                    index = next++;
+                    memoryInUse += modelSizes[index];
+                    loadsInFlight++;
+                }
+
+                const auto& entry = entries[index];
+                try {
+                    auto network = ReadNetwork(entry.modelPath, entry.binPath);
+                    execNetworks[index] = LoadNetwork(network, entry.deviceName, entry.config);
+                } catch (const std::exception& ex) {
+                    fail(entry, ex.what());
+                } catch (...) {
+                    fail(entry, "unknown exception");
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    memoryInUse -= modelSizes[index];
+                    loadsInFlight--;
+                }
+                memoryReleased.notify_all();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        for (unsigned int i = 1; i < numThreads; i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return execNetworks;
+    }
+
+    ExecutableNetwork LoadNetworkToDevice(const CNNNetwork& network, const std::string& deviceName,
+                                          const std::map<std::string, std::string>& config) {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+
+        std::string cacheDirectory = GetCacheDir();
+        auto cacheDirIt = parsed._config.find(CONFIG_KEY(CACHE_DIR));
+        if (cacheDirIt != parsed._config.end()) {
+            cacheDirectory = cacheDirIt->second;
+            parsed._config.erase(cacheDirIt);
+        }
+
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        if (!cacheDirectory.empty() && NetworkCompilationContext::isCacheable(network) &&
+            DeviceSupportsImportExport(plugin)) {
+            return LoadNetworkWithCache(plugin, network, parsed._deviceName, cacheDirectory, parsed._config);
+        }
+
+        return plugin.LoadNetwork(network, parsed._config);
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -330,7 +550,7 @@ public:
         }
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
-        InferencePlugin cppPlugin = GetCPPPluginByName(parsed._deviceName);
+        InferencePlugin cppPlugin = GetCPPPluginByName(parsed._deviceName, false);
         auto pluginAPIInterface = getInferencePluginAPIInterface(cppPlugin);
 
         if (pluginAPIInterface == nullptr) {
@@ -347,9 +567,12 @@ public:
      * @deprecated
      * @brief Returns reference to CPP plugin wrapper by a device name
      * @param deviceName A name of device
+     * @param withExtensions Whether the plugin is going to compile networks and needs the registered extensions,
+     *        the plugin libraries are loaded on the first use of a device and the extensions on the first use
+     *        with this flag set
      * @return Reference to a CPP plugin wrapper
      */
-    InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
+    InferencePlugin GetCPPPluginByName(const std::string& deviceName, bool withExtensions = true) const {
         std::lock_guard<std::mutex> lock(pluginsMutex);
 
         auto it = pluginRegistry.find(deviceName);
@@ -359,9 +582,9 @@ public:
 
         // Plugin is in registry, but not created, let's create
 
+        const PluginDescriptor& desc = it->second;
         if (plugins.find(deviceName) == plugins.end()) {
-            PluginDescriptor desc = it->second;
-
+            IE_PROFILING_AUTO_SCOPE(Core::CreatePlugin)
             try {
                 InferenceEnginePluginPtr plugin(desc.libraryLocation);
                 IInferencePlugin* pplugin = static_cast<IInferencePlugin*>(plugin.operator->());
@@ -375,23 +598,10 @@ public:
                     iplugin_api_ptr->SetCore(mutableCore);
                 }
 
-                // Add registered extensions to new plugin
-                for (const auto& ext : extensions) {
-                    plugin->AddExtension(ext, nullptr);
-                }
-
                 InferencePlugin cppPlugin(plugin);
 
                 // configuring
-                {
-                    cppPlugin.SetConfig(desc.defaultConfig);
-
-                    for (auto&& extensionLocation : desc.listOfExtentions) {
-                        // TODO: fix once InferenceEngine::Extension can accept FileUtils::FilePath
-                        // currently, extensions cannot be loaded using wide path
-                        cppPlugin.AddExtension(make_so_pointer<IExtension>(FileUtils::fromFilePath(extensionLocation)));
-                    }
-                }
+                cppPlugin.SetConfig(desc.defaultConfig);
 
                 plugins[deviceName] = cppPlugin;
             } catch (const details::InferenceEngineException& ex) {
@@ -402,7 +612,31 @@ public:
             }
         }
 
-        return plugins[deviceName];
+        auto& cppPlugin = plugins[deviceName];
+        if (withExtensions && pluginsWithExtensions.count(deviceName) == 0) {
+            IE_PROFILING_AUTO_SCOPE(Core::AddPluginExtensions)
+            // Add registered extensions, not every plugin supports them
+            for (const auto& ext : extensions) {
+                try {
+                    cppPlugin.AddExtension(ext);
+                } catch (...) {}
+            }
+
+            try {
+                for (auto&& extensionLocation : desc.listOfExtentions) {
+                    // TODO: fix once InferenceEngine::Extension can accept FileUtils::FilePath
+                    // currently, extensions cannot be loaded using wide path
+                    cppPlugin.AddExtension(make_so_pointer<IExtension>(FileUtils::fromFilePath(extensionLocation)));
+                }
+            } catch (const details::InferenceEngineException& ex) {
+                THROW_IE_EXCEPTION << "Failed to load extensions of plugin " << FileUtils::fromFilePath(desc.libraryLocation)
+                                   << " for device " << deviceName << "\n"
+                                   << ex.what() << "\n";
+            }
+            pluginsWithExtensions.insert(deviceName);
+        }
+
+        return cppPlugin;
     }
 
     /**
@@ -417,6 +651,7 @@ public:
         }
 
         plugins.erase(deviceName);
+        pluginsWithExtensions.erase(deviceName);
     }
 
     /**
@@ -494,6 +729,24 @@ public:
         }
     }
 
+    /**
+     * @brief Sets a directory for compiled networks cache
+     * @param dir A directory path. Empty value disables cache
+     */
+    void SetCacheDir(const std::string& dir) {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        cacheDir = dir;
+    }
+
+    /**
+     * @brief Returns a directory for compiled networks cache
+     * @return A directory path or empty string if cache is disabled
+     */
+    std::string GetCacheDir() const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        return cacheDir;
+    }
+
     /**
      * @brief Registers the extension in a Core object
      *        Such extensions can be used for both CNNNetwork readers and device plugins
@@ -508,8 +761,10 @@ public:
             opsetNames.insert(it.first);
         }
 
-        // add extensions for already created plugins
+        // add extensions for the plugins which got the extensions already, the rest get them on the first use
         for (auto& plugin : plugins) {
+            if (pluginsWithExtensions.count(plugin.first) == 0)
+                continue;
             try {
                 plugin.second.AddExtension(extension);
             } catch (...) {}
@@ -575,7 +830,7 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
         DeviceIDParser parser(deviceName_);
         std::string deviceNameLocal = parser.getDeviceName();
 
-        InferenceEngine::InferencePlugin cppPlugin = _impl->GetCPPPluginByName(deviceNameLocal);
+        InferenceEngine::InferencePlugin cppPlugin = _impl->GetCPPPluginByName(deviceNameLocal, false);
         const Version * version = cppPlugin.GetVersion();
         versions[deviceNameLocal] = *version;
     }
@@ -596,6 +851,11 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const std::string
     return _impl->LoadNetwork(network, deviceName, config);
 }
 
+std::vector<ExecutableNetwork> Core::LoadNetworks(const std::vector<NetworkLoadEntry>& entries, unsigned int numThreads,
+                                                  size_t memoryLimit) {
+    return _impl->LoadNetworks(entries, numThreads, memoryLimit);
+}
+
 void Core::AddExtension(const IExtensionPtr& extension) {
     _impl->AddExtension(extension);
 }
@@ -742,6 +1002,46 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // cache directory, trace file and CPU threads budget are handled by Core itself and are not passed to plugins
+    auto cacheDirIt = config.find(CONFIG_KEY(CACHE_DIR));
+    auto traceFileIt = config.find(CONFIG_KEY(TRACE_FILE));
+    auto threadsBudgetIt = config.find(CONFIG_KEY(CPU_THREADS_BUDGET));
+    if (cacheDirIt != config.end() || traceFileIt != config.end() || threadsBudgetIt != config.end()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << CONFIG_KEY(CACHE_DIR) << ", " << CONFIG_KEY(TRACE_FILE) << " and "
+                               << CONFIG_KEY(CPU_THREADS_BUDGET) << " can be set only for all devices (with empty device name)";
+        }
+        auto pluginsConfig = config;
+        if (cacheDirIt != config.end()) {
+            _impl->SetCacheDir(cacheDirIt->second);
+            pluginsConfig.erase(CONFIG_KEY(CACHE_DIR));
+        }
+        if (traceFileIt != config.end()) {
+            if (traceFileIt->second.empty()) {
+                tracing::Stop();
+            } else {
+                tracing::Start(traceFileIt->second);
+            }
+            pluginsConfig.erase(CONFIG_KEY(TRACE_FILE));
+        }
+        if (threadsBudgetIt != config.end()) {
+            int threads = -1;
+            try {
+                threads = std::stoi(threadsBudgetIt->second);
+            } catch (const std::exception&) {}
+            if (threads < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_THREADS_BUDGET)
+                                   << ". Expected only non negative numbers (#threads)";
+            }
+            ExecutorManager::getInstance()->getCPUResourceManager().SetBudget(threads);
+            pluginsConfig.erase(CONFIG_KEY(CPU_THREADS_BUDGET));
+        }
+        if (!pluginsConfig.empty()) {
+            _impl->SetConfigForPlugins(pluginsConfig, std::string());
+        }
+        return;
+    }
+
     if (deviceName.empty()) {
         _impl->SetConfigForPlugins(config, std::string());
     } else {
@@ -768,8 +1068,20 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
         }
     }
 
+    if (name == CONFIG_KEY(CACHE_DIR)) {
+        return _impl->GetCacheDir();
+    }
+
+    if (name == CONFIG_KEY(TRACE_FILE)) {
+        return tracing::GetFilePath();
+    }
+
+    if (name == CONFIG_KEY(CPU_THREADS_BUDGET)) {
+        return std::to_string(ExecutorManager::getInstance()->getCPUResourceManager().GetBudget());
+    }
+
     auto parsed = parseDeviceNameIntoConfig(deviceName);
-    auto cppPlugin = _impl->GetCPPPluginByName(parsed._deviceName);
+    auto cppPlugin = _impl->GetCPPPluginByName(parsed._deviceName, false);
     auto pluginAPIInterface = getInferencePluginAPIInterface(cppPlugin);
 
     if (pluginAPIInterface == nullptr) {
@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_load_time_profile.hpp"
+
+#include <string>
+#include <utility>
+
+namespace InferenceEngine {
+
+namespace {
+
+struct ThreadState {
+    LoadTimeProfile::Ptr _profile;
+    std::string          _phase;
+};
+
+ThreadState& GetThreadState() {
+    static thread_local ThreadState state;
+    return state;
+}
+
+}  // namespace
+
+LoadTimeProfile::Scope::Scope(const Ptr& profile, const std::string& phase) {
+    auto& state = GetThreadState();
+    _previousProfile = std::move(state._profile);
+    _previousPhase = std::move(state._phase);
+    state._profile = profile;
+    state._phase = phase;
+}
+
+LoadTimeProfile::Scope::~Scope() {
+    auto& state = GetThreadState();
+    state._profile = std::move(_previousProfile);
+    state._phase = std::move(_previousPhase);
+}
+
+LoadTimeProfile::Phase::Phase(const char* name) {
+    auto& state = GetThreadState();
+    if (state._profile == nullptr) {
+        return;
+    }
+    _profile = state._profile;
+    _previousPhase = state._phase;
+    state._phase = _previousPhase.empty() ? std::string(name) : _previousPhase + "/" + name;
+    _begin = std::chrono::steady_clock::now();
+}
+
+LoadTimeProfile::Phase::~Phase() {
+    if (_profile == nullptr) {
+        return;
+    }
+    auto& state = GetThreadState();
+    _profile->Add(state._phase, std::chrono::steady_clock::now() - _begin);
+    state._phase = std::move(_previousPhase);
+}
+
+void LoadTimeProfile::Add(const std::string& phase, std::chrono::steady_clock::duration duration) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _phases[phase] += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+LoadTimeProfile::Phases LoadTimeProfile::GetPhases() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _phases;
+}
+
+void LoadTimeProfile::SetPeakMemory(std::uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _peakMemory = bytes;
+}
+
+std::uint64_t LoadTimeProfile::GetPeakMemory() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _peakMemory;
+}
+
+LoadTimeProfile::Ptr LoadTimeProfile::GetCurrent() {
+    return GetThreadState()._profile;
+}
+
+std::string LoadTimeProfile::GetCurrentPhase() {
+    return GetThreadState()._phase;
+}
+
+}  // namespace InferenceEngine
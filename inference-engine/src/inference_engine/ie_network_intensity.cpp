@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_intensity.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+bool isStatic(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_partial_shape().is_static() && output.get_element_type().is_static();
+}
+
+size_t bytesOf(const ngraph::Output<ngraph::Node>& output) {
+    return ngraph::shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+// the multiply-adds of the operations with weights, 0 for the rest of the operations
+double multiplyAdds(const std::shared_ptr<ngraph::Node>& node) {
+    using namespace ngraph::opset1;
+    if (ngraph::is_type<Convolution>(node) || ngraph::is_type<GroupConvolution>(node)) {
+        // every output element is reduced over the part of the weights of its output channel
+        const auto& output = node->get_output_shape(0);
+        const auto weights = ngraph::shape_size(node->get_input_shape(1));
+        return output.size() > 1 && output[1] > 0
+               ? static_cast<double>(ngraph::shape_size(output)) * static_cast<double>(weights / output[1]) : 0;
+    }
+    if (ngraph::is_type<ConvolutionBackpropData>(node) || ngraph::is_type<GroupConvolutionBackpropData>(node)) {
+        // every input element is scattered over the part of the weights of its input channel
+        const auto& input = node->get_input_shape(0);
+        const auto weights = ngraph::shape_size(node->get_input_shape(1));
+        return input.size() > 1 && input[1] > 0
+               ? static_cast<double>(ngraph::shape_size(input)) * static_cast<double>(weights / input[1]) : 0;
+    }
+    if (auto matMul = ngraph::as_type_ptr<MatMul>(node)) {
+        const auto& a = matMul->get_input_shape(0);
+        if (a.empty()) {
+            return 0;
+        }
+        const auto k = (matMul->get_transpose_a() && a.size() > 1) ? a[a.size() - 2] : a.back();
+        return static_cast<double>(ngraph::shape_size(matMul->get_output_shape(0))) * static_cast<double>(k);
+    }
+    return 0;
+}
+
+}  // namespace
+
+NetworkIntensity getNetworkIntensity(const ngraph::Function& function) {
+    NetworkIntensity intensity;
+    for (auto&& node : function.get_ordered_ops()) {
+        // the constants and the parameters are counted by the operations which read them
+        if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+            continue;
+        }
+        const auto inputs = node->input_values();
+        const auto outputs = node->outputs();
+        if (!std::all_of(inputs.begin(), inputs.end(), isStatic) ||
+            !std::all_of(outputs.begin(), outputs.end(), isStatic)) {
+            continue;
+        }
+
+        size_t workingSet = 0;
+        for (auto&& input : inputs) {
+            workingSet += bytesOf(input);
+        }
+        double elements = 0;
+        for (auto&& output : outputs) {
+            workingSet += bytesOf(output);
+            elements += static_cast<double>(ngraph::shape_size(output.get_shape()));
+        }
+
+        const auto macs = multiplyAdds(node);
+        intensity.flops += macs > 0 ? 2 * macs : elements;
+        intensity.bytes += static_cast<double>(workingSet);
+        intensity.maxWorkingSet = std::max(intensity.maxWorkingSet, workingSet);
+    }
+    return intensity;
+}
+
+}  // namespace InferenceEngine
@@ -3,9 +3,12 @@
 //
 
 #include "ie_network_reader.hpp"
+#include "compressed_weights.hpp"
+#include "mmap_object.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
+#include <ie_bin_ir_format.hpp>
 #include <ie_blob_stream.hpp>
 #include <ie_profiling.hpp>
 #include <ie_reader.hpp>
@@ -13,8 +16,10 @@
 
 #include <fstream>
 #include <istream>
+#include <iterator>
 #include <mutex>
 #include <map>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -130,6 +135,11 @@ void registerReaders() {
     if (irReaderv7)
         readers.emplace("xml", irReaderv7);
 
+    // try to load binary IR reader if library exists
+    auto binaryIRReader = create_if_exists("BinaryIR", std::string("inference_engine_bin_ir_reader") + std::string(IE_BUILD_POSTFIX));
+    if (binaryIRReader)
+        readers.emplace(details::BinaryIR::FileExtension, binaryIRReader);
+
     initialized = true;
 }
 
@@ -150,6 +160,31 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
     THROW_IE_EXCEPTION << "IR v" << irVersion << " is deprecated. Please, migrate to IR v10 version";
 }
 
+/**
+ * @brief Decompresses the weights written by compress_weights_tool, other weights are returned as they are
+ */
+Blob::CPtr decompressIfNeeded(const Blob::CPtr& weights) {
+    if (weights && details::isCompressedWeights(weights->cbuffer().as<const void*>(), weights->byteSize()))
+        return details::decompressWeights(weights->cbuffer().as<const void*>(), weights->byteSize());
+    return weights;
+}
+
+/**
+ * @brief Reads the compressed weights from the stream if it starts with them, the stream is rewound otherwise
+ */
+Blob::CPtr readCompressedWeights(std::istream& stream) {
+    char header[64] = {};
+    stream.read(header, sizeof(header));
+    const auto headerSize = static_cast<size_t>(stream.gcount());
+    stream.clear();
+    stream.seekg(0, std::ios::beg);
+    if (!details::isCompressedWeights(header, headerSize))
+        return nullptr;
+
+    std::vector<char> content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    return details::decompressWeights(content.data(), content.size());
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -169,6 +204,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
         THROW_IE_EXCEPTION << "Model file " << modelPath << " cannot be opened!";
 
     assertIfIRv7LikeModel(modelStream);
+    // let readers resolve files the model refers to, e.g. ONNX external data
+    modelStream.pword(modelPathStreamIndex) = const_cast<char*>(modelPath.c_str());
 
     // Find reader for model extension
     auto fileExt = modelPath.substr(modelPath.find_last_of(".") + 1);
@@ -192,6 +229,15 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
+                // Map weights file into memory, so readers can share the pages with Constants instead of copying
+                // Compressed weights are decompressed into memory at once, the chunks are decoded in parallel
+                if (auto mappedWeights = details::mapFile(bPath)) {
+                    details::BlobStream binStream(decompressIfNeeded(details::make_mapped_blob(mappedWeights)));
+                    auto network = reader->read(modelStream, binStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+
                 // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = InferenceEngine::details::multiByteCharToWString(bPath.c_str());
@@ -203,11 +249,28 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 if (!binStream.is_open())
                     THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
 
+                if (auto weights = readCompressedWeights(binStream)) {
+                    details::BlobStream decompressedStream(weights);
+                    auto network = reader->read(modelStream, decompressedStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+
                 // read model with weights
                 auto network = reader->read(modelStream, binStream, exts);
                 modelStream.close();
                 return network;
             }
+            // Map the model file into memory if the reader keeps the weights in it, so they are shared
+            // with Constants instead of copying
+            if (reader->getDataFileExtensions().empty()) {
+                if (auto mappedModel = details::mapFile(modelPath)) {
+                    details::BlobStream mappedStream(details::make_mapped_blob(mappedModel));
+                    mappedStream.pword(modelPathStreamIndex) = const_cast<char*>(modelPath.c_str());
+                    modelStream.close();
+                    return reader->read(mappedStream, exts);
+                }
+            }
             // read model without weights
             return reader->read(modelStream, exts);
         }
@@ -221,7 +284,7 @@ CNNNetwork details::ReadNetwork(const std::string& model, const Blob::CPtr& weig
     // Register readers if it is needed
     registerReaders();
     std::istringstream modelStream(model);
-    details::BlobStream binStream(weights);
+    details::BlobStream binStream(decompressIfNeeded(weights));
 
     assertIfIRv7LikeModel(modelStream);
 
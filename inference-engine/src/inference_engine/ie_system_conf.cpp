@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #ifdef ENABLE_MKL_DNN
@@ -139,6 +141,13 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
 // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
 // (see cpp files in corresponding folders), for __APPLE__ it is default :
 int getNumberOfCPUCores() { return parallel_get_max_threads();}
+int getNumberOfAvailableCPUs() { return std::max(1u, std::thread::hardware_concurrency()); }
+int getCPUQuota() { return 0; }
+size_t getAvailableMemory() { return 0; }
+size_t getPeakMemoryUsage() { return 0; }
+bool resetPeakMemoryUsage() { return false; }
+std::vector<std::vector<int>> getAvailableCores(CPUCoreType) { return {}; }
+std::vector<int> getCoreSiblings(int processor) { return {processor}; }
 #if !((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() { return {0}; }
 #endif
@@ -0,0 +1,200 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracing.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+namespace tracing {
+
+namespace {
+
+struct Event {
+    char            _phase;
+    const char*     _category;
+    std::string     _name;
+    std::uint64_t   _id;
+    int             _threadId;
+    TimePoint       _begin;
+    TimePoint       _end;
+    std::string     _args;
+};
+
+void WriteEscaped(std::ostream& out, const std::string& value) {
+    for (auto c : value) {
+        switch (c) {
+        case '"': out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out << escaped;
+            } else {
+                out << c;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Keeps recorded events in memory and writes them to the file in batches,
+ * so recording does not involve I/O on every inference
+ */
+class Tracer {
+public:
+    static Tracer& Get() {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    ~Tracer() {
+        Stop();
+    }
+
+    void Start(const std::string& filePath) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        CloseFile();
+        _file.open(filePath, std::ios_base::out | std::ios_base::trunc);
+        if (!_file.is_open()) {
+            THROW_IE_EXCEPTION << "Cannot open the trace file " << filePath;
+        }
+        _file << "[\n"
+              << R"({"name":"process_name","ph":"M","pid":0,"tid":0,"args":{"name":"Inference Engine"}})";
+        _filePath = filePath;
+        _enabled = true;
+    }
+
+    std::string GetFilePath() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _filePath;
+    }
+
+    void Stop() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        CloseFile();
+    }
+
+    bool IsEnabled() const noexcept {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void Add(Event&& event) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_enabled) {
+            return;
+        }
+        _events.emplace_back(std::move(event));
+        if (_events.size() >= maxBufferedEvents) {
+            Flush();
+        }
+    }
+
+    static int GetThreadId() {
+        static std::atomic<int> nextThreadId{1};
+        thread_local int threadId = nextThreadId++;
+        return threadId;
+    }
+
+private:
+    static constexpr std::size_t maxBufferedEvents = 16384;
+
+    Tracer() : _epoch{Clock::now()} {}
+
+    double ToMicroseconds(TimePoint timePoint) const {
+        return std::chrono::duration<double, std::micro>(timePoint - _epoch).count();
+    }
+
+    void WriteEvent(const Event& event, char phase, TimePoint timestamp) {
+        _file << ",\n{\"name\":\"";
+        WriteEscaped(_file, event._name);
+        _file << "\",\"cat\":\"" << event._category << "\",\"ph\":\"" << phase
+              << "\",\"pid\":0,\"tid\":" << event._threadId
+              << ",\"ts\":" << ToMicroseconds(timestamp);
+        if (phase == 'X') {
+            _file << ",\"dur\":" << ToMicroseconds(event._end) - ToMicroseconds(event._begin);
+        } else {
+            _file << ",\"id\":" << event._id;
+        }
+        if (!event._args.empty() && phase != 'e') {
+            _file << ",\"args\":" << event._args;
+        }
+        _file << "}";
+    }
+
+    void Flush() {
+        _file << std::fixed << std::setprecision(3);
+        for (auto&& event : _events) {
+            if (event._phase == 'X') {
+                WriteEvent(event, 'X', event._begin);
+            } else {
+                WriteEvent(event, 'b', event._begin);
+                WriteEvent(event, 'e', event._end);
+            }
+        }
+        _events.clear();
+        _file.flush();
+    }
+
+    void CloseFile() {
+        _enabled = false;
+        _filePath.clear();
+        if (_file.is_open()) {
+            Flush();
+            _file << "\n]\n";
+            _file.close();
+        }
+        _events.clear();
+    }
+
+    const TimePoint     _epoch;
+    std::atomic<bool>   _enabled{false};
+    std::mutex          _mutex;
+    std::ofstream       _file;
+    std::string         _filePath;
+    std::vector<Event>  _events;
+};
+
+constexpr std::size_t Tracer::maxBufferedEvents;
+
+}  // namespace
+
+void Start(const std::string& filePath) {
+    Tracer::Get().Start(filePath);
+}
+
+void Stop() {
+    Tracer::Get().Stop();
+}
+
+std::string GetFilePath() {
+    return Tracer::Get().GetFilePath();
+}
+
+bool IsEnabled() noexcept {
+    return Tracer::Get().IsEnabled();
+}
+
+void AddEvent(const char* category, const std::string& name, TimePoint begin, TimePoint end, const std::string& args) {
+    Tracer::Get().Add({'X', category, name, 0, Tracer::GetThreadId(), begin, end, args});
+}
+
+void AddAsyncEvent(const char* category, const std::string& name, std::uint64_t id,
+                   TimePoint begin, TimePoint end, const std::string& args) {
+    Tracer::Get().Add({'b', category, name, id, Tracer::GetThreadId(), begin, end, args});
+}
+
+}  // namespace tracing
+}  // namespace InferenceEngine
@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_transformations_cache.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include <ngraph/function.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+// Changes made to a function in place after the first load: reshape changes the parameters, addOutput adds results
+// and operations. The operations are counted instead of compared, this is linear in the function size which is
+// negligible compared to the transformations
+std::string GetSignature(const ngraph::Function& function) {
+    std::ostringstream signature;
+    for (const auto& parameter : function.get_parameters()) {
+        signature << parameter->get_friendly_name() << ':' << parameter->get_element_type() << ':'
+                  << parameter->get_partial_shape() << ';';
+    }
+    signature << function.get_results().size() << ';' << function.get_ops().size();
+    return signature.str();
+}
+
+}  // namespace
+
+std::shared_ptr<const ngraph::Function> TransformationsCache::Get(
+        const std::shared_ptr<const ngraph::Function>& original, const Transform& transform) {
+    const auto signature = GetSignature(*original);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.erase(std::remove_if(_entries.begin(), _entries.end(), [] (const Entry& entry) {
+            return entry._original.expired();
+        }), _entries.end());
+        for (const auto& entry : _entries) {
+            if (entry._original.lock() == original && entry._signature == signature) {
+                return entry._transformed;
+            }
+        }
+    }
+
+    auto transformed = transform();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& entry : _entries) {
+        if (entry._original.lock() == original) {
+            // the function was changed since the previous load, the previous result is not needed any more
+            entry._signature = signature;
+            entry._transformed = transformed;
+            return transformed;
+        }
+    }
+    _entries.push_back({original, signature, transformed});
+    return transformed;
+}
+
+void TransformationsCache::Clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+}
+
+}  // namespace InferenceEngine
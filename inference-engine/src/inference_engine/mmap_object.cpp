@@ -0,0 +1,154 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_object.hpp"
+
+#include <details/os/os_filesystem.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+#ifdef _WIN32
+
+class MappedMemoryWin : public MappedMemory {
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+    char* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit MappedMemoryWin(const std::string& path) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+        _file = ::CreateFileW(multiByteCharToWString(path.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        _file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (_file == INVALID_HANDLE_VALUE) return;
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0) return;
+
+        _mapping = ::CreateFileMapping(_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (_mapping == nullptr) return;
+
+        _data = static_cast<char*>(::MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0));
+        if (_data != nullptr) {
+            _size = static_cast<size_t>(fileSize.QuadPart);
+        }
+    }
+
+    ~MappedMemoryWin() override {
+        if (_data != nullptr) ::UnmapViewOfFile(_data);
+        if (_mapping != nullptr) ::CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE) ::CloseHandle(_file);
+    }
+
+    bool valid() const noexcept {
+        return _data != nullptr;
+    }
+
+    char* data() noexcept override {
+        return _data;
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+};
+
+using MappedMemoryImpl = MappedMemoryWin;
+
+#else
+
+class MappedMemoryPosix : public MappedMemory {
+    char* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit MappedMemoryPosix(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) return;
+
+        struct stat sb = {};
+        if (::fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            // MAP_PRIVATE keeps pages shared until somebody writes into them
+            void* data = ::mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                _data = static_cast<char*>(data);
+                _size = static_cast<size_t>(sb.st_size);
+            }
+        }
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    ~MappedMemoryPosix() override {
+        if (_data != nullptr) ::munmap(_data, _size);
+    }
+
+    bool valid() const noexcept {
+        return _data != nullptr;
+    }
+
+    char* data() noexcept override {
+        return _data;
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+};
+
+using MappedMemoryImpl = MappedMemoryPosix;
+
+#endif
+
+/**
+ * @brief Holds the mapping while blob is alive
+ */
+class MappedBlob : public TBlob<uint8_t> {
+    MappedMemory::Ptr _memory;
+
+public:
+    explicit MappedBlob(const MappedMemory::Ptr& memory) :
+        TBlob<uint8_t>(TensorDesc(Precision::U8, {memory->size()}, Layout::C),
+                       reinterpret_cast<uint8_t*>(memory->data())),
+        _memory(memory) { }
+};
+
+}  // namespace
+
+MappedMemory::Ptr mapFile(const std::string& path) {
+    auto memory = std::make_shared<MappedMemoryImpl>(path);
+    if (!memory->valid()) {
+        return nullptr;
+    }
+    return memory;
+}
+
+Blob::Ptr make_mapped_blob(const MappedMemory::Ptr& memory) {
+    return std::make_shared<MappedBlob>(memory);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_dmabuf_blob.hpp"
+
+#include <linux/dma-buf.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// Maps the whole object at the first access of any of its planes, the planes share the mapping
+class DmaBufMapping {
+public:
+    DmaBufMapping(int fd, size_t size) : _fd(::dup(fd)), _size(size) {
+        if (_fd == -1) {
+            THROW_IE_EXCEPTION << "Failed to duplicate DMA-BUF descriptor " << fd;
+        }
+    }
+
+    ~DmaBufMapping() {
+        if (_data != nullptr) {
+            sync(DMA_BUF_SYNC_END);
+            ::munmap(_data, _size);
+        }
+        ::close(_fd);
+    }
+
+    uint8_t* data() noexcept {
+        std::call_once(_mapped, [this] {
+            void* data = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, _fd, 0);
+            if (data != MAP_FAILED) {
+                _data = static_cast<uint8_t*>(data);
+                // makes the device writes visible to the CPU, the objects which are not DMA-BUFs ignore it
+                sync(DMA_BUF_SYNC_START);
+            }
+        });
+        return _data;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+private:
+    void sync(uint64_t flags) noexcept {
+        struct dma_buf_sync sync = {};
+        sync.flags = flags | DMA_BUF_SYNC_READ;
+        ::ioctl(_fd, DMA_BUF_IOCTL_SYNC, &sync);
+    }
+
+    int _fd;
+    size_t _size;
+    uint8_t* _data = nullptr;
+    std::once_flag _mapped;
+};
+
+// Gives out a plane of the mapping, the memory stays mapped until all the planes are released
+class DmaBufPlaneAllocator : public IAllocator {
+public:
+    DmaBufPlaneAllocator(std::shared_ptr<DmaBufMapping> mapping, size_t offset) :
+        _mapping(std::move(mapping)), _offset(offset) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp) noexcept override {
+        if (handle != _mapping.get()) return nullptr;
+        auto data = _mapping->data();
+        return data == nullptr ? nullptr : data + _offset;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t) noexcept override {
+        return _mapping.get();
+    }
+
+    bool free(void* handle) noexcept override {
+        return handle == _mapping.get();
+    }
+
+private:
+    std::shared_ptr<DmaBufMapping> _mapping;
+    size_t _offset;
+};
+
+Blob::Ptr makePlane(const std::shared_ptr<DmaBufMapping>& mapping, const DmaBufPlane& plane,
+                    size_t height, size_t width, size_t channels) {
+    const auto rowSize = width * channels;
+    if (plane.pitch < rowSize || plane.offset + plane.pitch * (height - 1) + rowSize > mapping->size()) {
+        THROW_IE_EXCEPTION << "The plane at offset " << plane.offset << " with pitch " << plane.pitch
+                           << " does not fit into DMA-BUF object of size " << mapping->size();
+    }
+
+    // despite of layout, blob dimensions always follow in N,C,H,W order
+    // the rows of the plane are pitch bytes apart
+    BlockingDesc blocking({1, height, width, channels}, {0, 2, 3, 1}, 0, {0, 0, 0, 0},
+                          {plane.pitch * height, plane.pitch, channels, 1});
+    TensorDesc desc(Precision::U8, {1, channels, height, width}, blocking);
+
+    auto blob = make_shared_blob<uint8_t>(desc,
+        details::shared_from_irelease(new DmaBufPlaneAllocator(mapping, plane.offset)));
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace
+
+NV12Blob::Ptr make_shared_blob_nv12(size_t height, size_t width, int fd, size_t size,
+                                    const DmaBufPlane& y, const DmaBufPlane& uv) {
+    if (height == 0 || width == 0 || height % 2 != 0 || width % 2 != 0) {
+        THROW_IE_EXCEPTION << "Invalid NV12 image size " << width << "x" << height;
+    }
+
+    auto mapping = std::make_shared<DmaBufMapping>(fd, size);
+    return make_shared_blob<NV12Blob>(makePlane(mapping, y, height, width, 1),
+                                      makePlane(mapping, uv, height / 2, width / 2, 2));
+}
+
+}  // namespace InferenceEngine
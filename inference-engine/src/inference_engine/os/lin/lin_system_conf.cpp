@@ -2,12 +2,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <iostream>
 #include <sched.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
@@ -62,6 +72,7 @@ std::vector<int> getAvailableNUMANodes() {
 }
 #endif
 int getNumberOfCPUCores() {
+    const int quota = getCPUQuota();
     unsigned numberOfProcessors = cpu._processors;
     unsigned totalNumberOfCpuCores = cpu._cores;
     IE_ASSERT(totalNumberOfCpuCores != 0);
@@ -81,7 +92,294 @@ int getNumberOfCPUCores() {
             }
         }
     }
-    return CPU_COUNT(&currentCoreSet);
+    const int cores = CPU_COUNT(&currentCoreSet);
+    return (quota > 0) ? std::max(1, std::min(cores, quota)) : cores;
+}
+
+int getNumberOfAvailableCPUs() {
+    cpu_set_t currentCpuSet;
+    CPU_ZERO(&currentCpuSet);
+    const int processors = (0 == sched_getaffinity(0, sizeof(currentCpuSet), &currentCpuSet))
+                               ? CPU_COUNT(&currentCpuSet) : std::max(1, cpu._processors);
+    const int quota = getCPUQuota();
+    return (quota > 0) ? std::max(1, std::min(processors, quota)) : processors;
+}
+
+namespace {
+
+// the cgroup paths of the process by the controllers, the empty controller is the cgroup v2 unified hierarchy
+std::map<std::string, std::string> ReadProcessCgroups() {
+    std::map<std::string, std::string> cgroups;
+    std::ifstream file("/proc/self/cgroup");
+    std::string line;
+    // hierarchy-ID:controller-list:cgroup-path
+    while (std::getline(file, line)) {
+        const auto first = line.find(':');
+        const auto second = (first == std::string::npos) ? std::string::npos : line.find(':', first + 1);
+        if (second == std::string::npos) continue;
+        const auto path = line.substr(second + 1);
+        std::istringstream controllers(line.substr(first + 1, second - first - 1));
+        std::string controller;
+        if (first + 1 == second) {
+            cgroups[""] = path;
+        }
+        while (std::getline(controllers, controller, ',')) {
+            cgroups[controller] = path;
+        }
+    }
+    return cgroups;
+}
+
+// the first lines of the cgroup file from the process cgroup up to the root of the hierarchy mounted at the mount point.
+// A container usually mounts its own cgroup as the root, so the paths of the host hierarchy are skipped
+std::vector<std::string> ReadCgroupFiles(const std::string& mountPoint, std::string path, const std::string& name) {
+    std::vector<std::string> values;
+    while (true) {
+        std::ifstream file(mountPoint + path + "/" + name);
+        std::string value;
+        if (std::getline(file, value)) {
+            values.push_back(value);
+        }
+        if (path.empty() || path == "/") break;
+        path = path.substr(0, path.rfind('/'));
+    }
+    return values;
+}
+
+double ReadCgroupCpuQuota() {
+    const auto cgroups = ReadProcessCgroups();
+    double quota = 0.0;
+    auto update = [&quota] (double runtime, double period) {
+        if (runtime > 0.0 && period > 0.0 && (0.0 == quota || runtime / period < quota)) {
+            quota = runtime / period;
+        }
+    };
+    auto unified = cgroups.find("");
+    if (unified != cgroups.end()) {
+        // "$MAX $PERIOD", $MAX is "max" if the CPU time is not limited
+        for (auto&& value : ReadCgroupFiles("/sys/fs/cgroup", unified->second, "cpu.max")) {
+            std::istringstream stream(value);
+            std::string runtime;
+            double period = 0.0;
+            stream >> runtime >> period;
+            if (runtime != "max") {
+                update(std::atof(runtime.c_str()), period);
+            }
+        }
+    }
+    auto cpu = cgroups.find("cpu");
+    if (cpu != cgroups.end()) {
+        for (auto&& mountPoint : {"/sys/fs/cgroup/cpu,cpuacct", "/sys/fs/cgroup/cpu"}) {
+            // the quota is -1 if the CPU time is not limited
+            const auto runtimes = ReadCgroupFiles(mountPoint, cpu->second, "cpu.cfs_quota_us");
+            const auto periods = ReadCgroupFiles(mountPoint, cpu->second, "cpu.cfs_period_us");
+            for (size_t i = 0; i < std::min(runtimes.size(), periods.size()); i++) {
+                update(std::atof(runtimes[i].c_str()), std::atof(periods[i].c_str()));
+            }
+            if (!runtimes.empty()) break;
+        }
+    }
+    return quota;
+}
+
+size_t ReadCgroupMemoryLimit() {
+    const auto cgroups = ReadProcessCgroups();
+    size_t limit = 0;
+    auto update = [&limit] (const std::string& value) {
+        const auto bytes = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        if (bytes > 0 && (0 == limit || bytes < limit)) {
+            limit = bytes;
+        }
+    };
+    auto unified = cgroups.find("");
+    if (unified != cgroups.end()) {
+        for (auto&& value : ReadCgroupFiles("/sys/fs/cgroup", unified->second, "memory.max")) {
+            if (value != "max") update(value);
+        }
+    }
+    auto memory = cgroups.find("memory");
+    if (memory != cgroups.end()) {
+        // an unlimited cgroup v1 reports a huge number which is cut by the physical memory
+        for (auto&& value : ReadCgroupFiles("/sys/fs/cgroup/memory", memory->second, "memory.limit_in_bytes")) {
+            update(value);
+        }
+    }
+    return limit;
+}
+
+}  // namespace
+
+int getCPUQuota() {
+    static const double quota = ReadCgroupCpuQuota();
+    return (quota > 0.0) ? std::max(1, static_cast<int>(std::ceil(quota))) : 0;
+}
+
+size_t getAvailableMemory() {
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long pageSize = sysconf(_SC_PAGE_SIZE);
+    const size_t physical = (pages > 0 && pageSize > 0) ? static_cast<size_t>(pages) * static_cast<size_t>(pageSize) : 0;
+    static const size_t limit = ReadCgroupMemoryLimit();
+    if (0 == limit) return physical;
+    return (0 == physical) ? limit : std::min(physical, limit);
+}
+
+namespace {
+
+// parses cpu lists of sysfs, e.g. "0-3,8,10-11"
+std::vector<int> ReadCpuList(const std::string& path) {
+    std::ifstream file(path);
+    std::string list;
+    std::vector<int> cpus;
+    if (!std::getline(file, list)) {
+        return cpus;
+    }
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        try {
+            auto dash = range.find('-');
+            auto first = std::stoi(range.substr(0, dash));
+            auto last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (auto cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+// the hybrid PMUs of Linux 5.13+ list the processors of every core type
+bool ReadCoreTypesFromSysfs(std::set<int>& big, std::set<int>& little) {
+    auto bigCpus = ReadCpuList("/sys/devices/cpu_core/cpus");
+    auto littleCpus = ReadCpuList("/sys/devices/cpu_atom/cpus");
+    if (bigCpus.empty() || littleCpus.empty()) {
+        return false;
+    }
+    big.insert(bigCpus.begin(), bigCpus.end());
+    little.insert(littleCpus.begin(), littleCpus.end());
+    return true;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// CPUID leaf 0x1A tells the type of the core the code runs on, so a helper thread visits every processor
+bool ReadCoreTypesFromCpuid(std::set<int>& big, std::set<int>& little) {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    // the hybrid flag is EDX bit 15 of leaf 7
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 15))) {
+        return false;
+    }
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+    if (0 != sched_getaffinity(0, sizeof(processMask), &processMask)) {
+        return false;
+    }
+    bool ok = true;
+    std::thread worker([&] {
+        for (int processor = 0; processor < CPU_SETSIZE && ok; ++processor) {
+            if (!CPU_ISSET(processor, &processMask)) continue;
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            CPU_SET(processor, &mask);
+            unsigned int a = 0, b = 0, c = 0, d = 0;
+            if (0 != sched_setaffinity(0, sizeof(mask), &mask) || !__get_cpuid_count(0x1A, 0, &a, &b, &c, &d)) {
+                ok = false;
+                break;
+            }
+            // the core type is EAX bits 31-24: 0x40 is a Core, 0x20 is an Atom
+            const auto coreType = a >> 24;
+            if (0x40 == coreType) {
+                big.insert(processor);
+            } else if (0x20 == coreType) {
+                little.insert(processor);
+            }
+        }
+    });
+    worker.join();
+    return ok && !big.empty() && !little.empty();
+}
+#else
+bool ReadCoreTypesFromCpuid(std::set<int>&, std::set<int>&) {
+    return false;
+}
+#endif
+
+struct HybridCores {
+    std::vector<std::vector<int>> _big;
+    std::vector<std::vector<int>> _little;
+
+    HybridCores() {
+        std::set<int> big, little;
+        if (!ReadCoreTypesFromSysfs(big, little)) {
+            big.clear();
+            little.clear();
+            if (!ReadCoreTypesFromCpuid(big, little)) {
+                return;
+            }
+        }
+        cpu_set_t processMask;
+        CPU_ZERO(&processMask);
+        if (0 != sched_getaffinity(0, sizeof(processMask), &processMask)) {
+            return;
+        }
+        // processors of a core are its hyper-threading siblings
+        std::map<int, std::vector<int>> cores;
+        std::set<int> processors;
+        processors.insert(big.begin(), big.end());
+        processors.insert(little.begin(), little.end());
+        for (auto processor : processors) {
+            if (processor >= CPU_SETSIZE || !CPU_ISSET(processor, &processMask)) continue;
+            auto siblings = ReadCpuList("/sys/devices/system/cpu/cpu" + std::to_string(processor) +
+                                        "/topology/thread_siblings_list");
+            auto coreId = siblings.empty() ? processor : *std::min_element(siblings.begin(), siblings.end());
+            cores[coreId].push_back(processor);
+        }
+        for (auto&& core : cores) {
+            (big.count(core.first) || big.count(core.second.front()) ? _big : _little).push_back(core.second);
+        }
+        if (_big.empty() || _little.empty()) {
+            _big.clear();
+            _little.clear();
+        }
+    }
+};
+
+}  // namespace
+
+std::vector<std::vector<int>> getAvailableCores(CPUCoreType type) {
+    static HybridCores hybridCores;
+    return CPUCoreType::BIG == type ? hybridCores._big : hybridCores._little;
+}
+
+std::vector<int> getCoreSiblings(int processor) {
+    auto siblings = ReadCpuList("/sys/devices/system/cpu/cpu" + std::to_string(processor) +
+                                "/topology/thread_siblings_list");
+    if (std::find(siblings.begin(), siblings.end(), processor) == siblings.end()) {
+        return {processor};
+    }
+    std::sort(siblings.begin(), siblings.end());
+    return siblings;
+}
+
+size_t getPeakMemoryUsage() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (0 == line.find("VmHWM:")) {
+            // the value is in kB
+            return static_cast<size_t>(std::stoull(line.substr(line.find(':') + 1))) * 1024;
+        }
+    }
+    return 0;
+}
+
+bool resetPeakMemoryUsage() {
+    // "5" resets the high-water mark of the resident set size (Linux 4.0+)
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    clearRefs.close();
+    return !clearRefs.fail();
 }
 
 }  // namespace InferenceEngine
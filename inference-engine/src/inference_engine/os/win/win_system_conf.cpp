@@ -3,7 +3,10 @@
 //
 
 #include <windows.h>
+#include <psapi.h>
+#include <algorithm>
 #include <memory>
+#include <thread>
 #include <vector>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
@@ -31,6 +34,90 @@ int getNumberOfCPUCores() {
     return phys_cores;
 }
 
+namespace {
+
+struct HybridCores {
+    std::vector<std::vector<int>> _big;
+    std::vector<std::vector<int>> _little;
+
+    HybridCores() {
+        DWORD sz = 0;
+        if (GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &sz) ||
+            GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            return;
+        std::unique_ptr<uint8_t[]> ptr(new uint8_t[sz]);
+        if (!GetLogicalProcessorInformationEx(RelationProcessorCore,
+                reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(ptr.get()), &sz))
+            return;
+
+        // a hybrid CPU has cores of several efficiency classes, the highest class is the most performant one
+        std::vector<std::pair<BYTE, std::vector<int>>> cores;
+        for (size_t offset = 0; offset < sz;) {
+            auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(ptr.get() + offset);
+            std::vector<int> processors;
+            for (WORD group = 0; group < info->Processor.GroupCount; ++group) {
+                const auto& groupMask = info->Processor.GroupMask[group];
+                for (int bit = 0; bit < static_cast<int>(sizeof(KAFFINITY) * 8); ++bit) {
+                    if (groupMask.Mask & (static_cast<KAFFINITY>(1) << bit)) {
+                        processors.push_back(groupMask.Group * static_cast<int>(sizeof(KAFFINITY) * 8) + bit);
+                    }
+                }
+            }
+            cores.emplace_back(info->Processor.EfficiencyClass, processors);
+            offset += info->Size;
+        }
+        if (cores.empty()) return;
+        auto bigClass = std::max_element(cores.begin(), cores.end())->first;
+        for (auto&& core : cores) {
+            (core.first == bigClass ? _big : _little).push_back(core.second);
+        }
+        if (_little.empty()) {
+            _big.clear();
+        }
+    }
+};
+
+}  // namespace
+
+std::vector<std::vector<int>> getAvailableCores(CPUCoreType type) {
+    static HybridCores hybridCores;
+    return CPUCoreType::BIG == type ? hybridCores._big : hybridCores._little;
+}
+
+std::vector<int> getCoreSiblings(int processor) {
+    // the threads are not pinned to the processors on Windows
+    return {processor};
+}
+
+int getNumberOfAvailableCPUs() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+int getCPUQuota() {
+    // the CPU rate limits of the job objects are not taken into account
+    return 0;
+}
+
+size_t getAvailableMemory() {
+    MEMORYSTATUSEX status = {};
+    status.dwLength = sizeof(status);
+    if (!GlobalMemoryStatusEx(&status))
+        return 0;
+    return static_cast<size_t>(status.ullTotalPhys);
+}
+
+size_t getPeakMemoryUsage() {
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+}
+
+bool resetPeakMemoryUsage() {
+    // the peak working set cannot be reset
+    return false;
+}
+
 #if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 // OMP/SEQ threading on the Windows doesn't support NUMA
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
@@ -4,14 +4,165 @@
 
 #include "system_allocator.hpp"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace InferenceEngine {
 
+namespace {
+
+std::mutex& DefaultAllocatorMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::shared_ptr<IAllocator>& DefaultAllocator() {
+    static std::shared_ptr<IAllocator> allocator;
+    return allocator;
+}
+
+// Forwards to a shared allocator, each blob releases its own instance
+class SharedAllocator : public IAllocator {
+public:
+    explicit SharedAllocator(std::shared_ptr<IAllocator> allocator) : _allocator(std::move(allocator)) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp op = LOCK_FOR_WRITE) noexcept override {
+        return _allocator->lock(handle, op);
+    }
+
+    void unlock(void* handle) noexcept override {
+        _allocator->unlock(handle);
+    }
+
+    void* alloc(size_t size) noexcept override {
+        return _allocator->alloc(size);
+    }
+
+    bool free(void* handle) noexcept override {
+        return _allocator->free(handle);
+    }
+
+private:
+    std::shared_ptr<IAllocator> _allocator;
+};
+
+// Keeps the freed handles by their sizes and gives them out again instead of allocating the memory
+class PooledAllocator : public IAllocator {
+public:
+    PooledAllocator(std::shared_ptr<IAllocator> upstream, size_t capacity) :
+        _upstream(std::move(upstream)), _capacity(capacity) {}
+
+    ~PooledAllocator() override {
+        for (auto& handles : _freeHandles) {
+            for (auto handle : handles.second) {
+                _upstream->free(handle);
+            }
+        }
+    }
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp op = LOCK_FOR_WRITE) noexcept override {
+        return _upstream->lock(handle, op);
+    }
+
+    void unlock(void* handle) noexcept override {
+        _upstream->unlock(handle);
+    }
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto handles = _freeHandles.find(size);
+                if (handles != _freeHandles.end() && !handles->second.empty()) {
+                    auto handle = handles->second.back();
+                    handles->second.pop_back();
+                    _freeBytes -= size;
+                    _sizes[handle] = size;
+                    return handle;
+                }
+            }
+            auto handle = _upstream->alloc(size);
+            if (handle != nullptr) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _sizes[handle] = size;
+            }
+            return handle;
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr) {
+            return true;
+        }
+        try {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto size = _sizes.find(handle);
+            if (size == _sizes.end()) {
+                return false;
+            }
+            if (_freeBytes + size->second <= _capacity) {
+                _freeHandles[size->second].push_back(handle);
+                _freeBytes += size->second;
+                _sizes.erase(size);
+                return true;
+            }
+            _sizes.erase(size);
+        } catch (...) {
+        }
+        return _upstream->free(handle);
+    }
+
+private:
+    std::shared_ptr<IAllocator> _upstream;
+    size_t _capacity;
+    std::mutex _mutex;
+    std::unordered_map<void*, size_t> _sizes;
+    std::unordered_map<size_t, std::vector<void*>> _freeHandles;
+    size_t _freeBytes = 0;
+};
+
+}  // namespace
+
 IAllocator* CreateDefaultAllocator() noexcept {
     try {
+        std::shared_ptr<IAllocator> allocator;
+        {
+            std::lock_guard<std::mutex> lock(DefaultAllocatorMutex());
+            allocator = DefaultAllocator();
+        }
+        if (allocator != nullptr) {
+            return new SharedAllocator(std::move(allocator));
+        }
         return new SystemMemoryAllocator();
     } catch (...) {
         return nullptr;
     }
 }
 
+void SetDefaultAllocator(const std::shared_ptr<IAllocator>& allocator) noexcept {
+    std::lock_guard<std::mutex> lock(DefaultAllocatorMutex());
+    DefaultAllocator() = allocator;
+}
+
+IAllocator* CreatePooledAllocator(const std::shared_ptr<IAllocator>& upstream, size_t capacity) noexcept {
+    try {
+        return new PooledAllocator(upstream != nullptr ? upstream : std::make_shared<SystemMemoryAllocator>(), capacity);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_cpu_resource_manager.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+CPUResourceManager::Share::~Share() {
+    _manager->Unregister(this);
+}
+
+void CPUResourceManager::Share::Update() {
+    std::lock_guard<std::mutex> lock(_manager->_mutex);
+    _manager->Rebalance();
+}
+
+CPUResourceManager::Share::Ptr CPUResourceManager::Register(const IStreamsExecutor::Config& config,
+                                                            std::function<bool()> isActive,
+                                                            std::function<void()> onChange) {
+    Share::Ptr share{new Share};
+    share->_manager = this;
+    share->_streams = std::max(1, config._streams);
+    share->_threadsPerStream = std::max(1, config._threadsPerStream);
+    share->_priority = std::max(1, config._priority);
+    share->_isActive = std::move(isActive);
+    share->_onChange = std::move(onChange);
+    share->_allowedStreams = share->_streams;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shares.push_back(share.get());
+    Rebalance();
+    return share;
+}
+
+void CPUResourceManager::Unregister(Share* share) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shares.erase(std::remove(_shares.begin(), _shares.end(), share), _shares.end());
+    Rebalance();
+}
+
+void CPUResourceManager::SetBudget(int threads) {
+    if (threads < 0) {
+        THROW_IE_EXCEPTION << "CPU threads budget must be non negative, got " << threads;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = threads;
+    Rebalance();
+}
+
+int CPUResourceManager::GetBudget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _budget;
+}
+
+void CPUResourceManager::Rebalance() {
+    std::vector<int> allowed(_shares.size());
+    if (_budget == 0) {
+        for (size_t i = 0; i < _shares.size(); i++) {
+            allowed[i] = _shares[i]->_streams;
+        }
+    } else {
+        // weighted max-min fair division of the threads between the active executors: the executors which need
+        // less than their part get all they need, and the rest is divided again between the others
+        std::vector<size_t> unsatisfied;
+        std::vector<double> threads(_shares.size(), 0.0);
+        for (size_t i = 0; i < _shares.size(); i++) {
+            if (_shares[i]->_isActive())
+                unsatisfied.push_back(i);
+        }
+        double remaining = _budget;
+        while (!unsatisfied.empty() && remaining > 0.0) {
+            double weights = 0.0;
+            for (auto i : unsatisfied) {
+                weights += _shares[i]->_priority;
+            }
+            std::vector<size_t> next;
+            double given = 0.0;
+            for (auto i : unsatisfied) {
+                const double demand = _shares[i]->_streams * _shares[i]->_threadsPerStream;
+                const double part = remaining * _shares[i]->_priority / weights;
+                if (demand - threads[i] <= part) {
+                    given += demand - threads[i];
+                    threads[i] = demand;
+                } else {
+                    next.push_back(i);
+                }
+            }
+            if (next.size() == unsatisfied.size()) {
+                for (auto i : unsatisfied) {
+                    threads[i] += remaining * _shares[i]->_priority / weights;
+                }
+                break;
+            }
+            remaining -= given;
+            unsatisfied = std::move(next);
+        }
+
+        int used = 0;
+        for (size_t i = 0; i < _shares.size(); i++) {
+            if (!_shares[i]->_isActive())
+                continue;
+            allowed[i] = std::max(1, std::min(_shares[i]->_streams,
+                                              static_cast<int>(threads[i] / _shares[i]->_threadsPerStream)));
+            used += allowed[i] * _shares[i]->_threadsPerStream;
+        }
+        // idle executors may borrow the threads left by the active ones to start their next tasks
+        const int spare = std::max(0, _budget - used);
+        for (size_t i = 0; i < _shares.size(); i++) {
+            if (allowed[i] == 0) {
+                allowed[i] = std::max(1, std::min(_shares[i]->_streams, spare / _shares[i]->_threadsPerStream));
+            }
+        }
+    }
+
+    for (size_t i = 0; i < _shares.size(); i++) {
+        auto share = _shares[i];
+        if (share->_allowedStreams.exchange(allowed[i]) != allowed[i] && share->_onChange) {
+            share->_onChange();
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -21,9 +21,21 @@
 #include "details/ie_exception.hpp"
 #include "ie_util_internal.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
+#include "threading/ie_mpmc_queue.hpp"
+#include "threading/ie_priority_task_queue.hpp"
+#include "threading/ie_task_queue_counters.hpp"
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    /**
+     * @brief Capacity of a per-thread lock-free queue. Tasks which do not fit go to the shared overflow queue
+     */
+    static constexpr std::size_t threadQueueCapacity = 256;
+    /**
+     * @brief Number of attempts to find a task before a thread goes to sleep on the condition variable
+     */
+    static constexpr int spinCount = 1000;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public tbb::task_scheduler_observer {
@@ -34,15 +46,13 @@ struct CPUStreamsExecutor::Impl {
             Observer(tbb::task_arena&    arena,
                      CpuSet              mask,
                      int                 ncpus,
-                     const int           streamId,
-                     const int           threadsPerStream,
                      const int           threadBindingStep,
-                     const int           threadBindingOffset) :
+                     const int           offset) :
                 tbb::task_scheduler_observer(arena),
                 _mask{std::move(mask)},
                 _ncpus(ncpus),
                 _threadBindingStep(threadBindingStep),
-                _offset{streamId * threadsPerStream  + threadBindingOffset} {
+                _offset{offset} {
             }
             void on_scheduler_entry(bool) override {
                 PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
@@ -64,57 +74,95 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_usedNumaNodes.at(
-                (_streamId % _impl->_config._streams)/
-                ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()));
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
+            const auto threadsPerStream = _impl->_config.GetThreadsPerStream(_streamId);
+            // the explicit CPU lists take the place of the binding type
+            const auto bindingType = _impl->_config._streamsCpuLists.empty()
+                                     ? _impl->_config._threadBindingType : ThreadBindingType::CORES;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
-            auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
-            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+            auto concurrency = (0 == threadsPerStream) ? tbb::task_arena::automatic : threadsPerStream;
+            if (ThreadBindingType::NUMA == bindingType) {
                 _taskArena.reset(new tbb::task_arena{tbb::task_arena::constraints{_numaNodeId, concurrency}});
-            } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
+            } else if ((0 != threadsPerStream) || (ThreadBindingType::CORES == bindingType)) {
                 _taskArena.reset(new tbb::task_arena{concurrency});
-                if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
-                    CpuSet processMask;
+                if (ThreadBindingType::CORES == bindingType) {
+                    CpuSet mask;
                     int    ncpus = 0;
-                    std::tie(processMask, ncpus) = GetProcessMask();
-                    if (nullptr != processMask) {
-                        _observer.reset(new Observer{*_taskArena,
-                                                     std::move(processMask),
-                                                     ncpus,
-                                                     _streamId,
-                                                     _impl->_config._threadsPerStream,
-                                                     _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
+                    int    step = 0;
+                    int    offset = 0;
+                    std::tie(mask, ncpus, step, offset) = GetCoresBinding(threadsPerStream);
+                    if (nullptr != mask) {
+                        _observer.reset(new Observer{*_taskArena, std::move(mask), ncpus, step, offset});
                         _observer->observe(true);
                     }
                 }
             }
 #elif IE_THREAD == IE_THREAD_OMP
-            omp_set_num_threads(_impl->_config._threadsPerStream);
-            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
-                CpuSet processMask;
+            omp_set_num_threads(threadsPerStream);
+            if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != bindingType)) {
+                CpuSet mask;
                 int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
-                if (nullptr != processMask) {
-                    parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
-                        int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
-                        PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+                int    step = 0;
+                int    offset = 0;
+                std::tie(mask, ncpus, step, offset) = GetCoresBinding(threadsPerStream);
+                if (nullptr != mask) {
+                    parallel_nt(threadsPerStream, [&] (int threadIndex, int) {
+                        PinThreadToVacantCore(offset + threadIndex, step, ncpus, mask);
                     });
                 }
             }
 #elif IE_THREAD == IE_THREAD_SEQ
-            if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+            if (ThreadBindingType::NUMA == bindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
-            } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
-                CpuSet processMask;
+            } else if (ThreadBindingType::CORES == bindingType) {
+                CpuSet mask;
                 int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
-                if (nullptr != processMask) {
-                    PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
+                int    step = 0;
+                int    offset = 0;
+                std::tie(mask, ncpus, step, offset) = GetCoresBinding(1);
+                if (nullptr != mask) {
+                    PinThreadToVacantCore(offset, step, ncpus, mask);
                 }
             }
 #endif
         }
+
+        // Returns the mask the threads of the stream are pinned within, its size, the binding step and
+        // the index of the first thread of the stream in the mask. The streams sharing an explicit CPU list
+        // fill it from its first processor. On a hybrid CPU the first streams run on the big cores and the
+        // rest on the little ones, each type is filled from its first core. The reserved processors and the
+        // dropped hyper-threading siblings are never in the mask.
+        std::tuple<CpuSet, int, int, int> GetCoresBinding(const int threadsPerStream) const {
+            const auto& config = _impl->_config;
+            CpuSet processMask;
+            int    ncpus = 0;
+            std::tie(processMask, ncpus) = GetProcessMask();
+            const auto list = config.GetStreamCpuListIndex(_streamId);
+            if (nullptr != processMask && list >= 0) {
+                auto listMask = GetCpuListMask(config._streamsCpuLists[list], config._reservedCpus,
+                                               config._bindToSmtSiblings, ncpus, processMask);
+                if (nullptr != listMask) {
+                    return std::make_tuple(std::move(listMask), ncpus, 1,
+                                           config.GetStreamIndexInCpuList(_streamId) * threadsPerStream);
+                }
+            }
+            if (nullptr != processMask && (!config._reservedCpus.empty() || !config._bindToSmtSiblings)) {
+                auto allowedMask = GetCpuListMask({}, config._reservedCpus, config._bindToSmtSiblings, ncpus, processMask);
+                if (nullptr != allowedMask) {
+                    processMask = std::move(allowedMask);
+                }
+            }
+            if (nullptr != processMask && _impl->_config._bigCoreStreams > 0) {
+                const bool big = _streamId < _impl->_config._bigCoreStreams;
+                auto typeMask = GetCoreTypeMask(big ? CPUCoreType::BIG : CPUCoreType::LITTLE, ncpus, processMask);
+                if (nullptr != typeMask) {
+                    const auto index = big ? _streamId : _streamId - _impl->_config._bigCoreStreams;
+                    return std::make_tuple(std::move(typeMask), ncpus, 1, index * threadsPerStream);
+                }
+            }
+            return std::make_tuple(std::move(processMask), ncpus, _impl->_config._threadBindingStep,
+                                   _streamId * threadsPerStream + _impl->_config._threadBindingOffset);
+        }
         ~Stream() {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
@@ -138,44 +186,180 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
-    explicit Impl(const Config& config) :
+    Impl(const Config& config, CPUResourceManager* resourceManager) :
         _config{config},
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
-        }) {
+        }),
+        _busyTimes(std::max(0, config._streams)) {
+        if (nullptr != resourceManager && _config._streams > 0) {
+            _share = resourceManager->Register(_config,
+                [this] { return _activeTasks.load() > 0; },
+                [this] {
+                    // more streams may be allowed, the sleeping threads re-check it
+                    { std::lock_guard<std::mutex> lock(_mutex); }
+                    _queueCondVar.notify_all();
+                });
+        }
         auto numaNodes = getAvailableNUMANodes();
         std::copy_n(std::begin(numaNodes),
                     std::min(std::max(static_cast<std::size_t>(1),
                                       static_cast<std::size_t>(_config._streams)),
                              numaNodes.size()),
                     std::back_inserter(_usedNumaNodes));
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _threadQueues.emplace_back(new BoundedMPMCQueue<Task>{threadQueueCapacity});
+        }
+        // Every thread looks for work in its own queue first, then steals from threads of the same NUMA node
+        // and only then from the rest, so tasks tend to stay on the node they were scheduled to
+        _stealingOrders.resize(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            auto& order = _stealingOrders[streamId];
+            for (auto i = 0; i < _config._streams; ++i) {
+                auto victim = (streamId + i) % _config._streams;
+                if (GetNumaNodeId(victim) == GetNumaNodeId(streamId)) {
+                    order.push_back(victim);
+                }
+            }
+            for (auto i = 1; i < _config._streams; ++i) {
+                auto victim = (streamId + i) % _config._streams;
+                if (GetNumaNodeId(victim) != GetNumaNodeId(streamId)) {
+                    order.push_back(victim);
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                    // the busy waiting threads sleep only to stop
+                    for (int spin = 0; spin < spinCount && !task && !_isStopped; spin += _config._busyWait ? 0 : 1) {
+                        if (!TryGetAllowedTask(streamId, task)) {
+                            std::this_thread::yield();
                         }
                     }
+                    if (!task) {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        ++_sleepingThreads;
+                        _queueCondVar.wait(lock, [&] {
+                            return (_pendingTasks.load() > 0 && IsStreamAllowed()) || (stopped = _isStopped);
+                        });
+                        --_sleepingThreads;
+                    }
+                    if (!task && !stopped) {
+                        TryGetAllowedTask(streamId, task);
+                    }
                     if (task) {
+                        const auto started = TaskQueueCounters::Now();
+                        _counters.Started(started);
                         Execute(task, *(_streams.local()));
+                        _busyTimes[streamId].fetch_add(TaskQueueCounters::Now() - started, std::memory_order_relaxed);
+                        FinishTask();
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
-        {
+    int GetNumaNodeId(int streamId) const {
+        return _usedNumaNodes.at(
+            (streamId % _config._streams)/
+            ((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size()));
+    }
+
+    // prioritized tasks go before the default ones, and the tasks with a negative priority after them
+    bool TryGetTask(int streamId, Task& task) {
+        if (!_priorityTasks.empty() && _priorityTasks.try_pop(task, 0)) {
+            --_pendingTasks;
+            return true;
+        }
+        for (auto victim : _stealingOrders[streamId]) {
+            if (_threadQueues[victim]->try_pop(task)) {
+                --_pendingTasks;
+                if (victim != streamId) {
+                    _counters.Stolen();
+                }
+                return true;
+            }
+        }
+        if (_overflowSize.load(std::memory_order_relaxed) > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_overflowSize;
+                --_pendingTasks;
+                return true;
+            }
+        }
+        if (!_priorityTasks.empty() && _priorityTasks.try_pop(task)) {
+            --_pendingTasks;
+            return true;
+        }
+        return false;
+    }
+
+    bool IsStreamAllowed() const {
+        return nullptr == _share || _runningStreams.load() < _share->GetAllowedStreams();
+    }
+
+    // takes a task only if the share of the CPU threads budget allows one more stream to run
+    bool TryGetAllowedTask(int streamId, Task& task) {
+        if (nullptr == _share) {
+            return TryGetTask(streamId, task);
+        }
+        auto running = _runningStreams.load();
+        do {
+            if (running >= _share->GetAllowedStreams()) {
+                return false;
+            }
+        } while (!_runningStreams.compare_exchange_weak(running, running + 1));
+        if (TryGetTask(streamId, task)) {
+            return true;
+        }
+        --_runningStreams;
+        return false;
+    }
+
+    void FinishTask() {
+        if (nullptr == _share) {
+            return;
+        }
+        --_runningStreams;
+        if (_activeTasks.fetch_sub(1) == 1) {
+            _share->Update();
+        }
+        // a thread throttled by the share may take the next task now
+        if (_pendingTasks.load() > 0 && _sleepingThreads.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    void Enqueue(Task task, const TaskPriority& priority = {}) {
+        if (nullptr != _share && _activeTasks.fetch_add(1) == 0) {
+            _share->Update();
+        }
+        _counters.Queued();
+        if (!priority.IsDefault()) {
+            _priorityTasks.push(std::move(task), priority);
+        } else {
+            auto queueIdx = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _threadQueues.size();
+            // the task is moved from only if the lock-free queue accepted it
+            if (!_threadQueues[queueIdx]->try_push(std::move(task))) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _taskQueue.emplace(std::move(task));
+                ++_overflowSize;
+            }
+        }
+        ++_pendingTasks;
+        // Sleeping threads register themselves under the mutex and then re-check _pendingTasks,
+        // so taking the mutex here guarantees that the notification is not lost
+        if (_sleepingThreads.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -214,9 +398,22 @@ struct CPUStreamsExecutor::Impl {
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
     std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::atomic<bool>                       _isStopped{false};
+    std::vector<std::unique_ptr<BoundedMPMCQueue<Task>>> _threadQueues;
+    std::vector<std::vector<int>>           _stealingOrders;
+    std::atomic<std::size_t>                _nextQueue{0};
+    std::atomic<int>                        _pendingTasks{0};
+    std::atomic<int>                        _overflowSize{0};
+    PriorityTaskQueue                       _priorityTasks;
+    std::atomic<int>                        _sleepingThreads{0};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
+    std::atomic<int>                        _activeTasks{0};
+    std::atomic<int>                        _runningStreams{0};
+    CPUResourceManager::Share::Ptr          _share;
+    TaskQueueCounters                       _counters;
+    std::vector<std::atomic<std::uint64_t>> _busyTimes;
+    const std::uint64_t                     _created = TaskQueueCounters::Now();
 };
 
 
@@ -225,13 +422,25 @@ int CPUStreamsExecutor::GetStreamId() {
     return stream->_streamId;
 }
 
+TaskExecutorStatistics CPUStreamsExecutor::GetStatistics() const {
+    TaskExecutorStatistics statistics;
+    _impl->_counters.Fill(statistics);
+    const auto lifetime = TaskQueueCounters::Now() - _impl->_created;
+    for (auto&& busyTime : _impl->_busyTimes) {
+        const auto busy = std::min(lifetime, busyTime.load(std::memory_order_relaxed));
+        statistics._busyTime.push_back(busy);
+        statistics._idleTime.push_back(lifetime - busy);
+    }
+    return statistics;
+}
+
 int CPUStreamsExecutor::GetNumaNodeId() {
     auto stream = _impl->_streams.local();
     return stream->_numaNodeId;
 }
 
-CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
-    _impl{new Impl{config}} {
+CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config, CPUResourceManager* resourceManager) :
+    _impl{new Impl{config, resourceManager}} {
 }
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
@@ -245,6 +454,8 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
             thread.join();
         }
     }
+    // the manager does not call the executor after that
+    _impl->_share.reset();
 }
 
 void CPUStreamsExecutor::Execute(Task task) {
@@ -259,4 +470,12 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::runWithPriority(Task task, const TaskPriority& priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
 }  // namespace InferenceEngine
@@ -35,10 +35,14 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._priority == config._priority &&
+            executorConfig._bigCoreStreams == config._bigCoreStreams &&
+            executorConfig._threadsPerLittleCoreStream == config._threadsPerLittleCoreStream &&
+            executorConfig._busyWait == config._busyWait)
             return executor;
     }
-    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config, &cpuResourceManager);
     cpuStreamsExecutors.emplace_back(std::make_pair(config, newExec));
     return newExec;
 }
@@ -53,6 +57,10 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() {
     return cpuStreamsExecutors.size();
 }
 
+CPUResourceManager& ExecutorManagerImpl::getCPUResourceManager() {
+    return cpuResourceManager;
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
@@ -131,4 +139,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+CPUResourceManager& ExecutorManager::getCPUResourceManager() {
+    return _impl.getCPUResourceManager();
+}
+
 }  // namespace InferenceEngine
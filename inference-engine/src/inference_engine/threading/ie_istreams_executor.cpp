@@ -9,13 +9,92 @@
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #include "ie_parameter.hpp"
+#include "threading/ie_thread_affinity.hpp"
 #include <string>
 #include <algorithm>
+#include <sstream>
 #include <vector>
 #include <thread>
 
 
 namespace InferenceEngine {
+namespace {
+// parses the sysfs format of CPU lists, e.g. "0-3,8,10-11"
+std::vector<int> ParseCpuList(const std::string& key, const std::string& value) {
+    std::vector<int> cpus;
+    std::istringstream ranges(value);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        int first = 0, last = 0;
+        try {
+            std::size_t end = 0;
+            const auto dash = range.find('-');
+            first = std::stoi(range.substr(0, dash), &end);
+            if (end != (dash == std::string::npos ? range.size() : dash)) {
+                throw std::invalid_argument(range);
+            }
+            last = first;
+            if (dash != std::string::npos) {
+                last = std::stoi(range.substr(dash + 1), &end);
+                if (end != range.size() - dash - 1) {
+                    throw std::invalid_argument(range);
+                }
+            }
+        } catch (const std::exception&) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key
+                               << ". Expected CPU lists like 0-3,8";
+        }
+        if (first < 0 || last < first) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key
+                               << ". Expected non negative ascending CPU ranges";
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string FormatCpuList(const std::vector<int>& cpus) {
+    std::string list;
+    for (std::size_t i = 0; i < cpus.size();) {
+        auto last = i;
+        while (last + 1 < cpus.size() && cpus[last + 1] == cpus[last] + 1) {
+            ++last;
+        }
+        list += (list.empty() ? "" : ",") + std::to_string(cpus[i]);
+        if (last != i) {
+            list += "-" + std::to_string(cpus[last]);
+        }
+        i = last + 1;
+    }
+    return list;
+}
+
+// the cores the AUTO streams are divided between, a container gets only its CPU quota
+int GetAutoStreamsCores() {
+    const int sockets = getAvailableNUMANodes().size();
+    return sockets == 1 ? getNumberOfAvailableCPUs() : std::min(getNumberOfCPUCores(), getNumberOfAvailableCPUs());
+}
+
+// bare minimum of streams (that evenly divides available number of core)
+int GetAutoStreams(int num_cores) {
+    if (0 == num_cores % 4)
+        return std::max(4, num_cores / 4);
+    else if (0 == num_cores % 5)
+        return std::max(5, num_cores / 5);
+    else if (0 == num_cores % 3)
+        return std::max(3, num_cores / 3);
+    else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
+        return 1;
+}
+}  // namespace
+
 IStreamsExecutor::~IStreamsExecutor() {}
 
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
@@ -24,6 +103,10 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY(CPU_NETWORK_PRIORITY),
+        CONFIG_KEY(CPU_STREAMS_CPU_LISTS),
+        CONFIG_KEY(CPU_RESERVED_CPUS),
+        CONFIG_KEY(CPU_BIND_SMT_SIBLINGS),
     };
 }
 
@@ -44,20 +127,11 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes)";
             }
         } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
+            _autoStreams = (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO));
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
                 _streams = getAvailableNUMANodes().size();
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
-                const int sockets = getAvailableNUMANodes().size();
-                // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
-                if (0 == num_cores % 4)
-                    _streams = std::max(4, num_cores / 4);
-                else if (0 == num_cores % 5)
-                    _streams = std::max(5, num_cores / 5);
-                else if (0 == num_cores % 3)
-                    _streams = std::max(3, num_cores / 3);
-                else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
-                    _streams = 1;
+                _streams = GetAutoStreams(GetAutoStreamsCores());
             } else {
                 int val_i;
                 try {
@@ -96,6 +170,40 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY(CPU_NETWORK_PRIORITY)) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {}
+            if (val_i <= 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_NETWORK_PRIORITY)
+                                   << ". Expected only positive numbers";
+            }
+            _priority = val_i;
+        } else if (key == CONFIG_KEY(CPU_STREAMS_CPU_LISTS)) {
+            std::vector<std::vector<int>> lists;
+            std::istringstream values(value);
+            std::string list;
+            while (std::getline(values, list, ';')) {
+                auto cpus = ParseCpuList(key, list);
+                if (cpus.empty()) {
+                    THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key
+                                       << ". Expected non empty CPU lists separated with ';'";
+                }
+                lists.push_back(std::move(cpus));
+            }
+            _streamsCpuLists = std::move(lists);
+        } else if (key == CONFIG_KEY(CPU_RESERVED_CPUS)) {
+            _reservedCpus = ParseCpuList(key, value);
+        } else if (key == CONFIG_KEY(CPU_BIND_SMT_SIBLINGS)) {
+            if (value == CONFIG_VALUE(YES)) {
+                _bindToSmtSiblings = true;
+            } else if (value == CONFIG_VALUE(NO)) {
+                _bindToSmtSiblings = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_BIND_SMT_SIBLINGS)
+                                   << ". Expected only YES/NO";
+            }
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -120,22 +228,107 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY(CPU_NETWORK_PRIORITY)) {
+        return {_priority};
+    } else if (key == CONFIG_KEY(CPU_STREAMS_CPU_LISTS)) {
+        std::string lists;
+        for (auto&& cpus : _streamsCpuLists) {
+            lists += (lists.empty() ? "" : ";") + FormatCpuList(cpus);
+        }
+        return {lists};
+    } else if (key == CONFIG_KEY(CPU_RESERVED_CPUS)) {
+        return {FormatCpuList(_reservedCpus)};
+    } else if (key == CONFIG_KEY(CPU_BIND_SMT_SIBLINGS)) {
+        return {std::string(_bindToSmtSiblings ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
     return {};
 }
 
+int IStreamsExecutor::Config::GetModelAwareStreams(const NetworkIntensity& intensity, std::size_t cacheSize) {
+    const int cores = std::max(1, GetAutoStreamsCores());
+    if (intensity.FlopsPerByte() <= 0 || 0 == intensity.maxWorkingSet || 0 == cacheSize) {
+        return GetAutoStreams(cores);
+    }
+    // the largest operation of a stream is divided between its threads, so they keep their parts in their caches
+    auto threadsPerStream = static_cast<int>(std::min<std::size_t>(
+        cores, (intensity.maxWorkingSet + cacheSize - 1) / cacheSize));
+    // the compute bound networks reuse the data they read, so even the parts which do not fit the caches
+    // do not saturate the memory bandwidth, while the memory bound ones share it between the streams
+    constexpr double computeBoundFlopsPerByte = 16;
+    constexpr double memoryBoundFlopsPerByte = 2;
+    if (intensity.FlopsPerByte() >= computeBoundFlopsPerByte) {
+        threadsPerStream = std::min(threadsPerStream, 2);
+    } else if (intensity.FlopsPerByte() < memoryBoundFlopsPerByte) {
+        threadsPerStream = std::max(threadsPerStream, 4);
+    }
+    return std::max(1, cores / std::max(1, threadsPerStream));
+}
+
 IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(const IStreamsExecutor::Config& initial) {
     const auto envThreads = parallel_get_env_threads();
     const auto& numaNodes = getAvailableNUMANodes();
     const auto numaNodesNum = numaNodes.size();
     auto streamExecutorConfig = initial;
-    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    // use logical cores only for single-socket targets in throughput mode, a container gets only its CPU quota
+    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1
+                         ? std::min(parallel_get_max_threads(), getNumberOfAvailableCPUs()) : getNumberOfCPUCores();
     const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                             ? std::max(1, threads/streamExecutorConfig._streams)
                                             : threads;
+
+    // with the explicit CPU lists a stream gets its part of the processors of its list the process may run on
+    const bool autoThreads = 0 == initial._threads && 0 == envThreads && 0 == initial._threadsPerStream;
+    if (!streamExecutorConfig._streamsCpuLists.empty() && streamExecutorConfig._streams > 0 && autoThreads) {
+        CpuSet processMask;
+        int    ncpus = 0;
+        std::tie(processMask, ncpus) = GetProcessMask();
+        int threadsPerStream = 0;
+        for (int list = 0; list < static_cast<int>(streamExecutorConfig._streamsCpuLists.size()); ++list) {
+            int listStreams = 0;
+            for (int streamId = 0; streamId < streamExecutorConfig._streams; ++streamId) {
+                listStreams += list == streamExecutorConfig.GetStreamCpuListIndex(streamId) ? 1 : 0;
+            }
+            if (0 == listStreams) {
+                continue;
+            }
+            const auto mask = GetCpuListMask(streamExecutorConfig._streamsCpuLists[list], streamExecutorConfig._reservedCpus,
+                                             streamExecutorConfig._bindToSmtSiblings, ncpus, processMask);
+            auto cpus = static_cast<int>(streamExecutorConfig._streamsCpuLists[list].size());
+#if !(defined(__APPLE__) || defined(_WIN32))
+            if (nullptr != mask) {
+                cpus = CPU_COUNT_S(CPU_ALLOC_SIZE(ncpus), mask.get());
+            }
+#endif
+            const auto listThreads = std::max(1, cpus / listStreams);
+            threadsPerStream = 0 == threadsPerStream ? listThreads : std::min(threadsPerStream, listThreads);
+        }
+        streamExecutorConfig._threadsPerStream = std::max(1, threadsPerStream);
+        return streamExecutorConfig;
+    }
+
+    // the streams bound to the little cores would be stragglers setting the throughput of all the requests, so
+    // a single stream uses the big cores only and several streams get the cores of a type sized by its number of cores
+    const auto bigCores = static_cast<int>(getAvailableCores(CPUCoreType::BIG).size());
+    const auto littleCores = static_cast<int>(getAvailableCores(CPUCoreType::LITTLE).size());
+    if (ThreadBindingType::CORES == streamExecutorConfig._threadBindingType && 0 == streamExecutorConfig._bigCoreStreams &&
+        bigCores > 0 && littleCores > 0 && streamExecutorConfig._streams > 0 && autoThreads) {
+        const auto streams = streamExecutorConfig._streams;
+        if (1 == streams) {
+            streamExecutorConfig._bigCoreStreams = 1;
+            streamExecutorConfig._threadsPerStream = bigCores;
+        } else {
+            const auto threadsPerStream = std::max(1, (bigCores + littleCores) / streams);
+            const auto bigCoreStreams = std::min(streams, std::max(1, bigCores / threadsPerStream));
+            const auto littleCoreStreams = streams - bigCoreStreams;
+            streamExecutorConfig._bigCoreStreams = bigCoreStreams;
+            streamExecutorConfig._threadsPerStream = std::max(1, bigCores / bigCoreStreams);
+            streamExecutorConfig._threadsPerLittleCoreStream = littleCoreStreams > 0
+                                                                   ? std::max(1, littleCores / littleCoreStreams) : 0;
+        }
+    }
     return streamExecutorConfig;
 }
 
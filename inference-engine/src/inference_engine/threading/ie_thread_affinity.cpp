@@ -94,6 +94,62 @@ bool PinCurrentThreadToSocket(int socket) {
     }
     return res;
 }
+
+CpuSet GetCoreTypeMask(CPUCoreType type, int ncores, const CpuSet& procMask) {
+    if (procMask == nullptr)
+        return nullptr;
+    const auto cores = getAvailableCores(type);
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    CpuSet targetMask{CPU_ALLOC(ncores)};
+    CPU_ZERO_S(size, targetMask.get());
+    // hyper-threads of a core share its execution units, so only the first one is used
+    for (auto&& core : cores) {
+        if (!core.empty() && core.front() < ncores && CPU_ISSET_S(core.front(), size, procMask.get())) {
+            CPU_SET_S(core.front(), size, targetMask.get());
+        }
+    }
+    if (0 == CPU_COUNT_S(size, targetMask.get()))
+        return nullptr;
+    return targetMask;
+}
+
+CpuSet GetCpuListMask(const std::vector<int>& cpus, const std::vector<int>& reservedCpus,
+                      bool smtSiblings, int ncores, const CpuSet& procMask) {
+    if (procMask == nullptr)
+        return nullptr;
+    const size_t size = CPU_ALLOC_SIZE(ncores);
+    CpuSet targetMask{CPU_ALLOC(ncores)};
+    if (cpus.empty()) {
+        CPU_OR_S(size, targetMask.get(), procMask.get(), procMask.get());
+    } else {
+        CPU_ZERO_S(size, targetMask.get());
+        for (auto cpu : cpus) {
+            if (cpu >= 0 && cpu < ncores && CPU_ISSET_S(cpu, size, procMask.get())) {
+                CPU_SET_S(cpu, size, targetMask.get());
+            }
+        }
+    }
+    for (auto cpu : reservedCpus) {
+        if (cpu >= 0 && cpu < ncores) {
+            CPU_CLR_S(cpu, size, targetMask.get());
+        }
+    }
+    if (!smtSiblings) {
+        // a processor is dropped if a sibling with a lower id is in the mask, so every core keeps one of them
+        for (int cpu = 0; cpu < ncores; ++cpu) {
+            if (!CPU_ISSET_S(cpu, size, targetMask.get()))
+                continue;
+            for (auto sibling : getCoreSiblings(cpu)) {
+                if (sibling > cpu && sibling < ncores) {
+                    CPU_CLR_S(sibling, size, targetMask.get());
+                }
+            }
+        }
+    }
+    if (0 == CPU_COUNT_S(size, targetMask.get()))
+        return nullptr;
+    return targetMask;
+}
 #else   // no threads pinning/binding on Win/MacOS
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
@@ -109,5 +165,11 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
+CpuSet GetCoreTypeMask(CPUCoreType, int, const CpuSet&) {
+    return nullptr;
+}
+CpuSet GetCpuListMask(const std::vector<int>&, const std::vector<int>&, bool, int, const CpuSet&) {
+    return nullptr;
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 }  //  namespace InferenceEngine
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <algorithm>
+#include <deque>
 #include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -217,15 +219,15 @@ inline void UnorderedDFS(std::unordered_set<CNNLayer*>& visited, const Inference
  */
 template <class T>
 inline void BFS(InferenceEngine::CNNLayerPtr layer, const T& visit, int maxDepth) {
-    std::set<InferenceEngine::CNNLayer*> visited;
-    std::list<InferenceEngine::CNNLayerPtr> nextLayers;
+    std::unordered_set<InferenceEngine::CNNLayer*> visited;
+    std::deque<InferenceEngine::CNNLayerPtr> nextLayers;
     nextLayers.push_back(layer);
 
     int layersOnLevel = 1;
     for (; !nextLayers.empty() && maxDepth != 0;) {
         visit(*nextLayers.begin());
         for (auto& od : (*nextLayers.begin())->outData) {
-            for (auto nl : getInputTo(od)) {
+            for (const auto& nl : getInputTo(od)) {
                 if (visited.find(nl.second.get()) == visited.end()) {
                     nextLayers.push_back(nl.second);
                     visited.insert(nl.second.get());
@@ -439,6 +441,91 @@ std::vector<CNNLayerPtr> CNNNetSortTopologicallyEx(const ICNNNetwork& network, L
     return stackOfVisited;
 }
 
+/**
+ * @brief A compact view of the layers and edges of a CNNNetwork
+ * @details The layers are numbered and the edges are stored as arrays of layer indices (CSR), so traversals
+ * do not compare names, hash layers or copy shared pointers. The view is not updated when the network changes.
+ */
+class INFERENCE_ENGINE_API_CLASS(CNNNetAdjacency) {
+public:
+    /**
+     * @brief The index of an absent layer
+     */
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief A range of layer indices, suitable for ranged loops
+     */
+    struct Range {
+        const size_t* first;
+        const size_t* last;
+
+        const size_t* begin() const noexcept { return first; }
+        const size_t* end() const noexcept { return last; }
+        size_t size() const noexcept { return static_cast<size_t>(last - first); }
+        size_t operator[](size_t i) const noexcept { return first[i]; }
+    };
+
+    /**
+     * @brief Builds the view of the layers connected to the network inputs, the same layers CNNNetSortTopologically
+     * returns
+     * @param network - input CNNNetwork
+     */
+    explicit CNNNetAdjacency(const ICNNNetwork& network);
+
+    /**
+     * @return number of layers
+     */
+    size_t size() const noexcept {
+        return _layers.size();
+    }
+
+    /**
+     * @param index - layer index
+     * @return the layer
+     */
+    const CNNLayerPtr& layer(size_t index) const {
+        return _layers[index];
+    }
+
+    /**
+     * @param layer - layer of the network
+     * @return index of the layer or npos if the layer is not in the view
+     */
+    size_t indexOf(const CNNLayer* layer) const;
+
+    /**
+     * @param index - layer index
+     * @return consumers of the layer output data in the order of outData and getInputTo, a layer consuming several
+     * outputs is repeated
+     */
+    Range children(size_t index) const noexcept {
+        return {_children.data() + _childrenOffsets[index], _children.data() + _childrenOffsets[index + 1]};
+    }
+
+    /**
+     * @param index - layer index
+     * @return creators of the layer insData by input port, npos for data without creator
+     */
+    Range parents(size_t index) const noexcept {
+        return {_parents.data() + _parentsOffsets[index], _parents.data() + _parentsOffsets[index + 1]};
+    }
+
+    /**
+     * @brief Sorts the layers in the same topological order as CNNNetSortTopologically
+     * @return sorted layer indices
+     */
+    std::vector<size_t> sortTopologically() const;
+
+private:
+    std::vector<CNNLayerPtr> _layers;
+    std::unordered_map<const CNNLayer*, size_t> _indices;
+    std::vector<size_t> _childrenOffsets;
+    std::vector<size_t> _children;
+    std::vector<size_t> _parentsOffsets;
+    std::vector<size_t> _parents;
+};
+
 using CNNNetPtr = std::shared_ptr<ICNNNetwork>;
 using CNNNetCPtr = std::shared_ptr<const ICNNNetwork>;
 
@@ -25,6 +25,16 @@ IE_SUPPRESS_DEPRECATED_START
 INFERENCE_ENGINE_API_CPP(bool) CombineRNNSeq(ICNNNetwork& net);
 INFERENCE_ENGINE_API_CPP(bool) CombineRNNSeq(TensorIterator::Body& net);
 
+/**
+ * Move the FullyConnected layers applied to the iterated inputs of TI bodies out of the loop,
+ * so they process all the iterations at once
+ *
+ * @param net network to modify
+ * @return true if all Tensor iterators were processed
+ */
+INFERENCE_ENGINE_API_CPP(bool) HoistTIInvariants(ICNNNetwork& net);
+INFERENCE_ENGINE_API_CPP(bool) HoistTIInvariants(TensorIterator::Body& net);
+
 /**
  * Returns a vector of the topologically sorted layers from
  * the passed TI layer body.
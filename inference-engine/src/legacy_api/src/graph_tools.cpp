@@ -4,8 +4,10 @@
 
 #include "graph_tools.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "details/ie_cnn_network_tools.h"
@@ -16,23 +18,126 @@ namespace InferenceEngine {
 namespace details {
 
 std::vector<CNNLayerPtr> CNNNetSortTopologically(const ICNNNetwork& network) {
-    std::vector<CNNLayerPtr> stackOfVisited;
-    bool res = CNNNetForestDFS(
-        CNNNetGetAllInputLayers(network),
-        [&](CNNLayerPtr current) {
-            stackOfVisited.push_back(current);
-        },
-        false);
-
-    if (!res) {
-        THROW_IE_EXCEPTION << "Sorting not possible, due to existed loop.";
+    const CNNNetAdjacency adjacency(network);
+    std::vector<CNNLayerPtr> sorted;
+    sorted.reserve(adjacency.size());
+    for (const auto index : adjacency.sortTopologically()) {
+        sorted.push_back(adjacency.layer(index));
+    }
+    return sorted;
+}
+
+}  // namespace details
+
+constexpr size_t CNNNetAdjacency::npos;
+
+CNNNetAdjacency::CNNNetAdjacency(const ICNNNetwork& network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+
+    auto add = [&](const CNNLayerPtr& layer) {
+        if (_indices.emplace(layer.get(), _layers.size()).second) {
+            _layers.push_back(layer);
+        }
+    };
+
+    // the layers are numbered in the order of the breadth-first search over children and parents,
+    // _layers itself serves as the queue
+    for (const auto& input : inputs) {
+        const auto& consumers = getInputTo(input.second->getInputData());
+        if (!consumers.empty()) {
+            add(consumers.begin()->second);
+        }
+    }
+    for (size_t current = 0; current < _layers.size(); ++current) {
+        const CNNLayer* layer = _layers[current].get();
+        for (const auto& data : layer->outData) {
+            for (const auto& consumer : getInputTo(data)) {
+                add(consumer.second);
+            }
+        }
+        for (size_t i = 0; i < layer->insData.size(); ++i) {
+            const auto data = layer->insData[i].lock();
+            if (!data) {
+                THROW_IE_EXCEPTION << "Data " << i << " inserted into layer " << layer->name << " is nullptr";
+            }
+            const auto creator = getCreatorLayer(data).lock();
+            if (creator) {
+                add(creator);
+            }
+        }
     }
 
-    std::reverse(std::begin(stackOfVisited), std::end(stackOfVisited));
+    _childrenOffsets.reserve(_layers.size() + 1);
+    _parentsOffsets.reserve(_layers.size() + 1);
+    for (const auto& layer : _layers) {
+        _childrenOffsets.push_back(_children.size());
+        for (const auto& data : layer->outData) {
+            for (const auto& consumer : getInputTo(data)) {
+                _children.push_back(_indices.at(consumer.second.get()));
+            }
+        }
+        _parentsOffsets.push_back(_parents.size());
+        for (const auto& input : layer->insData) {
+            const auto creator = getCreatorLayer(input.lock()).lock();
+            _parents.push_back(creator ? _indices.at(creator.get()) : npos);
+        }
+    }
+    _childrenOffsets.push_back(_children.size());
+    _parentsOffsets.push_back(_parents.size());
+}
 
-    return stackOfVisited;
+size_t CNNNetAdjacency::indexOf(const CNNLayer* layer) const {
+    const auto it = _indices.find(layer);
+    return it == _indices.end() ? npos : it->second;
 }
 
-}  // namespace details
+std::vector<size_t> CNNNetAdjacency::sortTopologically() const {
+    // the DFS starts from the layers without inputs ordered by names and visits children in their order,
+    // so the result does not depend on the layers numbering
+    std::vector<size_t> heads;
+    for (size_t index = 0; index < _layers.size(); ++index) {
+        if (_layers[index]->insData.empty()) {
+            heads.push_back(index);
+        }
+    }
+    std::sort(heads.begin(), heads.end(), [&](size_t lhs, size_t rhs) {
+        return _layers[lhs]->name < _layers[rhs]->name;
+    });
+
+    enum : uint8_t { NotVisited, InProgress, Visited };
+    std::vector<uint8_t> states(_layers.size(), NotVisited);
+    std::vector<size_t> postOrder;
+    postOrder.reserve(_layers.size());
+    // layer index and the number of its visited children
+    std::vector<std::pair<size_t, size_t>> stack;
+
+    for (const auto head : heads) {
+        if (states[head] != NotVisited) continue;
+        states[head] = InProgress;
+        stack.emplace_back(head, 0);
+        while (!stack.empty()) {
+            const size_t index = stack.back().first;
+            const Range next = children(index);
+            if (stack.back().second < next.size()) {
+                const size_t child = next[stack.back().second++];
+                if (states[child] == InProgress) {
+                    THROW_IE_EXCEPTION << "Sorting not possible, due to existed loop.";
+                }
+                if (states[child] == NotVisited) {
+                    states[child] = InProgress;
+                    stack.emplace_back(child, 0);
+                }
+            } else {
+                states[index] = Visited;
+                postOrder.push_back(index);
+                stack.pop_back();
+            }
+        }
+    }
+
+    std::reverse(postOrder.begin(), postOrder.end());
+    return postOrder;
+}
 
 }  // namespace InferenceEngine
@@ -22,6 +22,7 @@
 #include "graph_tools.hpp"
 #include "ie_layers_internal.hpp"
 #include "ie_memcpy.h"
+#include "ie_util_internal.hpp"
 #include "precision_utils.h"
 
 namespace InferenceEngine {
@@ -1216,6 +1217,101 @@ static bool unrollSeq(CNNLayerPtr cur) {
     return true;
 }
 
+/**
+ * Move a FullyConnected layer applied to an iterated input of TI body out of the loop
+ *
+ *   in_data[A0, A1, I] -> TI { chunk[.., 1, .., I] -> (Reshape) -> FC -> fc_out[N, H] -> ... }
+ *
+ * becomes
+ *
+ *   in_data -> Reshape[A0 * A1, I] -> FC -> Reshape[A0, A1, H] -> TI { chunk[.., 1, .., H] -> Reshape -> fc_out -> ... }
+ *
+ * so the projection of all the iterations is done by one FC and only the recurrent part stays in the body.
+ */
+template <typename N>
+bool hoistTIInputFC(CNNLayerPtr cur, const N& net) {
+    if (cur->type != "TensorIterator") return true;
+
+    auto ti = std::dynamic_pointer_cast<TensorIterator>(cur);
+    IE_ASSERT(ti) << "Cannot cast object with type TensorIterator to TensorIterator object";
+
+    for (auto& rule : ti->input_port_map) {
+        if (!one_of(rule.axis, 0, 1) || !one_of(rule.stride, 1, -1)) continue;
+
+        // the outer data and the body chunk should be used by this rule and by the FC only
+        auto in_data = ti->insData[rule.from].lock();
+        auto uses = std::count_if(ti->input_port_map.begin(), ti->input_port_map.end(),
+                                  [&](const TensorIterator::PortMap& m) { return m.from == rule.from || m.to == rule.to; });
+        if (uses != 1 || in_data->getDims().size() != 3) continue;
+
+        auto& chunk = ti->body.inputs[rule.to];
+        if (getInputTo(chunk).size() != 1) continue;
+
+        auto fc_dt = chunk;
+        auto consumer = getInputTo(chunk).begin()->second;
+        std::shared_ptr<ReshapeLayer> squeeze;
+        if (consumer->type == "Reshape") {
+            squeeze = std::dynamic_pointer_cast<ReshapeLayer>(consumer);
+            if (!squeeze || squeeze->outData.size() != 1 || getInputTo(squeeze->outData[0]).size() != 1) continue;
+            fc_dt = squeeze->outData[0];
+            consumer = getInputTo(fc_dt).begin()->second;
+        }
+
+        auto fc = std::dynamic_pointer_cast<FullyConnectedLayer>(consumer);
+        if (!fc || fc->type != "FullyConnected" || fc->insData.size() != 1 || fc->outData.size() != 1) continue;
+
+        const auto full_dims = in_data->getDims();
+        const size_t I = full_dims[2];
+        const size_t B = full_dims[1 - rule.axis];
+        const size_t T = full_dims[rule.axis];
+        const size_t H = fc->_out_num;
+
+        auto chunk_dims = full_dims;
+        chunk_dims[rule.axis] = 1;
+        const auto& fc_out = fc->outData[0];
+        if (chunk->getDims() != chunk_dims || fc_out->getDims() != SizeVector {B, H} ||
+            (squeeze && fc_dt->getDims() != SizeVector {B, I}))
+            continue;
+
+        const auto prc = in_data->getPrecision();
+        const auto name = ti->name + ":" + fc->name;
+
+        // projection of all the iterations in front of TI
+        auto resh_in = _resh(name + ":resh_in", prc, {T * B, I});
+        auto hoisted = clonelayer(*fc);
+        hoisted->name = name;
+        hoisted->insData.resize(1);
+        hoisted->outData.resize(1);
+        hoisted->outData[0] = DataPtr(new Data(name, TensorDesc {prc, {T * B, H}, TensorDesc::getLayoutByDims({T * B, H})}));
+        getCreatorLayer(hoisted->outData[0]) = hoisted;
+        auto full_dims_out = full_dims;
+        full_dims_out[2] = H;
+        auto resh_out = _resh(name + ":resh_out", prc, full_dims_out);
+
+        getInputTo(in_data).erase(ti->name);
+        _link(in_data, resh_in);
+        _link(resh_in, hoisted);
+        _link(hoisted, resh_out);
+        getInputTo(resh_out->outData[0])[ti->name] = ti;
+        ti->insData[rule.from] = resh_out->outData[0];
+
+        // the body takes the projected chunk and restores the shape of the FC output
+        auto chunk_dims_out = chunk_dims;
+        chunk_dims_out[2] = H;
+        auto new_chunk = DataPtr(new Data(chunk->getName() + ":projected",
+                                          TensorDesc {chunk->getPrecision(), chunk_dims_out, TensorDesc::getLayoutByDims(chunk_dims_out)}));
+        auto resh_fc = std::make_shared<ReshapeLayer>(LayerParams {fc->name + ":resh", "Reshape", fc->precision});
+        resh_fc->insData.resize(1);
+        resh_fc->outData.push_back(fc_out);
+        getCreatorLayer(fc_out) = resh_fc;
+        fc->outData.clear();
+        _link(new_chunk, resh_fc);
+
+        chunk = new_chunk;
+    }
+    return true;
+}
+
 /************************************************************/
 /****  Converter API  ***************************************/
 /************************************************************/
@@ -1281,6 +1377,16 @@ bool CombineRNNSeq(TensorIterator::Body& net) {
     return ApplyForAll(net, convertToRNNSeq<TensorIterator::Body>);
 }
 
+bool HoistTIInvariants(ICNNNetwork& net) {
+    auto res = ApplyForAll(net, hoistTIInputFC<ICNNNetwork>);
+    restore_net_consistency(net);
+    return res;
+}
+
+bool HoistTIInvariants(TensorIterator::Body& net) {
+    return ApplyForAll(net, hoistTIInputFC<TensorIterator::Body>);
+}
+
 bool UnrollTI(ICNNNetwork& net) {
     auto res = ApplyForAll(net, unrollTI);
     restore_net_consistency(net);
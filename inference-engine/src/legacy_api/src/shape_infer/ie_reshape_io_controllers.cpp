@@ -145,14 +145,7 @@ void OutputController::propagateShapes(const std::set<ReshapeLauncher::Ptr>& lau
                 THROW_IE_EXCEPTION << "Failed to propagate shapes for layer (" << inputTo.first
                                    << "): connected layer is null";
             }
-            auto layerName = layer->name;
-            auto foundLauncher =
-                std::find_if(launchers.begin(), launchers.end(), [&layerName](const ReshapeLauncher::Ptr& launcher) {
-                    return launcher->getLayerName() == layerName;
-                });
-            if (foundLauncher == launchers.end())
-                THROW_IE_EXCEPTION << "Failed to find ReshapeLauncher for layer: '" << layerName << "'";
-            (*foundLauncher)->setShapeByName(_shapes[idx], outData->getName());
+            findLauncher(launchers, layer->name)->setShapeByName(_shapes[idx], outData->getName());
         }
         idx++;
     }
@@ -168,19 +161,40 @@ void OutputController::propagateBlobs(const std::set<ReshapeLauncher::Ptr>& laun
                 THROW_IE_EXCEPTION << "Failed to propagate shapes for layer (" << inputTo.first
                                    << "): connected layer is null";
             }
-            auto layerName = layer->name;
-            auto foundLauncher =
-                std::find_if(launchers.begin(), launchers.end(), [&layerName](const ReshapeLauncher::Ptr& launcher) {
-                    return launcher->getLayerName() == layerName;
-                });
-            if (foundLauncher == launchers.end())
-                THROW_IE_EXCEPTION << "Failed to find ReshapeLauncher for layer: '" << layerName << "'";
-            (*foundLauncher)->setBlobByName(_inferedData[idx], outData->getName());
+            findLauncher(launchers, layer->name)->setBlobByName(_inferedData[idx], outData->getName());
         }
         idx++;
     }
 }
 
+void OutputController::resolveLaunchers(const std::unordered_map<std::string, ReshapeLauncher*>& launchersByName) {
+    _resolvedLaunchers.clear();
+    for (auto const& outData : _dataVec) {
+        for (auto const& inputTo : getInputTo(outData)) {
+            if (inputTo.second == nullptr)
+                continue;
+            auto found = launchersByName.find(inputTo.second->name);
+            if (found != launchersByName.end())
+                _resolvedLaunchers[inputTo.second->name] = found->second;
+        }
+    }
+}
+
+ReshapeLauncher* OutputController::findLauncher(const std::set<ReshapeLauncher::Ptr>& launchers,
+                                                const std::string& layerName) const {
+    auto resolved = _resolvedLaunchers.find(layerName);
+    if (resolved != _resolvedLaunchers.end())
+        return resolved->second;
+    // the layers connected after the launchers were resolved are searched by the name
+    auto foundLauncher =
+        std::find_if(launchers.begin(), launchers.end(), [&layerName](const ReshapeLauncher::Ptr& launcher) {
+            return launcher->getLayerName() == layerName;
+        });
+    if (foundLauncher == launchers.end())
+        THROW_IE_EXCEPTION << "Failed to find ReshapeLauncher for layer: '" << layerName << "'";
+    return foundLauncher->get();
+}
+
 void OutputController::setShapes(const std::vector<SizeVector>& shapes) {
     _shapes = shapes;
 }
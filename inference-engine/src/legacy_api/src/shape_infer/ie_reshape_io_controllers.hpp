@@ -11,6 +11,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ie_reshape_launcher.hpp"
@@ -139,6 +140,17 @@ public:
     std::vector<Blob::Ptr> createBlobs();
 
     void propagateBlobs(const std::set<ReshapeLauncher::Ptr>& set);
+
+    /**
+     * @brief Remembers the launchers of the layers the outputs are passed to
+     * @param launchersByName - Map of layer names to reshape launchers for that layer
+     */
+    void resolveLaunchers(const std::unordered_map<std::string, ReshapeLauncher*>& launchersByName);
+
+private:
+    ReshapeLauncher* findLauncher(const std::set<ReshapeLauncher::Ptr>& launchers, const std::string& layerName) const;
+
+    std::unordered_map<std::string, ReshapeLauncher*> _resolvedLaunchers;
 };
 
 }  // namespace ShapeInfer
@@ -122,6 +122,11 @@ void ReshapeLauncher::constInfer(const std::set<ReshapeLauncher::Ptr>& launchers
     }
 }
 
+void ReshapeLauncher::resolveLaunchers(const std::unordered_map<std::string, ReshapeLauncher*>& launchersByName) {
+    if (_oController)
+        _oController->resolveLaunchers(launchersByName);
+}
+
 void ReshapeLauncher::reset() {
     _iController->reset();
     _oController->reset();
@@ -11,6 +11,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "shape_infer/built-in/ie_built_in_holder.hpp"
@@ -112,6 +113,13 @@ public:
 
     virtual const CNNLayer* getLayer() const;
 
+    /**
+     * @brief Remembers the launchers of the layers the outputs are passed to, so reshape() and constInfer()
+     * do not search them in the set of all launchers by the layer name
+     * @param launchersByName - Map of pairs: layer name and its reshape launcher.
+     */
+    void resolveLaunchers(const std::unordered_map<std::string, ReshapeLauncher*>& launchersByName);
+
 protected:
     InputController* _iController = nullptr;
     OutputController* _oController = nullptr;
@@ -57,6 +57,7 @@ Reshaper::Reshaper(std::vector<DataPtr> insDatas, const LauncherCreator::Ptr& la
         auto createdLauncher = launcherCreator->createNotInputLauncher(currentLayer.get(), _extensions);
         _launchers.insert(createdLauncher);
     }
+    indexLaunchers();
 }
 
 Reshaper::Reshaper(ICNNNetwork& network, const LauncherCreator::Ptr& launcherCreator) {
@@ -85,6 +86,7 @@ Reshaper::Reshaper(ICNNNetwork& network, const LauncherCreator::Ptr& launcherCre
         }
         _launchers.insert(createdLauncher);
     }
+    indexLaunchers();
 }
 
 void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
@@ -132,16 +134,27 @@ void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
         }
     }
     _extensions.push_back(extension);
+    indexLaunchers();
+}
+
+void Reshaper::indexLaunchers() {
+    _launchersByName.clear();
+    std::unordered_map<std::string, ReshapeLauncher*> launchersByName;
+    for (const auto& launcher : _launchers) {
+        auto layerName = launcher->getLayerName();
+        _launchersByName[layerName] = launcher;
+        launchersByName[layerName] = launcher.get();
+    }
+    for (const auto& launcher : _launchers) {
+        launcher->resolveLaunchers(launchersByName);
+    }
 }
 
 ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerName) const {
-    auto foundLauncher =
-        std::find_if(_launchers.begin(), _launchers.end(), [&layerName](const ReshapeLauncher::Ptr& launcher) {
-            return launcher->getLayerName() == layerName;
-        });
-    if (foundLauncher == _launchers.end())
+    auto foundLauncher = _launchersByName.find(layerName);
+    if (foundLauncher == _launchersByName.end())
         THROW_IE_EXCEPTION << "Failed to reshape layer ('" << layerName << "'): can't find the corresponding launcher";
-    return *foundLauncher;
+    return foundLauncher->second;
 }
 
 StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp) {
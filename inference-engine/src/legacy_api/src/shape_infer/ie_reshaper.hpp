@@ -11,6 +11,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ie_ishape_infer_extension.hpp"
@@ -100,11 +101,15 @@ public:
 private:
     ReshapeLauncher::Ptr getLauncherByLayerName(const std::string& layerName) const;
 
+    // indexes the launchers by the layer name, the launchers resolve the ones of their next layers with the index
+    void indexLaunchers();
+
     InferenceEngine::details::caseless_set<std::string> getTypeNamesFromExtension(
         const IShapeInferExtensionPtr& extension);
 
     std::vector<IShapeInferExtensionPtr> _extensions;
     std::set<ReshapeLauncher::Ptr> _launchers;
+    std::unordered_map<std::string, ReshapeLauncher::Ptr> _launchersByName;
     std::vector<CNNLayerPtr> _allSortedLayers {};
     std::set<CNNLayerPtr> _inputLayers {};
     InferenceEngine::details::caseless_set<std::string> _allTypes;
@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_layers.h"
+#include "low_precision_transformations/transformation_context.hpp"
+#include "low_precision_transformations/layer_transformation.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+IE_SUPPRESS_DEPRECATED_START
+
+class INFERENCE_ENGINE_API_CLASS(InterpTransformation) : public LayerTransformation {
+public:
+    InterpTransformation(const Params& params) : LayerTransformation(params) {}
+    ~InterpTransformation() override {}
+    void transform(TransformationContext& context, CNNLayer& layer) const override;
+    bool isPrecisionPreserved(const CNNLayer& layer) const noexcept override;
+};
+
+IE_SUPPRESS_DEPRECATED_END
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -176,7 +176,8 @@ public:
             const bool updateBiases = true,
             bool supportAsymmetricQuantization = true,
             std::vector<Precision> precisionsOnActivations = { Precision::U8, Precision::I8 },
-            std::vector<Precision> precisionsOnWeights = { Precision::I8 }) :
+            std::vector<Precision> precisionsOnWeights = { Precision::I8 },
+            const size_t minQuantizedOutputChannels = 0ul) :
             updatePrecisions(updatePrecisions),
             quantizeOutputs(quantizeOutputs),
             weightsToConst(weightsToConst),
@@ -186,7 +187,8 @@ public:
             updateBiases(updateBiases),
             supportAsymmetricQuantization(supportAsymmetricQuantization),
             precisionsOnActivations(precisionsOnActivations),
-            precisionsOnWeights(precisionsOnWeights) {
+            precisionsOnWeights(precisionsOnWeights),
+            minQuantizedOutputChannels(minQuantizedOutputChannels) {
             if (precisionsOnActivations.size() == 0ul) {
                 THROW_IE_EXCEPTION << "precisions on activations are not specisifed";
             }
@@ -246,6 +248,11 @@ public:
             return *this;
         }
 
+        Params& setMinQuantizedOutputChannels(const size_t minQuantizedOutputChannels) {
+            this->minQuantizedOutputChannels = minQuantizedOutputChannels;
+            return *this;
+        }
+
         bool updatePrecisions;
         bool quantizeOutputs;
         bool weightsToConst;
@@ -256,6 +263,8 @@ public:
         bool supportAsymmetricQuantization;
         std::vector<Precision> precisionsOnActivations;
         std::vector<Precision> precisionsOnWeights;
+        // depthwise convolutions and fully connected layers with less output channels are not quantized, 0 - disabled
+        size_t minQuantizedOutputChannels;
     };
 
     class PrecisionDetails {
@@ -347,6 +356,7 @@ protected:
     bool supportAsymmetricQuantization;
     std::vector<Precision> precisionsOnActivations;
     std::vector<Precision> precisionsOnWeights;
+    size_t minQuantizedOutputChannels;
 
     // absolute value, used to determine quantization interval asymmetry
     float quantizationIntervalAsymmetryThreshold;
@@ -187,6 +187,9 @@ public:
 
     static Blob::Ptr getWeights(const CNNLayer& layer, const bool roundQuantizedValues);
 
+    // precision of the getWeights result, the weights are not quantized
+    static Precision getWeightsPrecision(const CNNLayer& layer);
+
     static Blob::Ptr getBiases(const CNNLayer& layer);
 
     static Blob::Ptr quantizeWeights(
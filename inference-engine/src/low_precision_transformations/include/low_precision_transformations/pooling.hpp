@@ -21,6 +21,7 @@ public:
     ~PoolingTransformation() override {}
     void transform(TransformationContext& context, CNNLayer& layer) const override;
     bool isPrecisionPreserved(const CNNLayer& layer) const noexcept override;
+    bool canBeTransformed(const TransformationContext& context, const CNNLayer& layer) const override;
 };
 
 IE_SUPPRESS_DEPRECATED_END
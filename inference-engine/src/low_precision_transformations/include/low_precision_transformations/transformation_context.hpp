@@ -44,6 +44,8 @@ public:
 
 private:
     std::vector<CNNLayerPtr> layers;
+    // positions of the layers in the topologically sorted list, removeLayer is called for most of them
+    std::unordered_map<std::string, size_t> layerIndices;
     std::unordered_map<std::string, std::unordered_map<std::string, Precision>> _original_precisions_map;
 };
 
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/interp.hpp"
+
+#include <details/caseless.hpp>
+#include <string>
+#include <vector>
+
+#include "low_precision_transformations/network_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+void InterpTransformation::transform(TransformationContext& context, CNNLayer& layer) const {
+    if (!LayerTransformation::canBeTransformed(context, layer)) {
+        return;
+    }
+
+    if (layer.insData.size() != 1) {
+        THROW_IE_EXCEPTION << "layer inputs '" << layer.insData.size() << "' is not correct";
+    }
+
+    if (!CaselessEq<std::string>()(layer.type, "Interp")) {
+        THROW_IE_EXCEPTION << "layer '" << layer.name << "' is not correct";
+    }
+
+    const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(layer, 0);
+    if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+        return;
+    }
+
+    // the padded border is interpolated with zeros which are not shifted
+    if ((layer.GetParamAsInt("pad_beg", 0) != 0) || (layer.GetParamAsInt("pad_end", 0) != 0)) {
+        return;
+    }
+
+    // bilinear interpolation weights sum to one, so per channel scales and shifts
+    // can be applied after interpolation of the quantized values
+    std::vector<float> dequantizationScales;
+    std::vector<float> dequantizationShifts;
+    fillFromDequantizationLayer(*scaleShift, dequantizationScales, dequantizationShifts);
+
+    CNNNetworkHelper::removeLayer(context.network, scaleShift);
+    context.removeLayer(*scaleShift);
+
+    addDequantizationLayer(context, layer, dequantizationScales, dequantizationShifts);
+}
+
+bool InterpTransformation::isPrecisionPreserved(const CNNLayer& layer) const noexcept {
+    return false;
+}
@@ -38,6 +38,7 @@ LayerTransformation::LayerTransformation(const Params& params) :
     supportAsymmetricQuantization(params.supportAsymmetricQuantization),
     precisionsOnActivations(params.precisionsOnActivations),
     precisionsOnWeights(params.precisionsOnWeights),
+    minQuantizedOutputChannels(params.minQuantizedOutputChannels),
     layerTransformationsManager(nullptr),
     paramsManager(nullptr),
     quantizationIntervalAsymmetryThreshold(2.e-4),
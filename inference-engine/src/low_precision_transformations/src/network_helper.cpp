@@ -1541,6 +1541,38 @@ Blob::Ptr CNNNetworkHelper::getWeights(
     }
 }
 
+Precision CNNNetworkHelper::getWeightsPrecision(const CNNLayer& layer) {
+    if (layer.insData.size() > 1) {
+        CNNLayerPtr weightsLayer = CNNNetworkHelper::getParent(layer, 1);
+        if (weightsLayer == nullptr) {
+            THROW_IE_EXCEPTION << "Convolution weights const layer are absent";
+        }
+
+        if (weightsLayer->type == "ScaleShift") {
+            weightsLayer = CNNNetworkHelper::getParent(*weightsLayer);
+            if (weightsLayer == nullptr) {
+                THROW_IE_EXCEPTION << "Layer '" << layer.name << "' does not have weights";
+            }
+        }
+
+        if (weightsLayer->type == "Const") {
+            CNNNetworkHelper::checkConstWithBlobs(weightsLayer);
+            return CNNNetworkHelper::getBlob(weightsLayer, "custom")->getTensorDesc().getPrecision();
+        } else if (weightsLayer->type == "FakeQuantize") {
+            // weights are quantized to the precision of the source blob, see quantizeWeights
+            return getQuantizeLayerBlob(*weightsLayer)->getTensorDesc().getPrecision();
+        } else {
+            THROW_IE_EXCEPTION << "Unexpected weights layer " << weightsLayer->type << " " << weightsLayer->name << " for " << layer.type << " " << layer.name;
+        }
+    } else {
+        const auto it = layer.blobs.find("weights");
+        if (it == layer.blobs.end()) {
+            THROW_IE_EXCEPTION << "Convolution weights are absent";
+        }
+        return it->second->getTensorDesc().getPrecision();
+    }
+}
+
 Blob::Ptr CNNNetworkHelper::getBiases(const CNNLayer& layer) {
     if (layer.insData.size() > 1U) {
         if (layer.insData.size() > 2U) {
@@ -1718,7 +1750,9 @@ void CNNNetworkHelper::quantizeBlob(const CNNLayer& quantize, Blob::Ptr& targetB
         THROW_IE_EXCEPTION << "quantized blob is empty for " << quantize.type << " layer " << quantize.name;
     }
 
-    auto srcData = getFloatData(sourceBlob);
+    // FP32 weights are read in place, other precisions are converted once
+    const bool isSourceFP32 = sourceBlob->getTensorDesc().getPrecision() == Precision::FP32;
+    const std::shared_ptr<float> srcData = isSourceFP32 ? nullptr : getFloatData(sourceBlob);
     const std::vector<size_t>& outDims = quantize.outData[0]->getDims();
     if (outDims.empty() || outDims.size() > 5lu) {
         THROW_IE_EXCEPTION << "Unexpected dimensions count " << outDims.size() << " for layer '" << quantize.name << "'";
@@ -1768,10 +1802,12 @@ void CNNNetworkHelper::quantizeBlob(const CNNLayer& quantize, Blob::Ptr& targetB
     const size_t DHW = D * H * W;
     const size_t IDHW = IC * DHW;
 
-    std::vector<float> dstBuffer(targetBlob->size());
+    // FP32 target is filled in place, other precisions are converted from an intermediate buffer
+    const bool isTargetFP32 = targetBlob->getTensorDesc().getPrecision() == Precision::FP32;
+    std::vector<float> dstBuffer(isTargetFP32 ? 0lu : targetBlob->size());
 
-    auto srcPtr = srcData.get();
-    auto dstPtr = &dstBuffer[0];
+    const float* srcPtr = isSourceFP32 ? sourceBlob->cbuffer().as<const float*>() : srcData.get();
+    float* dstPtr = isTargetFP32 ? targetBlob->buffer().as<float*>() : dstBuffer.data();
 
     parallel_for4d(OC, IC, D, H, [&](size_t oc, size_t ic, size_t d, size_t h) {
         const float inputLow = quantizationDetails.inputLowValues[isInputLowBroadcasted ? 0 : oc];
@@ -1794,5 +1830,7 @@ void CNNNetworkHelper::quantizeBlob(const CNNLayer& quantize, Blob::Ptr& targetB
         }
     });
 
-    fillBlobByFP32(targetBlob, dstPtr);
+    if (!isTargetFP32) {
+        fillBlobByFP32(targetBlob, dstPtr);
+    }
 }
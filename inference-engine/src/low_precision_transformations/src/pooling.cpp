@@ -7,6 +7,9 @@
 #include <algorithm>
 #include <details/caseless.hpp>
 #include <string>
+#include <vector>
+
+#include "low_precision_transformations/network_helper.hpp"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -31,3 +34,44 @@ bool PoolingTransformation::isPrecisionPreserved(const CNNLayer& layer) const no
     const std::string poolMethod = layer.GetParamAsString("pool-method", "");
     return poolMethod == "max";
 }
+
+bool PoolingTransformation::canBeTransformed(const TransformationContext& context, const CNNLayer& layer) const {
+    if (!TransparentBaseTransformation::canBeTransformed(context, layer)) {
+        return false;
+    }
+
+    const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(layer, 0);
+    if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+        return true;
+    }
+
+    const PoolingLayer* pooling = dynamic_cast<const PoolingLayer*>(&layer);
+    if (pooling == nullptr) {
+        return false;
+    }
+
+    std::vector<float> scales;
+    std::vector<float> shifts;
+    fillFromDequantizationLayer(*scaleShift, scales, shifts);
+
+    if (pooling->_type == PoolingLayer::MAX) {
+        // max of the values multiplied by negative scale is the min of the quantized values
+        return std::all_of(scales.begin(), scales.end(), [](const float value) { return value >= 0.f; });
+    }
+
+    if (pooling->_type == PoolingLayer::AVG && !pooling->_exclude_pad) {
+        // the padded zeros are averaged without shift, the shift is correct only when it is zero
+        bool padded = false;
+        for (size_t i = 0ul; i < pooling->_padding.size(); ++i) {
+            padded = padded || (pooling->_padding[i] != 0u);
+        }
+        for (size_t i = 0ul; i < pooling->_pads_end.size(); ++i) {
+            padded = padded || (pooling->_pads_end[i] != 0u);
+        }
+        if (padded) {
+            return std::all_of(shifts.begin(), shifts.end(), [](const float value) { return value == 0.f; });
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/shuffle_channels.hpp"
+
+#include <details/caseless.hpp>
+#include <string>
+#include <vector>
+
+#include "low_precision_transformations/network_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+void ShuffleChannelsTransformation::transform(TransformationContext& context, CNNLayer& layer) const {
+    if (!LayerTransformation::canBeTransformed(context, layer)) {
+        return;
+    }
+
+    if (layer.insData.size() != 1) {
+        THROW_IE_EXCEPTION << "layer inputs '" << layer.insData.size() << "' is not correct";
+    }
+
+    if (!CaselessEq<std::string>()(layer.type, "ShuffleChannels")) {
+        THROW_IE_EXCEPTION << "layer '" << layer.name << "' is not correct";
+    }
+
+    const CNNLayerPtr scaleShift = CNNNetworkHelper::getParent(layer, 0);
+    if ((scaleShift == nullptr) || (scaleShift->type != "ScaleShift")) {
+        return;
+    }
+
+    const DataPtr insData = layer.insData[0].lock();
+    if (insData == nullptr) {
+        THROW_IE_EXCEPTION << "input data is absent";
+    }
+    const size_t rank = insData->getDims().size();
+    if (rank < 2ul) {
+        return;
+    }
+
+    int axis = layer.GetParamAsInt("axis", 1);
+    if (axis < 0) {
+        axis += static_cast<int>(rank);
+    }
+    const size_t group = layer.GetParamAsUInt("group", 1);
+
+    std::vector<float> scales;
+    std::vector<float> shifts;
+    fillFromDequantizationLayer(*scaleShift, scales, shifts);
+
+    std::vector<float> dequantizationScales = scales;
+    std::vector<float> dequantizationShifts = shifts;
+    if ((axis == 1) && !DequantizationDetails::isPerTensor(scales, shifts)) {
+        // the channels are shuffled together with their dequantization values:
+        // output channel c is the input channel (c % group) * (C / group) + c / group
+        const size_t channels = scales.size();
+        if ((group == 0ul) || (channels % group != 0ul)) {
+            return;
+        }
+
+        const size_t groupSize = channels / group;
+        for (size_t channel = 0ul; channel < channels; ++channel) {
+            const size_t source = (channel % group) * groupSize + channel / group;
+            dequantizationScales[channel] = scales[source];
+            dequantizationShifts[channel] = shifts[source];
+        }
+    }
+
+    if (updatePrecisions) {
+        CNNNetworkHelper::setOutDataPrecision(layer, getPrecisionBeforeParentDequantizationScaleShift(layer));
+    }
+
+    CNNNetworkHelper::removeLayer(context.network, scaleShift);
+    context.removeLayer(*scaleShift);
+
+    addDequantizationLayer(context, layer, dequantizationScales, dequantizationShifts);
+}
+
+bool ShuffleChannelsTransformation::isPrecisionPreserved(const CNNLayer& layer) const noexcept {
+    return true;
+}
@@ -11,6 +11,10 @@ using namespace InferenceEngine::details;
 
 TransformationContext::TransformationContext(ICNNNetwork& network)
     : network(network), layers(CNNNetSortTopologically(network)) {
+    for (size_t i = 0lu; i < layers.size(); ++i) {
+        layerIndices[layers[i]->name] = i;
+    }
+
     auto it = details::CNNNetworkIterator(&network);
     auto end = details::CNNNetworkIterator();
     while (it != end) {
@@ -21,10 +25,9 @@ TransformationContext::TransformationContext(ICNNNetwork& network)
 }
 
 void TransformationContext::removeLayer(const CNNLayer& layer) {
-    for (size_t i = 0lu; i < layers.size(); ++i) {
-        if ((layers[i] != nullptr) && (layers[i]->name == layer.name)) {
-            layers[i] = nullptr;
-            break;
-        }
+    const auto it = layerIndices.find(layer.name);
+    if (it != layerIndices.end()) {
+        layers[it->second] = nullptr;
+        layerIndices.erase(it);
     }
 }
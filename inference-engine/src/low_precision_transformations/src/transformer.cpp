@@ -31,6 +31,7 @@
 #include "low_precision_transformations/fully_connected.hpp"
 #include "low_precision_transformations/fuse_fake_quantize_and_scale_shift.hpp"
 #include "low_precision_transformations/gemm.hpp"
+#include "low_precision_transformations/interp.hpp"
 #include "low_precision_transformations/mvn.hpp"
 #include "low_precision_transformations/permute.hpp"
 #include "low_precision_transformations/pooling.hpp"
@@ -38,6 +39,7 @@
 #include "low_precision_transformations/power.hpp"
 #include "low_precision_transformations/reshape.hpp"
 #include "low_precision_transformations/scaleshift_to_convolution.hpp"
+#include "low_precision_transformations/shuffle_channels.hpp"
 #include "low_precision_transformations/squeeze.hpp"
 #include "low_precision_transformations/eltwise.hpp"
 #include "low_precision_transformations/normalize.hpp"
@@ -207,6 +209,8 @@ LowPrecisionTransformations LowPrecisionTransformer::getAllTransformations(const
             { "resample", LayerTransformationPtr(new ResampleTransformation(params)) },
             { "power", LayerTransformationPtr(new PowerTransformation(params)) },
             { "depthtospace", LayerTransformationPtr(new DepthToSpaceTransformation(params)) },
+            { "shufflechannels", LayerTransformationPtr(new ShuffleChannelsTransformation(params)) },
+            { "interp", LayerTransformationPtr(new InterpTransformation(params)) },
             { "normalize", LayerTransformationPtr(new NormalizeTransformation(params)) }
         }),
         std::map<std::string, LayerTransformationPtr>({
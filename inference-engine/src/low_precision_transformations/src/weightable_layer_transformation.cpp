@@ -96,12 +96,21 @@ bool WeightableLayerTransformation::isQuantized(const CNNLayer& layer) const noe
         return false;
     }
 
-    if (CNNNetworkHelper::isQuantizedConstWeights(layer)) {
-        const Blob::Ptr weightsBlob = CNNNetworkHelper::getWeights(layer, roundQuantizedValues);
-        if ((weightsBlob == nullptr) || (!CNNNetworkHelper::isBlobPrecisionSupported(weightsBlob->getTensorDesc().getPrecision()))) {
+    if ((minQuantizedOutputChannels != 0ul) && ((layer.type == "FullyConnected") || isDepthwise(layer))) {
+        // FullyConnected output channels are the innermost dimension
+        const size_t outputChannels = layer.type == "FullyConnected" ?
+            layer.outData[0]->getDims().back() :
+            CNNNetworkHelper::getOutputChannelsCount(layer);
+        if (outputChannels < minQuantizedOutputChannels) {
+            // INT8 is slower than original precision here: dequantization and reorders are not amortized
             return false;
         }
+    }
 
+    if (CNNNetworkHelper::isQuantizedConstWeights(layer)) {
+        if (!CNNNetworkHelper::isBlobPrecisionSupported(CNNNetworkHelper::getWeightsPrecision(layer))) {
+            return false;
+        }
 
         const Blob::Ptr biasesBlob = CNNNetworkHelper::getBiases(layer);
         if ((biasesBlob != nullptr) && (!CNNNetworkHelper::isBlobPrecisionSupported(biasesBlob->getTensorDesc().getPrecision()))) {
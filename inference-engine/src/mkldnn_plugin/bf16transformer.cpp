@@ -69,6 +69,7 @@ void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network) {
 
     // convert all edges back to FP32 on demand
     optimizeToFloat(network);
+    minimizeConverts(network);
 }
 
 void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
@@ -229,6 +230,53 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
     return marked;
 }
 
+void BF16Transformer::minimizeConverts(InferenceEngine::CNNNetwork &network) {
+    std::set<DataPtr> immutable;
+    for (auto input : network.getInputsInfo()) {
+        immutable.insert(input.second->getInputData());
+    }
+    for (auto output : network.getOutputsInfo()) {
+        immutable.insert(output.second);
+    }
+
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    for (auto iter : sortedLayers) {
+        if (_multiinput.find(iter->type) == _multiinput.end() || iter->outData.size() != 1) {
+            continue;
+        }
+        DataPtr output = iter->outData[0];
+        if (output->getPrecision() != Precision::BF16 || immutable.find(output) != immutable.end()) {
+            continue;
+        }
+
+        size_t fp32Inputs = 0, bf16Inputs = 0;
+        for (size_t i = 0; i < iter->insData.size(); i++) {
+            auto precision = iter->insData[i].lock()->getPrecision();
+            if (precision == Precision::FP32) {
+                fp32Inputs++;
+            } else if (precision == Precision::BF16) {
+                bf16Inputs++;
+            }
+        }
+
+        // the consumers compute in the precision of their outputs, init layers would compute in FP32 if they got
+        // an FP32 input, so the layers in front of them are kept in BF16
+        size_t bf16Consumers = 0;
+        bool toInitLayer = false;
+        for (auto inputTo : getInputTo(output)) {
+            if (_initbf16.find(inputTo.second->type) != _initbf16.end()) {
+                toInitLayer = true;
+            } else if (inputTo.second->outData.empty() || inputTo.second->outData[0]->getPrecision() == Precision::BF16) {
+                bf16Consumers++;
+            }
+        }
+
+        if (!toInitLayer && fp32Inputs > bf16Inputs + bf16Consumers) {
+            output->setPrecision(Precision::FP32);
+        }
+    }
+}
+
 InferenceEngine::MemoryBlob::Ptr BF16Transformer::convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr tweights) {
     TensorDesc td(Precision::FP32, tweights->getTensorDesc().getDims(), tweights->getTensorDesc().getLayout());
     MemoryBlob::Ptr weightsFP32 = make_shared_blob<float>(td);
@@ -60,6 +60,16 @@ public:
     */
     void convertToBFloat16(InferenceEngine::CNNNetwork &network);
 
+    /**
+     * Decreases the number of FP32<->BF16 conversions around the layers having several inputs
+     *
+     * Every input of a multi-input layer which is not in the precision of the layer gets a conversion. If the
+     * output of such a layer is BF16 while most of its inputs are FP32, the layer is moved to FP32 provided that
+     * this takes fewer conversions than it adds for the consumers of the output computing in BF16. Layers feeding
+     * convolutions or fully connected layers are kept as is, those should get their inputs in BF16.
+     */
+    void minimizeConverts(InferenceEngine::CNNNetwork &network);
+
     InferenceEngine::MemoryBlob::Ptr convertBF16ToFloat(InferenceEngine::MemoryBlob::Ptr);
 };
 
@@ -10,6 +10,9 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -44,6 +47,21 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_PERF_COUNT_SAMPLING) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT_SAMPLING
+                                   << ". Expected only non-negative integer";
+            perfCountSampling = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES) hwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) hwPerfCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -58,6 +76,162 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only non-negative integer";
+            dynamicShapesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_SIZE
+                                   << ". Expected only non-negative integer";
+            primitivesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            weightsCacheDir = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_WEIGHTS) {
+            if (val == PluginConfigParams::YES) sharedWeights = true;
+            else if (val == PluginConfigParams::NO) sharedWeights = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_CONVOLUTION_TUNING) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CONVOLUTION_TUNING
+                                   << ". Expected only non-negative integer";
+            convolutionTuning = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {}
+            if (val_f < 0.f || val_f > 1.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE
+                                   << ". Expected only float number in the range [0, 1]";
+            sparseWeightsRate = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_SPLIT_WEIGHTS_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_SPLIT_WEIGHTS_SIZE
+                                   << ". Expected only non-negative integer";
+            numaSplitWeightsSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_TILE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TILE_SIZE
+                                   << ". Expected only non-negative integer";
+            tileSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_LATENCY_CRITICAL) {
+            if (val == PluginConfigParams::YES) latencyCritical = true;
+            else if (val == PluginConfigParams::NO) latencyCritical = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LATENCY_CRITICAL
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION) {
+            if (val == PluginConfigParams::YES) depthFirstExecution = true;
+            else if (val == PluginConfigParams::NO) depthFirstExecution = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_CONCURRENT_NODES_EXECUTION) {
+            if (val == PluginConfigParams::YES) concurrentNodesExecution = true;
+            else if (val == PluginConfigParams::NO) concurrentNodesExecution = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CONCURRENT_NODES_EXECUTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SELECTIVE_INT8) {
+            if (val == PluginConfigParams::YES) selectiveInt8 = true;
+            else if (val == PluginConfigParams::NO) selectiveInt8 = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SELECTIVE_INT8
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_WARMUP) {
+            if (val == PluginConfigParams::YES)
+                warmupMode = WarmupMode::Inference;
+            else if (val == PluginConfigParams::WARMUP_MEMORY)
+                warmupMode = WarmupMode::Memory;
+            else if (val == PluginConfigParams::NO)
+                warmupMode = WarmupMode::None;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_WARMUP
+                                   << ". Expected only YES/NO/" << PluginConfigParams::WARMUP_MEMORY;
+        } else if (key == PluginConfigParams::KEY_MAX_QUEUED_INFER_REQUESTS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {}
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_MAX_QUEUED_INFER_REQUESTS
+                                   << ". Expected only non-negative integer";
+            maxQueuedRequests = val_i;
+        } else if (key == PluginConfigParams::KEY_QUEUED_INFER_REQUESTS_POLICY) {
+            if (val == PluginConfigParams::QUEUE_REJECT)
+                blockQueuedRequests = false;
+            else if (val == PluginConfigParams::QUEUE_BLOCK)
+                blockQueuedRequests = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_QUEUED_INFER_REQUESTS_POLICY
+                                   << ". Expected only " << PluginConfigParams::QUEUE_REJECT << "/"
+                                   << PluginConfigParams::QUEUE_BLOCK;
+        } else if (key == PluginConfigParams::KEY_CPU_EARLY_EXITS) {
+            std::vector<std::pair<std::string, float>> exits;
+            std::stringstream exitsStream(val);
+            std::string exit;
+            while (std::getline(exitsStream, exit, ',')) {
+                auto separator = exit.rfind(':');
+                float threshold = 0.f;
+                bool valid = separator != std::string::npos && separator != 0;
+                if (valid) {
+                    try {
+                        size_t parsed = 0;
+                        threshold = std::stof(exit.substr(separator + 1), &parsed);
+                        valid = parsed == exit.size() - separator - 1;
+                    } catch (const std::exception&) {
+                        valid = false;
+                    }
+                }
+                if (!valid)
+                    THROW_IE_EXCEPTION << "Wrong value " << exit << " for property key " << PluginConfigParams::KEY_CPU_EARLY_EXITS
+                                       << ". Expected only comma separated output:threshold pairs";
+                exits.emplace_back(exit.substr(0, separator), threshold);
+            }
+            earlyExits = exits;
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_SOLVER) {
+            if (val == PluginConfigParams::CPU_MEMORY_SOLVER_FIRST_FIT)
+                memorySolverStrategy = MemorySolver::Strategy::FirstFit;
+            else if (val == PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT)
+                memorySolverStrategy = MemorySolver::Strategy::BestFit;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_SOLVER
+                                   << ". Expected only " << PluginConfigParams::CPU_MEMORY_SOLVER_FIRST_FIT << "/"
+                                   << PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT;
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES)
+                hugePages = PageType::HugeTlb2MB;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_1GB)
+                hugePages = PageType::HugeTlb1GB;
+            else if (val == PluginConfigParams::NO)
+                hugePages = PageType::Default;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only YES/NO/" << PluginConfigParams::CPU_HUGE_PAGES_1GB;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -91,6 +265,8 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     }
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
+    // the streams of a latency critical network do not wait for the system to wake them up
+    streamExecutorConfig._busyWait = latencyCritical;
 
     updateProperties();
 }
@@ -111,6 +287,11 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_PERF_COUNT_SAMPLING, std::to_string(perfCountSampling) });
+        if (hwPerfCounters)
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::NO });
         if (exclusiveAsyncRequests == true)
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
@@ -121,8 +302,62 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(dynamicShapesCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_PRIMITIVES_CACHE_SIZE, std::to_string(primitivesCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_CACHE_DIR, weightsCacheDir });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_WEIGHTS,
+                         sharedWeights ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_CONVOLUTION_TUNING, std::to_string(convolutionTuning) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, std::to_string(sparseWeightsRate) });
+        _config.insert({ PluginConfigParams::KEY_CPU_NUMA_SPLIT_WEIGHTS_SIZE, std::to_string(numaSplitWeightsSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_TILE_SIZE, std::to_string(tileSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_CRITICAL,
+                         latencyCritical ? PluginConfigParams::YES : PluginConfigParams::NO });
+        if (depthFirstExecution)
+            _config.insert({ PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION, PluginConfigParams::NO });
+        if (selectiveInt8)
+            _config.insert({ PluginConfigParams::KEY_CPU_SELECTIVE_INT8, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SELECTIVE_INT8, PluginConfigParams::NO });
+        if (concurrentNodesExecution)
+            _config.insert({ PluginConfigParams::KEY_CPU_CONCURRENT_NODES_EXECUTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_CONCURRENT_NODES_EXECUTION, PluginConfigParams::NO });
+        if (warmupMode == WarmupMode::Inference)
+            _config.insert({ PluginConfigParams::KEY_WARMUP, PluginConfigParams::YES });
+        else if (warmupMode == WarmupMode::Memory)
+            _config.insert({ PluginConfigParams::KEY_WARMUP, PluginConfigParams::WARMUP_MEMORY });
+        else
+            _config.insert({ PluginConfigParams::KEY_WARMUP, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_MAX_QUEUED_INFER_REQUESTS, std::to_string(maxQueuedRequests) });
+        _config.insert({ PluginConfigParams::KEY_QUEUED_INFER_REQUESTS_POLICY,
+                         blockQueuedRequests ? PluginConfigParams::QUEUE_BLOCK : PluginConfigParams::QUEUE_REJECT });
+        if (memorySolverStrategy == MemorySolver::Strategy::BestFit)
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_SOLVER, PluginConfigParams::CPU_MEMORY_SOLVER_FIRST_FIT });
+        std::string exits;
+        for (auto&& exit : earlyExits) {
+            std::stringstream exitStream;
+            exitStream << exit.first << ':' << exit.second;
+            exits += (exits.empty() ? "" : ",") + exitStream.str();
+        }
+        _config.insert({ PluginConfigParams::KEY_CPU_EARLY_EXITS, exits });
+        if (hugePages == PageType::HugeTlb1GB)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::CPU_HUGE_PAGES_1GB });
+        else if (hugePages == PageType::HugeTlb2MB)
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        _config.insert({ PluginConfigParams::KEY_CPU_NETWORK_PRIORITY, std::to_string(streamExecutorConfig._priority) });
+        for (auto&& key : { PluginConfigParams::KEY_CPU_STREAMS_CPU_LISTS, PluginConfigParams::KEY_CPU_RESERVED_CPUS,
+                            PluginConfigParams::KEY_CPU_BIND_SMT_SIBLINGS }) {
+            _config.insert({ key, streamExecutorConfig.GetConfig(key).as<std::string>() });
+        }
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         if (!with_cpu_x86_bfloat16())
             enforceBF16 = false;
@@ -6,7 +6,11 @@
 
 #include <string>
 #include <map>
+#include <utility>
+#include <vector>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
+#include "utils/huge_pages.h"
 
 namespace MKLDNNPlugin {
 
@@ -25,14 +29,48 @@ struct Config {
         On,
     };
 
+    enum class WarmupMode {
+        None,
+        Memory,
+        Inference,
+    };
+
     bool collectPerfCounters = false;
+    int perfCountSampling = 0;
+    bool hwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int dynamicShapesCacheSize = 0;
+    int primitivesCacheSize = 0;
+    // the directory of the reordered weights shared between processes, empty string disables it
+    std::string weightsCacheDir;
+    // the reordered weights are shared with the other executable networks, not only between the streams
+    bool sharedWeights = false;
+    int convolutionTuning = 0;
+    float sparseWeightsRate = 0.f;
+    int numaSplitWeightsSize = 0;
+    int tileSize = 0;
+    // the streams spin for the inferences and the memory of the graphs is prefaulted and locked
+    bool latencyCritical = false;
+    bool depthFirstExecution = false;
+    bool selectiveInt8 = false;
+    bool concurrentNodesExecution = false;
+    // the network outputs the inference may stop after, with the confidence thresholds, in the order of the priority
+    std::vector<std::pair<std::string, float>> earlyExits;
+    WarmupMode warmupMode = WarmupMode::None;
+    // the inferences allowed to wait for the busy streams, 0 does not limit them
+    int maxQueuedRequests = 0;
+    bool blockQueuedRequests = false;
+    MemorySolver::Strategy memorySolverStrategy = MemorySolver::Strategy::FirstFit;
+    // the preferred pages of the intermediate tensors, PageType::Default disables huge pages
+    PageType hugePages = PageType::Default;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
+    // the operations per byte of the network the AUTO streams were adjusted to, 0 if they were not
+    double flopsPerByte = 0;
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
@@ -72,6 +72,59 @@ public:
         }
     }
 
+    /**
+     * @brief Converts the input to FP32 and subtracts the mean in the same pass over the data. The output has
+     * the layout of the input. Without the mean the input of any rank is only converted.
+     */
+    template<typename T>
+    void Convert(const MKLDNNDims &inputDims, const T *input, float *output, InferenceEngine::Layout layout) const {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        if ((!meanBuffer || !meanBuffer->size()) && meanValues.empty()) {
+            InferenceEngine::parallel_for(static_cast<size_t>(inputDims.size()), [&](size_t i) {
+                output[i] = static_cast<float>(input[i]);
+            });
+            return;
+        }
+
+        if (inputDims.ndims() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+
+        if (layout != InferenceEngine::NCHW && layout != InferenceEngine::NHWC) {
+            THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+        }
+
+        int MB = inputDims[0];
+        int srcSize = inputDims.size() / MB;
+
+        if (meanBuffer && meanBuffer->size()) {
+            const float * meanBufferValues = meanBuffer->readOnly();
+
+            InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                output[srcSize * mb + i] = static_cast<float>(input[srcSize * mb + i]) - meanBufferValues[i];
+            });
+        } else {
+            int C = inputDims[1];
+            srcSize /= inputDims[1];
+
+            if (layout == InferenceEngine::NCHW) {
+                InferenceEngine::parallel_for2d(MB, C, [&](int mb, int c) {
+                    const T *src = input + (mb * C + c) * srcSize;
+                    float *dst = output + (mb * C + c) * srcSize;
+                    const float mean = meanValues[c];
+                    for (int i = 0; i < srcSize; i++)
+                        dst[i] = static_cast<float>(src[i]) - mean;
+                });
+            } else {
+                InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                    for (int c = 0; c < C; c++)
+                        output[(mb * srcSize + i) * C + c] = static_cast<float>(input[(mb * srcSize + i) * C + c]) - meanValues[c];
+                });
+            }
+        }
+    }
+
 private:
     std::vector<float> meanValues;
 
@@ -64,5 +64,7 @@ enum impl_desc_type {
 };
 
 impl_desc_type parse_impl_name(std::string impl_desc_name);
+// the name of the implementation type, e.g. jit_avx512_winograd, which is parsed back by parse_impl_name
+std::string impl_type_to_string(impl_desc_type type);
 
 }  // namespace MKLDNNPlugin
@@ -13,6 +13,8 @@
 #include "bf16transformer.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
+#include <network_serializer.h>
+#include <xml_parse_utils.h>
 #include <threading/ie_executor_manager.hpp>
 #include "low_precision_transformations/convolution.hpp"
 #include "low_precision_transformations/eltwise.hpp"
@@ -21,8 +23,11 @@
 #include "low_precision_transformations/transformer.hpp"
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_load_time_profile.hpp>
 #include <threading/ie_thread_affinity.hpp>
+#include "utils/numa_utils.h"
 #include <algorithm>
+#include <set>
 #include <unordered_set>
 #include <utility>
 
@@ -39,11 +44,15 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     bool applyTransformations) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _numaNodesWeights(numaNodesWeights),
+    _dynamicShapesCacheSize{cfg.dynamicShapesCacheSize},
+    _perfSampling{std::make_shared<PerfSampling>(cfg.perfCountSampling)} {
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNet(network);
 
@@ -57,7 +66,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     NetPass::ConvertPrecision(*_clonedNetwork, Precision::BOOL, Precision::U8);
     NetPass::ConvertPrecision(*_clonedNetwork, Precision::U16, Precision::I32);
 
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+    if (applyTransformations && _cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+        IE_LOAD_PHASE("low_precision");
         auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                     true,  // quantizeOutputs
                                                     true,  // weightsToConst
@@ -66,6 +76,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                                     true,  // roundQuantizedValues
                                                     true,  // updateBiases
                                                     true);  // supportAsymmetricQuantization
+        if (_cfg.selectiveInt8) {
+            // 16 int32 accumulators fill an AVX-512 register, narrower layers run faster in FP32
+            params.setMinQuantizedOutputChannels(16ul);
+        }
         LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params).
             add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
             addCleanup<ScaleShiftToConvolutionTransformation>(
@@ -110,23 +124,25 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
+    auto streamExecutorConfig = IStreamsExecutor::Config::MakeDefaultMultiThreaded(cfg.streamExecutorConfig);
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
-        const int env_threads = parallel_get_env_threads();
-        const auto& numa_nodes = getAvailableNUMANodes();
-        const auto numa_nodes_num = numa_nodes.size();
-        auto streamExecutorConfig = cfg.streamExecutorConfig;
-        // use logical cores only for single-socket targets in throughput mode
-        const int hw_cores = streamExecutorConfig._streams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
-        const int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
-        streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
-                                                ? std::max(1, threads/streamExecutorConfig._streams)
-                                                : threads;
         streamExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
     }
+    const auto streams = std::max(1, streamExecutorConfig._streams);
+    _streamsConfiguration = {
+        {"streams", static_cast<float>(streams)},
+        {"threads_per_stream", static_cast<float>(streamExecutorConfig._threadsPerStream)},
+        {"optimal_infer_requests", static_cast<float>(streams)},
+        {"flops_per_byte", static_cast<float>(cfg.flopsPerByte)},
+    };
+    if (cfg.maxQueuedRequests > 0) {
+        _admissionControl = std::make_shared<AdmissionControl>(static_cast<size_t>(streams + cfg.maxQueuedRequests),
+            cfg.blockQueuedRequests ? AdmissionControl::Policy::Block : AdmissionControl::Policy::Reject);
+    }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
@@ -134,25 +150,80 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _callbackExecutor = _taskExecutor;
     }
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
+    // the set of counters is fixed here, so infer requests can update them concurrently without locking
+    InputsDataMap inputsInfo;
+    _clonedNetwork->getInputsInfo(inputsInfo);
+    for (auto&& input : inputsInfo) {
+        _zeroCopyInferences[input.first] = 0;
+    }
+    OutputsDataMap outputsInfo;
+    _clonedNetwork->getOutputsInfo(outputsInfo);
+    for (auto&& output : outputsInfo) {
+        _zeroCopyInferences[output.first] = 0;
+    }
+
+    if (_dynamicShapesCacheSize > 0) {
+        if (_cfg.enableDynamicBatch) {
+            THROW_IE_EXCEPTION << "Dynamic shapes cannot be used together with dynamic batch";
         }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
+        for (auto&& input : inputsInfo) {
+            _networkShapes[input.first] = input.second->getTensorDesc().getDims();
         }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
-        return graph;
-    }};
+    }
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    if (_cfg.tileSize > 0) {
+        if (_dynamicShapesCacheSize > 0 || _cfg.enableDynamicBatch) {
+            THROW_IE_EXCEPTION << "Tiling cannot be used together with dynamic shapes or dynamic batch";
+        }
+        _tiling = std::make_shared<TilingInfo>(GetTilingInfo(*_clonedNetwork, static_cast<size_t>(_cfg.tileSize)));
+        // the graphs are compiled for the window of a tile, the requests split the images into such windows
+        auto dims = inputsInfo.begin()->second->getTensorDesc().getDims();
+        dims[2] = _tiling->window(0);
+        dims[3] = _tiling->window(1);
+        ResponseDesc resp;
+        if (_clonedNetwork->reshape({{inputsInfo.begin()->first, dims}}, &resp) != StatusCode::OK) {
+            THROW_IE_EXCEPTION << "Cannot reshape the network " << _name << " for the window of a tile: " << resp.msg;
+        }
+        // e.g. a global pooling breaks the correspondence of the output pixels to the input ones
+        for (auto&& output : outputsInfo) {
+            const auto& outputDims = output.second->getTensorDesc().getDims();
+            const auto& stride = _tiling->outputStrides.at(output.first);
+            if (outputDims[2] * stride[0] != dims[2] || outputDims[3] * stride[1] != dims[3]) {
+                THROW_IE_EXCEPTION << "The output " << output.first << " of the network " << _name
+                                   << " does not correspond to the input pixels, so it cannot be tiled";
+            }
+        }
+    }
+
+    if (_cfg.primitivesCacheSize > 0) {
+        _primitivesCache = std::make_shared<MKLDNNPrimitivesCache>(_cfg.primitivesCacheSize);
+    }
+    if (!_cfg.weightsCacheDir.empty()) {
+        _weightsStore = std::make_shared<MKLDNNWeightsStore>(_cfg.weightsCacheDir);
+    }
+    if (_cfg.convolutionTuning > 0) {
+        _implTuner = std::make_shared<MKLDNNImplTuner>(_cfg.convolutionTuning);
+    }
+
+    {
+        IE_LOAD_PHASE("graphs");
+        // graphs are created by the threads of the streams, their phases are nested in the current one
+        auto profile = LoadTimeProfile::GetCurrent();
+        auto phase = LoadTimeProfile::GetCurrentPhase();
+        _graphs = decltype(_graphs){[this, profile, phase] {
+            LoadTimeProfile::Scope profileScope(profile, phase);
+            // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+            //       is fixed and does not change content of network passed (CVS-26420)
+            auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+            auto graph = CreateGraph(*localNetwork);
+            Warmup(*graph);
+            // the warmup inference is not sampled
+            graph->SetPerfSampling(_perfSampling);
+            return graph;
+        }};
+
+        _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -168,10 +239,161 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
+                auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(node.get());
+                auto appendState = memoryNode ? memoryNode->getAppendState() : nullptr;
+                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store, appendState));
             }
         }
     }
+    if (_dynamicShapesCacheSize > 0 && !memoryStates.empty()) {
+        THROW_IE_EXCEPTION << "Dynamic shapes are not supported for networks with memory layers";
+    }
+
+    // the graphs of all the streams have the same states, so the sessions can be inferred by any of them
+    auto stateSizes = _graphs.begin()->get()->GetStateSizes();
+    if (!stateSizes.empty()) {
+        _stateSessions = std::make_shared<MKLDNNStateSessions>(stateSizes);
+    }
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(const ICNNNetwork &network) {
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
+    }
+    graph->primitivesCache = _primitivesCache;
+    graph->weightsStore = _weightsStore;
+    graph->implTuner = _implTuner;
+    int numaNode = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+    }
+    graph->CreateGraph(network, extensionManager, _numaNodesWeights[numaNode]);
+    // threads of the stream are pinned to the NUMA node, so the memory is placed there as well
+    // instead of relying on the first touch which could be done by any thread of the allocator
+    if (nullptr != streamExecutor && getAvailableNUMANodes().size() > 1 &&
+        _cfg.streamExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::NUMA) {
+        graph->BindMemoryToNumaNode(numaNode);
+    }
+    return graph;
+}
+
+void MKLDNNExecNetwork::Warmup(MKLDNNGraph& graph) {
+    Config::WarmupMode mode;
+    bool latencyCritical = false;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        mode = _cfg.warmupMode;
+        latencyCritical = _cfg.latencyCritical;
+    }
+    // the inferences of a latency critical network must not page fault
+    if (latencyCritical && mode == Config::WarmupMode::None)
+        mode = Config::WarmupMode::Memory;
+    if (mode == Config::WarmupMode::None)
+        return;
+    // run by the thread of the stream, so the pages are placed on its NUMA node and the kernels see its caches
+    IE_LOAD_PHASE("warmup");
+    graph.PrefaultMemory();
+    // the pages are still used when the limit of the locked memory is reached, they may be swapped out only
+    if (latencyCritical)
+        graph.LockMemory();
+    if (mode != Config::WarmupMode::Inference)
+        return;
+    // an inference would change the states, while they must be zero for the first user inference
+    for (auto& node : graph.GetNodes()) {
+        if (node->getType() == MemoryInput)
+            return;
+    }
+    // inputs which are not bound to user blobs yet are filled with zeros on allocation
+    graph.Infer();
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const ICNNNetwork::InputShapes& shapes) {
+    if (_dynamicShapesCacheSize == 0 || shapes == _networkShapes) {
+        return _graphs.local();
+    }
+    // the topology and all the plugin transformations are kept: only shape inference, primitive creation
+    // and memory allocation are done again, while weights are taken from the cache of the NUMA node
+    auto& shapeGraphs = _shapeGraphs.local();
+    auto it = std::find_if(shapeGraphs.begin(), shapeGraphs.end(), [&] (const ShapeGraphs::value_type& cached) {
+        return cached.first == shapes;
+    });
+    if (it != shapeGraphs.end()) {
+        shapeGraphs.splice(shapeGraphs.begin(), shapeGraphs, it);
+        return shapeGraphs.front().second;
+    }
+
+    auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    ResponseDesc resp;
+    if (localNetwork->reshape(shapes, &resp) != StatusCode::OK) {
+        THROW_IE_EXCEPTION << "Cannot reshape the network " << _name << " for input shapes: " << resp.msg;
+    }
+    shapeGraphs.emplace_front(shapes, CreateGraph(*localNetwork));
+    shapeGraphs.front().second->SetPerfSampling(_perfSampling);
+    if (shapeGraphs.size() > static_cast<size_t>(_dynamicShapesCacheSize)) {
+        shapeGraphs.pop_back();
+    }
+    return shapeGraphs.front().second;
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    // The network is stored after all plugin specific transformations (legacy conversion, LPT, BF16, unrolling),
+    // so ImportNetwork needs to create MKLDNN graphs only.
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& input : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& output : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    // the implementations chosen by the tuning are stored as the priorities of the layers, so they are not timed again
+    auto exportedNetwork = _clonedNetwork;
+    auto tunedImplementations = _implTuner ? _implTuner->getSelected() : std::map<std::string, impl_desc_type>{};
+    if (!tunedImplementations.empty()) {
+        exportedNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
+        for (auto&& tuned : tunedImplementations) {
+            CNNLayerPtr layer;
+            if (exportedNetwork->getLayerByName(tuned.first.c_str(), layer, nullptr) != OK ||
+                layer->params.find("PrimitivesPriority") != layer->params.end())
+                continue;
+            layer->params["PrimitivesPriority"] = "cpu:" + impl_type_to_string(tuned.second);
+        }
+    }
+
+    pugi::xml_document networkDoc;
+    auto dataSize = static_cast<std::uint64_t>(Serialization::FillXmlDoc(*exportedNetwork, networkDoc));
+    networkDoc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    Serialization::SerializeBlobs(networkModel, *exportedNetwork);
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -188,12 +410,24 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
     auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    asyncRequestImpl->SetPipelineStatistics(_pipelineStatistics);
+    asyncRequestImpl->SetAdmissionControl(_admissionControl);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
 }
 
+void MKLDNNExecNetwork::InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs) {
+    int streams;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        streams = _cfg.streamExecutorConfig._streams;
+    }
+    // the synchronous requests run on the threads of the streams, as MKLDNNAsyncInferRequest runs them
+    InferBatchOnTaskExecutor(inputs, outputs, static_cast<size_t>(std::max(streams, 1)));
+}
+
 void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -201,9 +435,31 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     graphPtr = _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config, ResponseDesc *resp) {
+    if (config.empty()) {
+        THROW_IE_EXCEPTION << "The list of configuration values is empty";
+    }
+    std::map<std::string, std::string> properties;
+    for (auto&& entry : config) {
+        if (entry.first != PluginConfigParams::KEY_PERF_COUNT_SAMPLING) {
+            THROW_IE_EXCEPTION << "The following config value cannot be changed dynamically for ExecutableNetwork: "
+                               << entry.first;
+        }
+        properties[entry.first] = entry.second.as<std::string>();
+    }
+    // the graphs keep their configs, as they may infer at the moment, and read the rate from the shared sampling
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    _cfg.readProperties(properties);
+    _perfSampling->setRate(_cfg.perfCountSampling);
+}
+
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
+    if (name == PluginConfigParams::KEY_PERF_COUNT_SAMPLING) {
+        result = std::to_string(_perfSampling->getRate());
+        return;
+    }
     Config engConfig = _graphs.begin()->get()->getProperty();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -227,6 +483,18 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(ZERO_COPY_INFERENCES));
+        metrics.push_back(METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT));
+        metrics.push_back(METRIC_KEY(MEMORY_PAGE_TYPES));
+        metrics.push_back(METRIC_KEY(PRIMITIVES_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(PRIMITIVES_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(LOAD_TIME_PHASES));
+        metrics.push_back(METRIC_KEY(LOAD_PEAK_MEMORY));
+        metrics.push_back(METRIC_KEY(NETWORK_HOT));
+        metrics.push_back(METRIC_KEY(EXECUTOR_STATISTICS));
+        metrics.push_back(METRIC_KEY(LAYER_TIME_HISTOGRAMS));
+        metrics.push_back(METRIC_KEY(INFER_LATENCY_HISTOGRAM));
+        metrics.push_back(METRIC_KEY(STREAMS_CONFIGURATION));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -241,6 +509,61 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(ZERO_COPY_INFERENCES)) {
+        std::map<std::string, uint64_t> zeroCopyInferences;
+        for (auto&& counter : _zeroCopyInferences) {
+            zeroCopyInferences[counter.first] = counter.second.load();
+        }
+        result = IE_SET_METRIC(ZERO_COPY_INFERENCES, zeroCopyInferences);
+    } else if (name == METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT)) {
+        // weights are shared by the graphs of the same NUMA node, so each memory block is counted once
+        std::set<MKLDNNMemoryPtr> blocks;
+        for (auto&& graph : _graphs) {
+            for (auto&& block : graph->GetMemoryBlocks()) {
+                blocks.insert(block);
+            }
+        }
+        std::map<int, uint64_t> bytesPerNode;
+        for (auto&& block : blocks) {
+            GetMemoryPlacement(block->GetData(), block->GetSize(), bytesPerNode);
+        }
+        result = IE_SET_METRIC(NUMA_NODES_MEMORY_PLACEMENT, bytesPerNode);
+    } else if (name == METRIC_KEY(MEMORY_PAGE_TYPES)) {
+        std::map<MKLDNNMemoryPtr, PageType> blocks;
+        for (auto&& graph : _graphs) {
+            for (auto&& block : graph->GetMemoryBlocks()) {
+                blocks.emplace(block, graph->GetPageType(block));
+            }
+        }
+        std::map<std::string, uint64_t> bytesPerType;
+        for (auto&& block : blocks) {
+            bytesPerType[PageTypeName(block.second)] += block.first->GetSize();
+        }
+        result = IE_SET_METRIC(MEMORY_PAGE_TYPES, bytesPerType);
+    } else if (name == METRIC_KEY(PRIMITIVES_CACHE_HITS)) {
+        auto statistics = _primitivesCache ? _primitivesCache->getStatistics() : MKLDNNPrimitivesCache::Statistics{};
+        result = IE_SET_METRIC(PRIMITIVES_CACHE_HITS, statistics.hits);
+    } else if (name == METRIC_KEY(PRIMITIVES_CACHE_MISSES)) {
+        auto statistics = _primitivesCache ? _primitivesCache->getStatistics() : MKLDNNPrimitivesCache::Statistics{};
+        result = IE_SET_METRIC(PRIMITIVES_CACHE_MISSES, statistics.misses);
+    } else if (name == METRIC_KEY(LOAD_TIME_PHASES)) {
+        result = IE_SET_METRIC(LOAD_TIME_PHASES, _loadTimeProfile ? _loadTimeProfile->GetPhases() : LoadTimeProfile::Phases{});
+    } else if (name == METRIC_KEY(LOAD_PEAK_MEMORY)) {
+        result = IE_SET_METRIC(LOAD_PEAK_MEMORY, _loadTimeProfile ? _loadTimeProfile->GetPeakMemory() : 0);
+    } else if (name == METRIC_KEY(NETWORK_HOT)) {
+        bool hot = true;
+        for (auto&& graph : _graphs) {
+            hot = hot && graph->IsHot();
+        }
+        result = IE_SET_METRIC(NETWORK_HOT, hot);
+    } else if (name == METRIC_KEY(LAYER_TIME_HISTOGRAMS)) {
+        result = IE_SET_METRIC(LAYER_TIME_HISTOGRAMS, _perfSampling->getHistograms());
+    } else if (name == METRIC_KEY(INFER_LATENCY_HISTOGRAM)) {
+        result = IE_SET_METRIC(INFER_LATENCY_HISTOGRAM, _inferLatency.get());
+    } else if (name == METRIC_KEY(EXECUTOR_STATISTICS)) {
+        result = IE_SET_METRIC(EXECUTOR_STATISTICS, GetExecutorStatistics());
+    } else if (name == METRIC_KEY(STREAMS_CONFIGURATION)) {
+        result = IE_SET_METRIC(STREAMS_CONFIGURATION, _streamsConfiguration);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
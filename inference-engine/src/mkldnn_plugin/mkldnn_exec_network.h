@@ -8,14 +8,20 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_memory_state.h"
+#include "mkldnn_tiling.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
 #include <cnn_network_impl.hpp>
 #include <unordered_map>
+#include <list>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -29,13 +35,20 @@ public:
 
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
+    /**
+     * @param applyTransformations `false` if the network was already transformed by the plugin
+     *        (e.g. it was imported from a stream created by ExportImpl)
+     */
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      bool applyTransformations = true);
 
     ~MKLDNNExecNetwork() override = default;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config, InferenceEngine::ResponseDesc *resp) override;
+
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
@@ -44,9 +57,22 @@ public:
 
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    void InferBatch(const std::vector<InferenceEngine::BlobMap>& inputs,
+                    std::vector<InferenceEngine::BlobMap>& outputs) override;
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
+    /**
+     * @brief Returns the graph of the current stream which is compiled for the input shapes
+     * @details If the shapes differ from the network ones and KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE is set,
+     *          the graph is created from the reshaped network on the first use and cached for the stream
+     * @param shapes Dimensions of the network inputs
+     */
+    MKLDNNGraph::Ptr GetGraph(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+
 protected:
+    void ExportImpl(std::ostream& networkModel) override;
+
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
@@ -55,9 +81,35 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // number of inferences in which the graph used user blobs memory directly, per input / output name
+    std::map<std::string, std::atomic<uint64_t>> _zeroCopyInferences;
+    // the streams, the threads per stream and the intensity the network is executed with
+    std::map<std::string, float>                _streamsConfiguration;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::ICNNNetwork &network);
+    void Warmup(MKLDNNGraph& graph);
+
+    using ShapeGraphs = std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes, MKLDNNGraph::Ptr>>;
+
+    NumaNodesWeights&                           _numaNodesWeights;
+    InferenceEngine::ICNNNetwork::InputShapes   _networkShapes;
+    int                                         _dynamicShapesCacheSize = 0;
+    // the tiles the requests split the input images into, nullptr if KEY_CPU_TILE_SIZE is not set
+    TilingInfo::Ptr                             _tiling;
+    MKLDNNPrimitivesCache::Ptr                  _primitivesCache;
+    MKLDNNWeightsStore::Ptr                     _weightsStore;
+    MKLDNNImplTuner::Ptr                        _implTuner;
+    // graphs created for input shapes other than the network ones, the most recently used first
+    InferenceEngine::ThreadLocal<ShapeGraphs>   _shapeGraphs;
+    // the per layer histograms of the sampled inferences of all the graphs
+    PerfSampling::Ptr                           _perfSampling;
+    // the latencies of all the inferences of the requests
+    PerfHistogram                               _inferLatency;
+    // the states of the sessions of the requests, nullptr if the graphs have no states or cannot rebind them
+    MKLDNNStateSessions::Ptr                    _stateSessions;
 };
 
 }  // namespace MKLDNNPlugin
@@ -12,6 +12,11 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <mutex>
+#include <exception>
+#include <cstdint>
+#include <queue>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -20,6 +25,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
 #include <nodes/mkldnn_input_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 #include <nodes/mkldnn_reorder_node.h>
 
 #include <graph_tools.hpp>
@@ -28,12 +34,17 @@
 #include <net_pass.h>
 #include <details/ie_cnn_network_tools.h>
 #include <ie_memcpy.h>
+#include <ie_parallel.hpp>
+#include <ie_tracing.hpp>
+#include <ie_load_time_profile.hpp>
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
 #include "low_precision_transformations/transformer.hpp"
 
 #include "utils/blob_dump.h"
+#include "utils/huge_pages.h"
+#include "utils/numa_utils.h"
 
 /*****************************************************
  * Debug capability
@@ -61,6 +72,43 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// Extension nodes may use not thread safe implementations, inputs and memory nodes write the data of the
+// constants which are read by the other nodes, so they are processed sequentially and before the others
+bool IsSequentialLoadNode(const MKLDNNNodePtr& node) {
+    auto type = node->getType();
+    return type == Generic || type == Input || type == MemoryInput || type == MemoryOutput;
+}
+
+// runs the per node work of the graph compilation on all the threads, the nodes must not depend on each other
+template <typename F>
+void ParallelForNodes(const std::vector<MKLDNNNodePtr>& nodes, const F& func) {
+    std::vector<MKLDNNNodePtr> parallelNodes;
+    for (auto& node : nodes) {
+        if (IsSequentialLoadNode(node))
+            func(node);
+        else
+            parallelNodes.push_back(node);
+    }
+
+    std::exception_ptr error;
+    std::mutex errorGuard;
+    parallel_for(parallelNodes.size(), [&](size_t i) {
+        try {
+            func(parallelNodes[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorGuard);
+            if (!error)
+                error = std::current_exception();
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
     NetPass::CombineRNNSeq(net);
@@ -78,6 +126,9 @@ void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
     if (!ti_proc_ok)
         THROW_IE_EXCEPTION << "Plugin doesn't support Tensor Iterator in pure form. "
                               "None TI optimization pattern has been applied successfully";
+
+    // the input projections of the remaining loops run for all the iterations at once
+    NetPass::HoistTIInvariants(net);
 }
 
 template void MKLDNNGraph::ApplyUnrollPasses(TensorIterator::Body&);
@@ -88,10 +139,15 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
-
-    Replicate(net, extMgr);
+    // disable caching if graph was created only once and does not share the weights with other networks
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.dynamicShapesCacheSize > 0 || config.sharedWeights
+                   ? w_cache : nullptr;
+
+    IE_LOAD_PHASE("graph");
+    {
+        IE_LOAD_PHASE("replicate");
+        Replicate(net, extMgr);
+    }
     InitGraph();
     status = Ready;
 }
@@ -226,19 +282,26 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         }
     }
 
-    std::unordered_map<CNNLayerPtr, MKLDNNNodePtr> layer2node;
+    // layers and edges are enumerated once, nodes are found by layer indices
+    const CNNNetAdjacency adjacency(network);
+    std::vector<MKLDNNNodePtr> layer2node(adjacency.size());
+    auto layerNode = [&] (const CNNLayerPtr &layer) -> MKLDNNNodePtr {
+        const auto index = adjacency.indexOf(layer.get());
+        return index == CNNNetAdjacency::npos ? nullptr : layer2node[index];
+    };
     std::unordered_set<DataPtr> unused_data;  // nodes which has no consumers (output or just unused)
 
     auto _parent_port = [] (const DataPtr &data) -> int {
         auto parent = getCreatorLayer(data).lock();
-        for (int i = 0; parent->outData.size(); i++)
+        for (int i = 0; i < parent->outData.size(); i++)
             if (data == parent->outData[i])
                 return i;
         return -1;
     };
 
     // Replicate All Nodes in topological order
-    for (const auto layer : CNNNetSortTopologically(network)) {
+    for (const auto index : adjacency.sortTopologically()) {
+        const CNNLayerPtr &layer = adjacency.layer(index);
         CNNLayerPtr _layer = layer;
         if (layer->type == "Memory" && layer->GetParamAsString("index") == "1") {
             auto memoryId = layer->GetParamAsString("id");
@@ -250,18 +313,19 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
 
         const MKLDNNNodePtr node(MKLDNNNode::CreateNode(_layer, getEngine(), extMgr, weightsCache));
         graphNodes.push_back(node);
-        layer2node[layer] = node;
+        layer2node[index] = node;
 
         if (layer->params.count("originalLayersNames")) {
             node->originalLayers = layer->params["originalLayersNames"];
         }
 
+        const auto parents = adjacency.parents(index);
         for (int port = 0; port < layer->insData.size(); port++) {
-            auto data = layer->insData[port].lock();
-            auto parent_layer = getCreatorLayer(data).lock();
-            if (!parent_layer) continue;  // no parent means that it is input data node (or memory/const layer)
+            // no parent means that it is input data node (or memory/const layer)
+            if (parents[port] == CNNNetAdjacency::npos) continue;
 
-            auto parent_node = layer2node[parent_layer];
+            auto data = layer->insData[port].lock();
+            auto parent_node = layer2node[parents[port]];
 
             MKLDNNEdgePtr edge(new MKLDNNEdge(parent_node, node, _parent_port(data), port));
             node->addEdge(edge);
@@ -281,7 +345,7 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         const auto data = output.second;
 
         auto parent_layer = getCreatorLayer(data).lock();
-        auto parent_node = layer2node[parent_layer];
+        auto parent_node = layerNode(parent_layer);
 
         CNNLayerPtr layer(new CNNLayer({"out_" + output.first, "Output", data->getTensorDesc().getPrecision()}));
         layer->insData.push_back(data);
@@ -301,7 +365,7 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     // Add stub output node for unused data
     for (auto to_stub_data : unused_data) {
         auto parent_layer = getCreatorLayer(to_stub_data).lock();
-        auto parent_node = layer2node[parent_layer];
+        auto parent_node = layerNode(parent_layer);
 
         CNNLayerPtr layer(new CNNLayer({"stub_" + parent_layer->name, "Output", to_stub_data->getTensorDesc().getPrecision()}));
         layer->insData.push_back(to_stub_data);
@@ -317,7 +381,7 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     // Replicate input nodes
     for (const auto& input : inputs) {
         auto inputLayer = getCreatorLayer(input.second->getInputData()).lock();
-        inputNodes[input.first] = layer2node[inputLayer];
+        inputNodes[input.first] = layerNode(inputLayer);
 
         // Loading mean images
         MKLDNNDims outDims;
@@ -337,25 +401,61 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
 
-    SortTopologically();
-    InitNodes();
-    optimizer.ApplyCommonGraphOptimizations(*this);
-    SortTopologically();
+    {
+        IE_LOAD_PHASE("init_nodes");
+        SortTopologically();
+        InitNodes();
+    }
+    {
+        IE_LOAD_PHASE("common_optimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+        SortTopologically();
+    }
+    {
+        IE_LOAD_PHASE("init_descriptors");
+        InitDescriptors();
+
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+        InitEdges();
+    }
+    {
+        IE_LOAD_PHASE("impl_specific_optimizations");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
 
-    InitDescriptors();
+        SortTopologically();
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+        PrioritizeEarlyExits();
+
+        OrderAppendStates();
+
+        InitDepthFirstChains();
+    }
+    {
+        IE_LOAD_PHASE("allocate");
+        Allocate();
+    }
+    {
+        IE_LOAD_PHASE("create_primitives");
+        CreatePrimitives();
     }
-    InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    if (config.hugePages != PageType::Default) {
+        // the weights are already filled, so their pages can only be merged into huge pages in the background
+        for (auto& node : graphNodes) {
+            for (auto& memory : node->internalBlobMemory) {
+                if (memory && AdviseTransparentHugePages(memory->GetData(), memory->GetSize()))
+                    pageTypes[memory.get()] = PageType::TransparentHuge;
+            }
+        }
+    }
 
-    SortTopologically();
+    BindDepthFirstChains();
 
-    Allocate();
+    InitConcurrentGroups();
 
-    CreatePrimitives();
+    InitMemoryStateSwaps();
 
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
@@ -419,19 +519,23 @@ void MKLDNNGraph::InitNodes() {
 }
 
 void MKLDNNGraph::InitDescriptors() {
-    for (auto &node : graphNodes) {
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    for (auto &node : graphNodes) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
+    }
 #endif
+    // the supported descriptors of a node depend only on its own layer and the dims of its edges
+    ParallelForNodes(graphNodes, [&](const MKLDNNNodePtr& node) {
+        node->setImplTuner(implTuner);
         node->getSupportedDescriptors();
 
         node->initSupportedPrimitiveDescriptors();
         node->filterSupportedPrimitiveDescriptors();
-    }
+    });
 
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
@@ -458,10 +562,18 @@ void MKLDNNGraph::InitEdges() {
         uniqueLayerNames.insert(node->getCnnLayer()->name);
     }
 
+    size_t fp32ToBF16 = 0, bf16ToFP32 = 0;
     for (auto i = 0; i < numberOfEdges; i++) {
         if (graphEdges[i]->needReorder()) {
 #if defined (COMPILED_CPU_MKLDNN_REORDER_NODE)
             auto &edge = graphEdges[i];
+            auto inPrecision = edge->getInputDesc().getPrecision();
+            auto outPrecision = edge->getOutputDesc().getPrecision();
+            if (inPrecision == Precision::FP32 && outPrecision == Precision::BF16)
+                fp32ToBF16++;
+            if (inPrecision == Precision::BF16 && outPrecision == Precision::FP32)
+                bf16ToFP32++;
+
             std::string basicLayerName = edge->getParent()->getName() + "_" +
                                          reorderArgs(edge->getInputDesc(), edge->getOutputDesc()) + "_" +
                                          edge->getChild()->getName();
@@ -517,6 +629,7 @@ void MKLDNNGraph::InitEdges() {
 #endif
         }
     }
+    precisionConvertsReport = "fp32_to_bf16:" + std::to_string(fp32ToBF16) + ",bf16_to_fp32:" + std::to_string(bf16ToFP32);
 }
 
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
@@ -623,6 +736,22 @@ void MKLDNNGraph::AllocateWithReuse() {
             box.size =  std::max(e_size, box.size);
         }
 
+        // The images of a depth first chain are executed one after another, so the tensors
+        // the chain touches have to live from the beginning of the chain till its end
+        for (const auto &chain : depthFirstChains) {
+            if (box.finish < static_cast<int>(chain.begin) || box.start >= static_cast<int>(chain.end))
+                continue;
+            bool touched = false;
+            for (auto &edge : edge_clasters[i]) {
+                for (auto node : {edge->getParent(), edge->getChild()})
+                    touched |= node->execIndex >= static_cast<int>(chain.begin) && node->execIndex < static_cast<int>(chain.end);
+            }
+            if (touched) {
+                box.start = std::min(box.start, static_cast<int>(chain.begin));
+                box.finish = std::max(box.finish, static_cast<int>(chain.end) - 1);
+            }
+        }
+
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
@@ -635,6 +764,8 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+            // The new state becomes the state of MemoryInput once it is swapped at the end of inference
+            isConst |= edge->getChild()->getType() == MemoryOutput;
         }
 
         if (reuse_io_tensors) {
@@ -650,11 +781,24 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    MemorySolver memSolver(boxes, config.memorySolverStrategy);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    memoryReuseReport = std::string("solver:") +
+        (config.memorySolverStrategy == MemorySolver::Strategy::BestFit ? "best_fit" : "first_fit") +
+        ",allocated:" + std::to_string(total_size) +
+        ",peak:" + std::to_string(static_cast<size_t>(memSolver.maxDepth()) * alignment);
 
+    pageTypes.clear();
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    MKLDNNMemoryDesc workspaceDesc(TensorDesc(Precision::I8, {total_size}, Layout::C));
+    if (config.hugePages != PageType::Default && total_size > 0) {
+        workspaceBuffer = std::make_shared<HugePagesMemory>(total_size, config.hugePages);
+        memWorkspace->Create(workspaceDesc, workspaceBuffer->data());
+        pageTypes[memWorkspace.get()] = workspaceBuffer->type();
+    } else {
+        memWorkspace->Create(workspaceDesc);
+        workspaceBuffer.reset();
+    }
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
@@ -696,12 +840,482 @@ void MKLDNNGraph::Allocate() {
 }
 
 void MKLDNNGraph::CreatePrimitives() { IE_PROFILING_AUTO_SCOPE(MKLDNNGraph::CreatePrimitives)
-    for (auto& node : graphNodes) {
+    // the memory of all the edges is already allocated, so the primitives are created (JIT code is generated and
+    // the weights are reordered) independently
+    bool cachePrimitives = !config.batchLimit && depthFirstChains.empty();
+    ParallelForNodes(graphNodes, [&](const MKLDNNNodePtr& node) {
+        // dynamic batch changes descriptors of the primitives, so they cannot be reused by other graphs
+        if (cachePrimitives)
+            node->setPrimitivesCache(primitivesCache);
+        node->setWeightsStore(weightsStore);
         node->createPrimitive();
+    });
+}
+
+void MKLDNNGraph::BufferSwap::swap() const {
+    void* firstPtr = first.front()->getMemory().GetData();
+    void* secondPtr = second.front()->getMemory().GetData();
+    for (auto& edge : first)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(secondPtr);
+    for (auto& edge : second)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(firstPtr);
+}
+
+bool MKLDNNGraph::GetEdgesBoundTo(const MKLDNNMemory& memory, std::vector<MKLDNNEdgePtr>& edges) const {
+    auto bufferPtr = static_cast<uint8_t*>(memory.GetData());
+    size_t size = memory.GetSize();
+
+    edges.clear();
+    for (auto& edge : graphEdges) {
+        auto& edgeMemory = edge->getMemoryPtr();
+        if (!edgeMemory || !edgeMemory->GetPrimitivePtr())
+            continue;
+
+        auto ptr = static_cast<uint8_t*>(edgeMemory->GetPrimitive().get_data_handle());
+        if (ptr < bufferPtr || ptr >= bufferPtr + size)
+            continue;
+
+        // in-place views share the pointer of the buffer and keep their offsets in the descriptors,
+        // while the pointers into the middle of the buffer would be left behind
+        if (ptr != bufferPtr)
+            return false;
+
+        edges.push_back(edge);
+    }
+    return true;
+}
+
+bool MKLDNNGraph::InitBufferSwap(const MKLDNNMemory& first, const MKLDNNMemory& second, BufferSwap& swap, bool ioEdgesAllowed) const {
+    if (MKLDNNMemoryDesc(first.GetDescriptor()) != MKLDNNMemoryDesc(second.GetDescriptor()))
+        return false;
+
+    auto firstPtr = static_cast<uint8_t*>(first.GetData());
+    auto secondPtr = static_cast<uint8_t*>(second.GetData());
+    size_t size = first.GetSize();
+    if (firstPtr < secondPtr + size && secondPtr < firstPtr + size)
+        return false;
+
+    BufferSwap result;
+    if (!GetEdgesBoundTo(first, result.first) || !GetEdgesBoundTo(second, result.second) ||
+            result.first.empty() || result.second.empty())
+        return false;
+
+    for (auto edges : {&result.first, &result.second}) {
+        for (auto& edge : *edges) {
+            if (!ioEdgesAllowed && (edge->getParent()->getType() == Input || edge->getChild()->getType() == Output))
+                return false;
+            if (edge->getParent()->isConstant())
+                return false;
+        }
+    }
+
+    swap = std::move(result);
+    return true;
+}
+
+void MKLDNNGraph::InitMemoryStateSwaps() {
+    memoryStateSwaps.clear();
+    stateBindings.clear();
+    bool statesRebindable = true;
+    for (auto& node : graphNodes) {
+        if (node->getType() != MemoryOutput)
+            continue;
+
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        if (!memoryOutput || !memoryOutput->getInputNode())
+            continue;
+
+        // the length of an append state belongs to the graph, so the sessions cannot share it.
+        // The readers of the state rely on the zero rows after the valid prefix.
+        if (memoryOutput->getAppendState()) {
+            node->getChildEdgeAt(0)->getMemoryPtr()->FillZero();
+            statesRebindable = false;
+            continue;
+        }
+
+        // the state is kept in the output edge of MemoryInput, the new state is the input of MemoryOutput
+        BufferSwap stateSwap;
+        StateBinding binding;
+        if (InitBufferSwap(node->getChildEdgeAt(0)->getMemory(), node->getParentEdgeAt(0)->getMemory(), stateSwap, false)) {
+            memoryOutput->setStateSwapped(true);
+            binding.state = stateSwap.first;
+            binding.spare = stateSwap.second;
+            memoryStateSwaps.push_back(std::move(stateSwap));
+        } else if (!GetEdgesBoundTo(node->getChildEdgeAt(0)->getMemory(), binding.state) || binding.state.empty()) {
+            statesRebindable = false;
+        }
+        binding.size = node->getChildEdgeAt(0)->getMemory().GetSize();
+        stateBindings.push_back(std::move(binding));
+    }
+    if (!statesRebindable)
+        stateBindings.clear();
+}
+
+std::vector<size_t> MKLDNNGraph::GetStateSizes() const {
+    std::vector<size_t> sizes;
+    for (auto& binding : stateBindings)
+        sizes.push_back(binding.size);
+    return sizes;
+}
+
+void MKLDNNGraph::ExchangeStates(StateBuffers& buffers) {
+    if (buffers.states.size() != stateBindings.size() || buffers.spares.size() != stateBindings.size())
+        THROW_IE_EXCEPTION << "The state buffers do not match the states of the graph";
+
+    auto exchange = [](const std::vector<MKLDNNEdgePtr>& edges, void*& buffer) {
+        if (edges.empty())
+            return;
+        void* bound = edges.front()->getMemory().GetData();
+        for (auto& edge : edges)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(buffer);
+        buffer = bound;
+    };
+    for (size_t i = 0; i < stateBindings.size(); i++) {
+        exchange(stateBindings[i].state, buffers.states[i]);
+        exchange(stateBindings[i].spare, buffers.spares[i]);
+    }
+}
+
+void MKLDNNGraph::InitDepthFirstChains() {
+    depthFirstChains.clear();
+    if (!config.depthFirstExecution)
+        return;
+
+    // The nodes of a chain change the batch of their primitives to a single image, see ExecuteDepthFirstChain
+    auto isSuitableNode = [](const MKLDNNNodePtr& node) {
+        auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        return (node->getType() == Convolution || node->getType() == Pooling || node->getType() == Activation ||
+                node->getType() == Depthwise || node->getType() == Eltwise) &&
+               !node->isConstant() && selectedPD != nullptr && selectedPD->getConfig().dynBatchSupport &&
+               node->getMaxBatch() > 1;
+    };
+
+    auto imageSize = [](const MKLDNNEdgePtr& edge) {
+        const auto &desc = edge->getDesc();
+        size_t size = desc.getPrecision().size();
+        for (auto dim : desc.getBlockingDesc().getBlockDims())
+            size *= dim;
+        return size / desc.getDims()[0];
+    };
+
+    auto isSuitableEdge = [](const MKLDNNEdgePtr& edge, size_t batch) {
+        const auto &desc = edge->getDesc();
+        return desc.getDims().size() > 1 && desc.getDims()[0] == batch && desc.getBlockingDesc().getOffsetPadding() == 0 &&
+               desc.getBlockingDesc().getOrder()[0] == 0;
+    };
+
+    const size_t cacheSize = static_cast<size_t>(mkldnn_get_cache_size(2, false));
+
+    auto closeChain = [&](size_t begin, size_t end, size_t workingSet) {
+        size_t batch = static_cast<size_t>(graphNodes[begin]->getMaxBatch());
+        // A chain is useless when the tensors of the whole batch fit the cache anyway
+        if (end - begin > 1 && workingSet * batch > cacheSize)
+            depthFirstChains.push_back({begin, end, {}, {}});
+    };
+
+    size_t begin = 0, workingSet = 0;
+    for (size_t i = 0; i <= graphNodes.size(); i++) {
+        bool extends = i < graphNodes.size() && isSuitableNode(graphNodes[i]);
+        size_t nodeWorkingSet = 0;
+        if (extends) {
+            auto node = graphNodes[i];
+            size_t batch = static_cast<size_t>(node->getMaxBatch());
+            if (i > begin && batch != static_cast<size_t>(graphNodes[begin]->getMaxBatch()))
+                extends = false;
+            for (size_t j = 0; extends && j < node->getParentEdges().size(); j++)
+                extends = isSuitableEdge(node->getParentEdgeAt(j), batch);
+            for (size_t j = 0; extends && j < node->getChildEdges().size(); j++) {
+                extends = isSuitableEdge(node->getChildEdgeAt(j), batch);
+                nodeWorkingSet += extends ? imageSize(node->getChildEdgeAt(j)) : 0;
+            }
+        }
+
+        if (extends && (i == begin || workingSet + nodeWorkingSet <= cacheSize)) {
+            workingSet += nodeWorkingSet;
+            continue;
+        }
+
+        if (i > begin)
+            closeChain(begin, i, workingSet);
+        begin = extends ? i : i + 1;
+        workingSet = extends ? nodeWorkingSet : 0;
+    }
+}
+
+void MKLDNNGraph::BindDepthFirstChains() {
+    // Only the nodes executed by primitives honour the batch limit, the chains are split by the others.
+    // The lifetimes of the tensors have been extended for the whole original chains, so it stays safe.
+    std::vector<DepthFirstChain> chains;
+    for (const auto &chain : depthFirstChains) {
+        size_t begin = chain.begin;
+        for (size_t i = chain.begin; i <= chain.end; i++) {
+            if (i < chain.end && graphNodes[i]->prim)
+                continue;
+            if (i - begin > 1)
+                chains.push_back({begin, i, {}, {}});
+            begin = i + 1;
+        }
+    }
+
+    depthFirstChains.clear();
+    for (auto &chain : chains) {
+        for (size_t i = chain.begin; i < chain.end; i++) {
+            auto &node = graphNodes[i];
+            for (size_t j = 0; j < node->getParentEdges().size() + node->getChildEdges().size(); j++) {
+                auto edge = j < node->getParentEdges().size() ? node->getParentEdgeAt(j)
+                                                              : node->getChildEdgeAt(j - node->getParentEdges().size());
+                if (std::find(chain.edges.begin(), chain.edges.end(), edge) != chain.edges.end())
+                    continue;
+                const auto &desc = edge->getMemory().GetDescriptor().data;
+                chain.edges.push_back(edge);
+                chain.strides.push_back(desc.layout_desc.blocking.strides[0][0] *
+                                        MKLDNNExtensionUtils::sizeOfDataType(edge->getMemory().GetDataType()));
+            }
+        }
+        depthFirstChains.push_back(chain);
+    }
+}
+
+void MKLDNNGraph::ExecuteDepthFirstChain(const DepthFirstChain& chain, mkldnn::stream& stream, int batch) {
+    const int images = batch > 0 ? std::min(batch, graphNodes[chain.begin]->getMaxBatch()) : graphNodes[chain.begin]->getMaxBatch();
+
+    // The memories can be rebound by the infer request between the inferences
+    std::vector<char*> data(chain.edges.size());
+    for (size_t e = 0; e < chain.edges.size(); e++)
+        data[e] = static_cast<char*>(chain.edges[e]->getMemory().GetData());
+
+    for (size_t i = chain.begin; i < chain.end; i++)
+        graphNodes[i]->setDynamicBatchLim(1);
+
+    for (int image = 0; image < images; image++) {
+        for (size_t e = 0; e < chain.edges.size(); e++)
+            chain.edges[e]->getMemory().GetPrimitivePtr()->set_data_handle(data[e] + image * chain.strides[e]);
+
+        for (size_t i = chain.begin; i < chain.end; i++) {
+            PERF(graphNodes[i], perfCollect, perfSample, perfHwCounters);
+            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
+            IE_TRACE_SCOPE("layer", graphNodes[i]->getName());
+            graphNodes[i]->execute(stream);
+        }
+    }
+
+    for (size_t e = 0; e < chain.edges.size(); e++)
+        chain.edges[e]->getMemory().GetPrimitivePtr()->set_data_handle(data[e]);
+    for (size_t i = chain.begin; i < chain.end; i++)
+        graphNodes[i]->setDynamicBatchLim(batch > 0 ? batch : 0);
+}
+
+void MKLDNNGraph::InitConcurrentGroups() {
+    concurrentGroups.clear();
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!config.concurrentNodesExecution || parallel_get_max_threads() < 2)
+        return;
+
+    using Region = std::pair<const uint8_t*, const uint8_t*>;
+    auto regionOf = [](const MKLDNNEdgePtr& edge) {
+        auto data = static_cast<const uint8_t*>(edge->getMemory().GetData());
+        return Region(data, data + edge->getMemory().GetSize());
+    };
+    auto overlaps = [](const std::vector<Region>& a, const std::vector<Region>& b) {
+        for (const auto& ra : a)
+            for (const auto& rb : b)
+                if (ra.first < rb.second && rb.first < ra.second)
+                    return true;
+        return false;
+    };
+
+    // The memory nodes pass the states between the inferences and the extensions may keep state in the node
+    auto isSuitableNode = [](const MKLDNNNodePtr& node) {
+        return !node->isConstant() && node->getType() != Input && node->getType() != Output &&
+               node->getType() != MemoryInput && node->getType() != MemoryOutput && node->getType() != Generic &&
+               node->getType() != TensorIterator;
+    };
+
+    auto chain = depthFirstChains.begin();
+    size_t begin = 0;
+    std::vector<std::vector<Region>> reads, writes;
+    std::unordered_set<MKLDNNNode*> members;
+    for (size_t i = 0; i <= graphNodes.size(); i++) {
+        while (chain != depthFirstChains.end() && i >= chain->end)
+            chain++;
+        bool inChain = chain != depthFirstChains.end() && i >= chain->begin;
+
+        bool suitable = i < graphNodes.size() && !inChain && isSuitableNode(graphNodes[i]);
+        bool extends = suitable;
+        std::vector<Region> nodeReads, nodeWrites;
+        if (suitable) {
+            auto& node = graphNodes[i];
+            for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+                auto edge = node->getParentEdgeAt(j);
+                extends = extends && !members.count(edge->getParent().get());
+                nodeReads.push_back(regionOf(edge));
+            }
+            for (size_t j = 0; j < node->getChildEdges().size(); j++)
+                nodeWrites.push_back(regionOf(node->getChildEdgeAt(j)));
+            for (size_t k = 0; extends && k < writes.size(); k++)
+                extends = !overlaps(nodeWrites, writes[k]) && !overlaps(nodeWrites, reads[k]) &&
+                          !overlaps(nodeReads, writes[k]);
+        }
+
+        if (extends) {
+            members.insert(graphNodes[i].get());
+            reads.push_back(nodeReads);
+            writes.push_back(nodeWrites);
+            continue;
+        }
+
+        if (i - begin > 1)
+            concurrentGroups.push_back({begin, i});
+
+        // the node which has broken the group may start the next one
+        members.clear();
+        reads.clear();
+        writes.clear();
+        begin = i;
+        if (suitable) {
+            members.insert(graphNodes[i].get());
+            reads.push_back(std::move(nodeReads));
+            writes.push_back(std::move(nodeWrites));
+        } else {
+            begin = i + 1;
+        }
+    }
+#endif
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch) {
+    PERF(node, perfCollect, perfSample, perfHwCounters);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        IE_TRACE_SCOPE("layer", node->getName());
+        node->execute(stream);
+    }
+
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
+
+void MKLDNNGraph::ExecuteConcurrentGroup(const ConcurrentGroup& group, int batch) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // Every node gets its own stream, the primitives of a node are split further among the idle threads.
+    // The isolation keeps a thread waiting for its node from picking up another node of the group, as both would
+    // use the scratchpad of the thread.
+    parallel_for(group.end - group.begin, [&](size_t k) {
+        tbb::this_task_arena::isolate([&] {
+            mkldnn::stream stream(stream::kind::eager);
+            ExecuteNode(graphNodes[group.begin + k], stream, batch);
+        });
+    });
+#else
+    mkldnn::stream stream(stream::kind::eager);
+    for (size_t i = group.begin; i < group.end; i++)
+        ExecuteNode(graphNodes[i], stream, batch);
+#endif
+}
+
+std::vector<MKLDNNMemoryPtr> MKLDNNGraph::GetMemoryBlocks() const {
+    std::vector<MKLDNNMemoryPtr> blocks;
+    if (memWorkspace)
+        blocks.push_back(memWorkspace);
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory) {
+            if (memory)
+                blocks.push_back(memory);
+        }
+    }
+    return blocks;
+}
+
+void MKLDNNGraph::PrefaultMemory() {
+    const size_t pageSize = 4096;
+    if (memWorkspace) {
+        auto data = static_cast<volatile uint8_t*>(memWorkspace->GetData());
+        for (size_t i = 0; i < memWorkspace->GetSize(); i += pageSize) {
+            data[i] = data[i];
+        }
+    }
+    uint8_t checksum = 0;
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory) {
+            if (!memory)
+                continue;
+            auto data = static_cast<const volatile uint8_t*>(memory->GetData());
+            for (size_t i = 0; i < memory->GetSize(); i += pageSize) {
+                checksum ^= data[i];
+            }
+        }
+    }
+    (void)checksum;
+}
+
+bool MKLDNNGraph::LockMemory() {
+    bool locked = true;
+    for (auto& block : GetMemoryBlocks()) {
+        if (!LockPages(block->GetData(), block->GetSize()))
+            locked = false;
+    }
+    return locked;
+}
+
+PageType MKLDNNGraph::GetPageType(const MKLDNNMemoryPtr& block) const {
+    auto type = pageTypes.find(block.get());
+    return type != pageTypes.end() ? type->second : PageType::Default;
+}
+
+void MKLDNNGraph::BindMemoryToNumaNode(int numaNode) {
+    for (auto& block : GetMemoryBlocks()) {
+        MKLDNNPlugin::BindMemoryToNumaNode(block->GetData(), block->GetSize(), numaNode);
+    }
+}
+
+namespace {
+
+bool isIntegerInput(const InferenceEngine::Precision& precision) {
+    return precision == InferenceEngine::Precision::U8 || precision == InferenceEngine::Precision::BOOL ||
+           precision == InferenceEngine::Precision::I8 || precision == InferenceEngine::Precision::U16 ||
+           precision == InferenceEngine::Precision::I16;
+}
+
+template <typename T>
+void convertInput(const InferenceEngine::Blob::Ptr &in, float *dst, const MKLDNNDims &dims,
+                  InferenceEngine::Layout layout, const MeanImage *mean) {
+    const T *src = in->cbuffer().as<const T *>() + in->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    if (mean) {
+        mean->Convert(dims, src, dst, layout);
+    } else {
+        MeanImage().Convert(dims, src, dst, layout);
+    }
+}
+
+void convertInput(const InferenceEngine::Blob::Ptr &in, float *dst, const MKLDNNDims &dims,
+                  InferenceEngine::Layout layout, const MeanImage *mean) {
+    switch (in->getTensorDesc().getPrecision()) {
+        case InferenceEngine::Precision::U8:
+        case InferenceEngine::Precision::BOOL:
+            convertInput<uint8_t>(in, dst, dims, layout, mean);
+            break;
+        case InferenceEngine::Precision::I8:
+            convertInput<int8_t>(in, dst, dims, layout, mean);
+            break;
+        case InferenceEngine::Precision::U16:
+            convertInput<uint16_t>(in, dst, dims, layout, mean);
+            break;
+        case InferenceEngine::Precision::I16:
+            convertInput<int16_t>(in, dst, dims, layout, mean);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported input precision " << in->getTensorDesc().getPrecision();
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+}  // namespace
+
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -716,13 +1330,31 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
                 l = NCHW;
 
+            // The FP32 memory of the integer inputs (with a mean image or U16) is filled in one pass converting
+            // the precision and subtracting the mean, a reorder follows only when the layouts differ
+            const auto &inputMemory = input->second->getChildEdgeAt(0)->getMemory();
+            if (inputMemory.GetDataType() == memory::f32 && isIntegerInput(in->getTensorDesc().getPrecision())) {
+                const MeanImage *mean = subtractMean && _meanImages.find(name) != _meanImages.end() ? &_meanImages[name] : nullptr;
+                auto format = MKLDNNMemory::Convert(l);
+                if (format == inputMemory.GetFormat() && format != memory::blocked) {
+                    auto data = static_cast<float *>(inter_data_ptr) +
+                                inputMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+                    convertInput(in, data, outDims, l, mean);
+                } else {
+                    std::vector<float> converted(in->size());
+                    convertInput(in, converted.data(), outDims, l, mean);
+                    inputMemory.SetData(memory::f32, format, converted.data(), converted.size() * sizeof(float), false);
+                }
+                return;
+            }
+
             input->second->getChildEdgeAt(0)->getMemory().SetData(
                     MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
                     MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -775,6 +1407,24 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
         size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
 
+        // The user blob of the other channel order (e.g. NHWC for the planar output) is filled by one reorder
+        // of the processed images instead of the plain copy
+        auto isChannelOrderFormat = [](memory::format format, size_t ndims) {
+            return ndims == 4 ? format == memory::nchw || format == memory::nhwc
+                              : ndims == 5 && (format == memory::ncdhw || format == memory::ndhwc);
+        };
+        auto dims = intr_blob.GetDims();
+        auto ext_format = MKLDNNMemory::Convert(ext_blob->getTensorDesc().getLayout());
+        if (ext_format != intr_blob.GetFormat() && isChannelOrderFormat(ext_format, dims.size()) &&
+            isChannelOrderFormat(intr_blob.GetFormat(), dims.size())) {
+            dims[0] = MB_to_process;
+            MKLDNNMemory src(eng), dst(eng);
+            src.Create(dims, intr_blob.GetDataType(), intr_blob.GetFormat(), intr_blob_ptr);
+            dst.Create(dims, intr_blob.GetDataType(), ext_format, ext_blob_ptr);
+            dst.SetData(src, false);
+            continue;
+        }
+
         ie_memcpy(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
     }
 }
@@ -784,24 +1434,203 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    perfCollect = config.collectPerfCounters;
+    perfSample = false;
+    if (perfSampling) {
+        auto rate = perfSampling->getRate();
+        perfSample = rate > 0 && sampledInferCount++ % rate == 0;
+    }
+    perfHwCounters = nullptr;
+    if (perfCollect && config.hwPerfCounters) {
+        if (!hwCounters) {
+            hwCounters = std::make_shared<HwCountersGroup>();
+            // the threads which execute the primitives of the nodes, the current one included
+            hwCounters->attachCurrentThread();
+            parallel_nt_static(0, [&](int, int) { hwCounters->attachCurrentThread(); });
+        }
+        perfHwCounters = hwCounters.get();
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    auto chain = depthFirstChains.begin();
+    auto group = concurrentGroups.begin();
+    auto exit = earlyExits.begin();
+    for (size_t i = 0; i < graphNodes.size();) {
+        if (chain != depthFirstChains.end() && chain->begin == i) {
+            ExecuteDepthFirstChain(*chain, stream, batch);
+            i = chain->end;
+            chain++;
+        } else if (group != concurrentGroups.end() && group->begin == i) {
+            ExecuteConcurrentGroup(*group, batch);
+            i = group->end;
+            group++;
+        } else {
+            ExecuteNode(graphNodes[i], stream, batch);
+            i++;
+        }
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+        // the rest of the nodes is skipped once an executed exit is confident
+        bool confident = false;
+        for (; !confident && exit != earlyExits.end() && exit->index < i; exit++)
+            confident = IsConfident(*exit);
+        if (confident)
+            break;
+    }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    // the consumers of the states have read them, so the new states take their place
+    for (auto &stateSwap : memoryStateSwaps)
+        stateSwap.swap();
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+    if (infer_count != -1) infer_count++;
+    if (!hot.load(std::memory_order_relaxed))
+        hot.store(true, std::memory_order_relaxed);
+}
+
+void MKLDNNGraph::PrioritizeEarlyExits() {
+    earlyExits.clear();
+    if (config.earlyExits.empty())
+        return;
+
+    for (auto &node : graphNodes) {
+        // the skipped MemoryOutput nodes would not update the states
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            THROW_IE_EXCEPTION << "The early exits are not supported by the networks with memory states";
+    }
+
+    // The nodes the exit depends on are moved forward, after the nodes of the exits of the higher priority,
+    // so the exit is checked as early as possible. The relative order of the moved nodes stays topological.
+    std::vector<MKLDNNNodePtr> prioritized;
+    std::unordered_set<MKLDNNNode*> placed;
+    for (auto &exit : config.earlyExits) {
+        auto output = std::find_if(outputNodes.begin(), outputNodes.end(), [&](const MKLDNNNodePtr& node) {
+            return node->getName() == "out_" + exit.first;
+        });
+        if (output == outputNodes.end())
+            THROW_IE_EXCEPTION << "The early exit " << exit.first << " is not an output of the network";
+
+        std::unordered_set<MKLDNNNode*> ancestors;
+        std::vector<MKLDNNNode*> unvisited = {output->get()};
+        while (!unvisited.empty()) {
+            auto node = unvisited.back();
+            unvisited.pop_back();
+            if (placed.count(node) || !ancestors.insert(node).second)
+                continue;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++)
+                unvisited.push_back(node->getParentEdgeAt(i)->getParent().get());
+        }
+        for (auto &node : graphNodes) {
+            if (ancestors.count(node.get())) {
+                prioritized.push_back(node);
+                placed.insert(node.get());
+            }
         }
+        earlyExits.push_back({0, *output, exit.second});
+    }
+    for (auto &node : graphNodes) {
+        if (!placed.count(node.get()))
+            prioritized.push_back(node);
+    }
+
+    graphNodes = prioritized;
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        graphNodes[i]->execIndex = static_cast<int>(i);
+    for (auto &exit : earlyExits)
+        exit.index = static_cast<size_t>(exit.output->execIndex);
+    std::stable_sort(earlyExits.begin(), earlyExits.end(), [](const EarlyExit& a, const EarlyExit& b) {
+        return a.index < b.index;
+    });
+}
+
+void MKLDNNGraph::OrderAppendStates() {
+    // The nodes reading an append state see the slice appended by the same inference, so MemoryOutput of the
+    // state runs before them. The nodes are reordered by the extra dependencies keeping the order of the rest.
+    std::unordered_map<MKLDNNNode*, std::vector<MKLDNNNode*>> readers;
+    for (auto &node : graphNodes) {
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        if (!memoryOutput || !memoryOutput->getAppendState() || !memoryOutput->getInputNode())
+            continue;
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        auto inputNode = memoryOutput->getInputNode();
+        for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+            auto edge = inputNode->getChildEdgeAt(i);
+            const auto &desc = edge->getDesc();
+            const auto &order = desc.getBlockingDesc().getOrder();
+            if (desc.getPrecision() != Precision::FP32 || desc.getBlockingDesc().getOffsetPadding() != 0 ||
+                    order.size() != desc.getDims().size() || !std::is_sorted(order.begin(), order.end()))
+                THROW_IE_EXCEPTION << "The append state " << inputNode->getName() << " must be a planar FP32 tensor";
+            readers[node.get()].push_back(edge->getChild().get());
+        }
     }
+    if (readers.empty())
+        return;
 
-    if (infer_count != -1) infer_count++;
+    std::unordered_map<MKLDNNNode*, size_t> parentsCount;
+    auto forEachChild = [&](MKLDNNNode* node, const std::function<void(MKLDNNNode*)>& visit) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++)
+            visit(node->getChildEdgeAt(i)->getChild().get());
+        auto it = readers.find(node);
+        if (it != readers.end())
+            for (auto reader : it->second)
+                visit(reader);
+    };
+    for (auto &node : graphNodes)
+        forEachChild(node.get(), [&](MKLDNNNode* child) { parentsCount[child]++; });
+
+    auto later = [](const MKLDNNNodePtr& a, const MKLDNNNodePtr& b) {
+        return a->execIndex > b->execIndex;
+    };
+    std::priority_queue<MKLDNNNodePtr, std::vector<MKLDNNNodePtr>, decltype(later)> ready(later);
+    std::unordered_map<MKLDNNNode*, MKLDNNNodePtr> nodes;
+    for (auto &node : graphNodes) {
+        nodes[node.get()] = node;
+        if (parentsCount[node.get()] == 0)
+            ready.push(node);
+    }
+
+    std::vector<MKLDNNNodePtr> ordered;
+    while (!ready.empty()) {
+        auto node = ready.top();
+        ready.pop();
+        ordered.push_back(node);
+        forEachChild(node.get(), [&](MKLDNNNode* child) {
+            if (--parentsCount[child] == 0)
+                ready.push(nodes[child]);
+        });
+    }
+    if (ordered.size() != graphNodes.size())
+        THROW_IE_EXCEPTION << "The new slice of an append state depends on the state itself";
+
+    graphNodes = ordered;
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        graphNodes[i]->execIndex = static_cast<int>(i);
+}
+
+bool MKLDNNGraph::IsConfident(const EarlyExit& exit) const {
+    const MKLDNNMemory& memory = exit.output->getParentEdgeAt(0)->getMemory();
+    if (memory.GetDataType() != memory::f32)
+        return false;
+
+    // every processed image should be confident
+    auto data = reinterpret_cast<const float*>(memory.GetData());
+    size_t MB = memory.GetDims()[0];
+    size_t imageSize = memory.GetElementsCount() / MB;
+    if (imageSize == 0)
+        return false;
+    size_t MB_to_process = static_cast<size_t>(exit.output->batchToProcess());
+    for (size_t b = 0; b < MB_to_process; b++) {
+        auto image = data + b * imageSize;
+        if (*std::max_element(image, image + imageSize) < exit.threshold)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraph::SetPerfSampling(const PerfSampling::Ptr& sampling) {
+    perfSampling = sampling;
+    for (auto& node : graphNodes) {
+        // the fused and merged nodes are executed and timed by the node they are fused with
+        node->PerfCounter().histogram = sampling ? sampling->histogram(node->getName()) : nullptr;
+    }
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -898,6 +1727,18 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        auto hw = node->PerfCounter().avgHw();
+        pc.cycles = hw.cycles;
+        pc.instructions = hw.instructions;
+        pc.llc_misses = hw.llcMisses;
+        pc.bytes_read = hw.bytesRead;
+        pc.bytes_written = hw.bytesWritten;
+        if (pc.realTime_uSec > 0) {
+            // bytes or operations per microsecond to giga per second
+            auto perSec = 1e-3f / static_cast<float>(pc.realTime_uSec);
+            pc.bandwidth_GBps = static_cast<float>(hw.bytesRead + hw.bytesWritten) * perSec;
+            pc.compute_GFLOPs = static_cast<float>(node->getFlops()) * perSec;
+        }
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
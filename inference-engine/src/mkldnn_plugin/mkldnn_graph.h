@@ -11,7 +11,9 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "perf_count.h"
 #include "threading/ie_thread_local.hpp"
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -23,6 +25,9 @@ class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
     MKLDNNWeightsSharing::Ptr weightsCache;
+    MKLDNNPrimitivesCache::Ptr primitivesCache;
+    MKLDNNWeightsStore::Ptr weightsStore;
+    MKLDNNImplTuner::Ptr implTuner;
 
     enum Status {
         NotReady = 0,
@@ -55,11 +60,78 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Moves the edges workspace and the internal blobs (e.g. weights) of the nodes to the NUMA node
+     * @param numaNode The NUMA node the graph is executed on
+     */
+    void BindMemoryToNumaNode(int numaNode);
+
+    /**
+     * @brief Returns the memory owned by the graph: the edges workspace and the internal blobs of the nodes.
+     * The internal blobs can be shared with other graphs through the weights cache
+     */
+    std::vector<MKLDNNMemoryPtr> GetMemoryBlocks() const;
+
+    /**
+     * @brief Returns the type of the pages backing a memory block of the graph, see GetMemoryBlocks
+     */
+    PageType GetPageType(const MKLDNNMemoryPtr& block) const;
+
+    /**
+     * @brief Touches every page of the memory owned by the graph, so the first inference does not page fault.
+     * The data is kept: the workspace pages are rewritten with their own values, the internal blobs are only read
+     * as they can be shared with other graphs or mapped from a read-only file
+     */
+    void PrefaultMemory();
+
+    /**
+     * @brief Locks the pages of the memory owned by the graph in RAM, see KEY_CPU_LATENCY_CRITICAL
+     * @return false if some of the memory blocks were not locked
+     */
+    bool LockMemory();
+
+    /**
+     * @brief Returns true if the graph has already run an inference
+     */
+    bool IsHot() const {
+        return hot.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copies the input blob into the graph memory
+     * @param subtractMean false if the mean values were already applied to the blob during pre-processing
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
 
+    /**
+     * @brief Adds the execution times of the nodes of every sampled inference to the histograms of the sampling
+     */
+    void SetPerfSampling(const PerfSampling::Ptr& sampling);
+
+    /**
+     * @brief The buffers of the states of a session: the state every MemoryInput reads and a spare buffer of the same
+     * size the new state is written to, the inference exchanges their roles if the graph swaps the states
+     */
+    struct StateBuffers {
+        std::vector<void*> states;
+        std::vector<void*> spares;
+    };
+
+    /**
+     * @brief Returns the sizes in bytes of the states in the order of StateBuffers, empty if the graph has no states
+     * or they cannot be rebound because an edge views a part of a state through its own pointer
+     */
+    std::vector<size_t> GetStateSizes() const;
+
+    /**
+     * @brief Binds the edges of the states to the buffers and returns the buffers the edges were bound to in them,
+     * so the calls before and after an inference run it on the states of a session and leave its new states there
+     */
+    void ExchangeStates(StateBuffers& buffers);
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -92,6 +164,29 @@ public:
 
     void SortTopologically();
 
+    /**
+     * @brief Two buffers of the graph which exchange their roles instead of copying one into the other:
+     * swap() rebinds the edges of the first buffer to the second one and vice versa
+     */
+    struct BufferSwap {
+        std::vector<MKLDNNEdgePtr> first, second;
+        void swap() const;
+    };
+
+    /**
+     * @brief Collects the edges bound to the buffer of the memory
+     * @return false if an edge views a part of the buffer through its own pointer
+     */
+    bool GetEdgesBoundTo(const MKLDNNMemory& memory, std::vector<MKLDNNEdgePtr>& edges) const;
+
+    /**
+     * @brief Collects the edges bound to the two memories of the graph
+     * @param ioEdgesAllowed false if the edges of the inputs and outputs can be rebound by the infer request
+     * @return false if the memories cannot be swapped: the descriptors differ, the buffers overlap or there is
+     * an edge viewing a part of a buffer through its own pointer
+     */
+    bool InitBufferSwap(const MKLDNNMemory& first, const MKLDNNMemory& second, BufferSwap& swap, bool ioEdgesAllowed) const;
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -103,6 +198,11 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        memoryStateSwaps.clear();
+        stateBindings.clear();
+        depthFirstChains.clear();
+        concurrentGroups.clear();
+        earlyExits.clear();
         _meanImages.clear();
     }
     Status status;
@@ -112,9 +212,24 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    std::atomic<bool> hot{false};
+
+    PerfSampling::Ptr perfSampling;
+    uint64_t sampledInferCount = 0;
+    // whether the nodes of the current inference are timed for the performance counters and for the histograms
+    bool perfCollect = false;
+    bool perfSample = false;
+    // the hardware counters of the threads of the stream, opened by the first inference which collects them
+    HwCountersGroup::Ptr hwCounters;
+    const HwCountersGroup* perfHwCounters = nullptr;
+
     bool reuse_io_tensors = true;
 
+    // the huge pages the workspace points to if they are enabled, is released after the workspace
+    std::shared_ptr<HugePagesMemory> workspaceBuffer;
     MKLDNNMemoryPtr memWorkspace;
+    // the pages of the memory blocks which are not backed by the default ones
+    std::map<const MKLDNNMemory*, PageType> pageTypes;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -123,6 +238,52 @@ protected:
 
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
+    // the sizes of the memory allocated for intermediate tensors and its lower bound, see ExecGraphInfoSerialization
+    std::string memoryReuseReport;
+    // the number of reorders converting tensors between FP32 and BF16, see ExecGraphInfoSerialization
+    std::string precisionConvertsReport;
+    // the states of the MemoryInput/MemoryOutput pairs, swapped with the new states after every inference
+    std::vector<BufferSwap> memoryStateSwaps;
+
+    // the edges bound to the state of every MemoryInput and to the buffer of its new state, see ExchangeStates
+    struct StateBinding {
+        std::vector<MKLDNNEdgePtr> state;
+        // empty if MemoryOutput copies the new state into the state buffer
+        std::vector<MKLDNNEdgePtr> spare;
+        size_t size = 0;
+    };
+    std::vector<StateBinding> stateBindings;
+
+    /**
+     * @brief Consecutive nodes [begin, end) of graphNodes which are executed image after image, so the intermediate
+     * tensors of one image stay in cache. Strides are the distances in bytes between the images of the edges.
+     */
+    struct DepthFirstChain {
+        size_t begin, end;
+        std::vector<MKLDNNEdgePtr> edges;
+        std::vector<size_t> strides;
+    };
+    std::vector<DepthFirstChain> depthFirstChains;
+
+    /**
+     * @brief Consecutive nodes [begin, end) of graphNodes which neither depend on each other nor share memory,
+     * so they are executed at the same time.
+     */
+    struct ConcurrentGroup {
+        size_t begin, end;
+    };
+    std::vector<ConcurrentGroup> concurrentGroups;
+
+    /**
+     * @brief The Output node of graphNodes at index which may stop the inference, when the output reaches
+     * the threshold. Sorted by index, see PluginConfigParams::KEY_CPU_EARLY_EXITS.
+     */
+    struct EarlyExit {
+        size_t index;
+        MKLDNNNodePtr output;
+        float threshold;
+    };
+    std::vector<EarlyExit> earlyExits;
 
     mkldnn::engine eng;
 
@@ -135,6 +296,16 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitMemoryStateSwaps();
+    void InitDepthFirstChains();
+    void BindDepthFirstChains();
+    void ExecuteDepthFirstChain(const DepthFirstChain& chain, mkldnn::stream& stream, int batch);
+    void InitConcurrentGroups();
+    void ExecuteConcurrentGroup(const ConcurrentGroup& group, int batch);
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch);
+    void PrioritizeEarlyExits();
+    void OrderAppendStates();
+    bool IsConfident(const EarlyExit& exit) const;
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -85,6 +85,8 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_ngraph_net(const MKLDNNGraph &grap
         auto meta_data = extract_node_metadata(node);
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
+            meta_data[ExecGraphInfoSerialization::MEMORY_REUSE] = graph.memoryReuseReport;
+            meta_data[ExecGraphInfoSerialization::PRECISION_CONVERTS] = graph.precisionConvertsReport;
             auto desc = node->getChildEdgeAt(0)->getDesc();
             auto param = std::make_shared<ngraph::op::Parameter>(
                 details::convertPrecision(desc.getPrecision()),
@@ -135,6 +137,10 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph) {
     // Copy all nodes to network
     for (auto &node : graph.graphNodes) {
         auto layer = create_cnnlayer(node);
+        if (node->getType() == Input) {
+            layer->params[ExecGraphInfoSerialization::MEMORY_REUSE] = graph.memoryReuseReport;
+            layer->params[ExecGraphInfoSerialization::PRECISION_CONVERTS] = graph.precisionConvertsReport;
+        }
         node2layer[node] = layer;
         net->addLayer(layer);
     }
@@ -261,6 +267,20 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
     // Performance
     if (node->PerfCounter().avg() != 0) {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+        auto perSec = 1e-3f / static_cast<float>(node->PerfCounter().avg());
+        auto hw = node->PerfCounter().avgHw();
+        if (hw.cycles != 0) {
+            serialization_info[ExecGraphInfoSerialization::HW_COUNTERS] =
+                "cycles:" + std::to_string(hw.cycles) + ",instructions:" + std::to_string(hw.instructions) +
+                ",llc_misses:" + std::to_string(hw.llcMisses) + ",bytes_read:" + std::to_string(hw.bytesRead) +
+                ",bytes_written:" + std::to_string(hw.bytesWritten);
+            serialization_info[ExecGraphInfoSerialization::BANDWIDTH] =
+                std::to_string(static_cast<float>(hw.bytesRead + hw.bytesWritten) * perSec);
+        }
+        auto flops = node->getFlops();
+        if (flops != 0) {
+            serialization_info[ExecGraphInfoSerialization::COMPUTE_THROUGHPUT] = std::to_string(flops * perSec);
+        }
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
@@ -17,8 +17,12 @@
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_power_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
+#include "nodes/mkldnn_input_node.h"
 
 #include <blob_factory.hpp>
+#include <ie_system_conf.h>
 #include <ie_layers_internal.hpp>
 
 // WA for xbyak.h
@@ -37,6 +41,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <cmath>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -138,6 +143,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+#if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
+    CompressFullyConnectedWeights(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
+    SparsifyFullyConnectedWeights(graph);
+    SplitFullyConnectedWeightsByNumaNodes(graph);
+
     graph.RemoveDroppedEdges();
 }
 
@@ -234,7 +247,6 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
             THROW_IE_EXCEPTION << "Cannot get convolution node " << node->getName();
 
         int IC = node->getParentEdgesAtPort(0)[0]->getDims()[1];
-        int OC = node->getChildEdgesAtPort(0)[0]->getDims()[1];
 
         if (parent0->getType() == Eltwise) {
             auto * eltwiseLayer = dynamic_cast<EltwiseLayer*>(parent0->getCnnLayer().get());
@@ -273,10 +285,6 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
             return false;
         }
 
-        if (convNode->outputCompensation.empty()) {
-            convNode->outputCompensation.resize(OC);
-        }
-
         return true;
     };
 
@@ -358,34 +366,7 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
         ptrdiff_t KH = weightsLayer->outData[0]->getDims()[weightsLayer->outData[0]->getDims().size() - 2];
         ptrdiff_t KW = weightsLayer->outData[0]->getDims()[weightsLayer->outData[0]->getDims().size() - 1];
 
-        for (size_t g = 0; g < G; g++) {
-            for (size_t oc = 0; oc < OC; oc++) {
-                int32_t a = 0;
-                for (size_t ic = 0; ic < IC; ic++) {
-                    for (size_t kd = 0; kd < KD; kd++) {
-                        for (size_t kh = 0; kh < KH; kh++) {
-                            for (size_t kw = 0; kw < KW; kw++) {
-                                size_t widx = g * OC * IC * KD * KH * KW +
-                                              oc * IC * KD * KH * KW +
-                                              ic * KD * KH * KW +
-                                              kd * KH * KW +
-                                              kh * KW +
-                                              kw;
-
-                                auto w = static_cast<int32_t>(weightsPtr[widx]);
-
-                                auto izp = !convNode->inputZeroPoints.empty() ? static_cast<int32_t>(convNode->inputZeroPoints[g * IC + ic]) : 0;
-                                a += w * izp;
-
-                                auto wzp = !convNode->weightsZeroPoints.empty() ? static_cast<int32_t>(convNode->weightsZeroPoints[g * OC + oc]) : 0;
-                                a -= wzp * izp;
-                            }
-                        }
-                    }
-                }
-                convNode->outputCompensation[g * OC + oc] = -a;
-            }
-        }
+        convNode->initOutputCompensation(weightsPtr, G, OC, IC, KD * KH * KW);
     };
 
     for (int i = 0; i < graphNodes.size(); i++) {
@@ -1072,7 +1053,216 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     }
 }
 
+namespace {
+
+// Returns the constant FP32 weights of a FullyConnected node which does not fuse anything, or nullptr
+Blob::Ptr getPlainFP32Weights(const MKLDNNNodePtr &node) {
+    if (node->getType() != FullyConnected || !node->getFusedWith().empty())
+        return nullptr;
+
+    auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+    auto* fcLayer = dynamic_cast<FullyConnectedLayer*>(node->getCnnLayer().get());
+    if (fcNode == nullptr || fcLayer == nullptr || fcNode->isWithCompressedWeights() ||
+        fcNode->isWithSparseWeights() || node->getParentEdges().size() != fcLayer->insData.size())
+        return nullptr;
+    if (fcLayer->precision != Precision::FP32 || fcLayer->outData[0]->getPrecision() != Precision::FP32 ||
+        fcLayer->blobs.count("w-scale") || (fcLayer->insData.size() > 1 && fcLayer->_biases != nullptr))
+        return nullptr;
+    for (auto &inData : fcLayer->insData) {
+        if (inData.lock()->getPrecision() != Precision::FP32)
+            return nullptr;
+    }
+
+    Blob::Ptr weights;
+    if (fcLayer->insData.size() == 1) {
+        weights = fcLayer->_weights;
+    } else {
+        auto weightsNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(weightsNode.get());
+        if (inputNode == nullptr || weightsNode->getType() != Input || !weightsNode->isConstant())
+            return nullptr;
+        weights = inputNode->getConstBlob();
+    }
+
+    if (!weights || weights->getTensorDesc().getPrecision() != Precision::FP32 || weights->size() == 0 ||
+        (fcLayer->insData.size() == 1 && fcLayer->_biases && fcLayer->_biases->getTensorDesc().getPrecision() != Precision::FP32))
+        return nullptr;
+    return weights;
+}
+
+}  // namespace
+
+void MKLDNNGraphOptimizer::SparsifyFullyConnectedWeights(MKLDNNGraph &graph) {
+    const float rate = graph.getProperty().sparseWeightsRate;
+    if (rate <= 0.f)
+        return;
+
+    for (auto &node : graph.GetNodes()) {
+        auto weights = getPlainFP32Weights(node);
+        if (!weights)
+            continue;
+
+        const auto* data = weights->cbuffer().as<const float*>();
+        size_t zeros = std::count(data, data + weights->size(), 0.f);
+        if (static_cast<float>(zeros) >= rate * static_cast<float>(weights->size()))
+            dynamic_cast<MKLDNNFullyConnectedNode*>(node.get())->setSparseWeights();
+    }
+}
+
+void MKLDNNGraphOptimizer::SplitFullyConnectedWeightsByNumaNodes(MKLDNNGraph &graph) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    const size_t minSize = static_cast<size_t>(graph.getProperty().numaSplitWeightsSize) * 1024 * 1024;
+    // the streams of a multi-stream network are already spread between the NUMA nodes
+    if (minSize == 0 || graph.getProperty().streamExecutorConfig._streams > 1)
+        return;
+    const auto numaNodes = getAvailableNUMANodes();
+    if (numaNodes.size() < 2)
+        return;
+
+    for (auto &node : graph.GetNodes()) {
+        auto weights = getPlainFP32Weights(node);
+        if (!weights || weights->byteSize() < minSize)
+            continue;
+        // every node gets at least one output channel
+        if (node->getChildEdgeAt(0)->getDims().ndims() < 2 ||
+            static_cast<size_t>(node->getChildEdgeAt(0)->getDims().ToSizeVector().back()) < numaNodes.size())
+            continue;
+        dynamic_cast<MKLDNNFullyConnectedNode*>(node.get())->setNumaSplitWeights(numaNodes);
+    }
+#endif
+}
+
 #if defined(COMPILED_CPU_MKLDNN_QUANTIZE_NODE)
+void MKLDNNGraphOptimizer::CompressFullyConnectedWeights(MKLDNNGraph &graph) {
+    // Small batches of a FullyConnected are bound by the weights bandwidth, so the FakeQuantize on FP32
+    // weights is folded into U8 codes which the node decompresses on the fly
+    const size_t maxRows = 16;
+
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto isSutableFullyConnected = [&](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || !node->getFusedWith().empty())
+            return false;
+
+        auto* fcLayer = dynamic_cast<FullyConnectedLayer*>(node->getCnnLayer().get());
+        if (fcLayer == nullptr || fcLayer->insData.size() < 2 || fcLayer->insData.size() > 3 ||
+            node->getParentEdges().size() != fcLayer->insData.size())
+            return false;
+        if (fcLayer->_biases != nullptr && fcLayer->_biases->size() != 0)
+            return false;
+        for (auto &inData : fcLayer->insData) {
+            if (inData.lock()->getPrecision() != Precision::FP32)
+                return false;
+        }
+        if (fcLayer->outData[0]->getPrecision() != Precision::FP32)
+            return false;
+
+        auto inDims = node->getParentEdgesAtPort(0)[0]->getDims();
+        auto outDims = node->getChildEdgeAt(0)->getDims();
+        if (inDims.ndims() != 2 && inDims.ndims() != 3)
+            return false;
+        size_t rows = inDims.ndims() == 3 ? inDims[0] * inDims[1] : inDims[0];
+        if (rows > maxRows)
+            return false;
+
+        auto wDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        return wDims.ndims() == 2 && wDims[0] == outDims[outDims.ndims() - 1] && wDims[1] == inDims[inDims.ndims() - 1];
+    };
+
+    auto isSutableQuantize = [&](MKLDNNNodePtr node, size_t OC) {
+        if (node->getType() != Quantize || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+        if (quantizeNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+        if (quantizeNode->isBinarization() || quantizeNode->getLevels() > 256)
+            return false;
+
+        for (auto params : {&quantizeNode->getCropLow(), &quantizeNode->getCropHigh(), &quantizeNode->getInputScale(),
+                            &quantizeNode->getInputShift(), &quantizeNode->getOutputScale(), &quantizeNode->getOutputShift()}) {
+            if (params->size() != 1 && (params->size() != OC || quantizeNode->getAxis() != 0))
+                return false;
+        }
+
+        auto input = node->getParentEdgesAtPort(0)[0]->getParent();
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(input.get());
+        return inputNode != nullptr && input->getType() == Input && input->isConstant() && input->getChildEdges().size() == 1 &&
+               inputNode->getConstBlob() && inputNode->getConstBlob()->getTensorDesc().getPrecision() == Precision::FP32;
+    };
+
+    for (auto &node : graph.GetNodes()) {
+        if (!isSutableFullyConnected(node))
+            continue;
+
+        auto wDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        const size_t OC = wDims[0];
+        const size_t IC = wDims[1];
+
+        auto quantize = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isSutableQuantize(quantize, OC))
+            continue;
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(quantize.get());
+        auto* inputNode = dynamic_cast<MKLDNNInputNode*>(quantize->getParentEdgesAtPort(0)[0]->getParent().get());
+        auto weights = inputNode->getConstBlob();
+        if (weights->size() != OC * IC)
+            continue;
+
+        auto param = [](const std::vector<float>& values, size_t oc) {
+            return values[values.size() == 1 ? 0 : oc];
+        };
+
+        const float maxCode = static_cast<float>(quantizeNode->getLevels() - 1);
+        auto codes = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {OC, IC}, Layout::NC));
+        codes->allocate();
+        const auto* src = weights->cbuffer().as<const float*>();
+        auto* dst = codes->buffer().as<uint8_t*>();
+        for (size_t oc = 0; oc < OC; oc++) {
+            const float cl = param(quantizeNode->getCropLow(), oc);
+            const float ch = param(quantizeNode->getCropHigh(), oc);
+            const float isc = param(quantizeNode->getInputScale(), oc);
+            const float ish = param(quantizeNode->getInputShift(), oc);
+            for (size_t ic = 0; ic < IC; ic++) {
+                float q = std::nearbyint(std::min(std::max(src[oc * IC + ic], cl), ch) * isc + ish);
+                dst[oc * IC + ic] = static_cast<uint8_t>(std::min(std::max(q, 0.f), maxCode));
+            }
+        }
+
+        std::vector<float> scales(quantizeNode->getOutputScale().size() == 1 && quantizeNode->getOutputShift().size() == 1 ? 1 : OC);
+        std::vector<float> shifts(scales.size());
+        for (size_t oc = 0; oc < scales.size(); oc++) {
+            scales[oc] = param(quantizeNode->getOutputScale(), oc);
+            shifts[oc] = param(quantizeNode->getOutputShift(), oc);
+        }
+
+        inputNode->setConstBlob(codes);
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        if (fcNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get fully connected layer " << node->getName();
+        fcNode->setCompressedWeights(scales, shifts, quantizeNode->getLevels());
+
+        auto parentEdges = quantize->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getOutputNum() == 0)
+                continue;
+
+            removeEdge(graph, p_edge);
+        }
+
+        graph.DropNode(quantize);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndQuantize(MKLDNNGraph &graph) {
     auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
         auto& edges = graph.GetEdges();
@@ -1668,7 +1858,9 @@ void MKLDNNGraphOptimizer::FuseResampleAndSimpleOperation(MKLDNNGraph &graph) {
             if (resampleLayer == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get Resample layer " << node->getName();
 
-            return node->getChildEdges().size() == 1 && resampleLayer->GetParamAsString("type") == "caffe.ResampleParameter.NEAREST";
+            auto type = resampleLayer->GetParamAsString("type");
+            return node->getChildEdges().size() == 1 &&
+                   (type == "caffe.ResampleParameter.NEAREST" || type == "caffe.ResampleParameter.CUBIC");
         } else {
             return false;
         }
@@ -1841,39 +2033,53 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableEltwise = node->getType() == Eltwise;
-
-        if (isSutableEltwise) {
-            auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
-            if (eltwiseLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise layer " << node->getName();
+        if (node->getType() != Eltwise)
+            return false;
 
-            ptrdiff_t maxChannels = 1;
-            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
-                if (node->getParentEdgeAt(0)->getDims().ndims() != node->getParentEdgeAt(i)->getDims().ndims())
-                    return false;
-                if (node->getParentEdgeAt(i)->getDims().ndims() != 2 &&
-                    node->getParentEdgeAt(i)->getDims().ndims() != 4 &&
-                    node->getParentEdgeAt(i)->getDims().ndims() != 5)
-                    return false;
-                if (maxChannels < node->getParentEdgeAt(i)->getDims()[1])
-                    maxChannels = node->getParentEdgeAt(i)->getDims()[1];
-            }
+        auto *eltwiseLayer = dynamic_cast<EltwiseLayer *>(node->getCnnLayer().get());
+        if (eltwiseLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Eltwise layer " << node->getName();
 
-            int simdWidth = mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common) ? 16 :
-                            mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx2) ? 8 : 4;
-            if (maxChannels < simdWidth)
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if (node->getParentEdgeAt(0)->getDims().ndims() != node->getParentEdgeAt(i)->getDims().ndims())
                 return false;
+        }
 
-            return node->getChildEdges().size() == 1 &&
-                   (eltwiseLayer->_operation == EltwiseLayer::Sum || eltwiseLayer->_operation == EltwiseLayer::Prod) &&
-                   !node->isFusedWith(Quantize);
-        } else {
-            return false;
+        return node->getChildEdges().size() == 1 && node->getParentEdges().size() == 2 &&
+               (eltwiseLayer->_operation == EltwiseLayer::Sum || eltwiseLayer->_operation == EltwiseLayer::Prod) &&
+               !node->isFusedWith(Quantize);
+    };
+
+    // Per channel operations are applied by the kernel over the channels of a channels last layout
+    auto isSutableForChannelWiseOps = [](MKLDNNNodePtr node) {
+        ptrdiff_t maxChannels = 1;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if (node->getParentEdgeAt(i)->getDims().ndims() != 2 &&
+                node->getParentEdgeAt(i)->getDims().ndims() != 4 &&
+                node->getParentEdgeAt(i)->getDims().ndims() != 5)
+                return false;
+            if (maxChannels < node->getParentEdgeAt(i)->getDims()[1])
+                maxChannels = node->getParentEdgeAt(i)->getDims()[1];
         }
+
+        int simdWidth = mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common) ? 16 :
+                        mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx2) ? 8 : 4;
+        return maxChannels >= simdWidth;
     };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
+    // A chain of scalar operations is applied by the kernel over the flat buffers in the layout the inputs come in
+    auto isSutableForScalarOps = [](MKLDNNNodePtr node) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(node.get());
+        if (eltwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get Eltwise node " << node->getName();
+
+        auto ndims = node->getParentEdgeAt(0)->getDims().ndims();
+        auto prec = node->getCnnLayer()->outData[0]->getPrecision();
+        return ndims >= 1 && ndims <= 5 && (prec == Precision::FP32 || prec == Precision::BF16) &&
+               eltwiseNode->isUnitScales() && !eltwiseNode->isWithBroadcast() && eltwiseNode->isFusedWithScalarOpsOnly();
+    };
+
+    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr node) {
         if (!node->getCnnLayer())
             return false;
 
@@ -1881,19 +2087,35 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
             auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
             if (quantizeNode == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
+            return !quantizeNode->isBinarization() && isSutableForChannelWiseOps(parentNode);
         } else if (node->getType() == Activation) {
-            // Applicability was narrowed down in order not to affect FP32 topologies
+            auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            if (activationNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
+
+            if (isSutableForScalarOps(parentNode)) {
+                return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_gelu, eltwise_elu, eltwise_tanh, eltwise_logistic,
+                                                                eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear, eltwise_bounded_relu,
+                                                                eltwise_soft_relu, eltwise_clamp, eltwise_exp, eltwise_swish});
+            }
+
+            // Out of a chain of scalar operations the channels last layout of the kernel is only worth it
+            // in front of a Quantize, in order not to affect FP32 topologies
             if (node->getChildEdges().size() != 1)
                 return false;
             if (node->getChildEdgeAt(0)->getChild()->getType() != Quantize)
                 return false;
 
-            auto *activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
-            if (activationNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get activation layer " << node->getName();
-            return isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_logistic, eltwise_bounded_relu,
+            return isSutableForChannelWiseOps(parentNode) &&
+                   isOneOf(activationNode->getAlgorithm(), {eltwise_relu, eltwise_elu, eltwise_logistic, eltwise_bounded_relu,
                                                             eltwise_clamp, eltwise_swish});
+        } else if (node->getType() == Power) {
+            auto *powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+            if (powerNode == nullptr)
+                THROW_IE_EXCEPTION << "Cannot get power layer " << node->getName();
+
+            return isSutableForScalarOps(parentNode) &&
+                   (powerNode->getPower() == 1.0f || powerNode->getPower() == 2.0f || powerNode->getPower() == 0.5f);
         }
 
         return false;
@@ -1908,7 +2130,7 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
         }
 
         auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
+        if (!isSutableChildNode(parentNode, childNode)) {
             parent++;
             continue;
         }
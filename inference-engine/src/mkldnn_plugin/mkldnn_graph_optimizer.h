@@ -36,8 +36,11 @@ private:
     void FuseConvolutionAndQuantize(MKLDNNGraph &graph);
     void FuseBinaryConvolutionAndQuantize(MKLDNNGraph &graph);
     void FusePoolingAndQuantize(MKLDNNGraph &graph);
+    void CompressFullyConnectedWeights(MKLDNNGraph &graph);
 #endif
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
+    void SparsifyFullyConnectedWeights(MKLDNNGraph &graph);
+    void SplitFullyConnectedWeightsByNumaNodes(MKLDNNGraph &graph);
 #if defined(COMPILED_CPU_MKLDNN_ELTWISE_NODE)
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
 #endif
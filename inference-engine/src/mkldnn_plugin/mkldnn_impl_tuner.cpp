@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_impl_tuner.hpp"
+
+namespace MKLDNNPlugin {
+
+namespace {
+// another implementation must be faster than the preferred one by the margin, so the noise does not change the choice
+constexpr double preferredMargin = 0.95;
+}  // namespace
+
+size_t MKLDNNImplTuner::select(const std::string& layer, const std::string& shapes,
+                               const std::vector<impl_desc_type>& implementations,
+                               const std::function<double(size_t)>& measure) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto& found = entries[layer + "|" + shapes];
+        if (!found)
+            found = std::make_shared<Entry>();
+        entry = found;
+    }
+
+    // only the measurement of the same layer is serialized, the graphs wait for it instead of measuring concurrently
+    std::unique_lock<std::mutex> lock(entry->guard);
+    if (entry->measured)
+        return entry->selected;
+
+    double best = implementations.empty() ? -1 : measure(0);
+    for (size_t i = 1; i < implementations.size(); i++) {
+        const double time = measure(i);
+        if (time >= 0 && (best < 0 || time < best * preferredMargin)) {
+            best = time;
+            entry->selected = i;
+        }
+    }
+    entry->measured = true;
+
+    if (entry->selected < implementations.size()) {
+        std::unique_lock<std::mutex> selectedLock(guard);
+        selected.emplace(layer, implementations[entry->selected]);
+    }
+    return entry->selected;
+}
+
+std::map<std::string, impl_desc_type> MKLDNNImplTuner::getSelected() const {
+    std::unique_lock<std::mutex> lock(guard);
+    return selected;
+}
+
+}  // namespace MKLDNNPlugin
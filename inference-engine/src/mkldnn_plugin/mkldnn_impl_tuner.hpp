@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn/iml_type_mapper.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Load time choice of the fastest implementation of the nodes
+ * A node times its candidate implementations on the actual shapes once per executable network,
+ * the graphs of the other streams take the measured choice and the exported network keeps it.
+ *
+ * Is a thread safe
+ */
+class MKLDNNImplTuner {
+public:
+    typedef std::shared_ptr<MKLDNNImplTuner> Ptr;
+
+    /**
+     * @param candidates The maximal number of the implementations timed per node, the preferred one included
+     */
+    explicit MKLDNNImplTuner(size_t candidates) : candidates(candidates) {}
+
+    size_t getCandidates() const {
+        return candidates;
+    }
+
+    /**
+     * Returns the index of the fastest of the implementations, the first one is the preferred implementation
+     * The first graph created for the layer and the shapes measures them, the graphs of the other streams wait for it.
+     * @param measure Returns the time of an execution of the implementation, a negative one if it cannot be executed
+     */
+    size_t select(const std::string& layer, const std::string& shapes, const std::vector<impl_desc_type>& implementations,
+                  const std::function<double(size_t)>& measure);
+
+    /**
+     * Returns the implementations chosen for the shapes the layers were tuned for first
+     */
+    std::map<std::string, impl_desc_type> getSelected() const;
+
+private:
+    struct Entry {
+        std::mutex guard;
+        bool measured = false;
+        size_t selected = 0;
+    };
+
+    size_t candidates;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+    std::map<std::string, impl_desc_type> selected;
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,14 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <map>
@@ -11,6 +19,8 @@
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
+#include <ie_parallel.hpp>
+#include <ie_tracing.hpp>
 #include "inference_engine.hpp"
 #include "mkldnn_exec_network.h"
 
@@ -57,36 +67,76 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
 
 namespace {
 
-template <typename T>
-void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
-    if (!dst) {
-        return;
-    }
-    const InferenceEngine::TBlob<T>* t_blob = dynamic_cast<const InferenceEngine::TBlob<T>*>(src);
-    if (t_blob == nullptr) {
-        THROW_IE_EXCEPTION << "input type is " << src->getTensorDesc().getPrecision() << " but input is not "
-                           << typeid(T).name();
+// The graph can work on the memory of a user blob directly only if the blob has exactly the same precision
+// and memory layout as the graph edge and its buffer is aligned to the element size
+bool canUseDirectly(const InferenceEngine::Blob::Ptr& userBlob, const InferenceEngine::Blob::Ptr& graphBlob) {
+    if (userBlob->getTensorDesc() != graphBlob->getTensorDesc())
+        return false;
+    auto elementSize = userBlob->getTensorDesc().getPrecision().size();
+    return reinterpret_cast<uintptr_t>(userBlob->cbuffer().as<const void*>()) % elementSize == 0;
+}
+
+// Binds the states of a session to the graph for an inference, the graph gets its own states back afterwards
+class StateSessionBinding {
+public:
+    StateSessionBinding(MKLDNNPlugin::MKLDNNStateSessions& sessions, int64_t sessionId, MKLDNNPlugin::MKLDNNGraph& graph)
+        : sessions(sessions), sessionId(sessionId), graph(graph), buffers(sessions.Lock(sessionId)) {
+        try {
+            graph.ExchangeStates(buffers);
+        } catch (...) {
+            sessions.Unlock(sessionId);
+            throw;
+        }
     }
 
-    const T* srcPtr = t_blob->readOnly();
-    if (srcPtr == nullptr) {
-        THROW_IE_EXCEPTION << "Input data was not allocated.";
+    ~StateSessionBinding() {
+        graph.ExchangeStates(buffers);
+        sessions.Unlock(sessionId);
     }
-    for (size_t i = 0; i < t_blob->size(); i++) dst[i] = srcPtr[i];
+
+private:
+    MKLDNNPlugin::MKLDNNStateSessions& sessions;
+    int64_t sessionId;
+    MKLDNNPlugin::MKLDNNGraph& graph;
+    MKLDNNPlugin::MKLDNNGraph::StateBuffers& buffers;
+};
+
+// Copies the rows and the columns of the region with the given size of every image plane of the dense NCHW blobs
+void copyRegion(const InferenceEngine::Blob::Ptr& src, const std::array<size_t, 2>& srcBegin,
+                const InferenceEngine::Blob::Ptr& dst, const std::array<size_t, 2>& dstBegin,
+                const std::array<size_t, 2>& size) {
+    const auto& srcDims = src->getTensorDesc().getDims();
+    const auto& dstDims = dst->getTensorDesc().getDims();
+    const size_t elementSize = src->getTensorDesc().getPrecision().size();
+    const auto* srcData = src->cbuffer().as<const uint8_t*>();
+    auto* dstData = dst->buffer().as<uint8_t*>();
+    InferenceEngine::parallel_for2d(srcDims[0] * srcDims[1], size[0], [&](size_t plane, size_t y) {
+        std::memcpy(dstData + ((plane * dstDims[2] + dstBegin[0] + y) * dstDims[3] + dstBegin[1]) * elementSize,
+                    srcData + ((plane * srcDims[2] + srcBegin[0] + y) * srcDims[3] + srcBegin[1]) * elementSize,
+                    size[1] * elementSize);
+    });
 }
 
 }  // namespace
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     IE_PROFILING_AUTO_SCOPE_TASK(profilingTask)
-    graph = execNetwork->_graphs.local().get();
+    IE_TRACE_SCOPE("request", profilingTask.name);
+    PerfHistogramScope latency(execNetwork->_inferLatency);
+    if (execNetwork->_tiling) {
+        inferTiles();
+        return;
+    }
+    if (execNetwork->_dynamicShapesCacheSize > 0) {
+        selectGraphForInputs();
+    } else {
+        graph = execNetwork->_graphs.local().get();
+    }
     {
-        execDataPreprocessing(_inputs);
+        execPreprocessing();
 
         changeDefaultPtr();
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
@@ -94,8 +144,12 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     << input.first;
             }
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
+            auto normalized = normalizedInputs.find(input.first);
+            if (normalized != normalizedInputs.end()) {
+                graph->PushInputData(input.first, normalized->second, false);
+                continue;
+            }
+
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
@@ -106,55 +160,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 case InferenceEngine::Precision::I8:
                     pushInput<int8_t>(input.first, input.second);
                     break;
+                // The integer inputs of FP32 input nodes (U16, with a mean image) are converted by the graph
+                // in the same pass as the mean is subtracted
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                        input.second->getTensorDesc().getDims(),
-                                                                        input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    pushInput<uint16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    pushInput<int16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
                 case InferenceEngine::Precision::BOOL:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
@@ -162,11 +178,260 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         }
     }
 
+    std::unique_ptr<StateSessionBinding> stateBinding;
+    if (stateSession >= 0)
+        stateBinding.reset(new StateSessionBinding(*execNetwork->_stateSessions, stateSession, *graph));
+
     graph->Infer(m_curBatch);
 
     graph->PullOutputData(_outputs);
 }
 
+// The U8 input with mean values is converted to FP32 and normalized by the pre-processing itself
+// in the same pass as the resize and the color conversion, instead of the separate conversion
+// and the mean subtraction on the pushing of the input. The plugin does not apply stdScale,
+// so such inputs keep the default path.
+bool MKLDNNPlugin::MKLDNNInferRequest::canNormalizeInPreprocessing(const std::string& name,
+                                                                   const InferenceEngine::Blob::Ptr& blob) const {
+    if (blob->getTensorDesc().getPrecision() != InferenceEngine::Precision::U8 || !graph->hasMeanImageFor(name))
+        return false;
+
+    const auto& preProcess = _networkInputs.at(name)->getPreProcess();
+    if (preProcess.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+        if (preProcess[c]->stdScale != 1.0f)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::execPreprocessing() {
+    for (auto& input : _inputs) {
+        auto preProcData = _preProcData.find(input.first);
+        if (preProcData == _preProcData.end())
+            continue;
+
+        const auto& preProcess = _networkInputs[input.first]->getPreProcess();
+        if (!canNormalizeInPreprocessing(input.first, input.second)) {
+            normalizedInputs.erase(input.first);
+            preProcData->second->execute(input.second, preProcess, false, m_curBatch);
+            continue;
+        }
+
+        const auto& desc = input.second->getTensorDesc();
+        auto& normalized = normalizedInputs[input.first];
+        if (!normalized || normalized->getTensorDesc().getDims() != desc.getDims() ||
+            normalized->getTensorDesc().getLayout() != desc.getLayout()) {
+            normalized = getPooledBlob(normalizedPools[input.first],
+                                       {InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()});
+        }
+        preProcData->second->execute(normalized, preProcess, false, m_curBatch);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectGraphForInputs() {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (auto&& input : _inputs) {
+        shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    auto selected = execNetwork->GetGraph(shapes);
+    if (selected.get() == graph)
+        return;
+    graph = selected.get();
+    shapeGraph = selected;
+
+    // blobs can be used by the graph directly only if their descriptors match the edges of this graph
+    externalPtr.clear();
+    InferenceEngine::BlobMap blobs;
+    graph->getInputBlobs(blobs);
+    for (auto&& input : _inputs) {
+        if (canBindInput(input.first, input.second, blobs[input.first])) {
+            externalPtr[input.first] = input.second->buffer();
+        }
+    }
+    blobs.clear();
+    graph->getOutputBlobs(blobs);
+    for (auto&& output : blobs) {
+        auto& userBlob = _outputs[output.first];
+        if (!userBlob || userBlob->getTensorDesc().getDims() != output.second->getTensorDesc().getDims()) {
+            userBlob = getPooledBlob(outputPools[output.first], output.second->getTensorDesc());
+        }
+        if (canBindOutput(userBlob, output.second)) {
+            externalPtr[output.first] = userBlob->buffer();
+        }
+    }
+}
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::getPooledBlob(BlobPool& pool,
+                                                                           const InferenceEngine::TensorDesc& desc) const {
+    for (const auto& blob : pool.blobs) {
+        if (blob->getTensorDesc() == desc)
+            return blob;
+    }
+
+    size_t byteSize = desc.getPrecision().size() * InferenceEngine::details::product(desc.getDims());
+    if (pool.buffers.empty() || pool.buffers.back()->byteSize() < byteSize) {
+        // the capacity is doubled, so a sequence of the growing shapes reallocates the buffer a few times only
+        size_t capacity = pool.buffers.empty() ? byteSize : std::max(byteSize, 2 * pool.buffers.back()->byteSize());
+        auto buffer = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, {capacity},
+                                                                  InferenceEngine::Layout::C});
+        buffer->allocate();
+        // the blobs on the smaller buffers are not reused, the buffers are kept since the user can hold them
+        pool.blobs.clear();
+        pool.buffers.push_back(buffer);
+    }
+
+    // a blob is kept for every shape of the cache of the graphs
+    if (pool.blobs.size() >= static_cast<size_t>(std::max(execNetwork->_dynamicShapesCacheSize, 1)))
+        pool.blobs.erase(pool.blobs.begin());
+    auto blob = make_blob_with_precision(desc, pool.buffers.back()->buffer().as<void*>());
+    pool.blobs.push_back(blob);
+    return blob;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::hasVariableShapes() const {
+    return execNetwork->_dynamicShapesCacheSize > 0 || execNetwork->_tiling;
+}
+
+// Every stream takes the next tile until none are left, so the streams busy with other requests do not delay
+// the inference: when they are free the tiles are already taken. The state is shared with the tasks queued to
+// the streams, which can start after the inference is finished.
+struct MKLDNNPlugin::MKLDNNInferRequest::TilesState {
+    std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
+    std::vector<Tile>                   tiles;
+    std::string                         inputName;
+    InferenceEngine::Blob::Ptr          input;
+    InferenceEngine::BlobMap            outputs;
+    std::atomic<size_t>                 next = {0};
+    std::mutex                          mutex;
+    std::condition_variable             finishedCondition;
+    size_t                              finished = 0;
+    std::exception_ptr                  exception;
+};
+
+void MKLDNNPlugin::MKLDNNInferRequest::inferTiles() {
+    if (!_preProcData.empty())
+        THROW_IE_EXCEPTION << "The pre-processing of the inputs is not supported together with the tiling";
+
+    const auto& input = *_inputs.begin();
+    const auto& inputDesc = input.second->getTensorDesc();
+    const auto& dims = inputDesc.getDims();
+    const auto& networkDims = _networkInputs[input.first]->getTensorDesc().getDims();
+    // ROI blobs are not dense, so they differ from the descriptor created from the dimensions
+    if (inputDesc != InferenceEngine::TensorDesc(inputDesc.getPrecision(), dims, InferenceEngine::Layout::NCHW) ||
+        dims[0] != networkDims[0] || dims[1] != networkDims[1])
+        THROW_IE_EXCEPTION << "The tiling supports the dense NCHW input blobs with the batch and the channels of the network only";
+
+    const auto& tiling = *execNetwork->_tiling;
+    auto state = std::make_shared<TilesState>();
+    state->execNetwork = execNetwork;
+    state->tiles = SplitIntoTiles(tiling, {{dims[2], dims[3]}});
+    state->inputName = input.first;
+    state->input = input.second;
+    for (auto&& output : _networkOutputs) {
+        const auto& stride = tiling.outputStrides.at(output.first);
+        auto outputDims = output.second->getTensorDesc().getDims();
+        outputDims[2] = dims[2] / stride[0];
+        outputDims[3] = dims[3] / stride[1];
+        InferenceEngine::TensorDesc desc{output.second->getPrecision(), outputDims, InferenceEngine::Layout::NCHW};
+        auto& userBlob = _outputs[output.first];
+        if (!userBlob || userBlob->getTensorDesc() != desc) {
+            userBlob = getPooledBlob(outputPools[output.first], desc);
+        }
+        state->outputs[output.first] = userBlob;
+    }
+
+    auto streams = static_cast<size_t>(execNetwork->_streamsConfiguration.at("streams"));
+    for (size_t i = 1; i < std::min(streams, state->tiles.size()); i++) {
+        execNetwork->_taskExecutor->run([state] {
+            inferTilesOfStream(*state);
+        });
+    }
+    inferTilesOfStream(*state);
+
+    std::unique_lock<std::mutex> lock{state->mutex};
+    state->finishedCondition.wait(lock, [&] { return state->finished == state->tiles.size(); });
+    if (state->exception)
+        std::rethrow_exception(state->exception);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::inferTilesOfStream(TilesState& state) {
+    const size_t count = state.tiles.size();
+    size_t index = state.next++;
+    if (index >= count)
+        return;
+
+    // the graph of the stream is never bound to the user blobs in this mode, the windows are copied instead
+    const auto& tiling = *state.execNetwork->_tiling;
+    MKLDNNGraph::Ptr graph;
+    InferenceEngine::Blob::Ptr windowInput;
+    InferenceEngine::BlobMap windowOutputs;
+    for (; index < count; index = state.next++) {
+        bool failed;
+        {
+            std::lock_guard<std::mutex> lock{state.mutex};
+            failed = state.exception != nullptr;
+        }
+        // the tiles taken after a failure are only counted
+        if (!failed) {
+            try {
+                if (!graph) {
+                    graph = state.execNetwork->_graphs.local();
+                    auto dims = state.input->getTensorDesc().getDims();
+                    dims[2] = tiling.window(0);
+                    dims[3] = tiling.window(1);
+                    InferenceEngine::TensorDesc inputDesc{state.input->getTensorDesc().getPrecision(), dims,
+                                                          InferenceEngine::Layout::NCHW};
+                    windowInput = make_blob_with_precision(inputDesc);
+                    windowInput->allocate();
+                    for (auto&& output : state.outputs) {
+                        const auto& stride = tiling.outputStrides.at(output.first);
+                        auto outputDims = output.second->getTensorDesc().getDims();
+                        outputDims[2] = tiling.window(0) / stride[0];
+                        outputDims[3] = tiling.window(1) / stride[1];
+                        InferenceEngine::TensorDesc outputDesc{output.second->getTensorDesc().getPrecision(), outputDims,
+                                                               InferenceEngine::Layout::NCHW};
+                        auto& windowOutput = windowOutputs[output.first];
+                        windowOutput = make_blob_with_precision(outputDesc);
+                        windowOutput->allocate();
+                    }
+                }
+
+                const auto& tile = state.tiles[index];
+                copyRegion(state.input, tile.windowBegin, windowInput, {{0, 0}}, {{tiling.window(0), tiling.window(1)}});
+                graph->PushInputData(state.inputName, windowInput);
+                graph->Infer();
+                graph->PullOutputData(windowOutputs);
+                // only the outputs of the tile itself are taken, the ones of the halo are computed by the neighbours
+                for (auto&& output : state.outputs) {
+                    const auto& stride = tiling.outputStrides.at(output.first);
+                    std::array<size_t, 2> srcBegin, dstBegin, size;
+                    for (size_t i = 0; i < 2; i++) {
+                        srcBegin[i] = (tile.begin[i] - tile.windowBegin[i]) / stride[i];
+                        dstBegin[i] = tile.begin[i] / stride[i];
+                        size[i] = (tile.end[i] - tile.begin[i]) / stride[i];
+                    }
+                    copyRegion(windowOutputs[output.first], srcBegin, output.second, dstBegin, size);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{state.mutex};
+                if (!state.exception)
+                    state.exception = std::current_exception();
+            }
+        }
+
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock{state.mutex};
+            last = ++state.finished == count;
+        }
+        if (last)
+            state.finishedCondition.notify_all();
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -192,12 +457,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkUserBlob(data, name, true);
             return;
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -208,12 +472,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (canBindInput(name, _inputs[name], blobs[name])) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkUserBlob(data, name, true);
         return;
     }
     blobs.clear();
@@ -221,23 +484,41 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkUserBlob(data, name, false);
             return;
         }
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (canBindOutput(_outputs[name], blobs[name])) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkUserBlob(data, name, false);
         return;
     }
     THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::checkUserBlob(const InferenceEngine::Blob::Ptr& blob, const std::string& name,
+                                                     bool isInput) const {
+    // with dynamic shapes the dimensions are validated by the shape inference of the network,
+    // with the tiling they are validated on the split of the image
+    if (hasVariableShapes() && blob)
+        checkBlob(blob, name, isInput, blob->getTensorDesc().getDims());
+    else
+        checkBlob(blob, name, isInput);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    for (auto const& input : _inputs) {
+        checkUserBlob(input.second, input.first, true);
+    }
+    for (auto const& output : _outputs) {
+        checkUserBlob(output.second, output.first, false);
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
     IE_PROFILING_AUTO_SCOPE(SetBlob)
     if (name == nullptr) {
@@ -277,20 +558,28 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (hasVariableShapes()) {
+                // the graph for the blob dimensions is selected or the blob is split into tiles at the inference
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Rank mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                }
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            InferenceEngine::BlobMap blobs;
+            graph->getInputBlobs(blobs);
+            if (canBindInput(name, data, blobs[name])) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -302,22 +591,30 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+        if (hasVariableShapes()) {
+            // the blob is reallocated at the inference if its dimensions do not match the inputs
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Rank mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
         }
         if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        InferenceEngine::BlobMap blobs;
+        graph->getOutputBlobs(blobs);
+        if (canBindOutput(data, blobs[name])) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -326,16 +623,37 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::canBindInput(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob,
+                                                    const InferenceEngine::Blob::Ptr& graphBlob) const {
+    // mean image is subtracted in place, so it would corrupt the user data
+    return graphBlob && graph->_meanImages.find(name) == graph->_meanImages.end() &&
+        !graph->getProperty().batchLimit && canUseDirectly(userBlob, graphBlob);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::canBindOutput(const InferenceEngine::Blob::Ptr& userBlob,
+                                                     const InferenceEngine::Blob::Ptr& graphBlob) const {
+    return graphBlob && !graph->getProperty().batchLimit && canUseDirectly(userBlob, graphBlob);
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
+    auto countZeroCopy = [&] (const std::string& name, const MKLDNNEdgePtr& edge, void* ptr) {
+        if (edge->getMemory().GetPrimitive().get_data_handle() == ptr) {
+            auto counter = execNetwork->_zeroCopyInferences.find(name);
+            if (counter != execNetwork->_zeroCopyInferences.end())
+                counter->second++;
+        }
+    };
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
         if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second) {
+                countZeroCopy(it.first, input->second->getChildEdgeAt(0), it.second);
                 continue;
+            }
             // Input cannot be in-place with other primitives
             bool canBeInPlace = true;
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
@@ -365,6 +683,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
+            countZeroCopy(it.first, input->second->getChildEdgeAt(0), it.second);
             continue;
         }
 
@@ -376,8 +695,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             }
         }
         if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
+            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second) {
+                countZeroCopy(it.first, output->getParentEdgeAt(0), it.second);
                 continue;
+            }
             bool canBeInPlace = true;
             void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
             // Cannot be in-place after concat because concat is using different ptrs without offsets
@@ -399,6 +720,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             } while (previousParent != parent);
             if (canBeInPlace)
                 changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            countZeroCopy(it.first, output->getParentEdgeAt(0), it.second);
             continue;
         }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
@@ -417,3 +739,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 
     m_curBatch = new_batch;
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetStateSession(int64_t sessionId) {
+    if (sessionId >= 0 && !execNetwork->_stateSessions)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The network has no states which can be kept per session";
+    stateSession = sessionId < 0 ? -1 : sessionId;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStateSession(int64_t sessionId) {
+    if (!execNetwork->_stateSessions)
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The network has no states which can be kept per session";
+    execNetwork->_stateSessions->Release(sessionId);
+}
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -43,13 +44,49 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void SetStateSession(int64_t sessionId) override;
+
+    void ReleaseStateSession(int64_t sessionId) override;
+
+    void checkBlobs() override;
+
 private:
+    // The buffers of the blobs reallocated for the shapes of the inputs. A buffer is shared by the blobs of
+    // all shapes it fits, and the blobs are kept for the repeating shapes, so variable shapes do not allocate
+    // the memory at every inference once the largest one is seen.
+    struct BlobPool {
+        std::vector<InferenceEngine::Blob::Ptr> buffers;
+        std::vector<InferenceEngine::Blob::Ptr> blobs;
+    };
+
+    // the tiles of an inference shared by the streams, see inferTiles()
+    struct TilesState;
+
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    bool canBindInput(const std::string& name, const InferenceEngine::Blob::Ptr& userBlob,
+                      const InferenceEngine::Blob::Ptr& graphBlob) const;
+    bool canBindOutput(const InferenceEngine::Blob::Ptr& userBlob, const InferenceEngine::Blob::Ptr& graphBlob) const;
     void changeDefaultPtr();
+    void selectGraphForInputs();
+    void inferTiles();
+    static void inferTilesOfStream(TilesState& state);
+    bool hasVariableShapes() const;
+    void checkUserBlob(const InferenceEngine::Blob::Ptr& blob, const std::string& name, bool isInput) const;
+    bool canNormalizeInPreprocessing(const std::string& name, const InferenceEngine::Blob::Ptr& blob) const;
+    void execPreprocessing();
+    InferenceEngine::Blob::Ptr getPooledBlob(BlobPool& pool, const InferenceEngine::TensorDesc& desc) const;
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps the graph compiled for the input shapes alive after it is evicted from the cache of the stream
+    MKLDNNGraph::Ptr                    shapeGraph;
     std::map<std::string, void*>        externalPtr;
+    // FP32 inputs produced by the pre-processing with the mean values already subtracted
+    InferenceEngine::BlobMap            normalizedInputs;
+    std::map<std::string, BlobPool>     normalizedPools;
+    std::map<std::string, BlobPool>     outputPools;
     InferenceEngine::ProfilingTask      profilingTask;
+    // the session the states of the inferences are taken from, negative for the states of the graph
+    int64_t                             stateSession = -1;
 };
 }  // namespace MKLDNNPlugin
@@ -7,12 +7,14 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Strategy strategy) : _boxes(boxes), _strategy(strategy) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -58,6 +60,9 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
 
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+    if (_strategy == Strategy::BestFit)
+        return solveBestFit();
+
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
@@ -96,6 +101,49 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveBestFit() {
+    // Sort by box size. First is biggest, the longest living one among boxes of the same size
+    std::stable_sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+        return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+    });
+
+    std::vector<std::pair<const Box*, int64_t>> placed;  // boxes with their offsets
+    placed.reserve(_boxes.size());
+    std::vector<std::pair<int64_t, int64_t>> alive;  // offset and size of boxes which intersect in time
+    int64_t _min_required = 0;
+
+    for (const Box& box : _boxes) {
+        alive.clear();
+        for (auto& item : placed) {
+            const Box* other = item.first;
+            if (other->start <= box.finish && box.start <= other->finish)
+                alive.emplace_back(item.second, other->size);
+        }
+        std::sort(alive.begin(), alive.end());
+
+        // the smallest gap between alive boxes the box fits in, or the top of them
+        int64_t offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (auto& item : alive) {
+            int64_t gap = item.first - top;
+            if (gap >= box.size && gap < best_gap) {
+                best_gap = gap;
+                offset = top;
+            }
+            top = std::max(top, item.first + item.second);
+        }
+        if (offset == -1)
+            offset = top;
+
+        placed.emplace_back(&box, offset);
+        _min_required = std::max(_min_required, offset + box.size);
+        _offsets[box.id] = offset;
+    }
+
+    return _min_required;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
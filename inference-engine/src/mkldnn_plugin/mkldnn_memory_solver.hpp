@@ -42,6 +42,11 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  Two strategies are available. Both of them place boxes in order of decreasing size:
+ *  - FirstFit lifts the box from the bottom over every box it intersects with
+ *  - BestFit puts the box into the smallest gap between the boxes which live at the same time
+ *    and fits it (greedy by size with best-fit offsets). It is closer to maxDepth() on large graphs
  */
 
 class MemorySolver {
@@ -65,7 +70,12 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    enum class Strategy {
+        FirstFit,
+        BestFit,
+    };
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::FirstFit);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -83,12 +93,14 @@ public:
 
 private:
     std::vector<Box> _boxes;
+    Strategy _strategy;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveBestFit();
 };
 
 }  // namespace MKLDNNPlugin
@@ -5,6 +5,10 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
 
+#include <cstring>
+
+#include "cpp_interfaces/exception2status.hpp"
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -15,9 +19,42 @@ std::string  MKLDNNMemoryState::GetName() const {
 
 void  MKLDNNMemoryState::Reset() {
     storage->FillZero();
+    if (appendState)
+        appendState->length = 0;
 }
 
 void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
+    if (appendState) {
+        // the new state is the valid prefix of the append state, the rest is zero
+        const auto& desc = newState->getTensorDesc();
+        auto dims = storage->GetDims();
+        const size_t axis = appendState->axis;
+        if (desc.getPrecision() != Precision::FP32 || desc.getDims().size() != dims.size() ||
+                desc.getLayout() != TensorDesc::getLayoutByDims(desc.getDims()))
+            THROW_IE_EXCEPTION << "The state " << name << " is set by a planar FP32 blob of " << dims.size() << " dims";
+        size_t outer = 1, inner = 1;
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (i != axis && desc.getDims()[i] != static_cast<size_t>(dims[i]))
+                THROW_IE_EXCEPTION << "The state " << name << " differs from the new state not only along the axis " << axis;
+            if (i < axis)
+                outer *= dims[i];
+            else if (i > axis)
+                inner *= dims[i];
+        }
+        const size_t length = desc.getDims()[axis];
+        if (length > appendState->capacity)
+            THROW_IE_EXCEPTION << "The new state exceeds the capacity " << appendState->capacity << " of the state " << name;
+
+        storage->FillZero();
+        auto src = newState->cbuffer().as<const float*>() + desc.getBlockingDesc().getOffsetPadding();
+        auto dst = reinterpret_cast<float*>(storage->GetData()) +
+                   storage->GetDescriptor().data.layout_desc.blocking.offset_padding;
+        for (size_t i = 0; i < outer; i++)
+            std::memcpy(dst + i * appendState->capacity * inner, src + i * length * inner, length * inner * sizeof(float));
+        appendState->length = length;
+        return;
+    }
+
     auto prec = newState->getTensorDesc().getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(prec);
     auto data_layout = MKLDNNMemory::Convert(newState->getTensorDesc().getLayout());
@@ -32,4 +69,77 @@ InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
     return nullptr;
 }
 
+namespace {
+// the alignment of the state buffers, the same as of the memory allocated by mkldnn
+constexpr size_t stateAlignment = 64;
+
+size_t alignSize(size_t size) {
+    return (size + stateAlignment - 1) / stateAlignment * stateAlignment;
+}
+}  // namespace
+
+MKLDNNStateSessions::MKLDNNStateSessions(std::vector<size_t> sizes): sizes(std::move(sizes)) {}
+
+MKLDNNStateSessions::Block MKLDNNStateSessions::AllocateBlock() {
+    size_t total = stateAlignment;
+    for (auto size : sizes)
+        total += 2 * alignSize(size);
+
+    Block block;
+    block.data.reset(new uint8_t[total]);
+    auto ptr = block.data.get() + (stateAlignment - reinterpret_cast<uintptr_t>(block.data.get()) % stateAlignment) % stateAlignment;
+    for (auto size : sizes) {
+        block.buffers.states.push_back(ptr);
+        ptr += alignSize(size);
+        block.buffers.spares.push_back(ptr);
+        ptr += alignSize(size);
+    }
+    return block;
+}
+
+MKLDNNGraph::StateBuffers& MKLDNNStateSessions::Lock(int64_t sessionId) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto it = sessions.find(sessionId);
+    if (it == sessions.end()) {
+        Session session;
+        if (freeBlocks.empty()) {
+            session.block = AllocateBlock();
+        } else {
+            session.block = std::move(freeBlocks.back());
+            freeBlocks.pop_back();
+        }
+        // the inference may have exchanged the state and the spare buffers of the previous session
+        for (size_t i = 0; i < sizes.size(); i++)
+            std::memset(session.block.buffers.states[i], 0, sizes[i]);
+        it = sessions.emplace(sessionId, std::move(session)).first;
+    }
+    if (it->second.locked)
+        THROW_IE_EXCEPTION << REQUEST_BUSY_str << "The state session " << sessionId << " is used by another infer request";
+    it->second.locked = true;
+    return it->second.block.buffers;
+}
+
+void MKLDNNStateSessions::Unlock(int64_t sessionId) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto it = sessions.find(sessionId);
+    if (it != sessions.end())
+        it->second.locked = false;
+}
+
+void MKLDNNStateSessions::Release(int64_t sessionId) {
+    std::lock_guard<std::mutex> lock{mutex};
+    auto it = sessions.find(sessionId);
+    if (it == sessions.end())
+        return;
+    if (it->second.locked)
+        THROW_IE_EXCEPTION << REQUEST_BUSY_str << "The state session " << sessionId << " is used by an infer request";
+    freeBlocks.push_back(std::move(it->second.block));
+    sessions.erase(it);
+}
+
+size_t MKLDNNStateSessions::size() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return sessions.size();
+}
+
 }  // namespace MKLDNNPlugin
\ No newline at end of file
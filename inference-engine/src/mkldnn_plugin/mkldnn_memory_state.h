@@ -6,15 +6,22 @@
 
 #include "cpp_interfaces/impl/ie_memory_state_internal.hpp"
 #include "mkldnn_memory.h"
+#include "mkldnn_graph.h"
+#include "nodes/mkldnn_memory_node.hpp"
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
 public:
-    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name), storage(storage) {}
+    MKLDNNMemoryState(std::string name, MKLDNNMemoryPtr storage, MKLDNNAppendState::Ptr appendState = nullptr) :
+            name(name), storage(storage), appendState(appendState) {}
 
     std::string GetName() const override;
     void Reset() override;
@@ -24,6 +31,56 @@ public:
 private:
     std::string name;
     MKLDNNMemoryPtr storage;
+    MKLDNNAppendState::Ptr appendState;
+};
+
+/**
+ * @brief The states of the sessions of an executable network, see InferRequest::SetStateSession
+ * @details Every session owns a block with the states and the spare buffers of the graph, the blocks of the released
+ * sessions are reused by the new ones. A graph runs an inference of a session by rebinding its state edges to the
+ * buffers of the session, so the states are not copied.
+ */
+class MKLDNNStateSessions {
+public:
+    typedef std::shared_ptr<MKLDNNStateSessions> Ptr;
+
+    /**
+     * @param sizes The sizes of the states of the graphs, see MKLDNNGraph::GetStateSizes
+     */
+    explicit MKLDNNStateSessions(std::vector<size_t> sizes);
+
+    /**
+     * @brief Marks the session as used by an inference, creates it with zero states if it does not exist
+     * @return The buffers of the session, they stay valid until the session is unlocked
+     */
+    MKLDNNGraph::StateBuffers& Lock(int64_t sessionId);
+
+    void Unlock(int64_t sessionId);
+
+    /**
+     * @brief Returns the block of the session to the pool, throws if an inference uses the session
+     */
+    void Release(int64_t sessionId);
+
+    size_t size() const;
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        MKLDNNGraph::StateBuffers buffers;
+    };
+
+    struct Session {
+        Block block;
+        bool locked = false;
+    };
+
+    Block AllocateBlock();
+
+    std::vector<size_t> sizes;
+    mutable std::mutex mutex;
+    std::unordered_map<int64_t, Session> sessions;
+    std::vector<Block> freeBlocks;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
+#include <ie_data_hash.hpp>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -194,6 +195,42 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
     }
 }
 
+MKLDNNNode::~MKLDNNNode() {
+    // the primitive is released to be taken by the node of another graph
+    if (primitivesCache && cachedPrimitive.primitive)
+        primitivesCache->put(cachedPrimitiveKey, std::move(cachedPrimitive));
+}
+
+bool MKLDNNNode::takeCachedPrimitive(const std::vector<mkldnn::memory>& memories) {
+    // nodes of graphs created for the same network have the same names and fusing, so the name defines
+    // the primitive attributes while the memory descriptors depend on the input shapes
+    std::string key = name + "|" + std::to_string(static_cast<int>(getSelectedPrimitiveDescriptor()->getImplementationType()));
+    for (auto& node : fusedWith)
+        key += "|" + node->getName();
+    for (auto& node : mergedWith)
+        key += "|" + node->getName();
+    for (auto& memory : memories)
+        key += "|" + MKLDNNPrimitivesCache::describe(memory);
+
+    cachedPrimitiveKey = key;
+    boundMemories = memories;
+    if (primitivesCache->take(cachedPrimitiveKey, cachedPrimitive)) {
+        prim = cachedPrimitive.primitive;
+        return true;
+    }
+
+    cachedPrimitive.engine = engine;
+    cachedPrimitive.memories.clear();
+    for (auto& memory : memories)
+        cachedPrimitive.memories.emplace_back(memory.get_primitive_desc(), memory.get_data_handle());
+    return false;
+}
+
+void MKLDNNNode::setCachedPrimitive(mkldnn::primitive* primitive) {
+    cachedPrimitive.primitive.reset(primitive);
+    prim = cachedPrimitive.primitive;
+}
+
 void MKLDNNNode::addEdge(const MKLDNNEdgeWeakPtr& edge) {
     auto edgePtr = edge.lock();
     if (!edgePtr)
@@ -385,6 +422,44 @@ void MKLDNNNode::resolveNotAllocatedEdges() {
     }
 }
 
+uint64_t MKLDNNNode::getFlops() const {
+    if (!cnnLayer || parentEdges.empty() || childEdges.empty())
+        return 0;
+    const auto inDims = getParentEdgeAt(0)->getDims();
+    const auto outDims = getChildEdgeAt(0)->getDims();
+    if (inDims.ndims() < 2 || outDims.ndims() < 2)
+        return 0;
+
+    // a multiply and an add per element of the products
+    switch (type) {
+        case Convolution:
+        case Deconvolution: {
+            auto* convLayer = dynamic_cast<InferenceEngine::ConvolutionLayer*>(cnnLayer.get());
+            if (!convLayer || convLayer->_group == 0)
+                return 0;
+            uint64_t kernel = 1;
+            for (size_t i = 0; i < convLayer->_kernel.size(); i++)
+                kernel *= convLayer->_kernel[i];
+            // every output point of a convolution gathers the kernel of all the input channels of its group,
+            // every input point of a deconvolution is scattered to the kernel of all the output channels
+            if (type == Convolution)
+                return 2 * outDims.size() * (inDims[1] / convLayer->_group) * kernel;
+            return 2 * inDims.size() * (outDims[1] / convLayer->_group) * kernel;
+        }
+        case FullyConnected:
+            return 2 * outDims.size() * inDims.size(1);
+        case Gemm: {
+            auto* gemmLayer = dynamic_cast<InferenceEngine::GemmLayer*>(cnnLayer.get());
+            if (!gemmLayer)
+                return 0;
+            auto k = gemmLayer->transpose_a ? inDims[inDims.ndims() - 2] : inDims[inDims.ndims() - 1];
+            return 2 * outDims.size() * k;
+        }
+        default:
+            return 0;
+    }
+}
+
 std::string MKLDNNNode::getPrimitiveDescriptorType() {
     auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
 
@@ -393,40 +468,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
         type = selectedPrimitiveDesc->getImplementationType();
     }
 
-    std::string str_type;
-
-    auto add_type = [&](std::string t) {
-        if (!str_type.empty() && t.c_str()[0] != '_')
-            str_type += "_";
-        str_type += t;
-    };
-
-#define SEARCH_TYPE(_type)                                          \
-    if ((type & impl_desc_type::_type) == impl_desc_type::_type)    \
-        add_type(#_type)
-
-    SEARCH_TYPE(undef);
-    SEARCH_TYPE(reorder);
-    SEARCH_TYPE(jit);
-    SEARCH_TYPE(gemm);
-    SEARCH_TYPE(ref);
-
-    SEARCH_TYPE(avx512);
-    SEARCH_TYPE(avx2);
-    SEARCH_TYPE(avx);
-    SEARCH_TYPE(sse42);
-    SEARCH_TYPE(blas);
-    SEARCH_TYPE(any);
-    SEARCH_TYPE(uni);
-
-    SEARCH_TYPE(winograd);
-    SEARCH_TYPE(_dw);
-    SEARCH_TYPE(_1x1);
-
-    if (type == impl_desc_type::unknown)
-        str_type = "unknown";
-    else if (str_type.empty())
-        str_type = "undef";
+    std::string str_type = impl_type_to_string(type);
 
     // adding layer precision to the performance counters as one of the token
     // currently we treat a layer executing in int8 mode if its input is I8 or U8. if input is U8, we still
@@ -510,6 +552,8 @@ std::vector<memory::format> MKLDNNNode::getAvailableFormatsForDims(const MKLDNND
 
 void MKLDNNNode::execute(mkldnn::stream strm) {
     if (prim) {
+        for (size_t i = 0; i < boundMemories.size() && cachedPrimitive.primitive; i++)
+            cachedPrimitive.memories[i].set_data_handle(boundMemories[i].get_data_handle());
         strm.submit({*prim});
     }
 }
@@ -749,7 +793,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
-        auto create = [&] () {
+        auto reorder = [&] () {
             auto newDesc = MKLDNNMemoryDesc(internalBlob->getTensorDesc());
             auto newFormat = newDesc.getFormat();
             if (newFormat == mkldnn::memory::ncdhw) {
@@ -769,16 +813,33 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             return _ptr;
         };
 
-        MKLDNNMemoryPtr ptr;
-        if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+        uint64_t data_hash = 0;
+        if (weightCache != nullptr || weightsStore != nullptr)
+            data_hash = InferenceEngine::computeDataHash(internalBlob->buffer(), internalBlob->byteSize());
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+        // the reordered weights depend only on the source data and the layout the implementation expects,
+        // so the nodes of different networks and streams with the same weights share them whatever their names
+        std::string content_key;
+        if (weightCache != nullptr || weightsStore != nullptr)
+            content_key = std::to_string(internalBlob->byteSize()) + "_" + std::to_string(data_hash)
+                          + "|" + MKLDNNPrimitivesCache::describe(intDescs[i])
+                          + "|" + std::to_string(static_cast<int>(selected_pd->getImplementationType()));
 
-            ptr = weightCache->findOrCreate(string_hash, create);
+        auto create = [&] () {
+            if (weightsStore == nullptr)
+                return reorder();
+
+            MKLDNNMemoryPtr _ptr = weightsStore->load(content_key, intDescs[i], engine);
+            if (!_ptr) {
+                _ptr = reorder();
+                weightsStore->store(content_key, *_ptr);
+            }
+            return _ptr;
+        };
+
+        MKLDNNMemoryPtr ptr;
+        if (weightCache != nullptr) {
+            ptr = weightCache->findOrCreate(content_key, create);
         } else {
             ptr = create();
         }
@@ -23,6 +23,8 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_primitives_cache.hpp"
+#include "mkldnn_impl_tuner.hpp"
 #include "mkldnn.hpp"
 
 namespace MKLDNNPlugin {
@@ -235,7 +237,7 @@ public:
     static MKLDNNNode* CreateNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
                                   const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache);
 
-    ~MKLDNNNode() override = default;
+    ~MKLDNNNode() override;
 
     void addEdge(const MKLDNNEdgeWeakPtr& edge);
     void removeEdge(const MKLDNNEdgeWeakPtr& edge);
@@ -338,8 +340,26 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Returns the number of floating point operations of an execution of the node, the fused nodes are not counted
+     * @return Zero for the node types the number is not known for
+     */
+    uint64_t getFlops() const;
+
     virtual void setDynamicBatchLim(int lim);
 
+    void setPrimitivesCache(const MKLDNNPrimitivesCache::Ptr& cache) {
+        primitivesCache = cache;
+    }
+
+    void setWeightsStore(const MKLDNNWeightsStore::Ptr& store) {
+        weightsStore = store;
+    }
+
+    void setImplTuner(const MKLDNNImplTuner::Ptr& tuner) {
+        implTuner = tuner;
+    }
+
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
     virtual void initSupportedPrimitiveDescriptors();
@@ -515,6 +535,24 @@ protected:
 
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
+    MKLDNNPrimitivesCache::Ptr primitivesCache;
+    MKLDNNWeightsStore::Ptr weightsStore;
+    // times the implementations of the node at load time, nullptr if the node keeps the preferred one
+    MKLDNNImplTuner::Ptr implTuner;
+
+    /**
+     * @brief Takes the primitive created for the same memory descriptors from the primitives cache
+     * @param memories Memory objects in the order the primitive is created with
+     * @return `true` if the primitive is assigned to prim. Otherwise the primitive must be created
+     *         with cachedPrimitive.memories and passed to setCachedPrimitive()
+     */
+    bool takeCachedPrimitive(const std::vector<mkldnn::memory>& memories);
+    void setCachedPrimitive(mkldnn::primitive* primitive);
+
+    // the primitive works on its own memory objects which point to the data of boundMemories at execution
+    MKLDNNCachedPrimitive cachedPrimitive;
+    std::vector<mkldnn::memory> boundMemories;
+    std::string cachedPrimitiveKey;
 
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
@@ -7,12 +7,18 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <xml_parse_utils.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
+#include <ie_network_intensity.hpp>
+#include <algorithm>
+#include <ie_load_time_profile.hpp>
+#include <ie_transformations_cache.hpp>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
 
@@ -52,7 +58,7 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
+static std::shared_ptr<ICNNNetwork> Transformation(const ICNNNetwork& network, TransformationsCache& cache) {
     const auto transformations_callback = [](const std::shared_ptr<const ::ngraph::Node> &node) -> bool {
         // DepthToSpace node implementation supports only equal input/output tensors with rank <= 5
         if (auto dtsOp = std::dynamic_pointer_cast<const ::ngraph::opset3::DepthToSpace>(node)) {
@@ -64,6 +70,12 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
             return stdOp->input_value(0).get_shape().size() <= 5lu && stdOp->input_value(0).get_shape().size() == stdOp->get_output_shape(0).size();
         }
 
+        // MVN node implementation supports only tensors with rank <= 5
+        if (auto mvnOp = std::dynamic_pointer_cast<const ::ngraph::opset3::MVN>(node)) {
+            return mvnOp->input_value(0).get_partial_shape().rank().is_static() &&
+                   mvnOp->input_value(0).get_partial_shape().rank().get_length() <= 5;
+        }
+
         if (auto fc_op = std::dynamic_pointer_cast<const ngraph::op::FullyConnected>(node)) {
             return fc_op->input_value(0).get_shape().size() == 3ul;
         }
@@ -72,16 +84,32 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
             std::dynamic_pointer_cast<const ::ngraph::opset2::BatchToSpace>(node) ||
             std::dynamic_pointer_cast<const ::ngraph::opset2::SpaceToBatch>(node);
     };
-    auto nGraphFunc = clonedNetwork->getFunction();
-    // Disable shape inference (WA for generic operations)
-    ::ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
-
-    // Note: instead of running all Conversion Transformations you can make up your own transformation pipeline
-    ngraph::pass::CommonOptimizations(transformations_callback).run_on_function(nGraphFunc);
-    ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
-    ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
-    ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
-    clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
+    // The pipeline does not depend on the plugin configuration, so a network loaded several times is transformed once
+    auto transformedFunction = cache.Get(network.getFunction(), [&] {
+        std::shared_ptr<ICNNNetwork> clonedNetwork;
+        {
+            IE_LOAD_PHASE("clone");
+            clonedNetwork = cloneNetwork(network);
+        }
+        auto nGraphFunc = clonedNetwork->getFunction();
+        // Disable shape inference (WA for generic operations)
+        ::ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
+
+        // Note: instead of running all Conversion Transformations you can make up your own transformation pipeline
+        {
+            IE_LOAD_PHASE("common_optimizations");
+            ngraph::pass::CommonOptimizations(transformations_callback).run_on_function(nGraphFunc);
+        }
+        {
+            IE_LOAD_PHASE("opset_conversion");
+            ngraph::pass::ConvertOpSet3ToOpSet2(transformations_callback).run_on_function(nGraphFunc);
+            ngraph::pass::ConvertOpSet2ToOpSet1(transformations_callback).run_on_function(nGraphFunc);
+            ngraph::pass::ConvertOpSet1ToLegacy(transformations_callback).run_on_function(nGraphFunc);
+        }
+        return std::shared_ptr<const ngraph::Function>(nGraphFunc);
+    });
+    IE_LOAD_PHASE("legacy_conversion");
+    return InferenceEngine::details::convertFunctionToICNNNetwork(transformedFunction, network);
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr
@@ -113,20 +141,125 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
-    if (clonedNetwork->getFunction()) {
-        Transformation(clonedNetwork);
+    // the AUTO streams are adjusted to the network, while the transformations do not change its intensity much
+    if (conf.streamExecutorConfig._autoStreams && !conf.exclusiveAsyncRequests && network.getFunction()) {
+        const auto intensity = getNetworkIntensity(*network.getFunction());
+        conf.flopsPerByte = intensity.FlopsPerByte();
+        conf.streamExecutorConfig._streams = IStreamsExecutor::Config::GetModelAwareStreams(
+            intensity, static_cast<size_t>(std::max(0, mkldnn_get_cache_size(2, true))));
+        conf._config.clear();
+        conf.updateProperties();
+    }
+
+    std::shared_ptr<ICNNNetwork> clonedNetwork;
+    if (network.getFunction()) {
+        IE_LOAD_PHASE("transformations");
+        clonedNetwork = Transformation(network, transformationsCache);
+    } else {
+        IE_LOAD_PHASE("clone");
+        clonedNetwork = cloneNetwork(network);
     }
     auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
     if (implNetwork) {
+        IE_LOAD_PHASE("constant_folding");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
     }
 
+    IE_LOAD_PHASE("compile");
     return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
+ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    // configuration of the exported network is overridden by the import configuration
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+         configNode = configNode.next_sibling("config")) {
+        importedConfig.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    Config conf = engConfig;
+    conf.readProperties(importedConfig);
+    conf.readProperties(config);
+
+    // read transformed network
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin exported network";
+    }
+
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+    }
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network does not contain output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
+    }
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(inputs, outputs, networkInputs, networkOutputs);
+
+    auto impl = std::make_shared<MKLDNNExecNetwork>(static_cast<ICNNNetwork&>(cnnnetwork), conf, extensionManager, weightsSharing,
+                                                    false /* applyTransformations */);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl),
+                            [](InferenceEngine::details::IRelease *p) {p->Release();});
+
+    return ExecutableNetwork{executableNetwork};
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
@@ -167,6 +300,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -213,6 +347,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -232,8 +368,7 @@ void Engine::QueryNetwork(const ICNNNetwork& network, const std::map<std::string
                 originalOps.emplace(node->get_friendly_name());
             }
         }
-        auto clonedNetwork = cloneNetwork(network);
-        Transformation(clonedNetwork);
+        auto clonedNetwork = Transformation(network, transformationsCache);
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
         for (details::CNNNetworkIterator itLayer{clonedNetwork.get()}; itLayer != details::CNNNetworkIterator(); itLayer++) {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <ie_transformations_cache.hpp>
 #include "mkldnn_exec_network.h"
 
 #include <string>
@@ -33,6 +34,9 @@ public:
 
     InferenceEngine::Parameter GetMetric(const std::string& name, const std::map<std::string, InferenceEngine::Parameter>& options) const override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
     void QueryNetwork(const InferenceEngine::ICNNNetwork& network,
                       const std::map<std::string, std::string>& config, InferenceEngine::QueryNetworkResult& res) const override;
 
@@ -40,6 +44,8 @@ private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
+    // QueryNetwork and LoadNetwork of HETERO and MULTI share the transformed functions
+    mutable InferenceEngine::TransformationsCache transformationsCache;
 };
 
 }  // namespace MKLDNNPlugin
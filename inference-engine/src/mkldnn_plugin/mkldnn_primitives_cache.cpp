@@ -0,0 +1,70 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitives_cache.hpp"
+
+#include <iterator>
+#include <sstream>
+
+namespace MKLDNNPlugin {
+
+MKLDNNPrimitivesCache::MKLDNNPrimitivesCache(size_t capacity) : capacity(capacity) {}
+
+bool MKLDNNPrimitivesCache::take(const std::string& key, MKLDNNCachedPrimitive& primitive) {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = index.find(key);
+    if (found == index.end()) {
+        statistics.misses++;
+        return false;
+    }
+    statistics.hits++;
+    primitive = std::move(found->second->second);
+    entries.erase(found->second);
+    index.erase(found);
+    return true;
+}
+
+void MKLDNNPrimitivesCache::put(const std::string& key, MKLDNNCachedPrimitive primitive) {
+    std::unique_lock<std::mutex> lock(guard);
+    if (capacity == 0)
+        return;
+    entries.emplace_front(key, std::move(primitive));
+    index.emplace(key, entries.begin());
+    if (entries.size() > capacity) {
+        auto last = std::prev(entries.end());
+        auto range = index.equal_range(last->first);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                index.erase(it);
+                break;
+            }
+        }
+        entries.erase(last);
+    }
+}
+
+MKLDNNPrimitivesCache::Statistics MKLDNNPrimitivesCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock(guard);
+    return statistics;
+}
+
+std::string MKLDNNPrimitivesCache::describe(const mkldnn::memory& memory) {
+    return describe(memory.get_primitive_desc().desc());
+}
+
+std::string MKLDNNPrimitivesCache::describe(const mkldnn::memory::desc& memoryDesc) {
+    const auto& desc = memoryDesc.data;
+    std::ostringstream out;
+    out << desc.data_type << ':' << desc.format << ':';
+    for (int i = 0; i < desc.ndims; i++)
+        out << desc.dims[i] << ',';
+    const auto& blocking = desc.layout_desc.blocking;
+    out << ':';
+    for (int i = 0; i < desc.ndims; i++)
+        out << blocking.padding_dims[i] << '/' << blocking.strides[0][i] << '/' << blocking.offset_padding_to_data[i] << ',';
+    out << ':' << blocking.offset_padding;
+    return out.str();
+}
+
+}  // namespace MKLDNNPlugin
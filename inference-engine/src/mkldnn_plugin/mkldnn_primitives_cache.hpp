@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * A primitive with the memory objects it was created for.
+ * MKLDNN primitives are bound to memory objects, so a cached primitive keeps its own ones
+ * and the node points them to the data of its edges before the execution.
+ */
+struct MKLDNNCachedPrimitive {
+    mkldnn::engine engine{mkldnn::engine::kind::cpu, 0};
+    std::shared_ptr<mkldnn::primitive> primitive;
+    std::vector<mkldnn::memory> memories;
+};
+
+/**
+ * LRU store of primitives which are not used by any graph at the moment
+ * Creation of JIT primitives involves code generation, so the graphs created for other
+ * input shapes or in other streams take the primitives released by destroyed graphs.
+ * A primitive is used by one node at a time: it is removed from the store by take() and
+ * returned by put() when the node is destroyed.
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitivesCache {
+public:
+    typedef std::shared_ptr<MKLDNNPrimitivesCache> Ptr;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    /**
+     * @param capacity The maximal number of stored primitives. The least recently returned ones are released
+     */
+    explicit MKLDNNPrimitivesCache(size_t capacity);
+
+    bool take(const std::string& key, MKLDNNCachedPrimitive& primitive);
+    void put(const std::string& key, MKLDNNCachedPrimitive primitive);
+
+    Statistics getStatistics() const;
+
+    /**
+     * Describes everything the primitive code depends on for the memory: dimensions, data type and layout
+     */
+    static std::string describe(const mkldnn::memory& memory);
+    static std::string describe(const mkldnn::memory::desc& memoryDesc);
+
+private:
+    using Entries = std::list<std::pair<std::string, MKLDNNCachedPrimitive>>;
+
+    const size_t capacity;
+    mutable std::mutex guard;
+    // the most recently returned primitives first
+    Entries entries;
+    std::unordered_multimap<std::string, Entries::iterator> index;
+    Statistics statistics;
+};
+
+}  // namespace MKLDNNPlugin
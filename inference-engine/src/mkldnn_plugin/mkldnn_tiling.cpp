@@ -0,0 +1,178 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tiling.h"
+
+#include <details/caseless.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <ie_layers.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// the layers which compute each output pixel from the same pixel of the inputs
+const caseless_set<std::string> pointwiseTypes = {
+    "ReLU", "ReLU6", "Clamp", "ELU", "Sigmoid", "TanH", "Activation", "PReLU", "Power", "ScaleShift",
+    "BatchNormalization", "Eltwise", "FakeQuantize", "Convert", "Copy", "Gelu", "Erf", "Exp", "Swish",
+    "Mish", "HSwish", "SoftPlus", "Abs", "Sqrt", "Floor", "Concat", "SoftMax"
+};
+
+// how far an output pixel reaches into the network input: the input pixels per an output pixel and the input
+// pixels it depends on at each side, for the height and the width
+struct Reach {
+    std::array<size_t, 2> stride = {{1, 1}};
+    std::array<size_t, 2> radius = {{0, 0}};
+};
+
+size_t gcd(size_t a, size_t b) {
+    return b == 0 ? a : gcd(b, a % b);
+}
+
+size_t roundUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// the window of kernel size k with the dilation d, applied with the stride s, to the data of the input reach
+Reach applyWindow(const CNNLayer& layer, const Reach& input, const PropertyVector<unsigned int>& kernel,
+                  const PropertyVector<unsigned int>* dilation, const PropertyVector<unsigned int>& stride,
+                  bool transposed) {
+    Reach output;
+    const unsigned int axes[] = {Y_AXIS, X_AXIS};
+    for (size_t i = 0; i < 2; i++) {
+        const size_t k = kernel[axes[i]];
+        const size_t d = dilation ? std::max(1u, (*dilation)[axes[i]]) : 1;
+        const size_t s = std::max(1u, stride[axes[i]]);
+        if (transposed) {
+            if (input.stride[i] % s != 0)
+                THROW_IE_EXCEPTION << "The tiling does not support the upsampling of " << layer.name
+                                   << " which is not compensated by the preceding strides";
+            output.stride[i] = input.stride[i] / s;
+            output.radius[i] = input.radius[i] + ((k - 1) * d + s - 1) / s * input.stride[i];
+        } else {
+            output.stride[i] = input.stride[i] * s;
+            output.radius[i] = input.radius[i] + (k - 1) * d * input.stride[i];
+        }
+    }
+    return output;
+}
+
+}  // namespace
+
+TilingInfo GetTilingInfo(const ICNNNetwork& network, size_t tileSize) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    if (inputs.size() != 1 || inputs.begin()->second->getTensorDesc().getDims().size() != 4)
+        THROW_IE_EXCEPTION << "The tiling supports the networks with a single 4D input only";
+
+    TilingInfo info;
+    std::map<std::string, Reach> reaches;
+    reaches[inputs.begin()->second->getInputData()->getName()] = Reach{};
+    auto align = [&] (const Reach& reach) {
+        for (size_t i = 0; i < 2; i++)
+            info.alignment[i] = info.alignment[i] / gcd(info.alignment[i], reach.stride[i]) * reach.stride[i];
+    };
+
+    for (const auto& layer : CNNNetSortTopologically(network)) {
+        std::vector<const Reach*> inputReaches;
+        for (const auto& weakData : layer->insData) {
+            auto reach = reaches.find(weakData.lock()->getName());
+            if (reach != reaches.end())
+                inputReaches.push_back(&reach->second);
+        }
+        // the layers computing the constants do not depend on the image
+        if (inputReaches.empty())
+            continue;
+
+        Reach reach;
+        if (auto deconv = dynamic_cast<DeconvolutionLayer*>(layer.get())) {
+            reach = applyWindow(*layer, *inputReaches[0], deconv->_kernel, &deconv->_dilation, deconv->_stride, true);
+        } else if (dynamic_cast<DeformableConvolutionLayer*>(layer.get())) {
+            THROW_IE_EXCEPTION << "The tiling does not support the deformable convolution " << layer->name;
+        } else if (auto conv = dynamic_cast<ConvolutionLayer*>(layer.get())) {
+            reach = applyWindow(*layer, *inputReaches[0], conv->_kernel, &conv->_dilation, conv->_stride, false);
+        } else if (auto conv = dynamic_cast<BinaryConvolutionLayer*>(layer.get())) {
+            reach = applyWindow(*layer, *inputReaches[0], conv->_kernel, &conv->_dilation, conv->_stride, false);
+        } else if (auto pooling = dynamic_cast<PoolingLayer*>(layer.get())) {
+            reach = applyWindow(*layer, *inputReaches[0], pooling->_kernel, nullptr, pooling->_stride, false);
+        } else if (pointwiseTypes.count(layer->type)) {
+            auto concat = dynamic_cast<ConcatLayer*>(layer.get());
+            auto softmax = dynamic_cast<SoftMaxLayer*>(layer.get());
+            if ((concat && concat->_axis > 1) || (softmax && softmax->axis != 1))
+                THROW_IE_EXCEPTION << "The tiling supports " << layer->type << " along the channels only, "
+                                   << layer->name << " is along the axis " << (concat ? concat->_axis : softmax->axis);
+            reach = *inputReaches[0];
+            for (const auto* input : inputReaches) {
+                if (input->stride != reach.stride)
+                    THROW_IE_EXCEPTION << "The inputs of " << layer->name << " have different strides";
+                for (size_t i = 0; i < 2; i++)
+                    reach.radius[i] = std::max(reach.radius[i], input->radius[i]);
+            }
+        } else {
+            THROW_IE_EXCEPTION << "The tiling does not support the layer " << layer->name << " of the type " << layer->type;
+        }
+
+        align(reach);
+        for (const auto& output : layer->outData)
+            reaches[output->getName()] = reach;
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    std::array<size_t, 2> radius = {{0, 0}};
+    for (const auto& output : outputs) {
+        auto reach = reaches.find(output.first);
+        if (reach == reaches.end() || output.second->getTensorDesc().getDims().size() != 4)
+            THROW_IE_EXCEPTION << "The tiling supports the 4D network outputs computed from the input only, "
+                               << output.first << " is not such one";
+        info.outputStrides[output.first] = reach->second.stride;
+        for (size_t i = 0; i < 2; i++)
+            radius[i] = std::max(radius[i], reach->second.radius[i]);
+    }
+
+    for (size_t i = 0; i < 2; i++) {
+        info.tile[i] = roundUp(std::max<size_t>(tileSize, 1), info.alignment[i]);
+        info.halo[i] = roundUp(radius[i], info.alignment[i]);
+    }
+    return info;
+}
+
+std::vector<Tile> SplitIntoTiles(const TilingInfo& info, const std::array<size_t, 2>& imageSize) {
+    std::array<std::vector<size_t>, 2> begins;
+    for (size_t i = 0; i < 2; i++) {
+        if (imageSize[i] % info.alignment[i] != 0)
+            THROW_IE_EXCEPTION << "The image size " << imageSize[0] << "x" << imageSize[1] << " must be a multiple of "
+                               << info.alignment[0] << "x" << info.alignment[1] << " to be split into tiles";
+        if (imageSize[i] < info.window(i))
+            THROW_IE_EXCEPTION << "The image size " << imageSize[0] << "x" << imageSize[1] << " is smaller than the window "
+                               << info.window(0) << "x" << info.window(1) << " of the tile, decrease KEY_CPU_TILE_SIZE";
+        for (size_t begin = 0; begin < imageSize[i]; begin += info.tile[i])
+            begins[i].push_back(begin);
+    }
+
+    std::vector<Tile> tiles;
+    tiles.reserve(begins[0].size() * begins[1].size());
+    for (auto y : begins[0]) {
+        for (auto x : begins[1]) {
+            Tile tile;
+            tile.begin = {{y, x}};
+            for (size_t i = 0; i < 2; i++) {
+                tile.end[i] = std::min(tile.begin[i] + info.tile[i], imageSize[i]);
+                auto windowBegin = tile.begin[i] > info.halo[i] ? tile.begin[i] - info.halo[i] : 0;
+                tile.windowBegin[i] = std::min(windowBegin, imageSize[i] - info.window(i));
+            }
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The geometry of the tiles a fully convolutional network splits the large images into
+ * @details The sizes are in the input pixels, the first element is for the height and the second one for the width.
+ *          The network is compiled for the windows of a tile and the halo around it, so the outputs of the tile do
+ *          not depend on the pixels out of the window. All the sizes are multiples of the alignment, so the windows
+ *          are aligned to the strides of every layer and the outputs of the tiles are the same as of the whole image.
+ */
+struct TilingInfo {
+    typedef std::shared_ptr<TilingInfo> Ptr;
+
+    std::array<size_t, 2> tile = {{0, 0}};
+    std::array<size_t, 2> halo = {{0, 0}};
+    std::array<size_t, 2> alignment = {{1, 1}};
+    // the input pixels per an output pixel for every network output
+    std::map<std::string, std::array<size_t, 2>> outputStrides;
+
+    size_t window(size_t axis) const {
+        return tile[axis] + 2 * halo[axis];
+    }
+};
+
+/**
+ * @brief The part of the image a tile computes
+ * @details The outputs of the input pixels [begin, end) are taken from the inference of the window, which starts
+ *          at windowBegin. The windows of the border tiles are shifted into the image instead of being padded.
+ */
+struct Tile {
+    std::array<size_t, 2> begin;
+    std::array<size_t, 2> end;
+    std::array<size_t, 2> windowBegin;
+};
+
+/**
+ * @brief Computes the halo from the receptive field of the network outputs
+ * @details Only the layers which keep the spatial correspondence of the pixels are supported: convolutions,
+ *          deconvolutions, poolings, and the layers which compute each pixel from the same pixel of the inputs
+ * @param network The transformed network with a single 4D input
+ * @param tileSize The desired tile size, it is rounded up to the alignment
+ */
+TilingInfo GetTilingInfo(const InferenceEngine::ICNNNetwork& network, size_t tileSize);
+
+/**
+ * @brief Splits the image into the tiles, the image must be aligned and not smaller than the window
+ * @param info The geometry of the tiles
+ * @param imageSize The height and the width of the image
+ */
+std::vector<Tile> SplitIntoTiles(const TilingInfo& info, const std::array<size_t, 2>& imageSize);
+
+}  // namespace MKLDNNPlugin
@@ -4,12 +4,103 @@
 
 #include "mkldnn_weights_cache.hpp"
 
+#include <ie_data_hash.hpp>
 #include <ie_system_conf.h>
+#include <file_utils.h>
+#include <mmap_object.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+namespace {
+
+constexpr char weightsStoreMagic[8] = {'I', 'E', 'C', 'P', 'U', 'W', 'T', '\0'};
+// the data follows the header at the offset aligned as MKLDNN allocates the primitive memory
+constexpr size_t weightsStoreAlignment = 64;
+
+size_t getDataOffset(size_t keySize) {
+    size_t headerSize = sizeof(weightsStoreMagic) + 2 * sizeof(uint64_t) + keySize;
+    return (headerSize + weightsStoreAlignment - 1) / weightsStoreAlignment * weightsStoreAlignment;
+}
+
+}  // namespace
+
+MKLDNNWeightsStore::MKLDNNWeightsStore(const std::string& directory) : directory(directory) {}
+
+std::string MKLDNNWeightsStore::getPath(const std::string& key) const {
+    std::ostringstream name;
+    name << std::hex << InferenceEngine::computeDataHash(key.data(), key.size())
+         << ".weights";
+    return FileUtils::makePath(directory, name.str());
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsStore::load(const std::string& key, const MKLDNNMemoryDesc& desc,
+                                         const mkldnn::engine& engine) const {
+    auto mapping = InferenceEngine::details::mapFile(getPath(key));
+    if (!mapping)
+        return nullptr;
+
+    // the file name is a hash, so the full key is compared to exclude collisions
+    const char* data = mapping->data();
+    size_t offset = getDataOffset(key.size());
+    uint64_t keySize = 0, dataSize = 0;
+    if (mapping->size() < offset ||
+        std::memcmp(data, weightsStoreMagic, sizeof(weightsStoreMagic)) != 0)
+        return nullptr;
+    std::memcpy(&keySize, data + sizeof(weightsStoreMagic), sizeof(keySize));
+    std::memcpy(&dataSize, data + sizeof(weightsStoreMagic) + sizeof(keySize), sizeof(dataSize));
+    if (keySize != key.size() || key.compare(0, key.size(), data + sizeof(weightsStoreMagic) + 2 * sizeof(uint64_t), key.size()) != 0 ||
+        mapping->size() != offset + dataSize)
+        return nullptr;
+
+    // the memory keeps the mapping alive, stored pads are already zero
+    MKLDNNMemoryPtr memory(new MKLDNNMemory(engine), [mapping](MKLDNNMemory* memory) {
+        delete memory;
+    });
+    memory->Create(desc, mapping->data() + offset, false);
+    if (memory->GetSize() != dataSize)
+        return nullptr;
+    return memory;
+}
+
+void MKLDNNWeightsStore::store(const std::string& key, const MKLDNNMemory& memory) const {
+    if (memory.GetFormat() == mkldnn::memory::wino_fmt)
+        return;
+
+    auto path = getPath(key);
+    // the file is written under a unique name and renamed, so other processes never map a partial file
+    std::ostringstream tempPath;
+    tempPath << path << "." << std::hex << std::random_device{}() << ".tmp";
+    {
+        std::ofstream file(tempPath.str(), std::ios::binary);
+        if (!file.is_open())
+            return;
+        uint64_t keySize = key.size();
+        uint64_t dataSize = memory.GetSize();
+        std::vector<char> padding(getDataOffset(key.size()) - sizeof(weightsStoreMagic) - 2 * sizeof(uint64_t) - key.size(), 0);
+        file.write(weightsStoreMagic, sizeof(weightsStoreMagic));
+        file.write(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+        file.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+        file.write(key.data(), key.size());
+        file.write(padding.data(), padding.size());
+        file.write(static_cast<const char*>(memory.GetData()), dataSize);
+        if (!file.good()) {
+            file.close();
+            std::remove(tempPath.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tempPath.str().c_str(), path.c_str()) != 0)
+        std::remove(tempPath.str().c_str());
+}
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
@@ -21,30 +21,6 @@
 
 namespace MKLDNNPlugin {
 
-class SimpleDataHash {
-public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
-};
-
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
@@ -56,22 +32,65 @@ public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
+        std::shared_ptr<Entry> entry;
+        {
+            std::unique_lock<std::mutex> lock(guard);
+            auto& found = sharedWeights[name_hash];
+            if (!found)
+                found = std::make_shared<Entry>();
+            entry = found;
+        }
 
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
+        // only the creation of the same weights is serialized, different weights are reordered in parallel
+        std::unique_lock<std::mutex> lock(entry->guard);
+        MKLDNNMemoryPtr ptr = entry->memory.lock();
+        if (!ptr) {
             ptr = create();
-            sharedWeights[name_hash] = ptr;
+            entry->memory = ptr;
         }
         return ptr;
     }
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    struct Entry {
+        std::mutex guard;
+        std::weak_ptr<MKLDNNMemory> memory;
+    };
+
+    std::unordered_map<std::string, std::shared_ptr<Entry>> sharedWeights;
     std::mutex guard;
-    static const SimpleDataHash simpleCRC;
+};
+
+/**
+ * Directory of reordered weights shared by processes and executable networks
+ *
+ * A file is identified by the hash of the source weights, the target memory descriptor and
+ * the implementation (ISA) of the primitive, so it never becomes stale. Loaded weights are
+ * memory mapped, their pages are shared via page cache between all users.
+ *
+ * Is a thread safe
+ */
+class MKLDNNWeightsStore {
+public:
+    typedef std::shared_ptr<MKLDNNWeightsStore> Ptr;
+
+    explicit MKLDNNWeightsStore(const std::string& directory);
+
+    /**
+     * Maps the weights stored with the key
+     * @return the weights or nullptr if they are not stored
+     */
+    MKLDNNMemoryPtr load(const std::string& key, const MKLDNNMemoryDesc& desc, const mkldnn::engine& engine) const;
+
+    /**
+     * Stores the weights with the key, errors are ignored, so the weights are just reordered next time
+     */
+    void store(const std::string& key, const MKLDNNMemory& memory) const;
+
+private:
+    std::string getPath(const std::string& key) const;
+
+    std::string directory;
 };
 
 /**
@@ -12,7 +12,7 @@
 #include <utility>
 #include <functional>
 #include <ie_parallel.hpp>
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #include "nodes/common/uni_simd.h"
 #endif
@@ -26,7 +26,7 @@ using Shape = std::vector<size_t>;
 
 #if defined(HAVE_AVX512F)
     constexpr int count_vec = 32;
-#elif defined(HAVE_SSE) || defined(HAVE_AVX2)
+#elif defined(HAVE_SSE42) || defined(HAVE_AVX2)
     constexpr int count_vec = 16;
 #endif
 
@@ -59,14 +59,14 @@ void argmax_one_class_has_axis(const float* src_data, float* dst_data, Shape in_
     typedef __m256 vec_type_f;
     typedef __m256i vec_type_i;
     typedef __m256 vmask_type;
-#elif defined(HAVE_SSE)
+#elif defined(HAVE_SSE42)
     const int block_size = 4;
     typedef __m128 vec_type_f;
     typedef __m128i vec_type_i;
     typedef __m128 vmask_type;
 #endif
 
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
     parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
         int s_index = i0 * dim * after_num + ib1 * block_size;
         vec_type_f vmax_val = _mm_uni_loadu_ps(src_data + s_index);
@@ -158,14 +158,14 @@ void argmax_many_classes_has_axis(const float* src_data, float* dst_data, Shape
     typedef __m256 vec_type_f;
     typedef __m256i vec_type_i;
     typedef __m256 vmask_type;
-#elif defined(HAVE_SSE)
+#elif defined(HAVE_SSE42)
     const int block_size = 4;
     typedef __m128 vec_type_f;
     typedef __m128i vec_type_i;
     typedef __m128 vmask_type;
 #endif
 
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
     if (top_k_ < count_vec) {
         parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
 #if defined(HAVE_AVX512F)
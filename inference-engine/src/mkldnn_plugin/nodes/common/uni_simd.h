@@ -4,7 +4,7 @@
 
 #pragma once
 
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 
@@ -5,6 +5,7 @@
 #include "base.hpp"
 
 #include <cfloat>
+#include <cstdint>
 #include <vector>
 #include <cmath>
 #include <string>
@@ -135,6 +136,24 @@ public:
         int *indices_data          = _indices->buffer();
         int *num_priors_actual     = _num_priors_actual->buffer();
 
+        // Reorder the confidences to [N, classes, priors] and mark the priors having a confidence reaching the
+        // threshold for any class NMS may select (MXNet style skips the class 0). Only them can be selected by NMS,
+        // so the rest is not decoded.
+        const int first_class = _decrease_label_id ? 1 : 0;
+        const int skipped_class = _decrease_label_id ? -1 : _background_label_id;
+        _candidate_priors.resize(N*_num_priors);
+        parallel_for2d(N, _num_priors, [&](int n, int p) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + p*_num_classes;
+            float *preordered  = reordered_conf_data + n*_num_priors*_num_classes + p;
+
+            bool candidate = false;
+            for (int c = 0; c < _num_classes; ++c) {
+                preordered[c*_num_priors] = pconf[c];
+                candidate = candidate || (c >= first_class && c != skipped_class && pconf[c] >= _confidence_threshold);
+            }
+            _candidate_priors[n*_num_priors + p] = candidate;
+        });
+
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
             const float *prior_variances = prior_data + _num_priors*_prior_size;
@@ -147,7 +166,8 @@ public:
                 const float *ploc = loc_data + n*4*_num_priors;
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
+                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n,
+                             _candidate_priors.data() + n*_num_priors);
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
                     if (c == _background_label_id) {
@@ -157,50 +177,42 @@ public:
                     const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
                     float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
                     float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-                }
-            }
-        }
-
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n,
+                                 _candidate_priors.data() + n*_num_priors);
                 }
             }
         }
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        // The classes of all the images are processed independently, every pair has own part of the buffer
+        if (!_decrease_label_id) {
+            // Caffe style
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -208,7 +220,11 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
+
+        for (int n = 0; n < N; ++n) {
+            int detections_total = 0;
 
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
@@ -344,7 +360,8 @@ private:
     };
 
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n,
+                      const uint8_t *candidate_priors);
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
@@ -359,6 +376,8 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+
+    std::vector<uint8_t> _candidate_priors;
 };
 
 struct ConfidenceComparator {
@@ -416,7 +435,8 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                    float *decoded_bboxes,
                                    float *decoded_bbox_sizes,
                                    int* num_priors_actual,
-                                   int n) {
+                                   int n,
+                                   const uint8_t *candidate_priors) {
     num_priors_actual[n] = _num_priors;
     if (!_normalized) {
         int num = 0;
@@ -430,6 +450,9 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
     }
 
     parallel_for(num_priors_actual[n], [&](int p) {
+        if (!candidate_priors[p])
+            return;
+
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
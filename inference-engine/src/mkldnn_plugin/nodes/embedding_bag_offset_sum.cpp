@@ -5,6 +5,8 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 
@@ -157,9 +159,17 @@ protected:
                 weightsIdx = offsetsData[embIndex];
         };
 
+        // offsets give the sizes of the bags without calling get_idx, invalid offsets are reported by it
+        std::vector<size_t> bagsEnd(OUTPUT_BAGS_NUM);
+        for (size_t obi = 0lu; obi < OUTPUT_BAGS_NUM; obi++) {
+            size_t bagEnd = obi + 1lu < _offsetsLen ? static_cast<size_t>(offsetsData[obi + 1lu]) : _indicesLen;
+            bagEnd = std::min(bagEnd, _indicesLen) + obi + 1lu;
+            bagsEnd[obi] = obi == 0lu ? bagEnd : std::max(bagEnd, bagsEnd[obi - 1lu]);
+        }
+
         auto threadBody = [&](const int ithr, const int nthr) {
             size_t start(0lu), end(0lu);
-            splitter(OUTPUT_BAGS_NUM, nthr, ithr, start, end);
+            splitBags(bagsEnd, nthr, ithr, start, end);
             if (start >= end)
                 return;
 
@@ -169,51 +179,26 @@ protected:
             bool withWeights = _withWeights;
 
             for (size_t obi = start; obi < end; obi++) {
-                size_t dstIndex = obi * _embDepth;
+                T* dst = dstData + obi * _embDepth;
                 get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
                 if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
-                    size_t inIdx = 0lu;
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                        return;
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i];
-                        }
-                    }
-
-                    for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
+                    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
                         if (indices[inIdx] >= inDataDims[0]) {
                             errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                             return;
                         }
-                        size_t srcIndex = indices[inIdx] * _embDepth;
-
-                        if (withWeights) {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                            }
-                            weightsIdx++;
-                        } else {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i];
-                            }
-                        }
+
+                        const size_t prefetchIdx = inIdx + PREFETCH_ROWS;
+                        if (prefetchIdx < indicesSize && indices[prefetchIdx] < inDataDims[0])
+                            prefetchRow(srcData + indices[prefetchIdx] * _embDepth, _embDepth);
+
+                        accumulateRow(dst, srcData + indices[inIdx] * _embDepth,
+                                      withWeights ? weightsData + weightsIdx + inIdx : nullptr, _embDepth, inIdx == 0lu);
                     }
                 } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = 0;
-                    }
+                    std::fill_n(dst, _embDepth, static_cast<T>(0));
                 }
             }
         };
@@ -7,6 +7,7 @@
 #include "jit_generator.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <vector>
@@ -129,6 +130,25 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
     return OK;
 }
 
+void MKLDNNEmbeddingBagSum::splitBags(const std::vector<size_t>& bagsEnd, int nthr, int ithr, size_t& start, size_t& end) {
+    const size_t bagsNum = bagsEnd.size();
+    if (bagsNum == 0lu) {
+        start = end = 0lu;
+        return;
+    }
+
+    const size_t total = bagsEnd.back();
+    auto boundary = [&](int thr) {
+        if (thr >= nthr)
+            return bagsNum;
+        // the first bag not finished before the share of the previous threads
+        const size_t rows = total * thr / nthr;
+        return static_cast<size_t>(std::upper_bound(bagsEnd.begin(), bagsEnd.end(), rows) - bagsEnd.begin());
+    };
+    start = boundary(ithr);
+    end = boundary(ithr + 1);
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
@@ -146,62 +166,53 @@ void MKLDNNEmbeddingBagSum::processData(
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
+    struct Bag {
+        const size_t* indices;
+        size_t size;
+        size_t weightsIdx;
+        bool withWeights;
+    };
+
+    std::vector<Bag> bags(outputBagsNum);
+    std::vector<size_t> bagsEnd(outputBagsNum);
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+        auto& bag = bags[obi];
+        bag.indices = nullptr;
+        bag.size = 0lu;
+        bag.weightsIdx = 0lu;
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights & _withWeights;
+
+        // a bag costs at least the write of its output row
+        bagsEnd[obi] = (obi == 0lu ? 0lu : bagsEnd[obi - 1lu]) + std::max<size_t>(bag.indices != nullptr ? bag.size : 0lu, 1lu);
+    }
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitBags(bagsEnd, nthr, ithr, start, end);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const size_t* indices = nullptr;
-        size_t weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
+            T* dst = dstData + obi * _embDepth;
+            const auto& bag = bags[obi];
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
+            if (bag.indices != nullptr && bag.size != 0lu) {
+                for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                    if (bag.indices[inIdx] >= inDataDims[0])
                         THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+                            << "' has invalid embedding bag index: " << bag.indices[inIdx];
+
+                    const size_t prefetchIdx = inIdx + PREFETCH_ROWS;
+                    if (prefetchIdx < bag.size && bag.indices[prefetchIdx] < inDataDims[0])
+                        prefetchRow(srcData + bag.indices[prefetchIdx] * _embDepth, _embDepth);
+
+                    accumulateRow(dst, srcData + bag.indices[inIdx] * _embDepth,
+                                  bag.withWeights ? weightsData + bag.weightsIdx + inIdx : nullptr, _embDepth, inIdx == 0lu);
                 }
             } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+                std::fill_n(dst, _embDepth, static_cast<T>(0));
             }
         }
     };
@@ -6,10 +6,15 @@
 
 #include "base.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <vector>
 
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -41,6 +46,45 @@ protected:
     template<typename T>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    // The number of the next rows of a bag being prefetched while the current one is accumulated.
+    // The indices of recommendation models are random, so the rows of big tables are not in the cache.
+    static constexpr size_t PREFETCH_ROWS = 4lu;
+
+    template<typename T>
+    static void prefetchRow(const T* row, size_t depth) {
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        const char* ptr = reinterpret_cast<const char*>(row);
+        for (size_t offset = 0lu; offset < depth * sizeof(T); offset += 64lu)
+            _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#endif
+    }
+
+    // Plain loops over restricted pointers, so that the compiler vectorizes them for the target ISA
+    template<typename T>
+    static void accumulateRow(T* __restrict dst, const T* __restrict src, const T* weight, size_t depth, bool first) {
+        if (weight != nullptr) {
+            const T w = *weight;
+            if (first) {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] = src[i] * w;
+            } else {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] += src[i] * w;
+            }
+        } else {
+            if (first) {
+                std::copy_n(src, depth, dst);
+            } else {
+                for (size_t i = 0lu; i < depth; i++)
+                    dst[i] += src[i];
+            }
+        }
+    }
+
+    // Splits the bags between the threads so that every thread gets about the same number of rows to
+    // accumulate, bagsEnd[i] is the number of rows in the bags [0, i] and must not decrease
+    static void splitBags(const std::vector<size_t>& bagsEnd, int nthr, int ithr, size_t& start, size_t& end);
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -74,6 +74,18 @@ public:
             }
         }
 
+        // Find the first index and the size of every segment at once, getIndices is called for every segment
+        _segmentFirst.assign(_numSegments, 0lu);
+        _segmentSize.assign(_numSegments, 0lu);
+        for (size_t si = 0; si < _segmentIds.size(); si++) {
+            const size_t segment = _segmentIds[si];
+            if (segment >= _numSegments)
+                continue;
+            if (_segmentSize[segment] == 0lu)
+                _segmentFirst[segment] = si;
+            _segmentSize[segment]++;
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -95,14 +107,10 @@ public:
         size = 0lu;
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (_segmentSize[embIndex] != 0lu) {
+            size = _segmentSize[embIndex];
+            indices = _indices.data() + _segmentFirst[embIndex];
+            weightsIdx = _segmentFirst[embIndex];
         }
 
         // Empty bag
@@ -123,6 +131,8 @@ protected:
 
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
+    std::vector<size_t> _segmentFirst;
+    std::vector<size_t> _segmentSize;
     std::vector<size_t> _defaultIndices;
 };
 
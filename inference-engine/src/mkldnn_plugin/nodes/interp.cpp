@@ -158,8 +158,9 @@ public:
                 THROW_IE_EXCEPTION << "Interp supports only 4d blobs!";
 
             auto src_precision = inData->getTensorDesc().getPrecision();
-            if (src_precision != Precision::FP32 && src_precision != Precision::U8 && src_precision != Precision::BF16)
-                THROW_IE_EXCEPTION << layer->name << " Incorrect input data tensor precision. Only U8 or FP32 or BF16 are supported!";
+            if (src_precision != Precision::FP32 && src_precision != Precision::U8 && src_precision != Precision::I8 &&
+                src_precision != Precision::BF16)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect input data tensor precision. Only U8, I8, FP32 or BF16 are supported!";
 
             auto dst_precision = layer->outData[0]->getTensorDesc().getPrecision();
             if (dst_precision != Precision::FP32 && dst_precision != Precision::BF16)
@@ -171,10 +172,10 @@ public:
             align_corners = layer->GetParamAsBool("align_corners", true);
 
             ConfLayout blk_layout;
-            if (src_precision == Precision::U8) {
+            if (src_precision == Precision::U8 || src_precision == Precision::I8) {
                 LayerConfig config;
                 DataConfig dataConfigDct;
-                dataConfigDct.desc = TensorDesc(Precision::U8, inData->getTensorDesc().getDims(), Layout::NCHW);
+                dataConfigDct.desc = TensorDesc(src_precision, inData->getTensorDesc().getDims(), Layout::NCHW);
                 config.inConfs.push_back(dataConfigDct);
 
                 DataConfig dataConfigOut;
@@ -227,7 +228,7 @@ public:
         }
 
         auto inPrecision = config.inConfs[0].desc.getPrecision();
-        if (inPrecision != Precision::U8 && inPrecision != Precision::FP32)  {
+        if (inPrecision != Precision::U8 && inPrecision != Precision::I8 && inPrecision != Precision::FP32)  {
             strncpy(resp->msg, "Interp layer has unsupported input precision", sizeof(resp->msg));
             return GENERAL_ERROR;
         }
@@ -272,13 +273,21 @@ public:
         {
             const uint8_t* src_data = inputs[0]->cbuffer().as<const uint8_t *>() + inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
             size_t IC = inputs[0]->getTensorDesc().getDims()[1];
-            interpolate_8u(inputs[0]->getTensorDesc().getLayout(), IN, IC, src_data,
+            interpolate_8bit(inputs[0]->getTensorDesc().getLayout(), IN, IC, src_data,
+                -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
+        }
+        break;
+        case Precision::I8:
+        {
+            const int8_t* src_data = inputs[0]->cbuffer().as<const int8_t *>() + inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            size_t IC = inputs[0]->getTensorDesc().getDims()[1];
+            interpolate_8bit(inputs[0]->getTensorDesc().getLayout(), IN, IC, src_data,
                 -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
         }
         break;
         default:
             if (resp) {
-                std::string errorMsg = "Incorrect input precision. Only U8 or FP32 are supported!";
+                std::string errorMsg = "Incorrect input precision. Only U8, I8 or FP32 are supported!";
                 errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             }
             return GENERAL_ERROR;
@@ -383,8 +392,9 @@ private:
         });
     }
 
-    void interpolate_8u(Layout layout, const size_t N, const size_t C,
-        const uint8_t *src, const int x1, const int y1,
+    template <typename T>
+    void interpolate_8bit(Layout layout, const size_t N, const size_t C,
+        const T *src, const int x1, const int y1,
         const int IH_pad, const int IW_pad, const size_t IH, const size_t IW,
         float *dst, const int x2, const int y2,
         const int OH_pad, const int OW_pad, const size_t OH, const size_t OW) {
@@ -406,7 +416,7 @@ private:
         }
 
         parallel_for3d(N, C, OH_pad, [&](size_t n, size_t cb, size_t h) {
-            const uint8_t *psrc = src + n * C * IH * IW;
+            const T *psrc = src + n * C * IH * IW;
 
             float fh = rh * h;
             int ih0 = static_cast<int>(fh);
@@ -4,6 +4,13 @@
 
 #include "nodes/list.hpp"
 
+// a selective build registers only the extension layers of the selected types
+#ifdef SELECTIVE_BUILD
+# define MKLDNN_EXTENSION_NODES_TBL "list_tbl_selected.hpp"
+#else
+# define MKLDNN_EXTENSION_NODES_TBL "list_tbl.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -15,12 +22,12 @@ namespace Cpu {
     __prim ## __type(this)
 
 #define MKLDNN_EXTENSION_NODE(__prim, __type) FACTORY_DECLARATION(__prim, __type)
-# include "list_tbl.hpp"
+# include MKLDNN_EXTENSION_NODES_TBL
 #undef MKLDNN_EXTENSION_NODE
 
 MKLDNNExtensions::MKLDNNExtensions() {
     #define MKLDNN_EXTENSION_NODE(__prim, __type) FACTORY_CALL(__prim, __type)
-    # include "list_tbl.hpp"
+    # include MKLDNN_EXTENSION_NODES_TBL
     #undef MKLDNN_EXTENSION_NODE
 }
 
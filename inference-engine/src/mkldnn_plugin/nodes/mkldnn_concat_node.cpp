@@ -192,7 +192,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -200,6 +200,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::nhwc);
 
+            if (canInplaceChannelsLast(dstDims)) {
+                for (auto& inConf : config.inConfs)
+                    inConf.inPlace = 0;
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::nhwc);
+            }
+
             return;
         } else if (numOfDim == 5) {
             // Here we assume NDHWC layout (channels are the last)
@@ -226,7 +232,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[4], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NDHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -234,6 +240,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::ndhwc);
 
+            if (canInplaceChannelsLast(dstDims)) {
+                for (auto& inConf : config.inConfs)
+                    inConf.inPlace = 0;
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::ndhwc);
+            }
+
             return;
         }
     }
@@ -516,6 +528,17 @@ void MKLDNNConcatNode::createPrimitive() {
     prim.reset(new concat(primitive_desc, srcs_p, getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+bool MKLDNNConcatNode::canInplaceChannelsLast(const MKLDNNDims& dstDims) {
+    // In channels last layouts the inputs of a concat by channels are interleaved pixel by pixel unless the
+    // spatial size is 1. Then an input is a plain [N, C] view of the output with the batch stride of the output,
+    // which the producers support the same way as for the planar layouts.
+    for (int i = 2; i < dstDims.ndims(); i++) {
+        if (dstDims[i] != 1)
+            return false;
+    }
+    return true;
+}
+
 size_t MKLDNNConcatNode::inverseOrder(const SizeVector& order, size_t axis) {
     for (size_t i = 0; i < order.size(); i++) {
         if (axis == order[i]) {
@@ -593,12 +616,12 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
                                                              });
         size_t axisSize = 1;
 
-        if (config.inConfs[0].desc.getLayout() == Layout::NHWC) {
+        if (config.inConfs[0].desc.getLayout() == Layout::NHWC || config.inConfs[0].desc.getLayout() == Layout::NDHWC) {
             // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
             size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
             for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
+                // block dims are already permuted according to the order
+                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
             }
         } else {
             // This works for nchw and nchw8c/nchw16c
@@ -30,6 +30,7 @@ private:
     size_t axis = 0;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    bool canInplaceChannelsLast(const MKLDNNDims& dstDims);
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
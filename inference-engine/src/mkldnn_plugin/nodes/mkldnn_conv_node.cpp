@@ -18,6 +18,11 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <ie_layers_internal.hpp>
+#include "ie_parallel.hpp"
+#include <ie_data_hash.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -643,10 +648,28 @@ void MKLDNNConvolutionNode::createPrimitive() {
     setPostOps(attr, true);
     addScaleToPrimitiveAttr(attr);
 
+    // fused depthwise and quantization post ops and the fused convolution point to the data of the node
+    const bool cacheable = primitivesCache && PostOpsIntBlobMemory.empty() && !withDWConv && baseInputsNumber == 1;
+    if (cacheable) {
+        std::vector<mkldnn::memory> memories = {getParentEdgeAt(0)->getMemory().GetPrimitive(), getWeights()};
+        if (withBiases)
+            memories.push_back(getBias());
+        memories.push_back(getChildEdgeAt(0)->getMemory().GetPrimitive());
+        if (takeCachedPrimitive(memories))
+            return;
+    }
+
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    if (withBiases) {
+    if (cacheable) {
+        auto& memories = cachedPrimitive.memories;
+        if (withBiases) {
+            setCachedPrimitive(new convolution_forward(prim_desc, memories[0], memories[1], memories[2], memories[3]));
+        } else {
+            setCachedPrimitive(new convolution_forward(prim_desc, memories[0], memories[1], memories[2]));
+        }
+    } else if (withBiases) {
         prim.reset(new convolution_forward(prim_desc,
                                            getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                            getWeights(),
@@ -747,8 +770,51 @@ void MKLDNNConvolutionNode::addZeroPoints(mkldnn::primitive_attr& attr) const {
     if (!weightsZeroPoints.empty())
         attr.set_weights_zero_points(1 << 1 /*through C dim*/, weightsZeroPoints);
 
-    if (!outputCompensation.empty())
-        attr.set_output_compensations(1 << 1 /*through C dim*/, outputCompensation);
+    if (outputCompensation) {
+        auto compensationData = static_cast<const int32_t *>(outputCompensation->GetData());
+        attr.set_output_compensations(1 << 1 /*through C dim*/,
+                                      std::vector<int32_t>(compensationData, compensationData + outputCompensation->GetElementsCount()));
+    }
+}
+
+void MKLDNNConvolutionNode::initOutputCompensation(const int8_t *weights, size_t G, size_t OC, size_t IC, size_t KSize) {
+    auto create = [&] () {
+        MKLDNNMemoryPtr compensation(new MKLDNNMemory(getEngine()));
+        compensation->Create(MKLDNNDims({static_cast<ptrdiff_t>(G * OC)}), memory::data_type::s32, memory::format::x);
+        auto compensationData = static_cast<int32_t *>(compensation->GetData());
+
+        parallel_for2d(G, OC, [&](size_t g, size_t oc) {
+            auto wzp = !weightsZeroPoints.empty()
+                       ? static_cast<int32_t>(weightsZeroPoints[weightsZeroPoints.size() == 1 ? 0 : g * OC + oc]) : 0;
+
+            int32_t a = 0;
+            for (size_t ic = 0; ic < IC; ic++) {
+                auto izp = static_cast<int32_t>(inputZeroPoints[inputZeroPoints.size() == 1 ? 0 : g * IC + ic]);
+
+                const int8_t *w = weights + ((g * OC + oc) * IC + ic) * KSize;
+                int32_t wsum = 0;
+                for (size_t k = 0; k < KSize; k++)
+                    wsum += static_cast<int32_t>(w[k]);
+
+                a += izp * (wsum - wzp * static_cast<int32_t>(KSize));
+            }
+            compensationData[g * OC + oc] = -a;
+        });
+
+        return compensation;
+    };
+
+    if (weightCache != nullptr) {
+        const size_t weightsSize = G * OC * IC * KSize;
+        const uint64_t data_hash = InferenceEngine::computeDataHash(weights, weightsSize);
+        const std::string string_hash = getName() + "_output_compensation"
+                                        + "_" + std::to_string(weightsSize)
+                                        + "_" + std::to_string(data_hash);
+
+        outputCompensation = weightCache->findOrCreate(string_hash, create);
+    } else {
+        outputCompensation = create();
+    }
 }
 
 void MKLDNNConvolutionNode::addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const {
@@ -878,6 +944,109 @@ void MKLDNNConvolutionNode::initDescriptor(const InferenceEngine::LayerConfig& c
     selectedPD->getConfig() = rightConfig;
 }
 
+void MKLDNNConvolutionNode::selectOptimalPrimitiveDescriptor() {
+    MKLDNNNode::selectOptimalPrimitiveDescriptor();
+    if (!implTuner || !canBeTuned())
+        return;
+
+    // the candidates take the input in the layout of the preferred implementation, so the reorders of the graph
+    // do not change, e.g. the winograd and the direct implementations of the blocked layout
+    const auto preferred = selectedPrimitiveDescriptorIndex;
+    const auto& preferredInput = supportedPrimitiveDescriptors[preferred].getConfig().inConfs[0].desc;
+    std::vector<size_t> candidates = {static_cast<size_t>(preferred)};
+    std::vector<impl_desc_type> implementations = {supportedPrimitiveDescriptors[preferred].getImplementationType()};
+    for (size_t i = 0; i < supportedPrimitiveDescriptors.size() && candidates.size() < implTuner->getCandidates(); i++) {
+        const auto& supported = supportedPrimitiveDescriptors[i];
+        if (std::find(implementations.begin(), implementations.end(), supported.getImplementationType()) != implementations.end() ||
+            supported.getConfig().inConfs.empty() ||
+            !MKLDNNExtensionUtils::initTensorsAreEqual(supported.getConfig().inConfs[0].desc, preferredInput))
+            continue;
+        candidates.push_back(i);
+        implementations.push_back(supported.getImplementationType());
+    }
+    if (candidates.size() < 2)
+        return;
+
+    // the batch is a part of the shapes, so the choice for batch 1 may differ from the one for the large batches
+    std::string shapes = preferredInput.getPrecision().name();
+    for (auto dim : getParentEdgeAt(0)->getDims().ToSizeVector())
+        shapes += "_" + std::to_string(dim);
+
+    auto selected = implTuner->select(getName(), shapes, implementations, [&](size_t candidate) {
+        return measureImplementation(candidates[candidate]);
+    });
+    selectPrimitiveDescriptorByIndex(static_cast<int>(candidates[selected]));
+}
+
+bool MKLDNNConvolutionNode::canBeTuned() const {
+    // the fused depthwise and quantization post ops and the fused convolution need the data of the node
+    if (baseInputsNumber != 1 || withDWConv || selectedPrimitiveDescriptorIndex < 0)
+        return false;
+    if (getCnnLayer()->params.find("PrimitivesPriority") != getCnnLayer()->params.end())
+        return false;
+    for (auto& node : fusedWith) {
+        if (node->getType() == Depthwise || node->getType() == Quantize || node->getType() == Convolution)
+            return false;
+    }
+    return true;
+}
+
+double MKLDNNConvolutionNode::measureImplementation(size_t index) {
+    mkldnn::primitive_attr attr;
+    addZeroPoints(attr);
+    setPostOps(attr);
+    addScaleToPrimitiveAttr(attr);
+
+    // the descriptors are enumerated in the order of initSupportedPrimitiveDescriptors, none is skipped when tuning
+    size_t count = 0;
+    for (auto& desc : descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
+        for (; itpd.is_not_end(); itpd++, count++) {
+            if (count != index)
+                continue;
+            if (parse_impl_name(itpd.get_impl_info_str()) != supportedPrimitiveDescriptors[index].getImplementationType())
+                return -1;
+
+            try {
+                std::shared_ptr<convolution_forward::desc> convDesc = desc;
+                convolution_forward::primitive_desc prim_desc(*convDesc, getEngine());
+                itpd.getPrimitiveDescriptor(prim_desc);
+
+                auto zeroMemory = [](const memory::primitive_desc& pd) {
+                    memory mem(pd);
+                    std::memset(mem.get_data_handle(), 0, mem.get_primitive_desc().get_size());
+                    return mem;
+                };
+                auto src = zeroMemory(prim_desc.src_primitive_desc());
+                auto weights = zeroMemory(prim_desc.weights_primitive_desc());
+                auto dst = zeroMemory(prim_desc.dst_primitive_desc());
+                std::shared_ptr<convolution_forward> conv;
+                if (withBiases) {
+                    auto bias = zeroMemory(prim_desc.bias_primitive_desc());
+                    conv.reset(new convolution_forward(prim_desc, src, weights, bias, dst));
+                } else {
+                    conv.reset(new convolution_forward(prim_desc, src, weights, dst));
+                }
+
+                // the first execution warms the caches up, the fastest of the others is the least disturbed one
+                const int runs = 3;
+                double best = -1;
+                for (int run = 0; run <= runs; run++) {
+                    auto start = std::chrono::steady_clock::now();
+                    mkldnn::stream(stream::kind::eager).submit({*conv}).wait();
+                    double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                    if (run > 0 && (best < 0 || time < best))
+                        best = time;
+                }
+                return best;
+            } catch (const mkldnn::error&) {
+                return -1;
+            }
+        }
+    }
+    return -1;
+}
+
 void MKLDNNConvolutionNode::filterSupportedPrimitiveDescriptors() {
     MKLDNNNode::filterSupportedPrimitiveDescriptors();
     // We also need to filter descs in Convolution node
@@ -921,6 +1090,10 @@ bool MKLDNNConvolutionNode::isPossibleToSkipInitConfig(MKLDNNDescriptor &desc) {
     if (getCnnLayer()->params.find("PrimitivesPriority") != getCnnLayer()->params.end())
         return false;
 
+    //  The GEMM implementations are candidates of the tuning
+    if (implTuner)
+        return false;
+
     //  Here we check that we will not delete jit_planar_conv primitive by mistake.
     //  It requires:
     //      1) strides equal 1;
@@ -26,6 +26,7 @@ public:
     void createPrimitive() override;
     void initSupportedPrimitiveDescriptors() override;
     void filterSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void filterSupportedDescriptors();
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc);
     bool created() const override;
@@ -51,7 +52,12 @@ public:
 
     std::vector<uint8_t> inputZeroPoints;
     std::vector<float> weightsZeroPoints;
-    std::vector<int32_t> outputCompensation;
+
+    /**
+     * @brief Computes the output compensation of the input zero points for the int8 weights in [G, OC, IC, KSize] layout.
+     * The compensation is shared through the weights cache by all the graphs (streams) of the network.
+     */
+    void initOutputCompensation(const int8_t *weights, size_t G, size_t OC, size_t IC, size_t KSize);
 
 protected:
     void addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const;
@@ -60,6 +66,14 @@ protected:
 private:
     mkldnn::memory::data_type precisionToDataType(InferenceEngine::Precision prec);
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
+    bool canBeTuned() const;
+    /**
+     * @brief Returns the time in microseconds of an execution of the supported primitive descriptor on zero data,
+     * a negative one if its primitive cannot be created
+     */
+    double measureImplementation(size_t index);
+
+    MKLDNNMemoryPtr outputCompensation;
 
     bool withBiases;
     bool withSum;
@@ -14,6 +14,7 @@
 #include "ie_parallel.hpp"
 #include "mkldnn_quantize_node.h"
 #include "mkldnn_activation_node.h"
+#include "mkldnn_power_node.h"
 #include <map>
 #include "jit_uni_eltwise.hpp"
 #include "jit_uni_quantization.hpp"
@@ -213,6 +214,7 @@ private:
     Reg64 reg_params = abi_param1;
 
     Reg8 reg_tmp_8 = r12b;
+    Reg16 reg_tmp_16 = r12w;
     Reg32 reg_tmp_32 = r12d;
     Reg64 reg_tmp_64 = r12;
 
@@ -231,6 +233,11 @@ private:
 
     Vmm vmm_zero = Vmm(5);
 
+    Vmm vmm_aux0 = Vmm(6);
+    Vmm vmm_aux1 = Vmm(7);
+    Xmm xmm_aux0 = Xmm(6);
+    Xmm xmm_aux1 = Xmm(7);
+
     std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
     std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
 
@@ -246,11 +253,16 @@ private:
             case memory::u8:
                 uni_vpmovzxbd(vmm_src, op);
                 break;
+            case memory::bf16:
+                assert(isa == avx512_common);
+                vpmovzxwd(vmm_src, op);
+                vpslld(vmm_src, vmm_src, 16);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
 
-        if (src_dt != data_type::f32) {
+        if (src_dt != data_type::f32 && src_dt != data_type::bf16) {
             uni_vcvtdq2ps(vmm_src, vmm_src);
         }
     }
@@ -269,11 +281,15 @@ private:
                 movzx(reg_tmp_32, op);
                 movq(xmm_src, reg_tmp_64);
                 break;
+            case memory::bf16:
+                pinsrw(xmm_src, op, 0x0);
+                pslld(xmm_src, 16);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
 
-        if (src_dt != data_type::f32) {
+        if (src_dt != data_type::f32 && src_dt != data_type::bf16) {
             uni_vcvtdq2ps(xmm_src, xmm_src);
         }
     }
@@ -282,7 +298,7 @@ private:
         Xmm xmm_dst = Xmm(vmm_dst.getIdx());
         Ymm ymm_dst = Ymm(vmm_dst.getIdx());
 
-        if (dst_dt != data_type::f32) {
+        if (dst_dt != data_type::f32 && dst_dt != data_type::bf16) {
             uni_vcvtps2dq(vmm_dst, vmm_dst);
         }
 
@@ -320,13 +336,28 @@ private:
                         movd(op, xmm_dst);
                 }
                 break;
+            case memory::bf16:
+                // Rounds to nearest even by adding 0x7fff plus the lowest bit of the result to the float bits,
+                // bfloat16 values are the upper halves of the sums
+                assert(isa == avx512_common);
+                vpsrld(vmm_aux0, vmm_dst, 16);
+                mov(reg_tmp_32, 0x1);
+                vpbroadcastd(vmm_aux1, reg_tmp_32);
+                vpandd(vmm_aux0, vmm_aux0, vmm_aux1);
+                mov(reg_tmp_32, 0x7fff);
+                vpbroadcastd(vmm_aux1, reg_tmp_32);
+                vpaddd(vmm_aux0, vmm_aux0, vmm_aux1);
+                vpaddd(vmm_dst, vmm_dst, vmm_aux0);
+                vpsrld(vmm_dst, vmm_dst, 16);
+                vpmovdw(op, vmm_dst);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
     }
 
     inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, memory::data_type dst_dt) {
-        if (dst_dt != data_type::f32) {
+        if (dst_dt != data_type::f32 && dst_dt != data_type::bf16) {
             uni_vcvtps2dq(xmm_dst, xmm_dst);
         }
 
@@ -347,6 +378,20 @@ private:
                 movq(reg_tmp_64, xmm_dst);
                 mov(op, reg_tmp_8);
                 break;
+            case memory::bf16:
+                movups(xmm_aux0, xmm_dst);
+                psrld(xmm_aux0, 16);
+                mov(reg_tmp_32, 0x1);
+                movd(xmm_aux1, reg_tmp_32);
+                pand(xmm_aux0, xmm_aux1);
+                mov(reg_tmp_32, 0x7fff);
+                movd(xmm_aux1, reg_tmp_32);
+                paddd(xmm_aux0, xmm_aux1);
+                paddd(xmm_dst, xmm_aux0);
+                psrld(xmm_dst, 16);
+                movd(reg_tmp_32, xmm_dst);
+                mov(op, reg_tmp_16);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
@@ -381,6 +426,14 @@ bool MKLDNNEltwiseNode::isUnitScales() {
     return true;
 }
 
+bool MKLDNNEltwiseNode::isFusedWithScalarOpsOnly() const {
+    for (auto &node : fusedWith) {
+        if (node->getType() != Activation && node->getType() != Power)
+            return false;
+    }
+    return true;
+}
+
 bool MKLDNNEltwiseNode::isWithBroadcast() {
     bool withBroadcast = false;
     auto oDims = outDims[0].ToSizeVector();
@@ -491,7 +544,13 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         return {config, impl_type, format};
     };
 
-    if (fusedWith.empty()) {
+    // BF16 is loaded and stored by the JIT kernel itself, otherwise the tensors are converted to FP32 around the node
+    bool withBF16 = mayiuse(avx512_core);
+    bool isBF16Sum = withBF16 && fusedWith.empty() && (op == EltwiseLayer::Sum || op == EltwiseLayer::Prod) &&
+                     getParentEdges().size() == 2 && !broadcast && isUnitScales() &&
+                     getCnnLayer()->outData[0]->getPrecision() == Precision::BF16;
+
+    if (fusedWith.empty() && !isBF16Sum) {
         for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
             // Precision of implementation is defined by precision of output tensor
             auto prec = getCnnLayer()->outData[0]->getPrecision();
@@ -522,6 +581,57 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
                 supportedPrimitiveDescriptors.push_back(impl_desc);
             }
         }
+    } else if (!broadcast && isFusedWithScalarOpsOnly()) {
+        // Fused operations do not depend on the channel, so the kernel walks the tensors as flat arrays
+        // and any dense layout of the inputs can be taken as is
+        flat = true;
+
+        auto outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->outData[0]->getPrecision());
+        if (!fusedWith.empty()) {
+            auto lastFusedLayer = fusedWith[fusedWith.size() - 1].get()->getCnnLayer();
+            outputDT = lastFusedLayer ? MKLDNNExtensionUtils::IEPrecisionToDataType(lastFusedLayer->outData[0]->getPrecision()) : memory::f32;
+        }
+        if (outputDT == memory::bf16 && !withBF16)
+            outputDT = memory::f32;
+
+        for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
+            InferenceEngine::LayerConfig config;
+            config.dynBatchSupport = true;
+            bool isDense = true;
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                InferenceEngine::DataConfig dataConfig;
+                dataConfig.inPlace = -1;
+                dataConfig.constant = false;
+                // All the inputs are taken in the precision of the first one, see initOptimalPrimitiveDescriptor
+                auto inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(
+                        getCnnLayer()->insData[0].lock()->getPrecision());
+                if (inputDT == memory::bf16 && !withBF16)
+                    inputDT = memory::f32;
+                MKLDNNMemoryDesc desc(getParentEdgeAt(i)->getDims(), inputDT, format);
+                isDense = isDense && !desc.blocksExtended();
+                dataConfig.desc = desc;
+                config.inConfs.push_back(dataConfig);
+            }
+
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            MKLDNNMemoryDesc desc(getChildEdgeAt(0)->getDims(), outputDT, format);
+            isDense = isDense && !desc.blocksExtended();
+            dataConfig.desc = desc;
+            config.outConfs.push_back(dataConfig);
+
+            // Padded channels would be processed as data
+            if (!isDense)
+                continue;
+
+            supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref, format});
+        }
+
+        if (supportedPrimitiveDescriptors.empty())
+            THROW_IE_EXCEPTION << "Cannot find a dense layout for Eltwise node " << getName();
+
+        initJitKernel(supportedPrimitiveDescriptors[0].getConfig());
     } else {
         auto ndims = getCnnLayer()->outData[0]->getDims().size();
         auto format = ndims == 2 ? memory::format::nc :
@@ -555,24 +665,29 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 
         supportedPrimitiveDescriptors.push_back({config, impl_type, format});
 
-        jep.src0_step = config.inConfs[0].desc.getDims()[1] == 1 ? 0 : 1;
-        jep.src1_step = config.inConfs[1].desc.getDims()[1] == 1 ? 0 : 1;
-        jep.dst_step = 1;
-        jep.src0_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[0].desc.getPrecision());
-        jep.src1_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[1].desc.getPrecision());
-        jep.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.outConfs[0].desc.getPrecision());
-        jep.src0_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src0_dt);
-        jep.src1_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src1_dt);
-        jep.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.dst_dt);
-        jep.eltwise_op = op;
-
-        if (mayiuse(cpu::avx512_common)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx512_common>(jep, *attr.get()));
-        } else if (mayiuse(cpu::avx2)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx2>(jep, *attr.get()));
-        } else if (mayiuse(cpu::sse42)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::sse42>(jep, *attr.get()));
-        }
+        initJitKernel(config);
+    }
+}
+
+void MKLDNNEltwiseNode::initJitKernel(const InferenceEngine::LayerConfig &config) {
+    // The data types of the inputs and of the output are the same for all the layouts the node offers
+    jep.src0_step = !flat && config.inConfs[0].desc.getDims()[1] == 1 ? 0 : 1;
+    jep.src1_step = !flat && config.inConfs[1].desc.getDims()[1] == 1 ? 0 : 1;
+    jep.dst_step = 1;
+    jep.src0_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[0].desc.getPrecision());
+    jep.src1_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.inConfs[1].desc.getPrecision());
+    jep.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(config.outConfs[0].desc.getPrecision());
+    jep.src0_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src0_dt);
+    jep.src1_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.src1_dt);
+    jep.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jep.dst_dt);
+    jep.eltwise_op = op;
+
+    if (mayiuse(cpu::avx512_common)) {
+        eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx512_common>(jep, *attr.get()));
+    } else if (mayiuse(cpu::avx2)) {
+        eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx2>(jep, *attr.get()));
+    } else if (mayiuse(cpu::sse42)) {
+        eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::sse42>(jep, *attr.get()));
     }
 }
 
@@ -600,7 +715,7 @@ void MKLDNNEltwiseNode::createPrimitive() {
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
         }
     }
-    if (op == EltwiseLayer::Sum && !broadcast && fusedWith.empty()) {
+    if (op == EltwiseLayer::Sum && !broadcast && fusedWith.empty() && !flat) {
         try {
             auto primitive_desc = mkldnn::sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
             prim = std::shared_ptr<mkldnn::sum>(new mkldnn::sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
@@ -645,6 +760,21 @@ void MKLDNNEltwiseNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeight
             continue;
         }
 
+        auto* powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+        if (powerNode) {
+            // (scale * x + shift) ^ power, only the powers the eltwise injector has a primitive for are fused
+            if (powerNode->getScale() != 1.0f || powerNode->getShift() != 0.0f)
+                ops.append_eltwise(1.0, eltwise_linear, powerNode->getScale(), powerNode->getShift());
+            if (powerNode->getPower() == 2.0f)
+                ops.append_eltwise(1.0, eltwise_square, 0.0f, 0.0f);
+            else if (powerNode->getPower() == 0.5f)
+                ops.append_eltwise(1.0, eltwise_sqrt, 0.0f, 0.0f);
+            else if (powerNode->getPower() != 1.0f)
+                THROW_IE_EXCEPTION << "Fusing of Power operation with power " << powerNode->getPower() << " to Eltwise node is not implemented";
+
+            continue;
+        }
+
         auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
         if (quantizeNode) {
             quantizeNode->appendPostOps(ops);
@@ -2537,7 +2667,25 @@ void MKLDNNEltwiseNode::jit_eltwise_fq() {
         dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding *
         MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dstMemory.GetDescriptor().data.data_type));
 
-    if (!broadcast) {
+    if (flat) {
+        auto& dims = getChildEdgeAt(0)->getDims();
+        size_t work_amount = static_cast<size_t>(dims.size() / dims[0] * batchToProcess());
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            auto arg = jit_eltwise_fq_call_args();
+            arg.src0 = src0_ptr + start * jep.src0_data_size;
+            arg.src1 = src1_ptr + start * jep.src1_data_size;
+            arg.dst = dst_ptr + start * jep.dst_data_size;
+            arg.work_amount = end - start;
+
+            (*eltiwse_fq_kernel)(&arg);
+        });
+    } else if (!broadcast) {
         auto& dims = getParentEdgeAt(0)->getDims();
 
         int N = batchToProcess();
@@ -2627,7 +2775,7 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
 
         IE_ASSERT(getParentEdges().size() > 1);
 
-        if (!fusedWith.empty()) {
+        if (eltiwse_fq_kernel) {
             jit_eltwise_fq();
         } else {
             // Input and output types for eltwise compare operations can be different
@@ -64,12 +64,14 @@ public:
     bool isSum();
     bool isUnitScales();
     bool isWithBroadcast();
+    bool isFusedWithScalarOpsOnly() const;
     void initOptimalPrimitiveDescriptor() override;
 
 private:
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
     bool broadcast = false;
+    bool flat = false;
     int batch_dim = 5;
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     mkldnn::primitive_attr attr;
@@ -77,6 +79,7 @@ private:
     std::shared_ptr<jit_uni_eltwise_fq_kernel> eltiwse_fq_kernel;
     jit_eltwise_fq_params jep;
 
+    void initJitKernel(const InferenceEngine::LayerConfig &config);
     void jit_eltwise_fq();
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
@@ -7,9 +7,15 @@
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
+#include "utils/numa_utils.h"
+#include "ie_parallel.hpp"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
+#include <utility>
+#include <numeric>
+#include <functional>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 
@@ -157,6 +163,11 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         }
     }
 
+    // Compressed, sparse and NUMA split weights are not supported by the inner product primitive,
+    // see executeCompressed, executeSparse and executeNumaSplit
+    if (isWithCustomExecution())
+        return;
+
     for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::any);
@@ -165,8 +176,58 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!isWithCustomExecution()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        auto dims = getParentEdgeAt(i)->getDims();
+        auto dataType = i == 1 && isWithCompressedWeights() ? memory::u8 : memory::f32;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        config.inConfs.push_back(dataConfig);
+    }
+
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
+    auto dims = getChildEdgeAt(0)->getDims();
+    dataConfig.desc = MKLDNNMemoryDesc(dims, memory::f32, MKLDNNMemory::GetPlainFormat(dims));
+    config.outConfs.push_back(dataConfig);
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref, MKLDNNMemory::GetPlainFormat(dims)});
+}
+
+void MKLDNNFullyConnectedNode::initOptimalPrimitiveDescriptor() {
+    if (isWithCustomExecution())
+        return;
+    MKLDNNNode::initOptimalPrimitiveDescriptor();
+}
+
+void MKLDNNFullyConnectedNode::setCompressedWeights(std::vector<float> scales, std::vector<float> shifts, int levels) {
+    if (levels < 2 || levels > 256 || scales.empty() || shifts.empty())
+        THROW_IE_EXCEPTION << "Incorrect parameters of compressed weights for node " << getName();
+    compressedWeightsScales = std::move(scales);
+    compressedWeightsShifts = std::move(shifts);
+    compressedWeightsLevels = levels;
+}
+
+void MKLDNNFullyConnectedNode::setNumaSplitWeights(std::vector<int> numaNodes) {
+    if (numaNodes.size() < 2)
+        THROW_IE_EXCEPTION << "Weights of node " << getName() << " can be split only between several NUMA nodes";
+    numaSplitNodes = std::move(numaNodes);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || isWithCustomExecution())
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -442,4 +503,296 @@ const mkldnn::memory& MKLDNNFullyConnectedNode::getBias() const {
     return baseInputsNumber > 2 ? getParentEdgeAt(2)->getMemory().GetPrimitive() : internalBlobMemory[1]->GetPrimitive();
 }
 
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (isWithCompressedWeights()) {
+        executeCompressed();
+    } else if (isWithSparseWeights()) {
+        executeSparse();
+    } else if (isWithNumaSplitWeights()) {
+        executeNumaSplit();
+    } else {
+        MKLDNNNode::execute(strm);
+    }
+}
+
+namespace {
+
+// Independent partial sums make the loops below vectorizable without reassociation flags
+const size_t dotLanes = 16;
+
+inline float dotU8(const float *x, const uint8_t *q, size_t size) {
+    float acc[dotLanes] = {};
+    size_t i = 0;
+    for (; i + dotLanes <= size; i += dotLanes) {
+        for (size_t l = 0; l < dotLanes; l++)
+            acc[l] += x[i + l] * static_cast<float>(q[i + l]);
+    }
+    float sum = 0.f;
+    for (size_t l = 0; l < dotLanes; l++)
+        sum += acc[l];
+    for (; i < size; i++)
+        sum += x[i] * static_cast<float>(q[i]);
+    return sum;
+}
+
+inline float dotF32(const float *x, const float *w, size_t size) {
+    float acc[dotLanes] = {};
+    size_t i = 0;
+    for (; i + dotLanes <= size; i += dotLanes) {
+        for (size_t l = 0; l < dotLanes; l++)
+            acc[l] += x[i + l] * w[i + l];
+    }
+    float sum = 0.f;
+    for (size_t l = 0; l < dotLanes; l++)
+        sum += acc[l];
+    for (; i < size; i++)
+        sum += x[i] * w[i];
+    return sum;
+}
+
+inline float dotU4(const float *x, const uint8_t *q, size_t size) {
+    float acc[dotLanes] = {};
+    size_t i = 0;
+    for (; i + dotLanes <= size; i += dotLanes) {
+        const uint8_t *p = q + i / 2;
+        for (size_t l = 0; l < dotLanes / 2; l++) {
+            acc[2 * l] += x[i + 2 * l] * static_cast<float>(p[l] & 0x0F);
+            acc[2 * l + 1] += x[i + 2 * l + 1] * static_cast<float>(p[l] >> 4);
+        }
+    }
+    float sum = 0.f;
+    for (size_t l = 0; l < dotLanes; l++)
+        sum += acc[l];
+    for (; i < size; i++)
+        sum += x[i] * static_cast<float>((q[i / 2] >> ((i % 2) * 4)) & 0x0F);
+    return sum;
+}
+
+}  // namespace
+
+void MKLDNNFullyConnectedNode::packCompressedWeights() {
+    auto &wMem = getParentEdgeAt(1)->getMemory();
+    const auto *codes = reinterpret_cast<const uint8_t *>(wMem.GetData()) +
+                        wMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t stride = div_up(IC, 2);
+
+    packedWeights.assign(OC * stride, 0);
+    parallel_for(OC, [&](size_t oc) {
+        for (size_t ic = 0; ic < IC; ic++)
+            packedWeights[oc * stride + ic / 2] |= static_cast<uint8_t>(codes[oc * IC + ic] << ((ic % 2) * 4));
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    // The weights are constant, so packing them once at the first inference is enough
+    const bool packed = compressedWeightsLevels <= 16;
+    if (packed && packedWeights.empty())
+        packCompressedWeights();
+
+    auto &srcMem = getParentEdgeAt(0)->getMemory();
+    auto &wMem = getParentEdgeAt(1)->getMemory();
+    auto &dstMem = getChildEdgeAt(0)->getMemory();
+
+    const auto *src = reinterpret_cast<const float *>(srcMem.GetData()) +
+                      srcMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const auto *codes = packed ? packedWeights.data() :
+                        reinterpret_cast<const uint8_t *>(wMem.GetData()) + wMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const float *bias = nullptr;
+    if (baseInputsNumber > 2) {
+        auto &biasMem = getParentEdgeAt(2)->getMemory();
+        bias = reinterpret_cast<const float *>(biasMem.GetData()) + biasMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    }
+    auto *dst = reinterpret_cast<float *>(dstMem.GetData()) + dstMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t MB = srcMem.GetElementsCount() / IC;
+    const size_t stride = packed ? div_up(IC, 2) : IC;
+
+    // w = q * scale + shift gives y = scale * dot(x, q) + shift * sum(x) + bias
+    std::vector<float> srcSums(MB);
+    for (size_t mb = 0; mb < MB; mb++) {
+        float sum = 0.f;
+        for (size_t ic = 0; ic < IC; ic++)
+            sum += src[mb * IC + ic];
+        srcSums[mb] = sum;
+    }
+
+    const bool perChannelScales = compressedWeightsScales.size() > 1;
+    const bool perChannelShifts = compressedWeightsShifts.size() > 1;
+    // Every thread streams its own rows of weights, they stay in cache for the whole batch
+    parallel_for(OC, [&](size_t oc) {
+        const uint8_t *w = codes + oc * stride;
+        const float scale = compressedWeightsScales[perChannelScales ? oc : 0];
+        const float shift = compressedWeightsShifts[perChannelShifts ? oc : 0];
+        const float b = bias ? bias[oc] : 0.f;
+        for (size_t mb = 0; mb < MB; mb++) {
+            const float dp = packed ? dotU4(src + mb * IC, w, IC) : dotU8(src + mb * IC, w, IC);
+            dst[mb * OC + oc] = scale * dp + shift * srcSums[mb] + b;
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::getFP32WeightsAndBiases(const float *&weights, const float *&biases) {
+    weights = nullptr;
+    biases = nullptr;
+    if (baseInputsNumber > 1) {
+        auto &wMem = getParentEdgeAt(1)->getMemory();
+        weights = reinterpret_cast<const float *>(wMem.GetData()) + wMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        if (baseInputsNumber > 2) {
+            auto &bMem = getParentEdgeAt(2)->getMemory();
+            biases = reinterpret_cast<const float *>(bMem.GetData()) + bMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        }
+    } else {
+        weights = internalBlobs[0]->cbuffer().as<const float *>();
+        if (withBiases)
+            biases = internalBlobs[1]->cbuffer().as<const float *>();
+    }
+}
+
+void MKLDNNFullyConnectedNode::initSparseWeights() {
+    const float *weights = nullptr;
+    const float *biases = nullptr;
+    getFP32WeightsAndBiases(weights, biases);
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+
+    sparseRowOffsets.assign(OC + 1, 0);
+    sparseValues.clear();
+    sparseColumns.clear();
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            float w = weights[oc * IC + ic];
+            if (w == 0.f)
+                continue;
+            sparseValues.push_back(w);
+            sparseColumns.push_back(static_cast<int32_t>(ic));
+        }
+        sparseRowOffsets[oc + 1] = sparseValues.size();
+    }
+
+    sparseBiases.assign(OC, 0.f);
+    if (biases)
+        std::copy(biases, biases + OC, sparseBiases.begin());
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    // The weights are constant, so the conversion is done only once
+    if (sparseRowOffsets.empty())
+        initSparseWeights();
+
+    auto &srcMem = getParentEdgeAt(0)->getMemory();
+    auto &dstMem = getChildEdgeAt(0)->getMemory();
+    const auto *src = reinterpret_cast<const float *>(srcMem.GetData()) +
+                      srcMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto *dst = reinterpret_cast<float *>(dstMem.GetData()) + dstMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t OC = sparseRowOffsets.size() - 1;
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t MB = srcMem.GetElementsCount() / IC;
+
+    if (MB == 1) {
+        parallel_for(OC, [&](size_t oc) {
+            float acc = sparseBiases[oc];
+            for (size_t j = sparseRowOffsets[oc]; j < sparseRowOffsets[oc + 1]; j++)
+                acc += sparseValues[j] * src[sparseColumns[j]];
+            dst[oc] = acc;
+        });
+        return;
+    }
+
+    transposedSrc.resize(IC * MB);
+    parallel_for(IC, [&](size_t ic) {
+        for (size_t mb = 0; mb < MB; mb++)
+            transposedSrc[ic * MB + mb] = src[mb * IC + ic];
+    });
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(OC, nthr, ithr, start, end);
+        std::vector<float> acc(MB);
+        for (size_t oc = start; oc < end; oc++) {
+            std::fill(acc.begin(), acc.end(), sparseBiases[oc]);
+            for (size_t j = sparseRowOffsets[oc]; j < sparseRowOffsets[oc + 1]; j++) {
+                const float w = sparseValues[j];
+                const float *s = &transposedSrc[sparseColumns[j] * MB];
+                for (size_t mb = 0; mb < MB; mb++)
+                    acc[mb] += w * s[mb];
+            }
+            for (size_t mb = 0; mb < MB; mb++)
+                dst[mb * OC + oc] = acc[mb];
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::initNumaSplitWeights() {
+    const float *weights = nullptr;
+    const float *biases = nullptr;
+    getFP32WeightsAndBiases(weights, biases);
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+
+    numaSlices.resize(numaSplitNodes.size());
+    for (size_t s = 0; s < numaSlices.size(); s++) {
+        auto &slice = numaSlices[s];
+        splitter(OC, static_cast<int>(numaSlices.size()), static_cast<int>(s), slice.begin, slice.end);
+        slice.weights.assign(weights + slice.begin * IC, weights + slice.end * IC);
+        slice.biases.assign(slice.end - slice.begin, 0.f);
+        if (biases)
+            std::copy(biases + slice.begin, biases + slice.end, slice.biases.begin());
+        // the copy was made by the thread of the stream, so its pages are moved to the node which reads them
+        BindMemoryToNumaNode(slice.weights.data(), slice.weights.size() * sizeof(float), numaSplitNodes[s]);
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        slice.arena.reset(new tbb::task_arena{tbb::task_arena::constraints{numaSplitNodes[s], tbb::task_arena::automatic}});
+        slice.group.reset(new tbb::task_group);
+#endif
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeNumaSplit() {
+    // The weights are constant, so they are split only once
+    if (numaSlices.empty())
+        initNumaSplitWeights();
+
+    auto &srcMem = getParentEdgeAt(0)->getMemory();
+    auto &dstMem = getChildEdgeAt(0)->getMemory();
+    const auto *src = reinterpret_cast<const float *>(srcMem.GetData()) +
+                      srcMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto *dst = reinterpret_cast<float *>(dstMem.GetData()) + dstMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t MB = srcMem.GetElementsCount() / IC;
+
+    // Every slice writes its own output channels, so the results need no gathering
+    auto computeSlice = [&](const NumaSlice &slice) {
+        parallel_for(slice.end - slice.begin, [&](size_t oc) {
+            const float *w = slice.weights.data() + oc * IC;
+            for (size_t mb = 0; mb < MB; mb++)
+                dst[mb * OC + slice.begin + oc] = dotF32(src + mb * IC, w, IC) + slice.biases[oc];
+        });
+    };
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    for (auto &slice : numaSlices) {
+        auto *group = slice.group.get();
+        const auto *current = &slice;
+        slice.arena->execute([&] {
+            group->run([&computeSlice, current] { computeSlice(*current); });
+        });
+    }
+    for (auto &slice : numaSlices) {
+        auto *group = slice.group.get();
+        slice.arena->execute([group] { group->wait(); });
+    }
+#else
+    for (auto &slice : numaSlices)
+        computeSlice(slice);
+#endif
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
@@ -9,6 +9,11 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "ie_parallel.hpp"
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
 
 namespace MKLDNNPlugin {
 
@@ -18,7 +23,10 @@ public:
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +45,28 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    // The weights input holds the U8 codes of a FakeQuantize: w[o][i] = q[o][i] * scales[o] + shifts[o].
+    // Scales and shifts are either per output channel or a single value.
+    void setCompressedWeights(std::vector<float> scales, std::vector<float> shifts, int levels);
+    bool isWithCompressedWeights() const {
+        return compressedWeightsLevels > 0;
+    }
+
+    // Constant FP32 weights are converted to the CSR format at the first inference and only non-zeros are multiplied
+    void setSparseWeights() {
+        sparseWeights = true;
+    }
+    bool isWithSparseWeights() const {
+        return sparseWeights;
+    }
+
+    // Constant FP32 weights are split along the output channels between the NUMA nodes at the first inference,
+    // every node multiplies its local slice by its own threads
+    void setNumaSplitWeights(std::vector<int> numaNodes);
+    bool isWithNumaSplitWeights() const {
+        return !numaSplitNodes.empty();
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +82,46 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    void executeCompressed();
+    void packCompressedWeights();
+
+    std::vector<float> compressedWeightsScales;
+    std::vector<float> compressedWeightsShifts;
+    int compressedWeightsLevels = 0;
+    // Two codes per byte when all of them fit into 4 bits, the even element goes to the low nibble
+    std::vector<uint8_t> packedWeights;
+
+    void executeSparse();
+    void initSparseWeights();
+
+    bool sparseWeights = false;
+    std::vector<float> sparseValues;
+    std::vector<int32_t> sparseColumns;
+    std::vector<size_t> sparseRowOffsets;
+    std::vector<float> sparseBiases;
+    // Source transposed to [IC, MB], so every non-zero weight is applied to the whole batch at once
+    std::vector<float> transposedSrc;
+
+    void executeNumaSplit();
+    void initNumaSplitWeights();
+    void getFP32WeightsAndBiases(const float *&weights, const float *&biases);
+    bool isWithCustomExecution() const {
+        return isWithCompressedWeights() || isWithSparseWeights() || isWithNumaSplitWeights();
+    }
+
+    struct NumaSlice {
+        size_t begin = 0;
+        size_t end = 0;
+        std::vector<float> weights;
+        std::vector<float> biases;
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        std::unique_ptr<tbb::task_arena> arena;
+        std::unique_ptr<tbb::task_group> group;
+#endif
+    };
+    std::vector<int> numaSplitNodes;
+    std::vector<NumaSlice> numaSlices;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_gemm_node.h"
+#include "mkldnn_memory_node.hpp"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -241,6 +242,29 @@ void MKLDNNGemmNode::process_data() {
     int ldb = transposeB ? K : N;
     int ldc = N;
 
+    // The inputs read directly from the append states are multiplied by their valid prefix only, since the rest of
+    // the states is zero. So a decoder step costs as much as the tokens it attends to rather than the capacity.
+    auto validSize = [&](size_t input, int axis, int size) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(getParentEdgeAt(input)->getParent().get());
+        auto appendState = memoryNode ? memoryNode->getAppendState() : nullptr;
+        if (!appendState || appendState->axis != static_cast<size_t>(axis))
+            return size;
+        return std::max(1, std::min(size, static_cast<int>(appendState->length)));
+    };
+    const int validK = std::min(validSize(0, transposeA ? yAxis : xAxis, K), validSize(1, transposeB ? xAxis : yAxis, K));
+    // the rows and the columns out of the prefix are zero, unless they are taken from the third input
+    const int validM = isThreeInputs ? M : validSize(0, transposeA ? xAxis : yAxis, M);
+    const int validN = isThreeInputs ? N : validSize(1, transposeB ? yAxis : xAxis, N);
+    auto multiply = [&](const T0 *a_ptr, const T1 *b_ptr, float *d_ptr) {
+        process_gemm(transa, transb, validM, validN, validK, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+        if (validN < N) {
+            for (int m = 0; m < validM; m++)
+                memset(d_ptr + m * N + validN, 0, (N - validN) * sizeof(float));
+        }
+        if (validM < M)
+            memset(d_ptr + validM * N, 0, (M - validM) * N * sizeof(float));
+    };
+
     const float *src2_ptr;
     if (isThreeInputs) {
         auto& srcMemory2 = getParentEdgeAt(2)->getMemory();
@@ -254,6 +278,27 @@ void MKLDNNGemmNode::process_data() {
         beta = 0.f;
     }
 
+    // Batched small matrices (e.g. attention scores of every head) are multiplied in parallel, one matrix per
+    // thread, since a single small gemm does not scale over the threads. The nested gemm calls run sequentially.
+    const size_t smallGemmSize = 1 << 21;
+    const int batches = MB1 * MB2;
+    if (batches > 1 && (batches >= parallel_get_max_threads() ||
+                        static_cast<size_t>(validM) * static_cast<size_t>(validN) * static_cast<size_t>(validK) <= smallGemmSize)) {
+        parallel_for2d(MB1, MB2, [&](int b1, int b2) {
+            const T0 *a_ptr = src0_ptr + b1 * aOffsets[1] + b2 * aOffsets[0];
+            const T1 *b_ptr = src1_ptr + b1 * bOffsets[1] + b2 * bOffsets[0];
+            float *d_ptr = dst_ptr + (static_cast<size_t>(b1) * MB2 + b2) * M * N;
+
+            if (isThreeInputs) {
+                const float *c_ptr = src2_ptr + b1 * cOffsets[1] + b2 * cOffsets[0];
+                memcpy(d_ptr, c_ptr, M * N * sizeof(float));
+            }
+
+            multiply(a_ptr, b_ptr, d_ptr);
+        });
+        return;
+    }
+
     for (int b1 = 0; b1 < MB1; b1++) {
         const T0 *a_ptr = src0_ptr;
         const T1 *b_ptr = src1_ptr;
@@ -266,7 +311,7 @@ void MKLDNNGemmNode::process_data() {
                 c_ptr += cOffsets[0];
             }
 
-            process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+            multiply(a_ptr, b_ptr, d_ptr);
 
             a_ptr += aOffsets[0];
             b_ptr += bOffsets[0];
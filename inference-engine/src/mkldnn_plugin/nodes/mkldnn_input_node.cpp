@@ -48,6 +48,8 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
     memory::format outFormat = mkldnn::memory::format_undef;
     if (getType() == Input || getType() == MemoryInput) {
         precision = getCnnLayer()->outData[0]->getPrecision();
+        if (constBlobReplaced)
+            precision = constBlob->getTensorDesc().getPrecision();
         if (precision == InferenceEngine::Precision::U16 || isMeanImage) {
             precision = InferenceEngine::Precision::FP32;
         }
@@ -93,6 +95,13 @@ void MKLDNNInputNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set for node " << getName() << ".";
 }
 
+void MKLDNNInputNode::setConstBlob(const InferenceEngine::Blob::Ptr& blob) {
+    if (!constBlob || !blob || constBlob->size() != blob->size())
+        THROW_IE_EXCEPTION << "Cannot replace the constant blob of node " << getName();
+    constBlob = blob;
+    constBlobReplaced = true;
+}
+
 bool MKLDNNInputNode::created() const {
     return getType() == Input || getType() == Output;
 }
@@ -25,11 +25,18 @@ public:
         isMeanImage = true;
     }
 
+    const InferenceEngine::Blob::Ptr& getConstBlob() const {
+        return constBlob;
+    }
+    // Replaces the content of a constant input, the output precision follows the new blob
+    void setConstBlob(const InferenceEngine::Blob::Ptr& blob);
+
 private:
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
     bool isMeanImage = false;
+    bool constBlobReplaced = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -6,6 +6,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -24,7 +25,34 @@ MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
     MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
 }
 
-void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
+void MKLDNNMemoryOutputNode::getSupportedDescriptors() {
+    if (inputNode == nullptr || inputNode->getChildEdges().empty() || getAppendState())
+        return;
+
+    // the new state which is smaller than the state along a single axis is appended to the state
+    auto sliceDims = getParentEdgeAt(0)->getDims();
+    auto stateDims = inputNode->getChildEdgeAt(0)->getDims();
+    if (sliceDims.ndims() != stateDims.ndims())
+        return;
+    int axis = -1;
+    for (int i = 0; i < sliceDims.ndims(); i++) {
+        if (sliceDims[i] == stateDims[i])
+            continue;
+        if (axis != -1 || sliceDims[i] > stateDims[i])
+            return;
+        axis = i;
+    }
+    if (axis == -1)
+        return;
+
+    auto state = std::make_shared<MKLDNNAppendState>();
+    state->axis = static_cast<size_t>(axis);
+    state->capacity = static_cast<size_t>(stateDims[axis]);
+    setAppendState(state);
+    auto memoryInput = dynamic_cast<MKLDNNMemoryNode*>(inputNode);
+    if (memoryInput != nullptr)
+        memoryInput->setAppendState(state);
+}
 
 void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
@@ -39,8 +67,10 @@ void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     config.inConfs.resize(1);
     config.inConfs[0].inPlace = -1;
     config.inConfs[0].constant = false;
-    config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::format::any);
-    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, memory::format::any);
+    // the slice of an append state is copied by the planar rows
+    auto format = getAppendState() ? MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims()) : memory::format::any;
+    config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, format);
+    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, format);
 }
 
 const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
@@ -51,6 +81,14 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
 }
 
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
+    if (stateSwapped)
+        return;
+
+    if (getAppendState()) {
+        appendSlice();
+        return;
+    }
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
@@ -62,6 +100,39 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     memcpy(dst_ptr, src_ptr, srcMemory.GetSize());
 }
 
+void MKLDNNMemoryOutputNode::appendSlice() {
+    auto& state = *getAppendState();
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+
+    auto dims = srcMemory.GetDims();
+    const size_t slice = static_cast<size_t>(dims[state.axis]);
+    if (state.length + slice > state.capacity)
+        THROW_IE_EXCEPTION << "The state " << getId() << " of the capacity " << state.capacity
+                           << " is full, reset it to continue";
+
+    size_t outer = 1, inner = 1;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (i < state.axis)
+            outer *= dims[i];
+        else if (i > state.axis)
+            inner *= dims[i];
+    }
+
+    const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
+            srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    // only the new rows are written, the valid prefix of the state stays in place
+    const size_t length = state.length;
+    parallel_for(outer, [&](size_t i) {
+        memcpy(dst_ptr + (i * state.capacity + length) * inner, src_ptr + i * slice * inner,
+               slice * inner * sizeof(float));
+    });
+    state.length += slice;
+}
+
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer) {
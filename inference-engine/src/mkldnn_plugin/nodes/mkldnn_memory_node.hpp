@@ -14,8 +14,23 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief The state which grows by a slice every inference, like the keys and the values cache of a decoder
+ * @details The state is allocated with the full capacity along the axis and the new state is a smaller slice,
+ * which is written after the valid prefix of the state, so an inference copies the new slice only. The rest of
+ * the state is zero. MemoryInput and MemoryOutput of the state share the length.
+ */
+struct MKLDNNAppendState {
+    typedef std::shared_ptr<MKLDNNAppendState> Ptr;
+
+    size_t axis = 0;
+    size_t capacity = 0;
+    size_t length = 0;
+};
+
 class MKLDNNMemoryNode {
     std::string _id;
+    MKLDNNAppendState::Ptr appendState;
  public:
     explicit MKLDNNMemoryNode(std::string id) : _id(id) {}
     explicit MKLDNNMemoryNode(InferenceEngine::CNNLayerPtr lp) {
@@ -28,6 +43,16 @@ class MKLDNNMemoryNode {
         return _id;
     }
     virtual void setInputNode(MKLDNNNode *) = 0;
+
+    /**
+     * @return The append state or nullptr if the new state replaces the state
+     */
+    const MKLDNNAppendState::Ptr& getAppendState() const {
+        return appendState;
+    }
+    void setAppendState(const MKLDNNAppendState::Ptr& state) {
+        appendState = state;
+    }
 };
 class MKLDNNMemoryOutputNode;
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
@@ -79,11 +104,25 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
+
+    MKLDNNNode* getInputNode() const {
+        return inputNode;
+    }
+
+    /**
+     * @brief The graph swaps the buffers of the state and of the new state after inference, so there is nothing to copy
+     */
+    void setStateSwapped(bool swapped) {
+        stateSwapped = swapped;
+    }
  private:
+    void appendSlice();
+
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    bool stateSwapped = false;
     static Register<MKLDNNMemoryOutputNode> reg;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
@@ -65,7 +65,7 @@ struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_ge
         Xbyak::Label exit_label;
 
         if (n + 1 == jpp.ndims) {
-            if (jpp.src_strides[n] == jpp.dst_strides[n] == 1) {
+            if (jpp.src_strides[n] == 1 && jpp.dst_strides[n] == 1) {
                 uint32_t step = vlen / jpp.data_size;
 
                 L(main_loop_label);
@@ -337,6 +337,23 @@ void MKLDNNPermuteNode::createPrimitive() {
         work_amount *= sorted_dst_dims[i];
     }
 
+    //  merge the adjacent dims looped by the kernel which are dense in both src and dst, so permutations
+    //  like 0,2,1,3 copy the innermost contiguous chunks with the vector loop instead of element by element
+    const int loop_begin = std::max(std::min(n, n2), jpp.supported_dynamic_batch ? 1 : 0);
+    for (int i = static_cast<int>(sorted_dst_dims.size()) - 2; i >= loop_begin; i--) {
+        if (sorted_src_strides[i] == sorted_src_strides[i + 1] * sorted_dst_dims[i + 1] &&
+            sorted_dst_strides[i] == sorted_dst_strides[i + 1] * sorted_dst_dims[i + 1]) {
+            sorted_dst_dims[i] *= sorted_dst_dims[i + 1];
+            sorted_src_strides[i] = sorted_src_strides[i + 1];
+            sorted_dst_strides[i] = sorted_dst_strides[i + 1];
+
+            sorted_dst_dims.erase(sorted_dst_dims.begin() + i + 1);
+            sorted_src_strides.erase(sorted_src_strides.begin() + i + 1);
+            sorted_dst_strides.erase(sorted_dst_strides.begin() + i + 1);
+            sorted_order.erase(sorted_order.begin() + i + 1);
+        }
+    }
+
     jpp.src_strides = sorted_src_strides;
     jpp.dst_strides = sorted_dst_strides;
     jpp.dst_block_dims = sorted_dst_dims;
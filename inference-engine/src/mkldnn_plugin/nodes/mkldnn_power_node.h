@@ -21,6 +21,10 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    float getScale() const { return scale; }
+    float getShift() const { return shift; }
+    float getPower() const { return power; }
+
 private:
     float scale;
     float shift;
@@ -25,6 +25,7 @@ public:
     void execute(mkldnn::stream strm) override;
 
     size_t getAxis() const { return axis; }
+    int getLevels() const { return levels; }
 
     bool isBinarization() const { return quantizeAlgorithm == mkldnn::algorithm::binarization_depthwise; }
     mkldnn::algorithm getAlgorithm() const { return quantizeAlgorithm; }
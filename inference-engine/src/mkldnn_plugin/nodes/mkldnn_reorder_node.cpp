@@ -73,6 +73,9 @@ void MKLDNNReorderNode::createPrimitive() {
 
     createReorderPrimitive(srcMemPtr->GetDescriptor(), srcMemPtr->GetPrimitive().get_data_handle(),
             dstMemPtr->GetDescriptor(), dstMemPtr->GetPrimitive().get_data_handle());
+
+    batchVariants.clear();
+    batchVariants[getMaxBatch()] = {prim, src_blocked, dst_blocked};
 }
 
 void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr) {
@@ -178,6 +181,16 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
     if (prim) {
+        const int batch = batchToProcess();
+        auto variant = batchVariants.find(batch);
+        if (variant != batchVariants.end()) {
+            // the data handles are set right before the execution
+            prim = variant->second.prim;
+            src_blocked = variant->second.src_blocked;
+            dst_blocked = variant->second.dst_blocked;
+            return;
+        }
+
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
         memory::desc src_d = srcMemPtr->GetDescriptor();
@@ -185,13 +198,14 @@ void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
         void *src_data_hdl = srcMemPtr->GetPrimitive().get_data_handle();
         void *dst_data_hdl = dstMemPtr->GetPrimitive().get_data_handle();
 
-        src_d.data.dims[0] = batchToProcess();
-        src_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
+        src_d.data.dims[0] = batch;
+        src_d.data.layout_desc.blocking.padding_dims[0] = batch;
 
-        dst_d.data.dims[0] = batchToProcess();
-        dst_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
+        dst_d.data.dims[0] = batch;
+        dst_d.data.layout_desc.blocking.padding_dims[0] = batch;
 
         createReorderPrimitive(src_d, src_data_hdl, dst_d, dst_data_hdl);
+        batchVariants[batch] = {prim, src_blocked, dst_blocked};
     }
 }
 REG_MKLDNN_PRIM_FOR(MKLDNNReorderNode, Reorder);
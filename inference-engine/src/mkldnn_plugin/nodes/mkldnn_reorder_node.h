@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_map>
 
 namespace MKLDNNPlugin {
 
@@ -50,6 +51,16 @@ private:
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
 
+    /**
+     * @brief The reorder created for a batch size, kept to avoid re-creation when the dynamic batch changes
+     */
+    struct BatchVariant {
+        MKLDNNPrimitive prim;
+        MKLDNNMemoryPtr src_blocked;
+        MKLDNNMemoryPtr dst_blocked;
+    };
+    std::unordered_map<int, BatchVariant> batchVariants;
+
     void createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr);
 };
 
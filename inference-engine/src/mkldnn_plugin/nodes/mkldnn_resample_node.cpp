@@ -16,6 +16,7 @@
 #include <ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <cmath>
 
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
@@ -379,7 +380,7 @@ void MKLDNNResampleNode::initSupportedPrimitiveDescriptors() {
             }
         }
     }
-    if (type == "caffe.ResampleParameter.LINEAR") {
+    if (type == "caffe.ResampleParameter.LINEAR" || type == "caffe.ResampleParameter.CUBIC") {
         if (getParentEdgeAt(0)->getDims().ndims() == 4) {
             pushDesc(memory::nchw);
         } else if (getParentEdgeAt(0)->getDims().ndims() == 5) {
@@ -592,6 +593,44 @@ void MKLDNNResampleNode::execute(mkldnn::stream strm) {
             auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
             LinearInterpolation<float, float>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW, kernel_width, isDownsample && antialias);
         }
+    } else if (type == "caffe.ResampleParameter.CUBIC") {
+        if (output_prec == Precision::U8) {
+            auto dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetData());
+            if (input_prec == Precision::U8) {
+                auto src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<uint8_t, uint8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::I8) {
+                auto src_data = reinterpret_cast<const int8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<int8_t, uint8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::FP32) {
+                auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
+                CubicInterpolation<float, uint8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            }
+        } else if (output_prec == Precision::I8) {
+            auto dst_data = reinterpret_cast<int8_t *>(dstMemPtr->GetData());
+            if (input_prec == Precision::U8) {
+                auto src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<uint8_t, int8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::I8) {
+                auto src_data = reinterpret_cast<const int8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<int8_t, int8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::FP32) {
+                auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
+                CubicInterpolation<float, int8_t>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            }
+        } else if (output_prec == Precision::FP32) {
+            auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
+            if (input_prec == Precision::U8) {
+                auto src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<uint8_t, float>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::I8) {
+                auto src_data = reinterpret_cast<const int8_t *>(srcMemPtr->GetData());
+                CubicInterpolation<int8_t, float>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            } else if (input_prec == Precision::FP32) {
+                auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
+                CubicInterpolation<float, float>(src_data, dst_data, N, C, ID, IH, IW, fx, fy, fz, OD, OH, OW);
+            }
+        }
     }
 }
 
@@ -812,81 +851,155 @@ void MKLDNNResampleNode::LinearInterpolation(const in_data_t *in_ptr_, out_data_
         return;
     }
 
-    for (size_t b = 0; b < B; b++) {
+    parallel_for2d(B, C, [&](size_t b, size_t c) {
         const in_data_t *in_ptr_n = in_ptr_ + IW * IH * ID * C * b;
         out_data_t *out_ptr_n = out_ptr_ + OW * OH * OD * C * b;
-        for (size_t c = 0; c < C; c++) {
-            const in_data_t *in_ptr_nc = in_ptr_n + IW * IH * ID * c;
-            out_data_t *out_ptr_nc = out_ptr_n + OW * OH * OD * c;
-
-            for (size_t oz = 0; oz < OD; oz++) {
-                out_data_t *out_ptr_ncd = out_ptr_nc + OW * OH * oz;
-                for (size_t oy = 0; oy < OH; oy++) {
-                    out_data_t *out_ptr_ncdh = out_ptr_ncd + OW * oy;
-                    for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fx / 2.0f - 0.5f;
-                        float iy = oy * fy + fy / 2.0f - 0.5f;
-                        float iz = oz * fz + fz / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-                        int iz_r = static_cast<int>(round(iz));
-
-                        float sum = 0;
-                        float wsum = 0;
-
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
-                        float az = 1.0f / (antialias ? fz : 1.0f);
-
-                        int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
-                        int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
-                        int rz = (fz < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / az));
-
-                        for (int z = iz_r - rz; z <= iz_r + rz; z++) {
-                            for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                                for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                    bool is_continue =  z < 0                     ||
-                                                        y < 0                     ||
-                                                        x < 0                     ||
-                                                        z >= static_cast<int>(ID) ||
-                                                        y >= static_cast<int>(IH) ||
-                                                        x >= static_cast<int>(IW);
-                                    if (is_continue)
-                                        continue;
-
-                                    float dx = ix - x;
-                                    float dy = iy - y;
-                                    float dz = iz - z;
-
-                                    float w = ax * triangleCoeff(ax * dx) *
-                                              ay * triangleCoeff(ay * dy) *
-                                              az * triangleCoeff(az * dz);
-
-                                    sum += w * static_cast<float>(in_ptr_nc[z * IH * IW + y * IW + x]);
-                                    wsum += w;
-                                }
+        const in_data_t *in_ptr_nc = in_ptr_n + IW * IH * ID * c;
+        out_data_t *out_ptr_nc = out_ptr_n + OW * OH * OD * c;
+
+        for (size_t oz = 0; oz < OD; oz++) {
+            out_data_t *out_ptr_ncd = out_ptr_nc + OW * OH * oz;
+            for (size_t oy = 0; oy < OH; oy++) {
+                out_data_t *out_ptr_ncdh = out_ptr_ncd + OW * oy;
+                for (size_t ox = 0; ox < OW; ox++) {
+                    float ix = ox * fx + fx / 2.0f - 0.5f;
+                    float iy = oy * fy + fy / 2.0f - 0.5f;
+                    float iz = oz * fz + fz / 2.0f - 0.5f;
+
+                    int ix_r = static_cast<int>(round(ix));
+                    int iy_r = static_cast<int>(round(iy));
+                    int iz_r = static_cast<int>(round(iz));
+
+                    float sum = 0;
+                    float wsum = 0;
+
+                    float ax = 1.0f / (antialias ? fx : 1.0f);
+                    float ay = 1.0f / (antialias ? fy : 1.0f);
+                    float az = 1.0f / (antialias ? fz : 1.0f);
+
+                    int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
+                    int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
+                    int rz = (fz < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / az));
+
+                    for (int z = iz_r - rz; z <= iz_r + rz; z++) {
+                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
+                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
+                                bool is_continue =  z < 0                     ||
+                                                    y < 0                     ||
+                                                    x < 0                     ||
+                                                    z >= static_cast<int>(ID) ||
+                                                    y >= static_cast<int>(IH) ||
+                                                    x >= static_cast<int>(IW);
+                                if (is_continue)
+                                    continue;
+
+                                float dx = ix - x;
+                                float dy = iy - y;
+                                float dz = iz - z;
+
+                                float w = ax * triangleCoeff(ax * dx) *
+                                          ay * triangleCoeff(ay * dy) *
+                                          az * triangleCoeff(az * dz);
+
+                                sum += w * static_cast<float>(in_ptr_nc[z * IH * IW + y * IW + x]);
+                                wsum += w;
                             }
                         }
-                        if (!wsum) {
-                            out_ptr_ncdh[ox] = 0;
-                        } else {
-                            float dst_value = sum / wsum;
-                            if (output_prec == Precision::FP32) {
-                                out_ptr_ncdh[ox] = dst_value;
-                            } else if (output_prec == Precision::U8) {
-                                out_ptr_ncdh[ox] = (dst_value >= 0) ? lroundf(dst_value) : 0;
-                            } else if (output_prec == Precision::I8) {
-                                out_ptr_ncdh[ox] = lroundf(dst_value);
-                            }
+                    }
+                    if (!wsum) {
+                        out_ptr_ncdh[ox] = 0;
+                    } else {
+                        float dst_value = sum / wsum;
+                        if (output_prec == Precision::FP32) {
+                            out_ptr_ncdh[ox] = dst_value;
+                        } else if (output_prec == Precision::U8) {
+                            out_ptr_ncdh[ox] = (dst_value >= 0) ? lroundf(dst_value) : 0;
+                        } else if (output_prec == Precision::I8) {
+                            out_ptr_ncdh[ox] = lroundf(dst_value);
                         }
                     }
                 }
             }
         }
+    });
+}
+
+// Keys cubic convolution coefficients (a = -0.75) of the 4 taps around the point at the distance t from the first inner tap
+static inline void cubicCoeffs(float t, float *coeffs) {
+    const float a = -0.75f;
+    float x = t + 1.0f;
+    coeffs[0] = ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+    x = t;
+    coeffs[1] = ((a + 2) * x - (a + 3)) * x * x + 1;
+    x = 1.0f - t;
+    coeffs[2] = ((a + 2) * x - (a + 3)) * x * x + 1;
+    coeffs[3] = 1.0f - coeffs[0] - coeffs[1] - coeffs[2];
+}
+
+// the source indices (replicated at the borders) and weights of the 4 taps for every output coordinate of an axis
+static void cubicTable(int I, int O, float f, std::vector<int> &index, std::vector<float> &weights) {
+    index.resize(4 * O);
+    weights.resize(4 * O);
+    for (int o = 0; o < O; o++) {
+        float i = o * f + f / 2.0f - 0.5f;
+        int i_floor = static_cast<int>(std::floor(i));
+        cubicCoeffs(i - i_floor, &weights[4 * o]);
+        for (int k = 0; k < 4; k++) {
+            index[4 * o + k] = (std::max)(0, (std::min)(I - 1, i_floor - 1 + k));
+        }
     }
 }
 
+template <typename in_data_t, typename out_data_t>
+void MKLDNNResampleNode::CubicInterpolation(const in_data_t *in_ptr_, out_data_t *out_ptr_, int B, int C, int ID, int IH, int IW,
+                                            float fx, float fy, float fz, int OD, int OH, int OW) {
+    std::vector<int> index_x, index_y, index_z;
+    std::vector<float> weights_x, weights_y, weights_z;
+    cubicTable(IW, OW, fx, index_x, weights_x);
+    cubicTable(IH, OH, fy, index_y, weights_y);
+    cubicTable(ID, OD, fz, index_z, weights_z);
+
+    parallel_for3d(B, C, OD, [&](int b, int c, int oz) {
+        const in_data_t *in_ptr_nc = in_ptr_ + IW * IH * ID * (C * b + c);
+        out_data_t *out_ptr_ncd = out_ptr_ + OW * OH * (OD * (C * b + c) + oz);
+
+        for (int oy = 0; oy < OH; oy++) {
+            for (int ox = 0; ox < OW; ox++) {
+                float dst_value = 0;
+                for (int kz = 0; kz < 4; kz++) {
+                    float wz = weights_z[4 * oz + kz];
+                    if (wz == 0.0f)
+                        continue;  // e.g. all the depth taps but one for 4D inputs
+
+                    const in_data_t *in_ptr_ncd = in_ptr_nc + IW * IH * index_z[4 * oz + kz];
+                    float sum_y = 0;
+                    for (int ky = 0; ky < 4; ky++) {
+                        const in_data_t *in_ptr_ncdh = in_ptr_ncd + IW * index_y[4 * oy + ky];
+                        float sum_x = 0;
+                        for (int kx = 0; kx < 4; kx++) {
+                            sum_x += weights_x[4 * ox + kx] * static_cast<float>(in_ptr_ncdh[index_x[4 * ox + kx]]);
+                        }
+                        sum_y += weights_y[4 * oy + ky] * sum_x;
+                    }
+                    dst_value += wz * sum_y;
+                }
+
+                if (!fusedWith.empty()) {
+                    apply_post_ops_scalar(dst_value, c);
+                }
+
+                if (output_prec == Precision::U8) {
+                    out_ptr_ncd[oy * OW + ox] = static_cast<out_data_t>((std::min)(255.0f, (std::max)(0.0f, roundf(dst_value))));
+                } else if (output_prec == Precision::I8) {
+                    out_ptr_ncd[oy * OW + ox] = static_cast<out_data_t>((std::min)(127.0f, (std::max)(-128.0f, roundf(dst_value))));
+                } else {
+                    out_ptr_ncd[oy * OW + ox] = dst_value;
+                }
+            }
+        }
+    });
+}
+
 inline void MKLDNNResampleNode::apply_post_ops_scalar(float &dst_value, int index_c) {
     const auto &p = (*attr.get()).post_ops_;
     for (int i = 0; i < p.len_; i++) {
@@ -86,6 +86,9 @@ private:
     template <typename in_data_t, typename out_data_t>
     void LinearInterpolation(const in_data_t *in_ptr_, out_data_t *out_ptr_, int B, int C, int ID, int IH, int IW,
                                           float fx, float fy, float fz, int OD, int OH, int OW, int kernel_width, bool antialias);
+    template <typename in_data_t, typename out_data_t>
+    void CubicInterpolation(const in_data_t *in_ptr_, out_data_t *out_ptr_, int B, int C, int ID, int IH, int IW,
+                                          float fx, float fy, float fz, int OD, int OH, int OW);
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
     inline void apply_post_ops_scalar(float &dst_value, int index_c);
 
@@ -51,8 +51,8 @@ static LayerConfig make_plain_config(const CNNLayerPtr &layer) {
 
 class PortIteratorHelper : public PortMapHelper {
 public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
-            bool as_input, const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool as_input, const TensorIterator::PortMap &port_map,
+            const MKLDNNGraph *graph, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
         const auto &full_blob = as_input ? from : to;
         const auto &part_blob = !as_input ? from : to;
 
@@ -93,6 +93,9 @@ public:
             chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
             chunk_stride_in_byte *= sign_of_stride;
 
+            if (graph && bindInPlace(*graph, *full_blob, *part_blob, axis))
+                return;
+
             if (as_input) {
                 reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
             } else {
@@ -101,7 +104,22 @@ public:
         }
     }
 
+    void bind(int n_iter) override {
+        if (part_edges.empty())
+            return;
+
+        IE_ASSERT(n_iter < iter_count);
+
+        auto full_mem = mem_holder[FULL_DATA];
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
+        for (auto &edge : part_edges)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(chunk_ptr);
+    }
+
     void execute(int n_iter, mkldnn::stream strm) override {
+        if (!part_edges.empty())
+            return;
+
         if (chunk_stride_in_byte != 0) {
             IE_ASSERT(n_iter < iter_count);
 
@@ -119,7 +137,41 @@ public:
     };
 
 private:
+    /**
+     * @brief Makes the body use the chunks of the full tensor in place when each of them is a contiguous part of it:
+     * the edges of the body bound to the part memory are pointed at the chunk of the iteration instead of copying it
+     */
+    bool bindInPlace(const MKLDNNGraph &graph, const MKLDNNMemory &full_blob, const MKLDNNMemory &part_blob, int axis) {
+        if (!MKLDNNMemory::IsPlainFormat(full_blob.GetFormat()) || full_blob.GetFormat() != part_blob.GetFormat() ||
+                full_blob.GetDataType() != part_blob.GetDataType() ||
+                full_blob.GetDescriptor().data.layout_desc.blocking.offset_padding != 0 ||
+                part_blob.GetDescriptor().data.layout_desc.blocking.offset_padding != 0)
+            return false;
+
+        auto full_dims = full_blob.GetDims();
+        for (int i = 0; i < axis; i++) {
+            if (full_dims[i] != 1)
+                return false;
+        }
+
+        std::vector<MKLDNNEdgePtr> edges;
+        if (!graph.GetEdgesBoundTo(part_blob, edges) || edges.empty())
+            return false;
+
+        for (auto &edge : edges) {
+            // the input chunk must not be overwritten by the nodes working in place,
+            // and the output chunk is written by the body nodes only
+            bool is_input_edge = edge->getParent()->getType() == Input;
+            if (is_input_edge != as_input || edge->getParent()->isConstant())
+                return false;
+        }
+
+        part_edges = std::move(edges);
+        return true;
+    }
+
     bool as_input;
+    std::vector<MKLDNNEdgePtr> part_edges;
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
 
@@ -129,18 +181,33 @@ private:
 
 class BackEdgePortHelper : public PortMapHelper {
 public:
-    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
+    BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const MKLDNNGraph *graph,
+            const mkldnn::engine& eng, int n_iter) {
+        iter_count = n_iter;
+
+        // the output of the iteration becomes the input of the next one by swapping the buffers of the body,
+        // the data is copied only if the buffers cannot be exchanged
+        swapped = graph && graph->InitBufferSwap(*from, *to, buffer_swap, true);
+        if (swapped)
+            return;
+
         auto mem_desc =  from->GetDescriptor();
         mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
         reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
-        iter_count = n_iter;
     }
 
     void execute(int n_iter, mkldnn::stream strm) override {
         if (n_iter < iter_count - 1) {
-            strm.submit({reorders.begin(), reorders.end()});
+            if (swapped)
+                buffer_swap.swap();
+            else
+                strm.submit({reorders.begin(), reorders.end()});
         }
     };
+
+private:
+    bool swapped = false;
+    MKLDNNGraph::BufferSwap buffer_swap;
 };
 
 }  // namespace MKLDNNPlugin
@@ -195,12 +262,27 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    // the body memory is rebound in place of copying only if no other port map uses it,
+    // and a buffer can take part in one swap of the back edges only
+    std::map<MKLDNNMemoryPtr, int> body_mem_uses, back_edge_uses;
+    for (auto map_rule : ti->input_port_map)
+        body_mem_uses[input_mem[map_rule.to]]++;
+    for (auto map_rule : ti->output_port_map)
+        body_mem_uses[output_mem[map_rule.to]]++;
+    for (auto map_rule : ti->back_edges) {
+        body_mem_uses[output_mem[map_rule.from]]++;
+        body_mem_uses[input_mem[map_rule.to]]++;
+        back_edge_uses[output_mem[map_rule.from]]++;
+        back_edge_uses[input_mem[map_rule.to]]++;
+    }
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
+        bool can_bind = body_mem_uses[intr_mem] == 1;
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, can_bind ? &sub_graph : nullptr, getEngine(), n_iter));
 
         in_port_mappers.push_back(mapper);
     }
@@ -208,9 +290,10 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     for (auto map_rule : ti->output_port_map) {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
+        bool can_bind = body_mem_uses[intr_mem] == 1;
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
+                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, can_bind ? &sub_graph : nullptr, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
@@ -218,9 +301,10 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
+        bool can_swap = back_edge_uses[from_mem] == 1 && back_edge_uses[to_mem] == 1;
 
         auto mapper = std::shared_ptr<PortMapHelper>(
-                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
+                new BackEdgePortHelper(from_mem, to_mem, can_swap ? &sub_graph : nullptr, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
@@ -231,8 +315,12 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
 
     for (int i = 0; i < n_iter; i++) {
         // copy data to subgraph iteration
-        for (auto &mapper : in_port_mappers)
+        for (auto &mapper : in_port_mappers) {
+            mapper->bind(i);
             mapper->execute(i, strm);
+        }
+        for (auto &mapper : out_port_mappers)
+            mapper->bind(i);
 
         sub_graph.Infer();
 
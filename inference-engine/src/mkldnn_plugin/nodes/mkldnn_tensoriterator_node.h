@@ -17,6 +17,10 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(int n_iter, mkldnn::stream strm) = 0;
+    /**
+     * @brief Rebinds the body memory to the data of the iteration before the body is executed
+     */
+    virtual void bind(int n_iter) {}
 protected:
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
@@ -93,39 +93,75 @@ public:
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (center_point_box) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+    // Corners and area of the boxes of one batch laid out as separate arrays, so that one box is compared
+    // against many selected boxes by a loop the compiler is able to vectorize
+    struct BoxesSoA {
+        std::vector<float> ymin, xmin, ymax, xmax, area;
+
+        void resize(size_t size) {
+            ymin.resize(size);
+            xmin.resize(size);
+            ymax.resize(size);
+            xmax.resize(size);
+            area.resize(size);
         }
 
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
+        void load(const float* boxes, size_t size, bool center_point_box) {
+            resize(size);
+            for (size_t i = 0; i < size; i++) {
+                const float* box = boxes + i * 4;
+                if (center_point_box) {
+                    //  box format: x_center, y_center, width, height
+                    ymin[i] = box[1] - box[3] / 2.f;
+                    xmin[i] = box[0] - box[2] / 2.f;
+                    ymax[i] = box[1] + box[3] / 2.f;
+                    xmax[i] = box[0] + box[2] / 2.f;
+                } else {
+                    //  box format: y1, x1, y2, x2
+                    ymin[i] = (std::min)(box[0], box[2]);
+                    xmin[i] = (std::min)(box[1], box[3]);
+                    ymax[i] = (std::max)(box[0], box[2]);
+                    xmax[i] = (std::max)(box[1], box[3]);
+                }
+                area[i] = (ymax[i] - ymin[i]) * (xmax[i] - xmin[i]);
+            }
+        }
 
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
+        void copy(size_t dst, const BoxesSoA& from, size_t src) {
+            ymin[dst] = from.ymin[src];
+            xmin[dst] = from.xmin[src];
+            ymax[dst] = from.ymax[src];
+            xmax[dst] = from.xmax[src];
+            area[dst] = from.area[src];
+        }
+    };
+
+    // Checks whether the IoU of box i with any of the first count selected boxes exceeds the threshold
+    static bool isSuppressed(const BoxesSoA& boxes, size_t i, const BoxesSoA& selected, size_t count, float iou_threshold) {
+        const size_t block = 16;
+
+        const float yminI = boxes.ymin[i];
+        const float xminI = boxes.xmin[i];
+        const float ymaxI = boxes.ymax[i];
+        const float xmaxI = boxes.xmax[i];
+        const float areaI = boxes.area[i];
+
+        // The most recently selected boxes have the lowest scores and are the most likely to overlap
+        for (size_t end = count; end > 0; end -= (std::min)(end, block)) {
+            size_t start = end - (std::min)(end, block);
+            int suppressed = 0;
+            for (size_t j = start; j < end; j++) {
+                float intersection_area =
+                    (std::max)((std::min)(ymaxI, selected.ymax[j]) - (std::max)(yminI, selected.ymin[j]), 0.f) *
+                    (std::max)((std::min)(xmaxI, selected.xmax[j]) - (std::max)(xminI, selected.xmin[j]), 0.f);
+                float iou = (areaI <= 0.f || selected.area[j] <= 0.f) ? 0.f :
+                            intersection_area / (areaI + selected.area[j] - intersection_area);
+                suppressed |= iou > iou_threshold;
+            }
+            if (suppressed)
+                return true;
+        }
+        return false;
     }
 
     typedef struct {
@@ -169,47 +205,74 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
-        for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
-                }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
+        std::vector<BoxesSoA> batchBoxes(num_batches);
+        parallel_for(num_batches, [&](int batch) {
+            batchBoxes[batch].load(boxes + batch * boxesStrides[0], num_boxes, center_point_box);
+        });
+
+        // Higher scores first, ties are broken by the box index to keep the result deterministic
+        auto scoreGreater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return l.first > r.first || (l.first == r.first && l.second < r.second);
+        };
+
+        std::vector<std::vector<filteredBoxes>> classBoxes(num_batches * num_classes);
+        parallel_for2d(num_batches, num_classes, [&](int batch, int class_idx) {
+            if (max_output_boxes_per_class <= 0)
+                return;
+
+            const BoxesSoA& boxesSoA = batchBoxes[batch];
+            float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+
+            // Only the boxes above the threshold take part in the sort
+            std::vector<std::pair<float, int> > scores_vector;
+            for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+                if (scoresPtr[box_idx] > score_threshold)
+                    scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+            }
+            if (scores_vector.empty())
+                return;
+
+            // The candidates are taken from a heap, so only as many of them are ordered as are needed
+            // to select max_output_boxes_per_class boxes
+            auto heapLess = [&](const std::pair<float, int>& l, const std::pair<float, int>& r) { return scoreGreater(r, l); };
+            std::make_heap(scores_vector.begin(), scores_vector.end(), heapLess);
+
+            BoxesSoA selected;
+            selected.resize((std::min)(static_cast<size_t>(max_output_boxes_per_class), scores_vector.size()));
+            size_t io_selection_size = 0;
+            std::vector<filteredBoxes>& fb = classBoxes[batch * num_classes + class_idx];
+
+            auto heapEnd = scores_vector.end();
+            while (heapEnd != scores_vector.begin() && io_selection_size < static_cast<size_t>(max_output_boxes_per_class)) {
+                std::pop_heap(scores_vector.begin(), heapEnd, heapLess);
+                --heapEnd;
+                const auto& candidate = *heapEnd;
+
+                if (!isSuppressed(boxesSoA, candidate.second, selected, io_selection_size, iou_threshold)) {
+                    selected.copy(io_selection_size, boxesSoA, candidate.second);
+                    io_selection_size++;
+                    fb.push_back({ candidate.first, batch, class_idx, candidate.second });
                 }
             }
-        }
+        });
+
+        std::vector<filteredBoxes> fb;
+        for (const auto& boxesOfClass : classBoxes)
+            fb.insert(fb.end(), boxesOfClass.begin(), boxesOfClass.end());
 
         if (sort_result_descending) {
-            parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
+            auto filteredGreater = [](const filteredBoxes& l, const filteredBoxes& r) {
+                return l.score > r.score || (l.score == r.score && (l.batch_index < r.batch_index ||
+                       (l.batch_index == r.batch_index && (l.class_index < r.class_index ||
+                       (l.class_index == r.class_index && l.box_index < r.box_index)))));
+            };
+            // Only the boxes which fit into the output have to be ordered
+            if (fb.size() > selected_indices_dims[0]) {
+                std::partial_sort(fb.begin(), fb.begin() + selected_indices_dims[0], fb.end(), filteredGreater);
+            } else {
+                parallel_sort(fb.begin(), fb.end(), filteredGreater);
+            }
         }
 
         int selected_indicesStride = outputs[0]->getTensorDesc().getBlockingDesc().getStrides()[0];
@@ -10,7 +10,7 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
-#if defined(HAVE_AVX2)
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 #include "ie_parallel.hpp"
@@ -140,12 +140,24 @@ static void nms_cpu(const int num_boxes, int is_dead[],
 
     std::memset(is_dead, 0, num_boxes * sizeof(int));
 
-#if defined(HAVE_AVX2)
+#if defined(HAVE_AVX512F)
+    __m512  vc_fone = _mm512_set1_ps(coordinates_offset);
+    __m512i vc_ione = _mm512_set1_epi32(1);
+    __m512  vc_zero = _mm512_set1_ps(0.0f);
+
+    __m512 vc_nms_thresh = _mm512_set1_ps(nms_thresh);
+#elif defined(HAVE_AVX2)
     __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
     __m256i vc_ione = _mm256_set1_epi32(1);
     __m256  vc_zero = _mm256_set1_ps(0.0f);
 
     __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
+#elif defined(HAVE_SSE42)
+    __m128  vc_fone = _mm_set1_ps(coordinates_offset);
+    __m128i vc_ione = _mm_set1_epi32(1);
+    __m128  vc_zero = _mm_set1_ps(0.0f);
+
+    __m128 vc_nms_thresh = _mm_set1_ps(nms_thresh);
 #endif
 
     for (int box = 0; box < num_boxes; ++box) {
@@ -158,7 +170,49 @@ static void nms_cpu(const int num_boxes, int is_dead[],
 
         int tail = box + 1;
 
-#if defined(HAVE_AVX2)
+#if defined(HAVE_AVX512F)
+        __m512 vx0i = _mm512_set1_ps(x0[box]);
+        __m512 vy0i = _mm512_set1_ps(y0[box]);
+        __m512 vx1i = _mm512_set1_ps(x1[box]);
+        __m512 vy1i = _mm512_set1_ps(y1[box]);
+
+        __m512 vA_width  = _mm512_sub_ps(vx1i, vx0i);
+        __m512 vA_height = _mm512_sub_ps(vy1i, vy0i);
+        __m512 vA_area   = _mm512_mul_ps(_mm512_add_ps(vA_width, vc_fone), _mm512_add_ps(vA_height, vc_fone));
+
+        for (; tail <= num_boxes - 16; tail += 16) {
+            __m512i vdst = _mm512_loadu_si512(is_dead + tail);
+
+            __m512 vx0j = _mm512_loadu_ps(x0 + tail);
+            __m512 vy0j = _mm512_loadu_ps(y0 + tail);
+            __m512 vx1j = _mm512_loadu_ps(x1 + tail);
+            __m512 vy1j = _mm512_loadu_ps(y1 + tail);
+
+            __m512 vx0 = _mm512_max_ps(vx0i, vx0j);
+            __m512 vy0 = _mm512_max_ps(vy0i, vy0j);
+            __m512 vx1 = _mm512_min_ps(vx1i, vx1j);
+            __m512 vy1 = _mm512_min_ps(vy1i, vy1j);
+
+            __m512 vwidth  = _mm512_add_ps(_mm512_sub_ps(vx1, vx0), vc_fone);
+            __m512 vheight = _mm512_add_ps(_mm512_sub_ps(vy1, vy0), vc_fone);
+            __m512 varea = _mm512_mul_ps(_mm512_max_ps(vc_zero, vwidth), _mm512_max_ps(vc_zero, vheight));
+
+            __m512 vB_width  = _mm512_sub_ps(vx1j, vx0j);
+            __m512 vB_height = _mm512_sub_ps(vy1j, vy0j);
+            __m512 vB_area   = _mm512_mul_ps(_mm512_add_ps(vB_width, vc_fone), _mm512_add_ps(vB_height, vc_fone));
+
+            __m512 vdivisor = _mm512_sub_ps(_mm512_add_ps(vA_area, vB_area), varea);
+            __m512 vintersection_area = _mm512_div_ps(varea, vdivisor);
+
+            __mmask16 vcmp = _mm512_cmp_ps_mask(vx0i, vx1j, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vy0i, vy1j, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vx0j, vx1i, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vy0j, vy1i, _CMP_LE_OS);
+            vcmp &= _mm512_cmp_ps_mask(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
+
+            _mm512_storeu_si512(is_dead + tail, _mm512_mask_blend_epi32(vcmp, vdst, vc_ione));
+        }
+#elif defined(HAVE_AVX2)
         __m256 vx0i = _mm256_set1_ps(x0[box]);
         __m256 vy0i = _mm256_set1_ps(y0[box]);
         __m256 vx1i = _mm256_set1_ps(x1[box]);
@@ -206,6 +260,54 @@ static void nms_cpu(const int num_boxes, int is_dead[],
 
             _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
         }
+#elif defined(HAVE_SSE42)
+        __m128 vx0i = _mm_set1_ps(x0[box]);
+        __m128 vy0i = _mm_set1_ps(y0[box]);
+        __m128 vx1i = _mm_set1_ps(x1[box]);
+        __m128 vy1i = _mm_set1_ps(y1[box]);
+
+        __m128 vA_width  = _mm_sub_ps(vx1i, vx0i);
+        __m128 vA_height = _mm_sub_ps(vy1i, vy0i);
+        __m128 vA_area   = _mm_mul_ps(_mm_add_ps(vA_width, vc_fone), _mm_add_ps(vA_height, vc_fone));
+
+        for (; tail <= num_boxes - 4; tail += 4) {
+            __m128i *pdst = reinterpret_cast<__m128i*>(is_dead + tail);
+            __m128i  vdst = _mm_loadu_si128(pdst);
+
+            __m128 vx0j = _mm_loadu_ps(x0 + tail);
+            __m128 vy0j = _mm_loadu_ps(y0 + tail);
+            __m128 vx1j = _mm_loadu_ps(x1 + tail);
+            __m128 vy1j = _mm_loadu_ps(y1 + tail);
+
+            __m128 vx0 = _mm_max_ps(vx0i, vx0j);
+            __m128 vy0 = _mm_max_ps(vy0i, vy0j);
+            __m128 vx1 = _mm_min_ps(vx1i, vx1j);
+            __m128 vy1 = _mm_min_ps(vy1i, vy1j);
+
+            __m128 vwidth  = _mm_add_ps(_mm_sub_ps(vx1, vx0), vc_fone);
+            __m128 vheight = _mm_add_ps(_mm_sub_ps(vy1, vy0), vc_fone);
+            __m128 varea = _mm_mul_ps(_mm_max_ps(vc_zero, vwidth), _mm_max_ps(vc_zero, vheight));
+
+            __m128 vB_width  = _mm_sub_ps(vx1j, vx0j);
+            __m128 vB_height = _mm_sub_ps(vy1j, vy0j);
+            __m128 vB_area   = _mm_mul_ps(_mm_add_ps(vB_width, vc_fone), _mm_add_ps(vB_height, vc_fone));
+
+            __m128 vdivisor = _mm_sub_ps(_mm_add_ps(vA_area, vB_area), varea);
+            __m128 vintersection_area = _mm_div_ps(varea, vdivisor);
+
+            __m128 vcmp_0 = _mm_cmple_ps(vx0i, vx1j);
+            __m128 vcmp_1 = _mm_cmple_ps(vy0i, vy1j);
+            __m128 vcmp_2 = _mm_cmple_ps(vx0j, vx1i);
+            __m128 vcmp_3 = _mm_cmple_ps(vy0j, vy1i);
+            __m128 vcmp_4 = _mm_cmplt_ps(vc_nms_thresh, vintersection_area);
+
+            vcmp_0 = _mm_and_ps(vcmp_0, vcmp_1);
+            vcmp_2 = _mm_and_ps(vcmp_2, vcmp_3);
+            vcmp_4 = _mm_and_ps(vcmp_4, vcmp_0);
+            vcmp_4 = _mm_and_ps(vcmp_4, vcmp_2);
+
+            _mm_storeu_si128(pdst, _mm_blendv_epi8(vdst, vc_ione, _mm_castps_si128(vcmp_4)));
+        }
 #endif
 
         for (; tail < num_boxes; ++tail) {
@@ -11,6 +11,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <utility>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -457,6 +459,83 @@ public:
         });
     }
 
+    // Partial selection for long axes: every chunk of a row keeps its best src_k elements in a heap where
+    // the worst of them is on top, so most of the blocks of the chunk are rejected by one vectorizable
+    // comparison with it. The candidates of the chunks are merged at the end.
+    template <template <typename> class Compare>
+    void topk_heap(const float* src_data, float* dst_data, int* dst_idx) {
+        typedef std::pair<float, int> candidate;
+        // Equal values keep the element with the lower index first, as the insertion sort does
+        auto better = [](const candidate& a, const candidate& b) {
+            return Compare<float>()(a.first, b.first) || (a.first == b.first && a.second < b.second);
+        };
+
+        const int k = src_k;
+        const int nthr = parallel_get_max_threads();
+        int chunks = before_num >= nthr ? 1 : (nthr + before_num - 1) / before_num;
+        chunks = std::max(1, std::min(chunks, dim / heap_chunk_min_size));
+        const int chunk_size = (dim + chunks - 1) / chunks;
+
+        std::vector<candidate> candidates(static_cast<size_t>(before_num) * chunks * k);
+        std::vector<int> counts(static_cast<size_t>(before_num) * chunks, 0);
+
+        parallel_for2d(before_num, chunks, [&](int i0, int ic) {
+            const float* row = src_data + static_cast<size_t>(i0) * dim;
+            const size_t offset = static_cast<size_t>(i0) * chunks + ic;
+            candidate* heap = &candidates[offset * k];
+            const int end = std::min(dim, (ic + 1) * chunk_size);
+            int size = 0;
+            int i = ic * chunk_size;
+            for (; i < end && size < k; i++) {
+                heap[size++] = candidate(row[i], i);
+                std::push_heap(heap, heap + size, better);
+            }
+
+            // Later elements have greater indices, so only strictly better values replace the top
+            auto insert = [&](int i) {
+                if (Compare<float>()(row[i], heap[0].first)) {
+                    std::pop_heap(heap, heap + k, better);
+                    heap[k - 1] = candidate(row[i], i);
+                    std::push_heap(heap, heap + k, better);
+                }
+            };
+            for (; i + heap_block_size <= end; i += heap_block_size) {
+                const float threshold = heap[0].first;
+                int found = 0;
+                for (int j = 0; j < heap_block_size; j++)
+                    found |= Compare<float>()(row[i + j], threshold);
+                if (!found)
+                    continue;
+                for (int j = 0; j < heap_block_size; j++)
+                    insert(i + j);
+            }
+            for (; i < end; i++)
+                insert(i);
+            counts[offset] = size;
+        });
+
+        parallel_for(before_num, [&](int i0) {
+            std::vector<candidate> merged;
+            merged.reserve(static_cast<size_t>(chunks) * k);
+            for (int ic = 0; ic < chunks; ic++) {
+                const size_t offset = static_cast<size_t>(i0) * chunks + ic;
+                merged.insert(merged.end(), candidates.begin() + offset * k, candidates.begin() + offset * k + counts[offset]);
+            }
+            std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), better);
+            if (!sort_value) {
+                std::sort(merged.begin(), merged.begin() + k, [](const candidate& a, const candidate& b) {
+                    return a.second < b.second;
+                });
+            }
+            for (int i = 0; i < k; i++) {
+                if (dst_data)
+                    dst_data[static_cast<size_t>(i0) * k + i] = merged[i].first;
+                if (dst_idx)
+                    dst_idx[static_cast<size_t>(i0) * k + i] = merged[i].second;
+            }
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -524,7 +603,12 @@ public:
                     top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
             }
         } else {
-            if (is_last_dim) {
+            if (is_last_dim && dim >= heap_min_dim && src_k * heap_min_ratio <= dim) {
+                if (mode_max)
+                    topk_heap<std::greater>(src, dst_data, dst_idx);
+                else
+                    topk_heap<std::less>(src, dst_data, dst_idx);
+            } else if (is_last_dim) {
                 if (mode_max)
                     topk<std::greater>(src, dst_data, dst_idx, in_dims);
                 else
@@ -559,6 +643,12 @@ private:
 
     int dim, before_num;
 
+    // The heap selection is used for the last axes which are long compared to src_k
+    const int heap_min_dim = 1024;
+    const int heap_min_ratio = 8;
+    const int heap_chunk_min_size = 4096;
+    const int heap_block_size = 16;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
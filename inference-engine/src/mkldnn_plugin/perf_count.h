@@ -4,10 +4,111 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/hw_counters.h"
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Histogram of the execution times of a layer, updated by the sampled inferences of all the streams
+ * @details Bucket 0 counts the executions shorter than a microsecond, bucket i > 0 the ones in [2^(i-1), 2^i)
+ * microseconds, the last bucket takes all the longer ones
+ */
+class PerfHistogram {
+public:
+    static constexpr size_t bucketsNum = 32;
+
+    void add(uint64_t duration) {
+        size_t bucket = 0;
+        while (bucket + 1 < bucketsNum && (duration >> bucket) != 0)
+            bucket++;
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(duration, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return The number of samples, the sum of their times in microseconds and the buckets
+     */
+    std::vector<uint64_t> get() const {
+        std::vector<uint64_t> values = {count.load(std::memory_order_relaxed), sum.load(std::memory_order_relaxed)};
+        for (auto& bucket : buckets)
+            values.push_back(bucket.load(std::memory_order_relaxed));
+        return values;
+    }
+
+private:
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> buckets[bucketsNum] = {};
+};
+
+/**
+ * @brief Adds the time of its scope in microseconds to the histogram
+ */
+class PerfHistogramScope {
+public:
+    explicit PerfHistogramScope(PerfHistogram& histogram)
+        : histogram(histogram), start(std::chrono::high_resolution_clock::now()) {}
+
+    ~PerfHistogramScope() {
+        histogram.add(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now() - start).count());
+    }
+
+private:
+    PerfHistogram& histogram;
+    std::chrono::high_resolution_clock::time_point start;
+};
+
+/**
+ * @brief The sampling rate and the per layer histograms shared by the graphs of an executable network
+ * @details The rate can be changed while the graphs infer, the layers of the graphs of all the streams
+ * with the same name share a histogram
+ */
+class PerfSampling {
+public:
+    typedef std::shared_ptr<PerfSampling> Ptr;
+
+    explicit PerfSampling(int rate): rate(rate) {}
+
+    /**
+     * @param rate Every rate-th inference of a graph is sampled, zero disables the sampling
+     */
+    void setRate(int rate) { this->rate.store(rate, std::memory_order_relaxed); }
+
+    int getRate() const { return rate.load(std::memory_order_relaxed); }
+
+    PerfHistogram* histogram(const std::string& layerName) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto& histogram = histograms[layerName];
+        if (!histogram)
+            histogram.reset(new PerfHistogram());
+        return histogram.get();
+    }
+
+    std::map<std::string, std::vector<uint64_t>> getHistograms() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::map<std::string, std::vector<uint64_t>> values;
+        for (auto& histogram : histograms)
+            values[histogram.first] = histogram.second->get();
+        return values;
+    }
+
+private:
+    std::atomic<int> rate;
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<PerfHistogram>> histograms;
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
@@ -20,16 +121,42 @@ public:
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    /**
+     * @return The hardware counters per execution, zeros if they were not collected
+     */
+    HwCounters avgHw() {
+        HwCounters avg;
+        if (hwNum == 0)
+            return avg;
+        avg.cycles = hw.cycles / hwNum;
+        avg.instructions = hw.instructions / hwNum;
+        avg.llcMisses = hw.llcMisses / hwNum;
+        avg.bytesRead = hw.bytesRead / hwNum;
+        avg.bytesWritten = hw.bytesWritten / hwNum;
+        return avg;
+    }
+
+    // the histogram the sampled executions are added to, nullptr if the network does not sample the layer
+    PerfHistogram* histogram = nullptr;
+
 private:
+    HwCounters hw;
+    uint32_t hwNum = 0;
+
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
     }
 
-    void finish_itr() {
+    void finish_itr(bool collect, bool sample) {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
-        num++;
+        auto itr = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        if (collect) {
+            duration += itr;
+            num++;
+        }
+        if (sample && histogram)
+            histogram->add(itr);
     }
 
     friend class PerfHelper;
@@ -37,13 +164,29 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    bool collect;
+    bool sample;
+    // the counters of the threads executing the node, nullptr if they are not collected
+    const HwCountersGroup* hwCounters;
+    HwCounters hwStart;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, bool collect, bool sample, const HwCountersGroup* hwCounters)
+        : counter(count), collect(collect), sample(sample), hwCounters(collect ? hwCounters : nullptr) {
+        if (this->hwCounters) hwStart = this->hwCounters->read();
+        if (collect || sample) counter.start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (collect || sample) counter.finish_itr(collect, sample);
+        if (hwCounters) {
+            counter.hw += hwCounters->read() - hwStart;
+            counter.hwNum++;
+        }
+    }
 };
 
 }  // namespace MKLDNNPlugin
 
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF(_counter, _collect, _sample, _hw) \
+    PerfHelper __helper##__counter (_counter->PerfCounter(), _collect, _sample, _hw);
@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.h"
+
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(__linux__) && defined(MAP_HUGETLB) && defined(MADV_HUGEPAGE)
+#define MKLDNN_HUGE_PAGES
+#endif
+
+namespace MKLDNNPlugin {
+
+const char* PageTypeName(PageType type) {
+    switch (type) {
+    case PageType::TransparentHuge: return "TRANSPARENT_HUGE_PAGES";
+    case PageType::HugeTlb2MB:      return "HUGE_PAGES_2MB";
+    case PageType::HugeTlb1GB:      return "HUGE_PAGES_1GB";
+    default:                        return "DEFAULT_PAGES";
+    }
+}
+
+#ifdef MKLDNN_HUGE_PAGES
+
+namespace {
+
+constexpr size_t hugePageSize = size_t(1) << 21;
+constexpr size_t gigaPageSize = size_t(1) << 30;
+
+// values from <linux/mman.h>, they are missing in the headers of old systems
+constexpr int mapHugeShift = 26;
+constexpr int mapHuge2MB = 21 << mapHugeShift;
+constexpr int mapHuge1GB = 30 << mapHugeShift;
+
+size_t RoundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+HugePagesMemory::HugePagesMemory(size_t size, PageType preferred) {
+    const int protection = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    // 1GB pages are taken only for the regions which fill most of a page
+    if (preferred == PageType::HugeTlb1GB && size >= gigaPageSize / 2) {
+        _mappingSize = RoundUp(size, gigaPageSize);
+        _mapping = mmap(nullptr, _mappingSize, protection, flags | MAP_HUGETLB | mapHuge1GB, -1, 0);
+        _type = PageType::HugeTlb1GB;
+    }
+    if ((_mapping == nullptr || _mapping == MAP_FAILED) && preferred != PageType::Default) {
+        _mappingSize = RoundUp(size, hugePageSize);
+        _mapping = mmap(nullptr, _mappingSize, protection, flags | MAP_HUGETLB | mapHuge2MB, -1, 0);
+        _type = PageType::HugeTlb2MB;
+    }
+    if (_mapping == nullptr || _mapping == MAP_FAILED) {
+        // the extra page is used to align the region, transparent huge pages cover aligned 2MB pages only
+        _mappingSize = RoundUp(size, hugePageSize) + hugePageSize;
+        _mapping = mmap(nullptr, _mappingSize, protection, flags, -1, 0);
+        if (_mapping == MAP_FAILED) {
+            _mapping = nullptr;
+            throw std::bad_alloc();
+        }
+        auto aligned = RoundUp(reinterpret_cast<uintptr_t>(_mapping), hugePageSize);
+        _data = reinterpret_cast<void*>(aligned);
+        _type = PageType::Default;
+        if (preferred != PageType::Default && 0 == madvise(_data, RoundUp(size, hugePageSize), MADV_HUGEPAGE)) {
+            _type = PageType::TransparentHuge;
+        }
+        return;
+    }
+    _data = _mapping;
+}
+
+HugePagesMemory::~HugePagesMemory() {
+    if (_mapping != nullptr)
+        munmap(_mapping, _mappingSize);
+}
+
+bool AdviseTransparentHugePages(const void* ptr, size_t size) {
+    if (ptr == nullptr)
+        return false;
+    const auto begin = RoundUp(reinterpret_cast<uintptr_t>(ptr), hugePageSize);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / hugePageSize * hugePageSize;
+    if (end <= begin)
+        return false;
+    return 0 == madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+}
+
+#else
+
+HugePagesMemory::HugePagesMemory(size_t size, PageType) {
+    _mappingSize = size;
+    _mapping = new char[size]();
+    _data = _mapping;
+}
+
+HugePagesMemory::~HugePagesMemory() {
+    delete[] static_cast<char*>(_mapping);
+}
+
+bool AdviseTransparentHugePages(const void*, size_t) {
+    return false;
+}
+
+#endif
+
+bool LockPages(const void* ptr, size_t size) {
+#if defined(__linux__)
+    return ptr != nullptr && size > 0 && 0 == mlock(ptr, size);
+#else
+    return false;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
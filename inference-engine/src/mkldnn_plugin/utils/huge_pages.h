@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+/**
+ * The pages which back a memory region
+ */
+enum class PageType {
+    Default,            // regular pages of the system
+    TransparentHuge,    // regular pages advised to be merged into 2MB transparent huge pages
+    HugeTlb2MB,         // pages of the reserved 2MB huge page pool
+    HugeTlb1GB,         // pages of the reserved 1GB huge page pool
+};
+
+const char* PageTypeName(PageType type);
+
+/**
+ * Anonymous memory backed by huge pages: pages of the reserved hugetlb pool of the given size if it has enough
+ * free pages, otherwise 2MB aligned memory advised to be backed by transparent huge pages, otherwise regular memory.
+ * The memory is zero initialized and not touched on allocation.
+ */
+class HugePagesMemory {
+public:
+    HugePagesMemory(size_t size, PageType preferred);
+    ~HugePagesMemory();
+
+    HugePagesMemory(const HugePagesMemory&) = delete;
+    HugePagesMemory& operator=(const HugePagesMemory&) = delete;
+
+    void* data() const { return _data; }
+    PageType type() const { return _type; }
+
+private:
+    void* _mapping = nullptr;
+    size_t _mappingSize = 0;
+    void* _data = nullptr;
+    PageType _type = PageType::Default;
+};
+
+/**
+ * Advises the kernel to back the whole 2MB pages of an already allocated memory region by transparent huge pages.
+ * The touched pages are merged in the background.
+ * @return false if the advice was not applied, e.g. the region does not contain a whole 2MB page
+ */
+bool AdviseTransparentHugePages(const void* ptr, size_t size);
+
+/**
+ * Locks the pages of an already allocated memory region in RAM, so they are faulted in and never swapped out.
+ * The pages stay locked until they are unmapped.
+ * @return false if the pages were not locked, e.g. the region exceeds RLIMIT_MEMLOCK
+ */
+bool LockPages(const void* ptr, size_t size);
+
+}  // namespace MKLDNNPlugin
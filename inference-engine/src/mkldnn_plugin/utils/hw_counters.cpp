@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+#if defined(__linux__) && defined(SYS_perf_event_open)
+#define MKLDNN_PERF_EVENTS
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef MKLDNN_PERF_EVENTS
+
+namespace {
+
+constexpr uint64_t cacheLineSize = 64;
+
+struct Event {
+    uint32_t type;
+    uint64_t config;
+};
+
+uint64_t llcMissConfig(uint64_t op) {
+    return PERF_COUNT_HW_CACHE_LL | (op << 8) | (static_cast<uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+}
+
+// in the order of the fields of HwCounters
+const Event events[] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HW_CACHE, llcMissConfig(PERF_COUNT_HW_CACHE_OP_READ)},
+    {PERF_TYPE_HW_CACHE, llcMissConfig(PERF_COUNT_HW_CACHE_OP_WRITE)},
+};
+constexpr size_t eventsNum = sizeof(events) / sizeof(events[0]);
+
+int openEvent(const Event& event, int leader) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // the thread is counted on any CPU it runs on
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+}
+
+}  // namespace
+
+HwCountersGroup::~HwCountersGroup() {
+    for (auto& thread : threads) {
+        for (auto fd : thread.fds)
+            close(fd);
+    }
+}
+
+void HwCountersGroup::attachCurrentThread() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!attached.insert(std::this_thread::get_id()).second)
+        return;
+
+    ThreadEvents thread;
+    for (const auto& event : events) {
+        auto fd = openEvent(event, thread.leader);
+        if (fd < 0) {
+            // the cycles lead the group, the other events are optional as they are not available on every CPU
+            if (thread.leader < 0)
+                return;
+            thread.positions.push_back(-1);
+            continue;
+        }
+        if (thread.leader < 0)
+            thread.leader = fd;
+        thread.positions.push_back(static_cast<int>(thread.fds.size()));
+        thread.fds.push_back(fd);
+    }
+    threads.push_back(std::move(thread));
+}
+
+HwCounters HwCountersGroup::read() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    HwCounters sum;
+    uint64_t values[1 + eventsNum];
+    for (auto& thread : threads) {
+        // the group format is the number of the events followed by their values
+        auto size = static_cast<ssize_t>(sizeof(uint64_t) * (1 + thread.fds.size()));
+        if (::read(thread.leader, values, sizeof(values)) != size)
+            continue;
+        auto value = [&](size_t field) {
+            return thread.positions[field] < 0 ? 0 : values[1 + thread.positions[field]];
+        };
+        HwCounters counters;
+        counters.cycles = value(0);
+        counters.instructions = value(1);
+        counters.llcMisses = value(2);
+        counters.bytesRead = value(3) * cacheLineSize;
+        counters.bytesWritten = value(4) * cacheLineSize;
+        sum += counters;
+    }
+    return sum;
+}
+
+#else
+
+HwCountersGroup::~HwCountersGroup() = default;
+
+void HwCountersGroup::attachCurrentThread() {}
+
+HwCounters HwCountersGroup::read() const {
+    return {};
+}
+
+#endif
+
+size_t HwCountersGroup::size() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return threads.size();
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Values of the hardware performance counters. The bytes are the last level cache lines
+ * missed on loads and stores, i.e. the traffic between the caches and the memory.
+ */
+struct HwCounters {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+
+    HwCounters& operator+=(const HwCounters& other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llcMisses += other.llcMisses;
+        bytesRead += other.bytesRead;
+        bytesWritten += other.bytesWritten;
+        return *this;
+    }
+
+    HwCounters operator-(const HwCounters& other) const {
+        HwCounters diff;
+        diff.cycles = cycles - other.cycles;
+        diff.instructions = instructions - other.instructions;
+        diff.llcMisses = llcMisses - other.llcMisses;
+        diff.bytesRead = bytesRead - other.bytesRead;
+        diff.bytesWritten = bytesWritten - other.bytesWritten;
+        return diff;
+    }
+};
+
+/**
+ * Hardware performance counters of a set of threads, e.g. of the threads which execute the nodes of a graph.
+ * The counters are opened with perf_event_open on Linux and count the user space only, so they depend
+ * on /proc/sys/kernel/perf_event_paranoid. The threads the counters cannot be opened for are not counted,
+ * on other platforms nothing is counted.
+ */
+class HwCountersGroup {
+public:
+    typedef std::shared_ptr<HwCountersGroup> Ptr;
+
+    HwCountersGroup() = default;
+    HwCountersGroup(const HwCountersGroup&) = delete;
+    HwCountersGroup& operator=(const HwCountersGroup&) = delete;
+    ~HwCountersGroup();
+
+    /**
+     * Starts counting the events of the calling thread, does nothing if the thread is counted already
+     */
+    void attachCurrentThread();
+
+    /**
+     * @return The sums of the counters of all the attached threads since they were attached
+     */
+    HwCounters read() const;
+
+    /**
+     * @return The number of the threads the counters were opened for
+     */
+    size_t size() const;
+
+private:
+    struct ThreadEvents {
+        int leader = -1;
+        std::vector<int> fds;
+        // the position of the event of every HwCounters field in the values of the group, -1 if it is not opened
+        std::vector<int> positions;
+    };
+
+    mutable std::mutex mutex;
+    std::set<std::thread::id> attached;
+    std::vector<ThreadEvents> threads;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+#define MKLDNN_NUMA_MEMORY_POLICY
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef MKLDNN_NUMA_MEMORY_POLICY
+
+namespace {
+
+// values from <linux/mempolicy.h>, libnuma headers are not required to build the plugin
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1 << 1;
+
+struct PageRange {
+    uintptr_t begin;
+    size_t size;
+};
+
+PageRange GetPageRange(const void* ptr, size_t size) {
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(ptr) & ~(pageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size + pageSize - 1) & ~(pageSize - 1);
+    return {begin, static_cast<size_t>(end - begin)};
+}
+
+}  // namespace
+
+bool BindMemoryToNumaNode(const void* ptr, size_t size, int numaNode) {
+    if (ptr == nullptr || size == 0 || numaNode < 0)
+        return false;
+    constexpr int bitsPerMask = sizeof(unsigned long) * 8;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNode / bitsPerMask + 1, 0);  // NOLINT
+    nodeMask[numaNode / bitsPerMask] = 1UL << (numaNode % bitsPerMask);
+    auto range = GetPageRange(ptr, size);
+    // pages shared with neighbour allocations are moved as well, it is harmless as they belong to the same stream
+    return 0 == syscall(SYS_mbind, range.begin, range.size, mpolPreferred, nodeMask.data(),
+                        nodeMask.size() * bitsPerMask, mpolMfMove);
+}
+
+void GetMemoryPlacement(const void* ptr, size_t size, std::map<int, uint64_t>& bytesPerNode) {
+    if (ptr == nullptr || size == 0)
+        return;
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto range = GetPageRange(ptr, size);
+    std::vector<void*> pages(range.size / pageSize);
+    for (size_t i = 0; i < pages.size(); i++) {
+        pages[i] = reinterpret_cast<void*>(range.begin + i * pageSize);
+    }
+    std::vector<int> status(pages.size(), -1);
+    // with nodes == nullptr the call does not move anything and just reports the node of each page
+    if (0 != syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0))
+        return;
+    for (auto node : status) {
+        // negative values are errors, e.g. -ENOENT for the pages which are not allocated yet
+        if (node >= 0)
+            bytesPerNode[node] += pageSize;
+    }
+}
+
+#else
+
+bool BindMemoryToNumaNode(const void*, size_t, int) {
+    return false;
+}
+
+void GetMemoryPlacement(const void*, size_t, std::map<int, uint64_t>&) {
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
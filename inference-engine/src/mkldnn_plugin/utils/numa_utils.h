@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Moves already allocated pages of the memory region to the NUMA node and
+ * makes the node preferred for the pages which are not touched yet.
+ * Does nothing on the platforms without NUMA memory policy support.
+ * @return false if the memory policy was not applied
+ */
+bool BindMemoryToNumaNode(const void* ptr, size_t size, int numaNode);
+
+/**
+ * Adds the number of bytes of the memory region resident on each NUMA node to bytesPerNode.
+ * The pages which are not allocated yet are not counted.
+ */
+void GetMemoryPlacement(const void* ptr, size_t size, std::map<int, uint64_t>& bytesPerNode);
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -11,6 +12,11 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <limits>
+#include <tuple>
+#include <cstdint>
+#include <exception>
+#include <thread>
 
 #include "ie_metric_helpers.hpp"
 #include <ie_api.h>
@@ -18,6 +24,9 @@
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 #include <multi-device/multi_device_config.hpp>
 #include <ie_plugin_config.hpp>
+#include <ie_tracing.hpp>
+#include <ie_load_time_profile.hpp>
+#include <ie_blob_transfer.hpp>
 #include "multi_device.hpp"
 
 namespace MultiDevicePlugin {
@@ -49,20 +58,18 @@ MultiDeviceInferRequest::MultiDeviceInferRequest(const InputsDataMap&   networkI
 }
 
 void MultiDeviceInferRequest::SetBlobsToAnotherRequest(InferRequest& req) {
-    for (const auto &it : _networkInputs) {
+    // the worker request keeps the blobs of the previous inference, so the same blobs are not set again
+    auto setBlob = [&](const std::string& name) {
         Blob::Ptr blob;
-        auto &name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
         GetBlob(name.c_str(), blob);
-        req.SetBlob(name.c_str(), blob);
-    }
-    for (const auto &it : _networkOutputs) {
-        Blob::Ptr blob;
-        auto &name = it.first;
-        // this request is already in BUSY state, so using the internal functions safely
-        GetBlob(name.c_str(), blob);
-        req.SetBlob(name.c_str(), blob);
-    }
+        if (!BlobTransfer::IsSameMemory(blob, req.GetBlob(name)))
+            req.SetBlob(name.c_str(), blob);
+    };
+    for (const auto &it : _networkInputs)
+        setBlob(it.first);
+    for (const auto &it : _networkOutputs)
+        setBlob(it.first);
 }
 
 MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
@@ -78,7 +85,9 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         explicit ThisRequestExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
+            _this->ForwardPriority(*workerInferRequest);
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
@@ -104,6 +113,25 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
     };
 }
 
+void MultiDeviceAsyncInferRequest::ForwardPriority(MultiDeviceExecutableNetwork::WorkerInferRequest& workerInferRequest) {
+    const auto& taskPriority = GetTaskPriority();
+    if (taskPriority.IsDefault() && !workerInferRequest._hasPriority) {
+        return;
+    }
+    // the device request gets the rest of the latency budget of this request
+    int64_t deadlineUs = 0;
+    if (TaskPriority::Clock::time_point::max() != taskPriority._deadline) {
+        deadlineUs = std::max<int64_t>(1, std::chrono::duration_cast<std::chrono::microseconds>(
+            taskPriority._deadline - TaskPriority::Clock::now()).count());
+    }
+    try {
+        workerInferRequest._inferRequest.SetPriority(taskPriority._priority, deadlineUs);
+    } catch (const details::InferenceEngineException&) {
+        // the device does not support priorities, the requests are still ordered by the MULTI queue
+    }
+    workerInferRequest._hasPriority = !taskPriority.IsDefault();
+}
+
 void MultiDeviceAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
 }
@@ -128,7 +156,7 @@ struct IdleGuard {
     }
     ~IdleGuard() {
         if (nullptr != _notBusyWorkerRequests) {
-            _notBusyWorkerRequests->push(_workerInferRequestPtr);
+            _notBusyWorkerRequests->try_push(_workerInferRequestPtr);
         }
     }
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests* Release() {
@@ -143,12 +171,16 @@ struct IdleGuard {
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const DeviceMap<DeviceInformation>&                                  networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
-                                                           const bool                                                           needPerfCounters) :
+                                                           const bool                                                           needPerfCounters,
+                                                           const SchedulingPolicy                                               schedulingPolicy,
+                                                           const bool                                                           autoTuneRequests) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
     _devicePriorities{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _schedulingPolicy{schedulingPolicy},
+    _autoTuneRequests{autoTuneRequests} {
     _taskExecutor.reset();
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
@@ -164,26 +196,64 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
-            itNumRequests->second.numRequestsPerDevices == -1) ? optimalNum : itNumRequests->second.numRequestsPerDevices;
+        const bool explicitNumRequests = (_devicePriorities.end() != itNumRequests) &&
+            (itNumRequests->second.numRequestsPerDevices != -1);
+        const unsigned int numRequests = explicitNumRequests ? itNumRequests->second.numRequestsPerDevices : optimalNum;
+        // the tuned device creates all the requests it may need, the requests above the current number are parked
+        const unsigned int maxNumRequests = (_autoTuneRequests && !explicitNumRequests) ?
+            std::max(2 * numRequests, numRequests + 1) : numRequests;
         auto& workerRequests = _workerRequests[device];
-        auto& idleWorkerRequests = _idleWorkerRequests[device];
-        workerRequests.resize(numRequests);
+        auto& idleWorkerRequests = _idleWorkerRequests.emplace(std::piecewise_construct,
+                                                               std::forward_as_tuple(device),
+                                                               std::forward_as_tuple(maxNumRequests)).first->second;
+        auto* deviceStatisticsPtr = &(_deviceStatistics[device]);
+        auto* requestsTunerPtr = &(_requestsTuners.emplace(std::piecewise_construct,
+                                                           std::forward_as_tuple(device),
+                                                           std::forward_as_tuple(numRequests, maxNumRequests)).first->second);
+        auto& parkedWorkerRequests = _parkedWorkerRequests[device];
+        workerRequests.resize(maxNumRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+        unsigned int numIdleRequests = 0;
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
             auto* workerRequestPtr = &workerRequest;
-            idleWorkerRequests.push(workerRequestPtr);
+            if (numIdleRequests++ < numRequests) {
+                idleWorkerRequests.try_push(workerRequestPtr);
+            } else {
+                parkedWorkerRequests.push_back(workerRequestPtr);
+            }
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr, requestsTunerPtr]
+                (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    const auto finishTime = std::chrono::steady_clock::now();
+                    if (tracing::IsEnabled()) {
+                        tracing::AddAsyncEvent("device", device, reinterpret_cast<std::uintptr_t>(workerRequestPtr),
+                                               workerRequestPtr->_startTime, finishTime);
+                    }
+                    auto latency = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+                        finishTime - workerRequestPtr->_startTime);
+                    if (SchedulingPolicy::LATENCY == _schedulingPolicy) {
+                        deviceStatisticsPtr->UpdateLatency(latency.count());
+                        --deviceStatisticsPtr->_numRequestsInFlight;
+                    }
+                    auto numRequestsToAdd = requestsTunerPtr->Completed(latency.count(), finishTime);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
                     }
                     if (!_terminate) {
-                        idleGuard.Release()->push(workerRequestPtr);
+                        auto notBusyWorkerRequests = idleGuard.Release();
+                        if (requestsTunerPtr->TryPark()) {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            _parkedWorkerRequests[device].push_back(workerRequestPtr);
+                        } else {
+                            notBusyWorkerRequests->try_push(workerRequestPtr);
+                        }
+                        if (numRequestsToAdd > 0) {
+                            UnparkWorkerRequests(device, numRequestsToAdd);
+                        }
                         ScheduleToWorkerInferRequest();
                     }
                 });
@@ -191,34 +261,182 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     }
 }
 
+void MultiDeviceExecutableNetwork::DeviceStatistics::UpdateLatency(double latency) {
+    // exponential moving average, the first measurement initializes the average
+    constexpr double alpha = 0.125;
+    auto average = _averageLatency.load();
+    while (!_averageLatency.compare_exchange_weak(average, average == 0.0 ? latency : average + alpha * (latency - average))) {}
+}
+
+MultiDeviceExecutableNetwork::RequestsTuner::RequestsTuner(unsigned int numRequests, unsigned int maxNumRequests) :
+    _numRequests{numRequests},
+    _maxNumRequests{maxNumRequests},
+    _tuning{numRequests < maxNumRequests},
+    _bestNumRequests{numRequests} {
+}
+
+unsigned int MultiDeviceExecutableNetwork::RequestsTuner::Completed(double latency,
+                                                                    std::chrono::steady_clock::time_point finishTime) {
+    if (!_tuning) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_tuning) {
+        return 0;
+    }
+    // the first window starts with the first completed request, so the time before the first inference is not counted
+    if (std::chrono::steady_clock::time_point{} == _windowStart) {
+        _windowStart = finishTime;
+        return 0;
+    }
+    ++_numCompleted;
+    _latencySum += latency;
+
+    // every request completes several times in the window to smooth out the jitter
+    constexpr unsigned int completionsPerRequest = 16;
+    const unsigned int numRequests = _numRequests;
+    if (_numCompleted < completionsPerRequest * numRequests) {
+        return 0;
+    }
+    const auto seconds = std::chrono::duration<double>(finishTime - _windowStart).count();
+    const auto throughput = seconds > 0.0 ? _numCompleted / seconds : 0.0;
+    const auto averageLatency = _latencySum / _numCompleted;
+    const bool saturated = _saturated.exchange(false);
+    _windowStart = finishTime;
+    _numCompleted = 0;
+    _latencySum = 0.0;
+
+    // while there are idle requests the throughput is limited by the application and not by the device
+    if (!saturated) {
+        return 0;
+    }
+
+    constexpr double throughputGain = 1.05;
+    constexpr double latencyGrowth = 1.1;
+    if (throughput > _bestThroughput * throughputGain) {
+        _bestThroughput = throughput;
+        _bestLatency = averageLatency;
+        _bestNumRequests = numRequests;
+        if (numRequests < _maxNumRequests) {
+            _numRequests = numRequests + 1;
+            return 1;
+        }
+    } else if (averageLatency > _bestLatency * latencyGrowth && numRequests > _bestNumRequests) {
+        // the added requests only wait in the device queue
+        _numRequestsToPark += numRequests - _bestNumRequests;
+        _numRequests = _bestNumRequests;
+    }
+    _tuning = false;
+    return 0;
+}
+
+bool MultiDeviceExecutableNetwork::RequestsTuner::TryPark() {
+    auto numRequestsToPark = _numRequestsToPark.load();
+    while (numRequestsToPark > 0) {
+        if (_numRequestsToPark.compare_exchange_weak(numRequestsToPark, numRequestsToPark - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MultiDeviceExecutableNetwork::UnparkWorkerRequests(const DeviceName& device, unsigned int numRequests) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& parkedWorkerRequests = _parkedWorkerRequests[device];
+    auto& idleWorkerRequests = _idleWorkerRequests.at(device);
+    for (; numRequests > 0 && !parkedWorkerRequests.empty(); --numRequests) {
+        idleWorkerRequests.try_push(parkedWorkerRequests.back());
+        parkedWorkerRequests.pop_back();
+    }
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByExpectedLatency(const DeviceMap<DeviceInformation>& devices) {
+    DeviceName bestDevice;
+    auto bestCompletion = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        auto& statistics = _deviceStatistics[device.first];
+        auto numWorkerRequests = _requestsTuners.at(device.first).GetNumRequests();
+        if (0 == numWorkerRequests) {
+            continue;
+        }
+        // a new request waits for a share of the requests already queued to the device and then runs itself.
+        // Devices without measurements yet are estimated as immediate to collect the statistics
+        auto expectedCompletion = statistics._averageLatency.load() *
+            (1.0 + static_cast<double>(statistics._numRequestsInFlight.load()) / numWorkerRequests);
+        if (expectedCompletion < bestCompletion) {
+            bestCompletion = expectedCompletion;
+            bestDevice = device.first;
+        }
+    }
+    return bestDevice;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (SchedulingPolicy::LATENCY == _schedulingPolicy && !devices.empty()) {
+        // if the best device is busy the task stays in the queue until one of its requests completes
+        auto bestDevice = SelectDeviceByExpectedLatency(devices);
+        auto bestDeviceInformation = devices[bestDevice];
+        devices = {{bestDevice, bestDeviceInformation}};
+    }
     for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.first];
+        auto& idleWorkerRequests = _idleWorkerRequests.at(device.first);
         WorkerInferRequest* workerRequestPtr = nullptr;
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             Task inferPipelineTask;
-            if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
+            if (TryPopInferPipelineTask(inferPipelineTask)) {
                 _thisWorkerInferRequest = workerRequestPtr;
+                if (SchedulingPolicy::LATENCY == _schedulingPolicy) {
+                    ++_deviceStatistics[device.first]._numRequestsInFlight;
+                }
                 inferPipelineTask();
                 idleGuard.Release();
                 break;
             }
+        } else {
+            _requestsTuners.at(device.first).Saturated();
         }
     }
 }
 
+bool MultiDeviceExecutableNetwork::TryPopInferPipelineTask(Task& inferPipelineTask) {
+    // prioritized requests go before the default ones, and the requests with a negative priority after them
+    if (_priorityInferPipelineTasks.try_pop(inferPipelineTask, 0) ||
+        _inferPipelineTasks.try_pop(inferPipelineTask) ||
+        _priorityInferPipelineTasks.try_pop(inferPipelineTask)) {
+        _inferPipelineTasksCounters.Started();
+        return true;
+    }
+    return false;
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     if (!_terminate) {
+        _inferPipelineTasksCounters.Queued();
         _inferPipelineTasks.push(std::move(inferPipelineTask));
         ScheduleToWorkerInferRequest();
     }
 }
 
+void MultiDeviceExecutableNetwork::runWithPriority(Task inferPipelineTask, const TaskPriority& priority) {
+    if (!_terminate) {
+        _inferPipelineTasksCounters.Queued();
+        _priorityInferPipelineTasks.push(std::move(inferPipelineTask), priority);
+        ScheduleToWorkerInferRequest();
+    }
+}
+
+TaskExecutorStatistics MultiDeviceExecutableNetwork::GetStatistics() const {
+    // the requests wait in the queue for an idle worker request of a device
+    TaskExecutorStatistics statistics;
+    _inferPipelineTasksCounters.Fill(statistics);
+    return statistics;
+}
+
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -243,6 +461,7 @@ void MultiDeviceExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncR
                                                                              _needPerfCounters,
                                                                              std::static_pointer_cast<MultiDeviceExecutableNetwork>(shared_from_this()),
                                                                              _callbackExecutor);
+    asyncTreadSafeImpl->SetPipelineStatistics(_pipelineStatistics);
     asyncRequest.reset(new InferRequestBase<MultiDeviceAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
 }
@@ -295,6 +514,14 @@ void MultiDeviceExecutableNetwork::GetConfig(const std::string &name, InferenceE
 void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int res = 0u;
+        if (_autoTuneRequests) {
+            // the application should keep enough requests in flight to load the tuned devices
+            for (auto&& workerRequests : _workerRequests) {
+                res += static_cast<unsigned int>(workerRequests.second.size());
+            }
+            result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+            return;
+        }
         for (auto n : _networksPerDevice) {
             try {
                 res += n.second.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
@@ -306,6 +533,12 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
            }
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_REQUESTS)) {
+        std::map<std::string, unsigned int> numRequests;
+        for (auto&& requestsTuner : _requestsTuners) {
+            numRequests[requestsTuner.first] = requestsTuner.second.GetNumRequests();
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_REQUESTS, numRequests);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
         auto it = _networksPerDevice.begin();
         IE_ASSERT(it != _networksPerDevice.end());
@@ -316,10 +549,22 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(LOAD_TIME_PHASES),
+            METRIC_KEY(LOAD_PEAK_MEMORY),
+            METRIC_KEY(EXECUTOR_STATISTICS),
+            METRIC_KEY(MULTI_DEVICE_REQUESTS)
         });
+    } else if (name == METRIC_KEY(LOAD_TIME_PHASES)) {
+        result = IE_SET_METRIC(LOAD_TIME_PHASES, _loadTimeProfile ? _loadTimeProfile->GetPhases() : LoadTimeProfile::Phases{});
+    } else if (name == METRIC_KEY(LOAD_PEAK_MEMORY)) {
+        result = IE_SET_METRIC(LOAD_PEAK_MEMORY, _loadTimeProfile ? _loadTimeProfile->GetPeakMemory() : 0);
+    } else if (name == METRIC_KEY(EXECUTOR_STATISTICS)) {
+        result = IE_SET_METRIC(EXECUTOR_STATISTICS, GetExecutorStatistics(this));
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -414,6 +659,12 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string(MULTI_CONFIG_VALUE(PRIORITY)) : it->second };
+    } else if (name == MULTI_CONFIG_KEY(REQUESTS_AUTO_TUNING)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(REQUESTS_AUTO_TUNING));
+        return { it == _config.end() ? std::string(PluginConfigParams::NO) : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -456,7 +707,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
         std::string name = { "MULTI" };
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
@@ -481,15 +734,48 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
 
-    DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
+    // the devices compile the network in parallel, so the load takes as long as the slowest device and not the sum.
+    // The load of every device is a phase of the load profile named after the device
+    std::vector<std::pair<DeviceName, std::shared_ptr<ICNNNetwork>>> loads;
     for (auto& p : metaDevices) {
         auto & deviceName = p.first;
-        auto & metaDevice = p.second;
-        auto & deviceConfig = metaDevice.config;
-        auto clonedNetwork = cloneNetwork(network);
-        executableNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(CNNNetwork{clonedNetwork}, deviceName, deviceConfig) });
+        auto & deviceConfig = p.second.config;
+        loads.emplace_back(deviceName, cloneNetwork(network));
         multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
     }
+    std::vector<ExecutableNetwork> loadedNetworks(loads.size());
+    std::vector<std::exception_ptr> loadErrors(loads.size());
+    auto profile = LoadTimeProfile::GetCurrent();
+    auto phase = LoadTimeProfile::GetCurrentPhase();
+    auto load = [&] (size_t i) {
+        try {
+            LoadTimeProfile::Scope profileScope(profile, phase);
+            IE_LOAD_PHASE(loads[i].first.c_str());
+            loadedNetworks[i] = GetCore()->LoadNetwork(CNNNetwork{loads[i].second}, loads[i].first,
+                                                       metaDevices.at(loads[i].first).config);
+        } catch (...) {
+            loadErrors[i] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> loadThreads;
+    for (size_t i = 1; i < loads.size(); ++i) {
+        loadThreads.emplace_back(load, i);
+    }
+    if (!loads.empty()) {
+        load(0);
+    }
+    for (auto&& thread : loadThreads) {
+        thread.join();
+    }
+    for (auto&& error : loadErrors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
+    for (size_t i = 0; i < loads.size(); ++i) {
+        executableNetworkPerDevice.insert({ loads[i].first, loadedNetworks[i] });
+    }
     if (executableNetworkPerDevice.empty())
         THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to load Executable network to any device "
                                             <<  "that the MULTI device is initialized to work with";
@@ -497,10 +783,39 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
     bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
 
+    auto schedulingPolicy = MultiDeviceExecutableNetwork::SchedulingPolicy::PRIORITY;
+    auto policyConfig = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (fullConfig.end() != policyConfig) {
+        if (policyConfig->second == MultiDeviceConfigParams::MULTI_LATENCY) {
+            schedulingPolicy = MultiDeviceExecutableNetwork::SchedulingPolicy::LATENCY;
+        } else if (policyConfig->second != MultiDeviceConfigParams::MULTI_PRIORITY) {
+            THROW_IE_EXCEPTION << "Wrong value " << policyConfig->second << " for property key "
+                               << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY
+                               << ". Expected only " << MultiDeviceConfigParams::MULTI_PRIORITY
+                               << " or " << MultiDeviceConfigParams::MULTI_LATENCY;
+        }
+        multiNetworkConfig.insert(*policyConfig);
+    }
+
+    bool autoTuneRequests = false;
+    auto autoTuningConfig = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING);
+    if (fullConfig.end() != autoTuningConfig) {
+        if (autoTuningConfig->second == PluginConfigParams::YES) {
+            autoTuneRequests = true;
+        } else if (autoTuningConfig->second != PluginConfigParams::NO) {
+            THROW_IE_EXCEPTION << "Wrong value " << autoTuningConfig->second << " for property key "
+                               << MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING
+                               << ". Expected only " << PluginConfigParams::YES << " or " << PluginConfigParams::NO;
+        }
+        multiNetworkConfig.insert(*autoTuningConfig);
+    }
+
     return std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
                                                           metaDevices,
                                                           multiNetworkConfig,
-                                                          enablePerfCounters);
+                                                          enablePerfCounters,
+                                                          schedulingPolicy,
+                                                          autoTuneRequests);
 }
 
 void MultiDeviceInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -21,6 +22,9 @@
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include <ie_parallel.hpp>
+#include <threading/ie_mpmc_queue.hpp>
+#include <threading/ie_priority_task_queue.hpp>
+#include <threading/ie_task_queue_counters.hpp>
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 #include <tbb/concurrent_queue.h>
@@ -57,33 +61,48 @@ public:
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
 #else
+/**
+ * @brief Unbounded queue on top of the lock-free BoundedMPMCQueue.
+ *        Values which do not fit into the lock-free part go to the overflow queue guarded by the mutex
+ */
 template <typename T>
 class ThreadSafeQueue {
 public:
     void push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
+        // the value is moved from only if the lock-free queue accepted it
+        if (!_queue.try_push(std::move(value))) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _overflowQueue.push(std::move(value));
+            ++_overflowSize;
+        }
     }
 
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
+        if (_queue.try_pop(value)) {
             return true;
-        } else {
-            return false;
         }
+        if (_overflowSize.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_overflowQueue.empty()) {
+                value = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                --_overflowSize;
+                return true;
+            }
+        }
+        return false;
     }
 
     bool empty() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.empty();
+        return _queue.empty() && (0 == _overflowSize.load());
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
+    static constexpr std::size_t lockFreeCapacity = 256;
+    InferenceEngine::BoundedMPMCQueue<T>    _queue{lockFreeCapacity};
+    std::queue<T>                           _overflowQueue;
+    std::atomic<int>                        _overflowSize = {0};
+    std::mutex                              _mutex;
 };
 #endif
 
@@ -92,27 +111,84 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
     struct WorkerInferRequest {
-        InferenceEngine::InferRequest   _inferRequest;
-        Task                            _task;
-        InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        InferenceEngine::InferRequest                       _inferRequest;
+        Task                                                _task;
+        InferenceEngine::StatusCode                         _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point               _startTime;
+        bool                                                _hasPriority = false;
+    };
+    // the queue capacity is the number of the device worker requests, so pushing of an idle request always succeeds
+    using NotBusyWorkerRequests = BoundedMPMCQueue<WorkerInferRequest*>;
+    /**
+     * @brief Per-device inference statistics used by the latency-aware scheduling policy
+     */
+    struct DeviceStatistics {
+        std::atomic<double> _averageLatency = {0.0};  //!< Moving average of the inference latency, in microseconds
+        std::atomic<int>    _numRequestsInFlight = {0};
+        void UpdateLatency(double latency);
+    };
+    /**
+     * @brief Tunes the number of the worker requests of a device: a request is added while the throughput grows,
+     *        and the tuning stops when one more request only increases the latency
+     */
+    class RequestsTuner {
+    public:
+        RequestsTuner(unsigned int numRequests, unsigned int maxNumRequests);
+        // Accounts a completed request, returns the number of the requests to add to the device
+        unsigned int Completed(double latency, std::chrono::steady_clock::time_point finishTime);
+        // Returns true if the completed request should not be used anymore
+        bool TryPark();
+        void Saturated() {
+            _saturated = true;
+        }
+        unsigned int GetNumRequests() const {
+            return _numRequests;
+        }
+
+    private:
+        std::mutex                                  _mutex;
+        std::atomic<unsigned int>                   _numRequests;
+        std::atomic<unsigned int>                   _numRequestsToPark = {0};
+        const unsigned int                          _maxNumRequests;
+        std::atomic_bool                            _tuning;
+        std::atomic_bool                            _saturated = {false};
+        unsigned int                                _numCompleted = 0;
+        double                                      _latencySum = 0.0;
+        std::chrono::steady_clock::time_point       _windowStart;
+        double                                      _bestThroughput = 0.0;
+        double                                      _bestLatency = 0.0;
+        unsigned int                                _bestNumRequests = 0;
+    };
+    enum class SchedulingPolicy {
+        PRIORITY,
+        LATENCY
     };
-    using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const DeviceMap<DeviceInformation>&                                        networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
-                                          const bool                                                            needPerfCounters = false);
+                                          const bool                                                            needPerfCounters = false,
+                                          const SchedulingPolicy                                                schedulingPolicy =
+                                                                                                                    SchedulingPolicy::PRIORITY,
+                                          const bool                                                            autoTuneRequests = false);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config, InferenceEngine::ResponseDesc *resp) override;
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
     void run(Task inferTask) override;
+    void runWithPriority(Task inferTask, const TaskPriority& priority) override;
+    TaskExecutorStatistics GetStatistics() const override;
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
     InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest();
+    bool TryPopInferPipelineTask(Task& inferPipelineTask);
+    // Returns the device with the earliest expected completion of a new request
+    DeviceName SelectDeviceByExpectedLatency(const DeviceMap<DeviceInformation>& devices);
+    // Makes the parked worker requests of the device available for the scheduling
+    void UnparkWorkerRequests(const DeviceName& device, unsigned int numRequests);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
@@ -120,10 +196,17 @@ public:
     DeviceMap<DeviceInformation>                                _devicePriorities;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<Task>                                       _inferPipelineTasks;
+    PriorityTaskQueue                                           _priorityInferPipelineTasks;
+    TaskQueueCounters                                           _inferPipelineTasksCounters;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    DeviceMap<RequestsTuner>                                    _requestsTuners;
+    DeviceMap<std::vector<WorkerInferRequest*>>                 _parkedWorkerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::PRIORITY;
+    bool                                                        _autoTuneRequests = false;
 };
 
 class MultiDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -137,6 +220,8 @@ public:
     void Infer_ThreadUnsafe() override;
     void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &_perfMap) const override;
     ~MultiDeviceAsyncInferRequest() override;
+    // Passes the priority and the rest of the deadline of this request to the device request
+    void ForwardPriority(MultiDeviceExecutableNetwork::WorkerInferRequest& workerInferRequest);
 
 protected:
     MultiDeviceExecutableNetwork::Ptr                                   _multiDeviceExecutableNetwork;
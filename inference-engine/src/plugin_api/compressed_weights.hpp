@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with the compressed weights format helpers
+ * @file compressed_weights.hpp
+ */
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+
+#include <cstddef>
+#include <ostream>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Checks whether the memory starts with the header of the compressed weights format
+ *
+ * The weights are split into chunks of the same size which are compressed independently, so they are
+ * decompressed in parallel. A chunk index after the header keeps the offset and the size of every chunk.
+ * @param data A pointer to the memory
+ * @param size A size of the memory in bytes
+ * @return `true` if the memory holds compressed weights
+ */
+INFERENCE_ENGINE_API_CPP(bool) isCompressedWeights(const void* data, size_t size) noexcept;
+
+/**
+ * @brief Decompresses the weights, the chunks are decompressed in parallel
+ * @param data A pointer to the compressed weights
+ * @param size A size of the compressed weights in bytes
+ * @return A U8 blob with the original weights
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) decompressWeights(const void* data, size_t size);
+
+/**
+ * @brief Writes the weights in the compressed format, the chunks are compressed in parallel
+ *
+ * The bytes of every chunk are shuffled by the element size which compresses it best, so the similar
+ * bytes of FP32 and FP16 values follow each other. Chunks which do not compress are stored as they are.
+ * @param data A pointer to the weights, e.g. the content of an IR .bin file
+ * @param size A size of the weights in bytes
+ * @param stream A stream to write the compressed weights to
+ * @param chunkSize A size of the chunks in bytes
+ */
+INFERENCE_ENGINE_API_CPP(void) compressWeights(const void* data, size_t size, std::ostream& stream,
+                                               size_t chunkSize = 1 << 20);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -106,6 +106,11 @@ public:
         TO_STATUS(_impl->GetContext(pContext, resp));
     }
 
+    StatusCode InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs,
+                          ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->InferBatch(inputs, outputs));
+    }
+
 private:
     ~ExecutableNetworkBase() = default;
 };
@@ -87,6 +87,18 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(int priority, int64_t deadline_us, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority, deadline_us));
+    }
+
+    StatusCode SetStateSession(int64_t session_id, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetStateSession(session_id));
+    }
+
+    StatusCode ReleaseStateSession(int64_t session_id, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->ReleaseStateSession(session_id));
+    }
+
 private:
     ~InferRequestBase() = default;
 };
@@ -10,12 +10,16 @@
 #include <string>
 #include <vector>
 
+#include "blob_factory.hpp"
+#include "cpp/ie_infer_request.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "ie_load_time_profile.hpp"
+#include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
 
@@ -90,6 +94,14 @@ public:
         _plugin = plugin;
     }
 
+    /**
+     * @brief      Sets the profile of the network load, reported with the LOAD_TIME_PHASES metric.
+     * @param[in]  profile  The profile
+     */
+    void SetLoadTimeProfile(const LoadTimeProfile::Ptr& profile) {
+        _loadTimeProfile = profile;
+    }
+
     std::vector<IMemoryStateInternal::Ptr> QueryState() override {
         // meaning base plugin reports as no state available - plugin owners need to create proper override of this
         return {};
@@ -115,7 +127,68 @@ public:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    /**
+     * @brief Infers the sets in rounds on the OPTIMAL_NUMBER_OF_INFER_REQUESTS asynchronous requests created by
+     * the call, so every set goes through the asynchronous pipeline of the plugin.
+     * @note Plugins override it to infer the sets with a lower overhead, e.g. with
+     * ExecutableNetworkThreadSafeDefault::InferBatchOnTaskExecutor
+     * @param inputs The input blobs of each set
+     * @param outputs The output blobs of each set, the missing ones are allocated
+     */
+    void InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs) override {
+        outputs.resize(inputs.size());
+        unsigned int requestsNumber = 1;
+        try {
+            Parameter optimal;
+            GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), optimal, nullptr);
+            requestsNumber = std::max(1u, optimal.as<unsigned int>());
+        } catch (...) {
+            // the metric is optional, one request infers all the sets then
+        }
+        std::vector<InferRequest> requests;
+        for (size_t i = 0; i < std::min<size_t>(requestsNumber, inputs.size()); i++) {
+            IInferRequest::Ptr request;
+            CreateInferRequest(request);
+            requests.emplace_back(request);
+        }
+        for (size_t first = 0; first < inputs.size(); first += requests.size()) {
+            auto count = std::min(requests.size(), inputs.size() - first);
+            for (size_t i = 0; i < count; i++) {
+                SetBatchSetBlobs(requests[i], inputs[first + i], outputs[first + i]);
+                requests[i].StartAsync();
+            }
+            for (size_t i = 0; i < count; i++) {
+                requests[i].Wait(IInferRequest::WaitMode::RESULT_READY);
+            }
+        }
+    }
+
 protected:
+    /**
+     * @brief Passes the blobs of an input set of InferBatch to a request, allocates the missing output blobs of the set
+     * @param request A synchronous or an asynchronous request
+     * @param inputs The input blobs of the set, must contain all the network inputs
+     * @param outputs The output blobs of the set
+     */
+    template <typename Request>
+    void SetBatchSetBlobs(Request& request, const BlobMap& inputs, BlobMap& outputs) const {
+        for (auto&& input : _networkInputs) {
+            auto blob = inputs.find(input.first);
+            if (blob == inputs.end()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Input blob " << input.first << " is missing in an input set";
+            }
+            request.SetBlob(input.first.c_str(), blob->second);
+        }
+        for (auto&& output : _networkOutputs) {
+            auto& blob = outputs[output.first];
+            if (blob == nullptr) {
+                blob = make_blob_with_precision(output.second->getTensorDesc());
+                blob->allocate();
+            }
+            request.SetBlob(output.first.c_str(), blob);
+        }
+    }
+
     /**
      * @brief Exports an internal hardware-dependent model to a stream.
      * @note The function is called from ExecutableNetworkInternal::Export(std::ostream&),
@@ -135,6 +208,11 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     IInferencePluginInternal::Ptr _plugin;
+
+    /**
+     * @brief A profile of the network load, set by InferencePluginInternal
+     */
+    LoadTimeProfile::Ptr _loadTimeProfile;
 };
 
 }  // namespace InferenceEngine
@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -55,6 +61,8 @@ public:
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
         auto asyncTreadSafeImpl =
             std::make_shared<AsyncInferRequestThreadSafeDefault>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+        asyncTreadSafeImpl->SetPipelineStatistics(_pipelineStatistics);
+        asyncTreadSafeImpl->SetAdmissionControl(_admissionControl);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
                            [](IInferRequest* p) {
                                p->Release();
@@ -71,6 +79,62 @@ public:
     }
 
 protected:
+    /**
+     * @brief Infers the sets of InferBatch on synchronous requests, one task of the task executor per request.
+     * The tasks take the sets one after another, so a set costs neither an asynchronous pipeline nor a callback.
+     * The requests are created by the call: they own the executable network, so it can not keep them.
+     * @note Is used by the plugins which infer the synchronous requests on the task executor threads, as the default
+     * asynchronous pipeline does. Must not be called from a thread of the task executor
+     * @param inputs The input blobs of each set
+     * @param outputs The output blobs of each set, the missing ones are allocated
+     * @param requestsNumber The maximal number of the sets inferred in parallel, e.g. the number of streams
+     */
+    void InferBatchOnTaskExecutor(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs,
+                                  size_t requestsNumber) {
+        outputs.resize(inputs.size());
+        std::vector<InferRequestInternal::Ptr> requests;
+        for (size_t i = 0; i < std::min(std::max<size_t>(requestsNumber, 1), inputs.size()); i++) {
+            requests.push_back(CreateInferRequestImpl(_networkInputs, _networkOutputs));
+            requests.back()->setPointerToExecutableNetworkInternal(shared_from_this());
+        }
+
+        std::atomic<size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t running = requests.size();
+        std::exception_ptr error;
+        for (auto&& request : requests) {
+            auto syncRequest = request.get();
+            _taskExecutor->run([&, syncRequest] {
+                std::exception_ptr taskError;
+                try {
+                    for (auto i = next++; i < inputs.size(); i = next++) {
+                        SetBatchSetBlobs(*syncRequest, inputs[i], outputs[i]);
+                        syncRequest->Infer();
+                    }
+                } catch (...) {
+                    taskError = std::current_exception();
+                    next = inputs.size();
+                }
+                // notified under the lock, the waiting thread destroys the condition variable right after the wait
+                std::lock_guard<std::mutex> lock{mutex};
+                if (taskError && !error) {
+                    error = taskError;
+                }
+                if (--running == 0) {
+                    finished.notify_one();
+                }
+            });
+        }
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            finished.wait(lock, [&] { return running == 0; });
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
     /**
      * @brief Create a synchronous inference request object used to infer the network
      * @note Used by ExecutableNetworkThreadSafeDefault::CreateInferRequest as a plugin-specific implementation
@@ -81,8 +145,49 @@ protected:
     virtual InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
                                                              OutputsDataMap networkOutputs) = 0;
 
+    /**
+     * @brief Returns the counters of the task executor and of the pipelines of the requests for the
+     *        EXECUTOR_STATISTICS metric
+     * @param executor The executor of the requests if it is not the task executor of the network
+     * @return The counters by their names, the times are in microseconds
+     */
+    std::map<std::string, std::uint64_t> GetExecutorStatistics(const ITaskExecutor* executor = nullptr) const {
+        std::map<std::string, std::uint64_t> counters;
+        if (nullptr == executor) {
+            executor = _taskExecutor.get();
+        }
+        if (nullptr != executor) {
+            const auto statistics = executor->GetStatistics();
+            counters["queued_tasks"] = statistics._queuedTasks;
+            counters["started_tasks"] = statistics._startedTasks;
+            counters["queue_depth"] = statistics._queueDepth;
+            counters["wait_time_us"] = statistics._waitTime;
+            counters["stolen_tasks"] = statistics._stolenTasks;
+            for (std::size_t i = 0; i < statistics._busyTime.size(); ++i) {
+                counters["stream_" + std::to_string(i) + "_busy_time_us"] = statistics._busyTime[i];
+            }
+            for (std::size_t i = 0; i < statistics._idleTime.size(); ++i) {
+                counters["stream_" + std::to_string(i) + "_idle_time_us"] = statistics._idleTime[i];
+            }
+        }
+        if (nullptr != _pipelineStatistics) {
+            for (std::size_t i = 0; i < _pipelineStatistics->GetStages(); ++i) {
+                counters["stage_" + std::to_string(i) + "_runs"] = _pipelineStatistics->GetRuns(i);
+                counters["stage_" + std::to_string(i) + "_wait_time_us"] = _pipelineStatistics->GetWaitTime(i);
+            }
+        }
+        if (nullptr != _admissionControl) {
+            for (auto&& counter : _admissionControl->GetStatistics()) {
+                counters.insert(counter);
+            }
+        }
+        return counters;
+    }
+
     ITaskExecutor::Ptr _taskExecutor = nullptr;  //!< Holds a task executor
     ITaskExecutor::Ptr _callbackExecutor = nullptr;  //!< Holds a callback executor
+    PipelineStatistics::Ptr _pipelineStatistics = std::make_shared<PipelineStatistics>();  //!< Counters of the pipelines of the requests
+    AdmissionControl::Ptr _admissionControl = nullptr;  //!< Limits the started inferences of the requests, `nullptr` if they are not limited
 };
 
 }  // namespace InferenceEngine
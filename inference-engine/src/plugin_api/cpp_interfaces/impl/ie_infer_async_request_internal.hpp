@@ -45,6 +45,10 @@ public:
         _userData = data;
     }
 
+    void SetPriority(int, int64_t) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The device does not support priorities of infer requests";
+    }
+
     /**
      * @brief Set weak pointer to the corresponding public interface: IInferRequest. This allow to pass it to
      * IInferRequest::CompletionCallback
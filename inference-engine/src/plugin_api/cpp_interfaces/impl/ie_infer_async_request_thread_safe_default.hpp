@@ -6,14 +6,20 @@
 
 #include <threading/ie_immediate_executor.hpp>
 #include <threading/ie_itask_executor.hpp>
+#include <threading/ie_task_queue_counters.hpp>
 
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_internal.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ie_tracing.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,6 +30,159 @@
 
 namespace InferenceEngine {
 
+/**
+ * @ingroup ie_dev_api_async_infer_request_api
+ * @brief Counters of the time the stages of the pipelines wait for their executors.
+ *        They are shared by the requests of an executable network, see AsyncInferRequestThreadSafeDefault::SetPipelineStatistics
+ */
+class PipelineStatistics {
+public:
+    /**
+     * @brief A shared pointer to PipelineStatistics
+     */
+    using Ptr = std::shared_ptr<PipelineStatistics>;
+
+    /**
+     * @brief The number of counted stages, the later stages are counted as the last one
+     */
+    static constexpr std::size_t maxStages = 8;
+
+    /**
+     * @brief Counts a started stage
+     * @param stage The index of the stage in the pipeline
+     * @param waitTime The time the stage waited for its executor, in microseconds
+     */
+    void StageStarted(std::size_t stage, std::uint64_t waitTime) {
+        const auto index = std::min(stage, maxStages - 1);
+        _runs[index].fetch_add(1, std::memory_order_relaxed);
+        _waitTimes[index].fetch_add(waitTime, std::memory_order_relaxed);
+        auto stages = _stages.load(std::memory_order_relaxed);
+        while (stages <= index && !_stages.compare_exchange_weak(stages, index + 1, std::memory_order_relaxed)) {}
+    }
+
+    /**
+     * @brief Returns the number of the stages which ever started
+     * @return The number of stages
+     */
+    std::size_t GetStages() const {
+        return _stages.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of runs of a stage
+     * @param stage The index of the stage
+     * @return The number of runs
+     */
+    std::uint64_t GetRuns(std::size_t stage) const {
+        return _runs[std::min(stage, maxStages - 1)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the time the runs of a stage waited for its executor
+     * @param stage The index of the stage
+     * @return The time in microseconds
+     */
+    std::uint64_t GetWaitTime(std::size_t stage) const {
+        return _waitTimes[std::min(stage, maxStages - 1)].load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> _runs[maxStages] {};
+    std::atomic<std::uint64_t> _waitTimes[maxStages] {};
+    std::atomic<std::size_t> _stages{0};
+};
+
+/**
+ * @ingroup ie_dev_api_async_infer_request_api
+ * @brief Limits the number of the inferences of an executable network which are started and not completed yet,
+ *        so the bursts of the requests do not pile up in the queues of the executors.
+ *        It is shared by the requests of the network, see AsyncInferRequestThreadSafeDefault::SetAdmissionControl
+ */
+class AdmissionControl {
+public:
+    /**
+     * @brief A shared pointer to AdmissionControl
+     */
+    using Ptr = std::shared_ptr<AdmissionControl>;
+
+    /**
+     * @brief Defines what happens to an inference over the limit
+     */
+    enum class Policy : std::uint8_t {
+        Reject,  //!< The start of the inference throws REQUEST_BUSY
+        Block    //!< The start of the inference waits for another inference to complete
+    };
+
+    /**
+     * @brief Constructs the admission control
+     * @param capacity The maximal number of the inferences started and not completed yet
+     * @param policy The policy of the inferences over the limit
+     */
+    AdmissionControl(std::size_t capacity, Policy policy) : _capacity(std::max<std::size_t>(1, capacity)),
+                                                            _policy(policy) {}
+
+    /**
+     * @brief Admits an inference or throws REQUEST_BUSY exception if it is rejected
+     * @note Blocks with the Policy::Block, so it must not be called by the threads which complete the inferences
+     */
+    void Admit() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_pending >= _capacity) {
+            if (Policy::Reject == _policy) {
+                ++_rejected;
+                THROW_IE_EXCEPTION << REQUEST_BUSY_str << "The number of the started inferences reached the limit of "
+                                   << _capacity;
+            }
+            ++_blocked;
+            const auto blocked = TaskQueueCounters::Now();
+            _released.wait(lock, [&] {
+                return _pending < _capacity;
+            });
+            _blockTime += TaskQueueCounters::Now() - blocked;
+        }
+        ++_pending;
+        ++_admitted;
+    }
+
+    /**
+     * @brief Releases a place of a completed inference
+     */
+    void Release() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_pending;
+        }
+        _released.notify_one();
+    }
+
+    /**
+     * @brief Returns the counters of the admission: "admitted_requests", "rejected_requests", "blocked_requests",
+     *        "admission_wait_time_us" and "pending_requests"
+     * @return The counters by their names, the time is in microseconds
+     */
+    std::map<std::string, std::uint64_t> GetStatistics() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return {
+            {"admitted_requests", _admitted},
+            {"rejected_requests", _rejected},
+            {"blocked_requests", _blocked},
+            {"admission_wait_time_us", _blockTime},
+            {"pending_requests", _pending},
+        };
+    }
+
+private:
+    const std::size_t _capacity;
+    const Policy _policy;
+    mutable std::mutex _mutex;
+    std::condition_variable _released;
+    std::size_t _pending = 0;
+    std::uint64_t _admitted = 0;
+    std::uint64_t _rejected = 0;
+    std::uint64_t _blocked = 0;
+    std::uint64_t _blockTime = 0;
+};
+
 /**
  * @ingroup ie_dev_api_async_infer_request_api
  * @brief Base class with default implementation of asynchronous multi staged inference request.
@@ -33,6 +192,9 @@ namespace InferenceEngine {
  *        The class is recommended to be used by plugins as a base class for asynchronous inference request implementation.
  * @note  To synchronize derived context with stages
  *        derived class should call AsyncInferRequestThreadSafeDefault::StopAndWait() function in destructor.
+ * @note  The request keeps the progress of the running pipeline in its members and passes the executors the same
+ *        preallocated tasks capturing only `this`, so the stages are chained without heap allocations. The completion
+ *        of the pipeline is reported through a condition variable of the request reused by all the inferences.
  * @par Example
  *        Here is an example of asynchronous inference request implementation for some accelerator device.
  *        It uses 5 different executors to run different stages of a synchronous inference request.
@@ -41,8 +203,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInternal {
     using AtomicCallback = std::atomic<IInferRequest::CompletionCallback>;
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     struct DisableCallbackGuard{
         explicit DisableCallbackGuard(AtomicCallback& callback)
@@ -98,37 +258,34 @@ public:
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
                                << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock {_mutex};
-            return _futures.empty() ? std::shared_future<void> {} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        std::unique_lock<std::mutex> lock {_mutex};
+        if (0 == _startedRuns) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
+        // waits for the last started pipeline
+        const auto run = _startedRuns;
+        auto finished = [&] {
+            return _finishedRun >= run;
+        };
         switch (millis_timeout) {
         case IInferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
+            _runFinished.wait(lock, finished);
         } break;
         case IInferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds {0});
         } break;
         default: {
-            status = future.wait_for(std::chrono::milliseconds {millis_timeout});
+            _runFinished.wait_for(lock, std::chrono::milliseconds {millis_timeout}, finished);
         } break;
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
+        if (!finished()) {
             return StatusCode::RESULT_NOT_READY;
         }
+        if (nullptr != _runException) {
+            std::rethrow_exception(_runException);
+        }
+        return StatusCode::OK;
     }
 
     /**
@@ -140,6 +297,24 @@ public:
         _publicInterface = std::shared_ptr<IInferRequest>(ptr.get(), [](IInferRequest*) {});
     }
 
+    /**
+     * @brief Sets the counters of the time the stages of the request wait for their executors.
+     *        Must be called before the request is started
+     * @param statistics The counters shared by the requests of the network, `nullptr` disables the counting
+     */
+    void SetPipelineStatistics(const PipelineStatistics::Ptr& statistics) {
+        _pipelineStatistics = statistics;
+    }
+
+    /**
+     * @brief Sets the limit of the inferences of the network which are started and not completed yet.
+     *        Must be called before the request is started
+     * @param admissionControl The limit shared by the requests of the network, `nullptr` disables it
+     */
+    void SetAdmissionControl(const AdmissionControl::Ptr& admissionControl) {
+        _admissionControl = admissionControl;
+    }
+
 protected:
     /**
      * @brief Each pipeline stage is a @ref Task that is executed by specified ITaskExecutor implementation
@@ -151,44 +326,48 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Runs the first stage of the pipeline if StopAndWait was not called. The request is busy until
+     * the last stage or the stage which raised an exception is finished, Wait() waits for this moment
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Final or error stage executor
+     * @param[in]  callbackExecutor Final or error stage executor, the final stage is run by the last stage if it is empty
      */
     void RunFirstStage(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage,
-                       const ITaskExecutor::Ptr callbackExecutor = {}) {
-        _promise = {};
-        bool stop = [&] {
+                       const ITaskExecutor::Ptr& callbackExecutor = {}) {
+        // the rejected inference does not change the state of the request
+        if (nullptr != _admissionControl) {
+            _admissionControl->Admit();
+        }
+        std::uint64_t run = 0;
+        {
             std::lock_guard<std::mutex> lock(_mutex);
-            if (!_stop) {
-                _futures.erase(std::remove_if(std::begin(_futures), std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds {0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-
-                _futures.emplace_back(_promise.get_future().share());
+            if (_stop) {
+                ReleaseAdmission();
+                return;
             }
-            return _stop;
-        }();
+            run = ++_startedRuns;
+            ++_runningPipelines;
+        }
 
-        if (!stop) {
-            try {
-                auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
-                IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                throw;
+        try {
+            if (tracing::IsEnabled()) {
+                _inferStart = tracing::Clock::now();
             }
+            // all the stages of the inference are scheduled with the deadline of its start
+            _taskPriority._deadline = 0 == _deadline.count() ? TaskPriority::Clock::time_point::max() :
+                                                               TaskPriority::Clock::now() + _deadline;
+            _run = run;
+            _itStage = itBeginStage;
+            _itEndStage = itEndStage;
+            _stageIndex = 0;
+            _runCallbackExecutor = callbackExecutor.get();
+            auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
+            IE_ASSERT(nullptr != firstStageExecutor);
+            RunStage(*firstStageExecutor, _stageTask);
+        } catch (...) {
+            ReleaseAdmission();
+            CompleteRun(run, std::current_exception());
+            throw;
         }
     }
 
@@ -200,14 +379,12 @@ protected:
     void StopAndWait() {
         _callback = nullptr;
         {
-            std::lock_guard<std::mutex> lock(_mutex);
+            std::unique_lock<std::mutex> lock(_mutex);
             if (!_stop) {
                 _stop = true;
-                for (auto&& future : _futures) {
-                    if (future.valid()) {
-                        future.wait();
-                    }
-                }
+                _runFinished.wait(lock, [&] {
+                    return 0 == _runningPipelines;
+                });
             }
         }
     }
@@ -283,82 +460,177 @@ protected:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetStateSession_ThreadUnsafe(int64_t sessionId) override {
+        _syncRequest->SetStateSession(sessionId);
+    }
+
+    void ReleaseStateSession_ThreadUnsafe(int64_t sessionId) override {
+        _syncRequest->ReleaseStateSession(sessionId);
+    }
+
+    void SetPriority_ThreadUnsafe(int priority, int64_t deadlineUs) override {
+        if (deadlineUs < 0) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Deadline of infer request can't be negative";
+        }
+        _taskPriority._priority = priority;
+        _deadline = std::chrono::microseconds{deadlineUs};
+    }
+
+    /**
+     * @brief Returns the scheduling hints of the current inference
+     * @return The priority and the deadline of the inference
+     */
+    const TaskPriority& GetTaskPriority() const {
+        return _taskPriority;
+    }
+
 private:
+    // the tasks of requests without hints take the usual path of the executor
+    void RunStage(ITaskExecutor& executor, const Task& task) {
+        if (nullptr != _pipelineStatistics) {
+            _stageQueued = TaskQueueCounters::Now();
+        }
+        if (tracing::IsEnabled()) {
+            // the time the stage waits for its executor is a part of the timeline as well
+            _stageScheduled = tracing::Clock::now();
+        }
+        if (_taskPriority.IsDefault()) {
+            executor.run(task);
+        } else {
+            executor.runWithPriority(task, _taskPriority);
+        }
+    }
+
+    void ReleaseAdmission() {
+        if (nullptr != _admissionControl) {
+            _admissionControl->Release();
+        }
+    }
+
+    std::string GetTraceArgs() const {
+        return "{\"request\":" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "}";
+    }
+
     /**
-     * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
-     * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
-     * @return A next stage task
+     * @brief Runs the current stage of the pipeline and schedules the next one.
+     * After the last stage or if the exception is raised from a `_pipeline` task the final stage is called
+     * or passed to the callback executor if it is presented.
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-            StatusCode requestStatus = StatusCode::OK;
-            std::exception_ptr localCurrentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
+    void RunCurrentStage() {
+        StatusCode requestStatus = StatusCode::OK;
+        std::exception_ptr localCurrentException = nullptr;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*_itStage);
+            IE_ASSERT(nullptr != stageTask);
+            if (nullptr != _pipelineStatistics) {
+                _pipelineStatistics->StageStarted(_stageIndex, TaskQueueCounters::Now() - _stageQueued);
+            }
+            if (tracing::IsEnabled() && _stageScheduled != tracing::TimePoint{}) {
+                const auto stageName = "stage " + std::to_string(_stageIndex);
+                const auto started = tracing::Clock::now();
+                stageTask();
+                tracing::AddEvent("stage", stageName + " wait", _stageScheduled, started, GetTraceArgs());
+                tracing::AddEvent("stage", stageName, started, tracing::Clock::now(), GetTraceArgs());
+            } else {
+                stageTask();
+            }
+            auto itNextStage = _itStage + 1;
+            if (_itEndStage != itNextStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                _itStage = itNextStage;
+                ++_stageIndex;
+                // the next stage can run and change the state of the pipeline as soon as it is scheduled
+                RunStage(*nextStageExecutor, _stageTask);
+                return;
+            }
+        } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
+            requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+            localCurrentException = std::make_exception_ptr(ie_ex);
+        } catch (...) {
+            requestStatus = StatusCode::GENERAL_ERROR;
+            localCurrentException = std::current_exception();
+        }
+
+        // the place is released before the callback, so the callback can start the next inference
+        ReleaseAdmission();
+        _runStatus = requestStatus;
+        _stageException = std::move(localCurrentException);
+        if (nullptr == _runCallbackExecutor) {
+            RunLastStage();
+        } else {
+            RunStage(*_runCallbackExecutor, _lastStageTask);
+        }
+    }
 
+    /**
+     * @brief Calls the callback and completes the pipeline. The state of the pipeline is copied before the request
+     * stops being busy, as the callback or another thread can start the next inference right after that
+     */
+    void RunLastStage() {
+        if (tracing::IsEnabled() && _inferStart != tracing::TimePoint{}) {
+            tracing::AddAsyncEvent("request", "infer", reinterpret_cast<std::uintptr_t>(this),
+                                   _inferStart, tracing::Clock::now(), GetTraceArgs());
+            _inferStart = {};
+        }
+        const auto run = _run;
+        const auto requestStatus = _runStatus;
+        auto localCurrentException = std::move(_stageException);
+        _stageException = nullptr;
+        auto callback = _callback.load();
+        if (setIsRequestBusy(false) && nullptr != callback) {
+            InferenceEngine::CurrentException() = localCurrentException;
             try {
-                auto& stageTask = std::get<Stage_e::task>(thisStage);
-                IE_ASSERT(nullptr != stageTask);
-                stageTask();
-               if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                    IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
-                requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
-                localCurrentException = std::make_exception_ptr(ie_ex);
+                callback(_publicInterface, requestStatus);
             } catch (...) {
-                requestStatus = StatusCode::GENERAL_ERROR;
                 localCurrentException = std::current_exception();
             }
+            InferenceEngine::CurrentException() = nullptr;
+        }
+        CompleteRun(run, std::move(localCurrentException));
+    }
 
-            if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
-                auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
-                    auto promise = std::move(_promise);
-                    auto callback = _callback.load();
-                    if (setIsRequestBusy(false)) {
-                        if (nullptr != callback) {
-                            InferenceEngine::CurrentException() = localCurrentException;
-                            try {
-                                callback(_publicInterface, requestStatus);
-                            } catch (...) {
-                                localCurrentException = std::current_exception();
-                            }
-                            InferenceEngine::CurrentException() = nullptr;
-                        }
-                        if (nullptr == localCurrentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(localCurrentException);
-                        }
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
-                } else {
-                    callbackExecutor->run(std::move(lastStageTask));
-                }
-            }
-        }, std::move(callbackExecutor));
+    void CompleteRun(std::uint64_t run, std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // the pipeline started by the callback of this one can finish first
+        if (run > _finishedRun) {
+            _finishedRun = run;
+            _runException = std::move(exception);
+        }
+        --_runningPipelines;
+        // notified under the lock, StopAndWait() of the destructor returns only after it is released
+        _runFinished.notify_all();
     }
 
     void* _userData = nullptr;
     AtomicCallback _callback = {nullptr};
     IInferRequest::Ptr _publicInterface;
-    std::promise<void> _promise;
+    tracing::TimePoint _inferStart;
+    TaskPriority _taskPriority;
+    std::chrono::microseconds _deadline{0};
+
+    // the state of the running pipeline, it is changed only by its stages one after another
+    std::uint64_t _run = 0;
+    Pipeline::iterator _itStage;
+    Pipeline::iterator _itEndStage;
+    std::size_t _stageIndex = 0;
+    ITaskExecutor* _runCallbackExecutor = nullptr;
+    tracing::TimePoint _stageScheduled;
+    std::uint64_t _stageQueued = 0;
+    PipelineStatistics::Ptr _pipelineStatistics;
+    AdmissionControl::Ptr _admissionControl;
+    StatusCode _runStatus = StatusCode::OK;
+    std::exception_ptr _stageException;
+    // the tasks are copied to the executors, capturing only `this` they fit in the storage of std::function
+    const Task _stageTask = [this] { RunCurrentStage(); };
+    const Task _lastStageTask = [this] { RunLastStage(); };
+
     mutable std::mutex _mutex;
-    Futures _futures;
+    std::condition_variable _runFinished;
+    std::uint64_t _startedRuns = 0;
+    std::uint64_t _finishedRun = 0;
+    std::size_t _runningPipelines = 0;
+    std::exception_ptr _runException;
     bool _stop = false;
 };
 }  // namespace InferenceEngine
@@ -91,6 +91,11 @@ public:
         SetCompletionCallback_ThreadUnsafe(callback);
     }
 
+    void SetPriority(int priority, int64_t deadlineUs) override {
+        CheckBusy();
+        SetPriority_ThreadUnsafe(priority, deadlineUs);
+    }
+
     void Infer() override {
         if (setIsRequestBusy(true)) ThrowBusy();
         try {
@@ -131,6 +136,16 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetStateSession(int64_t sessionId) override {
+        CheckBusy();
+        SetStateSession_ThreadUnsafe(sessionId);
+    }
+
+    void ReleaseStateSession(int64_t sessionId) override {
+        CheckBusy();
+        ReleaseStateSession_ThreadUnsafe(sessionId);
+    }
+
 protected:
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -163,6 +178,15 @@ protected:
      */
     virtual void SetCompletionCallback_ThreadUnsafe(IInferRequest::CompletionCallback callback) = 0;
 
+    /**
+     * @brief Sets the scheduling priority thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetPriority which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  priority    The priority of the request
+     * @param[in]  deadlineUs  The latency budget of every inference in microseconds, 0 means no deadline
+     */
+    virtual void SetPriority_ThreadUnsafe(int priority, int64_t deadlineUs) = 0;
+
     /**
      * @brief Performs inference of pipeline in syncronous mode
      * @note Used by AsyncInferRequestThreadSafeInternal::Infer which ensures thread-safety
@@ -223,6 +247,22 @@ protected:
      * @param[in]  batch  The dynamic batch value
      */
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    /**
+     * @brief Binds the request to the states of a session thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetStateSession which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  sessionId  The identifier of the session
+     */
+    virtual void SetStateSession_ThreadUnsafe(int64_t sessionId) = 0;
+
+    /**
+     * @brief Releases the states of a session thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::ReleaseStateSession which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  sessionId  The identifier of the session
+     */
+    virtual void ReleaseStateSession_ThreadUnsafe(int64_t sessionId) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -222,6 +222,14 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    void SetStateSession(int64_t) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The device does not support state sessions";
+    }
+
+    void ReleaseStateSession(int64_t) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "The device does not support state sessions";
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      * @param inputs Inputs blobs to perform preprocessing on
@@ -22,6 +22,7 @@
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "graph_transformer.h"
+#include "ie_system_conf.h"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -191,12 +192,28 @@ protected:
         network.getOutputsInfo(networkOutputs);
         copyInputOutputInfo(networkInputs, networkOutputs, networkInputsCloned, networkOutputsCloned);
 
+        // phases of the load are added to the profile of the caller (e.g. Core or a HETERO plugin) if there is one
+        // the peak memory is measured by the outermost load, which owns the profile
+        auto profile = LoadTimeProfile::GetCurrent();
+        const bool ownProfile = profile == nullptr;
+        if (ownProfile) {
+            profile = std::make_shared<LoadTimeProfile>();
+            resetPeakMemoryUsage();
+        }
         ExecutableNetworkInternal::Ptr impl;
-        if (nullptr == context) {
-            impl = LoadExeNetworkImpl(network, config);
-        } else {
-            impl = LoadExeNetworkImpl(network, context, config);
+        {
+            LoadTimeProfile::Scope profileScope(profile, LoadTimeProfile::GetCurrentPhase());
+            IE_LOAD_PHASE("load");
+            if (nullptr == context) {
+                impl = LoadExeNetworkImpl(network, config);
+            } else {
+                impl = LoadExeNetworkImpl(network, context, config);
+            }
+        }
+        if (ownProfile) {
+            profile->SetPeakMemory(getPeakMemoryUsage());
         }
+        impl->SetLoadTimeProfile(profile);
 
         impl->setNetworkInputs(networkInputsCloned);
         impl->setNetworkOutputs(networkOutputsCloned);
@@ -109,6 +109,13 @@ public:
      * @param resp A response
      */
     virtual void GetContext(RemoteContext::Ptr& pContext, ResponseDesc* resp) const = 0;
+
+    /**
+     * @brief Infers several independent sets of inputs, see IExecutableNetwork::InferBatch
+     * @param inputs The input blobs of each set
+     * @param outputs The output blobs of each set, the missing ones are allocated
+     */
+    virtual void InferBatch(const std::vector<BlobMap>& inputs, std::vector<BlobMap>& outputs) = 0;
 };
 
 }  // namespace InferenceEngine
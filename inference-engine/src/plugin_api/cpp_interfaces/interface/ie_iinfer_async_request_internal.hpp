@@ -66,6 +66,13 @@ public:
      * @param callback - function to be called with the following description:
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Sets the scheduling priority of the following asynchronous inferences
+     * @param priority The priority of the request, 0 is the default
+     * @param deadlineUs The latency budget of every inference in microseconds, 0 means no deadline
+     */
+    virtual void SetPriority(int priority, int64_t deadlineUs) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -83,6 +83,18 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Binds the following inferences to the states of a session
+     * @param sessionId The identifier of the session, a negative value binds the request to the states of the network
+     */
+    virtual void SetStateSession(int64_t sessionId) = 0;
+
+    /**
+     * @brief Releases the states of a session, the next inference with the identifier starts with zero states
+     * @param sessionId The identifier of the session
+     */
+    virtual void ReleaseStateSession(int64_t sessionId) = 0;
 };
 
 }  // namespace InferenceEngine
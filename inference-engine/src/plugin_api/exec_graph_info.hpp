@@ -48,6 +48,23 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @brief Used to get the hardware counters per execution of the executable primitive if they are collected.
+ *        E.g. "cycles:1000,instructions:2000,llc_misses:10,bytes_read:640,bytes_written:0"
+ */
+static const char HW_COUNTERS[] = "hwCounters";
+
+/**
+ * @brief Used to get the memory bandwidth in GB/s achieved by the executable primitive if the hardware counters are collected.
+ */
+static const char BANDWIDTH[] = "bandwidthGBps";
+
+/**
+ * @brief Used to get the compute throughput in GFLOP/s achieved by the executable primitive
+ *        if it has a known number of floating point operations.
+ */
+static const char COMPUTE_THROUGHPUT[] = "computeGFLOPs";
+
 /**
  * @brief Used to get output layouts of primitive.
  */
@@ -63,6 +80,25 @@ static const char EXECUTION_ORDER[] = "execOrder";
  */
 static const char LAYER_TYPE[] = "layerType";
 
+/**
+ * @brief Used to get a report of the memory reused by intermediate tensors, set for input primitives.
+ *        E.g. "solver:best_fit,allocated:1024,peak:960", where sizes are in bytes and the peak is
+ *        the max size of tensors which live at the same time, i.e. the lower bound of the allocated size.
+ */
+static const char MEMORY_REUSE[] = "memoryReuse";
+
+/**
+ * @brief Used to get a number of reorders inserted to convert tensors between FP32 and BF16, set for input primitives.
+ *        E.g. "fp32_to_bf16:2,bf16_to_fp32:3"
+ */
+static const char PRECISION_CONVERTS[] = "precisionConverts";
+
+/**
+ * @brief Used to get a device the primitive is executed on. Set by the heterogeneous plugin,
+ *        where an execution order of the primitive is an index of its device subgraph.
+ */
+static const char AFFINITY[] = "affinity";
+
 class INFERENCE_ENGINE_API_CLASS(ExecutionNode) : public ngraph::Node {
 public:
     static constexpr ngraph::NodeTypeInfo type_info { "ExecutionNode", 0 };
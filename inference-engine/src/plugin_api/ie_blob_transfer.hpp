@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with the transfers of the blobs between the infer requests of the plugins
+ * @file ie_blob_transfer.hpp
+ */
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+#include <threading/ie_itask_executor.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Moves the tensors between the host memory of the infer requests, e.g. the blobs HETERO and MULTI pass to
+ *        the requests of the devices or the inputs a plugin copies to the memory of the device
+ * @ingroup ie_dev_api_memory
+ *
+ * The copies are elided when the source and the destination are the same tensor in the same memory. The staging
+ * blobs are page-aligned and kept while their descriptors do not change, so the driver mapping the host memory
+ * for DMA maps the same pages on every inference. The copies added by Add() run in a stage of the pipeline of
+ * AsyncInferRequestThreadSafeDefault, see GetStage().
+ */
+class INFERENCE_ENGINE_API_CLASS(BlobTransfer) {
+public:
+    /**
+     * @brief A shared pointer to BlobTransfer
+     */
+    using Ptr = std::shared_ptr<BlobTransfer>;
+
+    /**
+     * @brief Checks whether the blobs are the same tensor in the same memory
+     * @param src The source blob
+     * @param dst The destination blob
+     * @return `true` if there is nothing to copy
+     */
+    static bool IsSameMemory(const Blob::Ptr& src, const Blob::Ptr& dst);
+
+    /**
+     * @brief Copies the blob with the layout and the precision conversion, see blob_copy
+     * @param src The source blob
+     * @param dst The destination blob
+     * @return `false` if the copy is elided
+     */
+    static bool Copy(const Blob::Ptr& src, const Blob::Ptr& dst);
+
+    /**
+     * @brief Returns the page-aligned staging blob of the name, it is reallocated only when the descriptor changes
+     * @param name The name of the tensor, e.g. of the input of the network
+     * @param desc The descriptor of the blob
+     * @return The staging blob
+     */
+    Blob::Ptr GetStagingBlob(const std::string& name, const TensorDesc& desc);
+
+    /**
+     * @brief Schedules a copy, the copies are run by Run() in the order they are added
+     * @param src The source blob
+     * @param dst The destination blob
+     */
+    void Add(const Blob::Ptr& src, const Blob::Ptr& dst);
+
+    /**
+     * @brief Runs and clears the scheduled copies
+     */
+    void Run();
+
+    /**
+     * @brief Returns a stage of the pipeline of an asynchronous infer request which runs the scheduled copies
+     * @param executor The executor of the stage, the copies run in the thread of the previous stage if it is `nullptr`
+     * @return The executor and the task of the stage
+     */
+    std::pair<ITaskExecutor::Ptr, Task> GetStage(const ITaskExecutor::Ptr& executor = nullptr);
+
+private:
+    struct StagingBuffer {
+        std::unique_ptr<uint8_t[]> storage;
+        Blob::Ptr blob;
+    };
+
+    std::mutex _mutex;
+    std::map<std::string, StagingBuffer> _staging;
+    std::vector<std::pair<Blob::Ptr, Blob::Ptr>> _copies;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Hashing of the large host data, e.g. weights and serialized networks
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Computes a 64-bit non-cryptographic hash of the data
+ * @ingroup    ie_dev_api_memory
+ *
+ * The data is split into 1MB chunks hashed in parallel by the XXH64 algorithm, then the hashes of the chunks
+ * are hashed. The result depends only on the data and the seed, so it is stable between processes and machines
+ * and can be used in the keys of the persistent caches.
+ *
+ * @param[in]  data  The data to hash
+ * @param[in]  size  The size of the data in bytes
+ * @param[in]  seed  The seed, e.g. a hash of the previous data to hash a sequence of buffers
+ * @return     The hash of the data
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) computeDataHash(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,150 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API to measure phases of a network load
+ * @file ie_load_time_profile.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Wall time of named phases of a network load
+ * @ingroup ie_dev_profiling
+ * @details A profile is made current for a thread with LoadTimeProfile::Scope, and LoadTimeProfile::Phase objects
+ * created on this thread add their lifetime to it. Nested phases are named after their parents, e.g.
+ * "transformations/common", so the phases form a tree. Time of phases with the same name is summed, so phases
+ * run by several threads in parallel (e.g. graphs compiled by every stream) report the total time of the threads.
+ * Without a current profile phases do nothing but a check of a thread local pointer.
+ * The phases are reported by executable networks with the LOAD_TIME_PHASES metric and the peak memory of the load
+ * with the LOAD_PEAK_MEMORY metric.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadTimeProfile) {
+public:
+    /**
+     * @brief A shared pointer to LoadTimeProfile object
+     */
+    using Ptr = std::shared_ptr<LoadTimeProfile>;
+
+    /**
+     * @brief Phase name to the time spent in the phase, in microseconds
+     */
+    using Phases = std::map<std::string, std::uint64_t>;
+
+    /**
+     * @brief Makes a profile current for the calling thread for the lifetime of the scope.
+     * Scopes can be nested, the previous profile and phase are restored on exit.
+     */
+    class INFERENCE_ENGINE_API_CLASS(Scope) {
+    public:
+        /**
+         * @brief Makes the profile current
+         * @param profile A profile to record phases to. Can be nullptr to disable recording
+         * @param phase A name of the phase new phases are nested in, e.g. the phase of another thread
+         * which started the work
+         */
+        explicit Scope(const Ptr& profile, const std::string& phase = {});
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Ptr         _previousProfile;
+        std::string _previousPhase;
+    };
+
+    /**
+     * @brief Records the lifetime of the object as a phase of the current profile
+     */
+    class INFERENCE_ENGINE_API_CLASS(Phase) {
+    public:
+        /**
+         * @brief Starts the phase if the thread has a current profile
+         * @param name A name of the phase. Must not contain '/'
+         */
+        explicit Phase(const char* name);
+        ~Phase();
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+    private:
+        Ptr                                   _profile;
+        std::string                           _previousPhase;
+        std::chrono::steady_clock::time_point _begin;
+    };
+
+    /**
+     * @brief Adds time to a phase
+     * @param phase A full name of the phase
+     * @param duration Time spent in the phase
+     */
+    void Add(const std::string& phase, std::chrono::steady_clock::duration duration);
+
+    /**
+     * @brief Returns recorded phases
+     * @return Phase name to the time in microseconds
+     */
+    Phases GetPhases() const;
+
+    /**
+     * @brief Sets the peak resident memory of the process during the load
+     * @param bytes The peak memory in bytes, 0 if unknown
+     */
+    void SetPeakMemory(std::uint64_t bytes);
+
+    /**
+     * @brief Returns the peak resident memory of the process during the load
+     * @return The peak memory in bytes, 0 if unknown
+     */
+    std::uint64_t GetPeakMemory() const;
+
+    /**
+     * @brief Returns the current profile of the calling thread
+     * @return The profile or nullptr if phases of the thread are not recorded
+     */
+    static Ptr GetCurrent();
+
+    /**
+     * @brief Returns the full name of the innermost phase of the calling thread
+     * @return The phase name or an empty string
+     */
+    static std::string GetCurrentPhase();
+
+private:
+    mutable std::mutex _mutex;
+    Phases             _phases;
+    std::uint64_t      _peakMemory = 0;
+};
+
+}  // namespace InferenceEngine
+
+/**
+ * @cond
+ */
+#define IE_LOAD_PHASE_CONCAT_IMPL(a, b) a##b
+#define IE_LOAD_PHASE_CONCAT(a, b) IE_LOAD_PHASE_CONCAT_IMPL(a, b)
+/**
+ * @endcond
+ */
+
+/**
+ * @def IE_LOAD_PHASE(name)
+ * @ingroup ie_dev_profiling
+ * @brief Records a phase of a network load from the macro up to the end of the current scope
+ */
+#define IE_LOAD_PHASE(name) \
+    InferenceEngine::LoadTimeProfile::Phase IE_LOAD_PHASE_CONCAT(ieLoadPhase, __LINE__) {name}
@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Estimation of the arithmetic intensity of the networks, used to pick the number of streams
+ * @file ie_network_intensity.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "ie_api.h"
+
+namespace ngraph {
+class Function;
+}  // namespace ngraph
+
+namespace InferenceEngine {
+
+/**
+ * @brief The amount of the computations of a network and of the memory they access
+ * @ingroup ie_dev_api_threading
+ */
+struct NetworkIntensity {
+    double flops = 0;            //!< The floating point operations of a single inference, a multiply-add counts as two
+    double bytes = 0;            //!< The bytes the operations read and write, the weights included
+    std::size_t maxWorkingSet = 0;  //!< The largest number of bytes a single operation reads and writes
+
+    /**
+     * @brief Returns the operations per byte of the memory accessed
+     * @return The arithmetic intensity, 0 if it is unknown
+     */
+    double FlopsPerByte() const {
+        return bytes > 0 ? flops / bytes : 0;
+    }
+};
+
+/**
+ * @brief      Estimates the arithmetic intensity of a network
+ * @ingroup    ie_dev_api_threading
+ *
+ * Convolutions, matrix multiplications and the fully connected operations are counted by their multiply-adds,
+ * the rest of the operations by one operation per output element. The operations with dynamic shapes are skipped.
+ *
+ * @param[in]  function  The network function
+ * @return     The estimation, zeros if there is nothing to estimate
+ */
+INFERENCE_ENGINE_API_CPP(NetworkIntensity) getNetworkIntensity(const ngraph::Function& function);
+
+}  // namespace InferenceEngine
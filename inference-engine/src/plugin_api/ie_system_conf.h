@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ie_api.h"
+#include <exception>
 #include <vector>
 
 namespace InferenceEngine {
@@ -44,6 +45,64 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Returns the number of logical processors the process can use
+ * @details    On Linux these are the processors of the process affinity mask (that includes the cgroup cpuset),
+ *             limited by the CPU bandwidth quota of the process cgroups. On other OSes it is the number of the
+ *             logical processors of the machine
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Number of logical processors
+ */
+INFERENCE_ENGINE_API_CPP(int) getNumberOfAvailableCPUs();
+
+/**
+ * @brief      Returns the number of processors the CPU bandwidth quota of the process allows to keep busy (Linux only)
+ * @details    The quota is the least one of the cgroup v2 `cpu.max` or cgroup v1 `cpu.cfs_quota_us` of the
+ *             process cgroup and its parents, rounded up to the whole processors
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Number of processors, 0 if the CPU time is not limited
+ */
+INFERENCE_ENGINE_API_CPP(int) getCPUQuota();
+
+/**
+ * @brief      Returns the memory the process can use
+ * @details    On Linux it is the physical memory limited by the least one of the cgroup v2 `memory.max` or the
+ *             cgroup v1 `memory.limit_in_bytes` of the process cgroup and its parents
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Memory size in bytes, 0 if the OS does not report it
+ */
+INFERENCE_ENGINE_API_CPP(size_t) getAvailableMemory();
+
+/**
+ * @enum       CPUCoreType
+ * @brief      Types of the cores of a hybrid CPU
+ * @ingroup    ie_dev_api_system_conf
+ */
+enum class CPUCoreType {
+    BIG,     //!< Performance cores
+    LITTLE   //!< Efficiency cores
+};
+
+/**
+ * @brief      Returns the physical cores of the given type of a hybrid CPU which are available to the process
+ * @details    The core types are read from sysfs or, on older Linux kernels, from CPUID leaf 0x1A of every processor.
+ *             On Windows they are the efficiency classes of the cores
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  type  The core type
+ * @return     Logical processors of every core, sorted by their ids. Empty if the CPU is not hybrid or the core types
+ *             are unknown
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<std::vector<int>>) getAvailableCores(CPUCoreType type);
+
+/**
+ * @brief      Returns the logical processors of the physical core of the given logical processor
+ * @details    On Linux they are read from sysfs. On other systems the processor is reported as a core of its own
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  processor  The logical processor
+ * @return     The hyper-threading siblings of the processor including itself, sorted by their ids
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getCoreSiblings(int processor);
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -86,4 +145,18 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_bfloat16();
 
+/**
+ * @brief      Returns the peak resident memory (high-water mark) of the process
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Peak resident memory in bytes, 0 if the OS does not report it
+ */
+INFERENCE_ENGINE_API_CPP(size_t) getPeakMemoryUsage();
+
+/**
+ * @brief      Resets the peak resident memory of the process to the current resident memory (Linux only)
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` if the peak was reset, `false` if the OS does not allow it
+ */
+INFERENCE_ENGINE_API_CPP(bool) resetPeakMemoryUsage();
+
 }  // namespace InferenceEngine
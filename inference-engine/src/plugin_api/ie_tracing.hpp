@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API to record a timeline of inference events in the Chrome trace format
+ * @file ie_tracing.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Timeline tracing of inference requests, pipeline stages and layers
+ * @ingroup ie_dev_profiling
+ * @details Events are written in the Chrome trace event format (the same one nGraph uses in chrome_trace.hpp),
+ * so the resulting file can be opened with chrome://tracing or https://ui.perfetto.dev.
+ * Tracing is enabled for the whole process with KEY_TRACE_FILE passed to Core::SetConfig().
+ * When tracing is disabled recording functions do nothing but a check of an atomic flag.
+ */
+namespace tracing {
+
+using Clock = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+/**
+ * @brief Starts recording events. Already recorded events are written to the previous file if any
+ * @param filePath A path to the trace file. It is overwritten
+ */
+INFERENCE_ENGINE_API_CPP(void) Start(const std::string& filePath);
+
+/**
+ * @brief Stops recording events and writes all the recorded events to a file
+ */
+INFERENCE_ENGINE_API_CPP(void) Stop();
+
+/**
+ * @brief Returns the path to the trace file
+ * @return The file path, or an empty string if tracing is not enabled
+ */
+INFERENCE_ENGINE_API_CPP(std::string) GetFilePath();
+
+/**
+ * @brief Checks whether events are recorded
+ * @return `true` if tracing is enabled
+ */
+INFERENCE_ENGINE_API_CPP(bool) IsEnabled() noexcept;
+
+/**
+ * @brief Records an event executed by the current thread
+ * @param category A category of the event, e.g. "layer". Must be a string literal
+ * @param name A name of the event
+ * @param begin A time of the event start
+ * @param end A time of the event end
+ * @param args Additional event arguments as a JSON object, e.g. `{"request":1}`. Can be empty
+ */
+INFERENCE_ENGINE_API_CPP(void) AddEvent(const char* category, const std::string& name,
+                                        TimePoint begin, TimePoint end, const std::string& args = {});
+
+/**
+ * @brief Records an event which is not bound to a thread, e.g. a whole asynchronous inference
+ * @param category A category of the event. Must be a string literal
+ * @param name A name of the event
+ * @param id An identifier which groups events of a single object (e.g. an infer request) into one track
+ * @param begin A time of the event start
+ * @param end A time of the event end
+ * @param args Additional event arguments as a JSON object. Can be empty
+ */
+INFERENCE_ENGINE_API_CPP(void) AddAsyncEvent(const char* category, const std::string& name, std::uint64_t id,
+                                             TimePoint begin, TimePoint end, const std::string& args = {});
+
+/**
+ * @brief Records an event for the lifetime of the object
+ */
+class Scope {
+public:
+    /**
+     * @brief Starts the event if tracing is enabled
+     * @param category A category of the event. Must be a string literal
+     * @param name A name of the event. It is copied only if tracing is enabled
+     */
+    Scope(const char* category, const std::string& name) : _category{category}, _enabled{IsEnabled()} {
+        if (_enabled) {
+            _name = name;
+            _begin = Clock::now();
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope() {
+        if (_enabled) {
+            AddEvent(_category, _name, _begin, Clock::now());
+        }
+    }
+
+private:
+    const char* _category;
+    bool        _enabled;
+    std::string _name;
+    TimePoint   _begin;
+};
+
+}  // namespace tracing
+}  // namespace InferenceEngine
+
+/**
+ * @cond
+ */
+#define IE_TRACE_CONCAT_IMPL(a, b) a##b
+#define IE_TRACE_CONCAT(a, b) IE_TRACE_CONCAT_IMPL(a, b)
+/**
+ * @endcond
+ */
+
+/**
+ * @def IE_TRACE_SCOPE(category, name)
+ * @ingroup ie_dev_profiling
+ * @brief Records an event from the macro up to the end of the current scope
+ */
+#define IE_TRACE_SCOPE(category, name) \
+    InferenceEngine::tracing::Scope IE_TRACE_CONCAT(ieTraceScope, __LINE__) {category, name}
@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines a cache of nGraph functions transformed by a plugin
+ * @file ie_transformations_cache.hpp
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ie_api.h"
+
+namespace ngraph {
+class Function;
+}  // namespace ngraph
+
+namespace InferenceEngine {
+
+/**
+ * @brief Keeps the results of the device independent part of a plugin transformation pipeline
+ * @ingroup ie_dev_api_plugin_api
+ * @details A network loaded several times (with other configurations, by MULTI or by several executable networks
+ * of one application) is transformed once: the next loads get the function the first one produced. The results are
+ * keyed by the identity of the original function and by a signature of its parameters and operations, so a reshaped
+ * function or a function with added outputs is transformed again. The cached functions are shared between loads
+ * and must not be changed, conversion to the legacy representation only reads them. A result is dropped when its
+ * original function is destroyed.
+ * The pipeline must be the same for all the loads which use a cache: a plugin keeps a cache per pipeline.
+ */
+class INFERENCE_ENGINE_API_CLASS(TransformationsCache) {
+public:
+    /**
+     * @brief Transforms a copy of the original function
+     */
+    using Transform = std::function<std::shared_ptr<const ngraph::Function>()>;
+
+    /**
+     * @brief Returns the transformed function for the original one, runs the transformation on a miss
+     * @param original The original function of the network
+     * @param transform The transformation pipeline. Is called without the cache lock
+     * @return The transformed function
+     */
+    std::shared_ptr<const ngraph::Function> Get(const std::shared_ptr<const ngraph::Function>& original,
+                                                const Transform& transform);
+
+    /**
+     * @brief Drops all the cached functions
+     */
+    void Clear();
+
+private:
+    struct Entry {
+        std::weak_ptr<const ngraph::Function>   _original;
+        std::string                             _signature;
+        std::shared_ptr<const ngraph::Function> _transformed;
+    };
+
+    std::mutex         _mutex;
+    std::vector<Entry> _entries;
+};
+
+}  // namespace InferenceEngine
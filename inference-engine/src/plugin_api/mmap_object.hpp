@@ -0,0 +1,57 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with memory mapped files helpers
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief A memory mapped file. Pages are mapped with copy-on-write protection,
+ * so they are shared via page cache between processes until written.
+ */
+class MappedMemory {
+public:
+    using Ptr = std::shared_ptr<MappedMemory>;
+
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns a size of the mapped file in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps a whole file into memory
+ * @param path A path to the file
+ * @return A mapped memory or `nullptr` if the file cannot be mapped (e.g. it is empty)
+ */
+INFERENCE_ENGINE_API_CPP(MappedMemory::Ptr) mapFile(const std::string& path);
+
+/**
+ * @brief Creates a U8 blob which shares memory with the mapped file and keeps the mapping alive
+ * @param memory A mapped memory
+ * @return A blob of memory->size() bytes
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_mapped_blob(const MappedMemory::Ptr& memory);
+
+}  // namespace details
+}  // namespace InferenceEngine
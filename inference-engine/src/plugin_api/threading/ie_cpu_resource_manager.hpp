@@ -0,0 +1,109 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_cpu_resource_manager.hpp
+ * @brief A header file for the process-wide CPU threads budget
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ie_api.h"
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Divides a budget of CPU threads between streams executors of the process
+ * @ingroup ie_dev_api_threading
+ * @details Every registered executor gets a Share which tells how many of its streams may execute tasks at once.
+ * The budget is divided between the active executors (which have queued or running tasks) in proportion to their
+ * priorities, an executor never gets more than all its streams and at least one stream. Idle executors lend their
+ * threads: they do not take part in the division and may use at most what is left by the active ones,
+ * so an idle network starts its next inference immediately and the shares are rebalanced when it becomes active.
+ * The shares are recomputed when executors are registered or unregistered, become active or idle, and when
+ * the budget changes. A zero budget (default) disables the limits.
+ */
+class INFERENCE_ENGINE_API_CLASS(CPUResourceManager) {
+public:
+    /**
+     * @brief A part of the budget given to an executor. Unregisters the executor on destruction
+     */
+    class INFERENCE_ENGINE_API_CLASS(Share) {
+    public:
+        /**
+         * @brief A shared pointer to the Share object
+         */
+        using Ptr = std::shared_ptr<Share>;
+
+        ~Share();
+
+        Share(const Share&) = delete;
+        Share& operator=(const Share&) = delete;
+
+        /**
+         * @brief Returns the number of streams of the executor which may execute tasks at once
+         * @return The number of streams, from 1 to all the streams of the executor
+         */
+        int GetAllowedStreams() const {
+            return _allowedStreams.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Notifies the manager that the executor became active or idle
+         */
+        void Update();
+
+    private:
+        friend class CPUResourceManager;
+        Share() = default;
+
+        CPUResourceManager*    _manager = nullptr;
+        int                    _streams = 1;
+        int                    _threadsPerStream = 1;
+        int                    _priority = 1;
+        std::function<bool()>  _isActive;
+        std::function<void()>  _onChange;
+        std::atomic<int>       _allowedStreams{1};
+    };
+
+    /**
+     * @brief Registers an executor
+     * @param config The configuration of the executor: the number of streams, threads per stream and priority
+     * @param isActive Returns true if the executor has queued or running tasks. Is called under the manager lock
+     * @param onChange Is called under the manager lock when the number of allowed streams changes
+     * @return The share of the executor. Must not outlive the manager
+     */
+    Share::Ptr Register(const IStreamsExecutor::Config& config,
+                        std::function<bool()> isActive,
+                        std::function<void()> onChange);
+
+    /**
+     * @brief Sets the number of threads which all the registered executors may use at once
+     * @param threads The number of threads, 0 disables the limits
+     */
+    void SetBudget(int threads);
+
+    /**
+     * @brief Returns the number of threads which all the registered executors may use at once
+     * @return The number of threads, 0 if the limits are disabled
+     */
+    int GetBudget() const;
+
+private:
+    void Unregister(Share* share);
+    void Rebalance();
+
+    mutable std::mutex  _mutex;
+    int                 _budget = 0;
+    std::vector<Share*> _shares;
+};
+
+}  // namespace InferenceEngine
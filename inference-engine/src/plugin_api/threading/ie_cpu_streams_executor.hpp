@@ -13,6 +13,7 @@
 #include <string>
 
 #include <threading/ie_istreams_executor.hpp>
+#include <threading/ie_cpu_resource_manager.hpp>
 #include "ie_parallel.hpp"
 #include "ie_api.h"
 
@@ -22,7 +23,7 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-thread lock-free queues with work stealing.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -34,8 +35,10 @@ public:
     /**
     * @brief Constructor
     * @param config Stream executor parameters
+    * @param resourceManager A manager of the CPU threads budget which limits the number of streams executing tasks
+    *        at once. nullptr (default) means no limits. Must outlive the executor
     */
-    explicit CPUStreamsExecutor(const Config& config = {});
+    explicit CPUStreamsExecutor(const Config& config = {}, CPUResourceManager* resourceManager = nullptr);
 
     /**
      * @brief A class destructor
@@ -44,12 +47,20 @@ public:
 
     void run(Task task) override;
 
+    void runWithPriority(Task task, const TaskPriority& priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Returns the counters of the task queues and of the threads of the streams
+     * @return A snapshot of the counters
+     */
+    TaskExecutorStatistics GetStatistics() const override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
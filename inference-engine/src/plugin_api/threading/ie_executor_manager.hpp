@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_cpu_resource_manager.hpp"
 #include "ie_api.h"
 
 namespace InferenceEngine {
@@ -38,7 +39,11 @@ public:
 
     void clear(const std::string& id = {});
 
+    CPUResourceManager& getCPUResourceManager();
+
 private:
+    // is declared first, so the executors are unregistered before it is destroyed
+    CPUResourceManager cpuResourceManager;
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
     std::mutex streamExecutorMutex;
@@ -84,6 +89,12 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the manager of the CPU threads budget shared by the executors of getIdleCPUStreamsExecutor
+     * @return The process-wide CPU resource manager
+     */
+    CPUResourceManager& getCPUResourceManager();
+
     /**
      * @cond
      */
@@ -9,10 +9,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
 #include "threading/ie_itask_executor.hpp"
+#include "threading/ie_task_queue_counters.hpp"
 
 namespace InferenceEngine {
 
@@ -33,8 +37,32 @@ public:
     ~ImmediateExecutor() override = default;
 
     void run(Task task) override {
+        // the task does not wait, it is queued and started at once
+        const auto started = TaskQueueCounters::Now();
+        _counters.Queued(started);
+        _counters.Started(started);
         task();
+        _busyTime.fetch_add(TaskQueueCounters::Now() - started, std::memory_order_relaxed);
     }
+
+    /**
+     * @brief Returns the counters of the tasks. The calling threads are reported as a single stream
+     * @return A snapshot of the counters
+     */
+    TaskExecutorStatistics GetStatistics() const override {
+        TaskExecutorStatistics statistics;
+        _counters.Fill(statistics);
+        const auto lifetime = TaskQueueCounters::Now() - _created;
+        const auto busy = std::min(lifetime, _busyTime.load(std::memory_order_relaxed));
+        statistics._busyTime = {busy};
+        statistics._idleTime = {lifetime - busy};
+        return statistics;
+    }
+
+private:
+    TaskQueueCounters _counters;
+    std::atomic<std::uint64_t> _busyTime{0};
+    const std::uint64_t _created = TaskQueueCounters::Now();
 };
 
 }  // namespace InferenceEngine
@@ -9,10 +9,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include "threading/ie_itask_executor.hpp"
 #include "ie_api.h"
 #include "ie_parameter.hpp"
+#include "ie_network_intensity.hpp"
 #include <vector>
 #include <string>
 
@@ -70,12 +72,64 @@ public:
 
         /**
         * @brief Create appropriate multithreaded configuration
-        *        filing unconfigured values from initial configuration using hardware properties
+        *        filing unconfigured values from initial configuration using hardware properties.
+        *        With @ref CORES binding on a hybrid CPU a single stream is placed on the big cores, and several streams
+        *        are divided between the big and the little cores in proportion to the number of cores
         * @param initial Inital configuration
         * @return configured values
         */
         static Config MakeDefaultMultiThreaded(const Config& initial);
 
+        /**
+        * @brief Returns the number of streams for @ref _autoStreams configuration which suits the network.
+        *        The compute bound networks get more streams and the memory bound ones get more threads per stream,
+        *        so the largest operation of a stream fits the caches of its threads
+        * @param intensity The arithmetic intensity of the network
+        * @param cacheSize The size in bytes of the cache of a core, e.g. L2
+        * @return The number of streams, the CPU_THROUGHPUT_AUTO one if the intensity is unknown
+        */
+        static int GetModelAwareStreams(const NetworkIntensity& intensity, std::size_t cacheSize);
+
+        /**
+        * @brief Returns the number of threads of a stream
+        * @param streamId The index of the stream
+        * @return The number of threads, 0 if it is not set
+        */
+        int GetThreadsPerStream(int streamId) const {
+            return (_bigCoreStreams > 0 && streamId >= _bigCoreStreams && _threadsPerLittleCoreStream > 0)
+                       ? _threadsPerLittleCoreStream : _threadsPerStream;
+        }
+
+        /**
+        * @brief Returns the index of the CPU list of @ref _streamsCpuLists a stream is bound to
+        * @param streamId The index of the stream
+        * @return The index of the list, -1 if the lists are not set
+        */
+        int GetStreamCpuListIndex(int streamId) const {
+            const auto lists = static_cast<int>(_streamsCpuLists.size());
+            if (0 == lists) {
+                return -1;
+            }
+            const auto streams = std::max(1, _streams);
+            const auto streamsPerList = (streams + lists - 1) / lists;
+            return std::min(lists - 1, (streamId % streams) / streamsPerList);
+        }
+
+        /**
+        * @brief Returns the index of a stream among the streams bound to the same CPU list
+        * @param streamId The index of the stream
+        * @return The index of the stream in its list, 0 if the lists are not set
+        */
+        int GetStreamIndexInCpuList(int streamId) const {
+            const auto lists = static_cast<int>(_streamsCpuLists.size());
+            if (0 == lists) {
+                return 0;
+            }
+            const auto streams = std::max(1, _streams);
+            const auto streamsPerList = (streams + lists - 1) / lists;
+            return (streamId % streams) - GetStreamCpuListIndex(streamId) * streamsPerList;
+        }
+
         std::string        _name;  //!< Used by `ITT` to name executor threads
         int                _streams                 = 1;  //!< Number of streams.
         int                _threadsPerStream        = 0;  //!< Number of threads per stream that executes `ie_parallel` calls
@@ -83,6 +137,14 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _priority                = 1;  //!< Weight of the executor in the division of the CPU threads budget
+        int                _bigCoreStreams          = 0;  //!< In case of @ref CORES binding on a hybrid CPU the first streams are bound to the big cores, the rest to the little cores. 0 ignores the core types
+        int                _threadsPerLittleCoreStream = 0;  //!< Number of threads per stream bound to the little cores, 0 means @ref _threadsPerStream
+        std::vector<std::vector<int>> _streamsCpuLists;  //!< Logical processors the streams are divided between, see @ref GetStreamCpuListIndex. Empty keeps @ref _threadBindingType
+        std::vector<int>   _reservedCpus;  //!< Logical processors the threads are never bound to
+        bool               _bindToSmtSiblings       = true;  //!< `false` binds the threads to the first logical processor of every core only
+        bool               _autoStreams             = false;  //!< The number of streams was set to CPU_THROUGHPUT_AUTO and may be adjusted to the network
+        bool               _busyWait                = false;  //!< The idle threads spin for the tasks instead of sleeping, see KEY_CPU_LATENCY_CRITICAL
 
         /**
          * @brief      A constructor with arguments
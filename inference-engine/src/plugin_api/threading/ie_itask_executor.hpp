@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +26,43 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling hints of a task, see ITaskExecutor::runWithPriority
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskPriority {
+    /**
+     * @brief A clock of the deadlines
+     */
+    using Clock = std::chrono::steady_clock;
+
+    int               _priority = 0;                           //!< Tasks with a higher priority are executed first
+    Clock::time_point _deadline = Clock::time_point::max();    //!< Tasks with the same priority are executed earliest deadline first
+
+    /**
+     * @brief Checks whether the task is scheduled as the tasks started by ITaskExecutor::run
+     * @return `True` if the default priority and no deadline are set
+     */
+    bool IsDefault() const {
+        return 0 == _priority && Clock::time_point::max() == _deadline;
+    }
+};
+
+/**
+ * @brief A snapshot of the counters of a task executor, see ITaskExecutor::GetStatistics.
+ *        The counters only grow from the executor creation, so the rates are differences of two snapshots
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskExecutorStatistics {
+    std::uint64_t _queuedTasks  = 0;  //!< Number of tasks passed to the executor queue
+    std::uint64_t _startedTasks = 0;  //!< Number of queued tasks taken by the workers
+    std::uint64_t _queueDepth   = 0;  //!< Number of tasks waiting for a worker at the moment of the snapshot
+    std::uint64_t _waitTime     = 0;  //!< Time the tasks spent in the queue including the waiting ones, in microseconds
+    std::uint64_t _stolenTasks  = 0;  //!< Number of tasks a worker took from the queue of another worker
+    std::vector<std::uint64_t> _busyTime;  //!< Time every worker stream executed tasks, in microseconds
+    std::vector<std::uint64_t> _idleTime;  //!< Time every worker stream waited for tasks, in microseconds
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +100,17 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task with scheduling hints. The executor runs the waiting tasks with a higher
+     *        priority first and the tasks with the same priority earliest deadline first.
+     *        Default implementation ignores the hints and uses run()
+     * @param task A task to start
+     * @param priority The scheduling hints of the task
+     */
+    virtual void runWithPriority(Task task, const TaskPriority& priority) {
+        run(std::move(task));
+    }
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
@@ -74,6 +124,16 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void runAndWait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Returns the counters of the executor queue and workers. The counters are updated with a few
+     *        relaxed atomic operations per task, so they are always on.
+     *        Default implementation returns zeros for an executor which does not count its tasks
+     * @return A snapshot of the counters
+     */
+    virtual TaskExecutorStatistics GetStatistics() const {
+        return {};
+    }
 };
 
 }  // namespace InferenceEngine
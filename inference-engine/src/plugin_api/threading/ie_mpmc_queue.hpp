@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_mpmc_queue.hpp
+ * @brief A header file for the bounded lock-free multi-producer multi-consumer queue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue (D. Vyukov's algorithm)
+ * @ingroup ie_dev_api_threading
+ * @details Every cell carries a sequence number which tells producers and consumers whether the cell is free
+ * or holds a value for the current lap, so only the head or the tail index is contended.
+ * Producers and consumers never block: try_push() fails if the queue is full and try_pop() fails if it is empty.
+ * @tparam T A type of queue elements. Must be default constructible and move assignable
+ */
+template <typename T>
+class BoundedMPMCQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity A minimal number of elements the queue can hold. It is rounded up to a power of two
+     */
+    explicit BoundedMPMCQueue(std::size_t capacity) :
+        _mask{RoundUpToPowerOfTwo(capacity) - 1},
+        _cells{new Cell[_mask + 1]} {
+        for (std::size_t i = 0; i <= _mask; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+    BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+    /**
+     * @brief Pushes a value to the queue
+     * @param value A value to push. It is moved from only if the push succeeded
+     * @return `false` if the queue is full
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        auto pos = _enqueue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._value = std::forward<U>(value);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pops a value from the queue
+     * @param value A popped value
+     * @return `false` if the queue is empty
+     */
+    bool try_pop(T& value) {
+        auto pos = _dequeue._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    cell._value = T{};
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether the queue is empty
+     * @note The result is approximate if other threads push or pop at the same time
+     * @return `true` if there are no values in the queue
+     */
+    bool empty() const {
+        return _dequeue._value.load(std::memory_order_relaxed) >= _enqueue._value.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the maximal number of elements the queue can hold
+     * @return The queue capacity
+     */
+    std::size_t capacity() const {
+        return _mask + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    /**
+     * @brief Keeps the producers' and the consumers' positions in different cache lines
+     */
+    struct PaddedPosition {
+        std::atomic<std::size_t>    _value{0};
+        char                        _pad[64 - sizeof(std::atomic<std::size_t>)];
+    };
+
+    static std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const std::size_t           _mask;
+    std::unique_ptr<Cell[]>     _cells;
+    PaddedPosition              _enqueue;
+    PaddedPosition              _dequeue;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_task_queue.hpp
+ * @brief A header file for the queue of tasks ordered by their scheduling hints
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A thread-safe queue of tasks with scheduling hints
+ * @ingroup ie_dev_api_threading
+ * @details Pops the task with the highest priority, among them the one with the earliest deadline, and tasks with
+ * the same hints in the order they were pushed. Executors keep the tasks with the default hints in their usual queues
+ * and use this one only for the prioritized tasks, so empty() is a cheap check which does not take the lock.
+ */
+class PriorityTaskQueue {
+public:
+    /**
+     * @brief Pushes a task
+     * @param task A task
+     * @param priority The scheduling hints of the task
+     */
+    void push(Task task, const TaskPriority& priority) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _heap.push_back({std::move(task), priority, _order++});
+        std::push_heap(_heap.begin(), _heap.end(), Less{});
+        _size.store(_heap.size());
+    }
+
+    /**
+     * @brief Pops the most urgent task if its priority is not lower than the given one
+     * @param task The popped task
+     * @param minPriority The lowest priority of a task to pop
+     * @return `True` if a task was popped
+     */
+    bool try_pop(Task& task, int minPriority = INT_MIN) {
+        if (empty()) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_heap.empty() || _heap.front()._priority._priority < minPriority) {
+            return false;
+        }
+        std::pop_heap(_heap.begin(), _heap.end(), Less{});
+        task = std::move(_heap.back()._task);
+        _heap.pop_back();
+        _size.store(_heap.size());
+        return true;
+    }
+
+    /**
+     * @brief Checks whether the queue is empty without taking the lock
+     * @return `True` if there are no tasks
+     */
+    bool empty() const {
+        return 0 == _size.load();
+    }
+
+private:
+    struct Entry {
+        Task            _task;
+        TaskPriority    _priority;
+        std::uint64_t   _order;
+    };
+    // the heap keeps the most urgent task at the front
+    struct Less {
+        bool operator()(const Entry& lhs, const Entry& rhs) const {
+            if (lhs._priority._priority != rhs._priority._priority) {
+                return lhs._priority._priority < rhs._priority._priority;
+            }
+            if (lhs._priority._deadline != rhs._priority._deadline) {
+                return lhs._priority._deadline > rhs._priority._deadline;
+            }
+            return lhs._order > rhs._order;
+        }
+    };
+
+    std::mutex                  _mutex;
+    std::vector<Entry>          _heap;
+    std::uint64_t               _order = 0;
+    std::atomic<std::size_t>    _size{0};
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,97 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_task_queue_counters.hpp
+ * @brief A header file for the lock-free counters of the task queues of executors
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Counters of the tasks which pass through a queue of an executor
+ * @ingroup ie_dev_api_threading
+ * @details The time of every task in the queue is not stored: the queue sums the times the tasks were queued
+ * and the times they were taken by the workers. The difference of the sums plus the time the still queued
+ * tasks have waited up to now is the total wait time. Every sum keeps the number of its tasks in the low bits
+ * of the same atomic, so a snapshot never sees a task time without the task. The wait time wraps around
+ * after 2^44 microseconds (about 200 days of the summed wait) like a counter reset.
+ */
+class TaskQueueCounters {
+public:
+    /**
+     * @brief Returns the current time the counters use
+     * @return Microseconds of the steady clock
+     */
+    static std::uint64_t Now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Counts a task put to the queue. It should be called before the task is visible to the workers
+     * @param now The current time
+     */
+    void Queued(std::uint64_t now = Now()) {
+        _queued.fetch_add((now << countBits) + 1, std::memory_order_relaxed);
+        _queuedTasks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts a task taken from the queue by a worker
+     * @param now The current time
+     */
+    void Started(std::uint64_t now = Now()) {
+        _started.fetch_add((now << countBits) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Counts a task a worker took from the queue of another worker
+     */
+    void Stolen() {
+        _stolenTasks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Fills the queue counters of the statistics
+     * @param statistics The statistics to fill
+     */
+    void Fill(TaskExecutorStatistics& statistics) const {
+        // a task is queued before it is started, so reading the started ones first never sees more of them.
+        // A task counted in between is reported as still waiting
+        const auto started = _started.load(std::memory_order_acquire);
+        const auto queued = _queued.load(std::memory_order_acquire);
+        const auto queuedTasks = _queuedTasks.load(std::memory_order_relaxed);
+        const auto now = Now();
+        const auto depth = (queued - started) & countMask;
+        // with the counts cancelled out the difference of the sums is the difference of the times
+        const auto startedMinusQueued = (started - queued + depth) >> countBits;
+        statistics._queueDepth = depth;
+        statistics._queuedTasks = std::max(queuedTasks, depth);
+        statistics._startedTasks = statistics._queuedTasks - depth;
+        statistics._stolenTasks = _stolenTasks.load(std::memory_order_relaxed);
+        statistics._waitTime = (startedMinusQueued + depth * now) & timeMask;
+    }
+
+private:
+    static constexpr int countBits = 20;  // the queue of an executor never holds a million tasks
+    static constexpr std::uint64_t countMask = (std::uint64_t{1} << countBits) - 1;
+    static constexpr std::uint64_t timeMask = (std::uint64_t{1} << (64 - countBits)) - 1;
+
+    std::atomic<std::uint64_t> _queued{0};
+    std::atomic<std::uint64_t> _started{0};
+    std::atomic<std::uint64_t> _queuedTasks{0};
+    std::atomic<std::uint64_t> _stolenTasks{0};
+};
+
+}  // namespace InferenceEngine
@@ -5,9 +5,11 @@
 #pragma once
 
 #include <ie_api.h>
+#include <ie_system_conf.h>
 
 #include <tuple>
 #include <memory>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
@@ -85,4 +87,29 @@ INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet&
  * @return     `True` in case of success, `false` otherwise
  */
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadToSocket(int socket);
+
+/**
+ * @brief      Returns a mask of the first logical processors of the cores of the given type of a hybrid CPU
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  type         The core type
+ * @param[in]  ncores       The ncores
+ * @param[in]  processMask  The process mask the result is restricted to
+ * @return     A core affinity mask, `nullptr` if the CPU is not hybrid or the process can not run on the cores of the type
+ */
+INFERENCE_ENGINE_API_CPP(CpuSet) GetCoreTypeMask(CPUCoreType type, int ncores, const CpuSet& processMask);
+
+/**
+ * @brief      Returns a mask of the given logical processors which the process may run on
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  cpus          The logical processors, all the processors of the process mask if it is empty
+ * @param[in]  reservedCpus  The logical processors excluded from the mask
+ * @param[in]  smtSiblings   `false` keeps only the first logical processor of every physical core
+ * @param[in]  ncores        The ncores
+ * @param[in]  processMask   The process mask the result is restricted to
+ * @return     A core affinity mask, `nullptr` if no processor is left
+ */
+INFERENCE_ENGINE_API_CPP(CpuSet) GetCpuListMask(const std::vector<int>& cpus, const std::vector<int>& reservedCpus,
+                                                bool smtSiblings, int ncores, const CpuSet& processMask);
 }  //  namespace InferenceEngine
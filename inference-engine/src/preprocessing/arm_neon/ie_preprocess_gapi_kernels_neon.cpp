@@ -118,6 +118,123 @@ void calcRowArea_32F(float dst[], const float *src[], const Size& inSz,
     calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
 }
 
+// Resize (bi-linear, 8U, generic number of channels)
+template<int chanNum>
+void calcRowLinear_8UC_Impl(std::array<std::array<uint8_t*, 4>, chanNum> &dst,
+                            const uint8_t *src0[],
+                            const uint8_t *src1[],
+                            const short    alpha[],
+                            const short    mapsx[],
+                            const short    beta[],
+                                uint8_t    tmp[],
+                             const Size    &inSz,
+                             const Size    &outSz,
+                                    int    lpi) {
+    constexpr int half_nlanes = (v_uint8::nlanes / 2);
+
+    GAPI_DbgAssert(inSz.width*chanNum >= half_nlanes);
+    GAPI_DbgAssert(outSz.width >= half_nlanes);
+
+    for (int l = 0; l < lpi; ++l) {
+        short beta0 = beta[l];
+
+        // vertical pass
+        for (int w = 0; w < inSz.width*chanNum; ) {
+            for (; w <= inSz.width*chanNum - half_nlanes; w += half_nlanes) {
+                v_int16 s0 = v_reinterpret_as_s16(vx_load_expand(&src0[l][w]));
+                v_int16 s1 = v_reinterpret_as_s16(vx_load_expand(&src1[l][w]));
+                v_int16 t = v_mulhrs(s0 - s1, beta0) + s1;
+                v_pack_u_store(tmp + w, t);
+            }
+
+            if (w < inSz.width*chanNum) {
+                w = inSz.width*chanNum - half_nlanes;
+            }
+        }
+
+        // horizontal pass
+        for (int x = 0; x < outSz.width; ) {
+            for (; x <= outSz.width - half_nlanes; x += half_nlanes) {
+                v_int16 a0 = vx_load(&alpha[x]);        // as signed Q1.1.14
+                v_int16 sx = vx_load(&mapsx[x]);        // as integer (int16)
+                for (int c = 0; c < chanNum; ++c) {
+                    v_int16 t0 = v_gather_chan<chanNum>(tmp, sx, c, 0);
+                    v_int16 t1 = v_gather_chan<chanNum>(tmp, sx, c, 1);
+                    v_int16 d = v_mulhrs(t0 - t1, a0) + t1;
+                    v_pack_u_store(&dst[c][l][x], d);
+                }
+            }
+
+            if (x < outSz.width) {
+                x = outSz.width - half_nlanes;
+            }
+        }
+    }
+}
+
+// Resize (bi-linear, 8UC1)
+void calcRowLinear_8U(uint8_t *dst[],
+                      const uint8_t *src0[],
+                      const uint8_t *src1[],
+                      const short    alpha[],
+                      const short    /*clone*/[],
+                      const short    mapsx[],
+                      const short    beta[],
+                          uint8_t    tmp[],
+                      const Size&    inSz,
+                      const Size&    outSz,
+                              int    lpi) {
+    constexpr const int chanNum = 1;
+
+    std::array<std::array<uint8_t*, 4>, chanNum> dsts = {};
+    std::copy(dst, dst + lpi, dsts[0].begin());
+
+    calcRowLinear_8UC_Impl<chanNum>(dsts, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8U(C3, std::array<std::array<uint8_t*, 4>, 3> &dst,
+                      const uint8_t *src0[],
+                      const uint8_t *src1[],
+                      const short    alpha[],
+                      const short    /*clone*/[],
+                      const short    mapsx[],
+                      const short    beta[],
+                          uint8_t    tmp[],
+                      const Size&    inSz,
+                      const Size&    outSz,
+                              int    lpi) {
+    calcRowLinear_8UC_Impl<3>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 8UC4)
+void calcRowLinear_8U(C4, std::array<std::array<uint8_t*, 4>, 4> &dst,
+                      const uint8_t *src0[],
+                      const uint8_t *src1[],
+                      const short    alpha[],
+                      const short    /*clone*/[],
+                      const short    mapsx[],
+                      const short    beta[],
+                          uint8_t    tmp[],
+                      const Size&    inSz,
+                      const Size&    outSz,
+                              int    lpi) {
+    calcRowLinear_8UC_Impl<4>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                       const float *src0[],
+                       const float *src1[],
+                       const float  alpha[],
+                       const int    mapsx[],
+                       const float  beta[],
+                       const Size & inSz,
+                       const Size & outSz,
+                       int    lpi) {
+    calcRowLinear_32F_impl(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
+}
+
 void copyRow_8U(const uint8_t in[], uint8_t out[], int length) {
     copyRow_8U_impl(in, out, length);
 }
@@ -126,6 +243,16 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void convertNormalizeRow_8U32F(const uint8_t in[], float out[],
+                               float scale, float shift, int length) {
+    convertNormalizeRow_8U32F_impl(in, out, scale, shift, length);
+}
+
+void convertNormalizeRow_32F(const float in[], float out[],
+                             float scale, float shift, int length) {
+    convertNormalizeRow_32F_impl(in, out, scale, shift, length);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
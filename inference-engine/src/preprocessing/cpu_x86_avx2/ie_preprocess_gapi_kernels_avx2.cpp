@@ -550,6 +550,19 @@ void calcRowLinear_8U(C4, std::array<std::array<uint8_t*, 4>, 4> &dst,
     calcRowLinear_8UC_Impl<chanNum>(dst, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi);
 }
 
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                       const float *src0[],
+                       const float *src1[],
+                       const float  alpha[],
+                       const int    mapsx[],
+                       const float  beta[],
+                       const Size & inSz,
+                       const Size & outSz,
+                       int    lpi) {
+    calcRowLinear_32F_impl(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
+}
+
 void copyRow_8U(const uint8_t in[], uint8_t out[], int length) {
     copyRow_8U_impl(in, out, length);
 }
@@ -557,6 +570,16 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void convertNormalizeRow_8U32F(const uint8_t in[], float out[],
+                               float scale, float shift, int length) {
+    convertNormalizeRow_8U32F_impl(in, out, scale, shift, length);
+}
+
+void convertNormalizeRow_32F(const float in[], float out[],
+                             float scale, float shift, int length) {
+    convertNormalizeRow_32F_impl(in, out, scale, shift, length);
+}
+
 }  // namespace avx
 }  // namespace kernels
 }  // namespace gapi
@@ -15,6 +15,13 @@
 
 #define CV_AVX512_SKX 1
 
+// the file is compiled with AVX512DQ enabled, see ie_avx512_core_optimization_flags
+#ifdef CV_AVX_512DQ
+#undef CV_AVX_512DQ
+#endif
+
+#define CV_AVX_512DQ 1
+
 #define CV_CPU_HAS_SUPPORT_SSE2 1
 
 #ifdef CV_SIMD512
@@ -397,6 +404,39 @@ void calcRowLinear_8U(C4, std::array<std::array<uint8_t*, 4>, 4> &dst,
     calcRowLinear_8UC_Impl<chanNum>(dst, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi);
 }
 
+// Resize (bi-linear, 8UC1)
+void calcRowLinear_8U(uint8_t *dst[],
+                      const uint8_t *src0[],
+                      const uint8_t *src1[],
+                      const short    alpha[],
+                      const short    clone[],  // 4 clones of alpha
+                      const short    mapsx[],
+                      const short    beta[],
+                      uint8_t  tmp[],
+                      const Size    &inSz,
+                      const Size    &outSz,
+                      int      lpi) {
+    constexpr const int chanNum = 1;
+
+    std::array<std::array<uint8_t*, 4>, chanNum> dsts = {};
+    std::copy(dst, dst + lpi, dsts[0].begin());
+
+    calcRowLinear_8UC_Impl<chanNum>(dsts, src0, src1, alpha, clone, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                       const float *src0[],
+                       const float *src1[],
+                       const float  alpha[],
+                       const int    mapsx[],
+                       const float  beta[],
+                       const Size & inSz,
+                       const Size & outSz,
+                       int    lpi) {
+    calcRowLinear_32F_impl(dst, src0, src1, alpha, mapsx, beta, inSz, outSz, lpi);
+}
+
 void copyRow_8U(const uint8_t in[], uint8_t out[], int length) {
     copyRow_8U_impl(in, out, length);
 }
@@ -405,6 +445,16 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void convertNormalizeRow_8U32F(const uint8_t in[], float out[],
+                               float scale, float shift, int length) {
+    convertNormalizeRow_8U32F_impl(in, out, scale, shift, length);
+}
+
+void convertNormalizeRow_32F(const float in[], float out[],
+                             float scale, float shift, int length) {
+    convertNormalizeRow_32F_impl(in, out, scale, shift, length);
+}
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
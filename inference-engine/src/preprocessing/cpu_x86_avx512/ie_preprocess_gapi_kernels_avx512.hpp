@@ -200,6 +200,18 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void convertNormalizeRow_8U32F(const uint8_t in[],
+                                     float   out[],
+                                     float   scale,
+                                     float   shift,
+                                     int     length);
+
+void convertNormalizeRow_32F(const float in[],
+                                   float out[],
+                                   float scale,
+                                   float shift,
+                                   int   length);
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
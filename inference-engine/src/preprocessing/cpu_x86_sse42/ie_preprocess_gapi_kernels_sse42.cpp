@@ -1463,6 +1463,16 @@ void copyRow_32F(const float in[],
     copyRow_32F_impl(in, out, length);
 }
 
+void convertNormalizeRow_8U32F(const uint8_t in[], float out[],
+                               float scale, float shift, int length) {
+    convertNormalizeRow_8U32F_impl(in, out, scale, shift, length);
+}
+
+void convertNormalizeRow_32F(const float in[], float out[],
+                             float scale, float shift, int length) {
+    convertNormalizeRow_32F_impl(in, out, scale, shift, length);
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -13,6 +13,8 @@
 
 #include "debug.h"
 #include "ie_compound_blob.h"
+#include "ie_parallel.hpp"
+#include "blob_factory.hpp"
 #include <ie_input_info.hpp>
 
 #include <memory>
@@ -750,6 +752,58 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 using namespace Resize;
 
+namespace {
+
+Precision getRoiPrecision(const Blob::Ptr &roiBlob) {
+    // compound blobs are always made of U8 planes
+    return roiBlob->is<CompoundBlob>() ? Precision(Precision::U8) : roiBlob->getTensorDesc().getPrecision();
+}
+
+// U8 input passed to the FP32 network's blob is normalized as a part of the same pass, which replaces
+// the separate precision conversion and mean values subtraction done by a plugin. Mean images are
+// not supported here and are left to the plugin.
+PreprocEngine::Normalization getNormalization(const Blob::Ptr &roiBlob, const Blob::Ptr &outBlob,
+                                              const PreProcessInfo &info) {
+    const auto outPrecision = outBlob->getTensorDesc().getPrecision();
+    if (getRoiPrecision(roiBlob) == outPrecision) {
+        return {};
+    }
+
+    if (getRoiPrecision(roiBlob) != Precision::U8 || outPrecision != Precision::FP32) {
+        THROW_IE_EXCEPTION << "Pre-processing supports only U8 to FP32 precision conversion, but got "
+                           << getRoiPrecision(roiBlob) << " to " << outPrecision;
+    }
+
+    PreprocEngine::Normalization normalization;
+    if (info.getMeanVariant() == MEAN_VALUE) {
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            normalization.emplace_back(info[c]->meanValue, 1.f / info[c]->stdScale);
+        }
+    }
+    return normalization;
+}
+
+void convertNormalize(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob,
+                      const PreprocEngine::Normalization &normalization) {
+    const auto &desc = outBlob->getTensorDesc();
+    const auto &dims = desc.getDims();
+    const size_t C = dims[1];
+    const size_t planeSize = dims[2] * dims[3];
+    const bool interleaved = desc.getLayout() == NHWC;
+
+    const auto src = inBlob->cbuffer().as<const uint8_t*>() + inBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const auto dst = outBlob->buffer().as<float*>() + desc.getBlockingDesc().getOffsetPadding();
+
+    for (size_t i = 0; i < outBlob->size(); i++) {
+        const size_t c = interleaved ? i % C : (i / planeSize) % C;
+        const float mean  = normalization.empty() ? 0.f : normalization[c].first;
+        const float scale = normalization.empty() ? 1.f : normalization[c].second;
+        dst[i] = (static_cast<float>(src[i]) - mean) * scale;
+    }
+}
+
+}  // namespace
+
 
 /**
  * @brief This class stores pre-process information for exact input
@@ -761,6 +815,7 @@ class PreProcessData : public IPreProcessData {
     Blob::Ptr _roiBlob = nullptr;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
+    Blob::Ptr _tmp3 = nullptr;
 
     /**
      * @brief Pointer-to-implementation (PIMPL) hiding preprocessing implementation details.
@@ -773,6 +828,13 @@ class PreProcessData : public IPreProcessData {
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
 
+    /**
+     * @brief Pre-processing of the images of a batched ROI blob, one per item of the network input batch.
+     */
+    std::vector<std::unique_ptr<PreProcessData>> _batchItems;
+
+    void executeBatched(Blob::Ptr &outBlob, const PreProcessInfo& info, int batchSize);
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
@@ -818,12 +880,18 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    if (_roiBlob->is<BatchedBlob>()) {
+        executeBatched(outBlob, info, batchSize);
+        return;
+    }
+
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+    const auto normalization = getNormalization(_roiBlob, outBlob, info);
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize, normalization)) {
         return;
     }
 
@@ -838,6 +906,18 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
                               "formats.";
     }
 
+    // without G-API the input is resized in its own precision and converted afterwards
+    Blob::Ptr dstBlob = outBlob;
+    if (getRoiPrecision(_roiBlob) != outBlob->getTensorDesc().getPrecision()) {
+        if (!_tmp3 || _tmp3->getTensorDesc().getDims() != outBlob->getTensorDesc().getDims() ||
+            _tmp3->getTensorDesc().getLayout() != outBlob->getTensorDesc().getLayout()) {
+            _tmp3 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(),
+                                               outBlob->getTensorDesc().getLayout()});
+            _tmp3->allocate();
+        }
+        dstBlob = _tmp3;
+    }
+
     Blob::Ptr res_in, res_out;
     if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
         if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
@@ -858,18 +938,19 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         res_in = _roiBlob;
     }
 
-    if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp2 || _tmp2->size() != outBlob->size()) {
-            if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+    if (dstBlob->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp2 || _tmp2->size() != dstBlob->size() ||
+            _tmp2->getTensorDesc().getPrecision() != dstBlob->getTensorDesc().getPrecision()) {
+            if (dstBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp2 = make_shared_blob<float>({Precision::FP32, dstBlob->getTensorDesc().getDims(), Layout::NCHW});
             } else {
-                _tmp2 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+                _tmp2 = make_shared_blob<uint8_t>({Precision::U8, dstBlob->getTensorDesc().getDims(), Layout::NCHW});
             }
             _tmp2->allocate();
         }
         res_out = _tmp2;
     } else {
-        res_out = outBlob;
+        res_out = dstBlob;
     }
 
     {
@@ -879,11 +960,65 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
 
     if (res_out == _tmp2) {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_after)
-        blob_copy(_tmp2, outBlob);
+        blob_copy(_tmp2, dstBlob);
+    }
+
+    if (dstBlob != outBlob) {
+        convertNormalize(dstBlob, outBlob, normalization);
+    }
+}
+
+void PreProcessData::executeBatched(Blob::Ptr &outBlob, const PreProcessInfo& info, int batchSize) {
+    auto batched = _roiBlob->as<BatchedBlob>();
+    if (!outBlob->is<MemoryBlob>()) {
+        THROW_IE_EXCEPTION << "Unsupported network's input blob type: expected MemoryBlob";
+    }
+
+    const auto& outDesc = outBlob->getTensorDesc();
+    const auto& outDims = outDesc.getDims();
+    const size_t images = batchSize > 0 ? std::min(batched->size(), static_cast<size_t>(batchSize)) : batched->size();
+    if (outDims.size() != 4 || images > outDims[0]) {
+        THROW_IE_EXCEPTION << "Input pre-processing is called with " << images << " images of a batched blob for "
+                              "the network input of shape " << details::dumpVec(outDims);
+    }
+
+    while (_batchItems.size() < images) {
+        _batchItems.emplace_back(new PreProcessData());
     }
+
+    const TensorDesc imageDesc(outDesc.getPrecision(), {1, outDims[1], outDims[2], outDims[3]}, outDesc.getLayout());
+    const size_t imageSize = outDesc.getBlockingDesc().getStrides()[0] * outDesc.getPrecision().size();
+    auto data = outBlob->buffer().as<uint8_t*>() + outDesc.getBlockingDesc().getOffsetPadding() * outDesc.getPrecision().size();
+
+    // Every image is resized into its own item of the batch by its own engine, so the images are processed
+    // in parallel and the graphs compiled for the sizes of the images are kept between the inferences
+    parallel_for(images, [&](size_t i) {
+        auto imageBlob = make_blob_with_precision(imageDesc, data + i * imageSize);
+        _batchItems[i]->setRoiBlob(batched->getBlob(i));
+        _batchItems[i]->execute(imageBlob, info, true, 1);
+    });
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    if (src->is<BatchedBlob>()) {
+        const auto& dstDesc = dst->getTensorDesc();
+        const auto& dstDims = dstDesc.getDims();
+        if (dstDims.size() != 4 || src->size() > dstDims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. The batched blob has " << src->size()
+                               << " images for the network input of shape " << details::dumpVec(dstDims);
+        }
+
+        // every image is checked against one item of the network input batch
+        auto dstImage = make_blob_with_precision(TensorDesc(dstDesc.getPrecision(),
+                                                            {1, dstDims[1], dstDims[2], dstDims[3]},
+                                                            dstDesc.getLayout()));
+        auto batched = src->as<BatchedBlob>();
+        for (size_t i = 0; i < batched->size(); i++) {
+            isApplicable(batched->getBlob(i), dstImage);
+        }
+        return;
+    }
+
     // if G-API pre-processing is used, let it check that pre-processing is applicable
     if (PreprocEngine::useGAPI()) {
         PreprocEngine::checkApplicabilityGAPI(src, dst);
@@ -48,6 +48,8 @@ public:
 
     /**
      * @brief Executes input pre-processing with a given pre-processing information.
+     * If the ROI blob is U8 and the output blob is FP32, the precision conversion and the mean values
+     * and scales from the pre-processing info are applied within the same pass.
      * @param outBlob pre-processed output blob to be used for inference.
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
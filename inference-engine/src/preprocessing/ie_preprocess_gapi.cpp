@@ -535,6 +535,24 @@ convertColorPlanar(const std::vector<cv::GMat>& inputs,
     return planes;
 }
 
+// convert planes to FP32 applying per-channel normalization in the same row-wise pass
+std::vector<cv::GMat> convertNormalize(const std::vector<cv::GMat>& planes,
+                                       const PreprocEngine::Normalization& normalization) {
+    if (!normalization.empty() && normalization.size() != planes.size()) {
+        THROW_IE_EXCEPTION << "[G-API] number of normalization values " << normalization.size()
+                           << " != number of channels " << planes.size();
+    }
+
+    std::vector<cv::GMat> normalized;
+    normalized.reserve(planes.size());
+    for (size_t i = 0; i < planes.size(); i++) {
+        const auto mean  = normalization.empty() ? 0.f : normalization[i].first;
+        const auto scale = normalization.empty() ? 1.f : normalization[i].second;
+        normalized.emplace_back(gapi::ConvertNormalizePlane::on(planes[i], mean, scale));
+    }
+    return normalized;
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             Layout in_layout,
@@ -542,11 +560,19 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
                             ColorFormat output_color_format,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            const PreprocEngine::Normalization& normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
 
+    // the only precision conversion supported is U8 -> FP32 fused with the normalization
+    const bool convert_precision = precision != out_precision || !normalization.empty();
+    if (convert_precision && out_precision != CV_32F) {
+        THROW_IE_EXCEPTION << "[G-API] precision conversion is supported to FP32 network's blob only";
+    }
+
     std::vector<cv::GMat> inputs;  // 1 element if NHWC, C elements if NCHW
     if (in_layout == NHWC) {
         inputs.resize(1);
@@ -602,6 +628,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (convert_precision) {
+            planes = convertNormalize(planes, normalization);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -645,6 +675,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
+    if (convert_precision) {
+        outputs = convertNormalize(outputs, normalization);
+    }
+
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
         outputs = merge(outputs, out_desc.d.C);
@@ -654,7 +688,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()), _lastRois(_lastComp.size()) {}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -665,6 +699,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. normalization values have changed (kernel parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -672,13 +707,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -694,7 +731,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -806,59 +843,75 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     // to suppress unused warnings
     (void)(omp_serial);
 
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
-    // possible that all slices are processed by the same thread.
+    // Split the work into `total_slices` slices, where `total_slices` is provided by the parallel
+    // runtime and assumed to be number of threads used.  However it is not guaranteed that an
+    // actual number of threads will be as assumed, so it possible that all slices are processed by
+    // the same thread.
+    //
+    // The slices are arranged into groups: images of the batch are distributed among the groups
+    // and every slice of a group processes its own tile of rows of the images. So a single image
+    // is split into as many row tiles as there are slices, while a batch that is not smaller than
+    // the number of slices is processed image by image in parallel.
     //
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
 
+        const int row_tiles = std::max(1, total_slices / batch_size);
+        const int groups    = std::min(batch_size, total_slices / row_tiles);
+        const int group     = slice_n / row_tiles;
+        const int tile      = slice_n % row_tiles;
+
         auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+        auto& compiled_roi = _lastRois[slice_n];
 
-            using cv::gapi::own::Rect;
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+        using cv::gapi::own::Rect;
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+        auto lines_per_thread = output_plane_mats[0].rows / row_tiles;
+        const auto remainder = output_plane_mats[0].rows % row_tiles;
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+        // remainder shows how many tiles must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (tile < remainder) {
+            lines_per_thread++;  // 1 additional row
+            roi_y = tile * lines_per_thread;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to tile have lines rows
+            roi_y = remainder * (lines_per_thread + 1) + (tile - remainder) * lines_per_thread;
+        }
+
+        if (group >= groups || lines_per_thread <= 0) {
+            // no job for current thread: drop the outdated compiled graph to not use it later
+            if (Update::NOTHING != update) {
+                compiled = cv::GCompiled();
             }
+            return;
+        }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        const auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+        if (Update::NOTHING != update || !compiled || compiled_roi != roi) {
+            //  need to compile (or reshape) own object for a particular ROI
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
+            if (Update::REBUILD == update || !compiled) {
                 auto& computation = lastComputation.value();
                 compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descrs_of(input_plane_mats), std::move(args));
             }
+            compiled_roi = roi;
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        for (int i = group; i < batch_size; i += groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -876,7 +929,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const Normalization &normalization) {
 
     validateBlob(inBlob);
 
@@ -918,10 +971,10 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  normalization };
     const Update update = needUpdate(thisCall);
 
-    Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
         _lastCall = cv::util::make_optional(std::move(thisCall));
 
@@ -938,7 +991,9 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            algorithm,
                            in_fmt,
                            out_fmt,
-                           get_cv_depth(in_desc_ie)));
+                           get_cv_depth(in_desc_ie),
+                           get_cv_depth(out_desc_ie),
+                           normalization));
         }
     }
 
@@ -952,7 +1007,8 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 }
 
 bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization &normalization) {
     if (!useGAPI()) {
         return false;
     }
@@ -976,7 +1032,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -985,7 +1041,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 
     default:
@@ -995,7 +1051,7 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 }
 }  // namespace InferenceEngine
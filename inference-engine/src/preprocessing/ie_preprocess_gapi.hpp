@@ -9,6 +9,7 @@
 #include "ie_input_info.hpp"
 
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -21,12 +22,23 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    /**
+     * @brief Per-channel pairs of a mean value and a scale (1 / std) applied when the input is converted
+     * to the FP32 network's blob, empty if the values are only converted
+     */
+    using Normalization = std::vector<std::pair<float, float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
+    // the graph is kept to compile it for the slices which had no job on the previous calls
+    Opt<cv::GComputation> _lastComputation;
     std::vector<cv::GCompiled> _lastComp;
+    std::vector<cv::gapi::own::Rect> _lastRois;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
@@ -46,7 +58,7 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const Normalization &normalization);
 
 public:
     PreprocEngine();
@@ -54,7 +66,8 @@ public:
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        const Normalization &normalization = {});
 };
 
 }  // namespace InferenceEngine
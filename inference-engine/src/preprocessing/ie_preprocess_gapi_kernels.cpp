@@ -45,11 +45,8 @@ namespace kernels {
 
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
-// AVX512 implementation of wide universal intrinsics is slower than AVX2.
-// It is turned off until the cause isn't found out.
-#if 0
 #ifdef HAVE_AVX512
-    if (with_cpu_x86_avx512f()) {
+    if (with_cpu_x86_avx512_core()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             avx512::mergeRow_8UC2(ins[0], ins[1], out, length);
             return;
@@ -90,7 +87,6 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
         }
     }
 #endif  // HAVE_AVX512
-#endif
 
 #ifdef HAVE_AVX2
     if (with_cpu_x86_avx2()) {
@@ -235,7 +231,7 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
 #ifdef HAVE_AVX512
-    if (with_cpu_x86_avx512f()) {
+    if (with_cpu_x86_avx512_core()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             avx512::splitRow_8UC2(in, outs[0], outs[1], length);
             return;
@@ -554,11 +550,8 @@ GAPI_FLUID_KERNEL(FSplit4, Split4, false) {
 
 template<typename T>
 static void chanToPlaneRow(const uint8_t* in, int chan, int chs, uint8_t* out, int length) {
-// AVX512 implementation of wide universal intrinsics is slower than AVX2.
-// It is turned off until the cause isn't found out.
-#if 0
     #ifdef HAVE_AVX512
-    if (with_cpu_x86_avx512f()) {
+    if (with_cpu_x86_avx512_core()) {
         if (std::is_same<T, uint8_t>::value && chs == 1) {
             avx512::copyRow_8U(in, out, length);
             return;
@@ -572,7 +565,6 @@ static void chanToPlaneRow(const uint8_t* in, int chan, int chs, uint8_t* out, i
         }
     }
     #endif  // HAVE_AVX512
-#endif
 
     #ifdef HAVE_AVX2
     if (with_cpu_x86_avx2()) {
@@ -910,6 +902,36 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
         dst[l] = out.OutLine<T>(l);
     }
 
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 64 && outSz.width >= 32) {
+                avx512::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                         reinterpret_cast<const uint8_t**>(src0),
+                                         reinterpret_cast<const uint8_t**>(src1),
+                                         reinterpret_cast<const short*>(alpha),
+                                         reinterpret_cast<const short*>(clone),
+                                         reinterpret_cast<const short*>(mapsx),
+                                         reinterpret_cast<const short*>(beta),
+                                         reinterpret_cast<uint8_t*>(tmp),
+                                         inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                      reinterpret_cast<const float**>(src0),
+                                      reinterpret_cast<const float**>(src1),
+                                      reinterpret_cast<const float*>(alpha),
+                                      reinterpret_cast<const int*>(mapsx),
+                                      reinterpret_cast<const float*>(beta),
+                                      inSz, outSz, lpi);
+            return;
+        }
+    }
+    #endif  // HAVE_AVX512
+
     #ifdef HAVE_AVX2
     if (with_cpu_x86_avx2()) {
         if (std::is_same<T, uint8_t>::value) {
@@ -927,6 +949,17 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
                 return;
             }
         }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                   reinterpret_cast<const float**>(src0),
+                                   reinterpret_cast<const float**>(src1),
+                                   reinterpret_cast<const float*>(alpha),
+                                   reinterpret_cast<const int*>(mapsx),
+                                   reinterpret_cast<const float*>(beta),
+                                   inSz, outSz, lpi);
+            return;
+        }
     }
     #endif
 
@@ -960,6 +993,34 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
     }
     #endif  // HAVE_SSE
 
+    #ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        if (inSz.width >= 16 && outSz.width >= 8) {
+            neon::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                   reinterpret_cast<const uint8_t**>(src0),
+                                   reinterpret_cast<const uint8_t**>(src1),
+                                   reinterpret_cast<const short*>(alpha),
+                                   reinterpret_cast<const short*>(clone),
+                                   reinterpret_cast<const short*>(mapsx),
+                                   reinterpret_cast<const short*>(beta),
+                                   reinterpret_cast<uint8_t*>(tmp),
+                                   inSz, outSz, lpi);
+            return;
+        }
+    }
+
+    if (std::is_same<T, float>::value) {
+        neon::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                reinterpret_cast<const float**>(src0),
+                                reinterpret_cast<const float**>(src1),
+                                reinterpret_cast<const float*>(alpha),
+                                reinterpret_cast<const int*>(mapsx),
+                                reinterpret_cast<const float*>(beta),
+                                inSz, outSz, lpi);
+        return;
+    }
+    #endif  // HAVE_NEON
+
     for (int l = 0; l < lpi; l++) {
         constexpr static const auto unity = Mapper::unity;
 
@@ -1075,6 +1136,23 @@ static void calcRowLinearC(const cv::gapi::fluid::View  & in,
     }
 #endif  // HAVE_SSE
 
+#ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        if (inSz.width >= 16 && outSz.width >= 8) {
+            neon::calcRowLinear_8UC<numChan>(dst,
+                                             reinterpret_cast<const uint8_t**>(src0),
+                                             reinterpret_cast<const uint8_t**>(src1),
+                                             reinterpret_cast<const short*>(alpha),
+                                             reinterpret_cast<const short*>(clone),
+                                             reinterpret_cast<const short*>(mapsx),
+                                             reinterpret_cast<const short*>(beta),
+                                             reinterpret_cast<uint8_t*>(tmp),
+                                             inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif  // HAVE_NEON
+
     auto length = out[0].get().length();
 
     for (int l = 0; l < lpi; l++) {
@@ -1407,7 +1485,7 @@ static void calcAreaRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer
         auto dst = out.OutLine<T>(l);
 
         #ifdef HAVE_AVX512
-        if (with_cpu_x86_avx512f()) {
+        if (with_cpu_x86_avx512_core()) {
             if (std::is_same<T, uchar>::value) {
                 avx512::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
                                        reinterpret_cast<const uchar**>(src),
@@ -1496,6 +1574,34 @@ static void calcAreaRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer
         }
         #endif  // HAVE_SSE
 
+        #ifdef HAVE_NEON
+        if (std::is_same<T, uchar>::value) {
+            neon::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
+                                 reinterpret_cast<const uchar**>(src),
+                                 inSz, outSz,
+                                 static_cast<Q0_16>(ymapper.alpha),
+                                 reinterpret_cast<const MapperUnit8U&>(ymap),
+                                 xmaxdf[0],
+                                 reinterpret_cast<const short*>(xindex),
+                                 reinterpret_cast<const Q0_16*>(xalpha),
+                                 reinterpret_cast<Q8_8*>(vbuf));
+            continue;  // next l = 0, ..., lpi-1
+        }
+
+        if (std::is_same<T, float>::value) {
+            neon::calcRowArea_32F(reinterpret_cast<float*>(dst),
+                                  reinterpret_cast<const float**>(src),
+                                  inSz, outSz,
+                                  static_cast<float>(ymapper.alpha),
+                                  reinterpret_cast<const MapperUnit32F&>(ymap),
+                                  xmaxdf[0],
+                                  reinterpret_cast<const int*>(xindex),
+                                  reinterpret_cast<const float*>(xalpha),
+                                  reinterpret_cast<float*>(vbuf));
+            continue;
+        }
+        #endif  // HAVE_NEON
+
         // vertical pass
         int y_1st = ymap.index0;
         int ylast = ymap.index1 - 1;
@@ -2104,17 +2210,12 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
 
         int buf_width = out.length();
 
-// AVX512 implementation of wide universal intrinsics is slower than AVX2.
-// It is turned off until the cause isn't found out.
-    #if 0
     #ifdef HAVE_AVX512
         if (with_cpu_x86_avx512_core()) {
-            #define CV_AVX_512DQ 1
             avx512::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
             return;
         }
     #endif  // HAVE_AVX512
-    #endif
 
     #ifdef HAVE_AVX2
         if (with_cpu_x86_avx2()) {
@@ -2155,17 +2256,12 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
         int buf_width = out.length();
         GAPI_DbgAssert(in_u.length() ==  in_v.length());
 
-        // AVX512 implementation of wide universal intrinsics is slower than AVX2.
-        // It is turned off until the cause isn't found out.
-        #if 0
         #ifdef HAVE_AVX512
             if (with_cpu_x86_avx512_core()) {
-               #define CV_AVX_512DQ 1
                avx512::calculate_i420_to_rgb(y_rows, u_row, v_row, out_rows, buf_width);
                return;
             }
         #endif  // HAVE_AVX512
-        #endif
 
         #ifdef HAVE_AVX2
             if (with_cpu_x86_avx2()) {
@@ -2188,6 +2284,68 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
         calculate_i420_to_rgb_fallback(y_rows, u_row, v_row, out_rows, buf_width);
     }
 };
+
+//----------------------------------------------------------------------
+
+static void convertNormalizeRow(const uint8_t* in, int depth, float* out, float mean, float scale, int length) {
+    const float shift = -mean * scale;
+    const auto in32F = reinterpret_cast<const float*>(in);
+
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (depth == CV_8U) {
+            avx512::convertNormalizeRow_8U32F(in, out, scale, shift, length);
+        } else {
+            avx512::convertNormalizeRow_32F(in32F, out, scale, shift, length);
+        }
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (depth == CV_8U) {
+            avx::convertNormalizeRow_8U32F(in, out, scale, shift, length);
+        } else {
+            avx::convertNormalizeRow_32F(in32F, out, scale, shift, length);
+        }
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (depth == CV_8U) {
+            convertNormalizeRow_8U32F(in, out, scale, shift, length);
+        } else {
+            convertNormalizeRow_32F(in32F, out, scale, shift, length);
+        }
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    if (depth == CV_8U) {
+        neon::convertNormalizeRow_8U32F(in, out, scale, shift, length);
+    } else {
+        neon::convertNormalizeRow_32F(in32F, out, scale, shift, length);
+    }
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        const float value = (depth == CV_8U) ? static_cast<float>(in[x]) : in32F[x];
+        out[x] = value * scale + shift;
+    }
+}
+
+GAPI_FLUID_KERNEL(FConvertNormalizePlane, ConvertNormalizePlane, false) {
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale,
+                    cv::gapi::fluid::Buffer& out) {
+        convertNormalizeRow(in.InLineB(0), in.meta().depth, out.OutLine<float>(), mean, scale, in.length());
+    }
+};
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2214,6 +2372,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FSplit4
         , FNV12toRGB
         , FI420toRGB
+        , FConvertNormalizePlane
         >();
 }
 
@@ -143,6 +143,15 @@ namespace gapi {
         }
     };
 
+    // converts the plane to FP32 and normalizes it: out = (in - mean) / std, where scale = 1 / std
+    G_TYPED_KERNEL(ConvertNormalizePlane, <cv::GMat(cv::GMat, float, float)>, "com.intel.ie.convert_normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, float /*mean*/, float /*scale*/) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+            return in.withType(CV_32F, 1);
+        }
+    };
+
     cv::gapi::GKernelPackage preprocKernels();
 
 }  // namespace gapi
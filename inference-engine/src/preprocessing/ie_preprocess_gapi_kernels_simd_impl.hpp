@@ -783,6 +783,153 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+//------------------------------------------------------------------------------
+
+// out = in * scale + shift, i.e. (in - mean) / std with scale = 1 / std and shift = -mean / std
+inline void convertNormalizeRow_8U32F_impl(const uint8_t in[], float out[],
+                                           float scale, float shift, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vscale = vx_setall_f32(scale);
+    const v_float32 vshift = vx_setall_f32(shift);
+
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 x = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[l])));
+        vx_store(&out[l], v_fma(x, vscale, vshift));
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = static_cast<float>(in[l]) * scale + shift;
+    }
+}
+
+inline void convertNormalizeRow_32F_impl(const float in[], float out[],
+                                         float scale, float shift, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vscale = vx_setall_f32(scale);
+    const v_float32 vshift = vx_setall_f32(shift);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], v_fma(vx_load(&in[l]), vscale, vshift));
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = in[l] * scale + shift;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// Resize (bi-linear, 32F)
+inline void calcRowLinear_32F_impl(float *dst[],
+                                   const float *src0[],
+                                   const float *src1[],
+                                   const float  alpha[],
+                                   const int    mapsx[],
+                                   const float  beta[],
+                                   const Size & inSz,
+                                   const Size & outSz,
+                                   int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+#endif
+
+    if (!xRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+        #if MANUAL_SIMD
+            v_float32 vbeta0 = vx_setall_f32(beta0);
+
+            for (; x <= outSz.width - nlanes; x += nlanes) {
+                v_float32 alpha0 = vx_load(&alpha[x]);
+                v_int32   sx     = vx_load(&mapsx[x]);
+
+                v_float32 s00, s01;
+                v_lut_deinterleave(src0[l], sx, s00, s01);
+
+            //  res0 = s00*alpha0 + s01*alpha1
+                v_float32 res0 = v_fma(s00 - s01, alpha0, s01);
+
+                if (!yRatioEq1) {
+                    v_float32 s10, s11;
+                    v_lut_deinterleave(src1[l], sx, s10, s11);
+
+                    v_float32 res1 = v_fma(s10 - s11, alpha0, s11);
+
+                //  res0 = res0*beta0 + res1*beta1
+                    res0 = v_fma(res0 - res1, vbeta0, res1);
+                }
+
+                vx_store(&dst[l][x], res0);
+            }
+        #endif
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                if (!yRatioEq1) {
+                    float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                    res0 = beta0*res0 + beta1*res1;
+                }
+                dst[l][x] = res0;
+            }
+        }
+    } else if (!yRatioEq1) {
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+
+            int x = 0;
+
+        #if MANUAL_SIMD
+            v_float32 vbeta0 = vx_setall_f32(beta0);
+
+            for (; x <= length - nlanes; x += nlanes) {
+                v_float32 s0 = vx_load(&src0[l][x]);
+                v_float32 s1 = vx_load(&src1[l][x]);
+
+            //  d = s0*beta0 + s1*beta1
+                vx_store(&dst[l][x], v_fma(s0 - s1, vbeta0, s1));
+            }
+        #endif
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+    } else {
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            copyRow_32F_impl(src0[l], dst[l], length);
+        }
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -0,0 +1,353 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_bin_ir_parser.hpp"
+
+#include <ie_bin_ir_format.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/graph_arena.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+
+using namespace InferenceEngine;
+namespace BinaryIR = InferenceEngine::details::BinaryIR;
+
+namespace {
+
+// A view of the model memory which checks the references between the sections
+class Model {
+public:
+    explicit Model(const Blob::CPtr& blob) :
+        _blob(blob), _data(blob->cbuffer().as<const char*>()), _size(blob->byteSize()) {
+        if (_size < sizeof(BinaryIR::Header) || !BinaryIR::HasMagic(_data, _size)) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! The model has no header";
+        }
+        if (reinterpret_cast<std::uintptr_t>(_data) % BinaryIR::DataAlignment != 0) {
+            THROW_IE_EXCEPTION << "The memory of the binary IR is not aligned to " << BinaryIR::DataAlignment << " bytes";
+        }
+        _header = reinterpret_cast<const BinaryIR::Header*>(_data);
+        if (_header->version != BinaryIR::Version) {
+            THROW_IE_EXCEPTION << "Binary IR version " << _header->version << " is not supported, the reader supports version "
+                               << BinaryIR::Version;
+        }
+        for (auto section : {&_header->nodes, &_header->inputs, &_header->attributes, &_header->data,
+                             &_header->strings, &_header->parameters, &_header->results, &_header->weights}) {
+            if (section->offset > _size || section->size > _size - section->offset ||
+                section->offset % BinaryIR::DataAlignment != 0) {
+                THROW_IE_EXCEPTION << "Invalid binary IR! A section is out of the model";
+            }
+        }
+        if (_header->strings.size == 0 || _data[_header->strings.offset + _header->strings.size - 1] != '\0') {
+            THROW_IE_EXCEPTION << "Invalid binary IR! The strings are not terminated";
+        }
+    }
+
+    const BinaryIR::Header& header() const {
+        return *_header;
+    }
+
+    const Blob::CPtr& blob() const {
+        return _blob;
+    }
+
+    template <typename T>
+    uint64_t count(const BinaryIR::Section& section) const {
+        return section.size / sizeof(T);
+    }
+
+    template <typename T>
+    const T* records(const BinaryIR::Section& section, uint64_t first, uint64_t count) const {
+        if (first > this->count<T>(section) || count > this->count<T>(section) - first) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! A node refers to records out of the section";
+        }
+        return reinterpret_cast<const T*>(_data + section.offset) + first;
+    }
+
+    const char* string(uint64_t id) const {
+        if (id >= _header->strings.size) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! The string " << id << " is out of the section";
+        }
+        return _data + _header->strings.offset + id;
+    }
+
+    template <typename T>
+    std::vector<T> array(uint64_t offset, uint64_t count) const {
+        if (offset % sizeof(T) != 0) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! An array is not aligned";
+        }
+        auto values = records<T>({_header->data.offset, _header->data.size}, offset / sizeof(T), count);
+        return {values, values + count};
+    }
+
+    char* weights(uint64_t offset, uint64_t size) const {
+        if (offset > _header->weights.size || size > _header->weights.size - offset) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! A buffer is out of the weights section";
+        }
+        return const_cast<char*>(_data) + _header->weights.offset + offset;
+    }
+
+private:
+    Blob::CPtr                  _blob;
+    const char*                 _data;
+    size_t                      _size;
+    const BinaryIR::Header*     _header = nullptr;
+};
+
+class AttributeReader : public ngraph::AttributeVisitor {
+public:
+    AttributeReader(const Model& model, const BinaryIR::Node& node) :
+        _model(model),
+        _attributes(model.records<BinaryIR::Attribute>(model.header().attributes, node.firstAttribute, node.attributesCount)),
+        _count(node.attributesCount) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (find(name) != nullptr) {
+            THROW_IE_EXCEPTION << "Binary IR reader does not support the attribute " << name
+                               << " of the type " << adapter.get_type_info().name;
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Buffer)) {
+            if (attribute->count != adapter.size()) {
+                THROW_IE_EXCEPTION << "Invalid binary IR! The buffer " << name << " has " << attribute->count
+                                   << " bytes while the operation expects " << adapter.size();
+            }
+            std::memcpy(adapter.get_ptr(), _model.weights(attribute->value, attribute->count), attribute->count);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::String)) {
+            adapter.set(_model.string(attribute->value));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Bool)) {
+            adapter.set(attribute->value != 0);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Int64)) {
+            adapter.set(static_cast<int64_t>(attribute->value));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Double)) {
+            double value = 0;
+            std::memcpy(&value, &attribute->value, sizeof(value));
+            adapter.set(value);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        setInts(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Floats)) {
+            adapter.set(_model.array<float>(attribute->value, attribute->count));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Doubles)) {
+            adapter.set(_model.array<double>(attribute->value, attribute->count));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Strings)) {
+            std::vector<std::string> values;
+            for (auto id : _model.array<uint32_t>(attribute->value, attribute->count)) {
+                values.emplace_back(_model.string(id));
+            }
+            adapter.set(values);
+        }
+    }
+
+    const BinaryIR::Attribute* find(const std::string& name, BinaryIR::AttributeType type) const {
+        auto attribute = find(name);
+        if (attribute != nullptr && attribute->type != type) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! The attribute " << name << " has unexpected type";
+        }
+        return attribute;
+    }
+
+private:
+    const BinaryIR::Attribute* find(const std::string& name) const {
+        for (uint32_t i = 0; i < _count; i++) {
+            if (name == _model.string(_attributes[i].name)) {
+                return &_attributes[i];
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    void setInts(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        if (auto attribute = find(name, BinaryIR::AttributeType::Int64s)) {
+            auto values = _model.array<int64_t>(attribute->value, attribute->count);
+            adapter.set(std::vector<T>(values.begin(), values.end()));
+        }
+    }
+
+    const Model&                    _model;
+    const BinaryIR::Attribute*      _attributes;
+    uint32_t                        _count;
+};
+
+// the data of the Constants stays in the model memory
+std::shared_ptr<ngraph::Node> CreateConstant(const Model& model, AttributeReader& visitor) {
+    ngraph::element::Type type;
+    ngraph::Shape shape;
+    visitor.on_attribute("element_type", type);
+    visitor.on_attribute("shape", shape);
+    auto value = visitor.find("value", BinaryIR::AttributeType::Buffer);
+    if (value == nullptr || value->count < std::ceil(ngraph::shape_size(shape) * type.bitwidth() / 8.f)) {
+        THROW_IE_EXCEPTION << "Invalid binary IR! The Constant size and shape are inconsistent";
+    }
+    using SharedBuffer = ngraph::runtime::SharedBuffer<Blob::CPtr>;
+    auto buffer = std::make_shared<SharedBuffer>(model.weights(value->value, value->count), value->count, model.blob());
+    return ngraph::make_shared_in_arena<ngraph::op::Constant>(type, shape, buffer);
+}
+
+}  // namespace
+
+BinaryIRParser::BinaryIRParser(const std::vector<IExtensionPtr>& exts) {
+    _opsets = {ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(), ngraph::get_opset4()};
+    for (const auto& ext : exts) {
+        for (const auto& opset : ext->getOpSets()) {
+            _opsets.push_back(opset.second);
+        }
+    }
+}
+
+ngraph::OpSet& BinaryIRParser::getOpSet(const ngraph::NodeTypeInfo& typeInfo) {
+    auto it = _typeOpSets.find(typeInfo);
+    if (it != _typeOpSets.end()) {
+        return *it->second;
+    }
+    for (auto& opset : _opsets) {
+        const auto& types = opset.get_types_info();
+        auto type = types.find(typeInfo);
+        if (type != types.end()) {
+            _typeOpSets.emplace(*type, &opset);
+            return opset;
+        }
+    }
+    THROW_IE_EXCEPTION << "Cannot create the operation " << typeInfo.name << " of version " << typeInfo.version
+                       << ": neither the default opsets nor the opsets of the extensions contain it";
+}
+
+std::shared_ptr<ngraph::Function> BinaryIRParser::parse(const Blob::CPtr& blob) {
+    // All graph objects of the network are allocated from one arena like for the XML IR
+    ngraph::GraphArena::Scope arenaScope(std::make_shared<ngraph::GraphArena>());
+
+    Model model(blob);
+    const auto& header = model.header();
+    auto nodesCount = model.count<BinaryIR::Node>(header.nodes);
+    auto records = model.records<BinaryIR::Node>(header.nodes, 0, nodesCount);
+
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    nodes.reserve(nodesCount);
+    std::vector<std::shared_ptr<ngraph::op::Assign>> assigns;
+    std::map<std::string, std::shared_ptr<ngraph::Node>> readValues;
+    for (uint64_t i = 0; i < nodesCount; i++) {
+        const auto& record = records[i];
+        ngraph::NodeTypeInfo typeInfo{model.string(record.type), record.version};
+
+        ngraph::OutputVector inputs;
+        auto inputRecords = model.records<BinaryIR::Input>(header.inputs, record.firstInput, record.inputsCount);
+        for (uint32_t j = 0; j < record.inputsCount; j++) {
+            const auto& input = inputRecords[j];
+            if (input.node >= nodes.size() || input.port >= nodes[input.node]->get_output_size()) {
+                THROW_IE_EXCEPTION << "Invalid binary IR! The input " << j << " of the node " << model.string(record.name)
+                                   << " does not refer to an output of a previous node";
+            }
+            inputs.emplace_back(nodes[input.node]->output(input.port));
+        }
+
+        AttributeReader visitor(model, record);
+        std::shared_ptr<ngraph::Node> node;
+        if (typeInfo == ngraph::op::Constant::type_info) {
+            node = CreateConstant(model, visitor);
+        } else {
+            node.reset(getOpSet(typeInfo).get_factory_registry().create(typeInfo));
+            node->set_arguments(inputs);
+            if (node->visit_attributes(visitor))
+                node->constructor_validate_and_infer_types();
+        }
+        node->set_friendly_name(model.string(record.name));
+
+        if (auto assign = ngraph::as_type_ptr<ngraph::op::Assign>(node)) {
+            assigns.emplace_back(assign);
+        } else if (auto readValue = ngraph::as_type_ptr<ngraph::op::ReadValue>(node)) {
+            readValues[readValue->get_variable_id()] = readValue;
+        }
+        nodes.emplace_back(node);
+    }
+
+    auto getNode = [&] (uint32_t index) {
+        if (index >= nodes.size()) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! The function refers to the node " << index << " out of the model";
+        }
+        return nodes[index];
+    };
+    ngraph::ParameterVector parameters;
+    auto parameterIndices = model.records<uint32_t>(header.parameters, 0, model.count<uint32_t>(header.parameters));
+    for (uint64_t i = 0; i < model.count<uint32_t>(header.parameters); i++) {
+        auto parameter = ngraph::as_type_ptr<ngraph::op::Parameter>(getNode(parameterIndices[i]));
+        if (!parameter) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! A function parameter is not a Parameter node";
+        }
+        parameters.emplace_back(parameter);
+    }
+    ngraph::ResultVector results;
+    auto resultIndices = model.records<uint32_t>(header.results, 0, model.count<uint32_t>(header.results));
+    for (uint64_t i = 0; i < model.count<uint32_t>(header.results); i++) {
+        auto result = ngraph::as_type_ptr<ngraph::op::Result>(getNode(resultIndices[i]));
+        if (!result) {
+            THROW_IE_EXCEPTION << "Invalid binary IR! A function result is not a Result node";
+        }
+        results.emplace_back(result);
+    }
+
+    auto function = std::make_shared<ngraph::Function>(results, parameters, model.string(header.name));
+    if (!results.empty()) {
+        // Assign nodes are leaves of the graph, they are kept by control dependencies like in the XML IR
+        for (const auto& assign : assigns) {
+            auto readValue = readValues.find(assign->get_variable_id());
+            if (readValue != readValues.end()) {
+                assign->add_control_dependency(readValue->second);
+            }
+            results[0]->add_control_dependency(assign);
+        }
+    }
+    return function;
+}
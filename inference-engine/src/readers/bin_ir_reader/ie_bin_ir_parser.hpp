@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <ie_iextension.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates an nGraph function from the binary IR
+ */
+class BinaryIRParser {
+public:
+    explicit BinaryIRParser(const std::vector<IExtensionPtr>& exts);
+
+    /**
+     * @brief Creates the function from the memory of the model
+     * @param model A U8 blob with the whole file, the Constants keep the blob alive and share its memory
+     * @return The function
+     */
+    std::shared_ptr<ngraph::Function> parse(const Blob::CPtr& model);
+
+private:
+    // returns the opset with the operation, the operations of the extensions are looked up after the default ones
+    ngraph::OpSet& getOpSet(const ngraph::NodeTypeInfo& typeInfo);
+
+    std::vector<ngraph::OpSet> _opsets;
+    // keys refer to the type names of the opsets
+    std::map<ngraph::NodeTypeInfo, ngraph::OpSet*> _typeOpSets;
+};
+
+}  // namespace InferenceEngine
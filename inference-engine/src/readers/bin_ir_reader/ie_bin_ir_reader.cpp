@@ -0,0 +1,57 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_bin_ir_reader.hpp"
+
+#include <ie_api.h>
+#include <ie_blob_stream.hpp>
+#include <ie_bin_ir_format.hpp>
+
+#include <string>
+#include <vector>
+
+#include "ie_bin_ir_parser.hpp"
+
+using namespace InferenceEngine;
+
+bool BinaryIRReader::supportModel(std::istream& model) const {
+    char magic[sizeof(details::BinaryIR::Magic)] = {};
+    model.seekg(0, model.beg);
+    model.read(magic, sizeof(magic));
+    bool supported = details::BinaryIR::HasMagic(magic, static_cast<size_t>(model.gcount()));
+    model.clear();
+    model.seekg(0, model.beg);
+    return supported;
+}
+
+CNNNetwork BinaryIRReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    Blob::CPtr memory;
+    if (auto blobStream = dynamic_cast<details::BlobStream*>(&model)) {
+        // the model is in memory (e.g. a memory mapped file), it is used in place
+        memory = blobStream->getBlob();
+    } else {
+        model.seekg(0, model.end);
+        size_t size = static_cast<size_t>(model.tellg());
+        model.seekg(0, model.beg);
+        auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {size}, Layout::C));
+        blob->allocate();
+        model.read(blob->buffer().as<char*>(), size);
+        if (static_cast<size_t>(model.gcount()) != size) {
+            THROW_IE_EXCEPTION << "Cannot read the binary IR from the stream";
+        }
+        memory = blob;
+    }
+    BinaryIRParser parser(exts);
+    return CNNNetwork(parser.parse(memory));
+}
+
+INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
+    try {
+        reader = new BinaryIRReader();
+        return OK;
+    }
+    catch (std::exception &) {
+        return GENERAL_ERROR;
+    }
+}
@@ -12,6 +12,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <ngraph/graph_arena.hpp>
 #include <ngraph/ngraph.hpp>
 #include <set>
 #include <sstream>
@@ -23,6 +24,7 @@
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <ngraph/variant.hpp>
 
 #include <cpp/ie_cnn_network.h>
@@ -83,6 +85,10 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) {
 }
 
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::istream& binStream) {
+    // All graph objects of the network are allocated from one arena: a big model does not go
+    // through the global heap for each node and it is released at once with the network
+    ngraph::GraphArena::Scope arenaScope(std::make_shared<ngraph::GraphArena>());
+
     using node_params = struct {
         pugi::xml_node xml;
         GenericLayerParams params;
@@ -116,19 +122,31 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
         size_t toPort = GetUIntAttr(_ec, "to-port");
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
+    // The XML of the edges is not needed anymore, free it before the nodes are created
+    pugi::xml_node(root).remove_child("edges");
 
-    // Run DFS starting from outputs to get nodes topological order
+    // Run DFS starting from outputs to get nodes topological order.
+    // An explicit stack is used since a chain of layers can be much deeper than the call stack.
     std::set<size_t> used;
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        std::vector<std::pair<size_t, size_t>> stack = {{output, 0}};
+        while (!stack.empty()) {
+            const auto id = stack.back().first;
+            const auto& inputEdges = edges[id];
+            auto& nextEdge = stack.back().second;
+            if (nextEdge == inputEdges.size()) {
+                order.push_back(id);
+                stack.pop_back();
+                continue;
+            }
+            const auto from = inputEdges[nextEdge++].fromLayerId;
+            if (used.insert(from).second) {
+                stack.emplace_back(from, 0);
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
@@ -156,6 +174,11 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
         auto node = createNode(inputs, p.xml, binStream, p.params);
         id_to_node[layer_id] = node;
 
+        // The layer is not referenced anymore, so its part of the DOM is released right away
+        // and the XML and the nGraph representation of the whole network do not coexist
+        p.xml.parent().remove_child(p.xml);
+        p.xml = pugi::xml_node();
+
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
         // Temporary disabled!
@@ -470,7 +493,7 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
             outputs.emplace_back(iePort);
         }
 
-        ngraphNode = std::make_shared<ngraph::op::GenericIE>(inputs, parameters, params.type, outputs);
+        ngraphNode = ngraph::make_shared_in_arena<ngraph::op::GenericIE>(inputs, parameters, params.type, outputs);
     }
 
     if (!ngraphNode) {
@@ -529,17 +552,17 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::DetectionOutpu
     }
 
     if (inputs.size() == 3) {
-        return std::make_shared<ngraph::op::DetectionOutput>(inputs[0],
-                                                             inputs[1],
-                                                             inputs[2],
-                                                             attr);
+        return ngraph::make_shared_in_arena<ngraph::op::DetectionOutput>(inputs[0],
+                                                                         inputs[1],
+                                                                         inputs[2],
+                                                                         attr);
     } else {
-        return std::make_shared<ngraph::op::DetectionOutput>(inputs[0],
-                                                             inputs[1],
-                                                             inputs[2],
-                                                             inputs[3],
-                                                             inputs[4],
-                                                             attr);
+        return ngraph::make_shared_in_arena<ngraph::op::DetectionOutput>(inputs[0],
+                                                                         inputs[1],
+                                                                         inputs[2],
+                                                                         inputs[3],
+                                                                         inputs[4],
+                                                                         attr);
     }
 }
 
@@ -548,7 +571,7 @@ template <>
 std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::TensorIterator>::createLayer(
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
-    auto tensor_iterator = std::make_shared<ngraph::op::TensorIterator>();
+    auto tensor_iterator = ngraph::make_shared_in_arena<ngraph::op::TensorIterator>();
     tensor_iterator->set_friendly_name(GetStrAttr(node, "name"));
     auto body_node = node.child("body");
 
@@ -575,7 +598,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::TensorIterator
     auto result_nodes = ngraph_function->get_results();
     // Disabled reshape for generic operations in the TI body
     ::ngraph::op::GenericIE::DisableReshape noReshape(ngraph_function);
-    auto body = std::make_shared<ngraph::op::TensorIterator::BodyLambda>(result_nodes, parameter_nodes);
+    auto body = ngraph::make_shared_in_arena<ngraph::op::TensorIterator::BodyLambda>(result_nodes, parameter_nodes);
     tensor_iterator->set_body(body);
 
     // Parse PortMap: inputs
@@ -713,7 +736,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::PriorBoxCluste
     }
     attr.clip = (GetIntAttr(dn, "clip") != 0);
 
-    return std::make_shared<ngraph::op::PriorBoxClustered>(inputs[0], inputs[1], attr);
+    return ngraph::make_shared_in_arena<ngraph::op::PriorBoxClustered>(inputs[0], inputs[1], attr);
 }
 
 // Proposal layer
@@ -743,7 +766,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Proposal>::cre
     attr.box_coordinate_scale = GetFloatAttr(dn, "box_coordinate_scale", 1.0f);
     attr.framework = GetStrAttr(dn, "framework", "");
 
-    return std::make_shared<ngraph::op::Proposal>(inputs[0], inputs[1], inputs[2], attr);
+    return ngraph::make_shared_in_arena<ngraph::op::Proposal>(inputs[0], inputs[1], inputs[2], attr);
 }
 
 // PriorBox layer
@@ -771,7 +794,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::PriorBox>::cre
     attr.flip = (GetIntAttr(dn, "flip") != 0);
     attr.scale_all_sizes = (GetIntAttr(dn, "scale_all_sizes", 1) != 0);
 
-    return std::make_shared<ngraph::op::PriorBox>(inputs[0], inputs[1], attr);
+    return ngraph::make_shared_in_arena<ngraph::op::PriorBox>(inputs[0], inputs[1], attr);
 }
 
 // ShapeOf layer
@@ -780,7 +803,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::ShapeOf>::crea
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::ShapeOf>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::ShapeOf>(inputs[0]);
 }
 
 // FakeQuantize layer
@@ -793,8 +816,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::FakeQuantize>:
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::FakeQuantize>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4],
-                                                      GetUIntAttr(dn, "levels"));
+    return ngraph::make_shared_in_arena<ngraph::op::FakeQuantize>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4],
+                                                                  GetUIntAttr(dn, "levels"));
 }
 
 // ReverseSequence layer
@@ -804,7 +827,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::ReverseSequenc
                                                                                                 const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
     pugi::xml_node dn = node.child("data");
-    return std::make_shared<ngraph::op::ReverseSequence>(inputs[0], inputs[1], GetIntAttr(dn, "batch_axis", 0), GetIntAttr(dn, "seq_axis", 1));
+    return ngraph::make_shared_in_arena<ngraph::op::ReverseSequence>(inputs[0], inputs[1], GetIntAttr(dn, "batch_axis", 0), GetIntAttr(dn, "seq_axis", 1));
 }
 
 // Covnert layer
@@ -817,8 +840,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Convert>::crea
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::Convert>(inputs[0],
-                                                 details::convertPrecision(GetStrAttr(dn, "destination_type")));
+    return ngraph::make_shared_in_arena<ngraph::op::Convert>(inputs[0],
+                                                             details::convertPrecision(GetStrAttr(dn, "destination_type")));
 }
 
 // LSTMCell layer
@@ -835,9 +858,9 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::LSTMCell>::cre
     std::vector<float> activations_alpha = getParameters<float>(dn, "activations_alpha", {});
     std::vector<float> activations_beta = getParameters<float>(dn, "activations_beta", {});
     float clip = GetFloatAttr(dn, "clip", 0.f);
-    return std::make_shared<ngraph::op::LSTMCell>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4], inputs[5],
-                                                  GetUInt64Attr(dn, "hidden_size"), ngraph::op::LSTMWeightsFormat::IFCO,
-                                                  activations, activations_alpha, activations_beta, clip);
+    return ngraph::make_shared_in_arena<ngraph::op::LSTMCell>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4], inputs[5],
+                                                              GetUInt64Attr(dn, "hidden_size"), ngraph::op::LSTMWeightsFormat::IFCO,
+                                                              activations, activations_alpha, activations_beta, clip);
 }
 
 // BatchNormInference layer
@@ -851,7 +874,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::BatchNormInfer
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
     float eps = GetFloatAttr(dn, "eps");
-    return std::make_shared<ngraph::op::BatchNormInference>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4], eps);
+    return ngraph::make_shared_in_arena<ngraph::op::BatchNormInference>(inputs[0], inputs[1], inputs[2], inputs[3], inputs[4], eps);
 }
 
 // CTCGreedyDecoder layer
@@ -864,8 +887,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::CTCGreedyDecod
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::CTCGreedyDecoder>(inputs[0], inputs[1],
-                                                          GetBoolAttr(dn, "ctc_merge_repeated", true));
+    return ngraph::make_shared_in_arena<ngraph::op::CTCGreedyDecoder>(inputs[0], inputs[1],
+                                                                      GetBoolAttr(dn, "ctc_merge_repeated", true));
 }
 
 // TopK layer
@@ -902,7 +925,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::TopK>::cre
         THROW_IE_EXCEPTION << "Unsupported sort type: " << str_sort;
     }
 
-    return std::make_shared<ngraph::op::v1::TopK>(inputs[0], inputs[1], axis, mode, sort);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::TopK>(inputs[0], inputs[1], axis, mode, sort);
 }
 
 // Pad layer
@@ -932,14 +955,14 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Pad>::crea
 
     if (pad_mode == ngraph::op::PadMode::CONSTANT) {
         if (inputs.size() == 3) {
-            return std::make_shared<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], pad_mode);
+            return ngraph::make_shared_in_arena<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], pad_mode);
         }
         checkParameters(inputs, layerParsePrms, 4);
-        return std::make_shared<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], inputs[3], pad_mode);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], inputs[3], pad_mode);
     }
 
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], pad_mode);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Pad>(inputs[0], inputs[1], inputs[2], pad_mode);
 }
 
 // SquaredDifference layer
@@ -948,7 +971,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::SquaredDiffere
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::SquaredDifference>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::SquaredDifference>(inputs[0], inputs[1]);
 }
 
 // Greater layer
@@ -957,7 +980,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Greater>::
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Greater>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Greater>(inputs[0], inputs[1]);
 }
 
 // GreaterEqual layer
@@ -966,7 +989,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::GreaterEqu
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::GreaterEqual>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::GreaterEqual>(inputs[0], inputs[1]);
 }
 
 // Less layer
@@ -975,7 +998,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Less>::cre
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Less>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Less>(inputs[0], inputs[1]);
 }
 
 // LessEqual layer
@@ -984,7 +1007,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LessEqual>
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::LessEqual>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::LessEqual>(inputs[0], inputs[1]);
 }
 
 // Equal layer
@@ -993,7 +1016,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Equal>::cr
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Equal>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Equal>(inputs[0], inputs[1]);
 }
 
 // NotEqual layer
@@ -1002,7 +1025,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::NotEqual>:
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::NotEqual>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::NotEqual>(inputs[0], inputs[1]);
 }
 
 // FloorMod layer
@@ -1011,7 +1034,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::FloorMod>:
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::FloorMod>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::FloorMod>(inputs[0], inputs[1]);
 }
 
 // Select layer
@@ -1020,7 +1043,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Select>::c
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::v1::Select>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Select>(inputs[0], inputs[1], inputs[2]);
 }
 
 // MVN layer
@@ -1037,7 +1060,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::MVN>::createLa
     double eps = GetFloatAttr(dn, "eps");
     bool across = GetUIntAttr(dn, "across_channels", 0) == 1;
     bool normalize_variance = GetUIntAttr(dn, "normalize_variance", 0) == 1;
-    return std::make_shared<ngraph::op::MVN>(inputs[0], across, normalize_variance, eps);
+    return ngraph::make_shared_in_arena<ngraph::op::MVN>(inputs[0], across, normalize_variance, eps);
 }
 
 // Log layer
@@ -1046,7 +1069,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Log>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Log>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Log>(inputs[0]);
 }
 
 // LRN layer
@@ -1059,12 +1082,12 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::LRN>::createLa
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::LRN>(inputs[0],
-                                             inputs[1],
-                                             GetFloatAttr(dn, "alpha"),
-                                             GetFloatAttr(dn, "beta"),
-                                             GetFloatAttr(dn, "bias"),
-                                             GetUInt64Attr(dn, "size"));
+    return ngraph::make_shared_in_arena<ngraph::op::LRN>(inputs[0],
+                                                         inputs[1],
+                                                         GetFloatAttr(dn, "alpha"),
+                                                         GetFloatAttr(dn, "beta"),
+                                                         GetFloatAttr(dn, "bias"),
+                                                         GetUInt64Attr(dn, "size"));
 }
 
 // Clamp layer
@@ -1080,7 +1103,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Clamp>::create
 
     double maxVal = GetFloatAttr(dn, "max");
     double minVal = GetFloatAttr(dn, "min");
-    return std::make_shared<ngraph::op::Clamp>(inputs[0], minVal, maxVal);
+    return ngraph::make_shared_in_arena<ngraph::op::Clamp>(inputs[0], minVal, maxVal);
 }
 
 // VariadicSplit layer
@@ -1089,7 +1112,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::VariadicSplit>
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::VariadicSplit>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::VariadicSplit>(inputs[0], inputs[1], inputs[2]);
 }
 
 // Split layer
@@ -1104,7 +1127,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Split>::cr
 
     int num_splits = GetIntAttr(dn, "num_splits");
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Split>(inputs[0], inputs[1], num_splits);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Split>(inputs[0], inputs[1], num_splits);
 }
 
 // Sigmoid layer
@@ -1113,7 +1136,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Sigmoid>::crea
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Sigmoid>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Sigmoid>(inputs[0]);
 }
 
 // ELU layer
@@ -1127,7 +1150,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Elu>::createLa
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::Elu>(inputs[0], GetFloatAttr(dn, "alpha"));
+    return ngraph::make_shared_in_arena<ngraph::op::Elu>(inputs[0], GetFloatAttr(dn, "alpha"));
 }
 
 // SpaceToDepth layer
@@ -1141,7 +1164,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::SpaceToDepth>:
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::SpaceToDepth>(inputs[0], GetStrAttr(dn, "mode"), GetIntAttr(dn, "block_size", 1));
+    return ngraph::make_shared_in_arena<ngraph::op::SpaceToDepth>(inputs[0], GetStrAttr(dn, "mode"), GetIntAttr(dn, "block_size", 1));
 }
 
 // DepthToSpace layer
@@ -1155,7 +1178,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::DepthToSpace>:
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::DepthToSpace>(inputs[0], GetStrAttr(dn, "mode"), GetIntAttr(dn, "block_size", 1));
+    return ngraph::make_shared_in_arena<ngraph::op::DepthToSpace>(inputs[0], GetStrAttr(dn, "mode"), GetIntAttr(dn, "block_size", 1));
 }
 
 // SeLU layer
@@ -1164,7 +1187,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v0::Selu>::cre
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::v0::Selu>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::v0::Selu>(inputs[0], inputs[1], inputs[2]);
 }
 
 // PReLU layer
@@ -1173,7 +1196,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::PRelu>::create
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::PRelu>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::PRelu>(inputs[0], inputs[1]);
 }
 
 // Exp layer
@@ -1182,7 +1205,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Exp>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Exp>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Exp>(inputs[0]);
 }
 
 // ReLU layer
@@ -1191,7 +1214,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Relu>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Relu>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Relu>(inputs[0]);
 }
 
 // Negative layer
@@ -1200,7 +1223,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Negative>::cre
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Negative>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Negative>(inputs[0]);
 }
 
 // Range layer
@@ -1209,7 +1232,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Range>::create
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::Range>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::Range>(inputs[0], inputs[1], inputs[2]);
 }
 
 // Tanh layer
@@ -1218,7 +1241,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Tanh>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Tanh>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Tanh>(inputs[0]);
 }
 
 // Result layer
@@ -1227,7 +1250,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Result>::creat
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Result>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Result>(inputs[0]);
 }
 
 // Tile layer
@@ -1236,7 +1259,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Tile>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::Tile>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::Tile>(inputs[0], inputs[1]);
 }
 
 // StridedSlice layer
@@ -1254,11 +1277,11 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::StridedSli
     std::vector<int64_t> ellipsis_mask = getParameters<int64_t>(dn, "ellipsis_mask");
 
     if (inputs.size() == 3) {
-        return std::make_shared<ngraph::op::v1::StridedSlice>(inputs[0], inputs[1], inputs[2], begin_mask,
-                                                              end_mask, new_axis, shrink_axis, ellipsis_mask);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::StridedSlice>(inputs[0], inputs[1], inputs[2], begin_mask,
+                                                                          end_mask, new_axis, shrink_axis, ellipsis_mask);
     } else if (inputs.size() == 4) {
-        return std::make_shared<ngraph::op::v1::StridedSlice>(inputs[0], inputs[1], inputs[2], inputs[3], begin_mask,
-                                                              end_mask, new_axis, shrink_axis, ellipsis_mask);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::StridedSlice>(inputs[0], inputs[1], inputs[2], inputs[3], begin_mask,
+                                                                          end_mask, new_axis, shrink_axis, ellipsis_mask);
     } else {
         THROW_IE_EXCEPTION << "Incorrect number of inputs " << inputs.size() << " for " << getType() << " layer with name: " << layerParsePrms.name;
     }
@@ -1275,7 +1298,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Reshape>::
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::Reshape>(inputs[0], inputs[1], GetBoolAttr(dn, "special_zero"));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Reshape>(inputs[0], inputs[1], GetBoolAttr(dn, "special_zero"));
 }
 
 // Squeeze layer
@@ -1284,7 +1307,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Squeeze>::crea
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::Squeeze>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::Squeeze>(inputs[0], inputs[1]);
 }
 
 // Unsqueeze layer
@@ -1293,7 +1316,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Unsqueeze>::cr
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::Unsqueeze>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::Unsqueeze>(inputs[0], inputs[1]);
 }
 
 // Interpolate layer
@@ -1327,7 +1350,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Interpolate>::
         attrs.pads_end.push_back(pad);
     }
 
-    return std::make_shared<ngraph::op::Interpolate>(inputs[0], inputs[1], attrs);
+    return ngraph::make_shared_in_arena<ngraph::op::Interpolate>(inputs[0], inputs[1], attrs);
 }
 
 // Abs layer
@@ -1336,7 +1359,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Abs>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Abs>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Abs>(inputs[0]);
 }
 
 // Add layer
@@ -1345,7 +1368,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Add>::crea
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Add>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Add>(inputs[0], inputs[1]);
 }
 
 // Minimum layer
@@ -1354,7 +1377,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Minimum>::
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Minimum>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Minimum>(inputs[0], inputs[1]);
 }
 
 // Maximum layer
@@ -1363,7 +1386,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Maximum>::
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Maximum>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Maximum>(inputs[0], inputs[1]);
 }
 
 // Divide layer
@@ -1372,7 +1395,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Divide>::c
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Divide>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Divide>(inputs[0], inputs[1]);
 }
 
 // Subtract layer
@@ -1381,7 +1404,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Subtract>:
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Subtract>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Subtract>(inputs[0], inputs[1]);
 }
 
 // Multiply layer
@@ -1390,7 +1413,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Multiply>:
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Multiply>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Multiply>(inputs[0], inputs[1]);
 }
 
 // Broadcast layer
@@ -1399,9 +1422,9 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Broadcast>
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     if (inputs.size() == 2) {
-        return std::make_shared<ngraph::op::v1::Broadcast>(inputs[0], inputs[1]);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::Broadcast>(inputs[0], inputs[1]);
     } else if (layerParsePrms.inputPorts.size() == 3) {
-        return std::make_shared<ngraph::op::v1::Broadcast>(inputs[0], inputs[1], inputs[2]);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::Broadcast>(inputs[0], inputs[1], inputs[2]);
     }
     THROW_IE_EXCEPTION << "Invalid number of inputs: " << layerParsePrms.inputPorts.size();
 }
@@ -1435,7 +1458,16 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
-    auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
+    // weights are kept in memory (e.g. a memory mapped file), share them with the Constant instead of copying
+    if (auto blobStream = dynamic_cast<details::BlobStream*>(&binStream)) {
+        auto weights = blobStream->getBlob();
+        char* data = weights->cbuffer().as<char*>() + offset;
+        using SharedBuffer = ngraph::runtime::SharedBuffer<Blob::CPtr>;
+        auto buffer = std::make_shared<SharedBuffer>(data, size, weights);
+        return ngraph::make_shared_in_arena<ngraph::op::Constant>(port.precision, shape, buffer);
+    }
+
+    auto constant = ngraph::make_shared_in_arena<ngraph::op::Constant>(port.precision, shape);
     char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
     binStream.seekg(offset, std::ios::beg);
     binStream.read(data, size);
@@ -1448,7 +1480,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Power>::cr
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::Power>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Power>(inputs[0], inputs[1]);
 }
 
 // MatMul layer
@@ -1462,7 +1494,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::MatMul>::creat
     auto transpose_a = GetBoolAttr(dn, "transpose_a", false);
     auto transpose_b = GetBoolAttr(dn, "transpose_b", false);
 
-    return std::make_shared<ngraph::op::MatMul>(inputs[0], inputs[1], transpose_a, transpose_b);
+    return ngraph::make_shared_in_arena<ngraph::op::MatMul>(inputs[0], inputs[1], transpose_a, transpose_b);
 }
 
 // Softmax layer
@@ -1476,7 +1508,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Softmax>::
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::Softmax>(inputs[0], GetUIntAttr(dn, "axis"));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Softmax>(inputs[0], GetUIntAttr(dn, "axis"));
 }
 
 // Sqrt layer
@@ -1485,7 +1517,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Sqrt>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Sqrt>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Sqrt>(inputs[0]);
 }
 
 // RegionYolo layer
@@ -1508,8 +1540,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::RegionYolo>::c
     auto mask = getParameters<int64_t>(dn, "mask", {});
     auto anchors = getParameters<float>(dn, "anchors", {});
 
-    return std::make_shared<ngraph::op::RegionYolo>(inputs[0], coords, classes, num, do_softmax,
-                                                    mask, axis, end_axis, anchors);
+    return ngraph::make_shared_in_arena<ngraph::op::RegionYolo>(inputs[0], coords, classes, num, do_softmax,
+                                                                mask, axis, end_axis, anchors);
 }
 
 // ReorgYolo layer
@@ -1524,7 +1556,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::ReorgYolo>::cr
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
     auto stride = GetUIntAttr(dn, "stride");
-    return std::make_shared<ngraph::op::ReorgYolo>(inputs[0], ngraph::Strides {stride});
+    return ngraph::make_shared_in_arena<ngraph::op::ReorgYolo>(inputs[0], ngraph::Strides {stride});
 }
 
 // ReduceMin layer
@@ -1538,7 +1570,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceMin>
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceMin>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceMin>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
 }
 
 // ReduceMax layer
@@ -1552,7 +1584,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceMax>
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceMax>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceMax>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
 }
 
 // ReduceMean layer
@@ -1566,7 +1598,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceMean
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceMean>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceMean>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
 }
 
 // ReduceProd layer
@@ -1580,7 +1612,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceProd
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceProd>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceProd>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
 }
 
 // ReduceSum layer
@@ -1594,7 +1626,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceSum>
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceSum>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceSum>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims", false));
 }
 
 // Transpose layer
@@ -1603,7 +1635,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Transpose>::cr
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::Transpose>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::Transpose>(inputs[0], inputs[1]);
 }
 
 // BinaryConvolution layer
@@ -1637,8 +1669,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::BinaryConv
     auto mode = GetStrAttr(dn, "mode");
     auto pad_value = GetFloatAttr(dn, "pad_value");
 
-    return std::make_shared<ngraph::op::v1::BinaryConvolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
-                                                               dilations, mode, pad_value, pad_type);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::BinaryConvolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
+                                                                           dilations, mode, pad_value, pad_type);
 }
 
 // Convolution layer
@@ -1667,8 +1699,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Convolutio
     auto pads_begin = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_begin", {}));
     auto pads_end = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_end", {}));
 
-    return std::make_shared<ngraph::op::v1::Convolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
-                                                         dilations, pad_type);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Convolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
+                                                                     dilations, pad_type);
 }
 
 // GroupConvolution layer
@@ -1697,8 +1729,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::GroupConvo
     auto pads_begin = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_begin", {}));
     auto pads_end = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_end", {}));
 
-    return std::make_shared<ngraph::op::v1::GroupConvolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
-                                                              dilations, pad_type);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::GroupConvolution>(inputs[0], inputs[1], strides, pads_begin, pads_end,
+                                                                          dilations, pad_type);
 }
 
 // DeformableConvolution layer
@@ -1730,7 +1762,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Deformable
     auto pads_begin = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_begin"));
     auto pads_end = ngraph::CoordinateDiff(getParameters<std::ptrdiff_t>(dn, "pads_end"));
 
-    return std::make_shared<ngraph::op::v1::DeformableConvolution>(inputs[0], inputs[1], inputs[2], strides, pads_begin,
+    return ngraph::make_shared_in_arena<ngraph::op::v1::DeformableConvolution>(inputs[0], inputs[1], inputs[2], strides, pads_begin,
                 pads_end, dilations, pad_type, group, deformable_group);
 }
 
@@ -1764,11 +1796,11 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Convolutio
     }
 
     if (inputs.size() == 3) {
-        return std::make_shared<ngraph::op::v1::ConvolutionBackpropData>(inputs[0], inputs[1], inputs[2], strides, pads_begin, pads_end,
-                                                                         dilations, pad_type, output_padding);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::ConvolutionBackpropData>(inputs[0], inputs[1], inputs[2], strides, pads_begin, pads_end,
+                                                                                     dilations, pad_type, output_padding);
     } else {
-        return std::make_shared<ngraph::op::v1::ConvolutionBackpropData>(inputs[0], inputs[1], strides, pads_begin, pads_end,
-                                                                         dilations, pad_type, output_padding);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::ConvolutionBackpropData>(inputs[0], inputs[1], strides, pads_begin, pads_end,
+                                                                                     dilations, pad_type, output_padding);
     }
 }
 
@@ -1803,11 +1835,11 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::GroupConvo
     }
 
     if (inputs.size() == 3) {
-        return std::make_shared<ngraph::op::v1::GroupConvolutionBackpropData>(inputs[0], inputs[1], inputs[2], strides, pads_begin, pads_end,
-                                                                              dilations, pad_type, output_padding);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::GroupConvolutionBackpropData>(inputs[0], inputs[1], inputs[2], strides, pads_begin, pads_end,
+                                                                                          dilations, pad_type, output_padding);
     } else {
-        return std::make_shared<ngraph::op::v1::GroupConvolutionBackpropData>(inputs[0], inputs[1], strides, pads_begin, pads_end,
-                                                                              dilations, pad_type, output_padding);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::GroupConvolutionBackpropData>(inputs[0], inputs[1], strides, pads_begin, pads_end,
+                                                                                          dilations, pad_type, output_padding);
     }
 }
 
@@ -1848,8 +1880,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::AvgPool>::
         THROW_IE_EXCEPTION << "Unsuppored rounding type: " << str_rounding_type;
     }
 
-    return std::make_shared<ngraph::op::v1::AvgPool>(inputs[0], strides, pads_begin, pads_end, kernel, exclude_pad,
-                                                     rounding_type, pad_type);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::AvgPool>(inputs[0], strides, pads_begin, pads_end, kernel, exclude_pad,
+                                                                 rounding_type, pad_type);
 }
 
 // MaxPool layer
@@ -1888,8 +1920,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::MaxPool>::
         THROW_IE_EXCEPTION << "Unsuppored rounding type: " << str_rounding_type;
     }
 
-    return std::make_shared<ngraph::op::v1::MaxPool>(inputs[0], strides, pads_begin, pads_end, kernel, rounding_type,
-                                                     pad_type);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::MaxPool>(inputs[0], strides, pads_begin, pads_end, kernel, rounding_type,
+                                                                 pad_type);
 }
 
 // ROIPooling layer
@@ -1907,8 +1939,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::ROIPooling>::c
     auto pooled_w = GetUIntAttr(dn, "pooled_w");
     auto spatial_scale = GetFloatAttr(dn, "spatial_scale");
     auto method = GetStrAttr(dn, "method", "max");
-    return std::make_shared<ngraph::op::ROIPooling>(inputs[0], inputs[1],
-                                                    ngraph::Shape {pooled_h, pooled_w}, spatial_scale, method);
+    return ngraph::make_shared_in_arena<ngraph::op::ROIPooling>(inputs[0], inputs[1],
+                                                                ngraph::Shape {pooled_h, pooled_w}, spatial_scale, method);
 }
 
 // PSROIPooling layer
@@ -1929,9 +1961,9 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::PSROIPooling>:
     auto spatial_scale = GetFloatAttr(dn, "spatial_scale");
     auto mode = GetStrAttr(dn, "mode", "average");
 
-    return std::make_shared<ngraph::op::PSROIPooling>(inputs[0], inputs[1],
-                                                      output_dim, group_size, spatial_scale, spatial_bins_x,
-                                                      spatial_bins_y, mode);
+    return ngraph::make_shared_in_arena<ngraph::op::PSROIPooling>(inputs[0], inputs[1],
+                                                                  output_dim, group_size, spatial_scale, spatial_bins_x,
+                                                                  spatial_bins_y, mode);
 }
 
 // DeformablePSROIPooling layer
@@ -1955,16 +1987,16 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Deformable
     auto part_size = GetIntAttr(dn, "part_size", 1);
 
     if (inputs.size() == 3) {
-        return std::make_shared<ngraph::op::v1::DeformablePSROIPooling>(inputs[0],
-                                                                        inputs[1],
-                                                                        inputs[2], output_dim,
-                                                                        spatial_scale, group_size, mode, spatial_bins_x,
-                                                                        spatial_bins_y, trans_std, part_size);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::DeformablePSROIPooling>(inputs[0],
+                                                                                    inputs[1],
+                                                                                    inputs[2], output_dim,
+                                                                                    spatial_scale, group_size, mode, spatial_bins_x,
+                                                                                    spatial_bins_y, trans_std, part_size);
     } else if (inputs.size() == 2) {
-        return std::make_shared<ngraph::op::v1::DeformablePSROIPooling>(inputs[0],
-                                                                        inputs[1], output_dim,
-                                                                        spatial_scale, group_size, mode, spatial_bins_x,
-                                                                        spatial_bins_y, trans_std, part_size);
+        return ngraph::make_shared_in_arena<ngraph::op::v1::DeformablePSROIPooling>(inputs[0],
+                                                                                    inputs[1], output_dim,
+                                                                                    spatial_scale, group_size, mode, spatial_bins_x,
+                                                                                    spatial_bins_y, trans_std, part_size);
     } else {
         THROW_IE_EXCEPTION << "Wrong number of inputs for " << getType() << " layer with name: " << layerParsePrms.name;
     }
@@ -1981,7 +2013,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Concat>::creat
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::Concat>(inputs, GetUIntAttr(dn, "axis"));
+    return ngraph::make_shared_in_arena<ngraph::op::Concat>(inputs, GetUIntAttr(dn, "axis"));
 }
 
 // Gather layer
@@ -1990,7 +2022,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Gather>::c
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::v1::Gather>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::Gather>(inputs[0], inputs[1], inputs[2]);
 }
 
 // GatherTree layer
@@ -1999,7 +2031,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::GatherTree
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 4);
-    return std::make_shared<ngraph::op::v1::GatherTree>(inputs[0], inputs[1], inputs[2], inputs[3]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::GatherTree>(inputs[0], inputs[1], inputs[2], inputs[3]);
 }
 
 // OneHot layer
@@ -2013,7 +2045,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::OneHot>::c
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::OneHot>(inputs[0], inputs[1], inputs[2], inputs[3], GetInt64Attr(dn, "axis"));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::OneHot>(inputs[0], inputs[1], inputs[2], inputs[3], GetInt64Attr(dn, "axis"));
 }
 
 // NormalizeL2 layer
@@ -2038,7 +2070,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::NormalizeL2>::
         THROW_IE_EXCEPTION << "NormalizeL2 unsupported eps_mode: " << eps_mode;
     }
 
-    return std::make_shared<ngraph::op::NormalizeL2>(inputs[0], inputs[1], eps, em);
+    return ngraph::make_shared_in_arena<ngraph::op::NormalizeL2>(inputs[0], inputs[1], eps, em);
 }
 
 // Erf layer
@@ -2047,7 +2079,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Erf>::createLa
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Erf>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Erf>(inputs[0]);
 }
 
 // Sin layer
@@ -2056,7 +2088,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Sin>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Sin>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Sin>(inputs[0]);
 }
 
 // Sign layer
@@ -2065,7 +2097,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Sign>::createL
         const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
         const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Sign>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Sign>(inputs[0]);
 }
 
 // Sinh layer
@@ -2074,7 +2106,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Sinh>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Sinh>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Sinh>(inputs[0]);
 }
 
 // Asin layer
@@ -2083,7 +2115,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Asin>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Asin>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Asin>(inputs[0]);
 }
 
 // Cos layer
@@ -2092,7 +2124,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Cos>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Cos>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Cos>(inputs[0]);
 }
 
 // Cosh layer
@@ -2101,7 +2133,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Cosh>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Cosh>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Cosh>(inputs[0]);
 }
 
 // Acos layer
@@ -2110,7 +2142,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Acos>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Acos>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Acos>(inputs[0]);
 }
 
 // Tan layer
@@ -2119,7 +2151,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Tan>::createLa
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Tan>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Tan>(inputs[0]);
 }
 
 // Atan layer
@@ -2128,7 +2160,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Atan>::createL
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Atan>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Atan>(inputs[0]);
 }
 
 // Floor layer
@@ -2137,7 +2169,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Floor>::create
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Floor>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Floor>(inputs[0]);
 }
 
 // Ceiling layer
@@ -2146,7 +2178,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Ceiling>::crea
     const ngraph::OutputVector& inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::Ceiling>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::Ceiling>(inputs[0]);
 }
 
 // HardSigmoid layer
@@ -2155,7 +2187,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::HardSigmoid>::
     const ngraph::OutputVector & inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 3);
-    return std::make_shared<ngraph::op::HardSigmoid>(inputs[0], inputs[1], inputs[2]);
+    return ngraph::make_shared_in_arena<ngraph::op::HardSigmoid>(inputs[0], inputs[1], inputs[2]);
 }
 
 // GRN layer
@@ -2169,7 +2201,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::GRN>::createLa
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::GRN>(inputs[0], GetFloatAttr(dn, "bias"));
+    return ngraph::make_shared_in_arena<ngraph::op::GRN>(inputs[0], GetFloatAttr(dn, "bias"));
 }
 
 // LogicalAnd layer
@@ -2178,7 +2210,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LogicalAnd
     const ngraph::OutputVector & inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::LogicalAnd>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::LogicalAnd>(inputs[0], inputs[1]);
 }
 
 // LogicalOr layer
@@ -2187,7 +2219,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LogicalOr>
     const ngraph::OutputVector & inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::LogicalOr>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::LogicalOr>(inputs[0], inputs[1]);
 }
 
 // LogicalXor layer
@@ -2196,7 +2228,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LogicalXor
     const ngraph::OutputVector & inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 2);
-    return std::make_shared<ngraph::op::v1::LogicalXor>(inputs[0], inputs[1]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::LogicalXor>(inputs[0], inputs[1]);
 }
 
 // LogicalNot layer
@@ -2205,7 +2237,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LogicalNot
     const ngraph::OutputVector & inputs, const pugi::xml_node& node, std::istream& binStream,
     const GenericLayerParams& layerParsePrms) {
     checkParameters(inputs, layerParsePrms, 1);
-    return std::make_shared<ngraph::op::v1::LogicalNot>(inputs[0]);
+    return ngraph::make_shared_in_arena<ngraph::op::v1::LogicalNot>(inputs[0]);
 }
 
 // ReduceLogicalAnd layer
@@ -2219,7 +2251,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceLogi
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceLogicalAnd>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims"));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceLogicalAnd>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims"));
 }
 
 // ReduceLogicalOr layer
@@ -2233,7 +2265,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::ReduceLogi
     if (dn.empty())
         THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
 
-    return std::make_shared<ngraph::op::v1::ReduceLogicalOr>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims"));
+    return ngraph::make_shared_in_arena<ngraph::op::v1::ReduceLogicalOr>(inputs[0], inputs[1], GetBoolAttr(dn, "keep_dims"));
 }
 
 // NonMaxSuppression layer
@@ -2264,7 +2296,7 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::NonMaxSupp
         new_inputs.push_back(ngraph::op::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0}));
     for (size_t ind = new_inputs.size(); ind < 5; ++ind)
         new_inputs.push_back(ngraph::op::Constant::create(ngraph::element::f32, ngraph::Shape{}, {.0f}));
-    return std::make_shared<ngraph::op::v1::NonMaxSuppression>(new_inputs[0], new_inputs[1], new_inputs[2], new_inputs[3], new_inputs[4],
+    return ngraph::make_shared_in_arena<ngraph::op::v1::NonMaxSuppression>(new_inputs[0], new_inputs[1], new_inputs[2], new_inputs[3], new_inputs[4],
             box_enc_type, sort_flag);
 }
 
@@ -6,8 +6,19 @@
 #include <ie_api.h>
 #include <ngraph/frontend/onnx_import/onnx.hpp>
 
+#include <string>
+
 using namespace InferenceEngine;
 
+namespace {
+
+std::string readPathFromStream(std::istream& stream) {
+    auto path = static_cast<const char*>(stream.pword(modelPathStreamIndex));
+    return path == nullptr ? std::string{} : std::string{path};
+}
+
+}  // namespace
+
 bool ONNXReader::supportModel(std::istream& model) const {
     model.seekg(0, model.beg);
     const int header_size = 128;
@@ -22,7 +33,7 @@ bool ONNXReader::supportModel(std::istream& model) const {
 }
 
 CNNNetwork ONNXReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
-    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model));
+    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model, readPathFromStream(model)));
 }
 
 INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Layout of the binary IR, a single file representation of nGraph functions
+ * @file ie_bin_ir_format.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace InferenceEngine {
+namespace details {
+namespace BinaryIR {
+
+/**
+ * @brief The file starts with the Header, the other sections are arrays of the fixed size records below.
+ * Sections are referred by offsets from the beginning of the file, so a mapped file is used in place:
+ * a reader creates nodes from the records without parsing and Constants share the memory of the weights section.
+ * All the values are little endian.
+ *
+ * - nodes: Node records in topological order
+ * - inputs: Input records, the inputs of a node are a contiguous range
+ * - attributes: Attribute records, the attributes of a node are a contiguous range
+ * - data: values of the array attributes, each array is aligned to DataAlignment
+ * - strings: null-terminated strings, a string is referred by its offset in the section
+ * - parameters, results: uint32_t indices of the Parameter and Result nodes in the order of the function
+ * - weights: the data of Constants and of other buffer attributes, each buffer is aligned to WeightsAlignment
+ */
+
+/**
+ * @brief Extension of the binary IR files
+ */
+constexpr const char* FileExtension = "bir";
+
+/**
+ * @brief The first bytes of the file
+ */
+constexpr const char Magic[8] = {'I', 'E', 'B', 'I', 'N', 'I', 'R', '\0'};
+
+/**
+ * @brief Version of the layout, a reader rejects files of other versions
+ */
+constexpr uint32_t Version = 1;
+
+/**
+ * @brief Alignment of the arrays in the data section
+ */
+constexpr uint64_t DataAlignment = 8;
+
+/**
+ * @brief Alignment of the buffers in the weights section, chosen so Constants can be used by vectorized kernels
+ */
+constexpr uint64_t WeightsAlignment = 64;
+
+/**
+ * @brief A range of bytes in the file
+ */
+struct Section {
+    uint64_t offset;    //!< Offset from the beginning of the file
+    uint64_t size;      //!< Size in bytes
+};
+
+/**
+ * @brief The header of the file
+ */
+struct Header {
+    char     magic[8];      //!< Magic
+    uint32_t version;       //!< Version
+    uint32_t name;          //!< String with the name of the function
+    Section  nodes;         //!< Node records
+    Section  inputs;        //!< Input records
+    Section  attributes;    //!< Attribute records
+    Section  data;          //!< Values of the array attributes
+    Section  strings;       //!< Strings
+    Section  parameters;    //!< Indices of the Parameter nodes
+    Section  results;       //!< Indices of the Result nodes
+    Section  weights;       //!< Buffers
+};
+
+/**
+ * @brief An operation
+ */
+struct Node {
+    uint32_t type;              //!< String with the name of the operation type
+    uint32_t name;              //!< String with the friendly name
+    uint64_t version;           //!< Version of the operation type, the type and the version identify the operation
+    uint32_t firstInput;        //!< Index of the first Input record
+    uint32_t inputsCount;       //!< Number of inputs
+    uint32_t firstAttribute;    //!< Index of the first Attribute record
+    uint32_t attributesCount;   //!< Number of attributes
+};
+
+/**
+ * @brief An input of an operation, refers to the output of a previous node
+ */
+struct Input {
+    uint32_t node;              //!< Index of the producer node
+    uint32_t port;              //!< Index of the output of the producer
+};
+
+/**
+ * @brief Type of an attribute value
+ */
+enum class AttributeType : uint32_t {
+    Bool,       //!< `value` is 0 or 1
+    Int64,      //!< `value` is the int64_t bits
+    Double,     //!< `value` is the double bits
+    String,     //!< `value` is a string
+    Int64s,     //!< `value` is an offset of `count` int64_t values in the data section
+    Floats,     //!< `value` is an offset of `count` float values in the data section
+    Doubles,    //!< `value` is an offset of `count` double values in the data section
+    Strings,    //!< `value` is an offset of `count` uint32_t strings in the data section
+    Buffer,     //!< `value` is an offset of `count` bytes in the weights section
+};
+
+/**
+ * @brief An attribute of an operation as the nGraph AttributeVisitor sees it
+ */
+struct Attribute {
+    uint32_t      name;     //!< String with the name of the attribute including the names of the enclosing structures
+    AttributeType type;     //!< Type of the value
+    uint64_t      value;    //!< The value or its offset in a section
+    uint64_t      count;    //!< Number of the elements of an array value
+};
+
+/**
+ * @brief Checks whether the bytes start the binary IR file
+ * @param data The beginning of the file
+ * @param size The number of the bytes
+ * @return `True` if the bytes start with the magic
+ */
+inline bool HasMagic(const char* data, size_t size) {
+    return size >= sizeof(Magic) && 0 == std::memcmp(data, Magic, sizeof(Magic));
+}
+
+}  // namespace BinaryIR
+}  // namespace details
+}  // namespace InferenceEngine
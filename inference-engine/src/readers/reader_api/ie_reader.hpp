@@ -14,6 +14,13 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Index of the extensible array (std::ios_base::pword) of a model stream which holds the path to the model
+ * file as a null-terminated string. It is set only when the model is read from a file, so readers can find
+ * the files the model refers to
+ */
+constexpr int modelPathStreamIndex = 0;
+
 /**
  * @brief IReader an abstract interface for Inference Engine readers
  */
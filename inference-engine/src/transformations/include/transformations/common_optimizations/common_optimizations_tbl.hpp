@@ -25,3 +25,4 @@ NGRAPH_PASS(AlgebraicSimplification, ::ngraph::pass) // may introduce fake dynam
 NGRAPH_PASS(ConstantFolding, ::ngraph::pass)
 NGRAPH_PASS(ConvertScatterElementsToScatter, ::ngraph::pass) // partially depends on CF
 NGRAPH_PASS(DepthToSpaceFusion, ::ngraph::pass)
+NGRAPH_PASS(MVNFusion, ::ngraph::pass)
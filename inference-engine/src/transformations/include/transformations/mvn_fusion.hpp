@@ -0,0 +1,57 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include "transformations/utils/pass_param.hpp"
+
+namespace ngraph {
+namespace pass {
+
+    class TRANSFORMATIONS_API MVNFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MVNFusion transformation detects the decomposed mean-variance normalization
+ * (x - ReduceMean(x)) / Sqrt(ReduceMean((x - ReduceMean(x)) ^ 2) + eps) used for LayerNorm and
+ * InstanceNorm and fuses it into a single MVN layer.
+ *
+ * The squaring can be either Power with the exponent 2 or Multiply of the difference by itself.
+ * The reduction axes must be all the axes starting from the channel (across_channels) or
+ * the spatial ones, both ReduceMean layers must keep the reduced dims.
+ *
+ * MVNFusion transformation is optional and disabled by default.
+ * The transformation can be enabled with callback using setCallback method.
+ * See the example below.
+ *
+ * Callback example:
+ *
+ *     // This callback enables MVNFusion transformation
+ *     auto callback = [](const std::shared_ptr<const ngraph::Node> & node) -> bool {
+ *         return std::dynamic_pointer_cast<const ngraph::opset3::MVN>(node) != nullptr;
+ *     };
+ *
+ *     auto p = ngraph::pass::MVNFusion();
+ *     p.setCallback(callback);
+ *     p.run_on_function(f);
+ *
+ */
+class ngraph::pass::MVNFusion: public ngraph::pass::GraphRewrite, public ngraph::pass::PassParam {
+public:
+    MVNFusion() : GraphRewrite(), PassParam() {
+        mvn_fusion();
+    }
+
+private:
+    void mvn_fusion();
+};
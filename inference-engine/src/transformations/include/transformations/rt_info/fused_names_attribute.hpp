@@ -24,10 +24,14 @@ namespace ngraph {
  * @ingroup ie_runtime_attr_api
  * @brief FusedName class represents runtime info attribute that stores
  * all operation names that was fully or partially fused into node
+ *
+ * The names are kept as an immutable graph shared by the copies: every name is stored once and a fusion only
+ * references the fused sets, the sorted set of names is built when it is requested
  */
 class TRANSFORMATIONS_API FusedNames {
 private:
-    std::set<std::string> fused_names;
+    struct Names;
+    std::shared_ptr<const Names> fused_names;
 
 public:
     /**
@@ -39,9 +43,7 @@ public:
      * @brief      Constructs a new object consisting of a single name     *
      * @param[in]  name  The name
      */
-    explicit FusedNames(const std::string &name) {
-        fused_names.insert(name);
-    }
+    explicit FusedNames(const std::string &name);
 
     /**
      * @brief Unites current set of already fused names with another FusedNames object
@@ -59,6 +61,11 @@ public:
      * @return vector if strings
      */
     std::vector<std::string> getVectorNames() const;
+
+private:
+    std::set<std::string> collectNames() const;
+
+    friend class VariantWrapper<FusedNames>;
 };
 
 extern template class TRANSFORMATIONS_API VariantImpl<FusedNames>;
@@ -6,6 +6,7 @@
 
 #include "transformations/common_optimizations/common_optimizations.hpp"
 #include "transformations/depth_to_space_fusion.hpp"
+#include "transformations/mvn_fusion.hpp"
 #include "transformations/optimize_strided_slice.hpp"
 #include "transformations/convert_scatter_elements_to_scatter.hpp"
 #include "transformations/remove_filtering_boxes_by_size.hpp"
@@ -0,0 +1,154 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/mvn_fusion.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/rt_info.hpp>
+
+namespace {
+
+bool get_scalar_value(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset3::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) == 0) {
+        return false;
+    }
+
+    auto values = constant->cast_vector<float>();
+    for (auto v : values) {
+        if (v != values[0]) {
+            return false;
+        }
+    }
+    value = values[0];
+    return true;
+}
+
+bool get_reduction_axes(const std::shared_ptr<ngraph::opset3::ReduceMean>& reduce, int64_t rank, ngraph::AxisSet& axes) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset3::Constant>(reduce->input_value(1).get_node_shared_ptr());
+    if (!constant || !reduce->get_keep_dims()) {
+        return false;
+    }
+
+    axes.clear();
+    for (auto axis : constant->cast_vector<int64_t>()) {
+        axes.insert(static_cast<size_t>(axis < 0 ? axis + rank : axis));
+    }
+    return true;
+}
+
+}  // namespace
+
+void ngraph::pass::MVNFusion::mvn_fusion() {
+    auto input0 = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1, 1});
+    auto input1 = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1, 1});
+    auto div = std::make_shared<ngraph::opset3::Divide>(input0, input1);
+
+    ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+        auto div = std::dynamic_pointer_cast<ngraph::opset3::Divide>(m.get_match_root());
+        if (!div) {
+            return false;
+        }
+
+        auto sub = std::dynamic_pointer_cast<ngraph::opset3::Subtract>(div->input_value(0).get_node_shared_ptr());
+        auto sqrt = std::dynamic_pointer_cast<ngraph::opset3::Sqrt>(div->input_value(1).get_node_shared_ptr());
+        if (!sub || !sqrt) {
+            return false;
+        }
+
+        auto add = std::dynamic_pointer_cast<ngraph::opset3::Add>(sqrt->input_value(0).get_node_shared_ptr());
+        if (!add) {
+            return false;
+        }
+
+        float eps = 0.f;
+        size_t variance_port = 0;
+        if (get_scalar_value(add->input_value(1), eps)) {
+            variance_port = 0;
+        } else if (get_scalar_value(add->input_value(0), eps)) {
+            variance_port = 1;
+        } else {
+            return false;
+        }
+
+        auto variance = std::dynamic_pointer_cast<ngraph::opset3::ReduceMean>(add->input_value(variance_port).get_node_shared_ptr());
+        auto mean = std::dynamic_pointer_cast<ngraph::opset3::ReduceMean>(sub->input_value(1).get_node_shared_ptr());
+        if (!variance || !mean) {
+            return false;
+        }
+
+        auto data = sub->input_value(0);
+        if (mean->input_value(0) != data) {
+            return false;
+        }
+
+        // the difference is squared either by Power(diff, 2) or by Multiply(diff, diff)
+        auto square = variance->input_value(0).get_node_shared_ptr();
+        size_t sub_consumers = 0;
+        if (auto power = std::dynamic_pointer_cast<ngraph::opset3::Power>(square)) {
+            float exponent = 0.f;
+            if (power->input_value(0) != sub->output(0) || !get_scalar_value(power->input_value(1), exponent) || exponent != 2.f) {
+                return false;
+            }
+            sub_consumers = 2;
+        } else if (auto mul = std::dynamic_pointer_cast<ngraph::opset3::Multiply>(square)) {
+            if (mul->input_value(0) != sub->output(0) || mul->input_value(1) != sub->output(0)) {
+                return false;
+            }
+            sub_consumers = 3;
+        } else {
+            return false;
+        }
+
+        // the intermediate values must not be used outside of the pattern
+        if (sub->get_output_target_inputs(0).size() != sub_consumers ||
+            mean->get_output_target_inputs(0).size() != 1 ||
+            square->get_output_target_inputs(0).size() != 1 ||
+            variance->get_output_target_inputs(0).size() != 1 ||
+            add->get_output_target_inputs(0).size() != 1 ||
+            sqrt->get_output_target_inputs(0).size() != 1) {
+            return false;
+        }
+
+        auto p_shape_input = data.get_partial_shape();
+        if (p_shape_input.rank().is_dynamic() || p_shape_input.rank().get_length() < 2) {
+            return false;
+        }
+        const int64_t rank = p_shape_input.rank().get_length();
+
+        ngraph::AxisSet mean_axes, variance_axes;
+        if (!get_reduction_axes(mean, rank, mean_axes) || !get_reduction_axes(variance, rank, variance_axes) ||
+            mean_axes != variance_axes) {
+            return false;
+        }
+
+        // MVN normalizes either over all the axes starting from the channel one or over the spatial axes
+        ngraph::AxisSet across_channels_axes, spatial_axes;
+        for (int64_t axis = 1; axis < rank; ++axis) {
+            across_channels_axes.insert(static_cast<size_t>(axis));
+            if (axis > 1)
+                spatial_axes.insert(static_cast<size_t>(axis));
+        }
+        if (mean_axes != across_channels_axes && mean_axes != spatial_axes) {
+            return false;
+        }
+
+        auto mvn = std::make_shared<ngraph::opset3::MVN>(data, mean_axes, true, eps);
+        mvn->set_friendly_name(div->get_friendly_name());
+        ngraph::copy_runtime_info({mean, sub, square, variance, add, sqrt, div}, mvn);
+
+        if (!transformation_callback(mvn)) {
+            return false;
+        }
+
+        ngraph::replace_node(div, mvn);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(div, "MVNFusion");
+    this->add_matcher(m, callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
@@ -3,10 +3,13 @@
 //
 
 #include <assert.h>
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <iterator>
 #include <ostream>
+#include <unordered_set>
+#include <vector>
 
 #include <ngraph/node.hpp>
 #include <ngraph/variant.hpp>
@@ -22,35 +25,79 @@ template class ngraph::VariantImpl<FusedNames>;
 
 constexpr VariantTypeInfo VariantWrapper<FusedNames>::type_info;
 
+// A name of an operation or a fusion of the sets of other names
+struct FusedNames::Names {
+    std::string name;
+    std::vector<std::shared_ptr<const Names>> fused;
+};
+
+FusedNames::FusedNames(const std::string &name)
+    : fused_names(std::make_shared<Names>(Names{name, {}})) {}
+
+std::set<std::string> FusedNames::collectNames() const {
+    std::set<std::string> names;
+    if (!fused_names) return names;
+
+    // the fusions share their sets, so every one is visited once
+    std::unordered_set<const Names*> visited;
+    std::vector<const Names*> stack{fused_names.get()};
+    while (!stack.empty()) {
+        const auto current = stack.back();
+        stack.pop_back();
+        if (!visited.insert(current).second) continue;
+        if (current->fused.empty()) {
+            names.insert(current->name);
+        }
+        for (const auto& fused : current->fused) {
+            stack.push_back(fused.get());
+        }
+    }
+    return names;
+}
+
 std::string FusedNames::getNames() const {
     std::string res;
-    for (auto &name : fused_names) {
+    for (auto &name : collectNames()) {
         res += (res.empty() ? name : "," + name);
     }
     return res;
 }
 
 std::vector<std::string> FusedNames::getVectorNames() const {
-    return std::vector<std::string>(fused_names.begin(), fused_names.end());
+    const auto names = collectNames();
+    return std::vector<std::string>(names.begin(), names.end());
 }
 
 void FusedNames::fuseWith(const FusedNames &names) {
-    for (auto name : names.fused_names) {
-        fused_names.insert(name);
+    if (!names.fused_names || names.fused_names == fused_names) return;
+    if (!fused_names) {
+        fused_names = names.fused_names;
+        return;
     }
+    fused_names = std::make_shared<Names>(Names{{}, {fused_names, names.fused_names}});
 }
 
 std::shared_ptr<ngraph::Variant> VariantWrapper<FusedNames>::merge(const ngraph::NodeVector & nodes) {
-    FusedNames mergedNames;
+    std::vector<std::shared_ptr<const FusedNames::Names>> fused;
     for (auto &node : nodes) {
         const auto &rtInfo = node->get_rt_info();
-        if (!rtInfo.count(VariantWrapper<FusedNames>::type_info.name)) continue;
-
-        const auto attr = rtInfo.at(VariantWrapper<FusedNames>::type_info.name);
-        if (auto fusedNames = std::dynamic_pointer_cast<VariantWrapper<FusedNames> >(attr)) {
-            mergedNames.fuseWith(fusedNames->get());
+        auto it = rtInfo.find(VariantWrapper<FusedNames>::type_info.name);
+        if (it == rtInfo.end()) continue;
+
+        if (auto fusedNames = std::dynamic_pointer_cast<VariantWrapper<FusedNames> >(it->second)) {
+            const auto& names = fusedNames->get().fused_names;
+            if (names && std::find(fused.begin(), fused.end(), names) == fused.end()) {
+                fused.push_back(names);
+            }
         }
     }
+
+    FusedNames mergedNames;
+    if (fused.size() == 1) {
+        mergedNames.fused_names = fused.front();
+    } else if (!fused.empty()) {
+        mergedNames.fused_names = std::make_shared<FusedNames::Names>(FusedNames::Names{{}, std::move(fused)});
+    }
     return std::make_shared<VariantWrapper<FusedNames> >(mergedNames);
 }
 
@@ -55,6 +55,23 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    //
+    // Makes the environment of the current compilation available in a worker thread (e.g. of ie::parallel_for)
+    // while the object exists. The worker must only read the environment.
+    //
+
+    class Scope final {
+    public:
+        explicit Scope(const CompileEnv& env);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CompileEnv* _prevEnv = nullptr;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
@@ -68,6 +68,9 @@ public:
     void processParametersNode(const pugi::xml_node& node);
     void processWorkSizesNode(const pugi::xml_node& node);
 
+    // the local work size of a dimension is picked at compile time
+    static bool isAutoSizeRule(const std::string& rule);
+
     int maxShaves() const { return _maxShaves; }
     const std::string& kernelBinary() const { return _kernelBinary; }
     SmallVector<KernelParam> bindings() const { return _kernelParams; }
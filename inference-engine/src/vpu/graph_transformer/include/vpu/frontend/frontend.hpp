@@ -69,6 +69,9 @@ private:
     void moveConstInputsToBlobs(
             ie::ICNNNetwork& network);
 
+    void foldConstFakeQuantize(
+            ie::ICNNNetwork& network);
+
     //
     // Process internal VPU Model
     //
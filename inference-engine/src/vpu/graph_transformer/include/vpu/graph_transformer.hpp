@@ -59,6 +59,7 @@ struct CompilationConfig final {
     Optional<bool> packDataInCmx;
     bool mergeHwPoolToConv = true;
     bool hwDilation = false;
+    bool hwTilingCostModel = false;
     bool forceDeprecatedCnnConversion = false;
 
     std::map<std::string, std::vector<int>> ioStrides;
@@ -154,6 +155,13 @@ struct CompiledGraph final {
     std::uint32_t numShaves = 0;
     std::uint32_t numSlices = 0;
     std::uint32_t numExecutors = 0;
+
+    // Intermediate data allocation statistics
+    int usedBSS = 0;
+    int usedCMX = 0;
+    int peakLiveBSS = 0;
+    int peakLiveCMX = 0;
+    int spilledFromCMX = 0;
 };
 
 //
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <unordered_set>
+#include <unordered_map>
 #include <list>
 #include <vector>
 
@@ -27,8 +28,18 @@ struct UsedMemory final {
     int blob = 0;
     int input = 0;
     int output = 0;
+
+    // The largest amount of simultaneously live intermediate data,
+    // the difference with BSS/CMX is lost to fragmentation
+    int BSSPeakLive = 0;
+    int CMXPeakLive = 0;
+
+    // Bytes of CMX candidates moved to DDR because CMX was exhausted
+    int spilledFromCMX = 0;
 };
 
+int fragmentationPercent(int used, int peakLive);
+
 void printTo(std::ostream& os, const UsedMemory& usedMemory);
 void printTo(DotLabel& lbl, const UsedMemory& usedMemory);
 
@@ -99,11 +110,12 @@ public:
     AllocatorForShaves& getAllocatorOfShaves() { return _allocatorOfShaves; }
 
 private:
-    allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse);
+    allocator::MemChunk* allocateMem(MemoryType memType, int size, int inUse, int lifetimeEnd);
     void freeMem(allocator::MemChunk* chunk);
 
-    allocator::MemChunk* addNewChunk(allocator::MemoryPool& pool, MemoryType memType, int offset, int pointer, int size, int inUse);
-    allocator::MemChunk* checkMemPool(allocator::MemoryPool& pool, MemoryType memType, int size, int inUse);
+    allocator::MemChunk* addNewChunk(allocator::MemoryPool& pool, MemoryType memType, int offset, int pointer, int size, int inUse,
+                                     int lifetimeEnd);
+    allocator::MemChunk* checkMemPool(allocator::MemoryPool& pool, MemoryType memType, int size, int inUse, int lifetimeEnd);
 
     void extractDatas(MemoryType memType, const DataSet& from, DataVector& out) const;
 
@@ -126,10 +138,21 @@ private:
 
     DataMap<allocator::MemChunk*> _memChunksPerData;
 
+    /**
+     * Const data allocated in the blob keyed by the hash of their content, the data with equal
+     * content share the same blob memory
+     */
+    std::unordered_multimap<size_t, Data> _constDataByHash;
+
     int _blobMemOffset = 0;
     int _inputMemOffset = 0;
     int _outputMemOffset = 0;
 
+    /**
+     * Accumulated over all allocator runs, as the spilled data keep DDR requirements
+     */
+    int _spilledFromCMX = 0;
+
     /**
      * Means that Model::_datas list was changed in some way
      */
@@ -34,6 +34,7 @@ struct MemChunk final {
     int offset = 0;
     int size = 0;
     int inUse = 0;
+    int lifetimeEnd = 0;
 
     std::list<MemChunk>::iterator _posInList;
 };
@@ -46,12 +47,16 @@ struct FreeMemory final {
 struct MemoryPool final {
     int curMemOffset = 0;
     int memUsed = 0;
+    int liveBytes = 0;
+    int peakLiveBytes = 0;
     std::list<MemChunk> allocatedChunks;
     SmallVector<FreeMemory> freePool;
 
     void clear() {
         curMemOffset = 0;
         memUsed = 0;
+        liveBytes = 0;
+        peakLiveBytes = 0;
         allocatedChunks.clear();
         freePool.clear();
     }
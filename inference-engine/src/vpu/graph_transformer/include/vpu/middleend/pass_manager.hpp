@@ -146,6 +146,7 @@ public:
     // Model SW-specific optimizations
     //
 
+    Pass::Ptr mergePostOpChains();
     Pass::Ptr mergeReLUAndBias();
     Pass::Ptr mergeEltwiseAndReLU();
     Pass::Ptr replaceWithSCReLU();
@@ -29,6 +29,12 @@ DECLARE_VPU_CONFIG_KEY(HW_POOL_CONV_MERGE);
 DECLARE_VPU_CONFIG_KEY(PACK_DATA_IN_CMX);
 DECLARE_VPU_CONFIG_KEY(HW_DILATION);
 DECLARE_VPU_CONFIG_KEY(HW_EXTRA_SPLIT);
+
+/**
+ * @brief Ranks the tilings of HW convolutions by an estimate of DMA and HW compute cycles
+ * instead of the number of descriptors. Default is "NO".
+ */
+DECLARE_VPU_CONFIG_KEY(HW_TILING_COST_MODEL);
 DECLARE_VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION);
 
 DECLARE_VPU_CONFIG_KEY(PERF_REPORT_MODE);
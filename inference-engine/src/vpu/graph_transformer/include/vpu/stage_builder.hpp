@@ -58,6 +58,15 @@ public:
             const Data& scales,
             const Data& output);
 
+    Stage addScaleShiftStage(
+            const Model& model,
+            const std::string& name,
+            const ie::CNNLayerPtr& layer,
+            const Data& input,
+            const Data& scales,
+            const Data& biases,
+            const Data& output);
+
     Stage addCopyStage(
             const Model& model,
             const std::string& name,
@@ -52,6 +52,12 @@ CompiledGraph::Ptr BackEnd::build(
     compiledGraph->inputBufSize = usedMemory.input;
     compiledGraph->outputBufSize = usedMemory.output;
 
+    compiledGraph->usedBSS = usedMemory.BSS;
+    compiledGraph->usedCMX = usedMemory.CMX;
+    compiledGraph->peakLiveBSS = usedMemory.BSSPeakLive;
+    compiledGraph->peakLiveCMX = usedMemory.CMXPeakLive;
+    compiledGraph->spilledFromCMX = usedMemory.spilledFromCMX;
+
     const auto& resources = model->attrs().get<Resources>("resources");
     compiledGraph->numShaves = checked_cast<std::uint32_t>(resources.numSHAVEs);
     compiledGraph->numSlices = checked_cast<std::uint32_t>(resources.numCMXSlices);
@@ -410,6 +410,10 @@ void CustomKernel::processParametersNode(const pugi::xml_node& node) {
     }
 }
 
+bool CustomKernel::isAutoSizeRule(const std::string& rule) {
+    return ie::details::CaselessEq<std::string>{}(rule, "auto");
+}
+
 void CustomKernel::processWorkSizesNode(const pugi::xml_node& node) {
     const auto workSizes = node.child("WorkSizes");
 
@@ -421,6 +425,15 @@ void CustomKernel::processWorkSizesNode(const pugi::xml_node& node) {
 
     const auto lwgs = XMLParseUtils::GetStrAttr(workSizes, "local");
     _localGridSizeRules = parseSizeRule(lwgs);
+    // a single "auto" stands for all the dimensions
+    if (_localGridSizeRules.size() == 1 && isAutoSizeRule(_localGridSizeRules[0])) {
+        _localGridSizeRules.resize(_globalGridSizeRules.size(), _localGridSizeRules[0]);
+    }
+
+    if (_localGridSizeRules.size() != _globalGridSizeRules.size()) {
+        THROW_IE_EXCEPTION << "WorkSizes node has " << _globalGridSizeRules.size() << " global and "
+                           << _localGridSizeRules.size() << " local sizes";
+    }
 }
 
 } // namespace vpu
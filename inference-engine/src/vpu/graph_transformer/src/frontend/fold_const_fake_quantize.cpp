@@ -0,0 +1,226 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/frontend/frontend.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <precision_utils.h>
+#include <details/ie_cnn_network_tools.h>
+#include <details/caseless.hpp>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/utils/ie_helpers.hpp>
+
+#include "cnn_network_impl.hpp"
+
+namespace vpu {
+
+namespace {
+
+bool isConstLayer(const ie::CNNLayerPtr& layer) {
+    return layer != nullptr && layer->type == "Const" && layer->insData.empty() &&
+           layer->outData.size() == 1 && layer->blobs.count("custom") != 0;
+}
+
+ie::Blob::Ptr getConstBlob(const ie::DataWeakPtr& data) {
+    const auto creator = ie::getCreatorLayer(data.lock()).lock();
+    return isConstLayer(creator) ? creator->blobs.at("custom") : nullptr;
+}
+
+std::vector<float> toFloat(const ie::Blob::Ptr& blob) {
+    std::vector<float> values(blob->size());
+
+    const auto precision = blob->getTensorDesc().getPrecision();
+    if (precision == ie::Precision::FP32) {
+        const auto src = blob->cbuffer().as<const float*>();
+        std::copy_n(src, values.size(), values.begin());
+    } else if (precision == ie::Precision::FP16) {
+        const auto src = blob->cbuffer().as<const ie::ie_fp16*>();
+        std::transform(src, src + values.size(), values.begin(), ie::PrecisionUtils::f16tof32);
+    } else {
+        values.clear();
+    }
+
+    return values;
+}
+
+//
+// Maps the offset of an element of the data tensor to the offset in a range tensor having
+// numpy broadcastable dimensions (usually a scalar or the per output channel [O, 1, 1, 1]).
+//
+
+class BroadcastIndex final {
+public:
+    BroadcastIndex(const ie::SizeVector& dataDims, const ie::SizeVector& rangeDims) {
+        const auto rank = dataDims.size();
+        _dataDims = dataDims;
+        _rangeStrides.assign(rank, 0);
+
+        size_t stride = 1;
+        for (size_t i = 0; i < std::min(rank, rangeDims.size()); ++i) {
+            const auto dataInd = rank - 1 - i;
+            const auto rangeDim = rangeDims[rangeDims.size() - 1 - i];
+            _rangeStrides[dataInd] = rangeDim == 1 ? 0 : stride;
+            stride *= rangeDim;
+        }
+    }
+
+    size_t operator()(size_t dataOffset) const {
+        size_t rangeOffset = 0;
+        for (size_t i = _dataDims.size(); i-- > 0;) {
+            rangeOffset += (dataOffset % _dataDims[i]) * _rangeStrides[i];
+            dataOffset /= _dataDims[i];
+        }
+        return rangeOffset;
+    }
+
+private:
+    ie::SizeVector _dataDims;
+    ie::SizeVector _rangeStrides;
+};
+
+bool isBroadcastable(const ie::SizeVector& dataDims, const ie::SizeVector& rangeDims) {
+    if (rangeDims.size() > dataDims.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < rangeDims.size(); ++i) {
+        const auto rangeDim = rangeDims[rangeDims.size() - 1 - i];
+        if (rangeDim != 1 && rangeDim != dataDims[dataDims.size() - 1 - i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ie::Blob::Ptr fakeQuantize(const ie::CNNLayerPtr& layer, const std::vector<ie::Blob::Ptr>& inputs) {
+    const auto levels = layer->GetParamAsUInt("levels");
+    if (levels < 2) {
+        return nullptr;
+    }
+
+    std::vector<std::vector<float>> values;
+    for (const auto& input : inputs) {
+        values.push_back(toFloat(input));
+        if (values.back().empty()) {
+            return nullptr;
+        }
+    }
+
+    const auto& dataDims = inputs[0]->getTensorDesc().getDims();
+
+    std::vector<BroadcastIndex> indices;
+    for (size_t i = 1; i < inputs.size(); ++i) {
+        const auto& rangeDims = inputs[i]->getTensorDesc().getDims();
+        if (!isBroadcastable(dataDims, rangeDims)) {
+            return nullptr;
+        }
+        indices.emplace_back(dataDims, rangeDims);
+    }
+
+    const auto& src = values[0];
+    std::vector<float> dst(src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        const auto inputLow = values[1][indices[0](i)];
+        const auto inputHigh = values[2][indices[1](i)];
+        const auto outputLow = values[3][indices[2](i)];
+        const auto outputHigh = values[4][indices[3](i)];
+
+        if (src[i] <= std::min(inputLow, inputHigh)) {
+            dst[i] = outputLow;
+        } else if (src[i] > std::max(inputLow, inputHigh)) {
+            dst[i] = outputHigh;
+        } else {
+            const auto level = std::round((src[i] - inputLow) / (inputHigh - inputLow) * (levels - 1));
+            dst[i] = level / (levels - 1) * (outputHigh - outputLow) + outputLow;
+        }
+    }
+
+    const auto outDesc = layer->outData[0]->getTensorDesc();
+    auto output = ie::make_shared_blob<float>({ie::Precision::FP32, outDesc.getDims(), outDesc.getLayout()});
+    output->allocate();
+    std::copy(dst.begin(), dst.end(), output->buffer().as<float*>());
+
+    if (outDesc.getPrecision() == ie::Precision::FP16) {
+        return convertBlobFP32toFP16(output);
+    }
+
+    return output;
+}
+
+}  // namespace
+
+void FrontEnd::foldConstFakeQuantize(ie::ICNNNetwork& network) {
+    VPU_PROFILE(foldConstFakeQuantize);
+
+    const auto& env = CompileEnv::get();
+
+    env.log->trace("Fold FakeQuantize of constants");
+    VPU_LOGGER_SECTION(env.log);
+
+    auto implNetwork = dynamic_cast<ie::details::CNNNetworkImpl *>(&network);
+    VPU_THROW_UNLESS(implNetwork != nullptr, "FrontEnd::foldConstFakeQuantize expects CNNNetworkImpl");
+
+    for (const auto& layer : ie::details::CNNNetSortTopologically(network)) {
+        if (!ie::details::CaselessEq<std::string>()(layer->type, "FakeQuantize") ||
+            layer->insData.size() != 5 || layer->outData.size() != 1) {
+            continue;
+        }
+
+        const auto& outPrecision = layer->outData[0]->getPrecision();
+        if (outPrecision != ie::Precision::FP32 && outPrecision != ie::Precision::FP16) {
+            continue;
+        }
+
+        std::vector<ie::Blob::Ptr> inputs;
+        for (const auto& input : layer->insData) {
+            inputs.push_back(getConstBlob(input));
+        }
+        if (std::any_of(inputs.begin(), inputs.end(), [](const ie::Blob::Ptr& blob) { return blob == nullptr; })) {
+            continue;
+        }
+
+        const auto folded = fakeQuantize(layer, inputs);
+        if (folded == nullptr) {
+            continue;
+        }
+
+        env.log->trace("Fold FakeQuantize layer %s", layer->name);
+
+        //
+        // The FakeQuantize is replaced with a Const layer producing the same data, the weights then
+        // reach the consumers the same way as the weights of a not quantized network.
+        //
+
+        const ie::LayerParams constParams {layer->name + "@const", "Const", outPrecision};
+        auto constLayer = std::make_shared<ie::CNNLayer>(constParams);
+        constLayer->blobs["custom"] = folded;
+        constLayer->outData = layer->outData;
+        ie::getCreatorLayer(constLayer->outData[0]) = constLayer;
+
+        std::vector<ie::DataPtr> inputsData;
+        for (const auto& input : layer->insData) {
+            inputsData.push_back(input.lock());
+        }
+
+        for (const auto& inputData : inputsData) {
+            const auto inputLayer = ie::getCreatorLayer(inputData).lock();
+
+            ie::getInputTo(inputData).erase(layer->name);
+            if (ie::getInputTo(inputData).empty()) {
+                implNetwork->removeData(inputData->getName());
+                implNetwork->removeLayer(inputLayer->name);
+            }
+        }
+
+        implNetwork->removeLayer(layer->name);
+        implNetwork->addLayer(constLayer);
+    }
+}
+
+}  // namespace vpu
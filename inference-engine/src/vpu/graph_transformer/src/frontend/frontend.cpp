@@ -210,9 +210,12 @@ CustomLayer::Ptr FrontEnd::getSuitableCustomLayer(const std::vector<CustomLayer:
             const auto validSizeRule = [&](const std::string& rule) {
                 return CustomLayer::isLegalSizeRule(rule, cnnLayer->params);
             };
+            const auto validLocalSizeRule = [&](const std::string& rule) {
+                return CustomKernel::isAutoSizeRule(rule) || validSizeRule(rule);
+            };
 
             const auto validGridSizes = std::all_of(begin(gws), end(gws), validSizeRule) &&
-                                        std::all_of(begin(lws), end(lws), validSizeRule);
+                                        std::all_of(begin(lws), end(lws), validLocalSizeRule);
 
             if (!validGridSizes) {
                 env.log->trace("Work group grid sizes are not valid");
@@ -409,6 +412,8 @@ ModelPtr FrontEnd::runCommonPasses(ie::ICNNNetwork& network, const UnsupportedLa
         ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, ie::Precision::U64, ie::Precision::I32);
         ie::NetPass::ConvertPrecision(*originalOrConvertNetwork, ie::Precision::BOOL, ie::Precision::I32);
 
+        foldConstFakeQuantize(*originalOrConvertNetwork);
+
         moveConstInputsToBlobs(*originalOrConvertNetwork);
 
         removeConstLayers(*originalOrConvertNetwork);
@@ -139,6 +139,16 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+CompileEnv::Scope::Scope(const CompileEnv& env) : _prevEnv(g_compileEnv) {
+    IE_ASSERT(env.initialized);
+
+    g_compileEnv = const_cast<CompileEnv*>(&env);
+}
+
+CompileEnv::Scope::~Scope() {
+    g_compileEnv = _prevEnv;
+}
+
 //
 // compileNetwork
 //
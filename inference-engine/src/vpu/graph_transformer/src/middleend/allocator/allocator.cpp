@@ -8,6 +8,9 @@
 #include <algorithm>
 #include <limits>
 #include <set>
+#include <cstdlib>
+
+#include <ie_data_hash.hpp>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/model/model.hpp>
@@ -28,6 +31,11 @@ void printTo(std::ostream& os, const UsedMemory& usedMemory) {
     os << "blob=" << usedMemory.blob << std::endl;
     os << "input=" << usedMemory.input << std::endl;
     os << "output=" << usedMemory.output << std::endl;
+    os << "BSSPeakLive=" << usedMemory.BSSPeakLive << std::endl;
+    os << "BSSFragmentation=" << fragmentationPercent(usedMemory.BSS, usedMemory.BSSPeakLive) << "%" << std::endl;
+    os << "CMXPeakLive=" << usedMemory.CMXPeakLive << std::endl;
+    os << "CMXFragmentation=" << fragmentationPercent(usedMemory.CMX, usedMemory.CMXPeakLive) << "%" << std::endl;
+    os << "spilledFromCMX=" << usedMemory.spilledFromCMX << std::endl;
 
     os << "]";
 }
@@ -39,6 +47,15 @@ void printTo(DotLabel& lbl, const UsedMemory& usedMemory) {
     subLbl.appendPair("blob", usedMemory.blob);
     subLbl.appendPair("input", usedMemory.input);
     subLbl.appendPair("output", usedMemory.output);
+    subLbl.appendPair("BSSPeakLive", usedMemory.BSSPeakLive);
+    subLbl.appendPair("BSSFragmentation%", fragmentationPercent(usedMemory.BSS, usedMemory.BSSPeakLive));
+    subLbl.appendPair("CMXPeakLive", usedMemory.CMXPeakLive);
+    subLbl.appendPair("CMXFragmentation%", fragmentationPercent(usedMemory.CMX, usedMemory.CMXPeakLive));
+    subLbl.appendPair("spilledFromCMX", usedMemory.spilledFromCMX);
+}
+
+int fragmentationPercent(int used, int peakLive) {
+    return used > 0 ? static_cast<int>(100LL * (used - peakLive) / used) : 0;
 }
 
 //
@@ -60,6 +77,15 @@ Allocator::Allocator(): _allocatorOfShaves(_cmxMemoryPool) {
 
 namespace {
 
+size_t hashContent(const DataContent& content) {
+    return static_cast<size_t>(InferenceEngine::computeDataHash(content.get<uint8_t>(), content.byteSize()));
+}
+
+bool equalContent(const DataContent& lhs, const DataContent& rhs) {
+    return lhs.byteSize() == rhs.byteSize() &&
+           std::equal(lhs.get<uint8_t>(), lhs.get<uint8_t>() + lhs.byteSize(), rhs.get<uint8_t>());
+}
+
 void updateChildDataAllocation(const Data& data, int offsetLimitation) {
     for (const auto& edge : data->childDataToDataEdges()) {
         auto parent = edge->parent();
@@ -112,6 +138,33 @@ int getInUse(const Data& data) {
     return inUse;
 }
 
+//
+// Index of the last stage which uses the data or its children.
+// The data which are left for the network outputs live till the end.
+//
+
+int getLifetimeEnd(const Data& data) {
+    if (data->usage() == DataUsage::Temp) {
+        const auto& tempBufferEdge = data->tempBufferEdge();
+        return tempBufferEdge != nullptr ? tempBufferEdge->stage()->index() : 0;
+    }
+
+    int lifetimeEnd = data->producer() != nullptr ? data->producer()->index() : 0;
+    for (const auto& consumer : data->consumers()) {
+        lifetimeEnd = std::max(lifetimeEnd, consumer->index());
+    }
+    for (const auto& childData : data->childDatas()) {
+        lifetimeEnd = std::max(lifetimeEnd, getLifetimeEnd(childData));
+    }
+    for (const auto& childEdge : data->childDataToShapeEdges()) {
+        const auto& child = childEdge->child();
+        if (child->usage() == DataUsage::Output) {
+            return std::numeric_limits<int>::max();
+        }
+        lifetimeEnd = std::max(lifetimeEnd, getLifetimeEnd(child));
+    }
+    return lifetimeEnd;
+}
 
 }  // namespace
 
@@ -195,10 +248,24 @@ bool Allocator::allocateData(const Data& data) {
             IE_ASSERT(data->checkStrides(StridesRequirement::compact()));
             IE_ASSERT(data->content() != nullptr);
 
-            auto finalByteSize = calcAllocationSize(data);
+            const auto finalByteSize = calcAllocationSize(data);
+            const auto& content = *data->content();
+            const auto hash = hashContent(content);
 
-            data->setDataAllocationInfo({Location::Blob, _blobMemOffset});
-            _blobMemOffset += finalByteSize;
+            const auto candidates = _constDataByHash.equal_range(hash);
+            const auto same = std::find_if(candidates.first, candidates.second, [&](const std::pair<const size_t, Data>& candidate) {
+                const auto& other = candidate.second;
+                return calcAllocationSize(other) == finalByteSize && equalContent(*other->content(), content);
+            });
+
+            if (same != candidates.second) {
+                data->setDataAllocationInfo(same->second->dataLocation());
+            } else {
+                data->setDataAllocationInfo({Location::Blob, _blobMemOffset});
+                _blobMemOffset += finalByteSize;
+
+                _constDataByHash.emplace(hash, data);
+            }
 
             updateChildDataAllocation(data, DDR_MAX_SIZE);
 
@@ -275,7 +342,7 @@ bool Allocator::allocateData(const Data& data) {
         "allocateData failed: data {} with usage {} isn't used by anything",
         data->name(), data->usage());
 
-    auto chunk = allocateMem(memoryType, finalByteSize, inUse);
+    auto chunk = allocateMem(memoryType, finalByteSize, inUse, getLifetimeEnd(data));
 
     if (chunk == nullptr) {
         return false;
@@ -410,10 +477,11 @@ void Allocator::freeData(const Data& data, DeallocationMode mode) {
 
             auto curChunkSz = chunk->size;
             auto inUse = chunk->inUse;
+            auto lifetimeEnd = chunk->lifetimeEnd;
 
             freeMem(chunk);
 
-            auto ddrChunk = allocateMem(MemoryType::DDR, curChunkSz, inUse);
+            auto ddrChunk = allocateMem(MemoryType::DDR, curChunkSz, inUse, lifetimeEnd);
             IE_ASSERT(ddrChunk!= nullptr);
 
             _memChunksPerData[data] = ddrChunk;
@@ -448,6 +516,9 @@ UsedMemory Allocator::usedMemoryAmount() const {
     stats.blob = _blobMemOffset;
     stats.input = _inputMemOffset;
     stats.output = _outputMemOffset;
+    stats.BSSPeakLive = _ddrMemoryPool.peakLiveBytes;
+    stats.CMXPeakLive = _cmxMemoryPool.peakLiveBytes;
+    stats.spilledFromCMX = _spilledFromCMX;
 
     return stats;
 }
@@ -506,7 +577,7 @@ DataVector Allocator::getAllocatedDatas(MemoryType memType) const {
     return out;
 }
 
-allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int inUse) {
+allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int inUse, int lifetimeEnd) {
     VPU_THROW_UNLESS(size >= 0, "{} bytes to allocate have been requested, but only non-negative amount is supported", size);
     if (size == 0) {
         return nullptr;
@@ -518,7 +589,7 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
     // Try to reuse already allocated memory
     //
 
-    if (auto chunk = checkMemPool(*memPool, memType, size, inUse)) {
+    if (auto chunk = checkMemPool(*memPool, memType, size, inUse, lifetimeEnd)) {
         memPool->memUsed = std::max(memPool->memUsed, chunk->offset + chunk->size);
         return chunk;
     }
@@ -544,7 +615,7 @@ allocator::MemChunk* Allocator::allocateMem(MemoryType memType, int size, int in
         pointer = memPool->curMemOffset;
     }
 
-    auto chunk = addNewChunk(*memPool, memType, memPool->curMemOffset, pointer, size, inUse);
+    auto chunk = addNewChunk(*memPool, memType, memPool->curMemOffset, pointer, size, inUse, lifetimeEnd);
     IE_ASSERT(chunk != nullptr);
 
     memPool->curMemOffset += size;
@@ -608,26 +679,33 @@ void Allocator::freeMem(allocator::MemChunk* chunk) {
         }
     }
 
+    memPool->liveBytes -= chunk->size;
+
     IE_ASSERT(chunk->_posInList != memPool->allocatedChunks.end());
     memPool->allocatedChunks.erase(chunk->_posInList);
 }
 
-allocator::MemChunk* Allocator::addNewChunk(allocator::MemoryPool& memPool, MemoryType memType, int offset, int pointer, int size, int inUse) {
+allocator::MemChunk* Allocator::addNewChunk(allocator::MemoryPool& memPool, MemoryType memType, int offset, int pointer, int size, int inUse,
+                                            int lifetimeEnd) {
     allocator::MemChunk newChunkValues;
     newChunkValues.memType = memType;
     newChunkValues.pointer = pointer;
     newChunkValues.offset = offset;
     newChunkValues.size = size;
     newChunkValues.inUse = inUse;
+    newChunkValues.lifetimeEnd = lifetimeEnd;
     auto it = memPool.allocatedChunks.emplace(memPool.allocatedChunks.end(), newChunkValues);
 
     auto newChunk = &memPool.allocatedChunks.back();
     newChunk->_posInList = it;
 
+    memPool.liveBytes += size;
+    memPool.peakLiveBytes = std::max(memPool.peakLiveBytes, memPool.liveBytes);
+
     return newChunk;
 }
 
-allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, MemoryType memType, int size, int inUse) {
+allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, MemoryType memType, int size, int inUse, int lifetimeEnd) {
     auto minMemSizeToUse = std::numeric_limits<size_t>::max();
     auto minMemIt = memPool.freePool.end();
 
@@ -644,7 +722,26 @@ allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, Mem
         return nullptr;
     }
 
-    auto offset = minMemIt->offset + minMemIt->size - size;
+    //
+    // Place the chunk next to the neighbour of the free block whose lifetime ends closest to the chunk's one:
+    // they are released at about the same time and the free blocks coalesce instead of fragmenting the pool.
+    //
+
+    const auto freeBegin = minMemIt->offset;
+    const auto freeEnd = minMemIt->offset + minMemIt->size;
+
+    auto lowerSlack = std::numeric_limits<int>::max();
+    auto upperSlack = std::numeric_limits<int>::max();
+    for (const auto& neighbour : memPool.allocatedChunks) {
+        if (neighbour.offset + neighbour.size == freeBegin) {
+            lowerSlack = std::abs(neighbour.lifetimeEnd - lifetimeEnd);
+        } else if (neighbour.offset == freeEnd) {
+            upperSlack = std::abs(neighbour.lifetimeEnd - lifetimeEnd);
+        }
+    }
+
+    const auto placeAtBegin = lowerSlack < upperSlack;
+    auto offset = placeAtBegin ? freeBegin : freeEnd - size;
 
     int pointer = 0;
     if (memType == MemoryType::DDR) {
@@ -654,8 +751,11 @@ allocator::MemChunk* Allocator::checkMemPool(allocator::MemoryPool& memPool, Mem
         pointer = _maxCmxSize - offset - size;
     }
 
-    auto chunk = addNewChunk(memPool, memType, offset, pointer, size, inUse);
+    auto chunk = addNewChunk(memPool, memType, offset, pointer, size, inUse, lifetimeEnd);
 
+    if (placeAtBegin) {
+        minMemIt->offset += size;
+    }
     minMemIt->size -= size;
 
     if (minMemIt->size == 0) {
@@ -689,6 +789,7 @@ AllocationResult Allocator::preprocess(const Model& model) {
 
         _blobMemOffset = 0;
         _inputMemOffset = 0;
+        _constDataByHash.clear();
         _outputMemOffset = 0;
 
         for (const auto& data : model->datas()) {
@@ -730,6 +831,8 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
             freeData(data, DeallocationMode::MoveFromCMX);
         }
 
+        _spilledFromCMX += calcAllocationSize(data);
+
         loopOverData(data, [](const Data& subData) {
             subData->setMemReqs(MemoryType::DDR);
             return DataLoopStatus::NextChild;
@@ -747,6 +850,8 @@ bool Allocator::removeCMXCandidates(const vpu::Data& data) {
             it = _candidatesForCMX.find(cmxData);
 
             if (it != _candidatesForCMX.end()) {
+                _spilledFromCMX += calcAllocationSize(cmxData);
+
                 freeData(cmxData, DeallocationMode::MoveFromCMX);
 
                 loopOverData(cmxData, [](const Data& subData) {
@@ -272,7 +272,9 @@ bool HWConvolutionTiler::tileForHW() {
     for (const TilingOption& tilingOption : tilingOptions) {
         const auto& tileLayoutCut = _searcher.tileLayoutCut(tilingOption);
         if (tileLayoutCut.tileCutPossible()) {
-            _hwTilings.push_back(tileLayoutCut.hwTiling());
+            auto hwTiling = tileLayoutCut.hwTiling();
+            hwTiling->cost = tilingOption.cost;
+            _hwTilings.push_back(hwTiling);
         }
     }
 
@@ -614,6 +616,52 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
     }
 }
 
+namespace {
+
+//
+// Estimates HW cycles of one channel tile of the plane tile. The DMA of the tile is overlapped with the computations,
+// so the longest of them is taken, plus the setup of the descriptors.
+// The numbers are rough Myriad X estimates: DDR moves 8 bytes per cycle, unaligned transfers are twice slower,
+// HW computes one output pixel of a descriptor block per cycle of the descriptor cost.
+//
+
+double estimateTileCycles(const ConvolutionOptions& convolutionOptions,
+                          const HwPlaneTileInfo& widthTile, const HwPlaneTileInfo& heightTile,
+                          const HwConvTileInfo& tileInfo, int outputChannels, int numChannelTiles) {
+    const double ddrBytesPerCycle = 8.0;
+    const double unalignedDmaSlowdown = 2.0;
+    const double descriptorSetupCycles = 100.0;
+
+    const auto isAligned = [](int startIndex) {
+        return (startIndex * sizeof(fp16_t)) % 16 == 0;
+    };
+
+    const double outputPixels = static_cast<double>(widthTile.outputWithJunk) * heightTile.outputWithJunk;
+    const double computeCycles = outputPixels * tileInfo.cost;
+
+    double inputBytes = static_cast<double>(widthTile.inputWithJunk) * heightTile.inputWithJunk
+                        * tileInfo.extendedInputDimC * sizeof(fp16_t);
+    if (!isAligned(widthTile.inputStartIndex)) {
+        inputBytes *= unalignedDmaSlowdown;
+    }
+
+    // the partial sums of SoC are read back to be accumulated
+    double outputBytes = outputPixels * outputChannels * sizeof(fp16_t) * (numChannelTiles > 1 ? 2 : 1);
+    if (!isAligned(widthTile.outputStartIndex)) {
+        outputBytes *= unalignedDmaSlowdown;
+    }
+
+    // every plane tile loads the weights of its channel tile again
+    const double weightsBytes = static_cast<double>(convolutionOptions._kernelSizeX) * convolutionOptions._kernelSizeY
+                                * tileInfo.extendedInputDimC * tileInfo.extendedOutputDimC * sizeof(fp16_t);
+
+    const double dmaCycles = (inputBytes + outputBytes + weightsBytes) / ddrBytesPerCycle;
+
+    return std::max(computeCycles, dmaCycles) + tileInfo.numDescr * descriptorSetupCycles;
+}
+
+}  // namespace
+
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
@@ -786,6 +834,12 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         // Calc tile cost.
                         //
 
+                        if (env.config.hwTilingCostModel) {
+                            solutionCost += estimateTileCycles(_convolutionOptions, widthTile, heightTile, tileInfo,
+                                                               outputTileInitial[Dim::C], numChannelTiles) * numChannelTiles;
+                            continue;
+                        }
+
                         solutionCost += tileInfo.cost * numChannelTiles;
 
                         // Alignment for output
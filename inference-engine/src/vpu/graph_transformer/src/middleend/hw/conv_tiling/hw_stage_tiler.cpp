@@ -474,6 +474,8 @@ void HWConvStageTiler::createHWStageForTile(const Data& hwInputTile,
     hwStage->attrs().set<HwPaddingInfo>("pad", hwPad);
 
     hwStage->attrs().set<HwConvTileInfo>("tiling", channelTile->finalTiles);
+    // the tiling of the whole convolution, to see it in the graph dump
+    hwStage->attrs().set<HwConvTilingPtr>("convTiling", tiling);
 
     if (tiling->socTiles > 1) {
         hwStage->attrs().set<bool>("withReLU", false);
@@ -246,6 +246,9 @@ PassSet::Ptr PassManager::buildMiddleEnd() {
     // Model SW-specific optimizations
     //
 
+    ADD_PASS(mergePostOpChains);
+    ADD_DUMP_PASS("mergePostOpChains");
+
     ADD_PASS(mergeReLUAndBias);
     ADD_DUMP_PASS("mergeReLUAndBias");
 
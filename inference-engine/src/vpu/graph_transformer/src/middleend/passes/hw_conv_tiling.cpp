@@ -5,9 +5,14 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
+
+#include <exception>
 #include <utility>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,38 +36,38 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
-void PassImpl::run(const Model& model) {
-    VPU_PROFILE(hwConvTiling);
-
-    for (const auto& origStage : model->getStages()) {
-        if (origStage->type() != StageType::StubConv) {
-            continue;
-        }
-
-        const auto tryHW = origStage->attrs().getOrDefault<bool>("tryHW", false);
-        if (!tryHW) {
-            continue;
-        }
-
-        const HWConvStageOptions stageOptions(origStage);
-        const HWConvStageIO stageIO(origStage, origStage->output(0));
-
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+// Tries to find "best" tiling, depends on the dimensions of the stage only
+std::unique_ptr<HWTilingNS::HWConvolutionTiler> findTiling(const Stage& origStage) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+
+    std::unique_ptr<HWTilingNS::HWConvolutionTiler> tiler(
+        new HWTilingNS::HWConvolutionTiler(convolutionOptions, direction, tilingsCount));
+
+    if (!tiler->isTilingPossible() && tiler->withPool()) {
+        const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
+            stageIO.origOutputDesc.dims(),
             stageIO.origOutputDesc.dims(),
             stageOptions.kernelSizeX,
             stageOptions.kernelSizeY,
@@ -71,34 +76,56 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            stageOptions.withPool
+            false
         };
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
+        tiler.reset(new HWTilingNS::HWConvolutionTiler(optionsWithoutPool, direction, tilingsCount));
+    }
+
+    return tiler;
+}
+
+void PassImpl::run(const Model& model) {
+    VPU_PROFILE(hwConvTiling);
+
+    const auto& env = CompileEnv::get();
+
+    StageVector hwStages;
+    for (const auto& stage : model->getStages()) {
+        if (stage->type() == StageType::StubConv && stage->attrs().getOrDefault<bool>("tryHW", false)) {
+            hwStages.push_back(stage);
+        }
+    }
+
+    //
+    // The search does not change the model, it is done for all the stages in parallel.
+    // The dimensions of the stages are not affected by the tiling of the other ones.
+    //
+
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    ie::parallel_for(hwStages.size(), [&](size_t i) {
+        try {
+            CompileEnv::Scope scope(env);
+            tilers[i] = findTiling(hwStages[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
             }
-        }();
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    for (size_t i = 0; i < hwStages.size(); ++i) {
+        const auto& origStage = hwStages[i];
+        const auto& tiler = *tilers[i];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -0,0 +1,302 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/pass_manager.hpp>
+
+#include <precision_utils.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace vpu {
+
+namespace {
+
+//
+// Per-channel affine transformation y = scale * x + bias,
+// which is the common form of the Scale, Bias, ScaleShift and linear Power stages.
+//
+
+struct AffineTransform final {
+    std::vector<float> scales;
+    std::vector<float> biases;
+    bool hasScales = false;
+    bool hasBiases = false;
+
+    size_t size() const { return std::max(scales.size(), biases.size()); }
+
+    float scale(size_t c) const { return scales.empty() ? 1.0f : scales[scales.size() == 1 ? 0 : c]; }
+    float bias(size_t c) const { return biases.empty() ? 0.0f : biases[biases.size() == 1 ? 0 : c]; }
+};
+
+bool readConstValues(const Data& data, std::vector<float>& values) {
+    if (data->usage() != DataUsage::Const || data->content() == nullptr) {
+        return false;
+    }
+    if (data->desc().type() != DataType::FP16) {
+        return false;
+    }
+
+    const auto count = static_cast<size_t>(data->desc().totalDimSize());
+    const auto ptr = data->content()->get<fp16_t>();
+    IE_ASSERT(ptr != nullptr);
+
+    values.resize(count);
+    std::transform(ptr, ptr + count, values.begin(), ie::PrecisionUtils::f16tof32);
+    return true;
+}
+
+bool getAffineTransform(const Stage& stage, AffineTransform& affine) {
+    affine = AffineTransform();
+
+    switch (stage->type()) {
+    case StageType::Scale:
+        affine.hasScales = true;
+        return readConstValues(stage->input(1), affine.scales);
+    case StageType::Bias:
+        affine.hasBiases = true;
+        return readConstValues(stage->input(1), affine.biases);
+    case StageType::ScaleShift:
+        affine.hasScales = affine.hasBiases = true;
+        return readConstValues(stage->input(1), affine.scales) &&
+               readConstValues(stage->input(2), affine.biases) &&
+               affine.scales.size() == affine.biases.size();
+    case StageType::Power:
+        if (stage->attrs().get<float>("power") != 1.0f) {
+            return false;
+        }
+        affine.hasScales = affine.hasBiases = true;
+        affine.scales = {stage->attrs().get<float>("scale")};
+        affine.biases = {stage->attrs().get<float>("bias")};
+        return true;
+    default:
+        return false;
+    }
+}
+
+//
+// Each rule describes a pair of adjacent elementwise stages which can be replaced with a single
+// post-op stage. The pass applies the rules until no pair can be merged, so longer chains
+// collapse step by step.
+//
+
+using FuseFunc = std::function<bool(const Model&, const Stage& first, const Stage& second)>;
+
+struct FusionRule final {
+    std::unordered_set<StageType, EnumClassHash> firstTypes;
+    std::unordered_set<StageType, EnumClassHash> secondTypes;
+    FuseFunc fuse;
+};
+
+class PassImpl final : public Pass {
+public:
+    explicit PassImpl(const StageBuilder::Ptr& stageBuilder);
+
+    void run(const Model& model) override;
+
+private:
+    bool fuseAffine(const Model& model, const Stage& first, const Stage& second) const;
+    bool fuseClamps(const Model& model, const Stage& first, const Stage& second) const;
+    bool fuseReLUAndClamp(const Model& model, const Stage& first, const Stage& second) const;
+    bool fuseClampAndReLU(const Model& model, const Stage& first, const Stage& second) const;
+
+    void replaceWithClamp(const Model& model, const Stage& first, const Stage& second, float min, float max) const;
+
+private:
+    StageBuilder::Ptr _stageBuilder;
+    std::vector<FusionRule> _rules;
+};
+
+PassImpl::PassImpl(const StageBuilder::Ptr& stageBuilder) : _stageBuilder(stageBuilder) {
+    using namespace std::placeholders;
+
+    const std::unordered_set<StageType, EnumClassHash> affineTypes = {
+        StageType::Scale, StageType::Bias, StageType::ScaleShift, StageType::Power
+    };
+
+    _rules = {
+        {affineTypes, affineTypes, std::bind(&PassImpl::fuseAffine, this, _1, _2, _3)},
+        {{StageType::Clamp}, {StageType::Clamp}, std::bind(&PassImpl::fuseClamps, this, _1, _2, _3)},
+        {{StageType::Relu}, {StageType::Clamp}, std::bind(&PassImpl::fuseReLUAndClamp, this, _1, _2, _3)},
+        {{StageType::Clamp}, {StageType::Relu}, std::bind(&PassImpl::fuseClampAndReLU, this, _1, _2, _3)},
+    };
+}
+
+Stage getFusionCandidate(const Stage& stage, const std::unordered_set<StageType, EnumClassHash>& supportedTypes) {
+    if (stage->numOutputs() != 1) {
+        return nullptr;
+    }
+
+    const auto output = stage->output(0);
+    if (output->usage() != DataUsage::Intermediate ||
+        output->parentData() != nullptr ||
+        output->numChildDatas() != 0 ||
+        output->parentDataToShapeEdge() != nullptr ||
+        !output->childDataToShapeEdges().empty()) {
+        return nullptr;
+    }
+
+    if (output->numConsumers() != 1) {
+        return nullptr;
+    }
+
+    const auto consumer = output->singleConsumer();
+    if (supportedTypes.count(consumer->type()) == 0 || consumer->input(0) != output) {
+        return nullptr;
+    }
+
+    return consumer;
+}
+
+void PassImpl::run(const Model& model) {
+    VPU_PROFILE(mergePostOpChains);
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (const auto& stage : model->getStages()) {
+            for (const auto& rule : _rules) {
+                if (rule.firstTypes.count(stage->type()) == 0) {
+                    continue;
+                }
+
+                const auto next = getFusionCandidate(stage, rule.secondTypes);
+                if (next != nullptr && rule.fuse(model, stage, next)) {
+                    changed = true;
+                    break;
+                }
+            }
+
+            if (changed) {
+                break;
+            }
+        }
+    }
+}
+
+bool PassImpl::fuseAffine(const Model& model, const Stage& first, const Stage& second) const {
+    AffineTransform firstAffine, secondAffine;
+    if (!getAffineTransform(first, firstAffine) || !getAffineTransform(second, secondAffine)) {
+        return false;
+    }
+
+    const auto size = std::max(firstAffine.size(), secondAffine.size());
+    if ((firstAffine.size() != 1 && firstAffine.size() != size) ||
+        (secondAffine.size() != 1 && secondAffine.size() != size)) {
+        return false;
+    }
+
+    // y = s2 * (s1 * x + b1) + b2 = (s2 * s1) * x + (s2 * b1 + b2)
+    AffineTransform fused;
+    fused.hasScales = firstAffine.hasScales || secondAffine.hasScales;
+    fused.hasBiases = firstAffine.hasBiases || secondAffine.hasBiases;
+    fused.scales.resize(size);
+    fused.biases.resize(size);
+    for (size_t c = 0; c < size; ++c) {
+        fused.scales[c] = secondAffine.scale(c) * firstAffine.scale(c);
+        fused.biases[c] = secondAffine.scale(c) * firstAffine.bias(c) + secondAffine.bias(c);
+    }
+
+    const auto input = first->input(0);
+    const auto output = second->output(0);
+    const auto name = second->name();
+    const auto origLayer = second->origLayer();
+
+    // Scalar coefficients stay in the Power stage, otherwise the per-channel ones
+    // are stored in a new constant for the Scale/Bias kernels.
+    if (size == 1) {
+        model->removeStage(first);
+        model->removeStage(second);
+
+        _stageBuilder->addPowerStage(model, name, origLayer, fused.scales[0], 1.0f, fused.biases[0], input, output);
+        return true;
+    }
+
+    const auto channels = static_cast<int>(size);
+    if (output->desc().dims().has(Dim::C) && output->desc().dim(Dim::C) != channels) {
+        return false;
+    }
+
+    const auto makeConst = [&](const std::string& suffix, const std::vector<float>& values) {
+        const auto generator = [values](const ie::Blob::Ptr& blob) {
+            auto dst = blob->buffer().as<fp16_t*>();
+            std::transform(values.begin(), values.end(), dst, ie::PrecisionUtils::f32tof16);
+        };
+        return model->addConstData(name + suffix, DataDesc({channels}), generator);
+    };
+
+    model->removeStage(first);
+    model->removeStage(second);
+
+    if (fused.hasScales && fused.hasBiases) {
+        _stageBuilder->addScaleShiftStage(model, name, origLayer, input,
+                                          makeConst("@fused-scales", fused.scales),
+                                          makeConst("@fused-biases", fused.biases),
+                                          output);
+    } else if (fused.hasScales) {
+        _stageBuilder->addScaleStage(model, name, origLayer, input, makeConst("@fused-scales", fused.scales), output);
+    } else {
+        _stageBuilder->addBiasStage(model, name, origLayer, input, makeConst("@fused-biases", fused.biases), output);
+    }
+
+    return true;
+}
+
+void PassImpl::replaceWithClamp(const Model& model, const Stage& first, const Stage& second, float min, float max) const {
+    const auto input = first->input(0);
+    const auto output = second->output(0);
+    const auto name = second->name();
+    const auto origLayer = second->origLayer();
+
+    model->removeStage(first);
+    model->removeStage(second);
+
+    _stageBuilder->addClampStage(model, name, origLayer, min, max, input, output);
+}
+
+bool PassImpl::fuseClamps(const Model& model, const Stage& first, const Stage& second) const {
+    const auto min = std::max(first->attrs().get<float>("min_value"), second->attrs().get<float>("min_value"));
+    const auto max = std::min(first->attrs().get<float>("max_value"), second->attrs().get<float>("max_value"));
+
+    // Disjoint ranges produce a constant output, keep them as is
+    if (min > max) {
+        return false;
+    }
+
+    replaceWithClamp(model, first, second, min, max);
+    return true;
+}
+
+bool PassImpl::fuseReLUAndClamp(const Model& model, const Stage& first, const Stage& second) const {
+    const auto min = std::max(0.0f, second->attrs().get<float>("min_value"));
+    const auto max = second->attrs().get<float>("max_value");
+
+    if (min > max) {
+        return false;
+    }
+
+    replaceWithClamp(model, first, second, min, max);
+    return true;
+}
+
+bool PassImpl::fuseClampAndReLU(const Model& model, const Stage& first, const Stage& second) const {
+    const auto min = std::max(0.0f, first->attrs().get<float>("min_value"));
+    const auto max = std::max(0.0f, first->attrs().get<float>("max_value"));
+
+    replaceWithClamp(model, first, second, min, max);
+    return true;
+}
+
+}  // namespace
+
+Pass::Ptr PassManager::mergePostOpChains() {
+    return std::make_shared<PassImpl>(_stageBuilder);
+}
+
+}  // namespace vpu
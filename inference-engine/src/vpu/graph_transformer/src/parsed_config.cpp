@@ -55,6 +55,7 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_CONFIG_KEY(HW_POOL_CONV_MERGE),
         VPU_CONFIG_KEY(PACK_DATA_IN_CMX),
         VPU_CONFIG_KEY(HW_DILATION),
+        VPU_CONFIG_KEY(HW_TILING_COST_MODEL),
         VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION),
         VPU_CONFIG_KEY(DISABLE_REORDER),
         VPU_CONFIG_KEY(ENABLE_PERMUTE_MERGING),
@@ -161,6 +162,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     setOption(_compileConfig.injectSwOps,                    switches, config, VPU_CONFIG_KEY(HW_INJECT_STAGES));
     setOption(_compileConfig.mergeHwPoolToConv,              switches, config, VPU_CONFIG_KEY(HW_POOL_CONV_MERGE));
     setOption(_compileConfig.hwDilation,                     switches, config, VPU_CONFIG_KEY(HW_DILATION));
+    setOption(_compileConfig.hwTilingCostModel,              switches, config, VPU_CONFIG_KEY(HW_TILING_COST_MODEL));
     setOption(_compileConfig.forceDeprecatedCnnConversion,   switches, config, VPU_CONFIG_KEY(FORCE_DEPRECATED_CNN_CONVERSION));
     setOption(_compileConfig.disableReorder,                 switches, config, VPU_CONFIG_KEY(DISABLE_REORDER));
     setOption(_compileConfig.enablePermuteMerging,           switches, config, VPU_CONFIG_KEY(ENABLE_PERMUTE_MERGING));
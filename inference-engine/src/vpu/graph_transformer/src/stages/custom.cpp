@@ -5,6 +5,7 @@
 #include <vpu/frontend/frontend.hpp>
 
 #include <vpu/frontend/custom_layer.hpp>
+#include <vpu/compile_env.hpp>
 #include <vpu/utils/simple_math.hpp>
 #include <vpu/model/data_contents/kernel_binary_content.hpp>
 #include <vpu/model/data_contents/ie_blob_content.hpp>
@@ -15,6 +16,7 @@
 #include <map>
 #include <utility>
 #include <algorithm>
+#include <functional>
 #include <tuple>
 
 namespace vpu {
@@ -24,6 +26,9 @@ static SmallVector<int> calcSizesFromParams(const DataDesc& desc, const SmallVec
 
 namespace {
 
+// __local and __private memory of a work group in CMX
+constexpr int maxLocalMemoryPerWorkGroup = 100 * 1024;
+
 class CustomStage final : public StageNode {
 public:
     using StageNode::StageNode;
@@ -308,6 +313,93 @@ static SmallVector<int> calcSizesFromParams(const DataDesc& desc, const SmallVec
     return sizes;
 }
 
+// the sizes of the local data of a kernel may depend on the local work sizes as LX, LY and LZ
+static std::map<std::string, int> calcLocalDataSizes(const CustomKernel& kernel, const DataVector& inputs, const DataVector& outputs,
+                                                     const SmallVector<int>& lws, std::map<std::string, std::string> layerParams) {
+    static const char* const localSizeNames[] = {"LX", "LY", "LZ"};
+    for (size_t i = 0; i < lws.size() && i < 3; i++) {
+        layerParams[localSizeNames[i]] = std::to_string(lws[i]);
+    }
+
+    auto sizes = std::map<std::string, int>{};
+    for (const auto& bind : kernel.bindings()) {
+        if (bind.type == CustomParamType::LocalData) {
+            const auto& source = bind.dimSource == CustomDimSource::Input ? inputs : outputs;
+            const auto& desc = source[bind.dimIdx]->desc();
+            const auto size = calcSizesFromParams(desc, { bind.bufferSizeRule }, layerParams);
+            sizes.emplace(bind.argName, size[0]);
+        }
+    }
+    return sizes;
+}
+
+// The "auto" local work sizes are picked per dimension starting from the innermost one: the largest divisor of the
+// global size which keeps enough work groups for all the SHAVEs and the local data of a work group within CMX.
+// Wide work groups get the kernel code vectorized and their lines copied by a single DMA transaction.
+static SmallVector<int> calcLocalSizes(const CustomKernel& kernel, const DataDesc& desc, const SmallVector<int>& gws,
+                                       const DataVector& inputs, const DataVector& outputs,
+                                       const std::map<std::string, std::string>& layerParams) {
+    const auto& rules = kernel.localGridSizeRules();
+
+    auto lws = SmallVector<int>{};
+    auto autoDims = SmallVector<size_t>{};
+    for (size_t i = 0; i < rules.size(); i++) {
+        if (CustomKernel::isAutoSizeRule(rules[i])) {
+            lws.push_back(1);
+            autoDims.push_back(i);
+        } else {
+            lws.push_back(calcSizesFromParams(desc, { rules[i] }, layerParams)[0]);
+        }
+    }
+    if (autoDims.empty()) {
+        return lws;
+    }
+
+    const auto& env = CompileEnv::get();
+    auto numSHAVEs = std::max(env.resources.numSHAVEs, 1);
+    if (kernel.maxShaves() > 0) {
+        numSHAVEs = std::min(numSHAVEs, kernel.maxShaves());
+    }
+
+    const auto fits = [&](const SmallVector<int>& candidate) {
+        int numGroups = 1;
+        for (size_t i = 0; i < gws.size(); i++) {
+            numGroups *= gws[i] / candidate[i];
+        }
+        if (numGroups < numSHAVEs) {
+            return false;
+        }
+        int localMemory = 0;
+        for (const auto& size : calcLocalDataSizes(kernel, inputs, outputs, candidate, layerParams)) {
+            localMemory += size.second;
+        }
+        return localMemory <= maxLocalMemoryPerWorkGroup;
+    };
+
+    for (auto dim : autoDims) {
+        auto divisors = SmallVector<int>{};
+        for (int i = 1; i * i <= gws[dim]; i++) {
+            if (gws[dim] % i == 0) {
+                divisors.push_back(i);
+                divisors.push_back(gws[dim] / i);
+            }
+        }
+        std::sort(divisors.begin(), divisors.end(), std::greater<int>());
+
+        for (auto size : divisors) {
+            auto candidate = lws;
+            candidate[dim] = size;
+            if (size == 1 || fits(candidate)) {
+                lws = candidate;
+                break;
+            }
+        }
+    }
+
+    env.log->trace("Custom kernel %v local work sizes: %v", kernel.kernelId(), lws);
+    return lws;
+}
+
 void FrontEnd::parseCustom(const Model& model, const ie::CNNLayerPtr& layer, const DataVector& inputs, const DataVector& outputs) {
     IE_ASSERT(layer != nullptr);
     IE_ASSERT(outputs.size() == 1);
@@ -418,23 +510,12 @@ void FrontEnd::parseCustom(const Model& model, const ie::CNNLayerPtr& layer, con
         const auto& dataDesc = dimSource[kernel.dimSourceIndex()]->desc();
 
         const auto gws = calcSizesFromParams(dataDesc, kernel.globalGridSizeRules(), layer->params);
-        const auto lws = calcSizesFromParams(dataDesc, kernel.localGridSizeRules(), layer->params);
+        const auto lws = calcLocalSizes(kernel, dataDesc, gws, inputs, outputs, layer->params);
 
         stage->attrs().set("gws", gws);
         stage->attrs().set("lws", lws);
 
-        const auto localDataSizes = [&] {
-            auto sizes = std::map<std::string, int>{};
-            for (const auto& bind : kernel.bindings()) {
-                if (bind.type == CustomParamType::LocalData) {
-                    const auto& source = bind.dimSource == CustomDimSource::Input ? inputs : outputs;
-                    const auto& desc = source[bind.dimIdx]->desc();
-                    const auto size = calcSizesFromParams(desc, { bind.bufferSizeRule }, layer->params);
-                    sizes.emplace(bind.argName, size[0]);
-                }
-            }
-            return sizes;
-        }();
+        const auto localDataSizes = calcLocalDataSizes(kernel, inputs, outputs, lws, layer->params);
 
         stage->attrs().set("localDataSizes", localDataSizes);
 
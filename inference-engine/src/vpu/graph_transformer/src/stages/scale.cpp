@@ -45,6 +45,22 @@ Stage StageBuilder::addScaleStage(
         {output});
 }
 
+Stage StageBuilder::addScaleShiftStage(
+        const Model& model,
+        const std::string& name,
+        const ie::CNNLayerPtr& layer,
+        const Data& input,
+        const Data& scales,
+        const Data& biases,
+        const Data& output) {
+    return model->addNewStage<ScaleStage>(
+        name,
+        StageType::ScaleShift,
+        layer,
+        {input, scales, biases},
+        {output});
+}
+
 void FrontEnd::parseScale(const Model& model, const ie::CNNLayerPtr& _layer, const DataVector& inputs, const DataVector& outputs) const {
     IE_ASSERT(inputs.size() == 1);
     IE_ASSERT(outputs.size() == 1);
@@ -3,21 +3,50 @@
 //
 
 #include <memory>
+#include <utility>
 #include "myriad_async_infer_request.h"
 #include <vpu/utils/profiling.hpp>
 
 using namespace vpu::MyriadPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// The replica is selected when the inputs are packed,
+// so the inputs are sent and the results are read on the executors of that replica
+class ReplicaTaskExecutor : public ITaskExecutor {
+public:
+    using Selector = const ITaskExecutor::Ptr& (MyriadInferRequest::*)() const;
+
+    ReplicaTaskExecutor(MyriadInferRequest::Ptr request, Selector selector)
+        : _request(std::move(request)), _selector(selector) {}
+
+    void run(Task task) override {
+        ((*_request).*_selector)()->run(std::move(task));
+    }
+
+private:
+    MyriadInferRequest::Ptr _request;
+    Selector _selector;
+};
+
+}  // namespace
+
 MyriadAsyncInferRequest::MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                                  const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
-                                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
-                                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult)
+                                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor)
 : InferenceEngine::AsyncInferRequestThreadSafeDefault(request, taskExecutorStart, callbackExecutor),
-    _request(request), _taskExecutorGetResult(taskExecutorGetResult) {
+    _request(request),
+    _taskExecutorTransfer(std::make_shared<ReplicaTaskExecutor>(request, &MyriadInferRequest::transferExecutor)),
+    _taskExecutorGetResult(std::make_shared<ReplicaTaskExecutor>(request, &MyriadInferRequest::getResultExecutor)) {
+        // packing the inputs of the next request overlaps the transfer of the current one,
+        // and the transfer overlaps the execution of the requests already queued to the device
         _pipeline = {
             {_requestExecutor, [this] {
-                _request->InferAsync();
+                _request->PrepareInput();
+            }},
+            {_taskExecutorTransfer, [this] {
+                _request->SendInput();
             }},
             {_taskExecutorGetResult, [this] {
                 _request->GetResult();
@@ -14,12 +14,12 @@ class MyriadAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
-                                const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
-                                const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult);
+                                const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
     ~MyriadAsyncInferRequest() override;
 private:
     MyriadInferRequest::Ptr _request;
+    InferenceEngine::ITaskExecutor::Ptr _taskExecutorTransfer;
     InferenceEngine::ITaskExecutor::Ptr _taskExecutorGetResult;
 };
 
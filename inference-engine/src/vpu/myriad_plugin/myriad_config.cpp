@@ -8,6 +8,7 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <stdexcept>
 
 #include <cpp_interfaces/exception2status.hpp>
 
@@ -46,6 +47,7 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT),
 
         VPU_MYRIAD_CONFIG_KEY(MOVIDIUS_DDR_TYPE),
+        VPU_MYRIAD_CONFIG_KEY(DEVICE_POOL_SIZE),
     });
 IE_SUPPRESS_DEPRECATED_END
 
@@ -105,6 +107,14 @@ IE_SUPPRESS_DEPRECATED_END
         { VPU_MYRIAD_CONFIG_VALUE(MICRON_1GB),   MovidiusDdrType::MICRON_1GB }
     };
 
+    const auto parseDevicePoolSize = [](const std::string& src) {
+        const auto size = parseInt(src);
+        if (size < 0) {
+            throw std::invalid_argument("Negative value");
+        }
+        return size;
+    };
+
     ParsedConfig::parse(config);
 
     setOption(_pluginLogFilePath, config, VPU_MYRIAD_CONFIG_KEY(PLUGIN_LOG_FILE_PATH));
@@ -116,6 +126,7 @@ IE_SUPPRESS_DEPRECATED_END
     setOption(_deviceConnectTimeout, config, VPU_MYRIAD_CONFIG_KEY(DEVICE_CONNECT_TIMEOUT), parseSeconds);
     setOption(_powerConfig, powerConfigs, config, VPU_MYRIAD_CONFIG_KEY(POWER_MANAGEMENT));
     setOption(_memoryType, memoryTypes, config, VPU_MYRIAD_CONFIG_KEY(MOVIDIUS_DDR_TYPE));
+    setOption(_devicePoolSize, config, VPU_MYRIAD_CONFIG_KEY(DEVICE_POOL_SIZE), parseDevicePoolSize);
 
 IE_SUPPRESS_DEPRECATED_START
     setOption(_forceReset, switches, config, VPU_CONFIG_KEY(FORCE_RESET));
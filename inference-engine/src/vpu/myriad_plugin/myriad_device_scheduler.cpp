@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "myriad_device_scheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_common.h>
+
+namespace vpu {
+namespace MyriadPlugin {
+
+DeviceScheduler::DeviceScheduler(size_t numReplicas) : _stats(numReplicas), _startTime(Clock::now()) {
+    IE_ASSERT(numReplicas > 0);
+}
+
+size_t DeviceScheduler::acquire() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // ties are broken by the number of completed inferences to spread the load of sequential requests
+    auto leastBusy = std::min_element(_stats.begin(), _stats.end(),
+        [](const ReplicaStats& lhs, const ReplicaStats& rhs) {
+            return lhs.inFlight != rhs.inFlight ? lhs.inFlight < rhs.inFlight : lhs.completed < rhs.completed;
+        });
+
+    if (leastBusy->inFlight++ == 0) {
+        leastBusy->busySince = Clock::now();
+    }
+
+    return static_cast<size_t>(std::distance(_stats.begin(), leastBusy));
+}
+
+void DeviceScheduler::release(size_t replicaIdx) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& stats = _stats.at(replicaIdx);
+    IE_ASSERT(stats.inFlight > 0);
+
+    stats.completed++;
+    if (--stats.inFlight == 0) {
+        stats.busyTime += Clock::now() - stats.busySince;
+    }
+}
+
+std::vector<float> DeviceScheduler::utilization() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto now = Clock::now();
+    const auto elapsed = std::chrono::duration<float>(now - _startTime).count();
+
+    std::vector<float> result;
+    result.reserve(_stats.size());
+    for (const auto& stats : _stats) {
+        auto busyTime = stats.busyTime;
+        if (stats.inFlight > 0) {
+            busyTime += now - stats.busySince;
+        }
+        result.push_back(elapsed > 0.0f ? std::chrono::duration<float>(busyTime).count() / elapsed : 0.0f);
+    }
+
+    return result;
+}
+
+std::vector<unsigned int> DeviceScheduler::inferCount() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::vector<unsigned int> result;
+    result.reserve(_stats.size());
+    for (const auto& stats : _stats) {
+        result.push_back(stats.completed);
+    }
+
+    return result;
+}
+
+}  // namespace MyriadPlugin
+}  // namespace vpu
@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <threading/ie_itask_executor.hpp>
+
+#include "myriad_executor.h"
+
+namespace vpu {
+namespace MyriadPlugin {
+
+/**
+ * @brief The copy of a compiled graph allocated on one device of the pool
+ */
+struct GraphReplica {
+    DevicePtr _device;
+    GraphDesc _graphDesc;
+    InferenceEngine::ITaskExecutor::Ptr _taskExecutorTransfer;
+    InferenceEngine::ITaskExecutor::Ptr _taskExecutorGetResult;
+};
+
+/**
+ * @brief Dispatches inferences to the least busy replica of a network and collects the per device statistics.
+ * An inference occupies its replica from acquire() till release().
+ */
+class DeviceScheduler {
+public:
+    typedef std::shared_ptr<DeviceScheduler> Ptr;
+    using Clock = std::chrono::steady_clock;
+
+    explicit DeviceScheduler(size_t numReplicas);
+
+    size_t acquire();
+    void release(size_t replicaIdx);
+
+    std::vector<float> utilization() const;
+    std::vector<unsigned int> inferCount() const;
+
+private:
+    struct ReplicaStats {
+        unsigned int inFlight = 0;
+        unsigned int completed = 0;
+        Clock::duration busyTime = Clock::duration::zero();
+        Clock::time_point busySince;
+    };
+
+    mutable std::mutex _mutex;
+    std::vector<ReplicaStats> _stats;
+    Clock::time_point _startTime;
+};
+
+}  // namespace MyriadPlugin
+}  // namespace vpu
@@ -3,6 +3,9 @@
 //
 
 #include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
 #include <utility>
 
 #include <ie_metric_helpers.hpp>
@@ -44,7 +47,11 @@ ExecutableNetwork::ExecutableNetwork(
         METRIC_KEY(SUPPORTED_METRICS),
         METRIC_KEY(SUPPORTED_CONFIG_KEYS),
         METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
-        METRIC_KEY(DEVICE_THERMAL)
+        METRIC_KEY(DEVICE_THERMAL),
+        VPU_MYRIAD_METRIC(DEVICE_NAMES),
+        VPU_MYRIAD_METRIC(DEVICE_UTILIZATION),
+        VPU_MYRIAD_METRIC(DEVICE_INFER_COUNT),
+        VPU_MYRIAD_METRIC(MEMORY_STATISTICS)
     };
 }
 
@@ -76,22 +83,76 @@ ExecutableNetwork::ExecutableNetwork(
     _inputInfo  = std::move(compiledGraph->inputInfo);
     _outputInfo = std::move(compiledGraph->outputInfo);
 
+    const auto fragmentation = [](int used, int peakLive) {
+        return used > 0 ? static_cast<unsigned int>(100LL * (used - peakLive) / used) : 0u;
+    };
+    _memoryStatistics = {
+        {"BSS_USED", static_cast<unsigned int>(compiledGraph->usedBSS)},
+        {"BSS_PEAK_LIVE", static_cast<unsigned int>(compiledGraph->peakLiveBSS)},
+        {"BSS_FRAGMENTATION", fragmentation(compiledGraph->usedBSS, compiledGraph->peakLiveBSS)},
+        {"CMX_USED", static_cast<unsigned int>(compiledGraph->usedCMX)},
+        {"CMX_PEAK_LIVE", static_cast<unsigned int>(compiledGraph->peakLiveCMX)},
+        {"CMX_FRAGMENTATION", fragmentation(compiledGraph->usedCMX, compiledGraph->peakLiveCMX)},
+        {"CMX_SPILLED", static_cast<unsigned int>(compiledGraph->spilledFromCMX)},
+    };
+
     if (!_device->isBooted()) {
         return;
     }
 
     auto networkName = network.getName();
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName, _actualNumExecutors);
+    allocateReplicas(devicePool, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName);
     if (_config.exclusiveAsyncRequests()) {
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
+}
+
+void ExecutableNetwork::allocateReplicas(std::vector<DevicePtr> &devicePool,
+                                         const std::pair<const char*, size_t> &blobHeader,
+                                         size_t numStages,
+                                         const std::string &networkName) {
+    std::vector<DevicePtr> devices = {_device};
+    if (_config.devicePoolSize() != 1 && _config.deviceName().empty()) {
+        const auto maxCount = _config.devicePoolSize() == 0 ?
+                              std::numeric_limits<size_t>::max() :
+                              static_cast<size_t>(_config.devicePoolSize() - 1);
+        auto extraDevices = _executor->openExtraDevices(devicePool, _config, _device->_platform, maxCount);
+        devices.insert(devices.end(), extraDevices.begin(), extraDevices.end());
+    }
+
+    ExecutorManager *executorManager = ExecutorManager::getInstance();
+    for (auto &device : devices) {
+        GraphReplica replica;
+        replica._device = device;
+        try {
+            _executor->allocateGraph(replica._device, replica._graphDesc, _graphBlob, blobHeader,
+                                     numStages, networkName, _actualNumExecutors);
+        } catch (const std::exception& e) {
+            _executor->deallocateGraph(replica._device, replica._graphDesc);
+            if (_replicas.empty()) {
+                throw;
+            }
+            // the network keeps working on the devices it is already allocated on
+            _log->warning("Failed to replicate network %s to device %s: %s", networkName, device->_name, e.what());
+            continue;
+        }
+
+        std::stringstream transferIdStream;
+        transferIdStream << networkName << "_TaskExecutorTransfer" << _replicas.size();
+        replica._taskExecutorTransfer = executorManager->getExecutor(transferIdStream.str());
+
+        std::stringstream getResultIdStream;
+        getResultIdStream << networkName << "_TaskExecutorGetResult" << _replicas.size();
+        replica._taskExecutorGetResult = executorManager->getExecutor(getResultIdStream.str());
+        _replicas.push_back(std::move(replica));
+    }
 
-    for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
-        std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
-        _taskExecutorGetResultIds.emplace(idStream.str());
+    if (_replicas.size() > 1) {
+        _log->info("Network %s is replicated to %d devices", networkName, _replicas.size());
     }
+
+    _scheduler = std::make_shared<DeviceScheduler>(_replicas.size());
 }
 
 void ExecutableNetwork::Import(std::istream& strm,
@@ -122,7 +183,7 @@ void ExecutableNetwork::Import(std::istream& strm,
     _inputInfo  = blobReader.getInputInfo();
     _outputInfo = blobReader.getOutputInfo();
 
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors);
+    allocateReplicas(devicePool, blobHeader, numStages, networkName);
 
     _graphMetaData.stagesMeta.resize(numStages);
     for (auto &meta : _graphMetaData.stagesMeta) {
@@ -135,11 +196,6 @@ void ExecutableNetwork::Import(std::istream& strm,
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
 
-    for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
-        std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
-        _taskExecutorGetResultIds.emplace(idStream.str());
-    }
 }
 
 ExecutableNetwork::ExecutableNetwork(std::istream& strm,
@@ -164,22 +220,39 @@ ExecutableNetwork::ExecutableNetwork(
 
 void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (name == METRIC_KEY(NETWORK_NAME)) {
-        result = IE_SET_METRIC(NETWORK_NAME, _graphDesc._name);
+        result = IE_SET_METRIC(NETWORK_NAME, _replicas.empty() ? std::string() : _replicas.front()._graphDesc._name);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         result = IE_SET_METRIC(SUPPORTED_METRICS, _supportedMetrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, std::vector<std::string>());
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
+        const auto numReplicas = std::max<size_t>(_replicas.size(), 1);
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors * numReplicas));
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         result = IE_SET_METRIC(DEVICE_THERMAL, _executor->GetThermal(_device));
+    } else if (name == VPU_MYRIAD_METRIC(DEVICE_NAMES)) {
+        std::vector<std::string> deviceNames;
+        for (const auto &replica : _replicas) {
+            deviceNames.push_back(replica._device->_name);
+        }
+        result = IE_SET_METRIC(VPU_MYRIAD_DEVICE_NAMES, deviceNames);
+    } else if (name == VPU_MYRIAD_METRIC(DEVICE_UTILIZATION)) {
+        result = IE_SET_METRIC(VPU_MYRIAD_DEVICE_UTILIZATION,
+                               _scheduler != nullptr ? _scheduler->utilization() : std::vector<float>());
+    } else if (name == VPU_MYRIAD_METRIC(DEVICE_INFER_COUNT)) {
+        result = IE_SET_METRIC(VPU_MYRIAD_DEVICE_INFER_COUNT,
+                               _scheduler != nullptr ? _scheduler->inferCount() : std::vector<unsigned int>());
+    } else if (name == VPU_MYRIAD_METRIC(MEMORY_STATISTICS)) {
+        result = IE_SET_METRIC(VPU_MYRIAD_MEMORY_STATISTICS, _memoryStatistics);
     } else {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 }
 
 void ExecutableNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
-    auto perfInfo = _executor->getPerfTimeInfo(_graphDesc._graphHandle);
+    auto perfInfo = _replicas.empty() ?
+                    std::vector<float>() :
+                    _executor->getPerfTimeInfo(_replicas.front()._graphDesc._graphHandle);
     graphPtr = buildRuntimeGraph(_graphMetaData, perfInfo);
 }
 
@@ -9,9 +9,9 @@
 #include <vector>
 #include <map>
 #include <unordered_map>
-#include <queue>
 #include <sstream>
 #include <fstream>
+#include <utility>
 
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
@@ -24,6 +24,7 @@
 #include "myriad_infer_request.h"
 #include "myriad_async_infer_request.h"
 #include "myriad_config.h"
+#include "myriad_device_scheduler.h"
 
 namespace vpu {
 namespace MyriadPlugin {
@@ -49,12 +50,14 @@ public:
 
 
     virtual ~ExecutableNetwork() {
-        try {
-            _executor->deallocateGraph(_device, _graphDesc);
-        }
-        catch (...) {
-            std::cerr << "ERROR ~ExecutableNetwork():\n"
-                      << "Some errors occurred during the calling of the deallocateGraph() method";
+        for (auto &replica : _replicas) {
+            try {
+                _executor->deallocateGraph(replica._device, replica._graphDesc);
+            }
+            catch (...) {
+                std::cerr << "ERROR ~ExecutableNetwork():\n"
+                          << "Some errors occurred during the calling of the deallocateGraph() method";
+            }
         }
     }
 
@@ -65,7 +68,7 @@ public:
                                << _device->_platform;
         }
 
-        return std::make_shared<MyriadInferRequest>(_graphDesc, networkInputs, networkOutputs,
+        return std::make_shared<MyriadInferRequest>(_replicas, _scheduler, networkInputs, networkOutputs,
                                                     _inputInfo, _outputInfo,
                                                     _graphMetaData.stagesMeta, _config, _log, _executor);
     }
@@ -76,14 +79,13 @@ public:
                                << _device->_platform;
         }
 
-        auto syncRequestImpl = std::make_shared<MyriadInferRequest>(_graphDesc, _networkInputs, _networkOutputs,
+        auto syncRequestImpl = std::make_shared<MyriadInferRequest>(_replicas, _scheduler, _networkInputs, _networkOutputs,
                                                                     _inputInfo, _outputInfo,
                                                                     _graphMetaData.stagesMeta, _config, _log,
                                                                     _executor);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-        auto taskExecutorGetResult = getNextTaskExecutor();
         auto asyncTreadSafeImpl = std::make_shared<MyriadAsyncInferRequest>(
-                syncRequestImpl, _taskExecutor, _callbackExecutor, taskExecutorGetResult);
+                syncRequestImpl, _taskExecutor, _callbackExecutor);
         asyncRequest.reset(new InferenceEngine::InferRequestBase<InferenceEngine::AsyncInferRequestThreadSafeDefault>(
                            asyncTreadSafeImpl),
                            [](InferenceEngine::IInferRequest *p) { p->Release(); });
@@ -116,34 +118,30 @@ private:
     Logger::Ptr _log;
     MyriadExecutorPtr _executor;
     std::vector<char> _graphBlob;
-    GraphDesc _graphDesc;
     DevicePtr _device;
+    std::vector<GraphReplica> _replicas;
+    DeviceScheduler::Ptr _scheduler;
     GraphMetaInfo _graphMetaData;
     MyriadConfig _config;
     int _actualNumExecutors = 0;
     std::vector<std::string> _supportedMetrics;
+    std::map<std::string, unsigned int> _memoryStatistics;
 
     DataInfo _inputInfo;
     DataInfo _outputInfo;
 
-    const size_t _maxTaskExecutorGetResultCount = 1;
-    std::queue<std::string> _taskExecutorGetResultIds;
-
     ExecutableNetwork(std::shared_ptr<IMvnc> mvnc,
         std::vector<DevicePtr> &devicePool,
         const MyriadConfig& config);
 
-    InferenceEngine::ITaskExecutor::Ptr getNextTaskExecutor() {
-        std::string id = _taskExecutorGetResultIds.front();
-
-        _taskExecutorGetResultIds.pop();
-        _taskExecutorGetResultIds.push(id);
-
-        InferenceEngine::ExecutorManager *executorManager = InferenceEngine::ExecutorManager::getInstance();
-        InferenceEngine::ITaskExecutor::Ptr taskExecutor = executorManager->getExecutor(id);
-
-        return taskExecutor;
-    }
+    /**
+     * @brief Allocates the graph on the opened device and on the extra devices requested by
+     * VPU_MYRIAD_CONFIG_KEY(DEVICE_POOL_SIZE). Each replica sends the inputs and reads the results on its own executors.
+     */
+    void allocateReplicas(std::vector<DevicePtr> &devicePool,
+                          const std::pair<const char*, size_t> &blobHeader,
+                          size_t numStages,
+                          const std::string &networkName);
 };
 
 }  // namespace MyriadPlugin
@@ -285,6 +285,49 @@ DevicePtr MyriadExecutor::openDevice(std::vector<DevicePtr>& devicePool,
     return devicePool.back();
 }
 
+std::vector<DevicePtr> MyriadExecutor::openExtraDevices(std::vector<DevicePtr>& devicePool,
+                                                        const MyriadConfig& config,
+                                                        ncDevicePlatform_t platform,
+                                                        size_t maxCount) {
+    VPU_PROFILE(openExtraDevices);
+    std::lock_guard<std::mutex> lock(device_mutex);
+
+    std::vector<DevicePtr> devices;
+    while (devices.size() < maxCount) {
+        auto bootedButEmptyDevice = std::find_if(devicePool.begin(), devicePool.end(),
+            [&config, platform](const DevicePtr &device) {
+                return device->isBooted() && device->isEmpty()
+                       && device->isSuitableForConfig(config) && device->_platform == platform;
+            });
+
+        if (bootedButEmptyDevice != devicePool.end()) {
+            auto &device = *bootedButEmptyDevice;
+            device->_graphNum = 1;
+            devices.push_back(device);
+            continue;
+        }
+
+        if (bootNextDevice(devicePool, config) != NC_OK) {
+            break;
+        }
+
+        auto &device = devicePool.back();
+        if (device->_platform != platform) {
+            // keep the device booted for other networks
+            device->_graphNum = 0;
+            continue;
+        }
+
+        _log->info("Device #%d %s (%s protocol) allocated", devicePool.size() - 1,
+            device->_platform == NC_MYRIAD_X ? "MYRIAD-X" : "MYRIAD-2",
+            device->_protocol == NC_USB? "USB" : "PCIe");
+
+        devices.push_back(device);
+    }
+
+    return devices;
+}
+
 VPU_PACKED(bin_header {
     int32_t  magic;
     uint32_t frequency;
@@ -88,6 +88,15 @@ public:
      */
     DevicePtr openDevice(std::vector<DevicePtr> &devicePool, const MyriadConfig& config);
 
+    /**
+     * @brief Get additional myriad devices for replicating a network opened on another device
+     * @param platform Platform of the device the network was compiled for
+     * @param maxCount Maximum number of devices to return
+     * @return Already booted and empty devices or new booted devices, devices with graphs are never shared
+     */
+    std::vector<DevicePtr> openExtraDevices(std::vector<DevicePtr> &devicePool, const MyriadConfig& config,
+                                            ncDevicePlatform_t platform, size_t maxCount);
+
     static void closeDevices(std::vector<DevicePtr> &devicePool, std::shared_ptr<IMvnc> mvnc);
 
     void allocateGraph(DevicePtr &device,
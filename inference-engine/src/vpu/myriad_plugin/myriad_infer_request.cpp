@@ -3,6 +3,9 @@
 //
 
 #define NOMINMAX
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <utility>
 #include <ie_blob.h>
 #include <description_buffer.hpp>
@@ -23,7 +26,8 @@ using namespace InferenceEngine;
 
 #define MEMCPY(dst, src, bytes) std::copy_n((src), (bytes), (dst))
 
-MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
+MyriadInferRequest::MyriadInferRequest(const std::vector<GraphReplica> &replicas,
+                                       const DeviceScheduler::Ptr &scheduler,
                                        InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        DataInfo& compilerInputsInfo,
@@ -35,7 +39,7 @@ MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
         InferRequestInternal(networkInputs, networkOutputs), _executor(executor),
         _log(log), _stagesMetaData(blobMetaData), _config(myriadConfig),
         _inputInfo(compilerInputsInfo), _outputInfo(compilerOutputsInfo),
-        _graphDesc(graphDesc) {
+        _replicas(replicas), _scheduler(scheduler) {
     VPU_PROFILE(MyriadInferRequest);
 
     const auto& ioStrides = _config.compileConfig().ioStrides;
@@ -91,7 +95,12 @@ void MyriadInferRequest::InferImpl() {
 }
 
 void MyriadInferRequest::InferAsync() {
-    VPU_PROFILE(InferAsync);
+    PrepareInput();
+    SendInput();
+}
+
+void MyriadInferRequest::PrepareInput() {
+    VPU_PROFILE(PrepareInput);
 
     // execute input pre-processing
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
@@ -136,8 +145,29 @@ void MyriadInferRequest::InferAsync() {
         }
     }
 
-    _executor->queueInference(_graphDesc, inputBuffer.data(),
-                              _inputInfo.totalSize, nullptr, 0);
+    _replicaIdx = _scheduler->acquire();
+}
+
+void MyriadInferRequest::SendInput() {
+    VPU_PROFILE(SendInput);
+
+    try {
+        _executor->queueInference(_replicas[_replicaIdx]._graphDesc, inputBuffer.data(),
+                                  _inputInfo.totalSize, nullptr, 0);
+    } catch (...) {
+        _scheduler->release(_replicaIdx);
+        throw;
+    }
+}
+
+void MyriadInferRequest::readResult(void *resultData, unsigned int resultBytes) {
+    try {
+        _executor->getResult(_replicas[_replicaIdx]._graphDesc, resultData, resultBytes);
+    } catch (...) {
+        _scheduler->release(_replicaIdx);
+        throw;
+    }
+    _scheduler->release(_replicaIdx);
 }
 
 static void copyBlobAccordingUpperBound(
@@ -149,9 +179,7 @@ static void copyBlobAccordingUpperBound(
     const auto& inBlockingDesc = in->getTensorDesc().getBlockingDesc();
     const auto& outBlockingDesc = out->getTensorDesc().getBlockingDesc();
 
-    const auto& inDims = inBlockingDesc.getBlockDims();
     const auto& outDims = outBlockingDesc.getBlockDims();
-    const auto inTotalDimSize = in->byteSize();
 
     // Strides in blocking description is presented by elements.
     // So we need to multiply them by element size
@@ -167,25 +195,27 @@ static void copyBlobAccordingUpperBound(
     auto outPtr = out->cbuffer().as<uint8_t *>();
     IE_ASSERT(outPtr != nullptr);
 
-    const auto inLineByteSize = inDims[inDims.size() - 1] * in->element_size();
-    const auto outLineByteSize = outDims[inDims.size() - 1] * out->element_size();
+    const auto outLineByteSize = outDims[outDims.size() - 1] * out->element_size();
 
-    for (size_t inByteOffset = 0, outByteOffset = 0; inByteOffset < inTotalDimSize; inByteOffset += inLineByteSize) {
-        auto offset = inByteOffset;
-        bool isGarbageLine = false;
-        for (size_t dim = 0; dim < inStrides.size() - 1; ++dim) {
-            const auto coordAlongDim = offset / inStrides[dim];
-            if (coordAlongDim > outDims[dim] - 1) {
-                isGarbageLine = true;
-                break;
-            }
+    // Only the lines inside of the actual dims are visited, the upper bound may be much bigger than the result.
+    const auto numLineDims = outDims.size() - 1;
+    const auto numLines = std::accumulate(outDims.begin(), outDims.begin() + numLineDims, size_t{1}, std::multiplies<size_t>());
 
-            offset %= inStrides[dim];
+    SizeVector lineCoord(numLineDims, 0);
+    for (size_t line = 0, outByteOffset = 0; line < numLines; ++line, outByteOffset += outLineByteSize) {
+        size_t inByteOffset = 0;
+        for (size_t dim = 0; dim < numLineDims; ++dim) {
+            inByteOffset += lineCoord[dim] * inStrides[dim];
         }
-        if (!isGarbageLine) {
-            // We transfer outLineByteSize bytes, so garbage data at the end of the line is not copied.
-            std::copy_n(inPtr + inByteOffset, outLineByteSize, outPtr + outByteOffset);
-            outByteOffset += outLineByteSize;
+
+        // We transfer outLineByteSize bytes, so garbage data at the end of the line is not copied.
+        std::copy_n(inPtr + inByteOffset, outLineByteSize, outPtr + outByteOffset);
+
+        for (auto dim = numLineDims; dim > 0; --dim) {
+            if (++lineCoord[dim - 1] < outDims[dim - 1]) {
+                break;
+            }
+            lineCoord[dim - 1] = 0;
         }
     }
 }
@@ -208,12 +238,12 @@ void MyriadInferRequest::GetResult() {
         const auto& blob = (*it).second;
 
         if (blob->getTensorDesc().getLayout() == getVpuLayout(name)) {
-            _executor->getResult(_graphDesc, blob->buffer(), blob->byteSize());
+            readResult(blob->buffer(), blob->byteSize());
             return;
         }
     }
 
-    _executor->getResult(_graphDesc, resultBuffer.data(), resultBuffer.size());
+    readResult(resultBuffer.data(), resultBuffer.size());
 
     for (const auto& output : _outputs) {
         const auto& ieBlobName = output.first;
@@ -281,7 +311,7 @@ void MyriadInferRequest::GetResult() {
 }
 
 void MyriadInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
-    auto perfInfo = _executor->getPerfTimeInfo(_graphDesc._graphHandle);
+    auto perfInfo = _executor->getPerfTimeInfo(_replicas[_replicaIdx]._graphDesc._graphHandle);
 
     if (_log->isActive(LogLevel::Info)) {
         if (!perfInfo.empty()) {
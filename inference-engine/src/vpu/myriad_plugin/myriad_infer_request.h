@@ -18,6 +18,7 @@
 
 #include "myriad_executor.h"
 #include "myriad_config.h"
+#include "myriad_device_scheduler.h"
 
 namespace vpu {
 namespace MyriadPlugin {
@@ -31,14 +32,19 @@ class MyriadInferRequest : public InferenceEngine::InferRequestInternal {
     const DataInfo _inputInfo;
     const DataInfo _outputInfo;
 
-    GraphDesc _graphDesc;
+    std::vector<GraphReplica> _replicas;
+    DeviceScheduler::Ptr _scheduler;
+    size_t _replicaIdx = 0;
     std::vector<uint8_t> resultBuffer;
     std::vector<uint8_t> inputBuffer;
 
+    void readResult(void *resultData, unsigned int resultBytes);
+
 public:
     typedef std::shared_ptr<MyriadInferRequest> Ptr;
 
-    explicit MyriadInferRequest(GraphDesc &_graphDesc,
+    explicit MyriadInferRequest(const std::vector<GraphReplica> &replicas,
+                                const DeviceScheduler::Ptr &scheduler,
                                 InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 DataInfo& compilerInputsInfo,
@@ -52,6 +58,29 @@ public:
     void InferAsync();
     void GetResult();
 
+    /**
+     * @brief Packs the inputs to the request's buffer and selects the replica to run the inference on
+     */
+    void PrepareInput();
+    /**
+     * @brief Sends the packed inputs to the selected replica's input FIFO and starts the inference
+     */
+    void SendInput();
+
+    /**
+     * @brief Executor sending the inputs to the replica selected by PrepareInput()
+     */
+    const InferenceEngine::ITaskExecutor::Ptr& transferExecutor() const {
+        return _replicas[_replicaIdx]._taskExecutorTransfer;
+    }
+
+    /**
+     * @brief Executor reading the results from the replica the last inference was queued to
+     */
+    const InferenceEngine::ITaskExecutor::Ptr& getResultExecutor() const {
+        return _replicas[_replicaIdx]._taskExecutorGetResult;
+    }
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 };
@@ -25,6 +25,7 @@ MyriadMetrics::MyriadMetrics() {
         METRIC_KEY(OPTIMIZATION_CAPABILITIES),
         METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
         METRIC_KEY(DEVICE_THERMAL),
+        METRIC_KEY(IMPORT_EXPORT_SUPPORT),
     };
 
 IE_SUPPRESS_DEPRECATED_START
@@ -35,6 +36,7 @@ IE_SUPPRESS_DEPRECATED_START
         KEY_VPU_CUSTOM_LAYERS,
         KEY_VPU_MYRIAD_FORCE_RESET,
         KEY_VPU_MYRIAD_PLATFORM,
+        KEY_VPU_MYRIAD_DEVICE_POOL_SIZE,
         KEY_EXCLUSIVE_ASYNC_REQUESTS,
         KEY_PERF_COUNT,
         KEY_CONFIG_FILE,
@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_benchmark.hpp"
+
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LayerBenchmarks {
+
+namespace {
+
+std::vector<Generator>& GetGenerators() {
+    static std::vector<Generator> generators;
+    return generators;
+}
+
+}  // namespace
+
+Registrar::Registrar(Generator generator) {
+    GetGenerators().push_back(std::move(generator));
+}
+
+std::vector<Case> GetCases() {
+    std::vector<Case> cases;
+    for (auto&& generator : GetGenerators()) {
+        auto generated = generator();
+        cases.insert(cases.end(), generated.begin(), generated.end());
+    }
+    return cases;
+}
+
+std::string MakeName(const std::vector<std::string>& parts) {
+    std::string name;
+    for (auto&& part : parts) {
+        if (part.empty()) continue;
+        name += (name.empty() ? "" : "/") + part;
+    }
+    return name;
+}
+
+std::string ToString(const ngraph::Shape& shape) {
+    std::stringstream ss;
+    for (size_t i = 0; i < shape.size(); i++) {
+        ss << (i == 0 ? "" : "x") << shape[i];
+    }
+    return ss.str();
+}
+
+std::string ToString(InferenceEngine::Layout layout) {
+    std::stringstream ss;
+    ss << layout;
+    return ss.str();
+}
+
+const std::vector<InferenceEngine::Layout>& DefaultLayouts() {
+    static const std::vector<InferenceEngine::Layout> layouts = {
+        InferenceEngine::Layout::NCHW,
+        InferenceEngine::Layout::NHWC,
+    };
+    return layouts;
+}
+
+}  // namespace LayerBenchmarks
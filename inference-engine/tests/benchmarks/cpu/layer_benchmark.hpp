@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ie_layouts.h>
+#include <ngraph/function.hpp>
+#include <ngraph/shape.hpp>
+#include <ngraph/type/element_type.hpp>
+
+namespace LayerBenchmarks {
+
+/**
+ * @brief A single-layer network measured by the benchmark runner
+ */
+struct Case {
+    Case(std::string name_, std::function<std::shared_ptr<ngraph::Function>()> function_,
+         InferenceEngine::Layout layout_ = InferenceEngine::Layout::ANY)
+        : name(std::move(name_)), function(std::move(function_)), layout(layout_) {}
+
+    /**
+     * @brief A unique name of the case, e.g. "Gather/1000x512/axis=0/f32"
+     */
+    std::string name;
+
+    /**
+     * @brief Builds the network
+     */
+    std::function<std::shared_ptr<ngraph::Function>()> function;
+
+    /**
+     * @brief Layout of the 4D inputs and outputs of the network. ANY keeps the default one
+     */
+    InferenceEngine::Layout layout;
+};
+
+/**
+ * @brief Creates all the cases of a layer
+ */
+using Generator = std::function<std::vector<Case>()>;
+
+/**
+ * @brief Registers a generator from a static initializer. Use REGISTER_LAYER_BENCHMARKS
+ */
+struct Registrar {
+    explicit Registrar(Generator generator);
+};
+
+/**
+ * @brief Returns the cases of all registered generators
+ */
+std::vector<Case> GetCases();
+
+/**
+ * @brief Joins parts of a case name with '/'
+ */
+std::string MakeName(const std::vector<std::string>& parts);
+
+std::string ToString(const ngraph::Shape& shape);
+std::string ToString(InferenceEngine::Layout layout);
+
+/**
+ * @brief Layouts the layers are measured with: the plugin has specialized implementations for blocked and channel-last
+ * data, so a regression may affect only one of them
+ */
+const std::vector<InferenceEngine::Layout>& DefaultLayouts();
+
+}  // namespace LayerBenchmarks
+
+#define LAYER_BENCHMARKS_CONCAT_IMPL(a, b) a##b
+#define LAYER_BENCHMARKS_CONCAT(a, b) LAYER_BENCHMARKS_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Registers a generator of the cases of a layer
+ */
+#define REGISTER_LAYER_BENCHMARKS(generator) \
+    static LayerBenchmarks::Registrar LAYER_BENCHMARKS_CONCAT(layerBenchmarksRegistrar, __LINE__) {generator}
@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "layer_benchmark.hpp"
+
+using namespace ngraph;
+
+namespace {
+
+struct GatherParams {
+    Shape   dataShape;
+    size_t  indicesCount;
+    int64_t axis;
+};
+
+std::vector<LayerBenchmarks::Case> GatherCases() {
+    const std::vector<GatherParams> params = {
+        // embedding lookup
+        {{30000, 512}, 128, 0},
+        {{30000, 64}, 4096, 0},
+        // selection of channels and of the innermost elements
+        {{1, 256, 56, 56}, 64, 1},
+        {{8, 64, 64, 256}, 128, 3},
+    };
+    const std::vector<element::Type> precisions = {element::f32, element::i32};
+
+    std::vector<LayerBenchmarks::Case> cases;
+    for (auto&& param : params) {
+        for (auto precision : precisions) {
+            auto function = [=] {
+                auto input = std::make_shared<opset1::Parameter>(precision, param.dataShape);
+                // fixed pseudo random indices, so the accesses are not sequential
+                std::vector<int32_t> indices(param.indicesCount);
+                const auto dimension = param.dataShape[param.axis];
+                for (size_t i = 0; i < indices.size(); i++) {
+                    indices[i] = static_cast<int32_t>((i * 7919) % dimension);
+                }
+                auto indicesNode = opset1::Constant::create(element::i32, Shape{indices.size()}, indices);
+                auto axisNode = opset1::Constant::create(element::i64, Shape{}, {param.axis});
+                auto gather = std::make_shared<opset1::Gather>(input, indicesNode, axisNode);
+                return std::make_shared<Function>(gather->outputs(), ParameterVector{input}, "Gather");
+            };
+            cases.push_back({LayerBenchmarks::MakeName({"Gather", LayerBenchmarks::ToString(param.dataShape),
+                                                        "indices=" + std::to_string(param.indicesCount),
+                                                        "axis=" + std::to_string(param.axis),
+                                                        precision.get_type_name()}),
+                             function});
+        }
+    }
+    return cases;
+}
+
+}  // namespace
+
+REGISTER_LAYER_BENCHMARKS(GatherCases);
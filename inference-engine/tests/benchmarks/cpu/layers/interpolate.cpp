@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "layer_benchmark.hpp"
+
+using namespace ngraph;
+
+namespace {
+
+std::vector<LayerBenchmarks::Case> InterpolateCases() {
+    const std::vector<Shape> shapes = {{1, 64, 56, 56}, {1, 256, 28, 28}, {1, 32, 135, 240}};
+    const std::vector<std::string> modes = {"nearest", "linear"};
+    const size_t scale = 2;
+
+    std::vector<LayerBenchmarks::Case> cases;
+    for (auto&& shape : shapes) {
+        for (auto&& mode : modes) {
+            for (auto layout : LayerBenchmarks::DefaultLayouts()) {
+                auto function = [=] {
+                    auto input = std::make_shared<opset1::Parameter>(element::f32, shape);
+                    auto outputShape = opset1::Constant::create(element::i64, Shape{2},
+                        std::vector<int64_t>{static_cast<int64_t>(shape[2] * scale), static_cast<int64_t>(shape[3] * scale)});
+                    op::InterpolateAttrs attrs;
+                    attrs.axes = AxisSet{2, 3};
+                    attrs.mode = mode;
+                    attrs.align_corners = false;
+                    attrs.antialias = false;
+                    attrs.pads_begin = {0};
+                    attrs.pads_end = {0};
+                    auto interpolate = std::make_shared<opset1::Interpolate>(input, outputShape, attrs);
+                    return std::make_shared<Function>(interpolate->outputs(), ParameterVector{input}, "Interpolate");
+                };
+                cases.push_back({LayerBenchmarks::MakeName({"Interpolate", LayerBenchmarks::ToString(shape), mode,
+                                                            "scale=" + std::to_string(scale), "f32",
+                                                            LayerBenchmarks::ToString(layout)}),
+                                 function, layout});
+            }
+        }
+    }
+    return cases;
+}
+
+}  // namespace
+
+REGISTER_LAYER_BENCHMARKS(InterpolateCases);
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "layer_benchmark.hpp"
+
+using namespace ngraph;
+
+namespace {
+
+using ReduceBuilder = std::function<std::shared_ptr<Node>(const Output<Node>&, const Output<Node>&)>;
+
+template <class Reduce>
+std::pair<std::string, ReduceBuilder> MakeReduce(const std::string& name) {
+    return {name, [] (const Output<Node>& data, const Output<Node>& axes) {
+        return std::make_shared<Reduce>(data, axes, true);
+    }};
+}
+
+std::string ToString(const std::vector<int64_t>& axes) {
+    std::string result;
+    for (auto axis : axes) {
+        result += (result.empty() ? "" : ",") + std::to_string(axis);
+    }
+    return result;
+}
+
+std::vector<LayerBenchmarks::Case> ReduceCases() {
+    const std::vector<std::pair<std::string, ReduceBuilder>> reduces = {
+        MakeReduce<opset1::ReduceMean>("ReduceMean"),
+        MakeReduce<opset1::ReduceSum>("ReduceSum"),
+        MakeReduce<opset1::ReduceMax>("ReduceMax"),
+    };
+    const std::vector<Shape> shapes = {{1, 256, 56, 56}, {8, 512, 14, 14}};
+    // spatial (global pooling), channels (normalization) and the innermost axis
+    const std::vector<std::vector<int64_t>> axesSet = {{2, 3}, {1}, {3}};
+    const std::vector<element::Type> precisions = {element::f32, element::i32};
+
+    std::vector<LayerBenchmarks::Case> cases;
+    for (auto&& reduce : reduces) {
+        for (auto&& shape : shapes) {
+            for (auto&& axes : axesSet) {
+                for (auto precision : precisions) {
+                    for (auto layout : LayerBenchmarks::DefaultLayouts()) {
+                        auto builder = reduce.second;
+                        auto function = [=] {
+                            auto input = std::make_shared<opset1::Parameter>(precision, shape);
+                            auto axesNode = opset1::Constant::create(element::i64, Shape{axes.size()}, axes);
+                            auto node = builder(input, axesNode);
+                            return std::make_shared<Function>(node->outputs(), ParameterVector{input}, "Reduce");
+                        };
+                        cases.push_back({LayerBenchmarks::MakeName({reduce.first, LayerBenchmarks::ToString(shape),
+                                                                    "axes=" + ToString(axes), precision.get_type_name(),
+                                                                    LayerBenchmarks::ToString(layout)}),
+                                         function, layout});
+                    }
+                }
+            }
+        }
+    }
+    return cases;
+}
+
+}  // namespace
+
+REGISTER_LAYER_BENCHMARKS(ReduceCases);
@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "layer_benchmark.hpp"
+
+using namespace ngraph;
+
+namespace {
+
+std::vector<LayerBenchmarks::Case> TransposeCases() {
+    const std::vector<Shape> shapes = {{1, 64, 112, 112}, {16, 128, 32, 32}};
+    // channel-first to channel-last and back, and swaps of the spatial axes
+    const std::vector<std::vector<int64_t>> orders = {{0, 2, 3, 1}, {0, 3, 1, 2}, {0, 1, 3, 2}, {1, 0, 2, 3}};
+    const std::vector<element::Type> precisions = {element::f32, element::i32};
+
+    std::vector<LayerBenchmarks::Case> cases;
+    for (auto&& shape : shapes) {
+        for (auto&& order : orders) {
+            for (auto precision : precisions) {
+                for (auto layout : LayerBenchmarks::DefaultLayouts()) {
+                    auto function = [=] {
+                        auto input = std::make_shared<opset1::Parameter>(precision, shape);
+                        auto orderNode = opset1::Constant::create(element::i64, Shape{order.size()}, order);
+                        auto transpose = std::make_shared<opset1::Transpose>(input, orderNode);
+                        return std::make_shared<Function>(transpose->outputs(), ParameterVector{input}, "Transpose");
+                    };
+                    std::string orderName;
+                    for (auto axis : order) {
+                        orderName += std::to_string(axis);
+                    }
+                    cases.push_back({LayerBenchmarks::MakeName({"Transpose", LayerBenchmarks::ToString(shape),
+                                                                "order=" + orderName, precision.get_type_name(),
+                                                                LayerBenchmarks::ToString(layout)}),
+                                     function, layout});
+                }
+            }
+        }
+    }
+    return cases;
+}
+
+}  // namespace
+
+REGISTER_LAYER_BENCHMARKS(TransposeCases);
@@ -0,0 +1,230 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct Options {
+    std::string filter = ".*";
+    double minTime = 0.5;
+    size_t repetitions = 5;
+    int threads = 0;
+    bool csv = false;
+    bool list = false;
+};
+
+struct Result {
+    double timeUs = 0.0;
+    double cv = 0.0;
+    size_t iterations = 0;
+    double bytes = 0.0;
+};
+
+void ShowUsage() {
+    std::cout << "cpuLayerBenchmarks [OPTION]" << std::endl
+              << "Measures single-layer networks on the CPU plugin." << std::endl << std::endl
+              << "    --filter=<regex>      Run only the cases with the name matching the regular expression" << std::endl
+              << "    --min_time=<seconds>  Minimal time of one repetition. Default is 0.5" << std::endl
+              << "    --repetitions=<n>     Number of repetitions, the median one is reported. Default is 5" << std::endl
+              << "    --threads=<n>         Number of threads of the CPU plugin. Default is the plugin default" << std::endl
+              << "    --format=console|csv  Output format. Default is console" << std::endl
+              << "    --list                List the cases without running them" << std::endl;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto pos = arg.find('=');
+        auto key = arg.substr(0, pos);
+        auto value = pos == std::string::npos ? std::string{} : arg.substr(pos + 1);
+        if (key == "--filter") {
+            options.filter = value;
+        } else if (key == "--min_time") {
+            options.minTime = std::stod(value);
+        } else if (key == "--repetitions") {
+            options.repetitions = std::max<size_t>(1, std::stoul(value));
+        } else if (key == "--threads") {
+            options.threads = std::stoi(value);
+        } else if (key == "--format" && (value == "csv" || value == "console")) {
+            options.csv = value == "csv";
+        } else if (key == "--list") {
+            options.list = true;
+        } else {
+            ShowUsage();
+            return false;
+        }
+    }
+    return true;
+}
+
+// The same data on every run, so data-dependent kernels (e.g. max reductions) do the same work
+void FillBlob(const Blob::Ptr& blob, unsigned seed) {
+    std::mt19937 generator(seed);
+    auto memory = as<MemoryBlob>(blob)->wmap();
+    if (blob->getTensorDesc().getPrecision() == Precision::FP32) {
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        auto data = memory.as<float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = distribution(generator);
+        }
+    } else {
+        std::uniform_int_distribution<int> distribution(0, 100);
+        auto data = memory.as<uint8_t*>();
+        for (size_t i = 0; i < blob->byteSize(); i++) {
+            data[i] = static_cast<uint8_t>(distribution(generator));
+        }
+    }
+}
+
+Result Measure(Core& ie, const LayerBenchmarks::Case& benchmarkCase, const Options& options) {
+    CNNNetwork network(benchmarkCase.function());
+    if (benchmarkCase.layout != Layout::ANY) {
+        for (auto&& input : network.getInputsInfo()) {
+            if (input.second->getTensorDesc().getDims().size() == 4)
+                input.second->setLayout(benchmarkCase.layout);
+        }
+        for (auto&& output : network.getOutputsInfo()) {
+            if (output.second->getTensorDesc().getDims().size() == 4)
+                output.second->setLayout(benchmarkCase.layout);
+        }
+    }
+
+    // a single pinned stream, so the results depend on the layer and not on the scheduling of requests
+    std::map<std::string, std::string> config = {
+        {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"},
+        {CONFIG_KEY(CPU_BIND_THREAD), CONFIG_VALUE(YES)},
+    };
+    if (options.threads > 0)
+        config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(options.threads);
+    auto executableNetwork = ie.LoadNetwork(network, "CPU", config);
+    auto request = executableNetwork.CreateInferRequest();
+
+    Result result;
+    unsigned seed = 0;
+    for (auto&& input : executableNetwork.GetInputsInfo()) {
+        auto blob = request.GetBlob(input.first);
+        FillBlob(blob, seed++);
+        result.bytes += blob->byteSize();
+    }
+    for (auto&& output : executableNetwork.GetOutputsInfo()) {
+        result.bytes += request.GetBlob(output.first)->byteSize();
+    }
+
+    auto run = [&request] (size_t iterations) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.Infer();
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // warm up and find the number of iterations which takes at least the minimal time
+    run(3);
+    size_t iterations = 1;
+    double time = run(iterations);
+    while (time < options.minTime / 10 && iterations < (1u << 30)) {
+        iterations *= 2;
+        time = run(iterations);
+    }
+    iterations = std::max<size_t>(1, static_cast<size_t>(options.minTime * iterations / time));
+
+    std::vector<double> times;
+    for (size_t r = 0; r < options.repetitions; r++) {
+        times.push_back(run(iterations) / iterations);
+    }
+    double mean = 0.0;
+    for (auto t : times) mean += t;
+    mean /= times.size();
+    double variance = 0.0;
+    for (auto t : times) variance += (t - mean) * (t - mean);
+    variance /= times.size();
+
+    std::sort(times.begin(), times.end());
+    result.timeUs = times[times.size() / 2] * 1e6;
+    result.cv = mean > 0.0 ? std::sqrt(variance) / mean * 100.0 : 0.0;
+    result.iterations = iterations;
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::regex filter(options.filter);
+    std::vector<LayerBenchmarks::Case> cases;
+    for (auto&& benchmarkCase : LayerBenchmarks::GetCases()) {
+        if (std::regex_search(benchmarkCase.name, filter))
+            cases.push_back(benchmarkCase);
+    }
+    if (options.list) {
+        for (auto&& benchmarkCase : cases) {
+            std::cout << benchmarkCase.name << std::endl;
+        }
+        return 0;
+    }
+
+    Core ie;
+    const size_t nameWidth = 72;
+    if (options.csv) {
+        std::cout << "name,time_us,cv_percent,iterations,inferences_per_second,gb_per_second,error" << std::endl;
+    } else {
+        std::cout << "Device: " << ie.GetMetric("CPU", METRIC_KEY(FULL_DEVICE_NAME)).as<std::string>() << std::endl;
+        std::cout << "Threads: " << (options.threads > 0 ? std::to_string(options.threads) : "default")
+                  << ", repetitions: " << options.repetitions << ", min time: " << options.minTime << " s" << std::endl;
+        std::cout << std::left << std::setw(nameWidth) << "Benchmark" << std::right
+                  << std::setw(12) << "Time(us)" << std::setw(8) << "CV(%)" << std::setw(12) << "Iterations"
+                  << std::setw(14) << "Inferences/s" << std::setw(10) << "GB/s" << std::endl;
+        std::cout << std::string(nameWidth + 56, '-') << std::endl;
+    }
+
+    for (auto&& benchmarkCase : cases) {
+        try {
+            auto result = Measure(ie, benchmarkCase, options);
+            double inferences = 1e6 / result.timeUs;
+            double gbPerSecond = result.bytes * inferences / 1e9;
+            if (options.csv) {
+                std::cout << benchmarkCase.name << "," << result.timeUs << "," << result.cv << "," << result.iterations
+                          << "," << inferences << "," << gbPerSecond << "," << std::endl;
+            } else {
+                std::cout << std::left << std::setw(nameWidth) << benchmarkCase.name << std::right << std::fixed
+                          << std::setprecision(2) << std::setw(12) << result.timeUs << std::setw(8) << result.cv
+                          << std::setw(12) << result.iterations << std::setw(14) << inferences
+                          << std::setw(10) << gbPerSecond << std::endl;
+            }
+        } catch (const std::exception& ex) {
+            // e.g. a precision or layout the layer does not support, other cases are still measured
+            std::string error = ex.what();
+            error = error.substr(0, error.find('\n'));
+            if (options.csv) {
+                std::replace(error.begin(), error.end(), ',', ';');
+                std::cout << benchmarkCase.name << ",,,,,," << error << std::endl;
+            } else {
+                std::cout << std::left << std::setw(nameWidth) << benchmarkCase.name << " ERROR: " << error << std::endl;
+            }
+        }
+    }
+    return 0;
+}
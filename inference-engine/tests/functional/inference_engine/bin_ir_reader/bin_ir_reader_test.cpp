@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/op/constant.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+class BinaryIRReaderTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _function = ngraph::builder::subgraph::makeConvPoolRelu();
+        InferenceEngine::CNNNetwork(_function).serialize(_modelPath);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(_modelPath);
+    }
+
+    void compare(const InferenceEngine::CNNNetwork& network) {
+        auto function = network.getFunction();
+        ASSERT_NE(nullptr, function);
+        auto result = compare_functions(_function, std::const_pointer_cast<ngraph::Function>(function));
+        ASSERT_TRUE(result.first) << result.second;
+
+        auto expectedOps = _function->get_ordered_ops();
+        auto actualOps = function->get_ordered_ops();
+        ASSERT_EQ(expectedOps.size(), actualOps.size());
+        for (size_t i = 0; i < expectedOps.size(); i++) {
+            ASSERT_EQ(expectedOps[i]->get_friendly_name(), actualOps[i]->get_friendly_name());
+            if (auto expected = ngraph::as_type_ptr<ngraph::op::Constant>(expectedOps[i])) {
+                auto actual = ngraph::as_type_ptr<ngraph::op::Constant>(actualOps[i]);
+                ASSERT_NE(nullptr, actual);
+                ASSERT_EQ(expected->cast_vector<float>(), actual->cast_vector<float>());
+            }
+        }
+    }
+
+    std::shared_ptr<ngraph::Function> _function;
+    const std::string _modelPath = "BinaryIRReaderTests.bir";
+};
+
+}  // namespace
+
+TEST_F(BinaryIRReaderTests, readsSerializedFunctionFromFile) {
+    InferenceEngine::Core ie;
+    compare(ie.ReadNetwork(_modelPath));
+}
+
+TEST_F(BinaryIRReaderTests, readsSerializedFunctionFromMemory) {
+    std::ifstream file(_modelPath, std::ios::binary);
+    std::string model((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    InferenceEngine::Core ie;
+    compare(ie.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+}
+
+TEST_F(BinaryIRReaderTests, throwsOnUnsupportedVersion) {
+    std::ifstream file(_modelPath, std::ios::binary);
+    std::string model((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    // the version follows the magic
+    model[8]++;
+
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.ReadNetwork(model, InferenceEngine::Blob::CPtr()), InferenceEngine::details::InferenceEngineException);
+}
@@ -9,6 +9,7 @@
 
 #include <ie_blob.h>
 #include <blob_transform.hpp>
+#include <precision_utils.h>
 
 using namespace ::testing;
 using namespace InferenceEngine;
@@ -453,3 +454,77 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+TEST(BlobCopyTest, BlobCopyOf3DBlobWithPermutedLayout) {
+    const size_t C = 5, H = 17, W = 33;
+    auto src = make_shared_blob<float>({Precision::FP32, {C, H, W}, Layout::CHW});
+    auto dst = make_shared_blob<float>({Precision::FP32, {C, H, W}, BlockingDesc({H, W, C}, {1, 2, 0})});
+    src->allocate();
+    dst->allocate();
+    auto srcData = src->buffer().as<float*>();
+    for (size_t i = 0; i < src->size(); i++) {
+        srcData[i] = static_cast<float>(i);
+    }
+
+    blob_copy(src, dst);
+
+    auto dstData = dst->buffer().as<float*>();
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t w = 0; w < W; w++) {
+                ASSERT_EQ(srcData[(c * H + h) * W + w], dstData[(h * W + w) * C + c]);
+            }
+        }
+    }
+}
+
+TEST(BlobCopyTest, BlobCopyConvertsU8ToFP32WithReLayout) {
+    const size_t N = 2, C = 3, H = 40, W = 45;
+    auto src = make_shared_blob<uint8_t>({Precision::U8, {N, C, H, W}, Layout::NHWC});
+    auto dst = make_shared_blob<float>({Precision::FP32, {N, C, H, W}, Layout::NCHW});
+    src->allocate();
+    dst->allocate();
+    auto srcData = src->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < src->size(); i++) {
+        srcData[i] = static_cast<uint8_t>(i % 251);
+    }
+
+    blob_copy(src, dst);
+
+    auto dstData = dst->buffer().as<float*>();
+    for (size_t n = 0; n < N; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t hw = 0; hw < H * W; hw++) {
+                ASSERT_EQ(static_cast<float>(srcData[(n * H * W + hw) * C + c]), dstData[(n * C + c) * H * W + hw]);
+            }
+        }
+    }
+}
+
+TEST(BlobCopyTest, BlobCopyConvertsFP16ToFP32) {
+    const SizeVector dims = {2, 3, 4, 5, 6, 7};
+    auto src = make_shared_blob<ie_fp16>({Precision::FP16, dims, Layout::ANY});
+    auto dst = make_shared_blob<float>({Precision::FP32, dims, Layout::ANY});
+    src->allocate();
+    dst->allocate();
+    auto srcData = src->buffer().as<ie_fp16*>();
+    for (size_t i = 0; i < src->size(); i++) {
+        srcData[i] = PrecisionUtils::f32tof16(static_cast<float>(i % 100) / 4.f);
+    }
+
+    blob_copy(src, dst);
+
+    auto dstData = dst->buffer().as<float*>();
+    for (size_t i = 0; i < dst->size(); i++) {
+        ASSERT_EQ(static_cast<float>(i % 100) / 4.f, dstData[i]);
+    }
+}
+
+TEST(BlobCopyTest, BlobCopyThrowsOnUnsupportedPrecisionConversion) {
+    auto src = make_shared_blob<float>({Precision::FP32, {1, 3, 4, 4}, Layout::NCHW});
+    auto dst = make_shared_blob<uint8_t>({Precision::U8, {1, 3, 4, 4}, Layout::NHWC});
+    src->allocate();
+    dst->allocate();
+
+    ASSERT_THROW(blob_copy(src, dst), InferenceEngine::details::InferenceEngineException);
+}
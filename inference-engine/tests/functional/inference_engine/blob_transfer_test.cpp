@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <ie_blob.h>
+#include <ie_blob_transfer.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+TEST(BlobTransferTest, CopyIsElidedForTheSameMemory) {
+    std::vector<float> data(2 * 3 * 4 * 5, 1.f);
+    TensorDesc desc(Precision::FP32, {2, 3, 4, 5}, Layout::NCHW);
+    auto first = make_shared_blob<float>(desc, data.data());
+    auto second = make_shared_blob<float>(desc, data.data());
+
+    ASSERT_TRUE(BlobTransfer::IsSameMemory(first, second));
+    ASSERT_FALSE(BlobTransfer::Copy(first, second));
+}
+
+TEST(BlobTransferTest, CopyConvertsTheLayout) {
+    const SizeVector dims = {1, 3, 2, 2};
+    auto src = make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW});
+    auto dst = make_shared_blob<float>({Precision::FP32, dims, Layout::NHWC});
+    src->allocate();
+    dst->allocate();
+    auto srcData = src->buffer().as<float*>();
+    for (size_t i = 0; i < src->size(); i++)
+        srcData[i] = static_cast<float>(i);
+
+    ASSERT_FALSE(BlobTransfer::IsSameMemory(src, dst));
+    ASSERT_TRUE(BlobTransfer::Copy(src, dst));
+
+    auto dstData = dst->buffer().as<float*>();
+    for (size_t c = 0; c < 3; c++)
+        for (size_t hw = 0; hw < 4; hw++)
+            ASSERT_EQ(srcData[c * 4 + hw], dstData[hw * 3 + c]);
+}
+
+TEST(BlobTransferTest, StagingBlobIsReusedUntilTheDescChanges) {
+    BlobTransfer transfer;
+    TensorDesc desc(Precision::U8, {1, 3, 7, 7}, Layout::NCHW);
+    auto staging = transfer.GetStagingBlob("input", desc);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(staging->buffer().as<void*>()) % 4096);
+    ASSERT_EQ(staging, transfer.GetStagingBlob("input", desc));
+
+    TensorDesc other(Precision::U8, {1, 3, 8, 8}, Layout::NCHW);
+    auto reallocated = transfer.GetStagingBlob("input", other);
+    ASSERT_NE(staging, reallocated);
+    ASSERT_EQ(other, reallocated->getTensorDesc());
+}
+
+TEST(BlobTransferTest, StageRunsTheScheduledCopies) {
+    BlobTransfer transfer;
+    TensorDesc desc(Precision::I32, {4, 4}, Layout::NC);
+    auto src = make_shared_blob<int32_t>(desc);
+    src->allocate();
+    auto srcData = src->buffer().as<int32_t*>();
+    for (size_t i = 0; i < src->size(); i++)
+        srcData[i] = static_cast<int32_t>(i);
+    auto dst = transfer.GetStagingBlob("output", desc);
+
+    transfer.Add(src, dst);
+    auto stage = transfer.GetStage();
+    stage.first->run(stage.second);
+
+    auto dstData = dst->buffer().as<int32_t*>();
+    for (size_t i = 0; i < src->size(); i++)
+        ASSERT_EQ(srcData[i], dstData[i]);
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_plugin_config.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "compilation_context.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+TEST(NetworkCompilationContextTests, hashIsStableForTheSameNetwork) {
+    auto function = ngraph::builder::subgraph::makeConvPoolRelu();
+    CNNNetwork network1(function), network2(function);
+
+    ASSERT_TRUE(NetworkCompilationContext::isCacheable(network1));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(network1, "CPU", {}),
+              NetworkCompilationContext::computeHash(network2, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnDeviceAndConfig) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+
+    auto hash = NetworkCompilationContext::computeHash(network, "CPU", {});
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, "GPU", {}));
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, "CPU",
+        {{CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)}}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnInputPrecision) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+
+    auto hash = NetworkCompilationContext::computeHash(network, "CPU", {});
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(network, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnWeights) {
+    auto createNetwork = [](float value) {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {value});
+        auto add = std::make_shared<ngraph::opset1::Add>(param, constant);
+        auto result = std::make_shared<ngraph::opset1::Result>(add);
+        // friendly names are hashed as well, keep them the same for both networks
+        param->set_friendly_name("param");
+        constant->set_friendly_name("constant");
+        add->set_friendly_name("add");
+        result->set_friendly_name("result");
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+    };
+
+    ASSERT_NE(NetworkCompilationContext::computeHash(createNetwork(1.0f), "CPU", {}),
+              NetworkCompilationContext::computeHash(createNetwork(2.0f), "CPU", {}));
+}
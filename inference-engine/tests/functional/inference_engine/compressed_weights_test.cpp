@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <compressed_weights.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class CompressedWeightsTests : public ::testing::Test {
+protected:
+    static std::string compress(const std::vector<uint8_t>& data, size_t chunkSize) {
+        std::ostringstream stream;
+        details::compressWeights(data.data(), data.size(), stream, chunkSize);
+        return stream.str();
+    }
+
+    static void checkRoundTrip(const std::vector<uint8_t>& data, size_t chunkSize) {
+        auto compressed = compress(data, chunkSize);
+        ASSERT_TRUE(details::isCompressedWeights(compressed.data(), compressed.size()));
+
+        auto blob = details::decompressWeights(compressed.data(), compressed.size());
+        ASSERT_EQ(data.size(), blob->byteSize());
+        ASSERT_EQ(0, std::memcmp(data.data(), blob->cbuffer().as<const uint8_t*>(), data.size()));
+    }
+};
+
+TEST_F(CompressedWeightsTests, roundTripOfRandomData) {
+    std::mt19937 generator(42);
+    std::vector<uint8_t> data(100003);
+    for (auto& value : data)
+        value = static_cast<uint8_t>(generator());
+    checkRoundTrip(data, 4096);
+}
+
+TEST_F(CompressedWeightsTests, roundTripOfFloatsIsSmaller) {
+    std::mt19937 generator(42);
+    std::normal_distribution<float> distribution(0.f, 0.1f);
+    std::vector<float> values(1 << 18);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = i % 3 == 0 ? 0.f : distribution(generator);
+    std::vector<uint8_t> data(values.size() * sizeof(float));
+    std::memcpy(data.data(), values.data(), data.size());
+
+    checkRoundTrip(data, 1 << 16);
+    ASSERT_LT(compress(data, 1 << 16).size(), data.size());
+}
+
+TEST_F(CompressedWeightsTests, roundTripOfRepeatedData) {
+    std::vector<uint8_t> data(12345, 7);
+    for (size_t i = 0; i < data.size(); i += 100)
+        data[i] = static_cast<uint8_t>(i);
+    checkRoundTrip(data, 1000);
+}
+
+TEST_F(CompressedWeightsTests, roundTripOfSmallData) {
+    checkRoundTrip({}, 1024);
+    checkRoundTrip({1, 2, 3}, 1024);
+}
+
+TEST_F(CompressedWeightsTests, plainDataIsNotCompressed) {
+    std::vector<uint8_t> data(1024, 0);
+    ASSERT_FALSE(details::isCompressedWeights(data.data(), data.size()));
+    ASSERT_THROW(details::decompressWeights(data.data(), data.size()), details::InferenceEngineException);
+}
+
+TEST_F(CompressedWeightsTests, throwsOnCorruptedData) {
+    std::vector<uint8_t> data(100000);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i % 251);
+    auto compressed = compress(data, 8192);
+
+    auto truncated = compressed.substr(0, compressed.size() - 10);
+    ASSERT_THROW(details::decompressWeights(truncated.data(), truncated.size()), details::InferenceEngineException);
+}
@@ -147,3 +147,28 @@ TEST_F(CoreThreadingTests, ReadNetwork) {
         (void)ie.ReadNetwork(model.model_xml_str, model.weights_blob);
     }, 100, 12);
 }
+
+// tested function: LoadNetworks
+TEST_F(CoreThreadingTests, LoadNetworksReturnsNothingForNoEntries) {
+    InferenceEngine::Core ie;
+    ASSERT_TRUE(ie.LoadNetworks({}).empty());
+}
+
+// tested function: LoadNetworks
+TEST_F(CoreThreadingTests, LoadNetworksThrowsErrorOfFailedModel) {
+    InferenceEngine::Core ie;
+    std::vector<InferenceEngine::NetworkLoadEntry> entries(16);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        entries[i].modelPath = "not_existing_model_" + std::to_string(i) + ".xml";
+        entries[i].deviceName = "CPU";
+    }
+
+    runParallel([&] () {
+        try {
+            ie.LoadNetworks(entries, 4, 1024);
+            FAIL() << "LoadNetworks must throw for not existing models";
+        } catch (const InferenceEngine::details::InferenceEngineException & ex) {
+            ASSERT_STR_CONTAINS(ex.what(), "Failed to load not_existing_model_");
+        }
+    }, 10, 4);
+}
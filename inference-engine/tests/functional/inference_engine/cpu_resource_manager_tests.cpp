@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_resource_manager.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+IStreamsExecutor::Config MakeConfig(int streams, int threadsPerStream, int priority = 1) {
+    IStreamsExecutor::Config config{"CPUResourceManagerTests", streams, threadsPerStream};
+    config._priority = priority;
+    return config;
+}
+
+}  // namespace
+
+TEST(CPUResourceManagerTests, allStreamsAreAllowedWithoutBudget) {
+    CPUResourceManager manager;
+    bool active = true;
+    auto first = manager.Register(MakeConfig(4, 2), [&] { return active; }, nullptr);
+    auto second = manager.Register(MakeConfig(8, 1), [&] { return active; }, nullptr);
+    ASSERT_EQ(4, first->GetAllowedStreams());
+    ASSERT_EQ(8, second->GetAllowedStreams());
+}
+
+TEST(CPUResourceManagerTests, budgetIsDividedByPriorities) {
+    CPUResourceManager manager;
+    manager.SetBudget(12);
+    auto high = manager.Register(MakeConfig(12, 1, 2), [] { return true; }, nullptr);
+    auto low = manager.Register(MakeConfig(12, 1, 1), [] { return true; }, nullptr);
+    ASSERT_EQ(8, high->GetAllowedStreams());
+    ASSERT_EQ(4, low->GetAllowedStreams());
+}
+
+TEST(CPUResourceManagerTests, unusedPartIsGivenToOthers) {
+    CPUResourceManager manager;
+    manager.SetBudget(12);
+    auto small = manager.Register(MakeConfig(2, 1), [] { return true; }, nullptr);
+    auto large = manager.Register(MakeConfig(6, 2), [] { return true; }, nullptr);
+    ASSERT_EQ(2, small->GetAllowedStreams());
+    ASSERT_EQ(5, large->GetAllowedStreams());
+}
+
+TEST(CPUResourceManagerTests, idleExecutorLendsItsPartAndIsRebalancedWhenActive) {
+    CPUResourceManager manager;
+    manager.SetBudget(8);
+    bool active = false;
+    int changes = 0;
+    auto busy = manager.Register(MakeConfig(8, 1), [] { return true; }, [&] { changes++; });
+    auto idle = manager.Register(MakeConfig(8, 1), [&] { return active; }, nullptr);
+    ASSERT_EQ(8, busy->GetAllowedStreams());
+    ASSERT_EQ(1, idle->GetAllowedStreams());
+
+    active = true;
+    idle->Update();
+    ASSERT_EQ(4, busy->GetAllowedStreams());
+    ASSERT_EQ(4, idle->GetAllowedStreams());
+    ASSERT_EQ(1, changes);
+
+    idle.reset();
+    ASSERT_EQ(8, busy->GetAllowedStreams());
+}
+
+TEST(CPUResourceManagerTests, executorDoesNotRunMoreStreamsThanAllowed) {
+    CPUResourceManager manager;
+    manager.SetBudget(2);
+    auto executor = std::make_shared<CPUStreamsExecutor>(MakeConfig(4, 1), &manager);
+
+    std::atomic<int> running{0}, maxRunning{0};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 16; i++) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&] {
+            auto current = ++running;
+            auto observed = maxRunning.load();
+            while (current > observed && !maxRunning.compare_exchange_weak(observed, current)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            --running;
+        });
+        futures.emplace_back(task->get_future());
+        executor->run([task] { (*task)(); });
+    }
+    for (auto&& future : futures) {
+        future.get();
+    }
+    ASSERT_LE(maxRunning.load(), 2);
+}
@@ -3,12 +3,18 @@
 //
 
 #include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <threading/ie_task_queue_counters.hpp>
 #include <ie_system_conf.h>
+#include <ie_plugin_config.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -211,3 +217,164 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(CPUStreamsExecutorTests, waitingTasksAreExecutedByPriorityAndDeadline) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1,
+                                                          IStreamsExecutor::ThreadBindingType::NONE}};
+    std::promise<void> started;
+    std::promise<void> blocked;
+    auto unblocked = blocked.get_future().share();
+    executor.run([&started, unblocked] {
+        started.set_value();
+        unblocked.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto makeTask = [&] (std::string name) {
+        return [&, name] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    };
+    const auto now = TaskPriority::Clock::now();
+    TaskPriority background;
+    background._priority = -1;
+    TaskPriority urgent;
+    urgent._priority = 1;
+    urgent._deadline = now + std::chrono::seconds{2};
+    TaskPriority urgentEarlier = urgent;
+    urgentEarlier._deadline = now + std::chrono::seconds{1};
+    executor.run(makeTask("default0"));
+    executor.runWithPriority(makeTask("background"), background);
+    executor.runWithPriority(makeTask("urgent"), urgent);
+    executor.runWithPriority(makeTask("urgentEarlier"), urgentEarlier);
+    executor.run(makeTask("default1"));
+
+    std::promise<void> finished;
+    TaskPriority last;
+    last._priority = -2;
+    executor.runWithPriority([&finished] { finished.set_value(); }, last);
+    blocked.set_value();
+    finished.get_future().wait();
+
+    std::vector<std::string> expected = {"urgentEarlier", "urgent", "default0", "default1", "background"};
+    ASSERT_EQ(expected, order);
+}
+
+TEST(CPUStreamsExecutorTests, hybridCoresAreReportedForBothTypesOrNone) {
+    const auto big = getAvailableCores(CPUCoreType::BIG);
+    const auto little = getAvailableCores(CPUCoreType::LITTLE);
+    ASSERT_EQ(big.empty(), little.empty());
+    for (auto&& cores : {big, little}) {
+        for (auto&& core : cores) {
+            ASSERT_FALSE(core.empty());
+        }
+    }
+}
+
+TEST(CPUStreamsExecutorTests, streamsOfLittleCoresHaveOwnNumberOfThreads) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 4, 4, IStreamsExecutor::ThreadBindingType::CORES};
+    config._bigCoreStreams = 1;
+    config._threadsPerLittleCoreStream = 2;
+    ASSERT_EQ(4, config.GetThreadsPerStream(0));
+    ASSERT_EQ(2, config.GetThreadsPerStream(1));
+    ASSERT_EQ(2, config.GetThreadsPerStream(3));
+
+    config._bigCoreStreams = 0;
+    ASSERT_EQ(4, config.GetThreadsPerStream(3));
+
+    CPUStreamsExecutor executor{config};
+    std::promise<void> done;
+    executor.run([&done] { done.set_value(); });
+    done.get_future().wait();
+}
+
+TEST(CPUStreamsExecutorTests, availableCPUsRespectQuota) {
+    const auto available = getNumberOfAvailableCPUs();
+    const auto quota = getCPUQuota();
+    ASSERT_GE(available, 1);
+    ASSERT_LE(available, static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    ASSERT_GE(quota, 0);
+    if (quota > 0) {
+        ASSERT_LE(available, quota);
+        ASSERT_LE(getNumberOfCPUCores(), quota);
+    }
+}
+
+TEST(CPUStreamsExecutorTests, streamsAreDividedBetweenCpuLists) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 8};
+    config.SetConfig(CONFIG_KEY(CPU_STREAMS_CPU_LISTS), "0-15;16-23,28-31");
+    config.SetConfig(CONFIG_KEY(CPU_RESERVED_CPUS), "20,21,22");
+    config.SetConfig(CONFIG_KEY(CPU_BIND_SMT_SIBLINGS), CONFIG_VALUE(NO));
+    ASSERT_EQ(2u, config._streamsCpuLists.size());
+    ASSERT_EQ(12u, config._streamsCpuLists[1].size());
+    ASSERT_EQ(0, config.GetStreamCpuListIndex(3));
+    ASSERT_EQ(1, config.GetStreamCpuListIndex(4));
+    ASSERT_EQ(3, config.GetStreamIndexInCpuList(3));
+    ASSERT_EQ(1, config.GetStreamIndexInCpuList(5));
+    ASSERT_FALSE(config._bindToSmtSiblings);
+
+    ASSERT_EQ("0-15;16-23,28-31", config.GetConfig(CONFIG_KEY(CPU_STREAMS_CPU_LISTS)).as<std::string>());
+    ASSERT_EQ("20-22", config.GetConfig(CONFIG_KEY(CPU_RESERVED_CPUS)).as<std::string>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY(CPU_RESERVED_CPUS), "3-1"), InferenceEngineException);
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY(CPU_STREAMS_CPU_LISTS), "0-3;;4"), InferenceEngineException);
+}
+
+TEST(CPUStreamsExecutorTests, canRunOnCpuListWithoutSiblings) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2};
+    config.SetConfig(CONFIG_KEY(CPU_STREAMS_CPU_LISTS), "0");
+    config.SetConfig(CONFIG_KEY(CPU_BIND_SMT_SIBLINGS), CONFIG_VALUE(NO));
+    config = IStreamsExecutor::Config::MakeDefaultMultiThreaded(config);
+
+    CPUStreamsExecutor executor{config};
+    std::promise<void> done;
+    executor.run([&done] { done.set_value(); });
+    done.get_future().wait();
+}
+
+TEST(TaskQueueCountersTests, waitTimeIncludesWaitingTasks) {
+    TaskQueueCounters counters;
+    counters.Queued(100);
+    counters.Queued(200);
+    counters.Queued(300);
+    counters.Started(250);
+    counters.Stolen();
+
+    TaskExecutorStatistics statistics;
+    counters.Fill(statistics);
+    ASSERT_EQ(3u, statistics._queuedTasks);
+    ASSERT_EQ(1u, statistics._startedTasks);
+    ASSERT_EQ(2u, statistics._queueDepth);
+    ASSERT_EQ(1u, statistics._stolenTasks);
+    // 150us of the started task and the time the two others have waited so far
+    const auto now = TaskQueueCounters::Now();
+    ASSERT_LE(150u + (now - 200) + (now - 300), statistics._waitTime);
+}
+
+TEST(CPUStreamsExecutorTests, statisticsCountExecutedTasks) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2}};
+    std::vector<Task> tasks(8, [] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    executor.runAndWait(tasks);
+
+    const auto statistics = executor.GetStatistics();
+    ASSERT_EQ(8u, statistics._queuedTasks);
+    ASSERT_EQ(8u, statistics._startedTasks);
+    ASSERT_EQ(0u, statistics._queueDepth);
+    ASSERT_EQ(2u, statistics._busyTime.size());
+    ASSERT_EQ(2u, statistics._idleTime.size());
+    ASSERT_GE(statistics._busyTime[0] + statistics._busyTime[1], 8000u);
+}
+
+TEST(ImmediateExecutorTests, statisticsCountExecutedTasks) {
+    ImmediateExecutor executor;
+    executor.run([] {});
+    executor.run([] {});
+
+    const auto statistics = executor.GetStatistics();
+    ASSERT_EQ(2u, statistics._startedTasks);
+    ASSERT_EQ(0u, statistics._queueDepth);
+    ASSERT_EQ(0u, statistics._waitTime);
+    ASSERT_EQ(1u, statistics._busyTime.size());
+}
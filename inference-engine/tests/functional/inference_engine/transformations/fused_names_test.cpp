@@ -0,0 +1,63 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+using namespace testing;
+
+TEST(TransformationTests, FusedNamesMergedInAlphabeticalOrder) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    input->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+    relu->set_friendly_name("relu");
+    auto abs = std::make_shared<ngraph::opset1::Abs>(relu);
+    abs->set_friendly_name("abs");
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{abs}, ngraph::ParameterVector{input});
+    ngraph::pass::InitNodeInfo().run_on_function(f);
+
+    auto fused = std::make_shared<ngraph::opset1::Abs>(input);
+    ngraph::copy_runtime_info({relu, abs}, fused);
+    ASSERT_EQ(ngraph::getFusedNames(fused), "abs,relu");
+
+    // merging a set with itself or with its own parts does not repeat the names
+    auto twice = std::make_shared<ngraph::opset1::Abs>(input);
+    ngraph::copy_runtime_info({fused, relu, fused}, twice);
+    ASSERT_EQ(ngraph::getFusedNamesVector(twice), (std::vector<std::string>{"abs", "relu"}));
+
+    auto copy = std::make_shared<ngraph::opset1::Abs>(input);
+    ngraph::copy_runtime_info(twice, copy);
+    ASSERT_EQ(ngraph::getFusedNames(copy), "abs,relu");
+}
+
+TEST(TransformationTests, FusedNamesOfLongFusionChain) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    std::shared_ptr<ngraph::Node> last = input;
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    for (size_t i = 0; i < 1000; ++i) {
+        last = std::make_shared<ngraph::opset1::Relu>(last);
+        last->set_friendly_name("relu_" + std::to_string(i));
+        nodes.push_back(last);
+    }
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{last}, ngraph::ParameterVector{input});
+    ngraph::pass::InitNodeInfo().run_on_function(f);
+
+    // every step fuses the result of the previous one with the next node
+    auto fused = nodes.front();
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        auto next = std::make_shared<ngraph::opset1::Relu>(input);
+        ngraph::copy_runtime_info({fused, nodes[i], fused}, next);
+        fused = next;
+    }
+    ASSERT_EQ(ngraph::getFusedNamesVector(fused).size(), nodes.size());
+}
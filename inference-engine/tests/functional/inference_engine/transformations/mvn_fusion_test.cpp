@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <transformations/mvn_fusion.hpp>
+#include <transformations/utils/utils.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> makeDecomposedMVN(const ngraph::Shape& shape, const std::vector<int64_t>& axes, bool squareByMultiply) {
+    auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, shape);
+    auto axes_const = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+    auto mean = std::make_shared<ngraph::opset3::ReduceMean>(input, axes_const, true);
+    auto sub = std::make_shared<ngraph::opset3::Subtract>(input, mean);
+
+    std::shared_ptr<ngraph::Node> square;
+    if (squareByMultiply) {
+        square = std::make_shared<ngraph::opset3::Multiply>(sub, sub);
+    } else {
+        auto exponent = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{}, {2.f});
+        square = std::make_shared<ngraph::opset3::Power>(sub, exponent);
+    }
+
+    auto variance = std::make_shared<ngraph::opset3::ReduceMean>(square, axes_const, true);
+    auto eps = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{}, {1e-5f});
+    auto add = std::make_shared<ngraph::opset3::Add>(variance, eps);
+    auto sqrt = std::make_shared<ngraph::opset3::Sqrt>(add);
+    auto div = std::make_shared<ngraph::opset3::Divide>(sub, sqrt);
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{div}, ngraph::ParameterVector{input});
+}
+
+void runMVNFusion(std::shared_ptr<ngraph::Function> f) {
+    ngraph::pass::InitNodeInfo().run_on_function(f);
+    auto callback = [](const std::shared_ptr<const ngraph::Node> & node) -> bool {
+        return std::dynamic_pointer_cast<const ngraph::opset3::MVN>(node) != nullptr;
+    };
+
+    auto mvn_transform = ngraph::pass::MVNFusion();
+    mvn_transform.setCallback(callback);
+    mvn_transform.run_on_function(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+
+}  // namespace
+
+TEST(TransformationTests, MVNFusionLayerNorm) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        f = makeDecomposedMVN(ngraph::Shape{2, 128, 768}, {-1}, false);
+        runMVNFusion(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{2, 128, 768});
+        auto mvn = std::make_shared<ngraph::opset3::MVN>(input, ngraph::AxisSet{2}, true, 1e-5);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{mvn}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto mvn = std::dynamic_pointer_cast<ngraph::opset3::MVN>(f->get_results()[0]->input_value(0).get_node_shared_ptr());
+    ASSERT_NE(nullptr, mvn);
+    ASSERT_EQ(ngraph::AxisSet({2}), mvn->get_reduction_axes());
+    ASSERT_FLOAT_EQ(1e-5f, static_cast<float>(mvn->get_eps()));
+}
+
+TEST(TransformationTests, MVNFusionInstanceNormSquareByMultiply) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        f = makeDecomposedMVN(ngraph::Shape{1, 32, 20, 20}, {2, 3}, true);
+        runMVNFusion(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1, 32, 20, 20});
+        auto mvn = std::make_shared<ngraph::opset3::MVN>(input, ngraph::AxisSet{2, 3}, true, 1e-5);
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{mvn}, ngraph::ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MVNFusionNotAppliedForBatchAxis) {
+    auto f = makeDecomposedMVN(ngraph::Shape{2, 128, 768}, {0}, false);
+    auto f_ref = makeDecomposedMVN(ngraph::Shape{2, 128, 768}, {0}, false);
+    runMVNFusion(f);
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
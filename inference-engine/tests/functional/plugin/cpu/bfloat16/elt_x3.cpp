@@ -33,7 +33,7 @@ protected:
 //            Conv(BF16)   Conv(BF16)  Conv(BF16)
 //                /        |          /
 // ----------------------------------------------
-//    Eltwise(MAX)(FP32)  Eltwise(Mul) (FP32)
+//    Eltwise(MAX)(FP32)  Eltwise(Mul) (BF16)
 //             |            |
 //            Conv(BF16)   Conv(BF16)
 //             \           /
@@ -180,7 +180,7 @@ protected:
         expectedPrecisions["Convolution_2"] = "BF16";
         expectedPrecisions["Convolution_3"] = "BF16";
         expectedPrecisions["Elt_max"] = "FP32";
-        expectedPrecisions["Elt_mul"] = "FP32";
+        expectedPrecisions["Elt_mul"] = "BF16";
         expectedPrecisions["Elt_sum"] = "ndef";
     }
 };
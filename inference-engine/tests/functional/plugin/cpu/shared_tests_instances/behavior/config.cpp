@@ -24,7 +24,22 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "4"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_SOLVER, InferenceEngine::PluginConfigParams::CPU_MEMORY_SOLVER_BEST_FIT}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, "0.8"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_WARMUP, InferenceEngine::PluginConfigParams::WARMUP_MEMORY}},
+            {{InferenceEngine::PluginConfigParams::KEY_WARMUP, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NETWORK_PRIORITY, "2"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SELECTIVE_INT8, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_MAX_QUEUED_INFER_REQUESTS, "4"},
+             {InferenceEngine::PluginConfigParams::KEY_QUEUED_INFER_REQUESTS_POLICY, InferenceEngine::PluginConfigParams::QUEUE_BLOCK}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_WEIGHTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CONVOLUTION_TUNING, "3"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_SPLIT_WEIGHTS_SIZE, "64"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_TILE_SIZE, "512"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LATENCY_CRITICAL, InferenceEngine::PluginConfigParams::YES}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -39,7 +54,11 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, MULTI_CONFIG_VALUE(LATENCY)}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING, InferenceEngine::PluginConfigParams::YES}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -59,7 +78,23 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_SOLVER, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_RATE, "1.5"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_WARMUP, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NETWORK_PRIORITY, "0"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SELECTIVE_INT8, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_EARLY_EXITS, "prob"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_EARLY_EXITS, "prob:high"}},
+            {{InferenceEngine::PluginConfigParams::KEY_MAX_QUEUED_INFER_REQUESTS, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_QUEUED_INFER_REQUESTS_POLICY, "DROP"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_WEIGHTS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_CONVOLUTION_TUNING, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_SPLIT_WEIGHTS_SIZE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_TILE_SIZE, "-1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LATENCY_CRITICAL, "ON"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -68,7 +103,11 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "FASTEST"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_REQUESTS_AUTO_TUNING, "MAYBE"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
@@ -6,6 +6,7 @@
 
 #include "behavior/infer_request.hpp"
 #include "ie_plugin_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 
 using namespace BehaviorTestsDefinitions;
 namespace {
@@ -24,6 +25,11 @@ namespace {
             {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
     };
 
+    const std::vector<std::map<std::string, std::string>> AutoBatchConfigs = {
+            {{ AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+             { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "10"}}
+    };
+
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, InferRequestTests,
                             ::testing::Combine(
                                     ::testing::ValuesIn(netPrecisions),
@@ -37,4 +43,11 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                                     ::testing::ValuesIn(Multiconfigs)),
                             InferRequestTests::getTestCaseName);
+
+    INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, InferRequestTests,
+                            ::testing::Combine(
+                                    ::testing::Values(InferenceEngine::Precision::FP32),
+                                    ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                                    ::testing::ValuesIn(AutoBatchConfigs)),
+                            InferRequestTests::getTestCaseName);
 }  // namespace
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,6 +87,49 @@ TEST_F(RemoteBlob_Test, canInputUserBlob) {
     }
 }
 
+TEST_F(RemoteBlob_Test, canInferOnUserHostBlobs) {
+    CNNNetwork net(fn_ptr);
+
+    net.getInputsInfo().begin()->second->setLayout(Layout::NCHW);
+    net.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+
+    auto ie = InferenceEngine::Core();
+    auto exec_net = ie.LoadNetwork(net, CommonTestUtils::DEVICE_GPU);
+
+    // regular inference
+    auto inf_req_regular = exec_net.CreateInferRequest();
+    auto inputDesc = net.getInputsInfo().begin()->second->getTensorDesc();
+    auto fakeImageData = FuncTestUtils::createAndFillBlob(inputDesc);
+    inf_req_regular.SetBlob(net.getInputsInfo().begin()->first, fakeImageData);
+
+    inf_req_regular.Infer();
+    auto outputBlob_regular = inf_req_regular.GetBlob(net.getOutputsInfo().begin()->first);
+
+    // inference on the user host buffer as an input, and on the host memory allocated by the plugin as an output
+    auto inf_req_shared = exec_net.CreateInferRequest();
+    auto cldnn_context = exec_net.GetContext();
+
+    std::vector<uint8_t> host_memory(fakeImageData->byteSize() + 4096);
+    auto host_ptr = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(host_memory.data()) + 4095) & ~uintptr_t(4095));
+    std::memcpy(host_ptr, fakeImageData->cbuffer().as<const uint8_t*>(), fakeImageData->byteSize());
+
+    ASSERT_THROW(make_shared_host_blob(inputDesc, cldnn_context, host_ptr + 1), InferenceEngine::details::InferenceEngineException);
+    Blob::Ptr shared_input = make_shared_host_blob(inputDesc, cldnn_context, host_ptr);
+    Blob::Ptr shared_output = make_shared_host_blob(net.getOutputsInfo().begin()->second->getTensorDesc(), cldnn_context);
+    inf_req_shared.SetBlob(net.getInputsInfo().begin()->first, shared_input);
+    inf_req_shared.SetBlob(net.getOutputsInfo().begin()->first, shared_output);
+
+    inf_req_shared.Infer();
+
+    // compare results
+    {
+        ASSERT_EQ(net.getOutputsInfo().begin()->second->getPrecision(), InferenceEngine::Precision::FP32);
+        ASSERT_EQ(outputBlob_regular->size(), shared_output->size());
+        auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+        FuncTestUtils::compareBlobs(outputBlob_regular, shared_output, thr);
+    }
+}
+
 TEST_F(RemoteBlob_Test, canInferOnUserContext) {
 #if defined _WIN32
     GTEST_SKIP();
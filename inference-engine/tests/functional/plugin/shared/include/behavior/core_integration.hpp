@@ -425,6 +425,20 @@ TEST(IEClassBasicTest, smoke_SetConfigHeteroNoThrow) {
     ASSERT_FALSE(value);
 }
 
+TEST(IEClassBasicTest, smoke_SetConfigHeteroPartitioningNoThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Core ie;
+    std::string value;
+
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PARTITIONING)).as<std::string>());
+    ASSERT_EQ(HETERO_CONFIG_VALUE(PARTITIONING_PRIORITY), value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PARTITIONING), HETERO_CONFIG_VALUE(PARTITIONING_COST)}},
+                                 CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PARTITIONING)).as<std::string>());
+    ASSERT_EQ(HETERO_CONFIG_VALUE(PARTITIONING_COST), value);
+}
+
 //
 // ImportNetwork
 //
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision_transformations/shuffle_channels_transformation.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include "ngraph_functions/pass/convert_prc.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <transformations/init_node_info.hpp>
+
+namespace LayerTestsDefinitions {
+
+std::string ShuffleChannelsTransformation::getTestCaseName(testing::TestParamInfo<LayerTestsUtils::LayerTransformationParams> obj) {
+    InferenceEngine::Precision netPrecision;
+    InferenceEngine::SizeVector inputShapes;
+    std::string targetDevice;
+    InferenceEngine::details::LayerTransformation::Params params;
+    std::tie(netPrecision, inputShapes, targetDevice, params) = obj.param;
+
+    std::ostringstream result;
+    result << netPrecision.name() << "_" << targetDevice << "_" << toString(params);
+    return result.str();
+}
+
+void ShuffleChannelsTransformation::SetUp() {
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision netPrecision;
+    InferenceEngine::details::LayerTransformation::Params params;
+    std::tie(netPrecision, inputShape, targetDevice, params) = this->GetParam();
+    if (inputShape.size() != 4ul) {
+        THROW_IE_EXCEPTION << "not supported input shape size " << inputShape.size();
+    }
+
+    auto ngPrecision = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+    const auto input = std::make_shared<ngraph::opset3::Parameter>(ngPrecision, ngraph::Shape(inputShape));
+
+    const auto fakeQuantize = ngraph::builder::makeFakeQuantize(input, ngPrecision, 256ul, { 1ul });
+    const auto shuffleChannels = std::make_shared<ngraph::opset3::ShuffleChannels>(fakeQuantize, 1, 4);
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ shuffleChannels }, ngraph::ParameterVector{ input });
+
+    ngraph::pass::InitNodeInfo().run_on_function(function);
+
+    // TODO: move to some another place
+    validate();
+}
+
+void ShuffleChannelsTransformation::validate() {
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision netPrecision;
+    InferenceEngine::details::LayerTransformation::Params params;
+    std::tie(netPrecision, inputShape, targetDevice, params) = this->GetParam();
+
+    const InferenceEngine::CNNNetwork network = transform(params);
+
+    IE_SUPPRESS_DEPRECATED_START
+
+    InferenceEngine::OutputsDataMap outputs = network.getOutputsInfo();
+    EXPECT_EQ(1, outputs.size());
+
+    std::map<std::string, InferenceEngine::DataPtr>::iterator it = outputs.begin();
+    const InferenceEngine::CNNLayerPtr outputLayer = getCreatorLayer(it->second).lock();
+    EXPECT_TRUE(outputLayer != nullptr);
+    EXPECT_EQ("ScaleShift", outputLayer->type);
+
+    EXPECT_EQ(1ul, outputLayer->insData.size());
+    const InferenceEngine::DataPtr insData = outputLayer->insData[0].lock();
+    EXPECT_TRUE(insData != nullptr);
+    const InferenceEngine::CNNLayerPtr shuffleChannels = getCreatorLayer(insData).lock();
+    EXPECT_TRUE(shuffleChannels != nullptr);
+    EXPECT_EQ("ShuffleChannels", shuffleChannels->type);
+
+    if (params.updatePrecisions) {
+        const InferenceEngine::Precision precision = shuffleChannels->outData[0]->getTensorDesc().getPrecision();
+        EXPECT_TRUE((precision == InferenceEngine::Precision::U8) || (precision == InferenceEngine::Precision::I8));
+    }
+
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+TEST_P(ShuffleChannelsTransformation, CompareWithRefImpl) {
+    Run();
+};
+
+}  // namespace LayerTestsDefinitions
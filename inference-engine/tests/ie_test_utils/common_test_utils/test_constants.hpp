@@ -13,6 +13,7 @@ const char DEVICE_FPGA[] = "FPGA";
 const char DEVICE_MYRIAD[] = "MYRIAD";
 const char DEVICE_KEEMBAY[] = "KMB";
 const char DEVICE_MULTI[] = "MULTI";
+const char DEVICE_BATCH[] = "BATCH";
 const char DEVICE_HETERO[] = "HETERO";
 
 #ifdef _WIN32
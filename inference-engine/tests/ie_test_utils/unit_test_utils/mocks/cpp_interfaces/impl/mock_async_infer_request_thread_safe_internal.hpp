@@ -61,4 +61,7 @@ public:
 
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD2(SetPriority_ThreadUnsafe, void(int, int64_t));
+    MOCK_METHOD1(SetStateSession_ThreadUnsafe, void(int64_t));
+    MOCK_METHOD1(ReleaseStateSession_ThreadUnsafe, void(int64_t));
 };
@@ -19,5 +19,6 @@ public:
                  std::shared_ptr<InferRequestInternal>(InputsDataMap networkInputs, OutputsDataMap networkOutputs));
     MOCK_METHOD1(Export, void(const std::string &));
     void Export(std::ostream &) override {}
+    using ExecutableNetworkThreadSafeDefault::InferBatchOnTaskExecutor;
 };
 IE_SUPPRESS_DEPRECATED_END
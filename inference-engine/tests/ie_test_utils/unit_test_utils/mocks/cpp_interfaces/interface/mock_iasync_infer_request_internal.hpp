@@ -26,4 +26,7 @@ public:
     MOCK_CONST_METHOD2(GetPreProcess, void(const char* name, const InferenceEngine::PreProcessInfo**));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
     MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD2(SetPriority, void(int, int64_t));
+    MOCK_METHOD1(SetStateSession, void(int64_t));
+    MOCK_METHOD1(ReleaseStateSession, void(int64_t));
 };
@@ -36,5 +36,6 @@ public:
     MOCK_CONST_METHOD3(GetConfig, void(const std::string &name, Parameter &result, ResponseDesc *resp));
     MOCK_CONST_METHOD3(GetMetric, void(const std::string &name, Parameter &result, ResponseDesc *resp));
     MOCK_CONST_METHOD2(GetContext, void(RemoteContext::Ptr &pContext, ResponseDesc *resp));
+    MOCK_METHOD2(InferBatch, void(const std::vector<BlobMap> &inputs, std::vector<BlobMap> &outputs));
 };
 IE_SUPPRESS_DEPRECATED_END
\ No newline at end of file
@@ -34,4 +34,7 @@ public:
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD4(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, const PreProcessInfo&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(SetPriority, noexcept, StatusCode(int priority, int64_t deadline_us, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetStateSession, noexcept, StatusCode(int64_t session_id, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(ReleaseStateSession, noexcept, StatusCode(int64_t session_id, ResponseDesc*));
 };
@@ -0,0 +1,44 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "utils/hw_counters.h"
+
+using MKLDNNPlugin::HwCounters;
+using MKLDNNPlugin::HwCountersGroup;
+
+TEST(HwCountersTest, ReadsZerosWithoutThreads) {
+    HwCountersGroup group;
+    auto counters = group.read();
+    EXPECT_EQ(0u, group.size());
+    EXPECT_EQ(0u, counters.cycles);
+    EXPECT_EQ(0u, counters.bytesRead);
+}
+
+TEST(HwCountersTest, AttachesThreadOnce) {
+    // the counters may be unavailable, e.g. in containers, then the thread is not counted at all
+    HwCountersGroup group;
+    group.attachCurrentThread();
+    auto size = group.size();
+    group.attachCurrentThread();
+    EXPECT_GE(1u, size);
+    EXPECT_EQ(size, group.size());
+}
+
+TEST(HwCountersTest, SubtractsCounters) {
+    HwCounters start;
+    start.cycles = 10;
+    start.bytesWritten = 64;
+    HwCounters finish = start;
+    HwCounters executed;
+    executed.cycles = 5;
+    executed.bytesWritten = 128;
+    finish += executed;
+
+    auto diff = finish - start;
+    EXPECT_EQ(5u, diff.cycles);
+    EXPECT_EQ(128u, diff.bytesWritten);
+    EXPECT_EQ(0u, diff.instructions);
+}
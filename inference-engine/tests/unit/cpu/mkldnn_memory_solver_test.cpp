@@ -273,3 +273,40 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestFitSolvesUnefficiency) {
+    std::vector<Box> boxes{    // the same boxes as in DISABLED_Unefficiency
+            {6, 7, 3},
+            {2, 5, 2},
+            {5, 8, 2},
+            {2, 3, 2},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.maxDepth(), 5);
+}
+
+TEST(MemSolverTest, BestFitNoOverlapping) {
+    std::vector<Box> boxes;
+    int64_t n = 0;
+    for (int i = 0; i < 64; i++) {
+        int start = (i * 7) % 23;
+        int finish = start + (i * 5) % 9;
+        boxes.push_back({start, finish, 1 + (i * 13) % 17, n++});
+    }
+
+    MKLDNNPlugin::MemorySolver ms(boxes, MKLDNNPlugin::MemorySolver::Strategy::BestFit);
+    auto total = ms.solve();
+    EXPECT_GE(total, ms.maxDepth());
+
+    for (int i = 0; i < n; i++) {
+        EXPECT_LE(ms.getOffset(boxes[i].id) + boxes[i].size, total);
+        for (int j = i + 1; j < n; j++) {
+            auto off1 = ms.getOffset(boxes[i].id);
+            auto off2 = ms.getOffset(boxes[j].id);
+            ASSERT_TRUE(boxes[i].finish < boxes[j].start || boxes[i].start > boxes[j].finish ||
+                        off1 + boxes[i].size <= off2 || off1 >= off2 + boxes[j].size) << "Box overlapping is detected";
+        }
+    }
+}
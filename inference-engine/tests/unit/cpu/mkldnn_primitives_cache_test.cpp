@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "mkldnn_primitives_cache.hpp"
+
+using MKLDNNPlugin::MKLDNNPrimitivesCache;
+using MKLDNNPlugin::MKLDNNCachedPrimitive;
+
+namespace {
+
+MKLDNNCachedPrimitive makePrimitive() {
+    MKLDNNCachedPrimitive primitive;
+    primitive.primitive = std::make_shared<mkldnn::primitive>();
+    return primitive;
+}
+
+}  // namespace
+
+TEST(PrimitivesCacheTest, TakesReturnedPrimitiveOnce) {
+    MKLDNNPrimitivesCache cache(4);
+    auto primitive = makePrimitive();
+    auto expected = primitive.primitive;
+    cache.put("conv", primitive);
+
+    MKLDNNCachedPrimitive taken;
+    ASSERT_TRUE(cache.take("conv", taken));
+    EXPECT_EQ(expected, taken.primitive);
+    EXPECT_FALSE(cache.take("conv", taken));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+
+TEST(PrimitivesCacheTest, KeepsSeveralPrimitivesForTheSameKey) {
+    MKLDNNPrimitivesCache cache(4);
+    cache.put("conv", makePrimitive());
+    cache.put("conv", makePrimitive());
+
+    MKLDNNCachedPrimitive first, second;
+    ASSERT_TRUE(cache.take("conv", first));
+    ASSERT_TRUE(cache.take("conv", second));
+    EXPECT_NE(first.primitive, second.primitive);
+}
+
+TEST(PrimitivesCacheTest, ReleasesLeastRecentlyReturnedPrimitive) {
+    MKLDNNPrimitivesCache cache(2);
+    cache.put("conv1", makePrimitive());
+    cache.put("conv2", makePrimitive());
+    cache.put("conv3", makePrimitive());
+
+    MKLDNNCachedPrimitive taken;
+    EXPECT_FALSE(cache.take("conv1", taken));
+    EXPECT_TRUE(cache.take("conv2", taken));
+    EXPECT_TRUE(cache.take("conv3", taken));
+}
+
+TEST(PrimitivesCacheTest, ZeroCapacityKeepsNothing) {
+    MKLDNNPrimitivesCache cache(0);
+    cache.put("conv", makePrimitive());
+
+    MKLDNNCachedPrimitive taken;
+    EXPECT_FALSE(cache.take("conv", taken));
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <details/ie_exception.hpp>
+
+#include "mkldnn_memory_state.h"
+
+using MKLDNNPlugin::MKLDNNStateSessions;
+
+TEST(MKLDNNStateSessionsTest, CreatesSessionsWithZeroStates) {
+    MKLDNNStateSessions sessions({16, 100});
+    auto& buffers = sessions.Lock(7);
+    ASSERT_EQ(2u, buffers.states.size());
+    ASSERT_EQ(2u, buffers.spares.size());
+    for (size_t i = 0; i < 2; i++) {
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffers.states[i]) % 64);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(buffers.spares[i]) % 64);
+    }
+    auto state = static_cast<uint8_t*>(buffers.states[1]);
+    for (size_t i = 0; i < 100; i++)
+        EXPECT_EQ(0, state[i]);
+    sessions.Unlock(7);
+    EXPECT_EQ(1u, sessions.size());
+}
+
+TEST(MKLDNNStateSessionsTest, KeepsStatesOfSessionsApart) {
+    MKLDNNStateSessions sessions({sizeof(float)});
+    auto& first = sessions.Lock(0);
+    *static_cast<float*>(first.states[0]) = 1.f;
+    sessions.Unlock(0);
+
+    auto& second = sessions.Lock(1);
+    EXPECT_EQ(0.f, *static_cast<float*>(second.states[0]));
+    sessions.Unlock(1);
+
+    EXPECT_EQ(1.f, *static_cast<float*>(sessions.Lock(0).states[0]));
+    sessions.Unlock(0);
+}
+
+TEST(MKLDNNStateSessionsTest, ThrowsIfSessionIsUsedTwice) {
+    MKLDNNStateSessions sessions({4});
+    sessions.Lock(3);
+    EXPECT_THROW(sessions.Lock(3), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(sessions.Release(3), InferenceEngine::details::InferenceEngineException);
+    sessions.Unlock(3);
+    EXPECT_NO_THROW(sessions.Release(3));
+    EXPECT_EQ(0u, sessions.size());
+}
+
+TEST(MKLDNNStateSessionsTest, ReusesReleasedBlocksWithZeroStates) {
+    MKLDNNStateSessions sessions({sizeof(float)});
+    auto& buffers = sessions.Lock(0);
+    void* state = buffers.states[0];
+    void* spare = buffers.spares[0];
+    // an inference exchanges the roles of the buffers
+    std::swap(buffers.states[0], buffers.spares[0]);
+    *static_cast<float*>(buffers.states[0]) = 1.f;
+    sessions.Unlock(0);
+    sessions.Release(0);
+
+    auto& reused = sessions.Lock(1);
+    EXPECT_EQ(spare, reused.states[0]);
+    EXPECT_EQ(state, reused.spares[0]);
+    EXPECT_EQ(0.f, *static_cast<float*>(reused.states[0]));
+    sessions.Unlock(1);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using MKLDNNPlugin::PerfHistogram;
+using MKLDNNPlugin::PerfSampling;
+
+TEST(PerfHistogramTest, PutsTimesToLog2Buckets) {
+    PerfHistogram histogram;
+    for (uint64_t duration : {0, 1, 2, 3, 4, 1000}) {
+        histogram.add(duration);
+    }
+
+    auto values = histogram.get();
+    ASSERT_EQ(2 + PerfHistogram::bucketsNum, values.size());
+    EXPECT_EQ(6u, values[0]);
+    EXPECT_EQ(1010u, values[1]);
+    EXPECT_EQ(1u, values[2 + 0]);
+    EXPECT_EQ(1u, values[2 + 1]);
+    EXPECT_EQ(2u, values[2 + 2]);
+    EXPECT_EQ(1u, values[2 + 3]);
+    // 512 <= 1000 < 1024
+    EXPECT_EQ(1u, values[2 + 10]);
+}
+
+TEST(PerfHistogramTest, PutsLongTimesToLastBucket) {
+    PerfHistogram histogram;
+    histogram.add(UINT64_MAX);
+
+    EXPECT_EQ(1u, histogram.get().back());
+}
+
+TEST(PerfSamplingTest, SharesHistogramOfLayerName) {
+    PerfSampling sampling(10);
+    auto conv = sampling.histogram("conv");
+    EXPECT_EQ(conv, sampling.histogram("conv"));
+    EXPECT_NE(conv, sampling.histogram("relu"));
+
+    conv->add(5);
+    auto histograms = sampling.getHistograms();
+    ASSERT_EQ(2u, histograms.size());
+    EXPECT_EQ(1u, histograms["conv"][0]);
+    EXPECT_EQ(0u, histograms["relu"][0]);
+}
+
+TEST(PerfSamplingTest, ChangesRate) {
+    PerfSampling sampling(0);
+    EXPECT_EQ(0, sampling.getRate());
+    sampling.setRate(100);
+    EXPECT_EQ(100, sampling.getRate());
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <runtime/float_kernels.hpp>
+
+using namespace GNAPluginNS::runtime;
+
+class FloatKernelsTest : public ::testing::Test {
+ protected:
+    // the sizes cover full vectors and the tails of the AVX2 and AVX-512 kernels
+    const std::vector<uint32_t> sizes = {0, 1, 7, 8, 15, 16, 17, 33, 100};
+
+    static std::vector<float> generate(uint32_t n, float scale, float shift) {
+        std::vector<float> data(n);
+        for (uint32_t i = 0; i < n; i++) {
+            data[i] = std::sin(static_cast<float>(i) * scale) * 10.0f + shift;
+        }
+        return data;
+    }
+};
+
+TEST_F(FloatKernelsTest, dotProductMatchesReference) {
+    for (auto n : sizes) {
+        auto a = generate(n, 0.3f, 0.0f);
+        auto b = generate(n, 0.7f, 1.0f);
+        double expected = 0.0;
+        for (uint32_t i = 0; i < n; i++) {
+            expected += static_cast<double>(a[i]) * b[i];
+        }
+        ASSERT_NEAR(expected, GetFloatKernels().dot_product(a.data(), b.data(), n), 1e-3) << "size " << n;
+    }
+}
+
+TEST_F(FloatKernelsTest, multiplyAddMatchesReference) {
+    for (auto n : sizes) {
+        auto a = generate(n, 0.3f, 0.0f);
+        auto x = generate(n, 0.7f, 1.0f);
+        auto y = generate(n, 0.1f, -2.0f);
+        auto expected = y;
+        for (uint32_t i = 0; i < n; i++) {
+            expected[i] += a[i] * x[i];
+        }
+        GetFloatKernels().multiply_add(a.data(), x.data(), y.data(), n);
+        for (uint32_t i = 0; i < n; i++) {
+            ASSERT_NEAR(expected[i], y[i], 1e-4) << "size " << n << " element " << i;
+        }
+    }
+}
+
+TEST_F(FloatKernelsTest, reluAndClampAreExact) {
+    for (auto n : sizes) {
+        auto in = generate(n, 0.5f, 0.0f);
+        if (n > 2) {
+            in[2] = std::numeric_limits<float>::quiet_NaN();
+        }
+        std::vector<float> relu(n), clamp(n);
+        GetFloatKernels().relu(in.data(), relu.data(), n, 0.25f);
+        GetFloatKernels().clamp(in.data(), clamp.data(), n, -5.0f, 5.0f);
+        for (uint32_t i = 0; i < n; i++) {
+            if (std::isnan(in[i])) {
+                ASSERT_TRUE(std::isnan(relu[i]));
+                ASSERT_TRUE(std::isnan(clamp[i]));
+                continue;
+            }
+            ASSERT_EQ(in[i] < 0.0f ? in[i] * 0.25f : in[i], relu[i]);
+            ASSERT_EQ(in[i] > 5.0f ? 5.0f : (in[i] < -5.0f ? -5.0f : in[i]), clamp[i]);
+        }
+    }
+}
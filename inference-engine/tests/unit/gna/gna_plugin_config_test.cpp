@@ -22,6 +22,7 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
+    {GNA_CONFIG_KEY(UNROLL_FRAMES), CONFIG_VALUE(NO)},
     {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
 };
 
@@ -158,6 +159,11 @@ TEST_F(GNAPluginConfigTest, GnaConfigPerfCountTest) {
                     config.gnaFlags.performance_counting);
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigUnrollFramesTest) {
+    SetAndCheckFlag(GNA_CONFIG_KEY(UNROLL_FRAMES),
+                    config.gnaFlags.unroll_frames);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     SetAndCompare(GNA_CONFIG_KEY(LIB_N_THREADS), "2");
     EXPECT_EQ(config.gnaFlags.gna_lib_async_threads_num, 2);
@@ -142,3 +142,26 @@ TEST_F(ExecutableNetworkThreadSafeTests, returnErrorIfStartAsyncThrowsException)
     ASSERT_EQ(StatusCode::GENERAL_ERROR, sts) << dsc.msg;
 }
 
+
+TEST_F(ExecutableNetworkThreadSafeTests, inferBatchInfersEverySetThroughAsyncPipeline) {
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _)).WillOnce(Return(mockInferRequestInternal));
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(3);
+    std::vector<BlobMap> outputs;
+    ASSERT_EQ(StatusCode::OK, exeNetwork->InferBatch(std::vector<BlobMap>(3), outputs, &dsc)) << dsc.msg;
+    ASSERT_EQ(3, outputs.size());
+}
+
+TEST_F(ExecutableNetworkThreadSafeTests, inferBatchOnTaskExecutorInfersEverySetOnOneRequest) {
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _)).WillOnce(Return(mockInferRequestInternal));
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(5);
+    std::vector<BlobMap> outputs;
+    ASSERT_NO_THROW(mockExeNetwork->InferBatchOnTaskExecutor(std::vector<BlobMap>(5), outputs, 1));
+    ASSERT_EQ(5, outputs.size());
+}
+
+TEST_F(ExecutableNetworkThreadSafeTests, inferBatchOnTaskExecutorStopsOnError) {
+    EXPECT_CALL(*mockExeNetwork.get(), CreateInferRequestImpl(_, _)).WillOnce(Return(mockInferRequestInternal));
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::runtime_error("")));
+    std::vector<BlobMap> outputs;
+    ASSERT_THROW(mockExeNetwork->InferBatchOnTaskExecutor(std::vector<BlobMap>(5), outputs, 1), std::runtime_error);
+}
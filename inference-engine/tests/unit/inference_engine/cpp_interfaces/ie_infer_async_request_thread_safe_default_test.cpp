@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -261,6 +264,51 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, rejectsInferencesOverAdmissionLimit) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto admissionControl = std::make_shared<AdmissionControl>(1, AdmissionControl::Policy::Reject);
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->SetAdmissionControl(admissionControl);
+    auto otherRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                            taskExecutor);
+    otherRequest->SetAdmissionControl(admissionControl);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2).WillRepeatedly(Return());
+
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([&] { otherRequest->StartAsync(); }, REQUEST_BUSY_str));
+    // the rejected request stays free and is not started
+    ASSERT_EQ(StatusCode::INFER_NOT_STARTED, otherRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(otherRequest->StartAsync());
+    taskExecutor->executeAll();
+
+    auto statistics = admissionControl->GetStatistics();
+    ASSERT_EQ(2, statistics["admitted_requests"]);
+    ASSERT_EQ(1, statistics["rejected_requests"]);
+    ASSERT_EQ(0, statistics["pending_requests"]);
+}
+
+TEST(AdmissionControlTests, blocksAdmissionUntilRelease) {
+    AdmissionControl admissionControl(1, AdmissionControl::Policy::Block);
+    admissionControl.Admit();
+    std::atomic<bool> admitted{false};
+    std::thread thread([&] {
+        admissionControl.Admit();
+        admitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_FALSE(admitted);
+    admissionControl.Release();
+    thread.join();
+    ASSERT_TRUE(admitted);
+    admissionControl.Release();
+
+    auto statistics = admissionControl.GetStatistics();
+    ASSERT_EQ(2, statistics["admitted_requests"]);
+    ASSERT_EQ(1, statistics["blocked_requests"]);
+    ASSERT_EQ(0, statistics["pending_requests"]);
+}
+
 
 class AsyncInferRequestThreadSafeInternalTests : public ::testing::Test {
 protected:
@@ -425,3 +425,50 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+class BatchedBlobTests : public CompoundBlobTests {};
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromROIBlobsOfOneImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 40, 60}, NHWC));
+    image->allocate();
+    BlobPtrs rois = {make_shared_blob(image, {0, 0, 0, 10, 20}),
+                     make_shared_blob(image, {0, 20, 10, 30, 25})};
+
+    Blob::Ptr batched;
+    ASSERT_NO_THROW(batched = make_shared_blob<BatchedBlob>(rois));
+    verifyCompoundBlob(batched, rois);
+    EXPECT_EQ(SizeVector({2, 3, 20, 10}), batched->getTensorDesc().getDims());
+    EXPECT_EQ(Precision::U8, batched->getTensorDesc().getPrecision());
+    EXPECT_EQ(NHWC, batched->getTensorDesc().getLayout());
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromNV12Blobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    BlobPtrs images = {make_shared_blob<NV12Blob>(y_blob, uv_blob), make_shared_blob<NV12Blob>(y_blob, uv_blob)};
+
+    Blob::Ptr batched;
+    ASSERT_NO_THROW(batched = make_shared_blob<BatchedBlob>(images));
+    verifyCompoundBlob(batched, images);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromEmptyVectorOrNullptrBlobs) {
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs()), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs({nullptr})), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromImagesWithBatch) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 4, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs({image})), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromImagesOfDifferentKinds) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12 = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    Blob::Ptr u8 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    Blob::Ptr fp32 = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 4, 4}, NHWC));
+
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs({nv12, u8})), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs({u8, fp32})), InferenceEngine::details::InferenceEngineException);
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ie_data_hash.hpp>
+
+using namespace InferenceEngine;
+
+TEST(DataHashTests, smallDataMatchesXXH64) {
+    const std::string abc = "abc";
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, computeDataHash(abc.data(), 0));
+    EXPECT_EQ(0x44BC2CF5AD770999ULL, computeDataHash(abc.data(), abc.size()));
+}
+
+TEST(DataHashTests, seedChangesHash) {
+    const std::string data = "weights";
+    EXPECT_NE(computeDataHash(data.data(), data.size(), 0), computeDataHash(data.data(), data.size(), 1));
+}
+
+TEST(DataHashTests, largeDataHashIsStable) {
+    // several chunks and a partial one
+    std::vector<uint8_t> data((5 << 20) + 123);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 12));
+    }
+    const auto hash = computeDataHash(data.data(), data.size());
+    EXPECT_EQ(hash, computeDataHash(data.data(), data.size()));
+
+    data[3 << 20] ^= 1;
+    EXPECT_NE(hash, computeDataHash(data.data(), data.size()));
+    data[3 << 20] ^= 1;
+    data.back() ^= 1;
+    EXPECT_NE(hash, computeDataHash(data.data(), data.size()));
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include <unistd.h>
+
+#include <ie_dmabuf_blob.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class DmaBufBlobTests : public ::testing::Test {
+protected:
+    // a regular file can be mapped the same way as a DMA-BUF object
+    void SetUp() override {
+        _file = std::tmpfile();
+        ASSERT_NE(nullptr, _file);
+        _data.resize(_size);
+        for (size_t i = 0; i < _size; ++i) {
+            _data[i] = static_cast<uint8_t>(i);
+        }
+        ASSERT_EQ(_size, std::fwrite(_data.data(), 1, _size, _file));
+        ASSERT_EQ(0, std::fflush(_file));
+    }
+
+    void TearDown() override {
+        if (_file != nullptr) std::fclose(_file);
+    }
+
+    int fd() const {
+        return fileno(_file);
+    }
+
+    const size_t _height = 4, _width = 6, _pitch = 8;
+    const size_t _size = 64;
+    std::FILE* _file = nullptr;
+    std::vector<uint8_t> _data;
+};
+
+TEST_F(DmaBufBlobTests, canReadPlanesInPlace) {
+    const DmaBufPlane y{0, _pitch};
+    const DmaBufPlane uv{_pitch * _height, _pitch};
+    auto blob = make_shared_blob_nv12(_height, _width, fd(), _size, y, uv);
+    ASSERT_NE(nullptr, blob);
+
+    const auto& yDesc = blob->y()->getTensorDesc();
+    EXPECT_EQ(Layout::NHWC, yDesc.getLayout());
+    EXPECT_EQ(SizeVector({1, 1, _height, _width}), yDesc.getDims());
+    EXPECT_EQ(_pitch, yDesc.getBlockingDesc().getStrides()[1]);
+    EXPECT_EQ(SizeVector({1, 2, _height / 2, _width / 2}), blob->uv()->getTensorDesc().getDims());
+
+    auto yData = blob->y()->as<MemoryBlob>()->rmap().as<const uint8_t*>();
+    auto uvData = blob->uv()->as<MemoryBlob>()->rmap().as<const uint8_t*>();
+    ASSERT_NE(nullptr, yData);
+    ASSERT_NE(nullptr, uvData);
+    EXPECT_EQ(_data[_pitch + 1], yData[_pitch + 1]);
+    EXPECT_EQ(_data[uv.offset + _pitch + 3], uvData[_pitch + 3]);
+}
+
+TEST_F(DmaBufBlobTests, blobOutlivesDescriptor) {
+    int copy = ::dup(fd());
+    ASSERT_NE(-1, copy);
+    auto blob = make_shared_blob_nv12(_height, _width, copy, _size, {0, _pitch}, {_pitch * _height, _pitch});
+    ::close(copy);
+
+    auto yData = blob->y()->as<MemoryBlob>()->rmap().as<const uint8_t*>();
+    ASSERT_NE(nullptr, yData);
+    EXPECT_EQ(_data[_width - 1], yData[_width - 1]);
+}
+
+TEST_F(DmaBufBlobTests, cannotCreateBlobWithPlanesOutOfObject) {
+    EXPECT_THROW(make_shared_blob_nv12(_height, _width, fd(), _size, {0, _pitch}, {_size - _pitch, _pitch}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob_nv12(_height, _width, fd(), _size, {0, _width - 1}, {_pitch * _height, _pitch}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(DmaBufBlobTests, cannotCreateBlobOfOddSize) {
+    EXPECT_THROW(make_shared_blob_nv12(_height - 1, _width, fd(), _size, {0, _pitch}, {_pitch * _height, _pitch}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+#endif  // __linux__
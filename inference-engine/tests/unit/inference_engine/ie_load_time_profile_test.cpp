@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_load_time_profile.hpp>
+
+#include <memory>
+#include <thread>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(LoadTimeProfileTests, phasesAreNotRecordedWithoutProfile) {
+    ASSERT_EQ(nullptr, LoadTimeProfile::GetCurrent());
+    { IE_LOAD_PHASE("skipped"); }
+    ASSERT_TRUE(LoadTimeProfile::GetCurrentPhase().empty());
+}
+
+TEST(LoadTimeProfileTests, nestedPhasesAreNamedAfterParents) {
+    auto profile = std::make_shared<LoadTimeProfile>();
+    {
+        LoadTimeProfile::Scope scope(profile);
+        IE_LOAD_PHASE("load");
+        {
+            IE_LOAD_PHASE("compile");
+            ASSERT_EQ("load/compile", LoadTimeProfile::GetCurrentPhase());
+        }
+        { IE_LOAD_PHASE("compile"); }
+    }
+    ASSERT_EQ(nullptr, LoadTimeProfile::GetCurrent());
+
+    auto phases = profile->GetPhases();
+    ASSERT_EQ(2, phases.size());
+    ASSERT_EQ(1, phases.count("load"));
+    ASSERT_EQ(1, phases.count("load/compile"));
+    ASSERT_GE(phases.at("load"), phases.at("load/compile"));
+}
+
+TEST(LoadTimeProfileTests, phasesOfOtherThreadsAreNestedInGivenPhase) {
+    auto profile = std::make_shared<LoadTimeProfile>();
+    {
+        LoadTimeProfile::Scope scope(profile);
+        IE_LOAD_PHASE("graphs");
+        auto phase = LoadTimeProfile::GetCurrentPhase();
+        std::thread worker([&] {
+            LoadTimeProfile::Scope workerScope(profile, phase);
+            IE_LOAD_PHASE("graph");
+        });
+        worker.join();
+    }
+    ASSERT_EQ(1, profile->GetPhases().count("graphs/graph"));
+}
+
+TEST(LoadTimeProfileTests, peakMemoryIsStored) {
+    LoadTimeProfile profile;
+    ASSERT_EQ(0, profile.GetPeakMemory());
+    profile.SetPeakMemory(1024);
+    ASSERT_EQ(1024, profile.GetPeakMemory());
+}
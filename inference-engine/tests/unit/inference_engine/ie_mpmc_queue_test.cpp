@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <threading/ie_mpmc_queue.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(BoundedMPMCQueueTests, capacityIsRoundedUpToPowerOfTwo) {
+    BoundedMPMCQueue<int> queue{5};
+    ASSERT_EQ(8, queue.capacity());
+}
+
+TEST(BoundedMPMCQueueTests, keepsFifoOrderAndFailsWhenFull) {
+    BoundedMPMCQueue<int> queue{4};
+    ASSERT_TRUE(queue.empty());
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(BoundedMPMCQueueTests, deliversEveryValueOnceWithConcurrentProducersAndConsumers) {
+    constexpr int numThreads = 4;
+    constexpr int numValuesPerThread = 10000;
+    BoundedMPMCQueue<int> queue{64};
+    std::vector<std::atomic<int>> received(numThreads * numValuesPerThread);
+    std::atomic<int> numReceived{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < numValuesPerThread; ++i) {
+                while (!queue.try_push(t * numValuesPerThread + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            int value = 0;
+            while (numReceived.load() < numThreads * numValuesPerThread) {
+                if (queue.try_pop(value)) {
+                    ++received[value];
+                    ++numReceived;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    for (auto&& value : received) {
+        ASSERT_EQ(1, value.load());
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_network_intensity.hpp>
+#include <threading/ie_istreams_executor.hpp>
+
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> MakeConvolution(const ngraph::PartialShape& shape) {
+    auto parameter = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3},
+                                                    std::vector<float>(4 * 3 * 3 * 3, 1.f));
+    auto convolution = std::make_shared<ngraph::opset1::Convolution>(parameter, weights,
+        ngraph::Strides{1, 1}, ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(convolution);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{parameter});
+}
+
+}  // namespace
+
+TEST(NetworkIntensityTests, countsMultiplyAddsAndBytes) {
+    auto intensity = getNetworkIntensity(*MakeConvolution(ngraph::Shape{1, 3, 8, 8}));
+
+    // the convolution has 1x4x6x6 outputs reduced over 3x3x3 weights, the relu one operation per output
+    ASSERT_DOUBLE_EQ(2 * 144 * 27 + 144, intensity.flops);
+    // the convolution reads the input and the weights and writes the output, the relu reads and writes 144 floats
+    const size_t convolutionBytes = (192 + 108 + 144) * sizeof(float);
+    ASSERT_DOUBLE_EQ(static_cast<double>(convolutionBytes + 2 * 144 * sizeof(float)), intensity.bytes);
+    ASSERT_EQ(convolutionBytes, intensity.maxWorkingSet);
+    ASSERT_GT(intensity.FlopsPerByte(), 0);
+}
+
+TEST(NetworkIntensityTests, skipsDynamicShapes) {
+    auto function = MakeConvolution(ngraph::PartialShape{ngraph::Dimension::dynamic(), 3, 8, 8});
+    auto intensity = getNetworkIntensity(*function);
+
+    ASSERT_EQ(0, intensity.flops);
+    ASSERT_EQ(0, intensity.FlopsPerByte());
+}
+
+TEST(NetworkIntensityTests, memoryBoundNetworkGetsFewerStreams) {
+    NetworkIntensity computeBound;
+    computeBound.flops = 64.0 * 1024 * 1024;
+    computeBound.bytes = 1024 * 1024;
+    computeBound.maxWorkingSet = 1024 * 1024;
+    NetworkIntensity memoryBound = computeBound;
+    memoryBound.flops = 1024 * 1024;
+
+    const size_t cacheSize = 1024 * 1024;
+    const auto computeBoundStreams = IStreamsExecutor::Config::GetModelAwareStreams(computeBound, cacheSize);
+    const auto memoryBoundStreams = IStreamsExecutor::Config::GetModelAwareStreams(memoryBound, cacheSize);
+    ASSERT_GE(memoryBoundStreams, 1);
+    ASSERT_LE(memoryBoundStreams, computeBoundStreams);
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_tracing.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class TracingTests : public ::testing::Test {
+protected:
+    const std::string traceFile = "ie_tracing_test.json";
+
+    std::string ReadTrace() const {
+        std::ifstream file{traceFile};
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    void TearDown() override {
+        tracing::Stop();
+        std::remove(traceFile.c_str());
+    }
+};
+
+TEST_F(TracingTests, eventsAreNotRecordedWhenDisabled) {
+    ASSERT_FALSE(tracing::IsEnabled());
+    { IE_TRACE_SCOPE("layer", "skipped"); }
+    tracing::Start(traceFile);
+    tracing::Stop();
+    ASSERT_EQ(std::string::npos, ReadTrace().find("skipped"));
+}
+
+TEST_F(TracingTests, recordsScopesAndAsyncEvents) {
+    tracing::Start(traceFile);
+    ASSERT_TRUE(tracing::IsEnabled());
+    ASSERT_EQ(traceFile, tracing::GetFilePath());
+    { IE_TRACE_SCOPE("layer", "conv\"1"); }
+    auto now = tracing::Clock::now();
+    tracing::AddAsyncEvent("request", "infer", 42, now, now, R"({"request":42})");
+    tracing::Stop();
+    ASSERT_FALSE(tracing::IsEnabled());
+
+    auto trace = ReadTrace();
+    ASSERT_EQ('[', trace.front());
+    ASSERT_NE(std::string::npos, trace.find(R"("name":"conv\"1","cat":"layer","ph":"X")"));
+    ASSERT_NE(std::string::npos, trace.find(R"("name":"infer","cat":"request","ph":"b")"));
+    ASSERT_NE(std::string::npos, trace.find(R"("name":"infer","cat":"request","ph":"e")"));
+    ASSERT_NE(std::string::npos, trace.find("]"));
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_transformations_cache.hpp>
+
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> MakeFunction() {
+    auto parameter = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    parameter->set_friendly_name("data");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(parameter);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{parameter});
+}
+
+}  // namespace
+
+TEST(TransformationsCacheTests, functionIsTransformedOnce) {
+    TransformationsCache cache;
+    auto function = MakeFunction();
+    size_t calls = 0;
+    auto transform = [&] {
+        calls++;
+        return std::shared_ptr<const ngraph::Function>(MakeFunction());
+    };
+
+    auto first = cache.Get(function, transform);
+    auto second = cache.Get(function, transform);
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(first, second);
+
+    cache.Get(MakeFunction(), transform);
+    ASSERT_EQ(2, calls);
+}
+
+TEST(TransformationsCacheTests, reshapedFunctionIsTransformedAgain) {
+    TransformationsCache cache;
+    auto function = MakeFunction();
+    size_t calls = 0;
+    auto transform = [&] {
+        calls++;
+        return std::shared_ptr<const ngraph::Function>(MakeFunction());
+    };
+
+    auto first = cache.Get(function, transform);
+    function->get_parameters()[0]->set_partial_shape(ngraph::PartialShape{2, 3, 16, 16});
+    function->validate_nodes_and_infer_types();
+    auto second = cache.Get(function, transform);
+    ASSERT_EQ(2, calls);
+    ASSERT_NE(first, second);
+
+    cache.Get(function, transform);
+    ASSERT_EQ(2, calls);
+}
+
+TEST(TransformationsCacheTests, resultIsDroppedWithOriginalFunction) {
+    TransformationsCache cache;
+    std::weak_ptr<const ngraph::Function> transformed;
+    {
+        auto function = MakeFunction();
+        transformed = cache.Get(function, [] {
+            return std::shared_ptr<const ngraph::Function>(MakeFunction());
+        });
+    }
+    cache.Get(MakeFunction(), [] {
+        return std::shared_ptr<const ngraph::Function>(MakeFunction());
+    });
+    ASSERT_TRUE(transformed.expired());
+}
@@ -7,6 +7,8 @@
 
 #include "common_test_utils/test_common.hpp"
 
+#include <ie_blob.h>
+
 #include "system_allocator.hpp"
 
 class SystemAllocatorReleaseTests : public CommonTestUtils::TestsCommon {
@@ -66,4 +68,61 @@ TEST_F(SystemAllocatorTests, canLockAndUnlockAllocatedMemory) {
     EXPECT_EQ(ptr[9999], 11);
     allocator->unlock(ptr);
     allocator->free(handle);
-}
\ No newline at end of file
+}
+namespace {
+
+std::shared_ptr<InferenceEngine::IAllocator> createPooledAllocator(size_t capacity) {
+    return InferenceEngine::details::shared_from_irelease(
+        InferenceEngine::CreatePooledAllocator(std::make_shared<SystemMemoryAllocator>(), capacity));
+}
+
+}  // namespace
+
+TEST(PooledAllocatorTests, reusesFreedMemoryOfSameSize) {
+    auto allocator = createPooledAllocator(1000);
+    void *handle = allocator->alloc(100);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_TRUE(allocator->free(handle));
+    EXPECT_EQ(handle, allocator->alloc(100));
+
+    void *other = allocator->alloc(200);
+    EXPECT_NE(other, handle);
+    EXPECT_TRUE(allocator->free(other));
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST(PooledAllocatorTests, doesNotKeepMoreThanCapacity) {
+    auto allocator = createPooledAllocator(150);
+    void *first = allocator->alloc(100);
+    void *second = allocator->alloc(100);
+    EXPECT_TRUE(allocator->free(first));
+    EXPECT_TRUE(allocator->free(second));
+    EXPECT_EQ(first, allocator->alloc(100));
+    void *third = allocator->alloc(100);
+    EXPECT_NE(first, third);
+    EXPECT_TRUE(allocator->free(first));
+    EXPECT_TRUE(allocator->free(third));
+}
+
+TEST(PooledAllocatorTests, doesNotFreeForeignHandle) {
+    auto allocator = createPooledAllocator(1000);
+    char foreign = 0;
+    EXPECT_TRUE(allocator->free(nullptr));
+    EXPECT_FALSE(allocator->free(&foreign));
+}
+
+TEST(PooledAllocatorTests, blobsUseDefaultAllocator) {
+    auto allocator = createPooledAllocator(1000);
+    InferenceEngine::SetDefaultAllocator(allocator);
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 25}, InferenceEngine::Layout::NC);
+    void *data = nullptr;
+    {
+        auto blob = InferenceEngine::make_shared_blob<float>(desc);
+        blob->allocate();
+        data = blob->buffer();
+    }
+    auto blob = InferenceEngine::make_shared_blob<float>(desc);
+    blob->allocate();
+    InferenceEngine::SetDefaultAllocator(nullptr);
+    EXPECT_EQ(data, blob->buffer().as<void*>());
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <thread>
+
+namespace vpu {
+
+class CompileEnvTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+};
+
+TEST_F(CompileEnvTests, ScopeSharesEnvironmentWithWorkerThread) {
+    const auto& env = CompileEnv::get();
+
+    const CompileEnv* inScope = nullptr;
+    const CompileEnv* afterScope = &env;
+    std::thread worker([&] {
+        {
+            CompileEnv::Scope scope(env);
+            inScope = &CompileEnv::get();
+        }
+        afterScope = CompileEnv::getOrNull();
+    });
+    worker.join();
+
+    ASSERT_EQ(&env, inScope);
+    ASSERT_EQ(nullptr, afterScope);
+    ASSERT_EQ(&env, &CompileEnv::get());
+}
+
+TEST_F(CompileEnvTests, ScopeRestoresEnvironmentOfCurrentThread) {
+    const auto& env = CompileEnv::get();
+    {
+        CompileEnv::Scope scope(env);
+        ASSERT_EQ(&env, &CompileEnv::get());
+    }
+    ASSERT_EQ(&env, &CompileEnv::get());
+}
+
+}  // namespace vpu
@@ -0,0 +1,56 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <precision_utils.h>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+class AllocatorTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _model = CreateModel();
+    }
+
+    Data constData(const std::string& name, float value) {
+        const auto generator = [value](const ie::Blob::Ptr& blob) {
+            auto ptr = blob->buffer().as<fp16_t*>();
+            std::fill(ptr, ptr + kSize, ie::PrecisionUtils::f32tof16(value));
+        };
+        return _model->addConstData(name, DataDesc({kSize}), generator);
+    }
+
+protected:
+    static constexpr int kSize = 100;
+
+    Model _model;
+};
+
+constexpr int AllocatorTests::kSize;
+
+TEST_F(AllocatorTests, ConstDataWithEqualContentShareBlobMemory) {
+    const auto weights1 = constData("weights1", 1.0f);
+    const auto weights2 = constData("weights2", 1.0f);
+    const auto biases = constData("biases", 2.0f);
+
+    auto& allocator = _model->getAllocator();
+    ASSERT_TRUE(allocator.allocateData(weights1));
+    ASSERT_TRUE(allocator.allocateData(biases));
+    ASSERT_TRUE(allocator.allocateData(weights2));
+
+    ASSERT_EQ(weights1->dataLocation().location, Location::Blob);
+    ASSERT_EQ(weights2->dataLocation().location, Location::Blob);
+    ASSERT_EQ(weights1->dataLocation().offset, weights2->dataLocation().offset);
+    ASSERT_NE(weights1->dataLocation().offset, biases->dataLocation().offset);
+
+    ASSERT_EQ(allocator.usedMemoryAmount().blob, 2 * calcAllocationSize(weights1));
+}
+
+}  // namespace vpu
@@ -0,0 +1,119 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <precision_utils.h>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+class MergePostOpChainsTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+
+        _model = CreateModel();
+        _input = _model->addInputData("input", _desc);
+        _output = _model->addOutputData("output", _desc);
+    }
+
+    Data intermediate(const std::string& name) {
+        return _model->addNewData(name, _desc);
+    }
+
+    Data channelConst(const std::string& name, float value) {
+        const auto generator = [value](const ie::Blob::Ptr& blob) {
+            auto ptr = blob->buffer().as<fp16_t*>();
+            std::fill(ptr, ptr + kChannels, ie::PrecisionUtils::f32tof16(value));
+        };
+        return _model->addConstData(name, DataDesc({kChannels}), generator);
+    }
+
+    StageVector runPass() {
+        passManager->mergePostOpChains()->run(_model);
+
+        StageVector stages;
+        for (const auto& stage : _model->getStages()) {
+            stages.push_back(stage);
+        }
+        return stages;
+    }
+
+protected:
+    static constexpr int kChannels = 3;
+
+    const DataDesc _desc = DataDesc({8, 8, kChannels, 1});
+    Model _model;
+    Data _input;
+    Data _output;
+};
+
+constexpr int MergePostOpChainsTests::kChannels;
+
+TEST_F(MergePostOpChainsTests, LinearPowerChainIsMergedIntoOnePower) {
+    auto data1 = intermediate("data1");
+    auto data2 = intermediate("data2");
+    stageBuilder->addPowerStage(_model, "power1", nullptr, 2.0f, 1.0f, 1.0f, _input, data1);
+    stageBuilder->addPowerStage(_model, "power2", nullptr, 3.0f, 1.0f, -1.0f, data1, data2);
+    stageBuilder->addPowerStage(_model, "power3", nullptr, 0.5f, 1.0f, 0.0f, data2, _output);
+
+    const auto stages = runPass();
+
+    ASSERT_EQ(stages.size(), 1);
+    const auto& power = stages.front();
+    ASSERT_EQ(power->type(), StageType::Power);
+    ASSERT_EQ(power->input(0), _input);
+    ASSERT_EQ(power->output(0), _output);
+    // 0.5 * (3 * (2 * x + 1) - 1) = 3 * x + 1
+    ASSERT_FLOAT_EQ(power->attrs().get<float>("scale"), 3.0f);
+    ASSERT_FLOAT_EQ(power->attrs().get<float>("bias"), 1.0f);
+}
+
+TEST_F(MergePostOpChainsTests, ScaleAndBiasAreMergedIntoScaleShift) {
+    auto data = intermediate("data");
+    stageBuilder->addScaleStage(_model, "scale", nullptr, _input, channelConst("scales", 2.0f), data);
+    stageBuilder->addBiasStage(_model, "bias", nullptr, data, channelConst("biases", 0.5f), _output);
+
+    const auto stages = runPass();
+
+    ASSERT_EQ(stages.size(), 1);
+    const auto& scaleShift = stages.front();
+    ASSERT_EQ(scaleShift->type(), StageType::ScaleShift);
+
+    const auto scales = scaleShift->input(1)->content()->get<fp16_t>();
+    const auto biases = scaleShift->input(2)->content()->get<fp16_t>();
+    for (int c = 0; c < kChannels; ++c) {
+        ASSERT_FLOAT_EQ(ie::PrecisionUtils::f16tof32(scales[c]), 2.0f);
+        ASSERT_FLOAT_EQ(ie::PrecisionUtils::f16tof32(biases[c]), 0.5f);
+    }
+}
+
+TEST_F(MergePostOpChainsTests, ReLUAndClampsAreMergedIntoOneClamp) {
+    auto data1 = intermediate("data1");
+    auto data2 = intermediate("data2");
+    stageBuilder->addReLUStage(_model, "relu", nullptr, 0.0f, _input, data1);
+    stageBuilder->addClampStage(_model, "clamp1", nullptr, -1.0f, 6.0f, data1, data2);
+    stageBuilder->addClampStage(_model, "clamp2", nullptr, 1.0f, 8.0f, data2, _output);
+
+    const auto stages = runPass();
+
+    ASSERT_EQ(stages.size(), 1);
+    const auto& clamp = stages.front();
+    ASSERT_EQ(clamp->type(), StageType::Clamp);
+    ASSERT_FLOAT_EQ(clamp->attrs().get<float>("min_value"), 1.0f);
+    ASSERT_FLOAT_EQ(clamp->attrs().get<float>("max_value"), 6.0f);
+}
+
+TEST_F(MergePostOpChainsTests, NonLinearPowerIsNotMerged) {
+    auto data = intermediate("data");
+    stageBuilder->addPowerStage(_model, "power1", nullptr, 2.0f, 2.0f, 0.0f, _input, data);
+    stageBuilder->addPowerStage(_model, "power2", nullptr, 3.0f, 1.0f, 0.0f, data, _output);
+
+    ASSERT_EQ(runPass().size(), 2);
+}
+
+}  // namespace vpu
@@ -9,6 +9,7 @@
 #include "ie_preprocess.hpp"
 #include "ie_preprocess_data.hpp"
 #include "ie_compound_blob.h"
+#include "ie_system_conf.h"
 
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
@@ -32,6 +33,20 @@
 
 namespace {
 #if PERF_TEST
+// the widest instruction set the preprocessing kernels are dispatched to on this machine,
+// printed with the timings so that results of different ISA paths can be told apart
+const char* dispatchedISA()
+{
+#if defined(__arm__) || defined(__aarch64__)
+    return "NEON";
+#else
+    if (InferenceEngine::with_cpu_x86_avx512_core()) return "AVX512";
+    if (InferenceEngine::with_cpu_x86_avx2())        return "AVX2";
+    if (InferenceEngine::with_cpu_x86_sse42())       return "SSE42";
+    return "scalar";
+#endif
+}
+
 // performance test: iterate function, measure and print milliseconds per call
 template<typename F> void test_ms(F func, int iter, const char format[], ...)
 {
@@ -54,7 +69,7 @@ template<typename F> void test_ms(F func, int iter, const char format[], ...)
 
     double median_ms = std::chrono::duration_cast<std::chrono::microseconds>(median).count() * 0.001; // convert to milliseconds
 
-    printf("Performance(ms): %lg ", median_ms);
+    printf("Performance(ms): %lg [%s] ", median_ms, dispatchedISA());
 
     va_list args;
     va_start(args, format);
@@ -509,6 +524,43 @@ TEST_P(ChanToPlaneTestGAPI, AccuracyTest)
     }
 }
 
+TEST_P(ConvertNormalizeTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int depth   = std::get<0>(params);
+    cv::Size sz = std::get<1>(params);
+    double tolerance = std::get<2>(params);
+
+    const float mean  = 117.f;
+    const float scale = 1.f / 58.f;
+
+    cv::Mat in_mat(sz, CV_MAKE_TYPE(depth, 1));
+    cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    cv::Mat out_mat_gapi(sz, CV_32FC1);
+    cv::Mat out_mat_ocv;
+
+    // G-API code //////////////////////////////////////////////////////////////
+    FluidConvertNormalizeComputation cc(to_test(in_mat), to_test(out_mat_gapi), mean, scale);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+            400, "ConvertNormalize GAPI %s %dx%d", typeToString(in_mat.type()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat.convertTo(out_mat_ocv, CV_32F, scale, -mean * scale);
+    }
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(MergeTestGAPI, AccuracyTest)
 {
     const auto params = GetParam();
@@ -17,6 +17,7 @@ struct ChanToPlaneTestGAPI: public TestParams<std::tuple<int, int, cv::Size, dou
 struct MergeTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct NV12toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 struct I420toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
+struct ConvertNormalizeTestGAPI: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct ResizeRoiTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, cv::Rect, double>> {};
 struct ResizeRGB8URoiTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, cv::Rect, double>> {};
 
@@ -148,6 +148,11 @@ INSTANTIATE_TEST_CASE_P(MergeTestFluid, MergeTestGAPI,
                                 Values(TEST_SIZES),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(ConvertNormalizeTestFluid, ConvertNormalizeTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(TEST_SIZES),
+                                Values(1e-5)));
+
 INSTANTIATE_TEST_CASE_P(NV12toRGBTestFluid, NV12toRGBTestGAPI,
                         Combine(Values(cv::Size(3840, 2160),
                                        cv::Size(1920, 1080),
@@ -213,3 +213,17 @@ FluidI420toRGBComputation::FluidI420toRGBComputation(test::Mat inMat_y, test::Ma
                                ,{to_own(outMat)}
                                })
 {}
+
+static cv::GComputation buildConvertNormalizeComputation(float mean, float scale)
+{
+    cv::GMat in;
+    cv::GMat out = InferenceEngine::gapi::ConvertNormalizePlane::on(in, mean, scale);
+    return cv::GComputation(in, out);
+}
+
+FluidConvertNormalizeComputation::FluidConvertNormalizeComputation(test::Mat inMat, test::Mat outMat, float mean, float scale)
+    : FluidComputation(new Priv{buildConvertNormalizeComputation(mean, scale)
+                               ,{to_own(inMat)}
+                               ,{to_own(outMat)}
+                               })
+{}
@@ -98,4 +98,10 @@ public:
     FluidI420toRGBComputation(test::Mat inMat_y, test::Mat inMat_u, test::Mat inMat_v, test::Mat outMat);
 };
 
+class FLUID_COMPUTATION_VISIBILITY FluidConvertNormalizeComputation : public FluidComputation
+{
+public:
+    FluidConvertNormalizeComputation(test::Mat inMat, test::Mat outMat, float mean, float scale);
+};
+
 #endif // FLUID_TEST_COMPUTATIONS_HPP
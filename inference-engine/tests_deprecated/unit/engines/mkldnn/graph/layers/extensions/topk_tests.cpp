@@ -337,7 +337,11 @@ INSTANTIATE_TEST_CASE_P(
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "max",{ 1, 18, 129, 129 },{},{} },
                 topk_test_params{ { 1, 20, 32, 32 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 32, 32 },{},{} },
                 topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "index", "min",{ 1, 18, 129, 129 },{},{} },
-                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} }
+                topk_test_params{ { 1, 20, 129, 129 },{}, 1,{ 18 }, "none", "min",{ 1, 18, 129, 129 },{},{} },
+                topk_test_params{ { 2, 30000 },{}, -1,{ 100 }, "value", "max",{ 2, 100 },{},{} },
+                topk_test_params{ { 3, 5000 },{}, 1,{ 128 }, "value", "min",{ 3, 128 },{},{} },
+                topk_test_params{ { 1, 100000 },{}, -1,{ 100 }, "index", "max",{ 1, 100 },{},{} },
+                topk_test_params{ { 1, 100000 },{}, -1,{ 100 }, "index", "min",{ 1, 100 },{},{} }
             ));
 
 
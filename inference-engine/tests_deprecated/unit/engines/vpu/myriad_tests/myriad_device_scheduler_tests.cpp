@@ -0,0 +1,45 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "myriad_device_scheduler.h"
+
+using namespace vpu::MyriadPlugin;
+
+TEST(MyriadDeviceSchedulerTests, dispatchesToLeastBusyReplica) {
+    DeviceScheduler scheduler(3);
+
+    ASSERT_EQ(0, scheduler.acquire());
+    ASSERT_EQ(1, scheduler.acquire());
+    ASSERT_EQ(2, scheduler.acquire());
+
+    scheduler.release(1);
+    ASSERT_EQ(1, scheduler.acquire());
+    ASSERT_EQ(0, scheduler.acquire());
+}
+
+TEST(MyriadDeviceSchedulerTests, spreadsSequentialInferences) {
+    DeviceScheduler scheduler(2);
+
+    for (int i = 0; i < 4; i++) {
+        scheduler.release(scheduler.acquire());
+    }
+
+    const auto inferCount = scheduler.inferCount();
+    ASSERT_EQ(2, inferCount.size());
+    ASSERT_EQ(2, inferCount[0]);
+    ASSERT_EQ(2, inferCount[1]);
+}
+
+TEST(MyriadDeviceSchedulerTests, reportsUtilizationOfBusyReplicas) {
+    DeviceScheduler scheduler(2);
+    scheduler.acquire();
+
+    const auto utilization = scheduler.utilization();
+    ASSERT_EQ(2, utilization.size());
+    ASSERT_GE(utilization[0], 0.0f);
+    ASSERT_LE(utilization[0], 1.0f);
+    ASSERT_EQ(0.0f, utilization[1]);
+}
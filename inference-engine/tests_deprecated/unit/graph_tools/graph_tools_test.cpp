@@ -132,6 +132,40 @@ TEST_F(GraphToolsTest, canSortTopologically) {
     EXPECT_STREQ(sorted[3]->name.c_str(), "4");
 }
 
+TEST_F(GraphToolsTest, canBuildAdjacency) {
+
+    CONNECT(0, 1);
+    CONNECT(2, 1);
+    CONNECT(1, 4);
+
+    EXPECT_CALL(*mockNet, getInputsInfo(_)).WillOnce(WithArg<0>(Invoke([&](InputsDataMap & maps){
+        prepareInputs(maps);
+    })));
+    CNNNetAdjacency adjacency(*mockNet);
+
+    ASSERT_EQ(4, adjacency.size());
+    ASSERT_EQ(CNNNetAdjacency::npos, adjacency.indexOf(layers[3].get()));
+    auto index = [&](int layer) {
+        return adjacency.indexOf(layers[layer].get());
+    };
+
+    auto parents = adjacency.parents(index(1));
+    ASSERT_EQ(2, parents.size());
+    EXPECT_EQ(index(0), parents[0]);
+    EXPECT_EQ(index(2), parents[1]);
+    ASSERT_EQ(0, adjacency.parents(index(0)).size());
+
+    auto children = adjacency.children(index(1));
+    ASSERT_EQ(1, children.size());
+    EXPECT_EQ(index(4), children[0]);
+    ASSERT_EQ(0, adjacency.children(index(4)).size());
+
+    auto sorted = adjacency.sortTopologically();
+    ASSERT_EQ(4, sorted.size());
+    EXPECT_EQ(index(1), sorted[2]);
+    EXPECT_EQ(index(4), sorted[3]);
+}
+
 TEST_F(GraphToolsTest, canDetectLoopsWhileSortTing) {
 
     // 1->2->3-> 4->5->6->7-> 8
@@ -20,6 +20,8 @@
 #include "device.hpp"
 #include <string>
 #include <stdexcept>
+#include <algorithm>
+#include <thread>
 #include <vector>
 #include <map>
 
@@ -52,6 +54,24 @@ enum class throttle_mode_types : int16_t {
     high
 };
 
+/// @brief Defines how dependencies between primitives are enforced in the command queue
+enum class queue_sync_mode_types : int16_t {
+    in_order,         ///< In-order queue, primitives are executed one after another.
+    barriers,         ///< Out-of-order queue, a barrier is enqueued when a primitive depends on the work enqueued
+                      ///< after the previous barrier.
+    events            ///< Out-of-order queue, every primitive waits for the events of its own dependencies only,
+                      ///< so independent branches of the network overlap.
+};
+
+/// @brief Statistics of buffers reuse in the engine memory pool
+struct memory_pool_statistics {
+    uint64_t peak_bytes;              ///< Max total size of memory allocated by the engine.
+    uint64_t pooled_requests;         ///< Number of requests for reusable memory.
+    uint64_t reused_requests;         ///< Number of requests for reusable memory served by already allocated buffers.
+    uint64_t reused_bytes_requested;  ///< Total size requested by the reused_requests.
+    uint64_t reused_bytes_allocated;  ///< Total size of buffers which served the reused_requests.
+};
+
 /// @brief Configuration parameters for created engine.
 struct engine_configuration {
     const bool enable_profiling;              ///< Enable per-primitive profiling.
@@ -71,8 +91,15 @@ struct engine_configuration {
 
     bool enable_memory_pool;              ///< Enables memory usage optimization. memory objects will be reused when possible
                                           ///< (switched off for older drivers then NEO).
+    bool share_memory_pool;               ///< Allows networks of the engine to reuse intermediate buffers of each other.
+                                          ///< Networks must not be executed concurrently then. Disabled by default.
     uint16_t n_streams;                   ///< Number of queues executed in parallel
     const std::string tuning_cache_path;  ///< Path to tuning kernel cache
+    uint16_t n_threads;                   ///< Max number of host threads used to compile OpenCL programs in parallel
+    uint32_t kernels_per_program;         ///< Max number of kernels compiled in a single OpenCL program
+    const std::string kernels_cache_path; ///< Specifies a directory where compiled OpenCL programs are cached.
+                                          ///< Empty by default (means no caching).
+    queue_sync_mode_types queue_sync_mode;  ///< Defines how dependencies between primitives are enforced in the command queue.
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -80,6 +107,11 @@ struct engine_configuration {
     /// @param dump_custom_program Dump the custom OpenCL programs to files
     /// @param options OpenCL compiler options string.
     /// @param single_kernel If provided, runs specific layer.
+    /// @param n_threads Max number of host threads used to compile OpenCL programs in parallel.
+    /// @param kernels_per_program Max number of kernels compiled in a single OpenCL program.
+    /// @param kernels_cache_path Directory where compiled OpenCL programs are cached between runs.
+    /// @param queue_sync_mode Type of the command queue and the way dependencies between primitives are enforced in it.
+    /// @param share_memory_pool Reuse intermediate buffers across networks which are never executed concurrently.
     engine_configuration(
         bool profiling = false,
         bool decorate_kernel_names = false,
@@ -93,7 +125,12 @@ struct engine_configuration {
         throttle_mode_types throttle_mode = throttle_mode_types::disabled,
         bool memory_pool = true,
         uint16_t n_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        uint16_t n_threads = static_cast<uint16_t>(std::max(std::thread::hardware_concurrency(), 1u)),
+        uint32_t kernels_per_program = 10,
+        const std::string& kernels_cache_path = std::string(),
+        queue_sync_mode_types queue_sync_mode = queue_sync_mode_types::barriers,
+        bool share_memory_pool = false)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -105,11 +142,22 @@ struct engine_configuration {
         , priority_mode(priority_mode)
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
+        , share_memory_pool(share_memory_pool)
         , n_streams(n_streams)
-        , tuning_cache_path(tuning_cache_path) {
+        , tuning_cache_path(tuning_cache_path)
+        , n_threads(n_threads)
+        , kernels_per_program(kernels_per_program)
+        , kernels_cache_path(kernels_cache_path)
+        , queue_sync_mode(queue_sync_mode) {
         if (n_streams == 0) {
             throw std::invalid_argument("Invalid streams count set in engine config");
         }
+        if (n_threads == 0) {
+            throw std::invalid_argument("Invalid threads count set in engine config");
+        }
+        if (kernels_per_program == 0) {
+            throw std::invalid_argument("Invalid kernels per program count set in engine config");
+        }
     }
 };
 
@@ -169,6 +217,9 @@ struct engine {
     /// @brief Returns total size of currently resources allocated using given engine
     uint64_t get_temp_used_device_memory_size() const;
 
+    /// @brief Returns statistics of the memory pool shared by all networks of the engine
+    memory_pool_statistics get_memory_pool_statistics() const;
+
     /// @brief Returns type of the engine.
     engine_types get_type() const;
 
@@ -80,6 +80,9 @@ struct event {
     /// @brief Get profiling info for the event associated with network output.
     std::vector<instrumentation::profiling_interval> get_profiling_info() const;
 
+    /// @brief Returns the OpenCL event handle, nullptr if the event is not a single OpenCL event.
+    void* get_ocl_handle() const;
+
     /// @brief Returns C API event handler.
     event_impl* get() const { return _impl; }
 
@@ -21,6 +21,7 @@
 #include "compounds.h"
 #include "layout.hpp"
 #include "engine.hpp"
+#include "event.hpp"
 #include <memory>
 #include <iterator>
 #include <string>
@@ -53,9 +54,16 @@ enum class shared_mem_type {
     shared_mem_vasurface,
 
     /// @brief Structure describes shared D3D11 buffer
-    shared_mem_dxbuffer
+    shared_mem_dxbuffer,
+
+    /// @brief Structure describes host memory the device accesses directly, without copies.
+    /// If the memory handle is null, the memory is allocated by the runtime.
+    shared_mem_host_buffer
 };
 
+/// @brief Alignment of user host buffers passed to memory::share_host_buffer(), required to avoid copies by the driver.
+constexpr size_t host_buffer_alignment = 4096;
+
 using shared_handle = void*;
 using shared_surface = uint32_t;
 
@@ -86,6 +94,12 @@ struct memory {
     /// Create shared memory object on @p engine using user-supplied memory buffer @p buf using specified @p layout
     static memory share_buffer(const engine& engine, const layout& layout, shared_handle buf, uint32_t net_id = 0);
 
+    /// Create memory object on @p engine which the device accesses in host memory directly, using specified @p layout.
+    /// On integrated GPU such memory is shared with the CPU, so neither the device nor the host side copies it.
+    /// @param ptr  The user host buffer aligned to @ref host_buffer_alignment, or nullptr to let the engine allocate it.
+    /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    static memory share_host_buffer(const engine& engine, const layout& layout, void* ptr, uint32_t net_id = 0);
+
     /// Create shared memory object on @p engine using user-supplied 2D image @p img using specified @p layout
     static memory share_image(const engine& engine, const layout& layout, shared_handle img, uint32_t net_id = 0);
 
@@ -158,6 +172,11 @@ struct memory {
 
     shared_mem_params get_internal_params() const;
 
+    /// Copies size() bytes from @p host_ptr to the memory without waiting for the transfer completion.
+    /// @note The host buffer must stay valid and unchanged until the returned event is completed,
+    /// and the event must be waited for before the memory is used by a network.
+    event copy_from(const void* host_ptr) const;
+
     /// Creates the @ref pointer object to get an access memory data
     template <typename T>
     friend struct cldnn::pointer;
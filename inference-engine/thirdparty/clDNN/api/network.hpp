@@ -113,6 +113,12 @@ struct network {
     /// @brief Provides user-supplied @ref memory for output primitives defined by user in source @ref topology.
     void set_output_memory(const primitive_id& id, const memory& mem) const;
 
+    /// @brief Makes the next executions process only the first @p batch images of the inputs.
+    /// @details Requires a program built with build_option::runtime_batch for which program::supports_runtime_batch()
+    /// is true. The inputs and outputs keep the batch of the program, the images past @p batch in the outputs are
+    /// undefined. 0 restores the batch of the program.
+    void set_runtime_batch(int32_t batch) const;
+
     /// @brief Return stream id.
     uint16_t get_stream_id();
 
@@ -191,6 +197,15 @@ struct network {
     /// before network execution.
     std::map<primitive_id, network_output> execute(const std::vector<event>& dependencies = {}) const;
 
+    /// @brief Returns an event which is set when all the work enqueued by the network so far is completed.
+    /// @details Unlike the events of the outputs it is a single OpenCL event in any queue mode, and it is not reused
+    /// by the next executions, so it can be handed to the users of the output memory.
+    event enqueue_marker() const;
+
+    /// @brief Makes the work the network enqueues next wait on the device for the given events.
+    /// @param events The events of the same @ref engine, e.g. the markers of the networks writing the inputs.
+    void enqueue_wait(const std::vector<event>& events) const;
+
     /// @brief Returns wrapped C API @ref cldnn_network handler.
     network_impl* get() const { return _impl; }
 
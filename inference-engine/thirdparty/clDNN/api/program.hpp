@@ -49,6 +49,10 @@ enum class build_option_type {
     /// @brief Enable running detection output layer always on gpu, regardless performance
     detection_output_gpu,
 
+    /// @brief Prefer the kernels which can run for the first images of the batch (default: false).
+    /// @details Lets one network serve any batch up to the one it was built for, see network::set_runtime_batch.
+    runtime_batch,
+
     /// @brief Enable debug mode (default: false).
     /// @details This option enforce all program primitives to be accessible as outputs.
     debug,
@@ -72,7 +76,10 @@ enum class build_option_type {
     /// @brief Name for serialization process
     serialize_network,
     load_program,
-    force_implementations
+    force_implementations,
+
+    /// @brief Specifies a directory where the reordered weights are cached between builds. (default: empty, i.e. no caching)
+    weights_cache_dir
 };
 
 /// @brief Tuning mode.
@@ -133,6 +140,9 @@ struct build_option {
     /// @brief Enable running detection output layer always on GPU, regardless performance (default: false).
     static std::shared_ptr<const build_option> detection_output_gpu(bool enable = false);
 
+    /// @brief Prefer the kernels which can run for the first images of the batch (default: false).
+    static std::shared_ptr<const build_option> runtime_batch(bool enable = false);
+
     /// @brief Enable debug mode (default: false).
     /// @details This option enforce all program primitives to be accessible as outputs.
     static std::shared_ptr<const build_option> debug(bool enable = false);
@@ -162,6 +172,9 @@ struct build_option {
     /// @brief Specifies user defined implementation details to use.
     static std::shared_ptr<const build_option> force_implementations(implementation_forcing_map forcing);
 
+    /// @brief Specifies a directory where the reordered weights are cached between builds (default: empty, i.e. no caching)
+    static std::shared_ptr<const build_option> weights_cache_dir(const std::string& dir_path);
+
     virtual ~build_option() = default;
 
 private:
@@ -250,8 +263,8 @@ struct build_option_directory : build_option {
     explicit build_option_directory(const std::string& dir_path) : directory_path(dir_path) {}
 
 private:
-    /// @brief Returns build_option_type::graph_dumps_dir.
-    build_option_type get_type() const override { return build_option_type::graph_dumps_dir; }
+    /// @brief Returns option type represented by this object.
+    build_option_type get_type() const override { return OptType; }
 
     build_option_directory(const build_option_directory& other) = delete;
     build_option_directory& operator=(const build_option_directory& other) = delete;
@@ -328,6 +341,11 @@ struct build_option_traits<build_option_type::detection_output_gpu> {
     static std::shared_ptr<const build_option> make_default() { return build_option::detection_output_gpu(); }
 };
 template <>
+struct build_option_traits<build_option_type::runtime_batch> {
+    typedef build_option_bool<build_option_type::runtime_batch> object_type;
+    static std::shared_ptr<const build_option> make_default() { return build_option::runtime_batch(); }
+};
+template <>
 struct build_option_traits<build_option_type::debug> {
     typedef build_option_bool<build_option_type::debug> object_type;
     static std::shared_ptr<const build_option> make_default() { return build_option::debug(); }
@@ -367,6 +385,11 @@ struct build_option_traits<build_option_type::force_implementations> {
     using object_type = build_option_force_implementations;
     static std::shared_ptr<const build_option> make_default() { return build_option::force_implementations({}); }
 };
+template <>
+struct build_option_traits<build_option_type::weights_cache_dir> {
+    typedef build_option_directory<build_option_type::weights_cache_dir> object_type;
+    static std::shared_ptr<const build_option> make_default() { return build_option::weights_cache_dir({}); }
+};
 
 #endif
 }  // namespace detail
@@ -388,6 +411,10 @@ inline std::shared_ptr<const build_option> build_option::detection_output_gpu(bo
     return std::make_shared<build_option_bool<build_option_type::detection_output_gpu>>(enable);
 }
 
+inline std::shared_ptr<const build_option> build_option::runtime_batch(bool enable) {
+    return std::make_shared<build_option_bool<build_option_type::runtime_batch>>(enable);
+}
+
 inline std::shared_ptr<const build_option> build_option::debug(bool enable) {
     return std::make_shared<build_option_bool<build_option_type::debug>>(enable);
 }
@@ -407,6 +434,9 @@ inline std::shared_ptr<const build_option> build_option::tuning_config(const tun
 inline std::shared_ptr<const build_option> build_option::graph_dumps_dir(const std::string& dir_path) {
     return std::make_shared<build_option_directory<build_option_type::graph_dumps_dir>>(dir_path);
 }
+inline std::shared_ptr<const build_option> build_option::weights_cache_dir(const std::string& dir_path) {
+    return std::make_shared<build_option_directory<build_option_type::weights_cache_dir>>(dir_path);
+}
 inline std::shared_ptr<const build_option> build_option::serialize_network(const std::string& name) {
     return std::make_shared<build_option_serialization<build_option_type::serialize_network>>(name);
 }
@@ -498,6 +528,11 @@ public:
     /// @brief Checks whether @p lhs and @p rhs reference different C API @ref cldnn_program handlers
     friend bool operator!=(const program& lhs, const program& rhs) { return !(lhs == rhs); }
 
+    /// @brief Checks whether the networks of the program can run for the first images of the batch.
+    /// @details True if the program is built with build_option::runtime_batch, has all the images of the batch
+    /// one after another in the memory of its primitives and has the kernels which can run for a part of the batch.
+    bool supports_runtime_batch() const;
+
     /// @brief Returns wrapped C API @ref cldnn_program handler.
     program_impl* get() const { return _impl; }
 
@@ -150,6 +150,12 @@ JitConstants ActivationKernelOpt::GetJitConstants(const activation_params& param
 }
 
 KernelsData ActivationKernelOpt::GetKernelsData(const Params& params, const optional_params& options) const {
-    return GetCommonKernelsData(params, options);
+    auto kd = GetCommonKernelsData(params, options);
+    const auto& output = static_cast<const activation_params&>(params).output;
+    // the kernel goes through the elements linearly, so the images have to be dense
+    if (!kd.empty() && !output.PitchesDifferFromLogicalDims()) {
+        SetBatchDimension(kd[0].kernels[0], output, 0, options);
+    }
+    return kd;
 }
 }  // namespace kernel_selector
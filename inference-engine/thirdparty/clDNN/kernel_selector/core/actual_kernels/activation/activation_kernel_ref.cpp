@@ -61,6 +61,12 @@ JitConstants ActivationKernelRef::GetJitConstants(const activation_params& param
 }
 
 KernelsData ActivationKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
-    return GetCommonKernelsData(params, options);
+    auto kd = GetCommonKernelsData(params, options);
+    const auto& output = static_cast<const activation_params&>(params).output;
+    // the last dimension of the global work size is batch * feature except for yxfb and b_fs_yx_fsv16
+    if (!kd.empty() && output.GetLayout() != DataLayout::yxfb && output.GetLayout() != DataLayout::b_fs_yx_fsv16) {
+        SetBatchDimension(kd[0].kernels[0], output, 2, options);
+    }
+    return kd;
 }
 }  // namespace kernel_selector
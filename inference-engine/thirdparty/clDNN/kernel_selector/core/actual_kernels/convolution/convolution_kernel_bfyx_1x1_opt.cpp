@@ -24,7 +24,9 @@ convolution_kernel_bfyx_1x1_opt::convolution_kernel_bfyx_1x1_opt()
 ParamsKey convolution_kernel_bfyx_1x1_opt::GetSupportedKey() const {
     ParamsKey k;
     k.EnableInputDataType(Datatype::F32);
+    k.EnableInputWeightsType(WeightsType::F16);
     k.EnableInputWeightsType(WeightsType::F32);
+    k.EnableDifferentInputWeightsTypes();
     k.EnableOutputDataType(Datatype::F32);
     k.EnableInputLayout(DataLayout::bfyx);
     k.EnableOutputLayout(DataLayout::bfyx);
@@ -114,6 +116,11 @@ bool convolution_kernel_bfyx_1x1_opt::Validate(const Params& p, const optional_p
     if (cp.padding.x != 0 || cp.padding.y != 0)
         return false;
 
+    // compressed weights are read by the short block reads and converted by the FP16 extension
+    if (cp.weights.GetDType() == WeightsType::F16 &&
+        (!cp.engineInfo.bSubGroupShortSupport || !cp.engineInfo.bFP16Support))
+        return false;
+
     // if block sizes are 1x1, then this algorithm is probably not the best
     auto block = get_out_block_size(cp);
     if (block.out_width == 1 && block.out_height == 1)
@@ -100,7 +100,9 @@ struct eltwise_optional_params : optional_params {
 // fuse_params
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 struct eltwise_fuse_params : fuse_params {
-    eltwise_fuse_params() : fuse_params(KernelType::ELTWISE) {}
+    explicit eltwise_fuse_params(EltwiseMode mode = EltwiseMode::ADD) : fuse_params(KernelType::ELTWISE), mode(mode) {}
+
+    EltwiseMode mode;
 };
 
 struct scale_fuse_params : fuse_params {
@@ -52,6 +52,14 @@ bool EltwiseKernelRef::Validate(const Params& p, const optional_params& o) const
 }
 
 KernelsData EltwiseKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
-    return GetCommonKernelsData(params, options);
+    auto kd = GetCommonKernelsData(params, options);
+    const auto& eltwiseParams = static_cast<const eltwise_params&>(params);
+    if (!kd.empty() && eltwiseParams.output.GetLayout() != DataLayout::fs_b_yx_fsv32) {
+        // the dense tensors are processed linearly, otherwise the batch is the last dimension of the global work size
+        bool linear = !eltwiseParams.layoutBased && !eltwiseParams.int8_quantization && !eltwiseParams.broadcast &&
+                      CheckInputsOutputNoPitchSameDims(eltwiseParams);
+        SetBatchDimension(kd[0].kernels[0], eltwiseParams.output, linear ? 0 : 2, options);
+    }
+    return kd;
 }
 }  // namespace kernel_selector
@@ -24,6 +24,7 @@ ParamsKey FullyConnected_bf_io_input_spatial::GetSupportedKey() const {
     k.EnableOutputDataType(Datatype::F32);
     k.EnableInputWeightsType(WeightsType::F16);
     k.EnableInputWeightsType(WeightsType::F32);
+    k.EnableDifferentInputWeightsTypes();
     k.EnableAllInputLayout();
     k.EnableOutputLayout(DataLayout::bf);
     k.EnableBatching();
@@ -72,6 +73,11 @@ bool FullyConnected_bf_io_input_spatial::Validate(const Params& p, const optiona
         return false;
     }
 
+    // compressed weights are converted by the FP16 extension
+    if (params.weights.GetDType() == WeightsType::F16 && !params.engineInfo.bFP16Support) {
+        return false;
+    }
+
     return true;
 }
 
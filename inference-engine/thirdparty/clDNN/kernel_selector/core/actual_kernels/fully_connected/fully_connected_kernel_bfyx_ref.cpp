@@ -100,6 +100,8 @@ KernelsData FullyConnected_bfyx_Ref::GetKernelsData(const Params& params, const
             DONT_USE_IF_HAVE_SOMETHING_ELSE,
             static_cast<int>(i));
         if (!kd.empty()) {
+            // the second dimension of the global work size is the batch
+            SetBatchDimension(kd[0].kernels[0], static_cast<const fully_connected_params&>(params).output, 1, options);
             res.emplace_back(kd[0]);
         }
     }
@@ -0,0 +1,171 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "non_max_suppression_kernel_ref.h"
+#include "kernel_selector_utils.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+
+static constexpr size_t MAX_LWS = 256;
+
+ParamsKey NonMaxSuppressionKernelRef::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableDifferentTypes();
+    k.EnableBatching();
+    return k;
+}
+
+size_t NonMaxSuppressionKernelRef::GetSortSize(const non_max_suppression_params& params) const {
+    size_t boxes_num = params.inputs[0].Feature().v;
+    size_t sort_size = 2;
+    while (sort_size < boxes_num)
+        sort_size *= 2;
+    return sort_size;
+}
+
+size_t NonMaxSuppressionKernelRef::GetLocalWorkSize(const non_max_suppression_params& params) const {
+    size_t lws = std::min(GetSortSize(params) / 2, MAX_LWS);
+    return std::min(lws, static_cast<size_t>(params.engineInfo.maxWorkGroupSize));
+}
+
+bool NonMaxSuppressionKernelRef::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::NON_MAX_SUPPRESSION || o.GetType() != KernelType::NON_MAX_SUPPRESSION)
+        return false;
+
+    const non_max_suppression_params& params = static_cast<const non_max_suppression_params&>(p);
+    size_t scalars_num = params.has_num_select_per_class + params.has_iou_threshold + params.has_score_threshold;
+    if (params.inputs.size() != 2 + scalars_num)
+        return false;
+
+    for (size_t i = 0; i < 2; i++) {
+        auto dt = params.inputs[i].GetDType();
+        if (dt != Datatype::F16 && dt != Datatype::F32)
+            return false;
+    }
+
+    // scores, box indices and suppression flags of a (batch, class) pair are kept in local memory
+    size_t slm_size = GetSortSize(params) * (sizeof(float) + sizeof(int) + sizeof(char)) + 2 * sizeof(int);
+    if (slm_size > params.engineInfo.maxLocalMemSize)
+        return false;
+
+    return true;
+}
+
+JitConstants NonMaxSuppressionKernelRef::GetJitConstants(const non_max_suppression_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("NUM_BATCHES", params.inputs[0].Batch().v),
+        MakeJitConstant("NUM_BOXES", params.inputs[0].Feature().v),
+        MakeJitConstant("NUM_CLASSES", params.inputs[1].Feature().v),
+        MakeJitConstant("OUTPUT_NUM", params.output.Batch().v),
+        MakeJitConstant("SORT_SIZE", GetSortSize(params)),
+        MakeJitConstant("LWS", GetLocalWorkSize(params)),
+        MakeJitConstant("CENTER_POINT_BOX", params.center_point_box),
+    });
+
+    size_t input = 2;
+    if (params.has_num_select_per_class)
+        jit.Merge(MakeTypeJitConstants(params.inputs[input++].GetDType(), "NUM_SELECT_PER_CLASS"));
+    if (params.has_iou_threshold)
+        jit.Merge(MakeTypeJitConstants(params.inputs[input++].GetDType(), "IOU_THRESHOLD"));
+    if (params.has_score_threshold)
+        jit.Merge(MakeTypeJitConstants(params.inputs[input++].GetDType(), "SCORE_THRESHOLD"));
+
+    return jit;
+}
+
+KernelsData NonMaxSuppressionKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options))
+        return {};
+
+    constexpr size_t kernels_num = 2;
+    KernelData kd = KernelData::Default<non_max_suppression_params>(params, kernels_num);
+    const non_max_suppression_params& newParams = *static_cast<non_max_suppression_params*>(kd.params.get());
+
+    const size_t batches_num = newParams.inputs[0].Batch().v;
+    const size_t boxes_num = newParams.inputs[0].Feature().v;
+    const size_t classes_num = newParams.inputs[1].Feature().v;
+    const size_t lists_num = batches_num * classes_num;
+
+    auto cldnn_jit = GetJitConstants(newParams);
+    {
+        // sort and suppression of every (batch, class) pair in its own work group
+        CommonDispatchData runInfo;
+        runInfo.gws0 = GetLocalWorkSize(newParams);
+        runInfo.gws1 = classes_num;
+        runInfo.gws2 = batches_num;
+        runInfo.lws0 = runInfo.gws0;
+        runInfo.lws1 = 1;
+        runInfo.lws2 = 1;
+
+        auto stage_jit = cldnn_jit;
+        stage_jit.AddConstant(MakeJitConstant("NMS_STAGE_1", 1));
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        auto jit = CreateJit(kernelName, stage_jit, entry_point);
+        auto& kernel = kd.kernels[0];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+        kernel.arguments.clear();
+        for (size_t i = 0; i < newParams.inputs.size(); i++) {
+            kernel.arguments.push_back({ArgumentDescriptor::Types::INPUT, static_cast<uint32_t>(i)});
+        }
+        kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, 0});
+        kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, 1});
+    }
+    {
+        // merge of the selected boxes of all the pairs by score
+        CommonDispatchData runInfo;
+        std::vector<size_t> global = {std::max(lists_num * boxes_num, newParams.output.Batch().v), 1, 1};
+        auto local = GetOptimalLocalWorkGroupSizes(global, params.engineInfo);
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        auto stage_jit = cldnn_jit;
+        stage_jit.AddConstant(MakeJitConstant("NMS_STAGE_2", 1));
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        auto jit = CreateJit(kernelName, stage_jit, entry_point);
+        auto& kernel = kd.kernels[1];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+        kernel.arguments.clear();
+        kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, 0});
+        kernel.arguments.push_back({ArgumentDescriptor::Types::INTERNAL_BUFFER, 1});
+        kernel.arguments.push_back({ArgumentDescriptor::Types::OUTPUT, 0});
+    }
+
+    // (box index, score bits) of the selected boxes of every pair and the number of them
+    kd.internalBufferSizes.push_back(lists_num * boxes_num * 2 * sizeof(int32_t));
+    kd.internalBufferSizes.push_back(lists_num * sizeof(int32_t));
+    kd.internalBufferDataType = Datatype::INT32;
+    kd.estimatedTime = FORCE_PRIORITY_9;
+
+    return {kd};
+}
+}  // namespace kernel_selector
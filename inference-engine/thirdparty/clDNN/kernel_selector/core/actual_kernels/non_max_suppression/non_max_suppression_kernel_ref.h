@@ -0,0 +1,65 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// non_max_suppression_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct non_max_suppression_params : public base_params {
+    non_max_suppression_params()
+        : base_params(KernelType::NON_MAX_SUPPRESSION),
+          center_point_box(false),
+          has_num_select_per_class(false),
+          has_iou_threshold(false),
+          has_score_threshold(false) {}
+
+    // inputs: boxes, scores and the optional scalars in this order
+    bool center_point_box;
+    bool has_num_select_per_class;
+    bool has_iou_threshold;
+    bool has_score_threshold;
+
+    virtual ParamsKey GetParamsKey() const { return base_params::GetParamsKey(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// non_max_suppression_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct non_max_suppression_optional_params : optional_params {
+    non_max_suppression_optional_params() : optional_params(KernelType::NON_MAX_SUPPRESSION) {}
+};
+
+// Stage 1 sorts the boxes of every (batch, class) pair in local memory and suppresses them greedily,
+// stage 2 merges the per class lists into the output ordered by score.
+class NonMaxSuppressionKernelRef : public common_kernel_base {
+public:
+    NonMaxSuppressionKernelRef() : common_kernel_base("non_max_suppression_ref") {}
+    virtual ~NonMaxSuppressionKernelRef() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const non_max_suppression_params& params) const;
+    size_t GetSortSize(const non_max_suppression_params& params) const;
+    size_t GetLocalWorkSize(const non_max_suppression_params& params) const;
+};
+}  // namespace kernel_selector
@@ -35,7 +35,8 @@ protected:
     JitConstants GetJitConstants(const pooling_params& params, DispatchData kd) const override;
     DispatchData SetDefault(const pooling_params& params) const override;
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
-        return { FusedOpType::QUANTIZE,
+        return { FusedOpType::ELTWISE,
+                 FusedOpType::QUANTIZE,
                  FusedOpType::SCALE,
                  FusedOpType::ACTIVATION };
     }
@@ -29,7 +29,8 @@ public:
     bool Validate(const Params&, const optional_params&) const override;
     JitConstants GetJitConstants(const pooling_params& params, DispatchData kd) const override;
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
-        return { FusedOpType::QUANTIZE,
+        return { FusedOpType::ELTWISE,
+                 FusedOpType::QUANTIZE,
                  FusedOpType::SCALE,
                  FusedOpType::ACTIVATION };
     }
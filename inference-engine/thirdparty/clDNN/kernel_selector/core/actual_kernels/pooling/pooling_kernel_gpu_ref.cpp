@@ -76,6 +76,15 @@ JitConstants PoolingKernelGPURef::GetJitConstants(const pooling_params& params,
 }
 
 KernelsData PoolingKernelGPURef::GetKernelsData(const Params& params, const optional_params& options) const {
-    return GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
+    auto kd = GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
+    const auto& output = static_cast<const pooling_params&>(params).output;
+    // these layouts have batch * feature in the last dimension of the global work size
+    const auto layout = output.GetLayout();
+    if (!kd.empty() && (layout == DataLayout::bfyx || layout == DataLayout::b_fs_yx_fsv4 || layout == DataLayout::byxf ||
+                        layout == DataLayout::byxf_af32 || layout == DataLayout::bfzyx ||
+                        layout == DataLayout::b_fs_zyx_fsv16)) {
+        SetBatchDimension(kd[0].kernels[0], output, 2, options);
+    }
+    return kd;
 }
 }  // namespace kernel_selector
@@ -47,6 +47,12 @@ JitConstants ReorderKernelRef::GetJitConstants(const reorder_params& params) con
 
 KernelsData ReorderKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
     const reorder_params& orgParams = static_cast<const reorder_params&>(params);
-    return GetCommonKernelsData(orgParams, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
+    auto kd = GetCommonKernelsData(orgParams, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
+    // the work groups follow the dimensions of the input, so its batch is the last dimension of them
+    if (!kd.empty() && orgParams.inputs[0].GetLayout() != DataLayout::fs_b_yx_fsv32 &&
+        orgParams.output.GetLayout() != DataLayout::bs_fs_yx_bsv16_fsv16) {
+        SetBatchDimension(kd[0].kernels[0], orgParams.inputs[0], 2, options);
+    }
+    return kd;
 }
 }  // namespace kernel_selector
\ No newline at end of file
@@ -32,7 +32,8 @@ protected:
     DispatchData SetDefault(const resample_params& arg) const override;
     Datatype GetUnitType(const base_params& params) const override;
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
-        return { FusedOpType::QUANTIZE,
+        return { FusedOpType::ELTWISE,
+                 FusedOpType::QUANTIZE,
                  FusedOpType::SCALE,
                  FusedOpType::ACTIVATION };
     }
@@ -27,7 +27,8 @@ public:
     ParamsKey GetSupportedKey() const override;
     JitConstants GetJitConstants(const resample_params& params) const override;
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
-        return { FusedOpType::QUANTIZE,
+        return { FusedOpType::ELTWISE,
+                 FusedOpType::QUANTIZE,
                  FusedOpType::SCALE,
                  FusedOpType::ACTIVATION };
     }
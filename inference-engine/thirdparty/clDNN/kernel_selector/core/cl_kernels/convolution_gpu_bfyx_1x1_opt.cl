@@ -66,12 +66,23 @@ KERNEL(convolution)(
             in[i] = input[in_offset];
         }
 
+#if FILTER_TYPE_SIZE == 2
+        // compressed weights are up-converted in registers
+#if OUT_BLOCK_DEPTH == 8
+        float8 w = convert_float8(as_half8(intel_sub_group_block_read_us8((__global ushort*)weights + filter_offset + k * 64)));
+#elif OUT_BLOCK_DEPTH == 4
+        float4 w = convert_float4(as_half4(intel_sub_group_block_read_us4((__global ushort*)weights + filter_offset + k * 32)));
+#elif OUT_BLOCK_DEPTH == 2
+        float2 w = convert_float2(as_half2(intel_sub_group_block_read_us2((__global ushort*)weights + filter_offset + k * 16)));
+#endif
+#else
 #if OUT_BLOCK_DEPTH == 8
         float8 w = as_float8(intel_sub_group_block_read8((__global uint*)weights + filter_offset + k * 64));
 #elif OUT_BLOCK_DEPTH == 4
         float4 w = as_float4(intel_sub_group_block_read4((__global uint*)weights + filter_offset + k * 32));
 #elif OUT_BLOCK_DEPTH == 2
         float2 w = as_float2(intel_sub_group_block_read2((__global uint*)weights + filter_offset + k * 16));
+#endif
 #endif
 
         for(uint br = 0; br < OUT_BLOCK_HEIGHT; br++)
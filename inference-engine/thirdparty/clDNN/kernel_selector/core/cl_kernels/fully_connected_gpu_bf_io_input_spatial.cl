@@ -18,7 +18,8 @@
 // Required JIT constants:
 //  - FP16_SUPPORTED        - [0/1] Value indicating whether device supports FP16 OpenCL extension (cl_khr_fp16).
 //  - FP16_UNIT_USED        - [0/1] Value indicating that current kernel should use FP16.
-//  - UNIT_TYPE             - Type of unit of input/output/weight/bias.
+//  - UNIT_TYPE             - Type of unit of input/output/bias.
+//  - FILTER_TYPE           - Type of weights, FP16 weights are up-converted for the FP32 computation.
 //  - UNIT_VAL_ZERO         - Literal of current UNIT_TYPE that represents 0.
 //  - INPUT0_BATCH_NUM      - [int] Number of elements from single spatial and single feature that are grouped in single batch in input.
 //  - INPUT0_ELEMENTS_COUNT - [int] Cumulative number of elements from input that are processed in single batch.
@@ -32,7 +33,7 @@ __attribute__((intel_reqd_sub_group_size(16)))
 KERNEL (fully_connected_gpu_bf_io_input_spatial)(
     const __global UNIT_TYPE* input,
     __global UNIT_TYPE* output,
-    const __global UNIT_TYPE* weight
+    const __global FILTER_TYPE* weight
 #if BIAS_TERM
     , __global UNIT_TYPE* bias)
 #else
@@ -47,9 +48,9 @@ KERNEL (fully_connected_gpu_bf_io_input_spatial)(
 
     uint input_idx = batch_id * INPUT0_ELEMENTS_COUNT + get_sub_group_local_id();
     input_idx = MULTIPLY_OFFSET(UNIT_TYPE, input_idx);
-    uint weight_idx = MULTIPLY_OFFSET(UNIT_TYPE, outXIdx);
+    uint weight_idx = MULTIPLY_OFFSET(FILTER_TYPE, outXIdx);
     const uint weight_idx_base = weight_idx;
-    uint s_w_idx = MULTIPLY_OFFSET(UNIT_TYPE, get_group_id(0) * 16 + get_sub_group_local_id() * FILTER_OFM_NUM);
+    uint s_w_idx = MULTIPLY_OFFSET(FILTER_TYPE, get_group_id(0) * 16 + get_sub_group_local_id() * FILTER_OFM_NUM);
     const uint input_slices = INPUT0_ELEMENTS_COUNT / 16;
     for (uint i = 0; i < input_slices; i++)
     {
@@ -59,22 +60,22 @@ KERNEL (fully_connected_gpu_bf_io_input_spatial)(
         {
             UNIT_TYPE _in = intel_sub_group_shuffle(_inG, j);
             uint wi_w_addr = intel_sub_group_shuffle(it_w_addr, j);
-            wi_w_addr += MULTIPLY_OFFSET(UNIT_TYPE, get_sub_group_local_id());
-            UNIT_TYPE _w = *OFFSET_GLOBAL_PTR(UNIT_TYPE, weight, wi_w_addr);
+            wi_w_addr += MULTIPLY_OFFSET(FILTER_TYPE, get_sub_group_local_id());
+            UNIT_TYPE _w = (UNIT_TYPE)(*OFFSET_GLOBAL_PTR(FILTER_TYPE, weight, wi_w_addr));
             result += _in * _w;
         }
         input_idx  += MULTIPLY_OFFSET(UNIT_TYPE, 16);
-        s_w_idx += MULTIPLY_OFFSET(UNIT_TYPE, FILTER_OFM_NUM * 16);
+        s_w_idx += MULTIPLY_OFFSET(FILTER_TYPE, FILTER_OFM_NUM * 16);
     }
     input_idx -=  MULTIPLY_OFFSET(UNIT_TYPE, get_sub_group_local_id());
-    weight_idx += MULTIPLY_OFFSET(UNIT_TYPE, input_slices * FILTER_OFM_NUM);
+    weight_idx += MULTIPLY_OFFSET(FILTER_TYPE, input_slices * FILTER_OFM_NUM);
     for (uint i = 0; i < INPUT0_ELEMENTS_COUNT % 16; i++)
     {
         UNIT_TYPE _in = *OFFSET_GLOBAL_PTR(UNIT_TYPE, input, input_idx);
-        UNIT_TYPE _w = *OFFSET_GLOBAL_PTR(UNIT_TYPE, weight, weight_idx);
+        UNIT_TYPE _w = (UNIT_TYPE)(*OFFSET_GLOBAL_PTR(FILTER_TYPE, weight, weight_idx));
         result += _in * _w;
         input_idx  += MULTIPLY_OFFSET(UNIT_TYPE, 1);
-        weight_idx += MULTIPLY_OFFSET(UNIT_TYPE, FILTER_OFM_NUM);
+        weight_idx += MULTIPLY_OFFSET(FILTER_TYPE, FILTER_OFM_NUM);
     }
 
 #if BIAS_TERM
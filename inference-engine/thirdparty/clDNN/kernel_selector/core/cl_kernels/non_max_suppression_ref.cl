@@ -0,0 +1,236 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+#ifdef NMS_STAGE_1
+inline float4 FUNC(get_box)(const __global INPUT0_TYPE* boxes, uint bi, uint box)
+{
+    const uint offset = (bi * NUM_BOXES + box) * 4;
+    const float a = convert_float(boxes[offset + 0]);
+    const float b = convert_float(boxes[offset + 1]);
+    const float c = convert_float(boxes[offset + 2]);
+    const float d = convert_float(boxes[offset + 3]);
+#if CENTER_POINT_BOX
+    // [center x, center y, width, height]
+    return (float4)(a - c / 2, b - d / 2, a + c / 2, b + d / 2);
+#else
+    // two corners in any order
+    return (float4)(min(a, c), min(b, d), max(a, c), max(b, d));
+#endif
+}
+
+inline float FUNC(iou)(float4 box1, float4 box2)
+{
+    const float area1 = (box1.s2 - box1.s0) * (box1.s3 - box1.s1);
+    const float area2 = (box2.s2 - box2.s0) * (box2.s3 - box2.s1);
+
+    const float intersection_x = min(box1.s2, box2.s2) - max(box1.s0, box2.s0);
+    const float intersection_y = min(box1.s3, box2.s3) - max(box1.s1, box2.s1);
+    if (intersection_x <= 0 || intersection_y <= 0)
+        return 0.f;
+
+    const float intersection = intersection_x * intersection_y;
+    const float union_area = area1 + area2 - intersection;
+    if (union_area <= 0)
+        return 0.f;
+
+    return intersection / union_area;
+}
+
+// descending scores, the lower box index first among the equal ones
+inline bool FUNC(is_before)(float score1, int box1, float score2, int box2)
+{
+    return score1 > score2 || (score1 == score2 && box1 < box2);
+}
+#endif
+
+#ifdef NMS_STAGE_2
+// the number of the entries of the sorted list which come before the given score:
+// the higher scores, and the equal ones of the lists with lower (batch, class)
+inline int FUNC(count_before)(const __global int* selected, int list_size, float score, bool take_equal)
+{
+    int lo = 0;
+    int hi = list_size;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        const float mid_score = as_float(selected[mid * 2 + 1]);
+        if (mid_score > score || (take_equal && mid_score == score))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+#endif
+
+KERNEL(non_max_suppression_ref)(
+#ifdef NMS_STAGE_1
+    const __global INPUT0_TYPE* boxes,
+    const __global INPUT1_TYPE* scores,
+#ifdef NUM_SELECT_PER_CLASS_TYPE
+    const __global NUM_SELECT_PER_CLASS_TYPE* num_select_per_class,
+#endif
+#ifdef IOU_THRESHOLD_TYPE
+    const __global IOU_THRESHOLD_TYPE* iou_threshold_value,
+#endif
+#ifdef SCORE_THRESHOLD_TYPE
+    const __global SCORE_THRESHOLD_TYPE* score_threshold_value,
+#endif
+    __global int* selected,
+    __global int* selected_num
+#else
+    const __global int* selected,
+    const __global int* selected_num,
+    __global OUTPUT_TYPE* output
+#endif
+)
+{
+#ifdef NMS_STAGE_1
+    __local float sort_scores[SORT_SIZE];
+    __local int sort_boxes[SORT_SIZE];
+    __local uchar suppressed[SORT_SIZE];
+    __local int candidates_num;
+
+    const uint lid = get_local_id(0);
+    const uint ci = get_global_id(1);
+    const uint bi = get_global_id(2);
+    const uint list = bi * NUM_CLASSES + ci;
+
+#ifdef NUM_SELECT_PER_CLASS_TYPE
+    const int select_num = (int)num_select_per_class[0];
+    // a non positive number selects all the boxes, as the host implementation does
+    const int max_keep = select_num > 0 ? min(select_num, NUM_BOXES) : NUM_BOXES;
+#else
+    const int max_keep = NUM_BOXES;
+#endif
+#ifdef IOU_THRESHOLD_TYPE
+    const float iou_threshold = convert_float(iou_threshold_value[0]);
+#else
+    const float iou_threshold = 1.f;
+#endif
+#ifdef SCORE_THRESHOLD_TYPE
+    const float score_threshold = convert_float(score_threshold_value[0]);
+#else
+    const float score_threshold = 0.f;
+#endif
+
+    if (lid == 0)
+        candidates_num = 0;
+
+    for (uint i = lid; i < SORT_SIZE; i += LWS) {
+        float score = -INFINITY;
+        if (i < NUM_BOXES) {
+            score = convert_float(scores[list * NUM_BOXES + i]);
+            if (!(score > score_threshold))
+                score = -INFINITY;
+        }
+        sort_scores[i] = score;
+        sort_boxes[i] = i;
+        suppressed[i] = 0;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // bitonic sort
+    for (uint k = 2; k <= SORT_SIZE; k <<= 1) {
+        for (uint j = k >> 1; j > 0; j >>= 1) {
+            for (uint i = lid; i < SORT_SIZE; i += LWS) {
+                const uint ixj = i ^ j;
+                if (ixj > i) {
+                    const bool in_order = (i & k) == 0;
+                    const bool swap = in_order ? FUNC_CALL(is_before)(sort_scores[ixj], sort_boxes[ixj], sort_scores[i], sort_boxes[i])
+                                               : FUNC_CALL(is_before)(sort_scores[i], sort_boxes[i], sort_scores[ixj], sort_boxes[ixj]);
+                    if (swap) {
+                        const float score = sort_scores[i];
+                        sort_scores[i] = sort_scores[ixj];
+                        sort_scores[ixj] = score;
+                        const int box = sort_boxes[i];
+                        sort_boxes[i] = sort_boxes[ixj];
+                        sort_boxes[ixj] = box;
+                    }
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+    }
+
+    for (uint i = lid; i < SORT_SIZE; i += LWS) {
+        if (sort_scores[i] > score_threshold && (i + 1 == SORT_SIZE || !(sort_scores[i + 1] > score_threshold)))
+            candidates_num = i + 1;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // greedy suppression: every kept box marks the remaining boxes overlapping it
+    const int candidates = candidates_num;
+    int kept = 0;
+    for (int p = 0; p < candidates && kept < max_keep; p++) {
+        if (suppressed[p])
+            continue;
+
+        if (lid == 0) {
+            const uint offset = (list * NUM_BOXES + kept) * 2;
+            selected[offset + 0] = sort_boxes[p];
+            selected[offset + 1] = as_int(sort_scores[p]);
+        }
+        kept++;
+
+        const float4 kept_box = FUNC_CALL(get_box)(boxes, bi, sort_boxes[p]);
+        for (int q = p + 1 + lid; q < candidates; q += LWS) {
+            if (!suppressed[q] && FUNC_CALL(iou)(kept_box, FUNC_CALL(get_box)(boxes, bi, sort_boxes[q])) > iou_threshold)
+                suppressed[q] = 1;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0)
+        selected_num[list] = kept;
+#else
+    const uint gid = get_global_id(0);
+    const uint lists_num = NUM_BATCHES * NUM_CLASSES;
+
+    if (gid < OUTPUT_NUM) {
+        int total = 0;
+        for (uint l = 0; l < lists_num; l++)
+            total += selected_num[l];
+        if (gid >= total) {
+            output[gid * 3 + 0] = TO_OUTPUT_TYPE(-1);
+            output[gid * 3 + 1] = TO_OUTPUT_TYPE(-1);
+            output[gid * 3 + 2] = TO_OUTPUT_TYPE(-1);
+        }
+    }
+
+    if (gid >= lists_num * NUM_BOXES)
+        return;
+
+    const uint list = gid / NUM_BOXES;
+    const int pos = gid % NUM_BOXES;
+    if (pos >= selected_num[list])
+        return;
+
+    // the position in the output ordered by score, then by batch, class and the order of selection
+    const float score = as_float(selected[gid * 2 + 1]);
+    int rank = pos;
+    for (uint l = 0; l < lists_num; l++) {
+        if (l != list)
+            rank += FUNC_CALL(count_before)(selected + l * NUM_BOXES * 2, selected_num[l], score, l < list);
+    }
+
+    if (rank < OUTPUT_NUM) {
+        output[rank * 3 + 0] = TO_OUTPUT_TYPE(list / NUM_CLASSES);
+        output[rank * 3 + 1] = TO_OUTPUT_TYPE(list % NUM_CLASSES);
+        output[rank * 3 + 2] = TO_OUTPUT_TYPE(selected[gid * 2]);
+    }
+#endif
+}
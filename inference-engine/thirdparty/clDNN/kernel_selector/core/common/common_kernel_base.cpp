@@ -212,4 +212,37 @@ void common_kernel_base::FillCLKernelData(clKernelData& kernel,
     kernel.arguments =
         GetArgsDesc(number_of_inputs, weights, bias, number_of_inputs_for_fused_prims);
 }
+
+void common_kernel_base::SetBatchDimension(clKernelData& kernel,
+                                           const DataTensor& tensor,
+                                           size_t dimension,
+                                           const optional_params& options) const {
+    if (!options.preferRuntimeBatch) {
+        return;
+    }
+
+    const auto layout = tensor.GetLayout();
+    const auto batch = tensor.Batch().v;
+    const auto& global = kernel.workGroups.global;
+    auto& local = kernel.workGroups.local;
+
+    // the images of the batch follow each other in the memory only if the batch is the outermost dimension
+    if (DataTensor::Channelndex(layout, Tensor::DataChannelName::BATCH) + 1 !=
+        static_cast<int>(DataTensor::ChannelsCount(layout))) {
+        return;
+    }
+    if (batch == 0 || dimension >= global.size() || global[dimension] % batch != 0) {
+        return;
+    }
+    if (dimension < local.size() && local[dimension] != 0) {
+        // the greatest common divisor of the work group and the work of one image
+        size_t image = global[dimension] / batch;
+        while (image != 0) {
+            size_t rest = local[dimension] % image;
+            local[dimension] = image;
+            image = rest;
+        }
+    }
+    kernel.batchDimension = static_cast<int>(dimension);
+}
 }  // namespace kernel_selector
@@ -68,5 +68,13 @@ protected:
                           bool bias = false,
                           int number_of_inputs = 1,
                           uint32_t number_of_inputs_for_fused_prims = 0) const;
+    // With preferRuntimeBatch, sets the batch dimension of the kernel if the global work size of the dimension is the batch of the tensor
+    // times a constant. The local work size of the dimension is reduced to make any number of images a whole number
+    // of work groups, so the caller guarantees that the kernel does not depend on the work group size and takes
+    // the batch index as the outer part of the global id in the dimension
+    void SetBatchDimension(clKernelData& kernel,
+                           const DataTensor& tensor,
+                           size_t dimension,
+                           const optional_params& options) const;
 };
 }  // namespace kernel_selector
@@ -1142,8 +1142,24 @@ JitConstants FusedOpsCodeGenerator::MakeOpJitConstants(const FusedOpsConfigurati
             break;
         }
         case KernelType::ELTWISE: {
-            op_decls += "\\\n\t" + GetOutputType(vec_size) + " " + out_var + " = " + in_vars_converted[0] +
-                        " + " + ConvertToOutputType(in_var, vec_size) + ";";
+            auto p = desc.GetOpParams<eltwise_fuse_params>();
+            if (!p)
+                throw std::runtime_error("[clDNN] Eltwise fuse params can't be nullptr");
+
+            // the fused primitive output is the first operand of the eltwise
+            auto lhs = ConvertToOutputType(in_var, vec_size);
+            auto rhs = in_vars_converted[0];
+            std::string op;
+            switch (p->mode) {
+                case EltwiseMode::ADD: op = lhs + " + " + rhs; break;
+                case EltwiseMode::SUB: op = lhs + " - " + rhs; break;
+                case EltwiseMode::MUL: op = lhs + " * " + rhs; break;
+                case EltwiseMode::DIV: op = lhs + " / " + rhs; break;
+                case EltwiseMode::MIN: op = "min(" + lhs + ", " + rhs + ")"; break;
+                case EltwiseMode::MAX: op = "max(" + lhs + ", " + rhs + ")"; break;
+                default: throw std::runtime_error("[clDNN] Unsupported mode of fused eltwise");
+            }
+            op_decls += "\\\n\t" + GetOutputType(vec_size) + " " + out_var + " = " + op + ";";
             break;
         }
         case KernelType::QUANTIZE: {
@@ -1273,16 +1289,19 @@ std::string FusedOpsCodeGenerator::GetJitLoad(const FusedOpsConfiguration& conf,
     size_t vec_size = 1;
     auto input_dt = input_tensor.GetDType();
 
-    if (desc.GetType() == KernelType::ELTWISE &&
-        input_tensor.GetLayout() != prim_output.GetLayout() && conf.vec_size > 1) {
-        throw std::runtime_error("[clDNN] Mixed layouts of input tensors are not supported in fused eltwise");
-    }
-
     if (conf.vec_axis != Tensor::DataChannelName::COUNT &&
         DataTensor::Extract(input_tensor.GetLayout(), conf.vec_axis, input_tensor.GetDims()).v != 1) {
         vec_size = conf.vec_size;
     }
 
+    // an input broadcasted along the vector axis is loaded by scalars and the features of a per feature input are
+    // dense in any layout, so such inputs may have a layout different from the output one
+    bool per_feature_input = input_tensor.LogicalSize() == input_tensor.Feature().v;
+    if (desc.GetType() == KernelType::ELTWISE && !per_feature_input &&
+        input_tensor.GetLayout() != prim_output.GetLayout() && vec_size > 1) {
+        throw std::runtime_error("[clDNN] Mixed layouts of input tensors are not supported in fused eltwise");
+    }
+
     auto idx = conf.bfzyx_idx_order;
     if (vec_size == 0 || vec_size > 8)
         throw std::invalid_argument("Invalid vector size in jit definitions: " + std::to_string(vec_size));
@@ -59,14 +59,16 @@ static WeightsFormatSupportType CheckWeights(const weight_bias_params& newParams
         reorderNeeded |= true;
     }
 
-    reorderNeeded |= tensor.GetLayout() != reqLayouts;
-    reorderNeeded |= rotate;
-
-    if (reorderNeeded && !pitchesDifferFromLS && !rotate) {
-        reorderNeeded = !((reqLayouts == WeightsLayout::io && tensor.GetLayout() == WeightsLayout::iyxo) ||
+    bool layoutDiffers = tensor.GetLayout() != reqLayouts;
+    if (layoutDiffers && !pitchesDifferFromLS && !rotate) {
+        // the layouts are the same in memory, but the type may still need the conversion
+        layoutDiffers = !((reqLayouts == WeightsLayout::io && tensor.GetLayout() == WeightsLayout::iyxo) ||
                           (reqLayouts == WeightsLayout::oi && tensor.GetLayout() == WeightsLayout::oiyx));
     }
 
+    reorderNeeded |= layoutDiffers;
+    reorderNeeded |= rotate;
+
     return reorderNeeded ? REORDER_NEEDED : SUPPORTED;
 }
 
@@ -73,6 +73,14 @@ kernel_selector_base::kernel_selector_base() {
 #endif
 }
 
+bool kernel_selector_base::IsBetter(const KernelData& lhs, const KernelData& rhs, const optional_params& options) {
+    // the kernels which can run for the first images of the batch are preferred regardless of their estimated time
+    if (options.preferRuntimeBatch && lhs.SupportsRuntimeBatch() != rhs.SupportsRuntimeBatch()) {
+        return lhs.SupportsRuntimeBatch();
+    }
+    return lhs.estimatedTime < rhs.estimatedTime;
+}
+
 KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
                                                      const optional_params& options,
                                                      KernelType kType) const {
@@ -100,7 +108,7 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
                     }
                 } else {
 #endif
-                    if (kernelsData.size() == 0 || kds[0].estimatedTime < kernelsData[0].estimatedTime) {
+                    if (kernelsData.size() == 0 || IsBetter(kds[0], kernelsData[0], options)) {
                         kernelsData = kds;
                         kernelName = implementation->GetName();
                     }
@@ -125,6 +133,11 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params,
 KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params,
                                                         const optional_params& options,
                                                         KernelType kType) const {
+    // the tuned kernels are chosen for the batch the program is built for
+    if (options.preferRuntimeBatch) {
+        return GetNaiveBestKernel(params, options, kType);
+    }
+
     KernelsData kernelsData;
     std::string kernelName;
 
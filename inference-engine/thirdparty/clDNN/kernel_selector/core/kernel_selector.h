@@ -52,6 +52,8 @@ protected:
 
     KernelList GetAllImplementations(const Params& params, const optional_params& options, KernelType kType) const;
 
+    static bool IsBetter(const KernelData& lhs, const KernelData& rhs, const optional_params& options);
+
     KernelList implementations;
     ForceList forceKernels;
 
@@ -163,6 +163,10 @@ struct clKernelData {
     Arguments arguments;
     Scalars scalars;
     std::string layerID;  // TODO: in order to support run single layer. think about more appropriate place
+    // The dimension of the global work size which is the batch times a constant, the kernel does not depend on the
+    // batch otherwise, so the first images of the batch are processed with a reduced global work size. -1 if the
+    // kernel has to run for the whole batch
+    int batchDimension = -1;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -209,6 +213,15 @@ struct KernelData {
 
     int autoTuneIndex = -1;
 
+    bool SupportsRuntimeBatch() const {
+        for (const auto& kernel : kernels) {
+            if (kernel.batchDimension < 0) {
+                return false;
+            }
+        }
+        return !kernels.empty();
+    }
+
     template <typename T>
     inline static KernelData Default(const Params& _params, size_t kernel_nums = 1) {
         KernelData kd;
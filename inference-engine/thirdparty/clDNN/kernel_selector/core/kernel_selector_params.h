@@ -620,6 +620,7 @@ struct optional_params {
         false;  // allow kernel to ask graph compiler to reorder the input data before executing its
     bool allowOutputReordering =
         false;  // allow kernel to ask graph compiler to reorder the output data before executing the next kernel
+    bool preferRuntimeBatch = false;  // prefer the kernels which can run for the first images of the batch
 
     TuningParams tuningParams;
 
@@ -27,6 +27,12 @@ primitive_type_id detection_output::type_id() {
     return &instance;
 }
 
+bool detection_output_node::use_gpu_kernels() const {
+    auto desc = get_primitive();
+    return get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled() &&
+           !desc->decrease_label_id && !desc->clip_before_nms && !desc->clip_after_nms;
+}
+
 layout detection_output_inst::calc_output_layout(detection_output_node const& node) {
     assert(static_cast<bool>(node.get_primitive()->output_data_type) == false &&
            "Output data type forcing is not supported for "
@@ -65,7 +71,7 @@ layout detection_output_inst::calc_output_layout(detection_output_node const& no
     // Add space for number of output results per image - needed in the next detection output step
     output_size += ((input_layout.size.batch[0] + 15) / 16) * 16;
 
-    if (node.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled()) {
+    if (node.use_gpu_kernels()) {
         return {input_layout.data_type, cldnn::format::bfyx, cldnn::tensor(1, 1, 1, output_size)};
     } else {
         return {input_layout.data_type,
@@ -66,6 +66,10 @@ uint64_t engine::get_temp_used_device_memory_size() const {
     return _impl->get_used_device_memory();
 }
 
+memory_pool_statistics engine::get_memory_pool_statistics() const {
+    return _impl->get_memory_pool().get_statistics();
+}
+
 engine_types engine::get_type() const {
     return _impl->type();
 }
@@ -86,7 +90,8 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.meaningful_kernels_names = conf.meaningful_kernels_names != 0;
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
-    result.host_out_of_order = true;
+    result.host_out_of_order = conf.queue_sync_mode != queue_sync_mode_types::in_order;
+    result.use_event_dependencies = conf.queue_sync_mode == queue_sync_mode_types::events;
     result.use_unifed_shared_memory = true;  // Switch on/off USM.
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
@@ -94,6 +99,9 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.throttle_mode = conf.throttle_mode;
     result.queues_num = conf.n_streams;
     result.tuning_cache_path = conf.tuning_cache_path;
+    result.n_threads = conf.n_threads;
+    result.kernels_per_program = conf.kernels_per_program;
+    result.kernels_cache_path = conf.kernels_cache_path;
     return result;
 }
 
@@ -131,6 +139,10 @@ memory_impl::ptr engine_impl::allocate_memory(const layout& layout,
 }
 
 memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, const layout& new_layout) {
+    return reinterpret_buffer(memory, new_layout, memory.get_net_id());
+}
+
+memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, const layout& new_layout, uint32_t net_id) {
     if (memory.get_engine() != (const refcounted_obj_ptr<engine_impl>) this)
         throw std::runtime_error("trying to reinterpret buffer allocated by a different engine");
 
@@ -146,7 +158,7 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, cons
                 new gpu::gpu_image2d((refcounted_obj_ptr<engine_impl>) this,
                                      new_layout,
                                      reinterpret_cast<const gpu::gpu_image2d&>(memory).get_buffer(),
-                                     memory.get_net_id()),
+                                     net_id),
                                      false };
             return mem_impl;
         } else if (memory_capabilities::is_usm_type(memory.get_allocation_type())) {
@@ -155,7 +167,7 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, cons
                                         new_layout,
                                         reinterpret_cast<const gpu::gpu_usm&>(memory).get_buffer(),
                                         memory.get_allocation_type(),
-                                        memory.get_net_id()),
+                                        net_id),
                                         false };
             return mem_impl;
         } else {
@@ -163,7 +175,7 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, cons
                 new gpu::gpu_buffer((refcounted_obj_ptr<engine_impl>) this,
                                     new_layout,
                                     reinterpret_cast<const gpu::gpu_buffer&>(memory).get_buffer(),
-                                    memory.get_net_id()),
+                                    net_id),
                                     false};
             return mem_impl;
         }
@@ -43,6 +43,10 @@ void event::set_event_handler(event_handler handler, void* param) const {
     _impl->add_event_handler(handler, param);
 }
 
+void* event::get_ocl_handle() const {
+    return _impl->get_ocl_handle();
+}
+
 std::vector<instrumentation::profiling_interval> event::get_profiling_info() const {
     auto interval_list = _impl->get_profiling_info();
     std::vector<instrumentation::profiling_interval> result(interval_list.size());
@@ -25,6 +25,7 @@ configuration::configuration()
       meaningful_kernels_names(false),
       dump_custom_program(false),
       host_out_of_order(true),
+      use_event_dependencies(false),
       use_unifed_shared_memory(false),
       compiler_options(""),
       single_kernel_name(""),
@@ -33,6 +34,9 @@ configuration::configuration()
       priority_mode(priority_mode_types::disabled),
       throttle_mode(throttle_mode_types::disabled),
       queues_num(0),
-      tuning_cache_path("cache.json") {}
+      tuning_cache_path("cache.json"),
+      n_threads(1),
+      kernels_per_program(10),
+      kernels_cache_path("") {}
 }  // namespace gpu
 }  // namespace cldnn
@@ -33,6 +33,7 @@ struct configuration {
     bool meaningful_kernels_names;
     bool dump_custom_program;
     bool host_out_of_order;
+    bool use_event_dependencies;  // out-of-order queue waits for the events of dependencies instead of barriers
     bool use_unifed_shared_memory;
     std::string compiler_options;
     std::string single_kernel_name;
@@ -42,6 +43,9 @@ struct configuration {
     throttle_mode_types throttle_mode;
     uint16_t queues_num;
     std::string tuning_cache_path;
+    uint16_t n_threads;
+    uint32_t kernels_per_program;
+    std::string kernels_cache_path;
 };
 }  // namespace gpu
 }  // namespace cldnn
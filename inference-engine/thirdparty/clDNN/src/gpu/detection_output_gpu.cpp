@@ -61,7 +61,7 @@ private:
 
 public:
     static primitive_impl* create(const detection_output_node& arg) {
-        if (!arg.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled()) {
+        if (!arg.use_gpu_kernels()) {
             return runDetectOutCpu(arg);
         }
 
@@ -16,11 +16,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iterator>
 #include "kernel.h"
 #include "memory_gpu.h"
 #include "memory_impl.h"
 #include "refcounted_obj.h"
+#include <type_traits>
 #include <vector>
 
 namespace cldnn {
@@ -40,7 +42,61 @@ inline cl::NDRange toNDRange(const std::vector<size_t>& v) {
     }
 }
 
-void set_arguments(kernels_cache::kernel_type& kernel,
+// Sets the arguments of an OpenCL kernel skipping the ones which already have the same values. A kernel keeps its
+// arguments between enqueues, so a network executed with the same memory objects passes them to the driver once.
+class kernel_arguments_binder {
+public:
+    kernel_arguments_binder(kernels_cache::kernel_type& kernel, std::vector<std::vector<uint8_t>>& bound)
+        : _kernel(kernel), _bound(bound) {}
+
+    cl_int setArg(cl_uint index, const cl::Memory& mem) {
+        const cl_mem handle = mem();
+        if (is_bound(index, &handle, sizeof(handle)))
+            return CL_SUCCESS;
+        return bind(index, _kernel.setArg(index, mem));
+    }
+
+    cl_int setArgUsm(cl_uint index, const cl::UsmMemory& mem) {
+        const void* ptr = mem.get();
+        if (is_bound(index, &ptr, sizeof(ptr)))
+            return CL_SUCCESS;
+        return bind(index, _kernel.setArgUsm(index, mem));
+    }
+
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    cl_int setArg(cl_uint index, const T& value) {
+        if (is_bound(index, &value, sizeof(value)))
+            return CL_SUCCESS;
+        return bind(index, _kernel.setArg(index, value));
+    }
+
+private:
+    // remembers the new value of the argument, it is committed when the driver accepts it
+    bool is_bound(cl_uint index, const void* value, size_t size) {
+        if (_bound.size() <= index)
+            _bound.resize(index + 1);
+        auto bytes = static_cast<const uint8_t*>(value);
+        auto& bound = _bound[index];
+        if (bound.size() == size && std::equal(bytes, bytes + size, bound.begin()))
+            return true;
+        _pending.assign(bytes, bytes + size);
+        return false;
+    }
+
+    cl_int bind(cl_uint index, cl_int status) {
+        if (status == CL_SUCCESS)
+            _bound[index].swap(_pending);
+        else
+            _bound[index].clear();
+        return status;
+    }
+
+    kernels_cache::kernel_type& _kernel;
+    std::vector<std::vector<uint8_t>>& _bound;
+    std::vector<uint8_t> _pending;
+};
+
+void set_arguments(kernel_arguments_binder& kernel,
                    const kernel_selector::kernel_arguments& args,
                    const kernel::kernel_arguments_data& data) {
     for (uint32_t i = 0; i < static_cast<uint32_t>(args.size()); i++) {
@@ -250,15 +306,25 @@ event_impl::ptr kernel::run(uint32_t queue_id,
                             const kernel_arguments_data& args) const {
     static std::mutex m;
     std::lock_guard<std::mutex> guard(m);
-    auto clkernel = context()->get_kernels_cache(_prog_id).get_kernel(_kernel_id, _one_time_kernel);
+    auto& bound = *_bound;
+    // one time kernels can be removed from the cache, so their handles are not kept
+    if (bound.cl_kernel() == nullptr || _one_time_kernel) {
+        bound.cl_kernel = context()->get_kernels_cache(_prog_id).get_kernel(_kernel_id, _one_time_kernel);
+        bound.arguments.clear();
+    }
     try {
-        set_arguments(clkernel, kernel_data.arguments, args);
+        kernel_arguments_binder binder(bound.cl_kernel, bound.arguments);
+        set_arguments(binder, kernel_data.arguments, args);
     } catch (cl::Error const& err) {
+        bound.arguments.clear();
         throw ocl_error(err);
+    } catch (...) {
+        bound.arguments.clear();
+        throw;
     }
 
     return context()->enqueue_kernel(queue_id,
-                                     clkernel,
+                                     bound.cl_kernel,
                                      toNDRange(kernel_data.workGroups.global),
                                      toNDRange(kernel_data.workGroups.local),
                                      dependencies);
@@ -34,6 +34,13 @@ class kernel : public context_holder {
     kernels_cache::kernel_id _kernel_id;
     bool _one_time_kernel;  // If this flag is true, the kernel is intended to be executed only once (can be removed
                             // later from the cache).
+    // The OpenCL kernel and the values of its arguments set by the last run. The copies of the kernel run the same
+    // OpenCL kernel, so they share it. Guarded by the run mutex.
+    struct bound_kernel {
+        kernels_cache::kernel_type cl_kernel;
+        std::vector<std::vector<uint8_t>> arguments;
+    };
+    std::shared_ptr<bound_kernel> _bound;
 
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context,
@@ -45,10 +52,12 @@ public:
           _prog_id(prog_id),
           _kernel_id(
               context->get_kernels_cache(prog_id).set_kernel_source(kernel_string, dump_custom_program, one_time_kernel)),
-          _one_time_kernel(one_time_kernel) {}
+          _one_time_kernel(one_time_kernel),
+          _bound(std::make_shared<bound_kernel>()) {}
 
     kernel(const kernel& other)
-        : context_holder(other.context()), _prog_id(other._prog_id), _kernel_id(other._kernel_id), _one_time_kernel(other._one_time_kernel) {}
+        : context_holder(other.context()), _prog_id(other._prog_id), _kernel_id(other._kernel_id), _one_time_kernel(other._one_time_kernel),
+          _bound(other._bound) {}
 
     kernel& operator=(const kernel& other) {
         if (this == &other) {
@@ -58,6 +67,7 @@ public:
         _kernel_id = other._kernel_id;
         _prog_id = other._prog_id;
         _one_time_kernel = other._one_time_kernel;
+        _bound = other._bound;
 
         return *this;
     }
@@ -19,17 +19,21 @@
 #include "ocl_toolkit.h"
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <sstream>
 #include <fstream>
 #include <set>
 #include <string>
 #include <memory>
 #include <utility>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <vector>
 
 #include "kernel_selector_helper.h"
 
-#define MAX_KERNELS_PER_PROGRAM 10
-
 namespace cldnn {
 namespace gpu {
 
@@ -99,6 +103,66 @@ std::string reorder_options(const std::string& org_options) {
 inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
+
+// Returns the name of the file where the compiled program is cached, or an empty string if caching is disabled.
+// The key covers everything which affects the binary: program sources, build options, device and driver.
+std::string get_binary_cache_file_name(const std::string& cache_dir,
+                                       const kernels_cache::source_code& sources,
+                                       const std::string& options,
+                                       const device_info_internal& device_info) {
+    if (cache_dir.empty())
+        return {};
+
+    std::hash<std::string> hasher;
+    size_t seed = 0;
+    auto combine = [&](const std::string& value) {
+        seed ^= hasher(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    for (const auto& s : sources) combine(s);
+    combine(options);
+    combine(device_info.dev_name);
+    combine(device_info.driver_version);
+    combine(std::to_string(device_info.vendor_id));
+
+    auto file_name = cache_dir;
+    if (file_name.back() != '/')
+        file_name += '/';
+    return file_name + "clDNN_program_" + std::to_string(seed) + ".cl_cache";
+}
+
+std::vector<unsigned char> load_binary(const std::string& file_name) {
+    std::vector<unsigned char> binary;
+    std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+    if (file.good()) {
+        auto size = file.tellg();
+        if (size > 0) {
+            binary.resize(static_cast<size_t>(size));
+            file.seekg(0, std::ios::beg);
+            if (!file.read(reinterpret_cast<char*>(binary.data()), size))
+                binary.clear();
+        }
+    }
+    return binary;
+}
+
+// The binary is written to a temporary file first, so concurrent processes never read a partially written one
+void save_binary(const std::string& file_name, const std::vector<unsigned char>& binary) {
+    std::stringstream tmp_file_name;
+    tmp_file_name << file_name << "." << std::this_thread::get_id() << ".tmp";
+    {
+        std::ofstream file(tmp_file_name.str(), std::ios::binary | std::ios::trunc);
+        if (!file.good())
+            return;
+        file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_file_name.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_file_name.str().c_str(), file_name.c_str()) != 0)
+        std::remove(tmp_file_name.str().c_str());
+}
 }  // namespace
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const {
@@ -140,7 +204,7 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             current_bucket.options = options;
         }
 
-        if ((current_bucket.kernels_counter % MAX_KERNELS_PER_PROGRAM) == 0) {
+        if ((current_bucket.kernels_counter % _context.get_configuration().kernels_per_program) == 0) {
             current_bucket.source.push_back({});
         }
 
@@ -183,8 +247,8 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const {
-    static uint32_t current_file_index = 0;
+std::string kernels_cache::get_dump_file_name(const program_code& program_source) const {
+    static std::atomic<uint32_t> current_file_index{0};
 
     bool dump_sources =
         !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
@@ -197,61 +261,85 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
 
         dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
     }
+    return dump_file_name;
+}
+
+kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source,
+                                                        size_t part_idx,
+                                                        const std::string& dump_file_name,
+                                                        std::string& err_log) const {
+    bool dump_sources = !dump_file_name.empty();
 
     try {
         kernels_map kmap;
-        std::string err_log;  // accumulated build log from all program's parts (only contains messages from parts which
-                              // failed to compile)
+        const auto& sources = program_source.source[part_idx];
+        auto current_dump_file_name = dump_file_name + std::to_string(part_idx) + ".cl";
+        std::ofstream dump_file;
 
-        uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source) {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            std::ofstream dump_file;
+        if (dump_sources) {
+            dump_file.open(current_dump_file_name);
 
-            if (dump_sources) {
-                dump_file.open(current_dump_file_name);
+            if (dump_file.good()) {
+                for (auto& s : sources) dump_file << s;
+            }
+        }
 
-                if (dump_file.good()) {
-                    for (auto& s : sources) dump_file << s;
+        try {
+            const auto device_info = _context.get_device_info();
+            const auto cache_file_name = get_binary_cache_file_name(_context.get_configuration().kernels_cache_path,
+                                                                    sources, program_source.options, device_info);
+            cl::Program program;
+            bool loaded_from_cache = false;
+            auto binary = cache_file_name.empty() ? std::vector<unsigned char>{} : load_binary(cache_file_name);
+            if (!binary.empty()) {
+                try {
+                    program = cl::Program(_context.context(), {_context.device()}, {binary});
+                    program.build({_context.device()}, program_source.options.c_str());
+                    loaded_from_cache = true;
+                } catch (const cl::Error&) {
+                    // the cached binary is stale or corrupted, so the program is compiled from sources
                 }
             }
 
-            try {
-                cl::Program program(_context.context(), sources);
+            if (!loaded_from_cache) {
+                program = cl::Program(_context.context(), sources);
                 program.build({_context.device()}, program_source.options.c_str());
 
-                if (dump_sources && dump_file.good()) {
-                    dump_file << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>()) dump_file << p.second << "\n";
-
-                    dump_file << "*/\n";
+                if (!cache_file_name.empty()) {
+                    auto binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+                    if (binaries.size() == 1 && !binaries.front().empty())
+                        save_binary(cache_file_name, binaries.front());
                 }
+            }
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+            if (dump_sources && dump_file.good()) {
+                dump_file << "\n/* Build Log:\n";
+                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>()) dump_file << p.second << "\n";
 
-                for (auto& k : kernels) {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, kernels_cache::kernel_type(k, _context.get_device_info().supports_usm));
-                }
-            } catch (const cl::BuildError& err) {
-                if (dump_sources && dump_file.good())
-                    dump_file << "\n/* Build Log:\n";
+                dump_file << "*/\n";
+            }
 
-                for (auto& p : err.getBuildLog()) {
-                    if (dump_sources && dump_file.good())
-                        dump_file << p.second << "\n";
+            cl::vector<cl::Kernel> kernels;
+            program.createKernels(&kernels);
 
-                    err_log += p.second + '\n';
-                }
+            for (auto& k : kernels) {
+                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                kmap.emplace(kernel_name, kernels_cache::kernel_type(k, device_info.supports_usm));
+            }
+        } catch (const cl::BuildError& err) {
+            if (dump_sources && dump_file.good())
+                dump_file << "\n/* Build Log:\n";
 
+            for (auto& p : err.getBuildLog()) {
                 if (dump_sources && dump_file.good())
-                    dump_file << "*/\n";
+                    dump_file << p.second << "\n";
+
+                err_log += p.second + '\n';
             }
-        }
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+            if (dump_sources && dump_file.good())
+                dump_file << "*/\n";
+        }
 
         return kmap;
     } catch (const cl::Error& err) {
@@ -276,14 +364,66 @@ void kernels_cache::build_all() {
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    // Parts of programs do not depend on each other, so all of them are compiled in parallel
+    struct build_unit {
+        program_code* program;
+        size_t part_idx;
+        std::string dump_file_name;
+        kernels_map kernels;
+        std::string err_log;  // build log of the part if it failed to compile
+        std::exception_ptr error;
+    };
+    std::vector<build_unit> units;
     for (auto& program : sorted_program_code) {
-        auto kernels = build_program(program.second);
+        auto dump_file_name = get_dump_file_name(program.second);
+        for (size_t part_idx = 0; part_idx < program.second.source.size(); part_idx++) {
+            units.push_back({&program.second, part_idx, dump_file_name, {}, {}, nullptr});
+        }
+    }
+
+    std::atomic<size_t> next_unit{0};
+    auto build_units = [&] {
+        for (auto i = next_unit++; i < units.size(); i = next_unit++) {
+            auto& unit = units[i];
+            try {
+                unit.kernels = build_program(*unit.program, unit.part_idx, unit.dump_file_name, unit.err_log);
+            } catch (...) {
+                unit.error = std::current_exception();
+            }
+        }
+    };
+
+    const auto n_threads = std::min<size_t>(_context.get_configuration().n_threads, units.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < n_threads; i++) {
+        try {
+            threads.emplace_back(build_units);
+        } catch (const std::system_error&) {
+            break;  // the units are built by the threads which are already started
+        }
+    }
+    build_units();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    _one_time_kernels.clear();
+
+    std::string err_log;  // accumulated build log from all program's parts (only contains messages from parts which
+                          // failed to compile)
+    for (auto& unit : units) {
+        if (unit.error)
+            std::rethrow_exception(unit.error);
+        err_log += unit.err_log;
+    }
+    if (!err_log.empty())
+        throw std::runtime_error("Program build failed:\n" + std::move(err_log));
 
-        for (auto& k : kernels) {
+    for (auto& unit : units) {
+        for (auto& k : unit.kernels) {
             const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time) {
+            const auto& k_id = unit.program->entry_point_to_id[entry_point];
+            if (unit.program->one_time) {
                 _one_time_kernels[k_id] = k.second;
             } else {
                 _kernels[k_id] = k.second;
@@ -94,7 +94,11 @@ private:
     uint32_t _prog_id;
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
-    kernels_map build_program(const program_code& pcode) const;
+    std::string get_dump_file_name(const program_code& pcode) const;
+    kernels_map build_program(const program_code& pcode,
+                              size_t part_idx,
+                              const std::string& dump_file_name,
+                              std::string& err_log) const;
 
 public:
     explicit kernels_cache(gpu_toolkit& context, uint32_t prog_id);
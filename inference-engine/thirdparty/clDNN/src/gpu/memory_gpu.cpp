@@ -69,6 +69,12 @@ void gpu_buffer::fill(unsigned char pattern, event_impl::ptr ev) {
     _context->queue(_net_id).enqueueFillBuffer<unsigned char>(_buffer, pattern, 0, size(), 0, &ev_ocl);
 }
 
+event_impl::ptr gpu_buffer::copy_from(const void* host_ptr) {
+    cl::Event ev_ocl;
+    _context->queue(_net_id).enqueueWriteBuffer(_buffer, CL_FALSE, 0, size(), host_ptr, nullptr, &ev_ocl);
+    return event_impl::ptr(new base_event(_context, ev_ocl), false);
+}
+
 shared_mem_params gpu_buffer::get_internal_params() const {
     return {shared_mem_type::shared_mem_buffer, static_cast<shared_handle>(_context->context().get()), nullptr,
             static_cast<shared_handle>(_buffer.get()),
@@ -182,6 +188,14 @@ void gpu_image2d::fill(unsigned char pattern, event_impl::ptr ev) {
     _context->queue(_net_id).enqueueFillImage(_buffer, pattern_uint4, {0, 0, 0}, {_width, _height, 1}, 0, &ev_ocl);
 }
 
+event_impl::ptr gpu_image2d::copy_from(const void* host_ptr) {
+    cl::Event ev_ocl;
+    // host data is tightly packed, so the pitches are calculated by the runtime
+    _context->queue(_net_id).enqueueWriteImage(_buffer, CL_FALSE, {0, 0, 0}, {_width, _height, 1}, 0, 0,
+                                               const_cast<void*>(host_ptr), nullptr, &ev_ocl);
+    return event_impl::ptr(new base_event(_context, ev_ocl), false);
+}
+
 shared_mem_params gpu_image2d::get_internal_params() const {
     return {shared_mem_type::shared_mem_image, static_cast<shared_handle>(_context->context().get()), nullptr,
             static_cast<shared_handle>(_buffer.get()),
@@ -287,6 +301,12 @@ void gpu_usm::fill(unsigned char pattern, event_impl::ptr ev) {
     cl::usm::enqueue_memcpy(_engine->get_context()->queue(_net_id), _buffer.get(), temp_buffer.data(), _bytes_count, true, nullptr, &ev_ocl);
 }
 
+event_impl::ptr gpu_usm::copy_from(const void* host_ptr) {
+    cl::Event ev_ocl;
+    cl::usm::enqueue_memcpy(_engine->get_context()->queue(_net_id), _buffer.get(), host_ptr, _bytes_count, false, nullptr, &ev_ocl);
+    return event_impl::ptr(new base_event(_engine->get_context(), ev_ocl), false);
+}
+
 void gpu_usm::zero_buffer() {
     // event_impl::ptr ev{ new base_event(_engine->get_context()), false };
     // cl::Event ev_ocl = dynamic_cast<base_event*>(ev.get())->get();
@@ -86,6 +86,7 @@ struct gpu_buffer : public lockable_gpu_mem, public memory_impl {
     void* lock() override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    event_impl::ptr copy_from(const void* host_ptr) override;
     shared_mem_params get_internal_params() const override;
     const cl::Buffer& get_buffer() const {
         assert(0 == _lock_count);
@@ -110,6 +111,7 @@ struct gpu_image2d : public lockable_gpu_mem, public memory_impl {
     void* lock() override;
     void unlock() override;
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    event_impl::ptr copy_from(const void* host_ptr) override;
     shared_mem_params get_internal_params() const override;
     const cl::Image2D& get_buffer() const {
         assert(0 == _lock_count);
@@ -177,6 +179,7 @@ struct gpu_usm : public lockable_gpu_mem, public memory_impl {
     cl::UsmMemory& get_buffer() { return _buffer; }
 
     void fill(unsigned char pattern, event_impl::ptr ev) override;
+    event_impl::ptr copy_from(const void* host_ptr) override;
     void zero_buffer();
     void copy_from_other(const gpu_usm& other);
     shared_mem_params get_internal_params() const override;
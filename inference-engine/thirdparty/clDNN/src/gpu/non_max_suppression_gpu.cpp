@@ -0,0 +1,72 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "non_max_suppression_inst.h"
+#include "primitive_gpu_base.h"
+#include "implementation_map.h"
+#include "kernel_selector_helper.h"
+#include "non_max_suppression/non_max_suppression_kernel_selector.h"
+#include "non_max_suppression/non_max_suppression_kernel_ref.h"
+#include "register_gpu.hpp"
+
+namespace cldnn {
+namespace gpu {
+
+struct non_max_suppression_gpu : typed_primitive_gpu_impl<non_max_suppression> {
+    using parent = typed_primitive_gpu_impl<non_max_suppression>;
+    using parent::parent;
+
+public:
+    static primitive_impl* create(const non_max_suppression_node& arg) {
+        auto nms_params = get_default_params<kernel_selector::non_max_suppression_params>(arg);
+        auto nms_optional_params =
+            get_default_optional_params<kernel_selector::non_max_suppression_optional_params>(arg.get_program());
+
+        for (size_t i = 1; i < arg.get_dependencies().size(); i++) {
+            nms_params.inputs.push_back(convert_data_tensor(arg.get_dependency(i).get_output_layout()));
+        }
+
+        auto primitive = arg.get_primitive();
+        nms_params.center_point_box = primitive->center_point_box;
+        nms_params.has_num_select_per_class = arg.has_num_select_per_class();
+        nms_params.has_iou_threshold = arg.has_iou_threshold();
+        nms_params.has_score_threshold = arg.has_score_threshold();
+
+        auto& kernel_selector = kernel_selector::non_max_suppression_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(nms_params, nms_optional_params);
+
+        // too many boxes to sort them in local memory
+        if (best_kernels.empty()) {
+            return runNonMaxSuppressionCpu(arg);
+        }
+
+        return new non_max_suppression_gpu(arg, best_kernels[0]);
+    }
+};
+
+namespace detail {
+
+attach_non_max_suppression_gpu::attach_non_max_suppression_gpu() {
+    implementation_map<non_max_suppression>::add({
+        {std::make_tuple(engine_types::ocl, data_types::i32, format::bfyx), non_max_suppression_gpu::create},
+        {std::make_tuple(engine_types::ocl, data_types::f16, format::bfyx), non_max_suppression_gpu::create},
+        {std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx), non_max_suppression_gpu::create}
+    });
+}
+
+}  // namespace detail
+}  // namespace gpu
+}  // namespace cldnn
@@ -55,6 +55,7 @@ public:
 
     std::shared_ptr<gpu_toolkit> get_context() const { return _ctx; }
     cl::Event get() { return _event; }
+    void* get_ocl_handle() override { return _event(); }
 
 private:
     std::shared_ptr<gpu_toolkit> _ctx;
@@ -92,6 +93,7 @@ public:
     }
 
     std::shared_ptr<gpu_toolkit> get_context() const { return _ctx; }
+    const std::vector<event_impl::ptr>& get_events() const { return _events; }
 
 private:
     void set_queue_stamp() {
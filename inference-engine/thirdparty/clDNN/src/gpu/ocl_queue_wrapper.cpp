@@ -64,6 +64,18 @@ std::string events_list_to_string(std::vector<cldnn::event_impl::ptr> events) {
     ret += ")";
     return ret;
 }
+
+// Grouped events are expanded, since an out-of-order queue with event dependencies has to wait for all of them
+void collect_ocl_events(std::vector<cldnn::event_impl::ptr> const& deps, std::vector<cl::Event>& dep_events) {
+    for (auto& dep : deps) {
+        if (auto ocl_ev = dynamic_cast<cldnn::gpu::base_event*>(dep.get())) {
+            if (ocl_ev->get()() != nullptr)
+                dep_events.push_back(ocl_ev->get());
+        } else if (auto ocl_evs = dynamic_cast<cldnn::gpu::base_events*>(dep.get())) {
+            collect_ocl_events(ocl_evs->get_events(), dep_events);
+        }
+    }
+}
 }  // namespace
 
 namespace cldnn {
@@ -78,10 +90,8 @@ event_impl::ptr gpu_queue::enqueue_kernel(kernels_cache::kernel_type const& kern
                                           std::vector<event_impl::ptr> const& deps) {
     std::vector<cl::Event> dep_events;
     auto dep_events_ptr = &dep_events;
-    if (!context()->get_configuration().host_out_of_order) {
-        for (auto& dep : deps)
-            if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                dep_events.push_back(ocl_ev->get());
+    if (!context()->get_configuration().host_out_of_order || context()->get_configuration().use_event_dependencies) {
+        collect_ocl_events(deps, dep_events);
     } else {
         dep_events_ptr = nullptr;
 
@@ -91,7 +101,9 @@ event_impl::ptr gpu_queue::enqueue_kernel(kernels_cache::kernel_type const& kern
     cl::Event ret_ev;
 
     try {
-        if (!context()->get_configuration().host_out_of_order || _output_event ||
+        // users of the kernel wait for its event when dependencies are tracked with events, an in-order queue and
+        // barriers order the kernels themselves, so only the kernels whose results are read by the host need events
+        if (context()->get_configuration().use_event_dependencies || _output_event ||
             context()->get_configuration().enable_profiling) {
             _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         } else {
@@ -109,13 +121,11 @@ event_impl::ptr gpu_queue::enqueue_marker(std::vector<event_impl::ptr> const& de
         return _events_pool->get_from_user_pool(context(), true);
 
     bool enabled_single_kernel = context()->get_configuration().single_kernel_name == "" ? false : true;
-    if (!context()->get_configuration().host_out_of_order) {
+    if (!context()->get_configuration().host_out_of_order || context()->get_configuration().use_event_dependencies) {
         cl::Event ret_ev;
         if (!enabled_single_kernel) {
             std::vector<cl::Event> dep_events;
-            for (auto& dep : deps)
-                if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
-                    dep_events.push_back(ocl_ev->get());
+            collect_ocl_events(deps, dep_events);
 
             try {
                 _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
@@ -137,6 +147,31 @@ event_impl::ptr gpu_queue::enqueue_marker(std::vector<event_impl::ptr> const& de
     }
 }
 
+event_impl::ptr gpu_queue::enqueue_completion_marker() {
+    // a marker without a wait list waits for all the commands enqueued before it in any queue mode
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+    // the event is handed out of the network, so it is not taken from the pool which is reset by the next execution
+    return event_impl::ptr(new base_event(context(), ret_ev, ++_queue_counter), false);
+}
+
+void gpu_queue::enqueue_wait(std::vector<event_impl::ptr> const& deps) {
+    std::vector<cl::Event> dep_events;
+    collect_ocl_events(deps, dep_events);
+    if (dep_events.empty())
+        return;
+
+    try {
+        _command_queue.enqueueBarrierWithWaitList(&dep_events, nullptr);
+    } catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+}
+
 event_impl::ptr gpu_queue::group_events(std::vector<event_impl::ptr> const& deps) {
     return _events_pool->get_from_group_pool(context(), deps);
 }
@@ -124,8 +124,10 @@ gpu_toolkit::gpu_toolkit(const device_impl& device_impl, const configuration& co
                    << "    compiler options: " << _configuration.compiler_options << "\n"
                    << "    single kernel name: " << _configuration.single_kernel_name << "\n"
                    << "    out-of-order: " << std::boolalpha << config.host_out_of_order << "\n"
+                   << "    event dependencies: " << std::boolalpha << config.use_event_dependencies << "\n"
                    << "    engine log: " << _configuration.log << "\n"
                    << "    sources dumps: " << _configuration.ocl_sources_dumps_dir << "\n"
+                   << "    kernels cache: " << _configuration.kernels_cache_path << "\n"
                    << "\nEngine info:\n"
                    << "    cores count: " << device_info.cores_count << "\n"
                    << "    core frequencey: " << device_info.core_frequency << "\n"
@@ -206,6 +208,14 @@ event_impl::ptr gpu_toolkit::enqueue_marker(uint32_t queue_id, std::vector<event
     return get_command_queue(queue_id).enqueue_marker(deps);
 }
 
+event_impl::ptr gpu_toolkit::enqueue_completion_marker(uint32_t queue_id) {
+    return get_command_queue(queue_id).enqueue_completion_marker();
+}
+
+void gpu_toolkit::enqueue_wait(uint32_t queue_id, std::vector<event_impl::ptr> const& deps) {
+    get_command_queue(queue_id).enqueue_wait(deps);
+}
+
 event_impl::ptr gpu_toolkit::group_events(uint32_t queue_id, std::vector<event_impl::ptr> const& deps) {
     return get_command_queue(queue_id).group_events(deps);
 }
@@ -78,6 +78,7 @@ struct typed_primitive_gpu_impl : public typed_primitive_impl<PType> {
         }
     }
     bool is_cpu() const override { return false; }
+    bool supports_runtime_batch() const override { return get_split() == 1 && _kernel_data.SupportsRuntimeBatch(); }
 
 protected:
     virtual bool optimized_out(typed_primitive_inst<PType>&) const { return false; }
@@ -127,6 +128,11 @@ protected:
 
         std::vector<event_impl::ptr> tmp_events(events);
 
+        // the kernels run for the first images of the batch when the network has a runtime batch
+        auto runtime_batch = instance.get_network().get_runtime_batch();
+        auto batch = _outer.get_output_layout().size.batch[0];
+        bool part_of_batch = runtime_batch != 0 && runtime_batch != batch;
+
         // TODO - split should be handle in kernel selector by providing multiple kernels.
         auto split = get_split();
 
@@ -152,7 +158,15 @@ protected:
                     _kernels[k].set_output_event(net_id, instance.node.is_output());
                 }
 
-                auto event = _kernels[k].run(net_id, _kernel_data.kernels[k], tmp_events, args);
+                event_impl::ptr event;
+                if (part_of_batch) {
+                    auto kernel_data = _kernel_data.kernels[k];
+                    auto& global = kernel_data.workGroups.global[kernel_data.batchDimension];
+                    global = global / static_cast<size_t>(batch) * static_cast<size_t>(runtime_batch);
+                    event = _kernels[k].run(net_id, kernel_data, tmp_events, args);
+                } else {
+                    event = _kernels[k].run(net_id, _kernel_data.kernels[k], tmp_events, args);
+                }
                 new_events.push_back(event);
             }
 
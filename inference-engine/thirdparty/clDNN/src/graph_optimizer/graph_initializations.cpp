@@ -126,8 +126,7 @@ void graph_initializations::handle_detection_output(program_impl& p) {
         auto node_itr = itr++;
         auto& node = *(*node_itr).second;
         // Create second part detection output primitive and replace nodes names - do it only once
-        if ((p.get_options().get<build_option_type::detection_output_gpu>()->enabled()) &&
-            (node.is_type<detection_output>()) &&
+        if ((node.is_type<detection_output>()) && node.as<detection_output>().use_gpu_kernels() &&
             (node.id().find("_pre") ==
              std::string::npos)) {  // ToDo: this will fail if user will name the primitive with using _pre like do_pre
                                     //       we need to use node mark() or some other idea to prevent it
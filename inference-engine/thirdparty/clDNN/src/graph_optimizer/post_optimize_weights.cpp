@@ -23,6 +23,10 @@
 #include "include/binary_convolution_inst.h"
 #include "include/deformable_convolution_inst.h"
 #include "lstm_dynamic_input_inst.h"
+#include "generic_layer.hpp"
+#include "data_inst.h"
+#include <string>
+#include <memory>
 
 namespace cldnn {
 
@@ -58,6 +62,31 @@ void post_optimize_weights::optimize_weights(T& node, program_impl& p) {
 
         auto reorders = _rf.get_weights_reorder(weights_node.id(), weights_layout, weights_reorder_params);
 
+        // the weights reordered by a previous build are uploaded instead of executing the reorders
+        std::string cache_file;
+        auto& cache = p.get_weights_cache();
+        if (!reorders.empty() && weights_node.template is_type<data>() && cache.enabled()) {
+            auto g_prim = std::static_pointer_cast<generic_layer>(reorders.back().first);
+            const auto cached_id = "_cldnn_weights_cache_" + g_prim->id;
+            // the weights are shared with a node which has already loaded them
+            if (p.has_node(cached_id)) {
+                p.add_intermediate(p.get_node(cached_id), node, i, false);
+                p.remove_if_dangling(weights_node);
+                continue;
+            }
+            if (!reorders.back().second) {
+                cache_file = cache.get_file_name(weights_node.template as<data>().get_attached_memory(),
+                                                 weights_reorder_params, g_prim->output_layout);
+                if (auto cached = cache.load(p.get_engine(), cache_file, g_prim->output_layout)) {
+                    auto& cached_node = p.get_or_create(std::make_shared<data>(cached_id, memory(cached.detach())));
+                    p.get_processing_order().insert_next(&weights_node, &cached_node);
+                    p.add_intermediate(cached_node, node, i, false);
+                    p.remove_if_dangling(weights_node);
+                    continue;
+                }
+            }
+        }
+
         for (auto& reorder : reorders) {
             // insert new generic_layer node to topology
             p.add_intermediate(reorder.first, node, i, !reorder.second);
@@ -66,6 +95,9 @@ void post_optimize_weights::optimize_weights(T& node, program_impl& p) {
             g_node.get_output_layout(false);
             g_node.selected_impl = g_node.type()->choose_impl(p.get_engine(), g_node);
         }
+        // the reordered weights are saved once propagate_constants computes them
+        if (!cache_file.empty())
+            cache.add_pending(node.get_dependency(i).id(), cache_file);
     }
 
     // Reset weights reorder params to not keep source code pointer
@@ -50,6 +50,7 @@
 #include "cum_sum_inst.h"
 #include "embedding_bag_inst.h"
 #include "extract_image_patches_inst.h"
+#include <algorithm>
 #include <vector>
 #include <list>
 #include <memory>
@@ -504,25 +505,54 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
 
         auto fuse_eltwise_f = [&](eltwise_node& node) {
             std::shared_ptr<const cldnn::eltwise> prim = node.get_primitive();
+            const std::vector<eltwise_mode> supported_modes = {
+                eltwise_mode::sum, eltwise_mode::sub, eltwise_mode::prod,
+                eltwise_mode::div, eltwise_mode::min, eltwise_mode::max
+            };
+
             if (node.is_output() || node.inputs_count() != 2 ||
-                prim->mode != eltwise_mode::sum || !prim->stride.empty())
+                std::find(supported_modes.begin(), supported_modes.end(), prim->mode) == supported_modes.end() ||
+                !prim->stride.empty())
                 return;
 
+            for (auto coefficient : prim->coefficients)
+                if (coefficient != 1.f)
+                    return;
+
             std::vector<cldnn::program_node*> parents = node.get_dependencies();
             std::list<cldnn::program_node*> users = node.get_users();
 
             auto parent1 = parents[0];
             auto parent2 = parents[1];
 
-            bool can_fuse_parent1 = (parent1->is_type<convolution>() && conv_supports_fusings(parent1->as<convolution>())) ||
-                                    (parent1->is_type<mvn>() && mvn_supports_fusings(parent1->as<mvn>())) ||
-                                    (parent1->is_type<deconvolution>()) || (parent1->is_type<permute>()) ||
-                                    (parent1->is_type<depth_to_space>()) || (parent1->is_type<gemm>());
-
-            bool can_fuse_parent2 = (parent2->is_type<convolution>() && conv_supports_fusings(parent2->as<convolution>())) ||
-                                    (parent2->is_type<mvn>() && mvn_supports_fusings(parent2->as<mvn>())) ||
-                                    (parent2->is_type<deconvolution>()) || (parent2->is_type<permute>()) ||
-                                    (parent1->is_type<depth_to_space>()) || (parent2->is_type<gemm>());
+            // The fused eltwise input is loaded in the layout of the fused primitive output by the kernels
+            // of these primitives, so the other input may be of the output shape or broadcasted
+            auto can_fuse_any_peer = [&](program_node* parent) -> bool {
+                return (parent->is_type<convolution>() && conv_supports_fusings(parent->as<convolution>())) ||
+                       (parent->is_type<mvn>() && mvn_supports_fusings(parent->as<mvn>())) ||
+                       parent->is_type<deconvolution>() || parent->is_type<permute>() ||
+                       parent->is_type<depth_to_space>() || parent->is_type<gemm>();
+            };
+
+            // The blocked kernels of these primitives can load only a scalar or a per feature input
+            auto can_fuse_broadcasted_peer = [&](program_node* parent, program_node* peer) -> bool {
+                if (!(parent->is_type<pooling>() && pooling_supports_fusings(parent->as<pooling>())) &&
+                    !parent->is_type<resample>())
+                    return false;
+
+                auto peer_size = peer->get_output_layout().size;
+                auto peer_count = peer_size.count();
+                return peer_count == 1 ||
+                       (peer_count == peer_size.feature[0] &&
+                        peer_size.feature[0] == parent->get_output_layout().size.feature[0]);
+            };
+
+            bool can_fuse_parent1 = can_fuse_any_peer(parent1) || can_fuse_broadcasted_peer(parent1, parent2);
+            bool can_fuse_parent2 = can_fuse_any_peer(parent2) || can_fuse_broadcasted_peer(parent2, parent1);
+
+            // The fused primitive output is always the first operand of the fused operation
+            if (prim->mode == eltwise_mode::sub || prim->mode == eltwise_mode::div)
+                can_fuse_parent2 = false;
 
             std::vector<bool> can_fuse_parents = { can_fuse_parent1, can_fuse_parent2 };
 
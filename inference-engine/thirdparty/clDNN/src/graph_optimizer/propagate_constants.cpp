@@ -80,6 +80,7 @@ void propagate_constants::run(program_impl& p) {
     for (auto& cout : to_replace) {
         auto& id_to_replace = cout.first;
         auto mem_impl = cout.second;
+        p.get_weights_cache().save_pending(id_to_replace, *mem_impl);
 
         memory api_memory = memory(mem_impl.detach());
 
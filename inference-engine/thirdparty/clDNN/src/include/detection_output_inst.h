@@ -38,6 +38,9 @@ public:
     program_node& location() const { return get_dependency(0); }
     program_node& confidence() const { return get_dependency(1); }
     program_node& prior_box() const { return get_dependency(2); }
+
+    // True if the layer runs with the OpenCL kernels, which do not support label decrease and box clipping
+    bool use_gpu_kernels() const;
 };
 
 using detection_output_node = typed_program_node<detection_output>;
@@ -38,7 +38,17 @@ public:
     size_t inputs_count() const { return get_primitive()->input.size(); }
 
     std::shared_ptr<kernel_selector::fuse_params> get_fuse_params() const override {
-        return std::make_shared<kernel_selector::eltwise_fuse_params>();
+        // only these modes are fused into other primitives
+        kernel_selector::EltwiseMode mode = kernel_selector::EltwiseMode::ADD;
+        switch (get_primitive()->mode) {
+            case eltwise_mode::sub: mode = kernel_selector::EltwiseMode::SUB; break;
+            case eltwise_mode::prod: mode = kernel_selector::EltwiseMode::MUL; break;
+            case eltwise_mode::div: mode = kernel_selector::EltwiseMode::DIV; break;
+            case eltwise_mode::min: mode = kernel_selector::EltwiseMode::MIN; break;
+            case eltwise_mode::max: mode = kernel_selector::EltwiseMode::MAX; break;
+            default: break;
+        }
+        return std::make_shared<kernel_selector::eltwise_fuse_params>(mode);
     }
 };
 
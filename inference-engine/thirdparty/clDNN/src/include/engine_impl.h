@@ -61,6 +61,7 @@ public:
                                                     allocation_type type,
                                                     bool reusable = true);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, const layout& new_layout);
+    refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, const layout& new_layout, uint32_t net_id);
     refcounted_obj_ptr<memory_impl> reinterpret_handle(const layout& new_layout,
                                                        const shared_mem_params* params,
                                                        uint32_t net_id);
@@ -41,6 +41,7 @@ public:
     }
     // returns true if handler has been successfully added
     bool add_event_handler(event_handler handler, void* data);
+    virtual void* get_ocl_handle() { return nullptr; }
 
     const std::list<instrumentation::profiling_interval>& get_profiling_info();
 
@@ -20,6 +20,7 @@
 
 #include "engine_impl.h"
 #include "refcounted_obj.h"
+#include <stdexcept>
 
 namespace cldnn {
 
@@ -35,6 +36,7 @@ struct memory_impl : refcounted_obj<memory_impl> {
     virtual void* lock() = 0;
     virtual void unlock() = 0;
     virtual void fill(unsigned char pattern, event_impl::ptr ev) = 0;
+    virtual event_impl::ptr copy_from(const void* host_ptr) = 0;
     size_t size() const { return _bytes_count; }
     virtual shared_mem_params get_internal_params() const = 0;
     virtual bool is_allocated_by(const engine_impl& engine) const { return &engine == _engine; }
@@ -64,6 +66,9 @@ struct simple_attached_memory : memory_impl {
     void* lock() override { return _pointer; }
     void unlock() override {}
     void fill(unsigned char, event_impl::ptr) override {}
+    event_impl::ptr copy_from(const void*) override {
+        throw std::logic_error("[clDNN] copying to user allocated memory is not supported");
+    }
     shared_mem_params get_internal_params() const override { return { shared_mem_type::shared_mem_empty, nullptr, nullptr, nullptr,
 #ifdef WIN32
         nullptr,
@@ -18,6 +18,7 @@
 #pragma once
 #include "api/layout.hpp"
 #include "api/primitive.hpp"
+#include "api/engine.hpp"
 #include "device_impl.h"
 #include "refcounted_obj.h"
 
@@ -98,13 +99,17 @@ struct padded_pool_comparer {
 // - resolve engine <--> memory_pool circular dependency
 // - add padded buffers pool
 // - add decreasing memory limit in gpu_buffer/image dctor
-// - add support for multi networks reuse
+// - add support for multi networks reuse (only networks which are never executed concurrently can share buffers,
+//   see engine_configuration::share_memory_pool)
 
 class memory_pool {
     memory_pool();
 
     refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout, allocation_type type, uint32_t network_id, bool reset = true);
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t network_id);
+    bool can_reuse_network_memory(uint32_t record_network_id, uint32_t network_id) const;
+    refcounted_obj_ptr<memory_impl> reuse_memory(memory_record& record, const layout& layout,
+                                                 const primitive_id& id, uint32_t network_id);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
@@ -112,6 +117,10 @@ class memory_pool {
     engine_impl* _engine;
     std::atomic<uint64_t> _temp_memory_used;
     std::atomic<uint64_t> _max_peak_memory_used;
+    std::atomic<uint64_t> _pooled_requests;
+    std::atomic<uint64_t> _reused_requests;
+    std::atomic<uint64_t> _reused_bytes_requested;
+    std::atomic<uint64_t> _reused_bytes_allocated;
 
 public:
     explicit memory_pool(engine_impl& engine);
@@ -147,6 +156,7 @@ public:
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; }
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; }
+    memory_pool_statistics get_statistics() const;
     void add_memory_used(size_t value);
     void subtract_memory_used(size_t value);
 };
@@ -31,6 +31,7 @@
 #include <memory>
 #include <list>
 #include <set>
+#include <utility>
 
 namespace cldnn {
 
@@ -59,6 +60,8 @@ public:
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
+    void set_runtime_batch(int32_t batch);
+    int32_t get_runtime_batch() const { return _runtime_batch; }
     uint16_t get_stream_id() const { return _stream_id; }
 
     std::vector<std::shared_ptr<primitive_inst>> const& get_outputs() { return _outputs; }
@@ -75,11 +78,14 @@ public:
     const program_impl::primitives_info& get_primitives_info() const;
     const program_impl::graph_optimizer_info& get_optimizer_passes_info() const;
     void execute(const std::vector<event_impl::ptr>& events);
+    event_impl::ptr enqueue_marker();
+    void enqueue_wait(const std::vector<event_impl::ptr>& events);
     void validate_primitives();
     // Implementation specific calls
     std::shared_ptr<primitive_inst> get_primitive(const primitive_id& id);
     std::string get_primitive_info(const primitive_id& id) const;
-    const event_impl::ptr& get_primitive_event(const primitive_id& id) const { return _events.at(id); }
+    event_impl::ptr get_primitive_event(const primitive_id& id) const;
+    event_impl::ptr get_primitive_event(const primitive_inst& primitive) const;
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<primitive_id>& ids);
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<program_node*>& nodes);
     void execute_primitive(const std::shared_ptr<primitive_inst>& primitive,
@@ -98,19 +104,26 @@ private:
     uint16_t _stream_id;
     bool _internal;
     float _learning_rate = static_cast<float>(0.00001);
+    int32_t _runtime_batch = 0;
 
     std::map<primitive_id, std::shared_ptr<primitive_inst>> _primitives;
     std::vector<std::shared_ptr<primitive_inst>> _inputs;
     std::vector<std::shared_ptr<primitive_inst>> _outputs;
     std::list<std::shared_ptr<primitive_inst>> _exec_order;
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
+    // mutable data primitives and the primitives whose events they take after the execution
+    std::vector<std::pair<primitive_id, std::shared_ptr<primitive_inst>>> _mutable_data_event_sources;
 
+    // the events of the executed primitives by their positions in the execution order
+    std::vector<event_impl::ptr> _exec_events;
+    // the events of the primitives which are not executed themselves (data outputs and mutable data)
     std::unordered_map<primitive_id, event_impl::ptr> _events;
 
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
     void allocate_mutable_data_for_streams(std::vector<std::shared_ptr<program_node>>& mutable_data_nodes);
     void add_to_exec_order(const primitive_id& id);
+    event_impl::ptr find_primitive_event(const primitive_inst& primitive) const;
     std::shared_ptr<primitive_inst> find_in_internal_networks(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_primitive(const primitive_id& id);
     void check_names();
@@ -62,6 +62,8 @@ struct primitive_impl {
     kernel_selector::weights_reorder_params _weights_reorder_params;
     // class typed_primitive_gpu_impl override this with return false;
     virtual bool is_cpu() const { return true; }
+    // the implementation can run for the first images of the batch, see network_impl::set_runtime_batch
+    virtual bool supports_runtime_batch() const { return false; }
 
 private:
     std::string _kernel_name;
@@ -115,6 +117,12 @@ public:
     bool output_changed() const { return _output_changed; }
     void reset_output_change() { _output_changed = false; }
 
+    // position of the primitive in the execution order of its network, the network keeps the event of the primitive
+    // at this position. Primitives which are not executed have no position
+    static constexpr size_t no_exec_index = static_cast<size_t>(-1);
+    size_t get_exec_index() const { return _exec_index; }
+    void set_exec_index(size_t index) { _exec_index = index; }
+
     void build_deps();
 
     memory_impl& fused_memory(size_t dep_id) const {
@@ -152,6 +160,7 @@ protected:
     memory_impl::ptr _output;
 
     bool _output_changed;  // todo: implement output reuse if neither of inputs has changed
+    size_t _exec_index = no_exec_index;
     bool _has_valid_input =
         true;  // by default all primitives has valid inputs, exception is input_layout (see input_layout_inst)
 
@@ -22,6 +22,7 @@
 
 #include "refcounted_obj.h"
 #include "engine_impl.h"
+#include "weights_cache.h"
 
 #include <list>
 #include <string>
@@ -153,6 +154,7 @@ public:
         return outputs;
     }  // ToDo: redesign reorder-inputs pass to make it const as_well as get_engine and get options
     bool is_debug_build() const { return options.get<build_option_type::debug>()->enabled(); }
+    bool supports_runtime_batch() const { return runtime_batch_supported; }
     const nodes_ordering& get_processing_order() const;
     nodes_ordering& get_processing_order();
     uint32_t get_prog_id() { return prog_id; }
@@ -221,11 +223,13 @@ public:
 
     void reset_program();
     uint32_t get_id() const { return prog_id; }
+    weights_cache& get_weights_cache() { return reordered_weights_cache; }
 
 private:
     uint32_t prog_id = 0;
     engine_impl::ptr engine;
     build_options options;
+    weights_cache reordered_weights_cache;
     std::list<program_node*> inputs;
     std::vector<program_node*> outputs;
     nodes_ordering processing_order;
@@ -236,6 +240,7 @@ private:
 
     std::list<optimized_info> optimized;
     primitives_info prim_info;
+    bool runtime_batch_supported = false;
     graph_optimizer_info optimizer_passes_info;
 
     primitives_info get_current_stage_info() const;
@@ -274,6 +279,8 @@ private:
     */
     // TODO: Remove once we will get full support for input/output padding in all primitive implementations.
     bool analyze_output_size_handling_need();
+    // checks that the kernels of all the primitives can run for the first images of the batch
+    bool analyze_runtime_batch_support() const;
 
     /*
     ** Optimization functions
@@ -0,0 +1,57 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/layout.hpp"
+#include "api/primitive.hpp"
+#include "engine_impl.h"
+#include "kernel_selector_helper.h"
+#include "memory_impl.h"
+#include <map>
+#include <string>
+
+namespace cldnn {
+
+// Keeps the weights reordered by the generic layers in a directory, so a network which is built again with
+// the same weights uploads the reordered weights instead of executing the reorders.
+// The files are keyed by the contents of the original weights and by the source and the target layouts.
+class weights_cache {
+public:
+    explicit weights_cache(const std::string& cache_dir) : _cache_dir(cache_dir) {}
+
+    bool enabled() const { return !_cache_dir.empty(); }
+
+    // returns the file which keeps the given weights reordered to 'reordered_layout', empty if caching is disabled
+    std::string get_file_name(memory_impl& weights,
+                              const kernel_selector::weights_reorder_params& reorder_params,
+                              const layout& reordered_layout) const;
+
+    // returns the reordered weights read from the file, nullptr if there are no such weights
+    memory_impl::ptr load(engine_impl& engine, const std::string& file_name, const layout& reordered_layout) const;
+
+    // remembers that the output of the reorder 'id' should be saved to 'file_name' once it is computed
+    void add_pending(const primitive_id& id, const std::string& file_name);
+
+    // saves the output of the reorder 'id' if it was requested by add_pending()
+    void save_pending(const primitive_id& id, memory_impl& reordered);
+
+private:
+    std::string _cache_dir;
+    std::map<primitive_id, std::string> _pending;
+};
+
+}  // namespace cldnn
@@ -716,6 +716,7 @@ void set_optional_params(const program_impl& program, kernel_selector::optional_
                                         program.get_options().get<build_option_type::allow_static_input_reorder>()->enabled();
     params.allowInputReordering = false;
     params.allowOutputReordering = false;
+    params.preferRuntimeBatch = program.get_options().get<build_option_type::runtime_batch>()->enabled();
 
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
@@ -52,6 +52,19 @@ memory memory::share_image(const engine& engine, const layout& layout, shared_ha
     return memory(engine.get()->reinterpret_handle(layout, &params, net_id).detach());
 }
 
+memory memory::share_host_buffer(const engine& engine, const layout& layout, void* ptr, uint32_t net_id) {
+    if (reinterpret_cast<uintptr_t>(ptr) % host_buffer_alignment != 0)
+        throw std::invalid_argument("host buffer should be aligned to " + std::to_string(host_buffer_alignment) + " bytes");
+    shared_mem_params params = { shared_mem_type::shared_mem_host_buffer, nullptr, nullptr, ptr,
+#ifdef WIN32
+        nullptr,
+#else
+        0,
+#endif
+        0 };
+    return memory(engine.get()->reinterpret_handle(layout, &params, net_id).detach());
+}
+
 #ifdef WIN32
 memory memory::share_surface(const engine& engine, const layout& layout, shared_handle surf, uint32_t plane,
     uint32_t net_id) {
@@ -119,6 +132,12 @@ shared_mem_params memory::get_internal_params() const {
     else throw std::runtime_error("empty memory object");
 }
 
+event memory::copy_from(const void* host_ptr) const {
+    if (!_impl) throw std::runtime_error("empty memory object");
+    if (!host_ptr) throw std::invalid_argument("pointer should not be null");
+    return event(_impl->copy_from(host_ptr).detach());
+}
+
 memory memory::attach_impl(const cldnn::layout& layout, void* ptr, uint32_t net_id) {
     return memory(new simple_attached_memory(layout, ptr, net_id));
 }
@@ -103,6 +103,14 @@ memory_impl::ptr memory_pool::get_memory(const layout& layout, const shared_mem_
                 buf,
                 net_id), false };
             return mem_impl;
+        } else if (!layout.format.is_image() && params->mem_type == shared_mem_type::shared_mem_host_buffer) {
+            // zero copy host memory: the user buffer is used in place, otherwise the driver allocates it in host memory
+            cl_mem_flags flags = CL_MEM_READ_WRITE | (params->mem ? CL_MEM_USE_HOST_PTR : CL_MEM_ALLOC_HOST_PTR);
+            cl::Buffer buf(_engine->get_context()->context(), flags, layout.bytes_count(), params->mem);
+            memory_impl::ptr mem_impl{ new gpu::gpu_buffer(engine_impl::ptr(_engine), layout,
+                buf,
+                net_id), false };
+            return mem_impl;
         } else {
             throw std::runtime_error("unknown shared object fromat or type");
         }
@@ -217,16 +225,14 @@ memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
                                                        allocation_type type) {
     auto it = _non_padded_pool.lower_bound(layout.bytes_count());
     while (it != _non_padded_pool.end()) {
-        if (it->second._network_id == network_id &&
+        if (can_reuse_network_memory(it->second._network_id, network_id) &&
             it->second._type == type &&
             it->second._memory->get_layout().format != format::fs_b_yx_fsv32 &&
             layout.format != format::fs_b_yx_fsv32 &&
             ((layout.format != format::b_fs_yx_fsv32 && layout.format != format::b_fs_zyx_fsv32) ||
              (layout.size.feature[0] % 32 == 0)) &&
             !has_conflict(it->second._users, restrictions, network_id)) {
-            it->second._users.insert(memory_user(id, network_id));
-            auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
-            return ret_mem;
+            return reuse_memory(it->second, layout, id, network_id);
         } else {
             ++it;
         }
@@ -249,7 +255,7 @@ memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout,
 
     if (first_level_cache != _padded_pool.end()) {
         for (auto& rec_list : first_level_cache->second) {
-            if (rec_list._network_id == network_id &&
+            if (can_reuse_network_memory(rec_list._network_id, network_id) &&
                 rec_list._type == type &&
                 ((layout.format != format::b_fs_yx_fsv32 && layout.format != format::b_fs_zyx_fsv32) ||
                  (layout.size.feature[0] % 32 == 0)) &&
@@ -260,9 +266,7 @@ memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout,
                 rec_list._memory->get_layout().format != format::fs_b_yx_fsv32 &&
                 layout.format != format::fs_b_yx_fsv32 &&
                 !has_conflict(rec_list._users, restrictions, network_id)) {
-                rec_list._users.insert({id, network_id});
-                auto ret_mem = _engine->reinterpret_buffer(*(rec_list._memory), layout);
-                return ret_mem;
+                return reuse_memory(rec_list, layout, id, network_id);
             }
         }
         auto mem = alloc_memory(layout, type, network_id);
@@ -316,6 +320,7 @@ memory_impl::ptr memory_pool::get_memory(const layout& layout,
                                          allocation_type type,
                                          bool reusable_across_network) {
     if (reusable_across_network) {
+        _pooled_requests++;
         // reusable within the same network
         if (!layout.format.is_image() && layout.data_padding == padding{{0, 0, 0, 0}, 0}) {
             // non-padded buffers
@@ -393,7 +398,36 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
     }
 }
 
-memory_pool::memory_pool(engine_impl& engine) : _engine(&engine), _temp_memory_used(0), _max_peak_memory_used(0) {
+memory_pool::memory_pool(engine_impl& engine)
+    : _engine(&engine),
+      _temp_memory_used(0),
+      _max_peak_memory_used(0),
+      _pooled_requests(0),
+      _reused_requests(0),
+      _reused_bytes_requested(0),
+      _reused_bytes_allocated(0) {
+}
+
+bool memory_pool::can_reuse_network_memory(uint32_t record_network_id, uint32_t network_id) const {
+    // memory users from different networks never conflict (see has_conflict),
+    // so buffers of other networks are reused only if they are not executed concurrently
+    return record_network_id == network_id || _engine->configuration().share_memory_pool;
+}
+
+memory_impl::ptr memory_pool::reuse_memory(memory_record& record,
+                                           const layout& layout,
+                                           const primitive_id& id,
+                                           uint32_t network_id) {
+    record._users.insert(memory_user(id, network_id));
+    _reused_requests++;
+    _reused_bytes_requested += layout.bytes_count();
+    _reused_bytes_allocated += record._memory->get_layout().bytes_count();
+    // the buffer is bound to the queue of the network which uses it, since the owner network may be destroyed first
+    return _engine->reinterpret_buffer(*record._memory, layout, network_id);
+}
+
+memory_pool_statistics memory_pool::get_statistics() const {
+    return { _max_peak_memory_used, _pooled_requests, _reused_requests, _reused_bytes_requested, _reused_bytes_allocated };
 }
 
 void memory_pool::dump_memory_pool(const program_impl& program, std::string& path, std::string& dep) {
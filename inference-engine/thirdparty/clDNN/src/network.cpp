@@ -75,6 +75,10 @@ void network::set_output_memory(const primitive_id& id, const memory& mem) const
     _impl->set_output_memory(id, *mem.get());
 }
 
+void network::set_runtime_batch(int32_t batch) const {
+    _impl->set_runtime_batch(batch);
+}
+
 uint32_t network::get_id() {
     return _impl->get_id();
 }
@@ -142,6 +146,19 @@ std::map<primitive_id, network_output> network::execute(const std::vector<event>
     return result;
 }
 
+event network::enqueue_marker() const {
+    return event(_impl->enqueue_marker().detach());
+}
+
+void network::enqueue_wait(const std::vector<event>& events) const {
+    std::vector<event_impl::ptr> impls;
+    impls.reserve(events.size());
+    for (auto& ev : events) {
+        impls.emplace_back(ev.get());
+    }
+    _impl->enqueue_wait(impls);
+}
+
 void network::retain() {
     _impl->add_ref();
 }
@@ -333,18 +350,26 @@ void network_impl::validate_primitives() {
 }
 
 void network_impl::reset_execution(bool wait) {
-    if (wait && _events.size() > 0) {
+    if (wait) {
         std::vector<event_impl::ptr> events;
+        for (auto& ev : _exec_events) {
+            if (!ev || ev->is_set())
+                continue;
+
+            events.push_back(ev);
+        }
         for (auto& pair : _events) {
             auto& ev = pair.second;
-            if (ev->is_set())
+            if (!ev || ev->is_set())
                 continue;
 
             events.push_back(ev);
         }
 
-        get_engine().wait_for_events(events);
+        if (!events.empty())
+            get_engine().wait_for_events(events);
     }
+    std::fill(_exec_events.begin(), _exec_events.end(), event_impl::ptr());
     _events.clear();
 }
 
@@ -423,6 +448,13 @@ void network_impl::set_learning_rate(const float lr) { _learning_rate = lr; }
 
 float network_impl::get_learning_rate() { return _learning_rate; }
 
+void network_impl::set_runtime_batch(int32_t batch) {
+    if (batch != 0 && !_program->supports_runtime_batch()) {
+        CLDNN_ERROR_MESSAGE("Network_impl", "The program does not support running for a part of the batch");
+    }
+    _runtime_batch = batch;
+}
+
 bool network_impl::is_primary_stream() {
     auto _nstreams = get_engine().configuration().n_streams;
     return _nstreams == 1 || (_nstreams > 1 && _stream_id > 0);
@@ -474,9 +506,37 @@ void network_impl::build_exec_order() {
             add_to_exec_order(node->id());
         }
     }
+    _exec_events.resize(_exec_order.size());
+
+    // Special handling for mutable data. The event should be the same as the user or dependency with highest
+    // processing_num as the mutable_data can be updated when is both user or dependency.
+    auto& processing_order = _program->get_processing_order();
+    for (auto& node : processing_order) {
+        if (!node->is_type<mutable_data>())
+            continue;
+        program_node* source = nullptr;
+        decltype(processing_order.get_processing_number(node)) proc_num = 0;
+        for (auto& user : node->get_users()) {
+            auto user_proc_num = processing_order.get_processing_number(user);
+            if (user_proc_num > proc_num) {
+                source = user;
+                proc_num = user_proc_num;
+            }
+        }
+        for (auto& dep : node->get_dependencies()) {
+            auto dep_proc_num = processing_order.get_processing_number(dep);
+            if (dep_proc_num > proc_num) {
+                source = dep;
+                proc_num = dep_proc_num;
+            }
+        }
+        if (source != nullptr)
+            _mutable_data_event_sources.emplace_back(node->id(), get_primitive(source->id()));
+    }
 }
 void network_impl::add_to_exec_order(const primitive_id& id) {
     auto inst = get_primitive(id);
+    inst->set_exec_index(_exec_order.size());
     _exec_order.push_back(inst);
 }
 
@@ -537,29 +597,8 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
 #endif
     }
 
-    for (auto& inst : _program->get_processing_order()) {
-        // Special handling for mutable data. The event should be the same as the user or dependency with highest
-        // processing_num as the mutable_data can be updated when is both user or dependency.
-        if (inst->is_type<mutable_data>()) {
-            decltype(_program->get_processing_order().get_processing_number(inst)) proc_num = 0;
-            for (auto& user : inst->get_users()) {
-                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
-                if (user_proc_num > proc_num) {
-                    _events[inst->id()] = _events[user->id()];
-                    proc_num = user_proc_num;
-                }
-            }
-
-            if (!inst->get_dependencies().empty()) {
-                for (auto& dep : inst->get_dependencies()) {
-                    auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
-                    if (dep_proc_num > proc_num) {
-                        _events[inst->id()] = _events[dep->id()];
-                        proc_num = dep_proc_num;
-                    }
-                }
-            }
-        }
+    for (auto& source : _mutable_data_event_sources) {
+        _events[source.first] = find_primitive_event(*source.second);
     }
 
     for (auto& dout : _data_outputs) {  // data primitives are not executed so if they are marked as output we need to add
@@ -579,6 +618,14 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     get_engine().flush_network(get_id());
 }
 
+event_impl::ptr network_impl::enqueue_marker() {
+    return get_engine().get_context()->enqueue_completion_marker(get_id());
+}
+
+void network_impl::enqueue_wait(const std::vector<event_impl::ptr>& events) {
+    get_engine().get_context()->enqueue_wait(get_id(), events);
+}
+
 std::vector<primitive_id> network_impl::get_input_ids() const {
     std::vector<primitive_id> ret;
     ret.reserve(_inputs.size());
@@ -651,22 +698,48 @@ std::vector<std::shared_ptr<primitive_inst>> network_impl::get_primitives(const
     return result;
 }
 
+event_impl::ptr network_impl::find_primitive_event(const primitive_inst& primitive) const {
+    const auto index = primitive.get_exec_index();
+    if (index < _exec_events.size() && _exec_events[index])
+        return _exec_events[index];
+    auto it = _events.find(primitive.id());
+    return (it != _events.end()) ? it->second : event_impl::ptr();
+}
+
+event_impl::ptr network_impl::get_primitive_event(const primitive_inst& primitive) const {
+    auto ev = find_primitive_event(primitive);
+    if (!ev)
+        throw std::out_of_range("primitive " + primitive.id() + " has no event");
+    return ev;
+}
+
+event_impl::ptr network_impl::get_primitive_event(const primitive_id& id) const {
+    // events of mutable data are replaced by the events of the primitives which update it
+    auto it = _events.find(id);
+    if (it != _events.end())
+        return it->second;
+    auto prim = _primitives.find(id);
+    if (prim == _primitives.end())
+        throw std::out_of_range("primitive " + id + " has no event");
+    return get_primitive_event(*prim->second);
+}
+
 void network_impl::execute_primitive(const std::shared_ptr<primitive_inst>& primitive,
                                      const std::vector<refcounted_obj_ptr<event_impl>>& events) {
-    auto id = primitive->id();
-    auto it = _events.find(id);
-    bool found = (it != _events.end());
-    CLDNN_ERROR_BOOL(id,
-                     "Invalid primitive call ",
-                     found,
-                     "Primitive " + id + " is tried to be executed for the second time");
-
-    event_impl::ptr ev;
-    if (!get_engine().get_context()->enabled_single_kernel() || get_engine().get_context()->single_kernel_name() == id)
+    auto& ev = _exec_events.at(primitive->get_exec_index());
+    // the message is built only on the error, this check runs for every primitive of every inference
+    if (ev) {
+        CLDNN_ERROR_BOOL(primitive->id(),
+                         "Invalid primitive call ",
+                         true,
+                         "Primitive " + primitive->id() + " is tried to be executed for the second time");
+    }
+
+    if (!get_engine().get_context()->enabled_single_kernel() ||
+        get_engine().get_context()->single_kernel_name() == primitive->id())
         ev = primitive->execute(events);
     else
         ev = get_engine().create_user_event(get_id(), true);
-    _events.insert({id, ev});
 }
 
 void network_impl::allocate_mutable_data_for_streams(std::vector<std::shared_ptr<program_node>>& mutable_data_nodes) {
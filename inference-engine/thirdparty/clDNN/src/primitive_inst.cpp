@@ -94,16 +94,14 @@ event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& even
     std::vector<event_impl::ptr> dependencies;
     dependencies.reserve(_exec_deps.size());
     for (auto& input : _exec_deps) {
-        auto id = input->id();
         try {
             // if the requested event deos not exits it means that it has not been executed, so the processing_order is
             // wrong or synchronization failed.
-            auto ev = get_network().get_primitive_event(id);
-            dependencies.emplace_back(ev);
+            dependencies.emplace_back(get_network().get_primitive_event(*input));
         } catch (const std::out_of_range& oor) {
             std::string temp = std::string("internal CLDNN error: execution order corrupted.") + std::string("\n") +
                                std::string(oor.what() + std::string("\n"));
-            CLDNN_ERROR_MESSAGE(id, temp);
+            CLDNN_ERROR_MESSAGE(input->id(), temp);
         }
     }
     return _impl->execute(dependencies, *this);
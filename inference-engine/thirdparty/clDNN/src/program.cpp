@@ -69,6 +69,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <map>
@@ -84,6 +85,10 @@
 program::program(engine const& engine, topology const& topology, build_options const& options)
     : _impl(engine.get()->build_program(*topology.get(), options).detach()) {}
 
+bool program::supports_runtime_batch() const {
+    return _impl->supports_runtime_batch();
+}
+
 void program::retain() {
     _impl->add_ref();
 }
@@ -99,6 +104,7 @@ program_impl::program_impl(engine_impl& engine_ref,
                            bool no_optimizations)
     : engine(&engine_ref),
       options(options),
+      reordered_weights_cache(options.get<build_option_type::weights_cache_dir>()->directory_path),
       processing_order() {
     kernel_selector::KernelBase::ResetCounter();
     set_options();
@@ -117,6 +123,7 @@ program_impl::program_impl(engine_impl& engine_ref,
                            bool is_internal)
     : engine(&engine_ref),
       options(options),
+      reordered_weights_cache(options.get<build_option_type::weights_cache_dir>()->directory_path),
       processing_order() {
     set_options();
     pm = std::unique_ptr<pass_manager>(new pass_manager(*this));
@@ -247,6 +254,38 @@ bool program_impl::analyze_output_size_handling_need() {
     return handling_needed;
 }
 
+bool program_impl::analyze_runtime_batch_support() const {
+    if (!options.get<build_option_type::runtime_batch>()->enabled())
+        return false;
+
+    int32_t batch = 0;
+    for (auto& node : processing_order) {
+        if (node->is_type<data>() || node->is_type<mutable_data>() || node->is_type<internal_primitive>())
+            continue;
+
+        // all the primitives process the same images, which follow each other in their memory
+        auto layout = node->get_output_layout();
+        const auto& traits = format::traits(layout.format);
+        bool batch_blocked = std::any_of(traits.block_sizes.begin(), traits.block_sizes.end(),
+                                         [](const std::pair<size_t, int>& block) { return block.first == 0; });
+        if (traits.order.empty() || traits.order[0] != 'b' || batch_blocked || format::is_image(layout.format) ||
+            format::is_winograd(layout.format) || layout.data_padding.lower_size().batch[0] != 0 ||
+            layout.data_padding.upper_size().batch[0] != 0)
+            return false;
+        if (batch == 0)
+            batch = layout.size.batch[0];
+        if (layout.size.batch[0] != batch)
+            return false;
+
+        if (node->is_type<input_layout>() || node->can_be_optimized())
+            continue;
+        auto impl = node->get_selected_impl();
+        if (!impl || !impl->supports_runtime_batch())
+            return false;
+    }
+    return batch != 0;
+}
+
 // create new nodes for a program based on the set of nodes
 // method created to be used by propagate_constants to build sub program from constant nodes
 void program_impl::prepare_nodes(std::set<std::shared_ptr<program_node>> const& nodes) {
@@ -365,12 +404,21 @@ void program_impl::build_program(bool is_internal) {
     run_graph_compilation();
     { post_optimize_graph(is_internal); }
     prepare_memory_dependencies();
+
+    // the kernels compilation does not touch the constants, so they are uploaded to the device meanwhile
+    // and the host copies of the large networks are released before the compilation is over
+    std::future<void> transfer;
+    if (!is_internal)
+        transfer = std::async(std::launch::async, [this] { transfer_memory_to_device(); });
     engine->compile_program(*this);
+    if (transfer.valid())
+        transfer.get();
 
     if (!is_internal)
         prim_info = get_current_stage_info();
 
-    if (!is_internal)  transfer_memory_to_device();
+    runtime_batch_supported = !is_internal && analyze_runtime_batch_support();
+
     cleanup();
 }
 
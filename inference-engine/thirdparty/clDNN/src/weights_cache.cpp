@@ -0,0 +1,145 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "weights_cache.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+namespace cldnn {
+
+namespace {
+// bumped whenever the contents of the cached files change
+const char weights_cache_version[] = "1";
+
+std::string layout_key(const layout& l) {
+    std::stringstream key;
+    key << static_cast<int>(l.data_type) << "_" << static_cast<int>(l.format.value) << "_" << l.size.to_string()
+        << "_" << l.data_padding.lower_size().to_string() << "_" << l.data_padding.upper_size().to_string();
+    return key.str();
+}
+
+std::string weights_tensor_key(const kernel_selector::WeightsTensor& t) {
+    std::stringstream key;
+    key << static_cast<int>(t.GetLayout()) << "_" << static_cast<int>(t.GetDType());
+    for (const auto& dim : t.GetDims())
+        key << "_" << dim.v << ":" << dim.pitch << ":" << dim.pad.before << ":" << dim.pad.after;
+    return key.str();
+}
+
+// FNV-1a, the weights are hashed in place rather than copied to a string for std::hash
+uint64_t hash_bytes(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+}  // namespace
+
+std::string weights_cache::get_file_name(memory_impl& weights,
+                                         const kernel_selector::weights_reorder_params& reorder_params,
+                                         const layout& reordered_layout) const {
+    if (!enabled())
+        return {};
+
+    uint64_t contents_hash = 0;
+    {
+        mem_lock<char> lock(weights);
+        contents_hash = hash_bytes(lock.data(), lock.size());
+    }
+
+    std::hash<std::string> hasher;
+    size_t seed = 0;
+    auto combine = [&](const std::string& value) {
+        seed ^= hasher(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(weights_cache_version);
+    combine(std::to_string(contents_hash));
+    combine(layout_key(weights.get_layout()));
+    combine(weights_tensor_key(reorder_params.dest));
+    combine(layout_key(reordered_layout));
+
+    auto file_name = _cache_dir;
+    if (file_name.back() != '/')
+        file_name += '/';
+    return file_name + "clDNN_weights_" + std::to_string(seed) + ".bin";
+}
+
+memory_impl::ptr weights_cache::load(engine_impl& engine,
+                                     const std::string& file_name,
+                                     const layout& reordered_layout) const {
+    if (file_name.empty())
+        return {};
+
+    std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+    if (!file.good())
+        return {};
+    // a file of another size is stale or partially written, so the weights are reordered again
+    auto size = file.tellg();
+    if (size <= 0 || static_cast<size_t>(size) != reordered_layout.bytes_count())
+        return {};
+    file.seekg(0, std::ios::beg);
+
+    auto reordered = engine.allocate_memory(reordered_layout, 0, false);
+    {
+        mem_lock<char> lock(reordered);
+        if (!file.read(lock.data(), size))
+            return {};
+    }
+    return reordered;
+}
+
+void weights_cache::add_pending(const primitive_id& id, const std::string& file_name) {
+    if (!file_name.empty())
+        _pending[id] = file_name;
+}
+
+// The weights are written to a temporary file first, so concurrent processes never read a partially written one
+void weights_cache::save_pending(const primitive_id& id, memory_impl& reordered) {
+    auto it = _pending.find(id);
+    if (it == _pending.end())
+        return;
+    const auto file_name = it->second;
+    _pending.erase(it);
+
+    std::stringstream tmp_file_name;
+    tmp_file_name << file_name << "." << std::this_thread::get_id() << ".tmp";
+    {
+        std::ofstream file(tmp_file_name.str(), std::ios::binary | std::ios::trunc);
+        if (!file.good())
+            return;
+        {
+            mem_lock<char> lock(reordered);
+            file.write(lock.data(), lock.size());
+        }
+        if (!file.good()) {
+            file.close();
+            std::remove(tmp_file_name.str().c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_file_name.str().c_str(), file_name.c_str()) != 0)
+        std::remove(tmp_file_name.str().c_str());
+}
+
+}  // namespace cldnn
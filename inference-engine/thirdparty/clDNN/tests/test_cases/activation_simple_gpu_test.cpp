@@ -1463,3 +1463,50 @@ TEST(activation_f32_fw_gpu, b_fs_yx_fsv16_prelu) {
         EXPECT_EQ(expected[i], out_ptr[i]) << "at i=" << i;
     }
 }
+
+TEST(activation_f32_fw_gpu, relu_runtime_batch_bfyx) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 4, 2, 3, 3 } });
+    VF<float> input_vec(input.get_layout().count());
+    for (size_t i = 0; i < input_vec.size(); ++i) {
+        input_vec[i] = (i % 2 ? 1.0f : -1.0f) * static_cast<float>(i);
+    }
+    set_values(input, input_vec);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_func::relu));
+    build_options options;
+    options.set_option(build_option::runtime_batch(true));
+    network network(engine, topology, options);
+    ASSERT_TRUE(network.get_program().supports_runtime_batch());
+
+    for (int32_t batch : { 2, 0 }) {
+        network.set_runtime_batch(batch);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_memory = outputs.at("relu").get_memory();
+        EXPECT_EQ(output_memory.get_layout().size.batch[0], 4);
+        auto output_ptr = output_memory.pointer<float>();
+
+        size_t processed = batch == 0 ? input_vec.size() : input_vec.size() / 4 * batch;
+        for (size_t i = 0; i < processed; ++i) {
+            EXPECT_FLOAT_EQ(std::max(input_vec[i], 0.0f), output_ptr[i]);
+        }
+    }
+}
+
+TEST(activation_f32_fw_gpu, runtime_batch_requires_build_option) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 4, 2, 3, 3 } });
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_func::relu));
+    network network(engine, topology);
+
+    EXPECT_FALSE(network.get_program().supports_runtime_batch());
+    EXPECT_ANY_THROW(network.set_runtime_batch(2));
+}
@@ -73,4 +73,36 @@ TEST(DISABLED_oooq_test, simple)
     EXPECT_TRUE(output.get_layout().size.spatial[1] == 2);
     EXPECT_TRUE(output.get_layout().size.feature[0] == 1);
     EXPECT_TRUE(output.get_layout().size.batch[0] == 1);
-}
\ No newline at end of file
+}
+TEST(network_events, chained_networks_wait_for_marker)
+{
+    const auto& eng = get_test_engine();
+
+    memory input_mem = memory::allocate(eng, layout{ data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    set_values(input_mem, { 50.f, 51.f, 52.f, 53.f });
+
+    topology producer_tpl;
+    producer_tpl.add(input_layout("in", input_mem.get_layout()));
+    producer_tpl.add(reorder("r", "in", input_mem.get_layout(), std::vector<float>{ 1 }));
+    network producer{ eng, producer_tpl };
+    producer.set_input_data("in", input_mem);
+
+    topology consumer_tpl;
+    consumer_tpl.add(input_layout("in", input_mem.get_layout()));
+    consumer_tpl.add(reorder("r", "in", input_mem.get_layout(), std::vector<float>{ 2 }));
+    network consumer{ eng, consumer_tpl };
+    consumer.set_input_data("in", producer.get_output_memory("r"));
+
+    producer.execute();
+    auto marker = producer.enqueue_marker();
+    EXPECT_NE(nullptr, marker.get_ocl_handle());
+
+    consumer.enqueue_wait({ marker });
+    auto output = consumer.execute().at("r").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    std::vector<float> expected = { 47.f, 48.f, 49.f, 50.f };
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_FLOAT_EQ(expected[i], output_ptr[i]);
+    }
+}
@@ -21,6 +21,7 @@
 #include <api/input_layout.hpp>
 #include "test_utils/test_utils.h"
 #include "api/arg_max_min.hpp"
+#include "api/reorder.hpp"
 
 using namespace cldnn;
 using namespace tests;
@@ -130,4 +131,42 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
             throttle_mode_types::low);
     cldnn::engine engine(configuration);
     exexute_network(engine);
-}
\ No newline at end of file
+}
+// Kernels keep their arguments between executions and only the changed ones are set again,
+// so the results have to follow the memory set to the network before every execution.
+void execute_network_with_changing_inputs(cldnn::engine engine)
+{
+    layout input_layout_f32{ data_types::f32, format::bfyx, { 1, 1, 2, 2 } };
+    auto first = memory::allocate(engine, input_layout_f32);
+    auto second = memory::allocate(engine, input_layout_f32);
+    set_values(first, { 1.f, 2.f, 3.f, 4.f });
+    set_values(second, { 10.f, 20.f, 30.f, 40.f });
+
+    topology topology;
+    topology.add(input_layout("input", input_layout_f32));
+    topology.add(reorder("r0", "input", input_layout_f32, std::vector<float>{ 1.f }));
+    topology.add(reorder("r1", "r0", input_layout_f32, std::vector<float>{ 2.f }));
+
+    network network(engine, topology);
+
+    for (auto& test : { std::make_pair(first, 1.f), std::make_pair(second, 10.f), std::make_pair(first, 1.f) }) {
+        network.set_input_data("input", test.first);
+        auto outputs = network.execute();
+        auto output_ptr = outputs.at("r1").get_memory().pointer<float>();
+        for (int i = 0; i < 4; i++) {
+            EXPECT_FLOAT_EQ(test.second * (i + 1) - 3.f, output_ptr[i]);
+        }
+    }
+}
+
+TEST(command_queue_test, in_order_queue_follows_changed_inputs) {
+    engine_configuration configuration;
+    configuration.queue_sync_mode = queue_sync_mode_types::in_order;
+    cldnn::engine engine(configuration);
+    execute_network_with_changing_inputs(engine);
+}
+
+TEST(command_queue_test, out_of_order_queue_follows_changed_inputs) {
+    cldnn::engine engine;
+    execute_network_with_changing_inputs(engine);
+}
@@ -484,6 +484,87 @@ TEST(fully_connected_gpu, x_f32) {
     EXPECT_EQ(7.00f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, x_f32_f16_weights) {
+    //  Same as x_f32, but the weights are stored in FP16 and up-converted by the kernel
+
+    const int32_t output_f = 4,                 // size of whole output buffer
+        input_x = 3,                 // size of whole input buffer
+        weight_b = 4, weight_x = 3;  // size of whole weights buffer
+
+    const auto& engine = get_test_engine();
+
+    auto input_prim = memory::allocate(engine, { data_types::f32,format::bfyx, { 1,1,input_x,1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f16,format::bfyx,{ weight_b, 1, weight_x, 1 } });
+    auto bias_prim = memory::allocate(engine, { data_types::f32,format::bfyx,{ 1,1,output_f,1 } });
+
+    set_values(input_prim, { -0.5f, 2.0f, 0.5f });
+    set_values(weights_prim, { FLOAT16(1.5f), FLOAT16(1.0f), FLOAT16(0.5f), FLOAT16(-1.0f), FLOAT16(0.0f), FLOAT16(0.5f),
+                               FLOAT16(0.5f), FLOAT16(-0.5f), FLOAT16(-2.0f), FLOAT16(-0.5f), FLOAT16(1.0f), FLOAT16(1.5f) });
+    set_values(bias_prim, { 1.0f, 2.0f, 3.0f, 4.0f });
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        data("bias", bias_prim),
+        fully_connected("full_con_prim", "input", "weights", "bias")
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "full_con_prim");
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    EXPECT_EQ(output_prim.get_layout().data_type, data_types::f32);
+
+    auto output_ptr = output_prim.pointer<float>();
+
+    EXPECT_EQ(2.50f, output_ptr[0]);
+    EXPECT_EQ(2.75f, output_ptr[1]);
+    EXPECT_EQ(0.75f, output_ptr[2]);
+    EXPECT_EQ(7.00f, output_ptr[3]);
+}
+
+TEST(fully_connected_gpu, bf_io_input_spatial_f16_weights) {
+    const int32_t input_f = 64, output_f = 32;
+
+    const auto& engine = get_test_engine();
+
+    auto input_data = generate_random_1d<float>(input_f, -1, 1);
+    auto weights_data = generate_random_1d<FLOAT16>(output_f * input_f, -1, 1);
+
+    auto input_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, input_f, 1, 1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f16, format::bfyx, { output_f, input_f, 1, 1 } });
+    set_values(input_prim, input_data);
+    set_values(weights_prim, weights_data);
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        fully_connected("fc", "input", "weights")
+    );
+
+    build_options options;
+    implementation_desc fc_impl = { format::bfyx, "fully_connected_gpu_bf_io_input_spatial" };
+    options.set_option(build_option::force_implementations({ {"fc", fc_impl} }));
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    auto output_ptr = outputs.at("fc").get_memory().pointer<float>();
+
+    for (int32_t o = 0; o < output_f; o++) {
+        float expected = 0.f;
+        for (int32_t i = 0; i < input_f; i++) {
+            expected += input_data[i] * static_cast<float>(weights_data[o * input_f + i]);
+        }
+        EXPECT_NEAR(expected, output_ptr[o], 1e-4f) << "o = " << o;
+    }
+}
+
 TEST(fully_connected_gpu, yxfn_f32) {
     //  Input  : 1x2x1x2 - 1 batch 2 feature maps of size 2x1
     //  Output : 2x1 - 2 batches 1 neuron each
@@ -2606,6 +2606,36 @@ INSTANTIATE_TEST_CASE_P(fusings_gpu, resample_scale_activation,
                         resample_test_params{ CASE_RESAMPLE_U8_4, 2, 4 },
 }), );
 
+class resample_eltwise_chain : public ResamplePrimitiveFusingTest {};
+TEST_P(resample_eltwise_chain, basic) {
+    auto p = GetParam();
+    create_topologies(input_layout("input", get_input_layout(p)),
+        data("mul_data", get_mem(get_per_channel_layout(p), -10, 10)),
+        data("sub_data", get_mem(get_single_element_layout(p), -10, 10)),
+        data("max_data", get_mem(get_per_channel_layout(p), -10, 10)),
+        resample("resample_prim", "input", p.out_shape, p.in_shape.feature[0], p.type),
+        eltwise("mul", {"resample_prim", "mul_data"}, eltwise_mode::prod, p.default_type),
+        eltwise("sub", {"mul", "sub_data"}, eltwise_mode::sub, p.default_type),
+        eltwise("max", {"max_data", "sub"}, eltwise_mode::max, p.default_type),
+        activation("activation", "max", activation_func::abs),
+        reorder("reorder_bfyx", "activation", p.default_format, data_types::f32)
+    );
+
+    tolerance = 1e-5f;
+    execute(p);
+}
+
+INSTANTIATE_TEST_CASE_P(fusings_gpu, resample_eltwise_chain,
+    ::testing::ValuesIn(std::vector<resample_test_params>{
+                        resample_test_params{ CASE_RESAMPLE_FP32_1, 2, 6 },
+                        resample_test_params{ CASE_RESAMPLE_FP32_5, 2, 6 },
+                        resample_test_params{ CASE_RESAMPLE_FP32_9, 2, 6 },
+
+                        resample_test_params{ CASE_RESAMPLE_FP16_1, 2, 6 },
+                        resample_test_params{ CASE_RESAMPLE_FP16_5, 2, 6 },
+                        resample_test_params{ CASE_RESAMPLE_FP16_9, 2, 6 },
+}), );
+
 class resample_quantize_concat : public ResamplePrimitiveFusingTest {};
 TEST_P(resample_quantize_concat, along_f) {
     auto p = GetParam();
@@ -4296,6 +4326,31 @@ INSTANTIATE_TEST_CASE_P(fusings_gpu,
                             pooling_test_params{CASE_POOLING_I8_2, 2, 3, pooling_mode::average, ""},
                         }), );
 
+class pooling_eltwise_chain : public PoolingFusingTest {};
+TEST_P(pooling_eltwise_chain, basic) {
+    auto p = GetParam();
+    create_topologies(
+        input_layout("input", get_input_layout(p)),
+        data("div_data", get_mem(get_per_channel_layout(p), 1, 10)),
+        data("min_data", get_mem(get_single_element_layout(p), 0, 1)),
+        pooling("pooling", "input", p.pool_mode, tensor{1, 1, 3, 3}, tensor{1}, tensor{0, 0, -1, -1, 0, 0}),
+        eltwise("div", {"pooling", "div_data"}, eltwise_mode::div, p.default_type),
+        eltwise("min", {"min_data", "div"}, eltwise_mode::min, p.default_type),
+        reorder("output_reorder", "min", format::bfyx, data_types::f32));
+
+    tolerance = 1e-05f;
+    execute(p);
+}
+
+INSTANTIATE_TEST_CASE_P(fusings_gpu,
+                        pooling_eltwise_chain,
+                        ::testing::ValuesIn(std::vector<pooling_test_params>{
+                            pooling_test_params{CASE_POOLING_F32_1, 2, 4, pooling_mode::max, ""},
+                            pooling_test_params{CASE_POOLING_F32_1, 2, 4, pooling_mode::average, ""},
+                            pooling_test_params{CASE_POOLING_F16_1, 2, 4, pooling_mode::max, ""},
+                            pooling_test_params{CASE_POOLING_F16_1, 2, 4, pooling_mode::average, ""},
+                        }), );
+
 class pooling_scale_activation_quantize : public PoolingFusingTest {};
 TEST_P(pooling_scale_activation_quantize, basic) {
     auto p = GetParam();
@@ -324,3 +324,61 @@ TYPED_TEST(non_max_suppression_basic, score_threshold) {
         EXPECT_EQ(expected_out[i], out_ptr[i]) << "at i = " << i;
     }
 }
+
+TYPED_TEST(non_max_suppression_basic, center_point_box) {
+    auto engine = tests::get_test_engine();
+
+    // The same boxes as [center x, center y, width, height]
+    const std::vector<TypeParam> center_boxes_data = {
+        TypeParam(5.f), TypeParam(5.f), TypeParam(10.f), TypeParam(10.f),
+        TypeParam(4.5f), TypeParam(6.f), TypeParam(9.f), TypeParam(8.f),
+        TypeParam(7.5f), TypeParam(5.5f), TypeParam(5.f), TypeParam(9.f),
+
+        TypeParam(7.5f), TypeParam(2.5f), TypeParam(5.f), TypeParam(5.f),
+        TypeParam(2.5f), TypeParam(2.5f), TypeParam(5.f), TypeParam(5.f),
+        TypeParam(5.5f), TypeParam(2.f), TypeParam(7.f), TypeParam(4.f),
+    };
+
+    auto num_per_class_mem = memory::allocate(engine, layout(data_types::f32, format::bfyx, tensor(batch(1))));
+    tests::set_values(num_per_class_mem, { 3.f });
+    auto iou_threshold_mem = memory::allocate(engine, layout(data_types::f32, format::bfyx, tensor(batch(1))));
+    tests::set_values(iou_threshold_mem, { 0.4f });
+
+    topology topo;
+    topo.add(input_layout("boxes", this->boxes_layout));
+    topo.add(input_layout("scores", this->scores_layout));
+    topo.add(data("num_per_class", num_per_class_mem));
+    topo.add(data("iou_threshold", iou_threshold_mem));
+    topo.add(non_max_suppression("nms", "boxes", "scores", 6, true, "num_per_class", "iou_threshold"));
+
+    build_options build_opts(
+        build_option::optimize_data(true)
+    );
+    auto net = network(engine, topo, build_opts);
+
+    auto boxes_mem = memory::allocate(engine, this->boxes_layout);
+    tests::set_values(boxes_mem, center_boxes_data);
+    auto scores_mem = this->get_scores_memory(engine);
+
+    net.set_input_data("boxes", boxes_mem);
+    net.set_input_data("scores", scores_mem);
+
+    auto result = net.execute();
+
+    std::vector<int> expected_out = {
+        0, 0, 2,
+        0, 1, 0,
+        1, 0, 2,
+        0, 0, 1,
+        1, 0, 1,
+        1, 1, 2
+    };
+
+    auto out_mem = result.at("nms").get_memory();
+    auto out_ptr = out_mem.pointer<int>();
+
+    ASSERT_EQ(expected_out.size(), out_ptr.size());
+    for (size_t i = 0; i < expected_out.size(); ++i) {
+        EXPECT_EQ(expected_out[i], out_ptr[i]) << "at i = " << i;
+    }
+}
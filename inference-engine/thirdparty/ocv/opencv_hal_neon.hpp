@@ -2323,6 +2323,28 @@ inline v_uint16x8 v_mulhi(const v_uint16x8& a, uint16_t b) {
     return result;
 }
 
+// (a * b + (1 << 14)) >> 15, as _mm_mulhrs_epi16 does
+inline v_int16x8 v_mulhrs(const v_int16x8& a, const v_int16x8& b) {
+    return v_int16x8(vqrdmulhq_s16(a.val, b.val));
+}
+
+inline v_int16x8 v_mulhrs(const v_int16x8& a, short b) {
+    return v_int16x8(vqrdmulhq_n_s16(a.val, b));
+}
+
+namespace {
+    template<int chanNum>
+    static inline v_int16x8 v_gather_chan(const uchar src[], const v_int16x8& index, int channel, int pos) {
+        short CV_DECL_ALIGNED(16) idx[8];
+        vst1q_s16(idx, index.val);
+
+        short CV_DECL_ALIGNED(16) elems[8];
+        for (int i = 0; i < 8; i++) {
+            elems[i] = src[chanNum*(idx[i] + pos) + channel];
+        }
+        return v_int16x8(vld1q_s16(elems));
+    }
+}  // namespace
 
 
 CV_CPU_OPTIMIZATION_HAL_NAMESPACE_END
@@ -0,0 +1,119 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "compressed_weights.hpp"
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char input_message[] = "Required. Path to the IR .bin file with the weights.";
+static constexpr char output_message[] = "Optional. Path to the output file. Default value: \"<input_file>.z\".\n"
+"                                             Replace the original .bin file with it to load the compressed weights.";
+static constexpr char chunk_size_message[] = "Optional. Size of the chunks in KB which are compressed and decompressed in parallel."
+                                             " Default value: 1024.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(i, "", input_message);
+DEFINE_string(o, "", output_message);
+DEFINE_uint32(chunk_size, 1024, chunk_size_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "compress_weights_tool [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message       << std::endl;
+    std::cout << "    -i                           <value>     "   << input_message      << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message     << std::endl;
+    std::cout << "    -chunk_size                  <value>     "   << chunk_size_message << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_i.empty()) {
+        throw std::invalid_argument("Path to the weights file is required");
+    }
+
+    if (FLAGS_chunk_size == 0) {
+        throw std::invalid_argument("Chunk size should be positive");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    using TimeDiff = std::chrono::milliseconds;
+    TimeDiff compressionTimeElapsed {0};
+    size_t rawSize = 0;
+    size_t compressedSize = 0;
+
+    try {
+        std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::ifstream inputFile{FLAGS_i, std::ios::binary};
+        if (!inputFile) {
+            std::cout << "Input file " << FLAGS_i << " can't be opened for reading" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::vector<char> weights{std::istreambuf_iterator<char>(inputFile), std::istreambuf_iterator<char>()};
+        if (InferenceEngine::details::isCompressedWeights(weights.data(), weights.size())) {
+            std::cout << "Input file " << FLAGS_i << " is already compressed" << std::endl;
+            return EXIT_FAILURE;
+        }
+        rawSize = weights.size();
+
+        std::string outputName = FLAGS_o.empty() ? FLAGS_i + ".z" : FLAGS_o;
+        std::ofstream outputFile{outputName, std::ios::binary};
+        if (!outputFile) {
+            std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        auto timeBeforeCompression = std::chrono::steady_clock::now();
+        InferenceEngine::details::compressWeights(weights.data(), weights.size(), outputFile,
+                                                  static_cast<size_t>(FLAGS_chunk_size) * 1024);
+        compressionTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeCompression);
+        compressedSize = static_cast<size_t>(outputFile.tellp());
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Done. " << rawSize << " bytes are compressed to " << compressedSize << " bytes in "
+              << compressionTimeElapsed.count() << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}
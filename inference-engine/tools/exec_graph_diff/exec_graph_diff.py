@@ -0,0 +1,204 @@
+# Copyright (C) 2020 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+#
+
+import argparse
+import csv
+import sys
+import xml.etree.ElementTree as ET
+from collections import Counter, defaultdict
+
+
+class Layer:
+    def __init__(self, element):
+        self.id = element.get('id')
+        self.name = element.get('name')
+        self.type = element.get('type')
+        data = element.find('data')
+        attributes = data.attrib if data is not None else {}
+        self.primitive = attributes.get('primitiveType', '')
+        self.precisions = attributes.get('outputPrecisions', '')
+        self.layouts = attributes.get('outputLayouts', '')
+        self.originals = [name for name in attributes.get('originalLayersNames', '').split(',') if name]
+        exec_time = attributes.get('execTimeMcs', '')
+        self.time_us = float(exec_time) if exec_time.replace('.', '', 1).isdigit() else None
+        self.producers = []
+        self.consumers = []
+
+    def is_reorder(self):
+        return self.type == 'Reorder'
+
+    def anchor(self):
+        return ','.join(sorted(self.originals)) if self.originals else self.name
+
+
+class ExecGraph:
+    def __init__(self, path, counters_path=None):
+        root = ET.parse(path).getroot()
+        self.layers = {}
+        for element in root.iter('layer'):
+            layer = Layer(element)
+            self.layers[layer.id] = layer
+        edges = root.find('edges')
+        for edge in (edges if edges is not None else []):
+            producer = self.layers.get(edge.get('from-layer'))
+            consumer = self.layers.get(edge.get('to-layer'))
+            if producer and consumer:
+                producer.consumers.append(consumer)
+                consumer.producers.append(producer)
+        if counters_path:
+            times = read_counters(counters_path)
+            for layer in self.layers.values():
+                if layer.name in times:
+                    layer.time_us = times[layer.name]
+
+    def total_time(self):
+        return sum(layer.time_us or 0.0 for layer in self.layers.values())
+
+
+def read_counters(path):
+    """Reads the realTime of the layers from a benchmark_app average or detailed counters CSV report"""
+    sums = defaultdict(float)
+    counts = defaultdict(int)
+    with open(path, newline='') as report:
+        for row in csv.reader(report, delimiter=';'):
+            if len(row) < 5 or row[0] in ('layerName', 'Total') or row[1] != 'EXECUTED':
+                continue
+            try:
+                sums[row[0]] += float(row[4]) * 1000.0
+                counts[row[0]] += 1
+            except ValueError:
+                continue
+    return {name: sums[name] / counts[name] for name in sums}
+
+
+def reorder_position(reorder):
+    """The reorders are inserted by the plugin and have no original layers, they are identified by the layers they connect"""
+    def walk(layer, next_layers):
+        visited = set()
+        while layer.is_reorder() and next_layers(layer) and layer.id not in visited:
+            visited.add(layer.id)
+            layer = next_layers(layer)[0]
+        return layer.anchor() if not layer.is_reorder() else ''
+    producer = walk(reorder, lambda layer: layer.producers)
+    consumer = walk(reorder, lambda layer: layer.consumers)
+    return '{} -> {}'.format(producer, consumer)
+
+
+def align(base, new):
+    """Groups the layers of both graphs which share original layers, every group is a part of the network
+    which the plugin executed as the layers of the group in each of the graphs"""
+    parent = {}
+
+    def find(key):
+        parent.setdefault(key, key)
+        while parent[key] != key:
+            parent[key] = parent[parent[key]]
+            key = parent[key]
+        return key
+
+    def union(lhs, rhs):
+        parent[find(lhs)] = find(rhs)
+
+    for tag, graph in (('base', base), ('new', new)):
+        for layer in graph.layers.values():
+            if layer.is_reorder():
+                continue
+            node = (tag, layer.id)
+            find(node)
+            for original in (layer.originals or [layer.name]):
+                union(node, ('original', original))
+
+    groups = defaultdict(lambda: ([], []))
+    for tag, graph, side in (('base', base, 0), ('new', new, 1)):
+        for layer in graph.layers.values():
+            if not layer.is_reorder():
+                groups[find((tag, layer.id))][side].append(layer)
+    return list(groups.values())
+
+
+def group_time(layers):
+    return sum(layer.time_us or 0.0 for layer in layers)
+
+
+def names(layers):
+    return ', '.join(layer.name for layer in layers)
+
+
+def print_section(title, lines):
+    print('\n{} ({})'.format(title, len(lines)))
+    for line in lines:
+        print('  ' + line)
+
+
+def diff(base, new, top, min_delta_us):
+    base_time, new_time = base.total_time(), new.total_time()
+    print('Total time of the layers: {:.1f} us -> {:.1f} us ({:+.1f} us)'.format(base_time, new_time, new_time - base_time))
+
+    base_reorders = Counter(reorder_position(layer) for layer in base.layers.values() if layer.is_reorder())
+    new_reorders = Counter(reorder_position(layer) for layer in new.layers.values() if layer.is_reorder())
+    print_section('New reorders', ['{} x{}'.format(position, count)
+                                   for position, count in sorted((new_reorders - base_reorders).items())])
+    print_section('Removed reorders', ['{} x{}'.format(position, count)
+                                       for position, count in sorted((base_reorders - new_reorders).items())])
+
+    primitives, precisions, fusions, added, removed, deltas = [], [], [], [], [], []
+    for base_layers, new_layers in align(base, new):
+        if not new_layers:
+            removed.append('{} [{}]'.format(names(base_layers), ', '.join(layer.type for layer in base_layers)))
+            continue
+        if not base_layers:
+            added.append('{} [{}]'.format(names(new_layers), ', '.join(layer.type for layer in new_layers)))
+            continue
+        if len(base_layers) == 1 and len(new_layers) == 1:
+            base_layer, new_layer = base_layers[0], new_layers[0]
+            if base_layer.primitive != new_layer.primitive:
+                primitives.append('{}: {} -> {}'.format(new_layer.name, base_layer.primitive, new_layer.primitive))
+            if base_layer.precisions != new_layer.precisions:
+                precisions.append('{}: {} -> {}'.format(new_layer.name, base_layer.precisions, new_layer.precisions))
+        else:
+            fusions.append('{} -> {}'.format(names(base_layers), names(new_layers)))
+        delta = group_time(new_layers) - group_time(base_layers)
+        if group_time(base_layers) + group_time(new_layers) > 0.0 and abs(delta) >= min_delta_us:
+            deltas.append((delta, group_time(base_layers), group_time(new_layers), names(new_layers)))
+
+    print_section('Changed primitive types', primitives)
+    print_section('Changed output precisions', precisions)
+    print_section('Changed fusions', fusions)
+    print_section('New layers', added)
+    print_section('Removed layers', removed)
+
+    deltas.sort(key=lambda value: -abs(value[0]))
+    print_section('Largest time deltas', ['{:+10.1f} us ({:.1f} -> {:.1f}) {}'.format(*value) for value in deltas[:top]])
+
+
+def build_parser():
+    parser = argparse.ArgumentParser(description='Compares the executable graphs of two benchmark_app runs, e.g. of two releases '
+                                                 'or configurations, and reports the layers which changed.')
+    parser.add_argument('base', help='Path to the executable graph of the base run stored with benchmark_app -exec_graph_path')
+    parser.add_argument('new', help='Path to the executable graph of the new run stored with benchmark_app -exec_graph_path')
+    parser.add_argument('--base_counters', default=None,
+                        help='Optional. Path to the benchmark_app -report_type average_counters/detailed_counters report '
+                             'of the base run. By default the times are taken from the executable graph, which has them '
+                             'if the performance counters were enabled with -pc.')
+    parser.add_argument('--new_counters', default=None, help='Optional. Path to the counters report of the new run.')
+    parser.add_argument('--top', type=int, default=20, help='Optional. Number of the largest time deltas to report. Default is 20.')
+    parser.add_argument('--min_delta_us', type=float, default=0.0,
+                        help='Optional. Time deltas below this value in microseconds are not reported. Default is 0.')
+    return parser
+
+
+def main():
+    args = build_parser().parse_args()
+    try:
+        base = ExecGraph(args.base, args.base_counters)
+        new = ExecGraph(args.new, args.new_counters)
+    except (ET.ParseError, OSError) as e:
+        print('Cannot read the executable graphs: {}'.format(e))
+        return 1
+    diff(base, new, args.top, args.min_delta_us)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
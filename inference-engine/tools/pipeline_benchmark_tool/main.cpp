@@ -0,0 +1,427 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "ie_compound_blob.h"
+#include "ie_preprocess_data.hpp"
+#include "postprocessing.hpp"
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char suite_message[] = "Optional. Path to the suite file with the pipelines. Default value: \"pipelines.lst\".";
+static constexpr char models_dir_message[] = "Optional. Directory the model paths of the suite file are relative to.";
+static constexpr char model_message[] = "Optional. Path to the .xml file of a model, it is benchmarked instead of the suite.";
+static constexpr char pipeline_message[] = "Optional. Pipeline of the -m model: \"classification\" or \"detection\".\n"
+"                                             Default value: \"detection\" if the model has a DetectionOutput output.";
+static constexpr char frame_message[] = "Optional. Size of the NV12 frame of the -m model. Default value: \"1920x1080\".";
+static constexpr char image_message[] = "Optional. Path to a raw NV12 frame, a synthetic one is used by default.";
+static constexpr char device_message[] = "Optional. Device to benchmark on. Default value: \"CPU\".";
+static constexpr char nload_message[] = "Optional. Number of times the model is read and loaded. Default value: 5.";
+static constexpr char niter_message[] = "Optional. Number of the measured frames. Default value: 100.";
+static constexpr char threshold_message[] = "Optional. Confidence threshold of the detections. Default value: 0.5.";
+static constexpr char iou_message[] = "Optional. IoU threshold of the non-maximum suppression. Default value: 0.45.";
+static constexpr char output_message[] = "Optional. Path to the JSON report. Default value: \"pipeline_benchmark_report.json\".";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(suite, "pipelines.lst", suite_message);
+DEFINE_string(models_dir, "", models_dir_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(pipeline, "", pipeline_message);
+DEFINE_string(frame, "1920x1080", frame_message);
+DEFINE_string(i, "", image_message);
+DEFINE_string(d, "CPU", device_message);
+DEFINE_uint32(nload, 5, nload_message);
+DEFINE_uint32(niter, 100, niter_message);
+DEFINE_double(threshold, 0.5, threshold_message);
+DEFINE_double(iou, 0.45, iou_message);
+DEFINE_string(o, "pipeline_benchmark_report.json", output_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "pipeline_benchmark_tool [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                                       "   << help_message       << std::endl;
+    std::cout << "    -suite                       <value>     "   << suite_message      << std::endl;
+    std::cout << "    -models_dir                  <value>     "   << models_dir_message << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message      << std::endl;
+    std::cout << "    -pipeline                    <value>     "   << pipeline_message   << std::endl;
+    std::cout << "    -frame                       <value>     "   << frame_message      << std::endl;
+    std::cout << "    -i                           <value>     "   << image_message      << std::endl;
+    std::cout << "    -d                           <value>     "   << device_message     << std::endl;
+    std::cout << "    -nload                       <value>     "   << nload_message      << std::endl;
+    std::cout << "    -niter                       <value>     "   << niter_message      << std::endl;
+    std::cout << "    -threshold                   <value>     "   << threshold_message  << std::endl;
+    std::cout << "    -iou                         <value>     "   << iou_message        << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message     << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int *argc, char ***argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_nload == 0 || FLAGS_niter == 0) {
+        throw std::invalid_argument("Number of iterations should be positive");
+    }
+
+    if (!FLAGS_pipeline.empty() && FLAGS_pipeline != "classification" && FLAGS_pipeline != "detection") {
+        throw std::invalid_argument("Unknown pipeline " + FLAGS_pipeline);
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+namespace {
+
+struct Pipeline {
+    std::string name;
+    std::string model;
+    std::string type;
+    size_t width = 0;
+    size_t height = 0;
+};
+
+// the stages in the order of the report, "frame" is the sum of the stages of a frame
+const char* const stageNames[] = {"read", "load", "preprocess", "infer", "postprocess", "frame"};
+
+struct Report {
+    Pipeline pipeline;
+    size_t inputWidth = 0;
+    size_t inputHeight = 0;
+    std::map<std::string, std::vector<double>> stages;
+};
+
+void parseFrameSize(const std::string& value, Pipeline& pipeline) {
+    char separator = 0;
+    std::istringstream stream(value);
+    if (!(stream >> pipeline.width >> separator >> pipeline.height) || separator != 'x' || !stream.eof() ||
+        pipeline.width == 0 || pipeline.height == 0 || pipeline.width % 2 != 0 || pipeline.height % 2 != 0) {
+        throw std::invalid_argument("Wrong frame size " + value + ", expected an even <width>x<height>");
+    }
+}
+
+std::vector<Pipeline> readSuite(const std::string& path, const std::string& modelsDir) {
+    std::ifstream file{path};
+    if (!file) {
+        throw std::invalid_argument("Suite file " + path + " can't be opened for reading");
+    }
+
+    std::vector<Pipeline> pipelines;
+    std::string line;
+    for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+        std::istringstream stream(line);
+        std::string frame;
+        Pipeline pipeline;
+        if (!(stream >> pipeline.name) || pipeline.name[0] == '#')
+            continue;
+        if (!(stream >> pipeline.model >> pipeline.type >> frame) ||
+            (pipeline.type != "classification" && pipeline.type != "detection")) {
+            throw std::invalid_argument(path + ":" + std::to_string(lineNumber) +
+                                        ": expected <name> <model> <classification|detection> <frame>");
+        }
+        parseFrameSize(frame, pipeline);
+        if (!modelsDir.empty())
+            pipeline.model = modelsDir + "/" + pipeline.model;
+        pipelines.push_back(pipeline);
+    }
+    return pipelines;
+}
+
+bool isDetectionOutput(const DataPtr& output) {
+    const auto& dims = output->getTensorDesc().getDims();
+    return dims.size() == 4 && dims[3] == 7;
+}
+
+template <typename F>
+double measure(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the network takes the decoded U8 planar image, the resize and the color conversion are the preprocess stage
+void configureNetwork(CNNNetwork& network, const std::string& type) {
+    auto inputs = network.getInputsInfo();
+    if (inputs.size() != 1)
+        throw std::logic_error("The pipelines expect the networks with a single image input");
+    const auto& dims = inputs.begin()->second->getTensorDesc().getDims();
+    if (dims.size() != 4 || dims[0] != 1 || dims[1] != 3)
+        throw std::logic_error("The pipelines expect the [1, 3, H, W] image input");
+    inputs.begin()->second->setPrecision(Precision::U8);
+    inputs.begin()->second->setLayout(Layout::NCHW);
+
+    auto outputs = network.getOutputsInfo();
+    for (auto& output : outputs)
+        output.second->setPrecision(Precision::FP32);
+    if (type == "detection" && std::none_of(outputs.begin(), outputs.end(),
+            [] (const std::pair<const std::string, DataPtr>& output) {return isDetectionOutput(output.second);})) {
+        throw std::logic_error("The detection pipeline expects a [1, 1, N, 7] output of DetectionOutput");
+    }
+}
+
+std::vector<uint8_t> createFrame(const Pipeline& pipeline) {
+    const size_t size = pipeline.width * pipeline.height * 3 / 2;
+    if (!FLAGS_i.empty()) {
+        std::ifstream file{FLAGS_i, std::ios::binary};
+        std::vector<uint8_t> frame{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        if (frame.size() != size) {
+            throw std::invalid_argument("Frame " + FLAGS_i + " is not a " + std::to_string(pipeline.width) + "x" +
+                                        std::to_string(pipeline.height) + " NV12 frame");
+        }
+        return frame;
+    }
+    // a gradient, so the resize does not work on a constant image, and the neutral chroma
+    std::vector<uint8_t> frame(size, 128);
+    for (size_t y = 0; y < pipeline.height; y++)
+        for (size_t x = 0; x < pipeline.width; x++)
+            frame[y * pipeline.width + x] = static_cast<uint8_t>((x + y) & 0xFF);
+    return frame;
+}
+
+Report run(Core& core, const Pipeline& pipeline) {
+    Report report;
+    report.pipeline = pipeline;
+
+    ExecutableNetwork executableNetwork;
+    std::string inputName;
+    std::vector<std::string> outputNames;
+    for (uint32_t i = 0; i < FLAGS_nload; i++) {
+        CNNNetwork network;
+        report.stages["read"].push_back(measure([&] {
+            network = core.ReadNetwork(pipeline.model);
+        }));
+        configureNetwork(network, pipeline.type);
+        inputName = network.getInputsInfo().begin()->first;
+        const auto& dims = network.getInputsInfo().begin()->second->getTensorDesc().getDims();
+        report.inputHeight = dims[2];
+        report.inputWidth = dims[3];
+        outputNames.clear();
+        for (const auto& output : network.getOutputsInfo()) {
+            if (pipeline.type == "classification" || isDetectionOutput(output.second))
+                outputNames.push_back(output.first);
+        }
+
+        // the previous network is released first, so every load starts from the same state of the device
+        executableNetwork = {};
+        report.stages["load"].push_back(measure([&] {
+            executableNetwork = core.LoadNetwork(network, FLAGS_d);
+        }));
+    }
+
+    auto request = executableNetwork.CreateInferRequest();
+    auto input = request.GetBlob(inputName);
+
+    auto frame = createFrame(pipeline);
+    auto yPlane = make_shared_blob<uint8_t>({Precision::U8, {1, 1, pipeline.height, pipeline.width}, Layout::NHWC},
+                                            frame.data());
+    auto uvPlane = make_shared_blob<uint8_t>({Precision::U8, {1, 2, pipeline.height / 2, pipeline.width / 2}, Layout::NHWC},
+                                             frame.data() + pipeline.width * pipeline.height);
+    auto preprocData = CreatePreprocDataHelper();
+    preprocData->setRoiBlob(make_shared_blob<NV12Blob>(yPlane, uvPlane));
+    PreProcessInfo preprocInfo;
+    preprocInfo.setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+    preprocInfo.setColorFormat(ColorFormat::NV12);
+
+    size_t results = 0;
+    const float threshold = static_cast<float>(FLAGS_threshold);
+    const float iou = static_cast<float>(FLAGS_iou);
+    auto postprocess = [&] {
+        results = 0;
+        for (const auto& name : outputNames) {
+            auto output = request.GetBlob(name);
+            if (pipeline.type == "classification") {
+                results += TopK(output, 5).size();
+            } else {
+                auto detections = ParseDetectionOutput(output, threshold);
+                results += NonMaxSuppression(detections, iou).size();
+            }
+        }
+    };
+
+    // the first frame allocates the memory and warms up the caches, it is not measured
+    preprocData->execute(input, preprocInfo, false);
+    request.Infer();
+    postprocess();
+
+    for (uint32_t i = 0; i < FLAGS_niter; i++) {
+        double preprocess = measure([&] {preprocData->execute(input, preprocInfo, false);});
+        double infer = measure([&] {request.Infer();});
+        double postprocessing = measure(postprocess);
+        report.stages["preprocess"].push_back(preprocess);
+        report.stages["infer"].push_back(infer);
+        report.stages["postprocess"].push_back(postprocessing);
+        report.stages["frame"].push_back(preprocess + infer + postprocessing);
+    }
+    std::cout << "    " << results << (pipeline.type == "classification" ? " classes" : " detections")
+              << " per frame" << std::endl;
+    return report;
+}
+
+std::string escape(const std::string& value) {
+    std::string escaped;
+    for (char c : value) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// the same statistics as the latency of benchmark_app: nearest-rank percentiles in milliseconds
+void writeStatistics(std::ostream& stream, const std::vector<double>& times) {
+    std::vector<double> sorted(times);
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted] (double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+    };
+    double median = (sorted.size() % 2 != 0) ?
+                    sorted[sorted.size() / 2] :
+                    (sorted[sorted.size() / 2] + sorted[sorted.size() / 2 - 1]) / 2.0;
+    double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+
+    stream << "{\"count\": " << sorted.size() << ", \"mean\": " << mean << ", \"min\": " << sorted.front()
+           << ", \"median\": " << median << ", \"p90\": " << percentile(90.0) << ", \"p95\": " << percentile(95.0)
+           << ", \"p99\": " << percentile(99.0) << ", \"max\": " << sorted.back() << "}";
+}
+
+void writeReport(const std::string& path, Core& core, const std::vector<Report>& reports,
+                 const std::vector<Pipeline>& skipped) {
+    std::ofstream stream{path};
+    if (!stream) {
+        throw std::invalid_argument("Report file " + path + " can't be opened for writing");
+    }
+    stream << std::fixed << std::setprecision(3);
+
+    std::string plugin;
+    for (const auto& version : core.GetVersions(FLAGS_d))
+        plugin = version.second.buildNumber;
+
+    stream << "{\n";
+    stream << "  \"inference_engine\": \"" << escape(GetInferenceEngineVersion()->buildNumber) << "\",\n";
+    stream << "  \"device\": \"" << escape(FLAGS_d) << "\",\n";
+    stream << "  \"plugin\": \"" << escape(plugin) << "\",\n";
+    stream << "  \"pipelines\": [";
+    for (size_t i = 0; i < reports.size(); i++) {
+        const auto& report = reports[i];
+        stream << (i == 0 ? "\n" : ",\n");
+        stream << "    {\n";
+        stream << "      \"name\": \"" << escape(report.pipeline.name) << "\",\n";
+        stream << "      \"model\": \"" << escape(report.pipeline.model) << "\",\n";
+        stream << "      \"pipeline\": \"" << report.pipeline.type << "\",\n";
+        stream << "      \"frame\": {\"width\": " << report.pipeline.width << ", \"height\": " << report.pipeline.height
+               << "},\n";
+        stream << "      \"input\": {\"width\": " << report.inputWidth << ", \"height\": " << report.inputHeight << "},\n";
+        stream << "      \"stages\": {";
+        for (size_t j = 0; j < sizeof(stageNames) / sizeof(stageNames[0]); j++) {
+            stream << (j == 0 ? "\n" : ",\n") << "        \"" << stageNames[j] << "\": ";
+            writeStatistics(stream, report.stages.at(stageNames[j]));
+        }
+        stream << "\n      }\n";
+        stream << "    }";
+    }
+    stream << "\n  ],\n";
+    stream << "  \"skipped\": [";
+    for (size_t i = 0; i < skipped.size(); i++)
+        stream << (i == 0 ? "" : ", ") << "\"" << escape(skipped[i].name) << "\"";
+    stream << "]\n";
+    stream << "}\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    try {
+        std::cout << "Inference Engine: " << GetInferenceEngineVersion()->buildNumber << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::vector<Pipeline> pipelines;
+        if (FLAGS_m.empty()) {
+            pipelines = readSuite(FLAGS_suite, FLAGS_models_dir);
+        } else {
+            Pipeline pipeline;
+            pipeline.name = FLAGS_m;
+            pipeline.model = FLAGS_m;
+            pipeline.type = FLAGS_pipeline;
+            parseFrameSize(FLAGS_frame, pipeline);
+            pipelines.push_back(pipeline);
+        }
+
+        Core core;
+        std::vector<Report> reports;
+        std::vector<Pipeline> skipped;
+        for (auto& pipeline : pipelines) {
+            // a missing model of the suite is reported, so the reports with different models are not compared
+            if (!std::ifstream{pipeline.model}) {
+                std::cout << "[ WARNING ] " << pipeline.name << " is skipped, " << pipeline.model << " is not found" << std::endl;
+                skipped.push_back(pipeline);
+                continue;
+            }
+            if (pipeline.type.empty()) {
+                auto outputs = core.ReadNetwork(pipeline.model).getOutputsInfo();
+                bool detection = std::any_of(outputs.begin(), outputs.end(),
+                    [] (const std::pair<const std::string, DataPtr>& output) {return isDetectionOutput(output.second);});
+                pipeline.type = detection ? "detection" : "classification";
+            }
+            std::cout << pipeline.name << " (" << pipeline.type << ", " << pipeline.width << "x" << pipeline.height
+                      << " NV12) on " << FLAGS_d << std::endl;
+            reports.push_back(run(core, pipeline));
+
+            const auto& frame = reports.back().stages.at("frame");
+            std::cout << "    Frame:      " << std::accumulate(frame.begin(), frame.end(), 0.0) / frame.size()
+                      << " ms on average" << std::endl;
+        }
+
+        if (reports.empty()) {
+            std::cerr << "No models of the suite are found" << std::endl;
+            return EXIT_FAILURE;
+        }
+        writeReport(FLAGS_o, core, reports, skipped);
+        std::cout << "Report is written to " << FLAGS_o << std::endl;
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "postprocessing.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace {
+
+MemoryBlob::Ptr asFP32(const Blob::Ptr& output) {
+    auto memory = as<MemoryBlob>(output);
+    if (!memory || output->getTensorDesc().getPrecision() != Precision::FP32)
+        throw std::logic_error("The postprocessing expects the FP32 outputs");
+    return memory;
+}
+
+float intersectionOverUnion(const Detection& a, const Detection& b) {
+    const float width = std::min(a.xmax, b.xmax) - std::max(a.xmin, b.xmin);
+    const float height = std::min(a.ymax, b.ymax) - std::max(a.ymin, b.ymin);
+    if (width <= 0.f || height <= 0.f)
+        return 0.f;
+    const float intersection = width * height;
+    const float areaA = (a.xmax - a.xmin) * (a.ymax - a.ymin);
+    const float areaB = (b.xmax - b.xmin) * (b.ymax - b.ymin);
+    return intersection / (areaA + areaB - intersection);
+}
+
+}  // namespace
+
+std::vector<Detection> ParseDetectionOutput(const Blob::Ptr& output, float threshold) {
+    const auto& dims = output->getTensorDesc().getDims();
+    if (dims.size() != 4 || dims[3] != 7)
+        throw std::logic_error("The output of DetectionOutput must be [1, 1, N, 7]");
+    auto mapped = asFP32(output)->rmap();
+    const float* data = mapped.as<const float*>();
+
+    std::vector<Detection> detections;
+    for (size_t i = 0; i < dims[2]; i++) {
+        const float* row = data + i * 7;
+        if (row[0] < 0.f)
+            break;
+        if (row[2] < threshold)
+            continue;
+        detections.push_back({static_cast<int>(row[1]), row[2], row[3], row[4], row[5], row[6]});
+    }
+    return detections;
+}
+
+std::vector<Detection> NonMaxSuppression(std::vector<Detection>& detections, float iouThreshold) {
+    std::stable_sort(detections.begin(), detections.end(), [] (const Detection& a, const Detection& b) {
+        return a.confidence > b.confidence;
+    });
+
+    std::vector<Detection> kept;
+    for (const auto& detection : detections) {
+        bool suppressed = std::any_of(kept.begin(), kept.end(), [&] (const Detection& other) {
+            return other.label == detection.label && intersectionOverUnion(other, detection) > iouThreshold;
+        });
+        if (!suppressed)
+            kept.push_back(detection);
+    }
+    return kept;
+}
+
+std::vector<std::pair<size_t, float>> TopK(const Blob::Ptr& output, size_t k) {
+    const auto& dims = output->getTensorDesc().getDims();
+    if (dims.empty() || dims[0] != 1)
+        throw std::logic_error("The classification output must have the batch of one");
+    const size_t classes = output->size();
+    auto mapped = asFP32(output)->rmap();
+    const float* data = mapped.as<const float*>();
+
+    std::vector<size_t> indices(classes);
+    for (size_t i = 0; i < classes; i++)
+        indices[i] = i;
+    k = std::min(k, classes);
+    std::partial_sort(indices.begin(), indices.begin() + k, indices.end(), [data] (size_t a, size_t b) {
+        return data[a] > data[b];
+    });
+
+    std::vector<std::pair<size_t, float>> top;
+    for (size_t i = 0; i < k; i++)
+        top.emplace_back(indices[i], data[indices[i]]);
+    return top;
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <ie_blob.h>
+
+struct Detection {
+    int label;
+    float confidence;
+    float xmin, ymin, xmax, ymax;
+};
+
+/**
+ * @brief Reads the [1, 1, N, 7] output of DetectionOutput, the list ends at the first image id below zero
+ * @param output The output blob, FP32
+ * @param threshold The detections with a smaller confidence are skipped
+ */
+std::vector<Detection> ParseDetectionOutput(const InferenceEngine::Blob::Ptr& output, float threshold);
+
+/**
+ * @brief The greedy class-wise non-maximum suppression the applications run on the detections of every frame
+ * @param detections The detections, they are sorted by the confidence in place
+ * @param iouThreshold The boxes overlapping a more confident one of the same class by a larger IoU are removed
+ */
+std::vector<Detection> NonMaxSuppression(std::vector<Detection>& detections, float iouThreshold);
+
+/**
+ * @brief Returns the classes with the largest scores and the scores, the first dimension is the batch of one
+ * @param output The output blob, FP32
+ * @param k The number of the classes
+ */
+std::vector<std::pair<size_t, float>> TopK(const InferenceEngine::Blob::Ptr& output, size_t k);
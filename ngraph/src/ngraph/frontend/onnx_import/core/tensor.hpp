@@ -23,6 +23,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -151,12 +152,21 @@ namespace ngraph
                         }
 
                         template <typename T>
-                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                        inline std::vector<T> __get_raw_data(const char* raw_data,
+                                                             std::size_t raw_data_size,
                                                              int onnx_data_type)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
+                            auto it = reinterpret_cast<const T*>(raw_data);
                             return std::vector<T>(
-                                it, it + (raw_data.size() / __get_onnx_data_size(onnx_data_type)));
+                                it, it + (raw_data_size / __get_onnx_data_size(onnx_data_type)));
+                        }
+
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                                                             int onnx_data_type)
+                        {
+                            return __get_raw_data<T>(
+                                raw_data.data(), raw_data.size(), onnx_data_type);
                         }
                     }
                 }
@@ -430,9 +440,23 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    // external data is stored in the same way as raw_data
+                    const auto data = detail::TensorExternalData{*m_tensor_proto}.load();
+                    return detail::tensor::detail::__get_raw_data<T>(
+                        data->get_ptr<char>(), data->size(), m_tensor_proto->data_type());
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+
             const std::string& get_name() const
             {
                 if (!m_tensor_proto->has_name())
@@ -526,8 +550,29 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                const std::size_t byte_size = shape_size(m_shape) * sizeof(T);
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (has_external_data())
+                {
+                    // the constant shares the pages of the mapped data file, nothing is copied
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, detail::TensorExternalData{*m_tensor_proto}.load());
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == byte_size)
+                {
+                    // copied once, directly from the message instead of through a vector
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
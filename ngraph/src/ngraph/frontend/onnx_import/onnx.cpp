@@ -24,6 +24,7 @@
 #include "ngraph/except.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -90,6 +91,12 @@ namespace ngraph
         } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return import_onnx_model(stream, "");
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path)
         {
             if (!stream.good())
             {
@@ -119,6 +126,7 @@ namespace ngraph
                 }
 #endif
             }
+            detail::update_external_data_paths(model_proto, model_path);
             return detail::convert_to_ng_function(model_proto);
         }
 
@@ -129,7 +137,7 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            return import_onnx_model(ifs, file_path);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
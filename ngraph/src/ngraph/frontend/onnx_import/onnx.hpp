@@ -68,6 +68,22 @@ namespace ngraph
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(std::istream& stream);
 
+        /// \brief      Imports and converts an serialized ONNX model from the input stream
+        ///             to an nGraph Function representation.
+        ///
+        /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
+        ///             the function throws an ngraph_error exception.
+        ///
+        /// \param[in]  stream      The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_path  The path to the file the model was read from. Relative
+        ///                         locations of tensors with external data are resolved
+        ///                         against its directory.
+        ///
+        /// \return     An nGraph function that represents a single output from the created graph.
+        ONNX_IMPORTER_API
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path);
+
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
         ///
@@ -75,7 +91,8 @@ namespace ngraph
         ///            the function throws an ngraph_error exception.
         ///
         /// \param[in] file_path  The path to a file containing the ONNX model
-        ///                       (relative or absolute).
+        ///                       (relative or absolute). Tensors with external data are
+        ///                       mapped into memory from the files next to the model.
         ///
         /// \return    An nGraph function that represents a single output from the created graph.
         ONNX_IMPORTER_API
@@ -0,0 +1,288 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdlib>
+#include <sstream>
+
+#include "ngraph/file_util.hpp"
+#include "utils/tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                /// \brief  Read-only view of a part of a file mapped into memory.
+                ///
+                /// The mapping starts at the page containing the requested offset,
+                /// so the view is placed inside of it.
+                class MappedFileView : public runtime::AlignedBuffer
+                {
+                public:
+                    MappedFileView(const std::string& path, std::size_t offset, std::size_t length)
+                    {
+#ifdef _WIN32
+                        HANDLE file = ::CreateFileA(path.c_str(),
+                                                    GENERIC_READ,
+                                                    FILE_SHARE_READ,
+                                                    nullptr,
+                                                    OPEN_EXISTING,
+                                                    FILE_ATTRIBUTE_NORMAL,
+                                                    nullptr);
+                        if (file == INVALID_HANDLE_VALUE)
+                        {
+                            throw error::tensor::invalid_external_data{"cannot open " + path};
+                        }
+                        LARGE_INTEGER file_size;
+                        ::GetFileSizeEx(file, &file_size);
+                        m_file_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+                        int fd = ::open(path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                        {
+                            throw error::tensor::invalid_external_data{"cannot open " + path};
+                        }
+                        struct stat sb = {};
+                        ::fstat(fd, &sb);
+                        m_file_size = static_cast<std::size_t>(sb.st_size);
+#endif
+                        if (length == 0)
+                        {
+                            length = offset < m_file_size ? m_file_size - offset : 0;
+                        }
+                        if (offset > m_file_size || m_file_size - offset < length)
+                        {
+#ifdef _WIN32
+                            ::CloseHandle(file);
+#else
+                            ::close(fd);
+#endif
+                            std::stringstream message;
+                            message << "the data exceeds the size of " << path << " (offset "
+                                    << offset << ", length " << length << ", file size "
+                                    << m_file_size << ")";
+                            throw error::tensor::invalid_external_data{message.str()};
+                        }
+
+#ifdef _WIN32
+                        SYSTEM_INFO system_info;
+                        ::GetSystemInfo(&system_info);
+                        const std::size_t granularity = system_info.dwAllocationGranularity;
+                        const std::size_t map_offset = offset / granularity * granularity;
+                        m_map_size = offset - map_offset + length;
+                        m_mapping = ::CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                        if (m_mapping != nullptr && m_map_size != 0)
+                        {
+                            m_map = ::MapViewOfFile(m_mapping,
+                                                    FILE_MAP_COPY,
+                                                    static_cast<DWORD>(map_offset >> 32),
+                                                    static_cast<DWORD>(map_offset & 0xFFFFFFFF),
+                                                    m_map_size);
+                        }
+                        ::CloseHandle(file);
+#else
+                        const std::size_t granularity =
+                            static_cast<std::size_t>(::sysconf(_SC_PAGE_SIZE));
+                        const std::size_t map_offset = offset / granularity * granularity;
+                        m_map_size = offset - map_offset + length;
+                        if (m_map_size != 0)
+                        {
+                            // MAP_PRIVATE keeps pages shared until somebody writes into them
+                            void* map = ::mmap(nullptr,
+                                               m_map_size,
+                                               PROT_READ | PROT_WRITE,
+                                               MAP_PRIVATE,
+                                               fd,
+                                               static_cast<off_t>(map_offset));
+                            m_map = map == MAP_FAILED ? nullptr : map;
+                        }
+                        // the mapping stays valid after the descriptor is closed
+                        ::close(fd);
+#endif
+                        if (m_map == nullptr && length != 0)
+                        {
+#ifdef _WIN32
+                            if (m_mapping != nullptr)
+                            {
+                                ::CloseHandle(m_mapping);
+                            }
+#endif
+                            throw error::tensor::invalid_external_data{"cannot map " + path};
+                        }
+                        m_allocated_buffer = static_cast<char*>(m_map) + (offset - map_offset);
+                        m_aligned_buffer = m_allocated_buffer;
+                        m_byte_size = length;
+                    }
+
+                    ~MappedFileView() override
+                    {
+                        if (m_map != nullptr)
+                        {
+#ifdef _WIN32
+                            ::UnmapViewOfFile(m_map);
+#else
+                            ::munmap(m_map, m_map_size);
+#endif
+                        }
+#ifdef _WIN32
+                        if (m_mapping != nullptr)
+                        {
+                            ::CloseHandle(m_mapping);
+                        }
+#endif
+                        // the memory is not owned by the buffer, must not be freed by AlignedBuffer
+                        m_allocated_buffer = nullptr;
+                        m_aligned_buffer = nullptr;
+                        m_byte_size = 0;
+                    }
+
+                private:
+                    void* m_map = nullptr;
+                    std::size_t m_map_size = 0;
+                    std::size_t m_file_size = 0;
+#ifdef _WIN32
+                    HANDLE m_mapping = nullptr;
+#endif
+                };
+
+                bool is_absolute(const std::string& path)
+                {
+#ifdef _WIN32
+                    return (path.size() > 1 && path[1] == ':') ||
+                           (!path.empty() && (path[0] == '\\' || path[0] == '/'));
+#else
+                    return !path.empty() && path[0] == '/';
+#endif
+                }
+
+                std::string get_model_directory(const std::string& model_path)
+                {
+#ifdef _WIN32
+                    const auto pos = model_path.find_last_of("/\\");
+#else
+                    const auto pos = model_path.find_last_of('/');
+#endif
+                    return pos == std::string::npos ? std::string{} : model_path.substr(0, pos);
+                }
+
+                void update_tensor(ONNX_NAMESPACE::TensorProto& tensor,
+                                   const std::string& model_dir)
+                {
+                    if (tensor.data_location() != ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL)
+                    {
+                        return;
+                    }
+                    for (auto& entry : *tensor.mutable_external_data())
+                    {
+                        if (entry.key() == "location" && !is_absolute(entry.value()))
+                        {
+                            entry.set_value(file_util::path_join(model_dir, entry.value()));
+                        }
+                    }
+                }
+
+                void update_graph(ONNX_NAMESPACE::GraphProto& graph, const std::string& model_dir)
+                {
+                    for (auto& initializer : *graph.mutable_initializer())
+                    {
+                        update_tensor(initializer, model_dir);
+                    }
+                    for (auto& node : *graph.mutable_node())
+                    {
+                        for (auto& attribute : *node.mutable_attribute())
+                        {
+                            if (attribute.has_t())
+                            {
+                                update_tensor(*attribute.mutable_t(), model_dir);
+                            }
+                            for (auto& tensor : *attribute.mutable_tensors())
+                            {
+                                update_tensor(tensor, model_dir);
+                            }
+                            if (attribute.has_g())
+                            {
+                                update_graph(*attribute.mutable_g(), model_dir);
+                            }
+                            for (auto& subgraph : *attribute.mutable_graphs())
+                            {
+                                update_graph(subgraph, model_dir);
+                            }
+                        }
+                    }
+                }
+            }
+
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        m_location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        m_offset = std::strtoull(entry.value().c_str(), nullptr, 10);
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        m_length = std::strtoull(entry.value().c_str(), nullptr, 10);
+                        m_has_length = true;
+                    }
+                }
+                if (m_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"location of tensor " +
+                                                               tensor.name() + " is not set"};
+                }
+            }
+
+            std::shared_ptr<runtime::AlignedBuffer> TensorExternalData::load() const
+            {
+                if (m_has_length && m_length == 0)
+                {
+                    return std::make_shared<runtime::AlignedBuffer>(0);
+                }
+                return std::make_shared<MappedFileView>(m_location, m_offset, m_length);
+            }
+
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path)
+            {
+                const auto model_dir = get_model_directory(model_path);
+                if (!model_dir.empty())
+                {
+                    update_graph(*model_proto.mutable_graph(), model_dir);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <onnx/onnx_pb.h>
+#include <memory>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& message)
+                        : ngraph_error{"invalid external data: " + message}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            /// \brief  Data of an ONNX tensor stored outside of the model file
+            ///         (data_location: EXTERNAL).
+            class TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief  Maps the data into memory.
+                ///
+                /// The pages are shared with the OS page cache and loaded when
+                /// they are touched, the mapping lives as long as the buffer.
+                ///
+                /// \return Buffer holding exactly the bytes of the tensor.
+                std::shared_ptr<runtime::AlignedBuffer> load() const;
+
+                const std::string& get_location() const { return m_location; }
+                std::size_t get_offset() const { return m_offset; }
+
+            private:
+                std::string m_location;
+                std::size_t m_offset = 0;
+                std::size_t m_length = 0;
+                bool m_has_length = false;
+            };
+
+            /// \brief  Makes relative locations of external data of the tensors
+            ///         of the model relative to the directory of the model file.
+            ///
+            /// \param  model_proto The model with tensors to update.
+            /// \param  model_path  The path to the model file. Locations are kept
+            ///                     relative to the working directory if it is empty.
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path);
+        }
+    }
+}
@@ -95,6 +95,69 @@ void Function::validate_nodes_and_infer_types()
     }
 }
 
+void Function::validate_nodes_and_infer_types(const ParameterVector& changed_parameters)
+{
+    if (changed_parameters.empty())
+    {
+        return;
+    }
+
+    unordered_set<const Node*> changed;
+    for (const auto& parameter : changed_parameters)
+    {
+        if (find(m_parameters.begin(), m_parameters.end(), parameter) == m_parameters.end())
+        {
+            throw ngraph_error("Function references undeclared parameter");
+        }
+        changed.insert(parameter.get());
+    }
+
+    for (auto& node : get_ordered_ops())
+    {
+        if (changed.count(node.get()))
+        {
+            continue;
+        }
+        bool affected = false;
+        for (const auto& input : node->inputs())
+        {
+            if (changed.count(input.get_source_output().get_node()))
+            {
+                affected = true;
+                break;
+            }
+        }
+        if (!affected)
+        {
+            continue;
+        }
+
+        vector<pair<element::Type, PartialShape>> outputs;
+        outputs.reserve(node->get_output_size());
+        for (const auto& output : node->outputs())
+        {
+            outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+
+        node->revalidate_and_infer_types();
+
+        if (outputs.size() != node->get_output_size())
+        {
+            changed.insert(node.get());
+            continue;
+        }
+        for (size_t i = 0; i < outputs.size(); ++i)
+        {
+            if (outputs[i].first != node->get_output_element_type(i) ||
+                !outputs[i].second.same_scheme(node->get_output_partial_shape(i)))
+            {
+                changed.insert(node.get());
+                break;
+            }
+        }
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -105,6 +105,16 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Revalidates only the nodes affected by the given parameters.
+        ///
+        /// The nodes are visited in topological order starting from `changed_parameters`. A
+        /// node is revalidated when one of its inputs comes from a node whose output element
+        /// types or shapes were changed, so the propagation stops at the nodes whose outputs
+        /// stay the same. All other nodes must have been validated before.
+        ///
+        /// \param changed_parameters The parameters whose element types or shapes were changed.
+        void validate_nodes_and_infer_types(const ParameterVector& changed_parameters);
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_arena.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    shared_ptr<GraphArena>& current_arena()
+    {
+        static thread_local shared_ptr<GraphArena> arena;
+        return arena;
+    }
+}
+
+GraphArena::Scope::Scope(const shared_ptr<GraphArena>& arena)
+    : m_previous(current_arena())
+{
+    current_arena() = arena;
+}
+
+GraphArena::Scope::~Scope()
+{
+    current_arena() = std::move(m_previous);
+}
+
+GraphArena::GraphArena(size_t block_size)
+    : m_block_size(block_size)
+{
+    NGRAPH_CHECK(block_size > 0, "Arena block size must be positive");
+}
+
+void* GraphArena::allocate(size_t size, size_t alignment)
+{
+    NGRAPH_CHECK(alignment > 0 && (alignment & (alignment - 1)) == 0,
+                 "Arena alignment must be a power of two");
+
+    lock_guard<mutex> guard(m_mutex);
+    auto padding = (alignment - reinterpret_cast<uintptr_t>(m_position) % alignment) % alignment;
+    if (m_position == nullptr || padding + size > m_available)
+    {
+        // Objects bigger than a quarter of a block get their own block, so they do not
+        // waste the rest of the current one
+        auto block_size = size + alignment;
+        if (block_size * 4 <= m_block_size)
+        {
+            block_size = m_block_size;
+        }
+        m_blocks.emplace_back(new char[block_size]);
+        char* block = m_blocks.back().get();
+        padding = (alignment - reinterpret_cast<uintptr_t>(block) % alignment) % alignment;
+        if (block_size != m_block_size)
+        {
+            m_allocated += size;
+            return block + padding;
+        }
+        m_position = block;
+        m_available = block_size;
+    }
+
+    void* result = m_position + padding;
+    m_position += padding + size;
+    m_available -= padding + size;
+    m_allocated += size;
+    return result;
+}
+
+size_t GraphArena::get_allocated_size() const
+{
+    lock_guard<mutex> guard(m_mutex);
+    return m_allocated;
+}
+
+shared_ptr<GraphArena> GraphArena::get_current()
+{
+    return current_arena();
+}
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Bump allocator for the objects of a graph.
+    ///
+    /// Memory is handed out from big blocks and is never returned piece by piece: the blocks
+    /// are released at once when the arena is destroyed. Every object allocated through
+    /// GraphArenaAllocator keeps the arena alive, so the arena goes away together with the
+    /// last node of the graph, whichever thread releases it.
+    class NGRAPH_API GraphArena
+    {
+    public:
+        /// \brief Makes an arena current for the calling thread for the lifetime of the scope.
+        ///        Scopes can be nested, the previous arena is restored on exit.
+        class NGRAPH_API Scope
+        {
+        public:
+            explicit Scope(const std::shared_ptr<GraphArena>& arena);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            std::shared_ptr<GraphArena> m_previous;
+        };
+
+        explicit GraphArena(size_t block_size = 64 * 1024);
+
+        GraphArena(const GraphArena&) = delete;
+        GraphArena& operator=(const GraphArena&) = delete;
+
+        /// \brief Allocates size bytes aligned to alignment, which must be a power of two.
+        void* allocate(size_t size, size_t alignment);
+
+        /// \brief Number of bytes handed out by the arena so far.
+        size_t get_allocated_size() const;
+
+        /// \brief The arena of the innermost Scope of the calling thread, or nullptr.
+        static std::shared_ptr<GraphArena> get_current();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        const size_t m_block_size;
+        char* m_position = nullptr;
+        size_t m_available = 0;
+        size_t m_allocated = 0;
+    };
+
+    /// \brief Standard allocator which takes its memory from a GraphArena. Deallocation is a
+    ///        no-op, the memory is released with the arena.
+    template <typename T>
+    class GraphArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit GraphArenaAllocator(std::shared_ptr<GraphArena> arena)
+            : m_arena(std::move(arena))
+        {
+        }
+
+        template <typename U>
+        GraphArenaAllocator(const GraphArenaAllocator<U>& other)
+            : m_arena(other.get_arena())
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T*, size_t) {}
+
+        const std::shared_ptr<GraphArena>& get_arena() const { return m_arena; }
+
+    private:
+        std::shared_ptr<GraphArena> m_arena;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const GraphArenaAllocator<T>& a, const GraphArenaAllocator<U>& b)
+    {
+        return a.get_arena() == b.get_arena();
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const GraphArenaAllocator<T>& a, const GraphArenaAllocator<U>& b)
+    {
+        return !(a == b);
+    }
+
+    /// \brief Same as std::make_shared, but the object and its control block are placed in
+    ///        the current arena of the thread when there is one.
+    template <typename T, typename... Args>
+    std::shared_ptr<T> make_shared_in_arena(Args&&... args)
+    {
+        if (auto arena = GraphArena::get_current())
+        {
+            return std::allocate_shared<T>(GraphArenaAllocator<T>(std::move(arena)),
+                                           std::forward<Args>(args)...);
+        }
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+}
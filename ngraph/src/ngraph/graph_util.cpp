@@ -278,18 +278,19 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
-std::vector<std::shared_ptr<ngraph::Node>>
-    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+// clones the nodes which are already in topological order
+static void clone_sorted_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& sorted_nodes,
+                               NodeMap& node_map)
 {
-    // for each node in topological order
-    auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    for (const auto& node : sorted_nodes)
     {
         if (node_map.count(node.get()) == 0)
         {
             // get (already) cloned arguments and clone the node
             OutputVector cloned_args;
-            for (auto input : node->inputs())
+            cloned_args.reserve(node->get_input_size());
+            for (const auto& input : node->inputs())
             {
                 Output<Node> output = input.get_source_output();
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
@@ -320,6 +321,13 @@ std::vector<std::shared_ptr<ngraph::Node>>
             node_map[node.get()] = cloned_node;
         }
     }
+}
+
+std::vector<std::shared_ptr<ngraph::Node>>
+    ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
+{
+    // for each node in topological order
+    clone_sorted_nodes(topological_sort(nodes), node_map);
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
@@ -404,8 +412,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(), node_map);
+    // clone function operations, the ops of the function are sorted once
+    clone_sorted_nodes(func.get_ordered_ops(), node_map);
 
     // get cloned function results and parameters
     ResultVector cloned_results;
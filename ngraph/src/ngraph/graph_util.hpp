@@ -397,6 +397,7 @@ namespace ngraph
     // input function is cloned and returned
     // NodeMap input may contain default node mapping i.e. pre-cloned nodes
     // NodeMap output (by reference) fully maps input and cloned function ops
+    // cloned Constants share the data buffers of the original ones, no data is copied
     NGRAPH_API
     std::shared_ptr<ngraph::Function> clone_function(const ngraph::Function& func,
                                                      NodeMap& node_map);
@@ -21,6 +21,7 @@
 
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/graph_arena.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/constant.hpp"
@@ -28,6 +29,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -192,7 +194,8 @@ descriptor::Output& Node::get_output_descriptor(size_t position)
     {
         size_t i = m_outputs.size();
         auto tensor_descriptor =
-            make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
+            make_shared_in_arena<descriptor::Tensor>(
+                element::dynamic, PartialShape::dynamic(), this, i);
         m_outputs.emplace_back(this, i, tensor_descriptor);
     }
     return m_outputs.at(position);
@@ -975,7 +978,11 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         if (auto constant = as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr()))
         {
-            auto host_tensor = make_shared<runtime::HostTensor>(constant);
+            // evaluators only read the inputs, so the tensors use the memory of the constants
+            auto host_tensor = make_shared<runtime::HostTensor>(
+                constant->get_output_element_type(0),
+                constant->get_output_shape(0),
+                const_cast<void*>(constant->get_data_ptr()));
             input_tensors.push_back(host_tensor);
         }
         else
@@ -995,7 +1002,12 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         for (size_t i = 0; i < output_tensors.size(); ++i)
         {
-            output_values[i] = make_shared<op::Constant>(output_tensors[i]);
+            // the constants keep the results instead of copying them
+            const auto& tensor = output_tensors[i];
+            auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<HostTensor>>>(
+                static_cast<char*>(tensor->get_data_ptr()), tensor->get_size_in_bytes(), tensor);
+            output_values[i] = make_shared<op::Constant>(
+                tensor->get_element_type(), tensor->get_shape(), buffer);
         }
         return true;
     }
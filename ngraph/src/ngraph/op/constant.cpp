@@ -316,14 +316,42 @@ op::Constant::Constant(const element::Type& type, const Shape& shape, const void
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
-op::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const std::shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NODE_VALIDATION_CHECK(this,
+                          data != nullptr && data->size() >= size,
+                          "Constant buffer is smaller than required for shape ",
+                          m_shape);
+    m_data = data;
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
+op::Constant::Constant(const Constant& other, const Shape& new_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(new_shape)
+    , m_data(other.m_data)
+    , m_all_elements_bitwise_identical(other.m_all_elements_bitwise_identical)
 {
-    m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
+    NODE_VALIDATION_CHECK(this,
+                          shape_size(m_shape) == shape_size(other.m_shape),
+                          "Cannot share data of constant with shape ",
+                          other.m_shape,
+                          " with shape ",
+                          m_shape);
     constructor_validate_and_infer_types();
 }
 
+op::Constant::Constant(const Constant& other)
+    : Constant(other, other.m_shape)
+{
+}
+
 op::Constant::~Constant()
 {
 }
@@ -233,6 +233,27 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant which shares the supplied buffer
+                ///
+                /// The data is not copied, so the buffer must hold (or keep alive) at least
+                /// shape_size(shape) elements of the type.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer with constant data.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
+                /// \brief Constructs a tensor constant which shares the data of other constant
+                ///
+                /// The data is not copied, so reshaping a constant costs no memory.
+                ///
+                /// \param other The constant with the data.
+                /// \param new_shape The shape of the tensor constant, must have the same number of
+                ///                  elements as the shape of other constant.
+                Constant(const Constant& other, const Shape& new_shape);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -18,80 +18,21 @@
 
 #include "constant_folding.hpp"
 #include "ngraph/op/reshape.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace std;
 using namespace ngraph;
 
-template <typename T, typename R>
-shared_ptr<op::Constant> fold_constant_dyn_reshape(shared_ptr<op::Constant> constant_data,
-                                                   R dyn_reshape)
-{
-    // v1::Reshape and v0::DynReshape do not allow data transposes.
-    return make_shared<op::Constant>(dyn_reshape->get_element_type(),
-                                     dyn_reshape->get_shape(),
-                                     constant_data->get_data_ptr<T>());
-}
-
 template <typename R>
 std::shared_ptr<Node> do_fold(R dyn_reshape_match, shared_ptr<op::Constant> constant_data_match)
 {
-    std::shared_ptr<Node> replacement;
     auto type = dyn_reshape_match->get_element_type();
-    switch (type)
-    {
-    case element::Type_t::undefined:
-        NGRAPH_CHECK(false,
-                     "Encountered 'undefined' element type in constant_dyn_reshape_callback");
-        break;
-    case element::Type_t::dynamic:
-        NGRAPH_CHECK(false, "Encountered 'dynamic' element type in constant_dyn_reshape_callback");
-        break;
-    case element::Type_t::u1:
-        NGRAPH_CHECK(false, "Encountered 'u1' element type in constant_dyn_reshape_callback");
-        break;
-    case element::Type_t::boolean:
-        replacement = fold_constant_dyn_reshape<char>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::bf16:
-        replacement = fold_constant_dyn_reshape<bfloat16>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::f16:
-        replacement = fold_constant_dyn_reshape<float16>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::f32:
-        replacement = fold_constant_dyn_reshape<float>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::f64:
-        replacement = fold_constant_dyn_reshape<double>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::i8:
-        replacement = fold_constant_dyn_reshape<int8_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::i16:
-        replacement = fold_constant_dyn_reshape<int16_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::i32:
-        replacement = fold_constant_dyn_reshape<int32_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::i64:
-        replacement = fold_constant_dyn_reshape<int64_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::u8:
-        replacement = fold_constant_dyn_reshape<uint8_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::u16:
-        replacement = fold_constant_dyn_reshape<uint16_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::u32:
-        replacement = fold_constant_dyn_reshape<uint32_t>(constant_data_match, dyn_reshape_match);
-        break;
-    case element::Type_t::u64:
-        replacement = fold_constant_dyn_reshape<uint64_t>(constant_data_match, dyn_reshape_match);
-        break;
-    }
-    return replacement;
+    NGRAPH_CHECK(type.is_static(),
+                 "Encountered '",
+                 type,
+                 "' element type in constant_dyn_reshape_callback");
+    // v1::Reshape and v0::DynReshape do not allow data transposes, so the data is shared
+    return make_shared<op::Constant>(*constant_data_match, dyn_reshape_match->get_shape());
 }
 
 void pass::ConstantFolding::construct_constant_dyn_reshape()
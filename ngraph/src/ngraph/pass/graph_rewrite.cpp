@@ -16,13 +16,16 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <regex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -60,10 +63,66 @@ using namespace ngraph;
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other
 //    fusion
+// To avoid trying every matcher on every node, the matchers are indexed by the type of their
+// pattern root: a node is tested only against the matchers of its type and the matchers which
+// can start at any node (e.g. the ones rooted at a Label), still in the registration order.
+
+namespace
+{
+    class MatcherIndex
+    {
+    public:
+        // root_types[i] is the root type of the i-th matcher or nullptr if it has no fixed one
+        MatcherIndex(const vector<const Node::type_info_t*>& root_types)
+        {
+            for (size_t i = 0; i < root_types.size(); i++)
+            {
+                if (root_types[i])
+                {
+                    m_typed[*root_types[i]].push_back(i);
+                }
+                else
+                {
+                    m_generic.push_back(i);
+                }
+            }
+        }
+
+        const vector<size_t>& get(const Node::type_info_t& type)
+        {
+            auto it = m_merged.find(type);
+            if (it == m_merged.end())
+            {
+                vector<size_t> merged;
+                auto typed = m_typed.find(type);
+                if (typed != m_typed.end())
+                {
+                    std::merge(typed->second.begin(),
+                               typed->second.end(),
+                               m_generic.begin(),
+                               m_generic.end(),
+                               back_inserter(merged));
+                }
+                else
+                {
+                    merged = m_generic;
+                }
+                it = m_merged.emplace(type, move(merged)).first;
+            }
+            return it->second;
+        }
+
+    private:
+        unordered_map<Node::type_info_t, vector<size_t>> m_typed;
+        vector<size_t> m_generic;
+        unordered_map<Node::type_info_t, vector<size_t>> m_merged;
+    };
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     bool rewritten = false;
+    bool transformed = false;
     const size_t NUM_TRIES = 10;
     size_t tries = NUM_TRIES;
     vector<MatchClosure> original_matchers{m_matchers};
@@ -77,6 +136,12 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // m_matchers may contain newly constructed matchers for matchers
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
+        vector<const Node::type_info_t*> root_types;
+        for (const auto& closure : matchers_to_run)
+        {
+            root_types.push_back(closure.root_type);
+        }
+        MatcherIndex index(root_types);
         m_matchers.clear();
         for (auto node : f->get_ordered_ops())
         {
@@ -84,8 +149,9 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            for (auto i : index.get(node->get_type_info()))
             {
+                auto& closure = matchers_to_run[i];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -97,6 +163,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 if (closure.handler(node))
                 {
                     rewritten = true;
+                    transformed = true;
                     // If call back may change function's is_dynamic state, we need to
                     // update the cached value.
                     if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -111,7 +178,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
-    return (NUM_TRIES - tries) > 1; // this means a graph was transformed
+    return transformed;
 }
 
 static vector<regex> initialize_fusion_regexes()
@@ -153,7 +220,24 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, nullptr});
+        // If any matcher call back may change dynamic state, we need to
+        // update the pass property.
+        if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+        {
+            set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+        }
+    }
+}
+
+void pass::GraphRewriteBase::add_handler(const std::string& name,
+                                         const Node::type_info_t& root_type,
+                                         function<bool(const std::shared_ptr<Node>&)> handler,
+                                         const PassPropertyMask& property)
+{
+    if (is_enabled(name))
+    {
+        m_matchers.push_back({name, handler, property, &root_type});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -167,17 +251,38 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
 {
-    add_handler(m->get_name(),
-                [m, callback](const std::shared_ptr<Node>& node) -> bool {
-                    NGRAPH_DEBUG << "Running matcher " << m->get_name() << " on " << node;
-                    if (m->match(node->output(0)))
-                    {
-                        NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
-                        return callback(*m.get());
-                    }
-                    return false;
-                },
-                property);
+    auto handler = [m, callback](const std::shared_ptr<Node>& node) -> bool {
+        NGRAPH_DEBUG << "Running matcher " << m->get_name() << " on " << node;
+        if (m->match(node->output(0)))
+        {
+            NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
+            return callback(*m.get());
+        }
+        return false;
+    };
+
+    // regular operations match only nodes of exactly the same type (see Node::match_node),
+    // while pattern operations may match anything
+    auto root = m->get_pattern_value().get_node();
+    if (dynamic_cast<pattern::op::Pattern*>(root) == nullptr)
+    {
+        add_handler(m->get_name(), root->get_type_info(), handler, property);
+    }
+    else
+    {
+        add_handler(m->get_name(), handler, property);
+    }
+}
+
+void pass::GraphRewrite::add_matchers(const shared_ptr<GraphRewrite>& rewrite)
+{
+    NGRAPH_CHECK(rewrite.get() != this, "GraphRewrite can not merge its own matchers");
+    m_matchers.insert(m_matchers.end(), rewrite->m_matchers.begin(), rewrite->m_matchers.end());
+    if (rewrite->get_property(PassProperty::CHANGE_DYNAMIC_STATE))
+    {
+        set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+    }
+    m_merged_rewrites.push_back(rewrite);
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
@@ -60,11 +60,19 @@ protected:
 
     bool is_enabled(const std::string& name) const;
 
+    /// \brief Add a handler which can change only nodes of the given type
+    void add_handler(const std::string& name,
+                     const Node::type_info_t& root_type,
+                     std::function<bool(const std::shared_ptr<Node>& node)> handler,
+                     const PassPropertyMask& property);
+
     struct MatchClosure
     {
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        // type of the nodes the handler is applicable to, nullptr means any node
+        const Node::type_info_t* root_type;
     };
     std::vector<MatchClosure> m_matchers;
 };
@@ -90,10 +98,22 @@ public:
     void add_matcher(const std::shared_ptr<pattern::Matcher>& m,
                      const ngraph::graph_rewrite_callback& callback);
 
+    /// \brief Append matchers of another GraphRewrite, so both of them are applied
+    /// during a single traversal of the graph
+    /// \param rewrite The pass to take the matchers from, it is kept alive by this pass
+    /// since the matcher callbacks may refer to it
+    ///
+    /// \note Matchers registered by the callbacks of the merged pass for another run
+    /// (see the comments in graph_rewrite.cpp) are not picked up.
+    void add_matchers(const std::shared_ptr<GraphRewrite>& rewrite);
+
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
 protected:
     bool m_enable_shape_inference = false;
+
+private:
+    std::vector<std::shared_ptr<GraphRewrite>> m_merged_rewrites;
 };
 
 class NGRAPH_API ngraph::pass::RecurrentGraphRewrite : public ngraph::pass::GraphRewriteBase
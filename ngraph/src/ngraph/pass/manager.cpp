@@ -19,14 +19,17 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -36,10 +39,94 @@
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Source and type of a node input as they were at the last validation of the node
+    struct InputState
+    {
+        Node* source;
+        size_t index;
+        element::Type element_type;
+        PartialShape shape;
+    };
+
+    struct ValidatedNode
+    {
+        weak_ptr<Node> node;
+        vector<InputState> inputs;
+    };
+
+    using validation_cache_t = unordered_map<Node*, ValidatedNode>;
+
+    vector<InputState> get_input_states(const Node& node)
+    {
+        vector<InputState> states;
+        states.reserve(node.get_input_size());
+        for (const auto& input : node.inputs())
+        {
+            auto source = input.get_source_output();
+            states.push_back({source.get_node(),
+                              source.get_index(),
+                              source.get_element_type(),
+                              source.get_partial_shape()});
+        }
+        return states;
+    }
+
+    bool same_inputs(const vector<InputState>& lhs, const vector<InputState>& rhs)
+    {
+        return lhs.size() == rhs.size() &&
+               equal(lhs.begin(), lhs.end(), rhs.begin(), [](const InputState& l, const InputState& r) {
+                   return l.source == r.source && l.index == r.index &&
+                          l.element_type == r.element_type && l.shape.same_scheme(r.shape);
+               });
+    }
+
+    // Nodes are visited in topological order, so a node re-inferring its outputs changes
+    // the input states of its consumers and the revalidation goes downstream of it
+    void validate_changed_nodes(const shared_ptr<Function>& f, validation_cache_t& cache)
+    {
+        const auto& parameters = f->get_parameters();
+        for (auto& node : f->get_ordered_ops())
+        {
+            auto inputs = get_input_states(*node);
+            auto it = cache.find(node.get());
+            if (it != cache.end() && it->second.node.lock() == node &&
+                same_inputs(it->second.inputs, inputs))
+            {
+                continue;
+            }
+
+            node->revalidate_and_infer_types();
+            if (op::is_parameter(node) &&
+                find(parameters.begin(), parameters.end(), node) == parameters.end())
+            {
+                throw ngraph_error("Function references undeclared parameter");
+            }
+            cache[node.get()] = {node, move(inputs)};
+        }
+    }
+
+    string get_pass_name(const pass::PassBase& pass)
+    {
+        string name = typeid(pass).name();
+#ifndef _WIN32
+        int status;
+        char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+        if (demangled != nullptr)
+        {
+            name = demangled;
+            free(demangled);
+        }
+#endif
+        return name;
+    }
+}
+
 pass::Manager::Manager()
     : m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING"))
     , m_serialize(getenv_bool("NGRAPH_ENABLE_SERIALIZE_TRACING"))
-
+    , m_incremental_validation(getenv_bool("NGRAPH_INCREMENTAL_VALIDATION"))
 {
 }
 
@@ -55,6 +142,11 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
     vector<shared_ptr<Function>> f_array{func};
 
+    // the function is validated on construction, so the first Validate pass
+    // has to do something only if the preceding passes modified it
+    bool function_changed = false;
+    validation_cache_t validation_cache;
+
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
@@ -67,13 +159,25 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
         auto node_pass = dynamic_pointer_cast<NodePass>(pass);
         auto call_graph_pass = dynamic_pointer_cast<CallGraphPass>(pass);
-        if (module_pass)
+        auto validate_pass = dynamic_pointer_cast<Validate>(pass);
+        if (validate_pass && m_incremental_validation)
+        {
+            if (function_changed)
+            {
+                for (auto f_pair : fs)
+                {
+                    validate_changed_nodes(f_pair.first, validation_cache);
+                }
+                function_changed = false;
+            }
+        }
+        else if (module_pass)
         {
             if (auto vt_pass = dynamic_pointer_cast<pass::VisualizeTree>(module_pass))
             {
                 vt_pass->set_ops_to_details(get_state().get_visualize_tree_ops_map());
             }
-            module_pass->run_on_module(f_array);
+            function_changed |= module_pass->run_on_module(f_array);
         }
         else if (function_pass)
         {
@@ -89,6 +193,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                     continue;
                 }
                 bool function_modified = function_pass->run_on_function(f);
+                function_changed |= function_modified;
                 // If the pass may change the function's is_dynamic property, we need to
                 // update the cached value.
                 if (function_modified &&
@@ -109,7 +214,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 }
                 for (shared_ptr<Node> n : f->get_ops())
                 {
-                    node_pass->run_on_node(n);
+                    function_changed |= node_pass->run_on_node(n);
                 }
             }
         }
@@ -124,6 +229,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                     continue;
                 }
                 bool function_modified = call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                function_changed |= function_modified;
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
             }
         }
@@ -154,15 +260,17 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        if (profile_enabled || m_profiling_callback)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            string name = get_pass_name(*pass);
+            if (profile_enabled)
+            {
+                cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            }
+            if (m_profiling_callback)
+            {
+                m_profiling_callback(name, pass_timer.get_microseconds());
+            }
         }
     }
     if (profile_enabled)
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -63,6 +65,23 @@ public:
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Set flag to enable/disable incremental validation. When enabled, the Validate
+    /// pass is skipped after passes which report that the function is not modified, and
+    /// otherwise re-infers types only for nodes whose inputs changed since the previous
+    /// validation and for the nodes downstream of them.
+    /// \param new_state Value "true" enables incremental validation; "false", otherwise
+    ///
+    /// \note Passes changing attributes of existing nodes in place must validate these
+    /// nodes themselves, since the inputs of such nodes stay the same.
+    void set_incremental_validation(bool new_state) { m_incremental_validation = new_state; }
+    /// \brief Callback called after every executed pass with the pass name and its wall
+    /// time in microseconds, the time of the Validate passes is reported as well
+    using profiling_callback_t = std::function<void(const std::string&, size_t)>;
+    void set_profiling_callback(const profiling_callback_t& callback)
+    {
+        m_profiling_callback = callback;
+    }
+
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -94,4 +113,6 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_incremental_validation = false;
+    profiling_callback_t m_profiling_callback;
 };
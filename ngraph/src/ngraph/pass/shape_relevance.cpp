@@ -14,13 +14,107 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <list>
+#include <set>
+
 #include "ngraph/pass/shape_relevance.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/fused/squeeze.hpp"
+#include "ngraph/op/fused/unsqueeze.hpp"
+#include "ngraph/op/gather.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/reduce_prod.hpp"
+#include "ngraph/op/reduce_sum.hpp"
+#include "ngraph/op/shape_of.hpp"
+#include "ngraph/op/subtract.hpp"
 #include "ngraph/op/util/op_types.hpp"
 
 using namespace ngraph;
 
+namespace
+{
+    // Finds the set of nodes that must be evaluated to determine the value of shape-relevant
+    // inputs.
+    std::set<Node*> find_shape_determinants(const Function& f)
+    {
+        // TODO(amprocte): We are probably reinventing the wheel with the graph traversal here; the
+        // reason is that we need to cut the traversal short in cases where input values are
+        // irrelevant. See if there is a way to reduce this duplication.
+
+        std::set<Node*> shape_determinants;
+
+        // Step 1: Find root nodes (these are nodes with an output connected to a shape-relevant
+        // input).
+        for (auto& n : f.get_ops())
+        {
+            for (auto& output : n->outputs())
+            {
+                for (auto& input : output.get_target_inputs())
+                {
+                    if (input.get_is_relevant_to_shapes())
+                    {
+                        shape_determinants.insert(n.get());
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Step 2: Find all shape determinants. This is the transitive closure of R, where n1 R n2
+        // iff there is a data flow edge from n2 to n1 and that data flow edge is not
+        // value-irrelevant.
+        std::list<Node*> to_visit{shape_determinants.begin(), shape_determinants.end()};
+        std::set<Node*> already_visited;
+
+        while (!to_visit.empty())
+        {
+            auto node = to_visit.front();
+            to_visit.pop_front();
+
+            if (already_visited.count(node) > 0)
+            {
+                continue;
+            }
+
+            shape_determinants.insert(node);
+            already_visited.insert(node);
+
+            for (size_t i = 0; i < node->get_input_size(); i++)
+            {
+                if (!node->input(i).get_is_relevant_to_values())
+                {
+                    continue;
+                }
+                auto source_node = node->get_input_node_ptr(i);
+                if (already_visited.count(source_node) == 0)
+                {
+                    to_visit.push_front(source_node);
+                }
+            }
+        }
+
+        return shape_determinants;
+    }
+
+    int64_t python_divide(int64_t x, int64_t y)
+    {
+        auto quotient = x / y;
+        if (x % y != 0 && (x < 0) != (y < 0))
+        {
+            quotient--;
+        }
+        return quotient;
+    }
+}
+
 //
 // This pass refreshes the "is_relevant_to_shape" flag on each parameter. A parameter will be
 // flagged as relevant to shapes if there is any path from that parameter to a shape-relevant
@@ -46,76 +140,356 @@ using namespace ngraph;
 //
 bool pass::ShapeRelevance::run_on_function(std::shared_ptr<Function> f)
 {
-    // TODO(amprocte): We are probably reinventing the wheel with the graph traversal here; the
-    // reason is that we need to cut the traversal short in cases where input values are
-    // irrelevant. See if there is a way to reduce this duplication.
-
-    // Set of nodes that must be evaluated to determine the value of shape-relevant inputs.
-    std::set<Node*> shape_determinants;
+    bool changes_made = false;
 
-    // Step 1: Find root nodes (these are nodes with an output connected to a shape-relevant
-    // input).
-    for (auto& n : f->get_ops())
+    for (auto node : find_shape_determinants(*f))
     {
-        for (auto& output : n->outputs())
+        if (op::is_parameter(node))
         {
-            for (auto& input : output.get_target_inputs())
+            auto node_as_param = static_cast<op::Parameter*>(node);
+            if (!node_as_param->is_relevant_to_shapes())
             {
-                if (input.get_is_relevant_to_shapes())
-                {
-                    shape_determinants.insert(n.get());
-                    break;
-                }
+                node_as_param->set_is_relevant_to_shapes(true);
+                changes_made = true;
             }
         }
     }
 
-    // Step 2: Find all shape determinants. This is the transitive closure of R, where n1 R n2
-    // iff there is a data flow edge from n2 to n1 and that data flow edge is not
-    // value-irrelevant.
-    bool changes_made = false;
+    return changes_made;
+}
 
+pass::ShapeProgram::ShapeProgram(const Function& f)
+{
+    auto shape_determinants = find_shape_determinants(f);
+    for (const auto& node : f.get_ordered_ops())
     {
-        std::list<Node*> to_visit{shape_determinants.begin(), shape_determinants.end()};
-        std::set<Node*> already_visited;
+        if (shape_determinants.count(node.get()) == 0 || node->get_output_size() != 1 ||
+            !node->get_output_element_type(0).is_integral_number())
+        {
+            continue;
+        }
 
-        while (!to_visit.empty())
+        Step step{};
+        if (is_type<op::v0::ShapeOf>(node) || is_type<op::v3::ShapeOf>(node))
         {
-            auto node = to_visit.front();
-            to_visit.pop_front();
+            step.kind = Kind::ShapeOf;
+        }
+        else if (is_type<op::v0::Convert>(node))
+        {
+            step.kind = Kind::Convert;
+        }
+        else if (is_type<op::v0::Concat>(node))
+        {
+            step.kind = Kind::Concat;
+        }
+        else if (is_type<op::v1::Gather>(node))
+        {
+            step.kind = Kind::Gather;
+        }
+        else if (is_type<op::v0::Squeeze>(node))
+        {
+            step.kind = Kind::Squeeze;
+        }
+        else if (is_type<op::v0::Unsqueeze>(node))
+        {
+            step.kind = Kind::Unsqueeze;
+        }
+        else if (is_type<op::v1::Add>(node))
+        {
+            step.kind = Kind::Add;
+        }
+        else if (is_type<op::v1::Subtract>(node))
+        {
+            step.kind = Kind::Subtract;
+        }
+        else if (is_type<op::v1::Multiply>(node))
+        {
+            step.kind = Kind::Multiply;
+        }
+        else if (auto divide = as_type_ptr<op::v1::Divide>(node))
+        {
+            step.kind = divide->is_pythondiv() ? Kind::PythonDivide : Kind::Divide;
+        }
+        else if (is_type<op::v1::Maximum>(node))
+        {
+            step.kind = Kind::Maximum;
+        }
+        else if (is_type<op::v1::Minimum>(node))
+        {
+            step.kind = Kind::Minimum;
+        }
+        else if (auto reduce = as_type_ptr<op::v1::ReduceProd>(node))
+        {
+            step.kind = Kind::ReduceProd;
+            step.keep_dims = reduce->get_keep_dims();
+        }
+        else if (auto reduce = as_type_ptr<op::v1::ReduceSum>(node))
+        {
+            step.kind = Kind::ReduceSum;
+            step.keep_dims = reduce->get_keep_dims();
+        }
+        else
+        {
+            continue;
+        }
+        step.node = node;
+        step.type = node->get_output_element_type(0);
 
-            if (already_visited.count(node) > 0)
+        // only the shape of the input of ShapeOf is used, the other nodes need the values of
+        // their inputs from the program or from integer Constants
+        bool computable = true;
+        for (size_t i = 0; step.kind != Kind::ShapeOf && i < node->get_input_size(); i++)
+        {
+            auto source = node->get_input_node_shared_ptr(i);
+            auto constant = as_type_ptr<op::v0::Constant>(source);
+            if (m_steps.count(source.get()) > 0)
             {
-                continue;
+                step.inputs.emplace_back(source.get(), Value{});
+            }
+            else if (constant && constant->get_element_type().is_integral_number())
+            {
+                step.inputs.emplace_back(
+                    nullptr, Value{constant->cast_vector<int64_t>(), constant->get_shape()});
             }
+            else
+            {
+                computable = false;
+                break;
+            }
+        }
+        if (computable)
+        {
+            m_steps.emplace(node.get(), std::move(step));
+        }
+    }
+}
 
-            shape_determinants.insert(node);
-            already_visited.insert(node);
+bool pass::ShapeProgram::contains(const Node* node) const
+{
+    return m_steps.count(node) > 0;
+}
 
-            if (op::is_parameter(node))
+std::shared_ptr<op::v0::Constant> pass::ShapeProgram::evaluate(const Node* node,
+                                                              Values& values,
+                                                              const InputShape& input_shape) const
+{
+    auto it = m_steps.find(node);
+    if (it == m_steps.end() || it->second.node.lock().get() != node)
+    {
+        return nullptr;
+    }
+    const auto& step = it->second;
+
+    Value output;
+    if (step.kind == Kind::ShapeOf)
+    {
+        auto shape = input_shape(node->input_value(0));
+        if (shape.is_dynamic())
+        {
+            return nullptr;
+        }
+        auto dims = shape.to_shape();
+        output.data.assign(dims.begin(), dims.end());
+        output.shape = Shape{dims.size()};
+    }
+    else
+    {
+        std::vector<const Value*> inputs;
+        for (const auto& input : step.inputs)
+        {
+            if (input.first == nullptr)
             {
-                auto node_as_param = static_cast<op::Parameter*>(node);
-                if (!node_as_param->is_relevant_to_shapes())
-                {
-                    node_as_param->set_is_relevant_to_shapes(true);
-                    changes_made = true;
-                }
+                inputs.push_back(&input.second);
+                continue;
             }
+            auto value = values.find(input.first);
+            if (value == values.end())
+            {
+                return nullptr;
+            }
+            inputs.push_back(&value->second);
+        }
+        if (!compute(step, inputs, output))
+        {
+            return nullptr;
+        }
+    }
 
-            for (size_t i = 0; i < node->get_input_size(); i++)
+    auto constant = std::make_shared<op::v0::Constant>(step.type, output.shape, output.data);
+    values[node] = std::move(output);
+    return constant;
+}
+
+bool pass::ShapeProgram::compute(const Step& step,
+                                 const std::vector<const Value*>& inputs,
+                                 Value& output) const
+{
+    // normalizes a negative axis of a tensor of the given rank
+    auto get_axis = [](int64_t axis, size_t rank, size_t& result) {
+        if (axis < 0)
+        {
+            axis += static_cast<int64_t>(rank);
+        }
+        result = static_cast<size_t>(axis);
+        return axis >= 0 && result < rank;
+    };
+
+    switch (step.kind)
+    {
+    case Kind::Convert:
+    {
+        output = *inputs[0];
+        return true;
+    }
+    case Kind::Concat:
+    {
+        for (auto input : inputs)
+        {
+            if (input->shape.size() != 1)
             {
-                if (!node->input(i).get_is_relevant_to_values())
+                return false;
+            }
+            output.data.insert(output.data.end(), input->data.begin(), input->data.end());
+        }
+        output.shape = Shape{output.data.size()};
+        return true;
+    }
+    case Kind::Gather:
+    {
+        const auto& data = *inputs[0];
+        const auto& indices = *inputs[1];
+        size_t axis = 0;
+        if (data.shape.size() != 1 || inputs[2]->data.size() != 1 ||
+            !get_axis(inputs[2]->data[0], 1, axis))
+        {
+            return false;
+        }
+        auto size = static_cast<int64_t>(data.data.size());
+        for (auto index : indices.data)
+        {
+            if (index < 0)
+            {
+                index += size;
+            }
+            if (index < 0 || index >= size)
+            {
+                return false;
+            }
+            output.data.push_back(data.data[index]);
+        }
+        output.shape = indices.shape;
+        return true;
+    }
+    case Kind::Squeeze:
+    case Kind::Unsqueeze:
+    {
+        const auto& data = *inputs[0];
+        std::vector<int64_t> axes;
+        if (inputs.size() > 1)
+        {
+            axes = inputs[1]->data;
+        }
+        auto rank = step.kind == Kind::Squeeze ? data.shape.size() : data.shape.size() + axes.size();
+        std::vector<bool> marked(rank, false);
+        for (auto axis : axes)
+        {
+            size_t index = 0;
+            if (!get_axis(axis, rank, index))
+            {
+                return false;
+            }
+            marked[index] = true;
+        }
+        if (step.kind == Kind::Squeeze)
+        {
+            for (size_t i = 0; i < rank; i++)
+            {
+                bool squeeze = axes.empty() ? data.shape[i] == 1 : marked[i];
+                if (squeeze && data.shape[i] != 1)
                 {
-                    continue;
+                    return false;
                 }
-                auto source_node = node->get_input_node_ptr(i);
-                if (already_visited.count(source_node) == 0)
+                if (!squeeze)
                 {
-                    to_visit.push_front(source_node);
+                    output.shape.push_back(data.shape[i]);
                 }
             }
         }
+        else
+        {
+            for (size_t i = 0, j = 0; i < rank; i++)
+            {
+                output.shape.push_back(marked[i] ? 1 : data.shape[j++]);
+            }
+        }
+        output.data = data.data;
+        return true;
+    }
+    case Kind::ReduceProd:
+    case Kind::ReduceSum:
+    {
+        const auto& data = *inputs[0];
+        const auto& axes = *inputs[1];
+        size_t axis = 0;
+        if (data.shape.size() != 1 || axes.data.size() != 1 || !get_axis(axes.data[0], 1, axis))
+        {
+            return false;
+        }
+        int64_t result = step.kind == Kind::ReduceProd ? 1 : 0;
+        for (auto value : data.data)
+        {
+            result = step.kind == Kind::ReduceProd ? result * value : result + value;
+        }
+        output.data = {result};
+        output.shape = step.keep_dims ? Shape{1} : Shape{};
+        return true;
+    }
+    default:
+    {
+        // binary elementwise operations, one of the inputs may be broadcasted from one element
+        const auto& a = *inputs[0];
+        const auto& b = *inputs[1];
+        if (a.shape == b.shape)
+        {
+            output.shape = a.shape;
+        }
+        else if (a.data.size() == 1 && a.shape.size() <= b.shape.size())
+        {
+            output.shape = b.shape;
+        }
+        else if (b.data.size() == 1 && b.shape.size() <= a.shape.size())
+        {
+            output.shape = a.shape;
+        }
+        else
+        {
+            return false;
+        }
+        auto size = std::max(a.data.size(), b.data.size());
+        output.data.resize(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            auto x = a.data[a.data.size() == 1 ? 0 : i];
+            auto y = b.data[b.data.size() == 1 ? 0 : i];
+            switch (step.kind)
+            {
+            case Kind::Add: output.data[i] = x + y; break;
+            case Kind::Subtract: output.data[i] = x - y; break;
+            case Kind::Multiply: output.data[i] = x * y; break;
+            case Kind::Maximum: output.data[i] = std::max(x, y); break;
+            case Kind::Minimum: output.data[i] = std::min(x, y); break;
+            case Kind::Divide:
+            case Kind::PythonDivide:
+                if (y == 0)
+                {
+                    return false;
+                }
+                output.data[i] = step.kind == Kind::Divide ? x / y : python_divide(x, y);
+                break;
+            default: return false;
+            }
+        }
+        return true;
+    }
     }
-
-    return changes_made;
 }
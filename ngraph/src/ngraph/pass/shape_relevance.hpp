@@ -16,10 +16,23 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
 {
+    namespace op
+    {
+        namespace v0
+        {
+            class Constant;
+        }
+    }
+
     namespace pass
     {
         class NGRAPH_API ShapeRelevance : public FunctionPass
@@ -31,5 +44,86 @@ namespace ngraph
             }
             virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
         };
+
+        /// \brief Integer program which computes the values of the shape subgraphs of a function
+        ///        (e.g. ShapeOf -> Gather -> Concat -> Reshape), built once per function.
+        ///
+        /// The program holds the nodes which determine shape-relevant inputs, as the
+        /// ShapeRelevance pass finds them, and whose values depend only on the shapes of tensors
+        /// and on integer Constants. Evaluating them is plain integer arithmetic over small
+        /// vectors, without the HostTensors of the node evaluators and without constant folding,
+        /// so a specialization of the function for new input shapes can replace the subgraphs
+        /// with Constants while it clones the nodes (see specialize_function).
+        ///
+        /// The program refers to the nodes of the function it was built for: a node which is
+        /// destroyed or replaced is not evaluated anymore.
+        class NGRAPH_API ShapeProgram
+        {
+        public:
+            /// \brief A value of a node: the elements and the shape of its output
+            struct Value
+            {
+                std::vector<int64_t> data;
+                Shape shape;
+            };
+            /// \brief The values of one evaluation of the program
+            using Values = std::unordered_map<const Node*, Value>;
+            /// \brief Returns the current shape of the output a ShapeOf gets
+            using InputShape = std::function<PartialShape(const Output<Node>&)>;
+
+            /// \brief Builds the program for the shape subgraphs of a function
+            explicit ShapeProgram(const Function& f);
+
+            /// \brief Number of the nodes of the program
+            size_t size() const { return m_steps.size(); }
+            /// \returns true if the node is in the program
+            bool contains(const Node* node) const;
+
+            /// \brief Computes the value of a node of the program. The nodes are evaluated in
+            ///        topological order.
+            /// \param node The node of the function the program was built for
+            /// \param values The values of the previously evaluated nodes of this evaluation, the
+            ///        value of the node is added to them
+            /// \param input_shape Returns the shapes of the inputs of ShapeOf
+            /// \returns A Constant with the value or nullptr if the node is not in the program or
+            ///          its value can not be computed (e.g. a shape is dynamic)
+            std::shared_ptr<op::v0::Constant>
+                evaluate(const Node* node, Values& values, const InputShape& input_shape) const;
+
+        private:
+            enum class Kind
+            {
+                ShapeOf,
+                Convert,
+                Concat,
+                Gather,
+                Squeeze,
+                Unsqueeze,
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                PythonDivide,
+                Maximum,
+                Minimum,
+                ReduceProd,
+                ReduceSum
+            };
+            struct Step
+            {
+                Kind kind;
+                std::weak_ptr<Node> node;
+                element::Type type;
+                bool keep_dims;
+                // the inputs refer to the nodes of the program or hold the values of Constant
+                std::vector<std::pair<const Node*, Value>> inputs;
+            };
+
+            bool compute(const Step& step,
+                         const std::vector<const Value*>& inputs,
+                         Value& output) const;
+
+            std::unordered_map<const Node*, Step> m_steps;
+        };
     }
 }
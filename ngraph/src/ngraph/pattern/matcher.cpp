@@ -45,6 +45,32 @@ namespace ngraph
                            ? node->output(0)
                            : std::make_shared<op::AnyOutput>(node)->output(0);
             }
+
+            // A necessary condition of a match checked before the recursion: an op of a pattern
+            // matches only a value of an op of its type with as many inputs, and in strict mode of
+            // a compatible element type and rank. Pattern ops check their own predicates.
+            bool may_match(const Output<Node>& pattern_value,
+                           const Output<Node>& graph_value,
+                           bool strict_mode)
+            {
+                auto pattern_node = pattern_value.get_node();
+                if (dynamic_cast<op::Pattern*>(pattern_node) != nullptr)
+                {
+                    return true;
+                }
+                auto graph_node = graph_value.get_node();
+                if (pattern_value.get_index() != graph_value.get_index() ||
+                    pattern_node->get_type_info() != graph_node->get_type_info() ||
+                    pattern_node->get_input_size() != graph_node->get_input_size())
+                {
+                    return false;
+                }
+                return !strict_mode ||
+                       (pattern_value.get_element_type().compatible(
+                            graph_value.get_element_type()) &&
+                        pattern_value.get_partial_shape().rank().compatible(
+                            graph_value.get_partial_shape().rank()));
+            }
         }
 
         Matcher::Matcher(std::shared_ptr<Node> pattern_node)
@@ -158,11 +184,41 @@ namespace ngraph
                     return false;
                 }
             }
-            return pattern_node->match_value(this, pattern_value, graph_value);
+            if (m_permutation_depth == 0 || pattern_node->get_input_size() == 0)
+            {
+                return pattern_node->match_value(this, pattern_value, graph_value);
+            }
+
+            auto key = std::make_pair(pattern_value, graph_value);
+            auto failed = m_failed_matches.find(key);
+            if (failed != m_failed_matches.end() &&
+                std::find(failed->second.begin(), failed->second.end(), m_pattern_map) !=
+                    failed->second.end())
+            {
+                return false;
+            }
+
+            bool is_match;
+            {
+                auto saved = start_match();
+                is_match = saved.finish(pattern_node->match_value(this, pattern_value, graph_value));
+            }
+            if (!is_match)
+            {
+                m_failed_matches[key].push_back(m_pattern_map);
+            }
+            return is_match;
         }
 
         bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVector& args)
         {
+            for (size_t i = 0; i < args.size(); i++)
+            {
+                if (!may_match(pattern_args.at(i), args.at(i), m_strict_mode))
+                {
+                    return false;
+                }
+            }
             for (size_t i = 0; i < args.size(); i++)
             {
                 if (!match_value(pattern_args.at(i), args.at(i)))
@@ -196,11 +252,13 @@ namespace ngraph
                           end(pattern_args),
                           [](const ngraph::Output<ngraph::Node>& n1,
                              const ngraph::Output<ngraph::Node>& n2) { return n1 < n2; });
+                m_permutation_depth++;
                 do
                 {
                     auto saved = start_match();
                     if (match_permutation(pattern_args, args))
                     {
+                        m_permutation_depth--;
                         return saved.finish(true);
                     }
                 } while (std::next_permutation(
@@ -208,6 +266,7 @@ namespace ngraph
                     end(pattern_args),
                     [](const ngraph::Output<ngraph::Node>& n1,
                        const ngraph::Output<ngraph::Node>& n2) { return n1 < n2; }));
+                m_permutation_depth--;
             }
             else
             {
@@ -234,11 +293,18 @@ namespace ngraph
             m_match_root.reset();
             m_pattern_map.clear();
             m_matched_list.clear();
+            m_failed_matches.clear();
+            m_permutation_depth = 0;
 
             // insert previous matches
             m_pattern_map.insert(previous_matches.cbegin(), previous_matches.cend());
-            auto saved = start_match();
-            bool is_match = saved.finish(match_value(m_pattern_node, graph_value));
+            bool is_match;
+            {
+                auto saved = start_match();
+                is_match = saved.finish(match_value(m_pattern_node, graph_value));
+            }
+            // the memo holds the values of the graph which may be replaced after the match
+            m_failed_matches.clear();
             if (is_match)
             {
                 m_match_root = graph_value;
@@ -193,6 +193,16 @@ namespace ngraph
 
             std::string m_name{"unnamed"};
             bool m_strict_mode{false};
+
+            /// \brief The bindings under which a pattern value failed to match a graph value.
+            ///
+            /// A match is a function of the pattern value, the graph value and the bindings, so
+            /// the permutations of commutative arguments do not explore a failed subgraph twice.
+            /// The memo lives for one match since the graph may change between matches.
+            std::map<std::pair<Output<Node>, Output<Node>>, PatternValueMaps> m_failed_matches;
+            /// \brief The number of enclosing permutation searches, the memo is kept only inside of
+            /// them because nothing is explored twice without backtracking
+            size_t m_permutation_depth{0};
         };
 
         class NGRAPH_API RecurrentMatcher
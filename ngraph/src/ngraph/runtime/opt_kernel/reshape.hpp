@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
 
 namespace ngraph
 {
@@ -233,6 +237,55 @@ namespace ngraph
                     }
                 }
             }
+            // Any rank transposition of a big tensor, the output is split into contiguous
+            // chunks and every thread walks the input coordinates of its own chunk
+            template <typename T>
+            void reshape_parallel(const T* in,
+                                  T* out,
+                                  const Shape& in_shape,
+                                  const AxisVector& in_axis_order)
+            {
+                const size_t rank = in_shape.size();
+                std::vector<size_t> size(rank);
+                std::vector<size_t> in_stride(rank);
+                auto strides = row_major_strides(in_shape);
+                for (size_t i = 0; i < rank; i++)
+                {
+                    size[i] = in_shape[in_axis_order[i]];
+                    in_stride[i] = strides[in_axis_order[i]];
+                }
+
+                reference::parallel_for(shape_size(in_shape), [&](size_t begin, size_t end) {
+                    std::vector<size_t> index(rank);
+                    size_t in_offset = 0;
+                    for (size_t i = rank, rest = begin; i-- > 0;)
+                    {
+                        index[i] = rest % size[i];
+                        rest /= size[i];
+                        in_offset += index[i] * in_stride[i];
+                    }
+
+                    const size_t inner = rank - 1;
+                    for (size_t pos = begin; pos < end;)
+                    {
+                        const size_t run = std::min(size[inner] - index[inner], end - pos);
+                        for (size_t k = 0; k < run; k++)
+                        {
+                            out[pos + k] = in[in_offset + k * in_stride[inner]];
+                        }
+                        pos += run;
+                        in_offset += run * in_stride[inner];
+                        index[inner] += run;
+                        for (size_t i = inner; i > 0 && index[i] == size[i]; i--)
+                        {
+                            in_offset += in_stride[i - 1] - size[i] * in_stride[i];
+                            index[i] = 0;
+                            index[i - 1]++;
+                        }
+                    }
+                });
+            }
+
             template <typename T>
             void reshape(const T* in,
                          T* out,
@@ -240,6 +293,12 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
+                if (in_shape.size() >= 2 && reference::get_parallel_threads() > 1 &&
+                    shape_size(in_shape) >= 2 * (1 << 16))
+                {
+                    reshape_parallel<T>(in, out, in_shape, in_axis_order);
+                    return;
+                }
                 switch (in_shape.size())
                 {
                 case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
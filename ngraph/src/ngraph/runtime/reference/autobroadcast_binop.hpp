@@ -21,6 +21,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -95,6 +96,122 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                // Serial NUMPY broadcasting of the whole output
+                template <typename T, typename U, typename Functor>
+                void numpy_autobroadcast(const T* arg0,
+                                         const T* arg1,
+                                         U* out,
+                                         const Shape& arg0_shape,
+                                         const Shape& arg1_shape,
+                                         Functor elementwise_functor)
+                {
+                    size_t const shape_rank =
+                        std::max(arg0_shape.size(), arg1_shape.size()) + 1;
+
+                    // TODO: Use compiler-specific alloca() or variable-length array
+                    std::vector<size_t> tmp(shape_rank * 2);
+
+                    size_t* strides0 = tmp.data();
+                    size_t* strides1 = tmp.data() + shape_rank;
+
+                    row_major_strides(arg0_shape, strides0, shape_rank);
+                    row_major_strides(arg1_shape, strides1, shape_rank);
+
+                    size_t const padding0 = shape_rank - arg0_shape.size();
+                    size_t const padding1 = shape_rank - arg1_shape.size();
+
+                    Shape output_shape(shape_rank, 0);
+
+                    size_t axis = 0;
+
+                    for (size_t i = 0; i < shape_rank; i++)
+                    {
+                        auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+                        auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+
+                        output_shape[i] = std::max(dim0, dim1);
+
+                        if (dim0 != dim1)
+                            axis = std::max(axis, i);
+                    }
+#if 0
+                    // Universal function without optimisations
+                    CoordinateTransformBasic arg0_transform(arg0_shape);
+                    CoordinateTransformBasic arg1_transform(arg1_shape);
+                    U *dst = out;
+
+                    for(CoordinateIterator it(output_shape),
+                        ite = CoordinateIterator::end();
+                        it != ite;
+                        ++it)
+                    {
+                        const Coordinate& output_coord = *it;
+                        size_t const idx0 = arg0_transform.index(output_coord);
+                        size_t const idx1 = arg1_transform.index(output_coord);
+                        *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
+                    }
+#else
+
+                    if (axis == 0)
+                    {
+                        for (size_t i = 0, end = strides0[0]; i < end; ++i)
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                    }
+                    else if (strides0[axis] == 1 &&
+                             value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
+                    {
+                        axis = calculate_fixed_axis(axis, strides0);
+
+                        numpy_autobroadcast_binop<0, 1>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides1[axis],
+                                                        elementwise_functor);
+                    }
+                    else if (strides1[axis] == 1 &&
+                             value_with_padding_or(arg1_shape, padding1, axis, 1) == 1)
+                    {
+                        axis = calculate_fixed_axis(axis, strides1);
+
+                        numpy_autobroadcast_binop<1, 0>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides0[axis],
+                                                        elementwise_functor);
+                    }
+                    else
+                        numpy_autobroadcast_binop<1, 1>(arg0,
+                                                        arg1,
+                                                        out,
+                                                        arg0_shape,
+                                                        arg1_shape,
+                                                        strides0,
+                                                        strides1,
+                                                        padding0,
+                                                        padding1,
+                                                        output_shape,
+                                                        axis,
+                                                        strides0[axis],
+                                                        elementwise_functor);
+#endif
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -126,10 +243,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape), [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -156,111 +275,61 @@ namespace ngraph
                     {
                         using namespace internal;
 
-                        size_t const shape_rank =
-                            std::max(arg0_shape.size(), arg1_shape.size()) + 1;
-
-                        // TODO: Use compiler-specific alloca() or variable-length array
-                        std::vector<size_t> tmp(shape_rank * 2);
-
-                        size_t* strides0 = tmp.data();
-                        size_t* strides1 = tmp.data() + shape_rank;
-
-                        row_major_strides(arg0_shape, strides0, shape_rank);
-                        row_major_strides(arg1_shape, strides1, shape_rank);
-
-                        size_t const padding0 = shape_rank - arg0_shape.size();
-                        size_t const padding1 = shape_rank - arg1_shape.size();
-
-                        Shape output_shape(shape_rank, 0);
-
-                        size_t axis = 0;
-
-                        for (size_t i = 0; i < shape_rank; i++)
-                        {
-                            auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
-                            auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
-
-                            output_shape[i] = std::max(dim0, dim1);
-
-                            if (dim0 != dim1)
-                                axis = std::max(axis, i);
-                        }
-#if 0
-                        // Universal function without optimisations
-                        CoordinateTransformBasic arg0_transform(arg0_shape);
-                        CoordinateTransformBasic arg1_transform(arg1_shape);
-                        U *dst = out;
-
-                        for(CoordinateIterator it(output_shape),
-                            ite = CoordinateIterator::end();
-                            it != ite;
-                            ++it)
+                        if (arg0_shape == arg1_shape)
                         {
-                            const Coordinate& output_coord = *it;
-                            size_t const idx0 = arg0_transform.index(output_coord);
-                            size_t const idx1 = arg1_transform.index(output_coord);
-                            *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
+                            parallel_for(shape_size(arg0_shape), [&](size_t begin, size_t end) {
+                                for (size_t i = begin; i < end; i++)
+                                {
+                                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                }
+                            });
+                            break;
                         }
-#else
 
-                        if (axis == 0)
-                        {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
-                        }
-                        else if (strides0[axis] == 1 &&
-                                 value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
+                        // Big outputs are split along the outermost axis, every thread
+                        // broadcasting its own slabs of the output
+                        const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                        if (rank > 1 && get_parallel_threads() > 1)
                         {
-                            axis = calculate_fixed_axis(axis, strides0);
-
-                            numpy_autobroadcast_binop<0, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides1[axis],
-                                                            elementwise_functor);
-                        }
-                        else if (strides1[axis] == 1 &&
-                                 value_with_padding_or(arg1_shape, padding1, axis, 1) == 1)
-                        {
-                            axis = calculate_fixed_axis(axis, strides1);
-
-                            numpy_autobroadcast_binop<1, 0>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
+                            Shape padded0(rank - arg0_shape.size(), 1);
+                            padded0.insert(padded0.end(), arg0_shape.begin(), arg0_shape.end());
+                            Shape padded1(rank - arg1_shape.size(), 1);
+                            padded1.insert(padded1.end(), arg1_shape.begin(), arg1_shape.end());
+
+                            const Shape inner0(padded0.begin() + 1, padded0.end());
+                            const Shape inner1(padded1.begin() + 1, padded1.end());
+                            size_t out_step = 1;
+                            for (size_t i = 0; i < inner0.size(); i++)
+                            {
+                                out_step *= std::max(inner0[i], inner1[i]);
+                            }
+                            const size_t step0 = padded0[0] == 1 ? 0 : shape_size(inner0);
+                            const size_t step1 = padded1[0] == 1 ? 0 : shape_size(inner1);
+                            const size_t outer = std::max(padded0[0], padded1[0]);
+                            const size_t grain =
+                                std::max<size_t>((1 << 16) / std::max<size_t>(out_step, 1), 1);
+
+                            if (outer >= 2 * grain)
+                            {
+                                parallel_for(outer,
+                                             [&](size_t begin, size_t end) {
+                                                 for (size_t i = begin; i < end; i++)
+                                                 {
+                                                     numpy_autobroadcast(arg0 + i * step0,
+                                                                         arg1 + i * step1,
+                                                                         out + i * out_step,
+                                                                         inner0,
+                                                                         inner1,
+                                                                         elementwise_functor);
+                                                 }
+                                             },
+                                             grain);
+                                break;
+                            }
                         }
-                        else
-                            numpy_autobroadcast_binop<1, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
-#endif
+
+                        numpy_autobroadcast(
+                            arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
@@ -18,7 +18,8 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -53,15 +54,31 @@ namespace ngraph
                         adjusted_axes.insert(axis);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                // The remaining output axes walk the input, the broadcast ones repeat it
+                auto adjusted_in_strides = row_major_strides(adjusted_in_shape);
+                std::vector<size_t> in_strides(out_shape.size(), 0);
+                size_t in_axis = 0;
+                for (size_t axis = 0; axis < out_shape.size(); ++axis)
                 {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    if (adjusted_axes.count(axis) == 0)
+                    {
+                        NGRAPH_CHECK(in_axis < adjusted_in_shape.size() &&
+                                         adjusted_in_shape[in_axis] == out_shape[axis],
+                                     "Broadcast input shape does not match the output shape");
+                        in_strides[axis] = adjusted_in_strides[in_axis++];
+                    }
                 }
+                NGRAPH_CHECK(in_axis == adjusted_in_shape.size(),
+                             "Broadcast input shape does not match the output shape");
+
+                strided_for_each(out_shape,
+                                 in_strides,
+                                 0,
+                                 row_major_strides(out_shape),
+                                 0,
+                                 [&](size_t in_index, size_t out_index) {
+                                     out[out_index] = arg[in_index];
+                                 });
             }
         }
     }
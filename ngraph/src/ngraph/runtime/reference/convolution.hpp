@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
+#include <type_traits>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/util.hpp"
 
@@ -264,6 +268,172 @@ namespace ngraph
                 std::fesetround(old_mode);
             }
 
+            template <typename T>
+            typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+                is_finite(T value)
+            {
+                return std::isfinite(value);
+            }
+
+            template <typename T>
+            typename std::enable_if<!std::is_floating_point<T>::value, bool>::type
+                is_finite(T)
+            {
+                return true;
+            }
+
+            // in: NC_I...
+            // filter: OC_C_F...
+            // out: NC_O...
+            //
+            // The patches of the input a tile of the output is computed from are unrolled into the
+            // columns of a matrix (im2col), which is multiplied by the filter matrix OC x C_F... The
+            // product is computed by the blocks of the columns and of the rows, so the blocks of
+            // both matrices and of the result stay in cache. The padding is unrolled into zeros.
+            // The summation is done in ACCUMULATION as by general_convolution.
+            template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+            void im2col_convolution(const INPUT* in,
+                                    const FILTER* filter,
+                                    OUTPUT* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& stride,
+                                    const Strides& filter_dilation,
+                                    const CoordinateDiff& in_pad_below)
+            {
+                const size_t n_spatial_dimensions = in_shape.size() - 2;
+                const size_t batch_size = in_shape[0];
+                const size_t n_in_channels = in_shape[1];
+                const size_t n_out_channels = filter_shape[0];
+
+                const Shape in_spatial_shape(in_shape.begin() + 2, in_shape.end());
+                const Shape filter_spatial_shape(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                const Strides in_spatial_strides = row_major_strides(in_spatial_shape);
+                const size_t in_spatial_size = shape_size(in_spatial_shape);
+                const size_t filter_spatial_size = shape_size(filter_spatial_shape);
+                const size_t out_spatial_size = shape_size(out_spatial_shape);
+                const size_t patch_size = n_in_channels * filter_spatial_size;
+
+                constexpr size_t columns_block = 64;
+                constexpr size_t rows_block = 256;
+
+                const std::vector<ACCUMULATION> weights(filter,
+                                                        filter + n_out_channels * patch_size);
+                const size_t n_tiles = (out_spatial_size + columns_block - 1) / columns_block;
+
+                // the tiles of the output are computed by several threads, each with its buffers
+                auto compute_tiles = [&](size_t tiles_begin, size_t tiles_end) {
+                    auto old_mode = std::fegetround();
+                    std::fesetround(FE_TONEAREST);
+
+                    std::vector<ACCUMULATION> columns(rows_block * columns_block);
+                    std::vector<ACCUMULATION> result(n_out_channels * columns_block);
+                    // the coordinates of the padded input the windows of the tile start at
+                    std::vector<std::ptrdiff_t> origins(columns_block * n_spatial_dimensions);
+                    std::vector<std::ptrdiff_t> filter_offsets(n_spatial_dimensions);
+
+                    for (size_t tile = tiles_begin; tile < tiles_end; tile++)
+                    {
+                        const size_t batch_index = tile / n_tiles;
+                        const INPUT* in_batch = in + batch_index * n_in_channels * in_spatial_size;
+                        OUTPUT* out_batch = out + batch_index * n_out_channels * out_spatial_size;
+                        const size_t out_begin = (tile % n_tiles) * columns_block;
+                        const size_t n_columns =
+                            std::min(columns_block, out_spatial_size - out_begin);
+
+                        for (size_t j = 0; j < n_columns; j++)
+                        {
+                            size_t out_index = out_begin + j;
+                            for (size_t d = n_spatial_dimensions; d-- > 0;)
+                            {
+                                std::ptrdiff_t out_coord = out_index % out_spatial_shape[d];
+                                out_index /= out_spatial_shape[d];
+                                origins[j * n_spatial_dimensions + d] =
+                                    out_coord * static_cast<std::ptrdiff_t>(stride[d]) -
+                                    in_pad_below[d];
+                            }
+                        }
+                        std::fill(result.begin(), result.end(), ACCUMULATION(0));
+
+                        for (size_t row_begin = 0; row_begin < patch_size; row_begin += rows_block)
+                        {
+                            const size_t n_rows = std::min(rows_block, patch_size - row_begin);
+
+                            for (size_t i = 0; i < n_rows; i++)
+                            {
+                                const size_t row = row_begin + i;
+                                const INPUT* in_channel =
+                                    in_batch + (row / filter_spatial_size) * in_spatial_size;
+                                size_t filter_index = row % filter_spatial_size;
+                                for (size_t d = n_spatial_dimensions; d-- > 0;)
+                                {
+                                    filter_offsets[d] =
+                                        (filter_index % filter_spatial_shape[d]) *
+                                        filter_dilation[d];
+                                    filter_index /= filter_spatial_shape[d];
+                                }
+
+                                ACCUMULATION* column_row = &columns[i * columns_block];
+                                for (size_t j = 0; j < n_columns; j++)
+                                {
+                                    const std::ptrdiff_t* origin =
+                                        &origins[j * n_spatial_dimensions];
+                                    size_t in_offset = 0;
+                                    bool in_bounds = true;
+                                    for (size_t d = 0; d < n_spatial_dimensions && in_bounds; d++)
+                                    {
+                                        std::ptrdiff_t in_coord = origin[d] + filter_offsets[d];
+                                        in_bounds =
+                                            in_coord >= 0 &&
+                                            in_coord < static_cast<std::ptrdiff_t>(
+                                                           in_spatial_shape[d]);
+                                        in_offset += in_coord * in_spatial_strides[d];
+                                    }
+                                    column_row[j] = in_bounds
+                                                        ? static_cast<ACCUMULATION>(
+                                                              in_channel[in_offset])
+                                                        : ACCUMULATION(0);
+                                }
+                            }
+
+                            for (size_t out_channel = 0; out_channel < n_out_channels;
+                                 out_channel++)
+                            {
+                                ACCUMULATION* result_row = &result[out_channel * columns_block];
+                                const ACCUMULATION* weights_row =
+                                    &weights[out_channel * patch_size + row_begin];
+                                for (size_t i = 0; i < n_rows; i++)
+                                {
+                                    const ACCUMULATION weight = weights_row[i];
+                                    const ACCUMULATION* column_row = &columns[i * columns_block];
+                                    for (size_t j = 0; j < n_columns; j++)
+                                    {
+                                        result_row[j] += weight * column_row[j];
+                                    }
+                                }
+                            }
+                        }
+
+                        for (size_t out_channel = 0; out_channel < n_out_channels; out_channel++)
+                        {
+                            for (size_t j = 0; j < n_columns; j++)
+                            {
+                                out_batch[out_channel * out_spatial_size + out_begin + j] =
+                                    result[out_channel * columns_block + j];
+                            }
+                        }
+                    }
+                    std::fesetround(old_mode);
+                };
+
+                const size_t tile_work = n_out_channels * patch_size * columns_block;
+                parallel_for(batch_size * n_tiles,
+                             compute_tiles,
+                             std::max<size_t>((1 << 20) / std::max<size_t>(tile_work, 1), 1));
+            }
+
             template <typename INPUT,
                       typename FILTER,
                       typename OUTPUT,
@@ -287,6 +457,32 @@ namespace ngraph
                              const OUTPUT* output_zero_point = nullptr)
 
             {
+                // The padding is multiplied as zeros, so the non-finite weights, which give NaN
+                // instead, as well as the quantized and the dilated inputs are left to the general
+                // implementation
+                bool is_im2col_applicable =
+                    !(input_scale || input_zero_point || filter_scale || filter_zero_point ||
+                      output_scale || output_zero_point) &&
+                    std::all_of(in_dilation.begin(),
+                                in_dilation.end(),
+                                [](size_t dilation) { return dilation == 1; }) &&
+                    std::all_of(filter,
+                                filter + shape_size(filter_shape),
+                                [](FILTER weight) { return is_finite(weight); });
+                if (is_im2col_applicable)
+                {
+                    im2col_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
+                                                                            filter,
+                                                                            out,
+                                                                            in_shape,
+                                                                            filter_shape,
+                                                                            out_shape,
+                                                                            stride,
+                                                                            filter_dilation,
+                                                                            in_pad_below);
+                    return;
+                }
+
                 general_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
                                                                          filter,
                                                                          out,
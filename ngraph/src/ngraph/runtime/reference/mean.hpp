@@ -16,11 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <map>
 #include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
@@ -36,52 +36,40 @@ namespace ngraph
             void mean(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
             {
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
+                std::fill(out, out + cs.size(), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                strided_for_each(in_shape,
+                                 row_major_strides(in_shape),
+                                 0,
+                                 reduction_strides(in_shape, reduction_axes),
+                                 0,
+                                 [&](size_t in_index, size_t out_index) {
+                                     T x = arg[in_index];
+                                     T& z = out[out_index];
 
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
+                                     if (is_finite(x) && is_finite(z))
+                                     {
+                                         T& c = cs[out_index];
+                                         T t = z + (x - c);
+                                         c = (t - z) - (x - c);
+                                         z = t;
+                                     }
+                                     else
+                                     {
+                                         z = z + x;
+                                     }
+                                 });
 
-                for (const Coordinate& input_coord : input_transform)
+                // Every output element accumulates the same number of input elements
+                int count = 1;
+                for (auto axis : reduction_axes)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    count *= static_cast<int>(in_shape.at(axis));
                 }
-
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t i = 0; i < cs.size(); ++i)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
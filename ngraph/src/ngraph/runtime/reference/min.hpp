@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -39,26 +40,20 @@ namespace ngraph
                                                                 : std::numeric_limits<T>::max();
 
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
-                    if (x < min)
-                    {
-                        out[output_transform.index(output_coord)] = x;
-                    }
-                }
+                std::fill(out, out + shape_size(out_shape), minval);
+
+                strided_for_each(in_shape,
+                                 row_major_strides(in_shape),
+                                 0,
+                                 reduction_strides(in_shape, reduction_axes),
+                                 0,
+                                 [&](size_t in_index, size_t out_index) {
+                                     T x = arg[in_index];
+                                     if (x < out[out_index])
+                                     {
+                                         out[out_index] = x;
+                                     }
+                                 });
             }
         }
     }
@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/pad.hpp" // for op::PadMode
+#include "ngraph/runtime/reference/strided_loop.hpp"
+#include "ngraph/shape_util.hpp"
 
 namespace ngraph
 {
@@ -29,6 +32,53 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Fills the output with the pad value and copies the part of the input which
+            ///        remains after the (possibly negative) padding into it.
+            template <typename T>
+            void pad_constant(const T* arg,
+                              const T& pad_value,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const CoordinateDiff& padding_below)
+            {
+                const size_t rank = arg_shape.size();
+                NGRAPH_CHECK(out_shape.size() == rank && padding_below.size() == rank);
+
+                std::fill(out, out + shape_size(out_shape), pad_value);
+
+                auto arg_strides = row_major_strides(arg_shape);
+                auto out_strides = row_major_strides(out_shape);
+                Shape copy_shape(rank);
+                size_t arg_offset = 0;
+                size_t out_offset = 0;
+                for (size_t i = 0; i < rank; ++i)
+                {
+                    const ptrdiff_t below = padding_below[i];
+                    const ptrdiff_t arg_begin = std::max<ptrdiff_t>(-below, 0);
+                    const ptrdiff_t out_begin = std::max<ptrdiff_t>(below, 0);
+                    const ptrdiff_t arg_end = std::min<ptrdiff_t>(
+                        static_cast<ptrdiff_t>(arg_shape[i]),
+                        static_cast<ptrdiff_t>(out_shape[i]) - below);
+                    if (arg_end <= arg_begin)
+                    {
+                        return;
+                    }
+                    copy_shape[i] = static_cast<size_t>(arg_end - arg_begin);
+                    arg_offset += static_cast<size_t>(arg_begin) * arg_strides[i];
+                    out_offset += static_cast<size_t>(out_begin) * out_strides[i];
+                }
+
+                strided_for_each(copy_shape,
+                                 arg_strides,
+                                 arg_offset,
+                                 out_strides,
+                                 out_offset,
+                                 [&](size_t arg_index, size_t out_index) {
+                                     out[out_index] = arg[arg_index];
+                                 });
+            }
+
             template <typename T>
             void pad(const T* arg0,
                      const T* arg1,
@@ -39,6 +89,12 @@ namespace ngraph
                      const CoordinateDiff& padding_above,
                      op::PadMode pad_mode)
             {
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    pad_constant(arg0, *arg1, out, arg0_shape, out_shape, padding_below);
+                    return;
+                }
+
                 Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
                 Coordinate input_end = out_shape; // end at (d'0,d'1,...,d'n), the outer corner of
                                                   // the post-padding shape
@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Number of threads used by the reference kernels for big tensors, it can be
+            ///        limited with the NGRAPH_REFERENCE_THREADS environment variable
+            ///        (1 disables the parallel execution).
+            inline size_t get_parallel_threads()
+            {
+                static const size_t threads = [] {
+                    int32_t env_threads = getenv_int("NGRAPH_REFERENCE_THREADS", 0);
+                    return env_threads > 0
+                               ? static_cast<size_t>(env_threads)
+                               : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+                }();
+                return threads;
+            }
+
+            /// \brief Splits [0, count) into contiguous chunks and calls func(begin, end) for
+            ///        each of them from several threads. Ranges shorter than the grain are
+            ///        processed in the calling thread, since starting threads costs more.
+            ///
+            /// \param count Number of elements to process.
+            /// \param func Functor processing the [begin, end) elements, it must not throw.
+            /// \param grain Least number of elements worth a separate thread.
+            template <typename Functor>
+            void parallel_for(size_t count, Functor func, size_t grain = 1 << 16)
+            {
+                size_t threads = std::min(get_parallel_threads(), count / std::max<size_t>(grain, 1));
+                if (threads <= 1)
+                {
+                    func(size_t(0), count);
+                    return;
+                }
+
+                const size_t chunk = (count + threads - 1) / threads;
+                std::vector<std::thread> workers;
+                workers.reserve(threads - 1);
+                for (size_t begin = chunk; begin < count; begin += chunk)
+                {
+                    workers.emplace_back(func, begin, std::min(begin + chunk, count));
+                }
+                func(size_t(0), std::min(chunk, count));
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
+        }
+    }
+}
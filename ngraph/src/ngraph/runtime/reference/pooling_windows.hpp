@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace internal
+            {
+                /// \brief The elements of every pooling window which are not in the padding, as
+                ///        the offsets in a spatial plane of the input, in the row-major order of
+                ///        the window.
+                struct PoolingWindows
+                {
+                    /// \brief The offsets of the window of the output position i are
+                    ///        offsets[begins[i]] ... offsets[begins[i + 1] - 1].
+                    std::vector<size_t> offsets;
+                    std::vector<size_t> begins;
+                    /// \brief The number of the elements of a window, the padding included.
+                    size_t window_size;
+                };
+
+                /// \brief Clips the windows of all the output positions once, so every plane of
+                ///        the input is pooled by the plain loops over the offsets.
+                inline PoolingWindows get_pooling_windows(const Shape& arg_shape,
+                                                          const Shape& out_shape,
+                                                          const Shape& window_shape,
+                                                          const Strides& window_movement_strides,
+                                                          const Shape& padding_below)
+                {
+                    const size_t n_spatial_dimensions = arg_shape.size() - 2;
+                    const Shape arg_spatial_shape(arg_shape.begin() + 2, arg_shape.end());
+                    const Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                    const Strides arg_spatial_strides = row_major_strides(arg_spatial_shape);
+                    const size_t out_spatial_size = shape_size(out_spatial_shape);
+
+                    PoolingWindows windows;
+                    windows.window_size = shape_size(window_shape);
+                    windows.offsets.reserve(out_spatial_size * windows.window_size);
+                    windows.begins.reserve(out_spatial_size + 1);
+                    windows.begins.push_back(0);
+                    std::vector<std::ptrdiff_t> origin(n_spatial_dimensions);
+                    for (size_t out_index = 0; out_index < out_spatial_size; out_index++)
+                    {
+                        size_t index = out_index;
+                        for (size_t d = n_spatial_dimensions; d-- > 0;)
+                        {
+                            origin[d] = static_cast<std::ptrdiff_t>(
+                                            (index % out_spatial_shape[d]) *
+                                            window_movement_strides[d]) -
+                                        static_cast<std::ptrdiff_t>(padding_below[d]);
+                            index /= out_spatial_shape[d];
+                        }
+
+                        for (size_t window_index = 0; window_index < windows.window_size;
+                             window_index++)
+                        {
+                            size_t element = window_index;
+                            size_t offset = 0;
+                            bool in_bounds = true;
+                            for (size_t d = n_spatial_dimensions; d-- > 0;)
+                            {
+                                std::ptrdiff_t coord =
+                                    origin[d] +
+                                    static_cast<std::ptrdiff_t>(element % window_shape[d]);
+                                element /= window_shape[d];
+                                in_bounds = in_bounds && coord >= 0 &&
+                                            coord < static_cast<std::ptrdiff_t>(
+                                                        arg_spatial_shape[d]);
+                                offset += coord * arg_spatial_strides[d];
+                            }
+                            if (in_bounds)
+                            {
+                                windows.offsets.push_back(offset);
+                            }
+                        }
+                        windows.begins.push_back(windows.offsets.size());
+                    }
+                    return windows;
+                }
+            }
+        }
+    }
+}
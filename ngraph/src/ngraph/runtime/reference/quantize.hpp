@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -26,6 +31,65 @@ namespace ngraph
     {
         namespace reference
         {
+            template <typename REAL>
+            REAL quantize_round(REAL qvalue, op::Quantize::RoundMode round_mode)
+            {
+                if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY)
+                {
+                    REAL abs_qvalue = std::fabs(qvalue);
+                    REAL abs_qvalue_toward_inf =
+                        std::floor(abs_qvalue + static_cast<REAL>(0.5));
+                    qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_inf
+                                                               : abs_qvalue_toward_inf;
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO)
+                {
+                    auto abs_qvalue = std::fabs(qvalue);
+                    auto abs_qvalue_toward_zero =
+                        std::ceil(abs_qvalue - static_cast<REAL>(0.5));
+                    qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_zero
+                                                               : abs_qvalue_toward_zero;
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_UPWARD)
+                {
+                    qvalue = std::floor(qvalue + static_cast<REAL>(0.5));
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD)
+                {
+                    qvalue = std::ceil(qvalue - static_cast<REAL>(0.5));
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
+                {
+                    auto up_qvalue = std::floor(qvalue + static_cast<REAL>(0.5));
+                    auto dn_qvalue = std::ceil(qvalue - static_cast<REAL>(0.5));
+                    auto rem = std::fmod(up_qvalue, 2.0);
+                    qvalue = (rem == 0.0) ? up_qvalue : dn_qvalue;
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_TOWARD_INFINITY)
+                {
+                    auto abs_qvalue = std::fabs(qvalue);
+                    auto abs_qvalue_toward_inf = std::ceil(abs_qvalue);
+                    qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_inf
+                                                               : abs_qvalue_toward_inf;
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_TOWARD_ZERO)
+                {
+                    auto abs_qvalue = std::fabs(qvalue);
+                    auto abs_qvalue_toward_zero = std::floor(abs_qvalue);
+                    qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_zero
+                                                               : abs_qvalue_toward_zero;
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_UP)
+                {
+                    qvalue = std::ceil(qvalue);
+                }
+                else if (round_mode == op::Quantize::RoundMode::ROUND_DOWN)
+                {
+                    qvalue = std::floor(qvalue);
+                }
+                return qvalue;
+            }
+
             template <typename REAL, typename QUANT>
             void quantize(const REAL* input,
                           const REAL* scale,
@@ -36,84 +100,55 @@ namespace ngraph
                           const AxisSet& axes,
                           op::Quantize::RoundMode round_mode)
             {
-                CoordinateTransform input_transform(input_shape);
-                CoordinateTransform scale_zero_point_transform(scale_zero_point_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                // The scale and the zero point are indexed by the input coordinates projected
+                // onto the quantization axes, the strides below turn the input coordinates
+                // straight into that index
+                const size_t rank = input_shape.size();
+                const auto input_strides = row_major_strides(input_shape);
+                const auto scale_zero_point_strides = row_major_strides(scale_zero_point_shape);
+                std::vector<size_t> projected_strides(rank, 0);
+                size_t projected_axis = 0;
+                for (size_t i = 0; i < rank; i++)
                 {
-                    Coordinate scale_zero_point_coord = project(input_coord, axes);
-
-                    // apply scale
-                    REAL qvalue = input[input_transform.index(input_coord)] /
-                                  scale[scale_zero_point_transform.index(scale_zero_point_coord)];
-
-                    // round
-                    if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY)
-                    {
-                        REAL abs_qvalue = std::fabs(qvalue);
-                        REAL abs_qvalue_toward_inf =
-                            std::floor(abs_qvalue + static_cast<REAL>(0.5));
-                        qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_inf
-                                                                   : abs_qvalue_toward_inf;
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO)
-                    {
-                        auto abs_qvalue = std::fabs(qvalue);
-                        auto abs_qvalue_toward_zero =
-                            std::ceil(abs_qvalue - static_cast<REAL>(0.5));
-                        qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_zero
-                                                                   : abs_qvalue_toward_zero;
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_UPWARD)
-                    {
-                        qvalue = std::floor(qvalue + static_cast<REAL>(0.5));
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD)
-                    {
-                        qvalue = std::ceil(qvalue - static_cast<REAL>(0.5));
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
-                    {
-                        auto up_qvalue = std::floor(qvalue + static_cast<REAL>(0.5));
-                        auto dn_qvalue = std::ceil(qvalue - static_cast<REAL>(0.5));
-                        auto rem = std::fmod(up_qvalue, 2.0);
-                        qvalue = (rem == 0.0) ? up_qvalue : dn_qvalue;
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_TOWARD_INFINITY)
+                    if (axes.count(i) != 0)
                     {
-                        auto abs_qvalue = std::fabs(qvalue);
-                        auto abs_qvalue_toward_inf = std::ceil(abs_qvalue);
-                        qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_inf
-                                                                   : abs_qvalue_toward_inf;
+                        projected_strides[i] = scale_zero_point_strides[projected_axis++];
                     }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_TOWARD_ZERO)
-                    {
-                        auto abs_qvalue = std::fabs(qvalue);
-                        auto abs_qvalue_toward_zero = std::floor(abs_qvalue);
-                        qvalue = (qvalue < static_cast<REAL>(0.0)) ? -abs_qvalue_toward_zero
-                                                                   : abs_qvalue_toward_zero;
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_UP)
-                    {
-                        qvalue = std::ceil(qvalue);
-                    }
-                    else if (round_mode == op::Quantize::RoundMode::ROUND_DOWN)
+                }
+
+                parallel_for(shape_size(input_shape), [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
                     {
-                        qvalue = std::floor(qvalue);
-                    }
+                        size_t scale_zero_point_index = 0;
+                        if (!axes.empty())
+                        {
+                            for (size_t axis = 0, rest = i; axis < rank; axis++)
+                            {
+                                scale_zero_point_index +=
+                                    rest / input_strides[axis] * projected_strides[axis];
+                                rest %= input_strides[axis];
+                            }
+                        }
 
-                    // apply zero_point
-                    qvalue += zero_point[scale_zero_point_transform.index(scale_zero_point_coord)];
+                        // apply scale
+                        REAL qvalue = input[i] / scale[scale_zero_point_index];
 
-                    // clamp
-                    qvalue = std::max<REAL>(qvalue,
-                                            static_cast<REAL>(std::numeric_limits<QUANT>::min()));
-                    qvalue = std::min<REAL>(qvalue,
-                                            static_cast<REAL>(std::numeric_limits<QUANT>::max()));
+                        // round
+                        qvalue = quantize_round(qvalue, round_mode);
 
-                    // cast
-                    output[input_transform.index(input_coord)] = static_cast<QUANT>(qvalue);
-                }
+                        // apply zero_point
+                        qvalue += zero_point[scale_zero_point_index];
+
+                        // clamp
+                        qvalue = std::max<REAL>(
+                            qvalue, static_cast<REAL>(std::numeric_limits<QUANT>::min()));
+                        qvalue = std::min<REAL>(
+                            qvalue, static_cast<REAL>(std::numeric_limits<QUANT>::max()));
+
+                        // cast
+                        output[i] = static_cast<QUANT>(qvalue);
+                    }
+                });
             }
         }
     }
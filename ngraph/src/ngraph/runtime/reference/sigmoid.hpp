@@ -19,6 +19,8 @@
 #include <cmath>
 #include <cstddef>
 
+#include "ngraph/runtime/reference/parallel.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -28,12 +30,13 @@ namespace ngraph
             template <typename T>
             void sigmoid(const T* arg, T* out, size_t count)
             {
-                T exp_value;
-                for (size_t i = 0; i < count; i++)
-                {
-                    exp_value = std::exp(-arg[i]);
-                    out[i] = 1 / (1 + exp_value);
-                }
+                parallel_for(count, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        T exp_value = std::exp(-arg[i]);
+                        out[i] = 1 / (1 + exp_value);
+                    }
+                });
             }
 
             template <typename T>
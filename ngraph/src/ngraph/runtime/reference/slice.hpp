@@ -19,7 +19,10 @@
 #include <cmath>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strides.hpp"
 
 namespace ngraph
 {
@@ -36,22 +39,34 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
+                const size_t rank = arg_shape.size();
+                NGRAPH_CHECK(lower_bounds.size() == rank && upper_bounds.size() == rank &&
+                             strides.size() == rank);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                auto arg_strides = row_major_strides(arg_shape);
+                Shape slice_shape(rank);
+                std::vector<size_t> in_strides(rank);
+                size_t in_offset = 0;
+                for (size_t i = 0; i < rank; ++i)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    NGRAPH_CHECK(strides[i] > 0 && lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i]);
+                    slice_shape[i] = (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) /
+                                     strides[i];
+                    in_strides[i] = arg_strides[i] * strides[i];
+                    in_offset += arg_strides[i] * lower_bounds[i];
+                }
 
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                strided_for_each(slice_shape,
+                                 in_strides,
+                                 in_offset,
+                                 row_major_strides(slice_shape),
+                                 0,
+                                 [&](size_t in_index, size_t out_index) {
+                                     out[out_index] = arg[in_index];
+                                 });
             }
         }
     }
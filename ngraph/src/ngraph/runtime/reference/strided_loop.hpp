@@ -0,0 +1,222 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace internal
+            {
+                template <size_t Rank>
+                struct StridedLoop
+                {
+                    template <typename Functor>
+                    static void run(const size_t* shape,
+                                    const size_t* a_strides,
+                                    const size_t* b_strides,
+                                    size_t a,
+                                    size_t b,
+                                    Functor& func)
+                    {
+                        for (size_t i = 0; i < shape[0]; ++i, a += a_strides[0], b += b_strides[0])
+                        {
+                            StridedLoop<Rank - 1>::run(
+                                shape + 1, a_strides + 1, b_strides + 1, a, b, func);
+                        }
+                    }
+                };
+
+                template <>
+                struct StridedLoop<1>
+                {
+                    template <typename Functor>
+                    static void run(const size_t* shape,
+                                    const size_t* a_strides,
+                                    const size_t* b_strides,
+                                    size_t a,
+                                    size_t b,
+                                    Functor& func)
+                    {
+                        // Dense innermost axes get a loop the compiler is able to vectorize
+                        if (a_strides[0] == 1 && b_strides[0] == 1)
+                        {
+                            for (size_t i = 0; i < shape[0]; ++i)
+                            {
+                                func(a + i, b + i);
+                            }
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < shape[0];
+                                 ++i, a += a_strides[0], b += b_strides[0])
+                            {
+                                func(a, b);
+                            }
+                        }
+                    }
+                };
+
+                template <>
+                struct StridedLoop<0>
+                {
+                    template <typename Functor>
+                    static void run(const size_t*,
+                                    const size_t*,
+                                    const size_t*,
+                                    size_t a,
+                                    size_t b,
+                                    Functor& func)
+                    {
+                        func(a, b);
+                    }
+                };
+
+                template <typename Functor>
+                void strided_loop_any_rank(const std::vector<size_t>& shape,
+                                           const std::vector<size_t>& a_strides,
+                                           const std::vector<size_t>& b_strides,
+                                           size_t a,
+                                           size_t b,
+                                           Functor& func)
+                {
+                    const size_t inner = shape.size() - 1;
+                    std::vector<size_t> index(shape.size(), 0);
+                    while (true)
+                    {
+                        StridedLoop<1>::run(
+                            &shape[inner], &a_strides[inner], &b_strides[inner], a, b, func);
+
+                        size_t axis = inner;
+                        while (axis > 0 && ++index[axis - 1] == shape[axis - 1])
+                        {
+                            index[axis - 1] = 0;
+                            a -= (shape[axis - 1] - 1) * a_strides[axis - 1];
+                            b -= (shape[axis - 1] - 1) * b_strides[axis - 1];
+                            --axis;
+                        }
+                        if (axis == 0)
+                        {
+                            return;
+                        }
+                        a += a_strides[axis - 1];
+                        b += b_strides[axis - 1];
+                    }
+                }
+            }
+
+            /// \brief Walks the elements of a tensor of the given shape in row-major order and
+            ///        calls func(a_index, b_index) for each of them, where the indices are
+            ///        offsets into two buffers laid out with the given element strides.
+            ///
+            /// This is a replacement of CoordinateTransform for the hot reference kernels: no
+            /// coordinate is materialized, axes of length 1 are skipped, axes which are
+            /// contiguous in both buffers are merged and ranks up to 6 run as fixed loop nests.
+            ///
+            /// \param shape Shape of the iteration space.
+            /// \param a_strides Strides of the first buffer, one per axis of the shape.
+            /// \param a_offset Offset of the first element in the first buffer.
+            /// \param b_strides Strides of the second buffer, one per axis of the shape.
+            /// \param b_offset Offset of the first element in the second buffer.
+            /// \param func Functor called with the offsets of every element.
+            template <typename Functor>
+            void strided_for_each(const Shape& shape,
+                                  const std::vector<size_t>& a_strides,
+                                  size_t a_offset,
+                                  const std::vector<size_t>& b_strides,
+                                  size_t b_offset,
+                                  Functor func)
+            {
+                NGRAPH_CHECK(a_strides.size() == shape.size() && b_strides.size() == shape.size(),
+                             "Strides do not match the rank of the iteration space");
+
+                std::vector<size_t> loop_shape;
+                std::vector<size_t> loop_a_strides;
+                std::vector<size_t> loop_b_strides;
+                for (size_t i = 0; i < shape.size(); ++i)
+                {
+                    if (shape[i] == 0)
+                    {
+                        return;
+                    }
+                    if (shape[i] == 1)
+                    {
+                        continue;
+                    }
+                    if (!loop_shape.empty() &&
+                        loop_a_strides.back() == a_strides[i] * shape[i] &&
+                        loop_b_strides.back() == b_strides[i] * shape[i])
+                    {
+                        loop_shape.back() *= shape[i];
+                        loop_a_strides.back() = a_strides[i];
+                        loop_b_strides.back() = b_strides[i];
+                        continue;
+                    }
+                    loop_shape.push_back(shape[i]);
+                    loop_a_strides.push_back(a_strides[i]);
+                    loop_b_strides.push_back(b_strides[i]);
+                }
+
+                const size_t* s = loop_shape.data();
+                const size_t* as = loop_a_strides.data();
+                const size_t* bs = loop_b_strides.data();
+                switch (loop_shape.size())
+                {
+                case 0: internal::StridedLoop<0>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 1: internal::StridedLoop<1>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 2: internal::StridedLoop<2>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 3: internal::StridedLoop<3>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 4: internal::StridedLoop<4>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 5: internal::StridedLoop<5>::run(s, as, bs, a_offset, b_offset, func); break;
+                case 6: internal::StridedLoop<6>::run(s, as, bs, a_offset, b_offset, func); break;
+                default:
+                    internal::strided_loop_any_rank(
+                        loop_shape, loop_a_strides, loop_b_strides, a_offset, b_offset, func);
+                    break;
+                }
+            }
+
+            /// \brief Strides of the output of a reduction over the axes of its input: the
+            ///        reduced axes get a zero stride, so all of their elements map to the same
+            ///        output element.
+            inline std::vector<size_t> reduction_strides(const Shape& in_shape,
+                                                         const AxisSet& reduction_axes)
+            {
+                std::vector<size_t> strides(in_shape.size(), 0);
+                size_t stride = 1;
+                for (size_t i = in_shape.size(); i-- > 0;)
+                {
+                    if (reduction_axes.count(i) == 0)
+                    {
+                        strides[i] = stride;
+                        stride *= in_shape[i];
+                    }
+                }
+                return strides;
+            }
+        }
+    }
+}
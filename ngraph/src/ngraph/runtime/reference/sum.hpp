@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
+#include "ngraph/runtime/reference/strided_loop.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,40 +54,71 @@ namespace ngraph
                 return true;
             }
 
-            template <typename T>
-            void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+            namespace internal
             {
-                auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
+                template <typename T>
+                void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
+                    auto out_shape = reduce(in_shape, reduction_axes);
+                    std::vector<T> cs(shape_size(out_shape));
+                    std::fill(out, out + cs.size(), T(0));
 
-                CoordinateTransform input_transform(in_shape);
+                    strided_for_each(in_shape,
+                                     row_major_strides(in_shape),
+                                     0,
+                                     reduction_strides(in_shape, reduction_axes),
+                                     0,
+                                     [&](size_t in_index, size_t out_index) {
+                                         T x = arg[in_index];
+                                         T& z = out[out_index];
 
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+                                         if (is_finite(x) && is_finite(z))
+                                         {
+                                             T& c = cs[out_index];
+                                             T t = z + (x - c);
+                                             c = (t - z) - (x - c);
+                                             z = t;
+                                         }
+                                         else
+                                         {
+                                             z = z + x;
+                                         }
+                                     });
+                }
+            }
 
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
+            template <typename T>
+            void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+            {
+                // The slabs along the outermost axis are summed independently when the axis is
+                // not reduced
+                if (in_shape.size() > 1 && reduction_axes.count(0) == 0 &&
+                    get_parallel_threads() > 1)
+                {
+                    const Shape slab_shape(in_shape.begin() + 1, in_shape.end());
+                    AxisSet slab_axes;
+                    for (auto axis : reduction_axes)
                     {
-                        z = z + x;
+                        slab_axes.insert(axis - 1);
                     }
+                    const size_t in_slab = shape_size(slab_shape);
+                    const size_t out_slab = shape_size(reduce(slab_shape, slab_axes));
+
+                    parallel_for(in_shape[0],
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         internal::sum(arg + i * in_slab,
+                                                       out + i * out_slab,
+                                                       slab_shape,
+                                                       slab_axes);
+                                     }
+                                 },
+                                 std::max<size_t>((1 << 16) / std::max<size_t>(in_slab, 1), 1));
+                    return;
                 }
+
+                internal::sum(arg, out, in_shape, reduction_axes);
             }
         }
     }
@@ -20,6 +20,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/tensor_iterator.hpp"
 #include "ngraph/op/util/op_types.hpp"
+#include "ngraph/pass/shape_relevance.hpp"
 
 using namespace ngraph;
 
@@ -39,7 +40,8 @@ std::shared_ptr<Function>
                                 const std::vector<PartialShape>& parameter_shapes,
                                 const std::vector<void*>& parameter_values,
                                 bool constant_folding,
-                                bool share_constants)
+                                bool share_constants,
+                                const pass::ShapeProgram* shape_program)
 {
     NGRAPH_CHECK(f->get_parameters().size() == parameter_shapes.size());
     NGRAPH_CHECK(f->get_parameters().size() == parameter_element_types.size());
@@ -66,6 +68,11 @@ std::shared_ptr<Function>
         m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
     }
 
+    pass::ShapeProgram::Values shape_values;
+    auto output_shape = [&m](const Output<Node>& output) {
+        return m.at(output.get_node())->get_output_partial_shape(output.get_index());
+    };
+
     for (auto old_node : f->get_ordered_ops())
     {
         if (op::is_parameter(old_node))
@@ -73,6 +80,17 @@ std::shared_ptr<Function>
             continue;
         }
 
+        if (shape_program != nullptr)
+        {
+            if (auto constant = shape_program->evaluate(old_node.get(), shape_values, output_shape))
+            {
+                constant->get_rt_info() = old_node->get_rt_info();
+                constant->set_friendly_name(old_node->get_friendly_name());
+                m[old_node.get()] = constant;
+                continue;
+            }
+        }
+
         OutputVector new_args;
         for (auto input : old_node->inputs())
         {
@@ -20,6 +20,11 @@
 
 namespace ngraph
 {
+    namespace pass
+    {
+        class ShapeProgram;
+    }
+
     /// \brief Creates a "specialized" clone of a function. The partial shapes and element types of
     ///        the function's parameters may be narrowed to more specific shapes and element types,
     ///        and constant values may optionally be substituted for any or all of the parameters.
@@ -195,6 +200,10 @@ namespace ngraph
     ///       which a Constant node with element type parameter_element_types[i] and shape
     ///       parameter_shapes[i] can be created.
     ///
+    /// If `shape_program` is not nullptr, it has to be built for `f`. The shape subgraphs it
+    /// can compute with the new parameter shapes are replaced with Constants while the nodes are
+    /// cloned, so they are neither cloned nor constant folded.
+    ///
     /// TODO(amprocte): convert this to a pass.
     NGRAPH_API
     std::shared_ptr<Function>
@@ -203,5 +212,6 @@ namespace ngraph
                             const std::vector<PartialShape>& parameter_shapes,
                             const std::vector<void*>& parameter_values,
                             bool constant_folding,
-                            bool share_constants);
+                            bool share_constants,
+                            const pass::ShapeProgram* shape_program = nullptr);
 }
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "util/type_prop.hpp"
 
 using namespace ngraph;
@@ -1389,3 +1390,30 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, shared_data)
+{
+    std::vector<float> values{1.0f, 2.0f, 3.0f, 4.0f};
+    auto buffer = std::make_shared<runtime::SharedBuffer<std::vector<float>*>>(
+        reinterpret_cast<char*>(values.data()), values.size() * sizeof(float), &values);
+    op::Constant c(element::f32, Shape{2, 2}, buffer);
+    EXPECT_EQ(c.get_data_ptr(), values.data());
+    EXPECT_EQ(c.get_vector<float>(), values);
+}
+
+TEST(constant, shared_data_with_new_shape)
+{
+    op::Constant c(element::f32, Shape{2, 2}, std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    op::Constant reshaped(c, Shape{4});
+    EXPECT_EQ(reshaped.get_shape(), Shape{4});
+    EXPECT_EQ(reshaped.get_data_ptr(), c.get_data_ptr());
+    EXPECT_THROW(op::Constant(c, Shape{3}), NodeValidationFailure);
+}
+
+TEST(constant, shared_data_too_small)
+{
+    std::vector<float> values{1.0f, 2.0f};
+    auto buffer = std::make_shared<runtime::SharedBuffer<std::vector<float>*>>(
+        reinterpret_cast<char*>(values.data()), values.size() * sizeof(float), &values);
+    EXPECT_THROW(op::Constant(element::f32, Shape{2, 2}, buffer), NodeValidationFailure);
+}
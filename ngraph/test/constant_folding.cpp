@@ -2093,6 +2093,25 @@ TEST(constant_folding, constant_dyn_reshape)
     ASSERT_TRUE(test::all_close_f(values_in, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_dyn_reshape_shares_data)
+{
+    auto constant_in =
+        make_shared<op::Constant>(element::f32, Shape{2, 4}, vector<float>{0, 1, 2, 3, 4, 5, 6, 7});
+    auto constant_shape = make_shared<op::Constant>(element::i64, Shape{2}, vector<int64_t>{4, 2});
+    auto dyn_reshape = make_shared<op::v1::Reshape>(constant_in, constant_shape, false);
+    auto f = make_shared<Function>(dyn_reshape, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{4, 2}));
+    ASSERT_EQ(new_const->get_data_ptr(), constant_in->get_data_ptr());
+}
+
 TEST(constant_folding, constant_dyn_reshape_shape_not_originally_constant)
 {
     Shape shape_in{2, 4};
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_arena.hpp"
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(graph_arena, nodes_keep_arena_alive)
+{
+    weak_ptr<GraphArena> weak_arena;
+    shared_ptr<Function> f;
+    {
+        auto arena = make_shared<GraphArena>();
+        weak_arena = arena;
+        GraphArena::Scope scope(arena);
+
+        auto param = make_shared_in_arena<op::Parameter>(element::f32, Shape{2, 3});
+        auto relu = make_shared_in_arena<op::Relu>(param);
+        f = make_shared<Function>(relu, ParameterVector{param});
+
+        EXPECT_GE(arena->get_allocated_size(), sizeof(op::Parameter) + sizeof(op::Relu));
+        EXPECT_EQ(relu->get_output_shape(0), (Shape{2, 3}));
+    }
+
+    EXPECT_EQ(GraphArena::get_current(), nullptr);
+    EXPECT_FALSE(weak_arena.expired());
+
+    f.reset();
+    EXPECT_TRUE(weak_arena.expired());
+}
+
+TEST(graph_arena, scopes_are_nested)
+{
+    auto outer = make_shared<GraphArena>();
+    auto inner = make_shared<GraphArena>();
+    {
+        GraphArena::Scope outer_scope(outer);
+        {
+            GraphArena::Scope inner_scope(inner);
+            EXPECT_EQ(GraphArena::get_current(), inner);
+        }
+        EXPECT_EQ(GraphArena::get_current(), outer);
+    }
+    EXPECT_EQ(GraphArena::get_current(), nullptr);
+
+    auto param = make_shared_in_arena<op::Parameter>(element::f32, Shape{1});
+    EXPECT_EQ(outer->get_allocated_size(), 0u);
+    EXPECT_EQ(inner->get_allocated_size(), 0u);
+}
+
+TEST(graph_arena, big_objects_are_aligned)
+{
+    auto arena = make_shared<GraphArena>(256);
+    for (size_t size : {1, 24, 100, 1000})
+    {
+        auto ptr = reinterpret_cast<uintptr_t>(arena->allocate(size, 64));
+        EXPECT_EQ(ptr % 64, 0u);
+    }
+    EXPECT_EQ(arena->get_allocated_size(), 1125u);
+}
@@ -192,6 +192,24 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1, 1, 1, 1});
+    test_case.add_expected_output<float>({7, 9, 11, 13});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_file_not_found)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(file_util::path_join(
+                     SERIALIZED_ZOO, "onnx/external_data/external_data_file_not_found.prototxt")),
+                 ngraph_error);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
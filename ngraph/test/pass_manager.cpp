@@ -67,3 +67,52 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+namespace
+{
+    // Inserts a Convert to f16 between the parameter and its consumer
+    class InsertConvertPass : public pass::FunctionPass
+    {
+    public:
+        InsertConvertPass()
+            : FunctionPass()
+        {
+        }
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            auto param = f->get_parameters().at(0);
+            auto convert = make_shared<op::Convert>(param, element::f16);
+            for (auto& input : param->output(0).get_target_inputs())
+            {
+                input.replace_source_output(convert);
+            }
+            return true;
+        }
+    };
+}
+
+TEST(pass_manager, incremental_validation_reinfers_downstream_nodes)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto abs = make_shared<op::Abs>(param);
+    auto neg = make_shared<op::Negative>(abs);
+    auto f = make_shared<Function>(neg, ParameterVector{param});
+
+    vector<string> passes;
+    pass::Manager pass_manager;
+    pass_manager.set_incremental_validation(true);
+    pass_manager.set_profiling_callback(
+        [&](const string& name, size_t /* microseconds */) { passes.push_back(name); });
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<InsertConvertPass>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(abs->get_input_node_ptr(0)->get_type_info(), op::Convert::type_info);
+    EXPECT_EQ(abs->get_output_element_type(0), element::f16);
+    EXPECT_EQ(neg->get_output_element_type(0), element::f16);
+    EXPECT_EQ(f->get_output_element_type(0), element::f16);
+
+    // every pass is reported, including the Validate ones
+    ASSERT_EQ(passes.size(), 4);
+    EXPECT_NE(passes[1].find("Validate"), string::npos);
+}
@@ -24,6 +24,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
+#include "ngraph/specialize_function.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -176,3 +177,75 @@ TEST(shape_relevance, param_shape_of_indirect_i32_v3)
 
     ASSERT_FALSE(param0->is_relevant_to_shapes());
 }
+
+namespace
+{
+    // Reshape of the data to {batch, product of the other dims}
+    shared_ptr<Function> make_flatten(const PartialShape& shape)
+    {
+        auto param0 = make_shared<op::Parameter>(element::f32, shape);
+        auto s = make_shared<op::v3::ShapeOf>(param0);
+        auto batch = make_shared<op::v1::Gather>(s,
+                                                 op::Constant::create(element::i64, Shape{1}, {0}),
+                                                 op::Constant::create(element::i64, Shape{}, {0}));
+        auto dims = make_shared<op::v1::Gather>(
+            s,
+            op::Constant::create(element::i64, Shape{3}, {1, 2, 3}),
+            op::Constant::create(element::i64, Shape{}, {0}));
+        auto size = make_shared<op::v1::ReduceProd>(
+            dims, op::Constant::create(element::i64, Shape{1}, {0}), true);
+        auto c = make_shared<op::Concat>(NodeVector{batch, size}, 0);
+        auto x = make_shared<op::v1::Reshape>(param0, c, true);
+        return make_shared<Function>(x, ParameterVector{param0});
+    }
+}
+
+TEST(shape_program, shape_subgraph_is_compiled)
+{
+    auto f = make_flatten(PartialShape{2, 3, 4, 5});
+
+    pass::ShapeProgram program(*f);
+    ASSERT_EQ(program.size(), 5);
+    for (const auto& node : f->get_ordered_ops())
+    {
+        ASSERT_EQ(program.contains(node.get()),
+                  is_type<op::v3::ShapeOf>(node) || is_type<op::v1::Gather>(node) ||
+                      is_type<op::v1::ReduceProd>(node) || is_type<op::Concat>(node));
+    }
+}
+
+TEST(shape_program, specialization_replaces_shape_subgraph)
+{
+    auto f = make_flatten(PartialShape{2, 3, 4, 5});
+    pass::ShapeProgram program(*f);
+
+    auto g = specialize_function(
+        f, {element::f32}, {PartialShape{8, 3, 4, 5}}, {nullptr}, false, true, &program);
+
+    ASSERT_EQ(g->get_output_partial_shape(0), (PartialShape{8, 60}));
+    auto reshape = g->get_result()->get_input_node_shared_ptr(0);
+    auto pattern = as_type_ptr<op::Constant>(reshape->get_input_node_shared_ptr(1));
+    ASSERT_NE(pattern, nullptr);
+    ASSERT_EQ(pattern->cast_vector<int64_t>(), (vector<int64_t>{8, 60}));
+    for (const auto& node : g->get_ordered_ops())
+    {
+        ASSERT_FALSE(is_type<op::v3::ShapeOf>(node));
+    }
+}
+
+TEST(shape_program, dynamic_shape_is_not_evaluated)
+{
+    auto f = make_flatten(PartialShape{2, 3, 4, 5});
+    pass::ShapeProgram program(*f);
+
+    auto g = specialize_function(f,
+                                 {element::f32},
+                                 {PartialShape{Dimension::dynamic(), 3, 4, 5}},
+                                 {nullptr},
+                                 false,
+                                 true,
+                                 &program);
+
+    ASSERT_TRUE(g->get_output_partial_shape(0).rank().compatible(2));
+    ASSERT_TRUE(g->get_output_partial_shape(0).is_dynamic());
+}
@@ -293,6 +293,26 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+TEST(pattern, graph_rewrite_merged_matchers)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto iconst0 = construct_constant_node(0);
+    auto iconst1 = construct_constant_node(1);
+    auto graph = b + (iconst0 + ((a + iconst0) * iconst1));
+    auto f = make_shared<Function>(graph, ParameterVector{a, b});
+
+    // both matchers of the merged pass are applied during the traversal of the merging one
+    auto merged = make_shared<pass::GraphRewrite>();
+    merged->add_matchers(make_shared<TestGraphRewrite>());
+    ASSERT_TRUE(merged->run_on_function(f));
+
+    ASSERT_EQ(graph->input_value(1).get_node_shared_ptr(), a);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 1);
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
@@ -559,6 +579,44 @@ TEST(pattern, test_sort)
     }
 }
 
+TEST(pattern, deep_commutative_match)
+{
+    using ngraph::pattern::Matcher;
+    Shape shape{};
+    const size_t depth = 8;
+
+    // a balanced tree of additions, the graph has the arguments of every addition swapped
+    std::function<std::shared_ptr<Node>(size_t, bool, bool)> make_tree =
+        [&](size_t level, bool swap, bool broken) -> std::shared_ptr<Node> {
+        if (level == 0)
+        {
+            return make_shared<op::Parameter>(element::i32, shape);
+        }
+        auto lhs = make_tree(level - 1, swap, broken);
+        auto rhs = make_tree(level - 1, swap, false);
+        if (broken && level == 1)
+        {
+            return make_shared<op::Multiply>(lhs, rhs);
+        }
+        return swap ? make_shared<op::Add>(rhs, lhs) : make_shared<op::Add>(lhs, rhs);
+    };
+    std::function<std::shared_ptr<Node>(size_t)> make_pattern =
+        [&](size_t level) -> std::shared_ptr<Node> {
+        if (level == 0)
+        {
+            return std::make_shared<pattern::op::Label>(element::i32, shape);
+        }
+        return make_shared<op::Add>(make_pattern(level - 1), make_pattern(level - 1));
+    };
+
+    auto pattern = make_pattern(depth);
+    Matcher matcher(pattern);
+    ASSERT_TRUE(matcher.match(make_tree(depth, true, false)));
+    ASSERT_EQ(matcher.get_matched_nodes().size(), (size_t{1} << (depth + 1)) - 1);
+    ASSERT_FALSE(matcher.match(make_tree(depth, true, true)));
+    ASSERT_TRUE(matcher.get_matched_nodes().empty());
+}
+
 TEST(pattern, recurrent_pattern)
 {
     using ngraph::pattern::RecurrentMatcher;
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <exception>
+#include <mutex>
+
 #include "int_executable.hpp"
 #include "backend_manager.hpp"
 #include "ngraph/chrome_trace.hpp"
@@ -28,6 +31,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "opset0_downgrade.hpp"
@@ -161,25 +165,35 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
-    // for each ordered op in the graph
+    // for each ordered op in the graph collect its input and output tensors, the ops are
+    // grouped by the length of the longest path from the parameters, ops of one group do not
+    // depend on each other
+    vector<vector<OpCall>> levels;
+    unordered_map<const Node*, size_t> op_levels;
     for (auto op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
         if (op::is_parameter(op))
         {
             continue;
         }
 
+        OpCall call{op, {}, {}};
+        size_t level = 0;
+
         // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
         for (auto input : op->inputs())
         {
             descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            call.inputs.push_back(tensor_map.at(tensor));
+
+            auto it = op_levels.find(input.get_source_output().get_node());
+            if (it != op_levels.end())
+            {
+                level = std::max(level, it->second + 1);
+            }
         }
 
         // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
@@ -194,53 +208,116 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             {
                 host_tensor = it->second;
             }
-            op_outputs.push_back(host_tensor);
+            call.outputs.push_back(host_tensor);
         }
 
-        // get op type
-        element::Type type;
-        if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op))
-        {
-            type = op->get_input_element_type(0);
-        }
-        else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
-                 is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
-        {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-        }
-        else if (is_type<op::TopK>(op))
+        for (const auto& dependency : op->get_control_dependencies())
         {
-            type = op->get_output_element_type(1);
-        }
-        else
-        {
-            type = op->get_output_element_type(0);
+            auto it = op_levels.find(dependency.get());
+            if (it != op_levels.end())
+            {
+                level = std::max(level, it->second + 1);
+            }
         }
 
-        if (m_performance_counters_enabled)
-        {
-            m_timer_map[op].start();
-        }
-        if (!op->evaluate(op_outputs, op_inputs))
+        op_levels[op.get()] = level;
+        if (levels.size() <= level)
         {
-            generate_calls(type, *op.get(), op_outputs, op_inputs);
+            levels.resize(level + 1);
         }
-        if (m_performance_counters_enabled)
+        levels[level].push_back(std::move(call));
+    }
+
+    // the timers are not thread safe and would count the time of other ops
+    const bool parallel = m_parallel_execution_enabled && !m_performance_counters_enabled &&
+                          runtime::reference::get_parallel_threads() > 1;
+    for (const auto& level : levels)
+    {
+        if (!parallel || level.size() == 1)
         {
-            m_timer_map[op].stop();
+            for (const auto& call : level)
+            {
+                call_op(call);
+            }
+            continue;
         }
-        if (m_nan_check_enabled)
+
+        exception_ptr error;
+        mutex error_mutex;
+        runtime::reference::parallel_for(level.size(),
+                                         [&](size_t begin, size_t end) {
+                                             try
+                                             {
+                                                 for (size_t i = begin; i < end; i++)
+                                                 {
+                                                     call_op(level[i]);
+                                                 }
+                                             }
+                                             catch (...)
+                                             {
+                                                 lock_guard<mutex> lock(error_mutex);
+                                                 if (!error)
+                                                 {
+                                                     error = current_exception();
+                                                 }
+                                             }
+                                         },
+                                         1);
+        if (error)
         {
-            perform_nan_check(op_outputs, op.get());
+            rethrow_exception(error);
         }
     }
 
     return true;
 }
 
+void runtime::interpreter::INTExecutable::call_op(const OpCall& call)
+{
+    const auto& op = call.op;
+    event::Duration d2(op->description(), "Interpreter");
+
+    // get op type
+    element::Type type;
+    if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op))
+    {
+        type = op->get_input_element_type(0);
+    }
+    else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
+             is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
+    {
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op->get_input_element_type(1);
+    }
+    else if (is_type<op::TopK>(op))
+    {
+        type = op->get_output_element_type(1);
+    }
+    else
+    {
+        type = op->get_output_element_type(0);
+    }
+
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map[op].start();
+    }
+    if (!op->evaluate(call.outputs, call.inputs))
+    {
+        generate_calls(type, *op.get(), call.outputs, call.inputs);
+    }
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map[op].stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(call.outputs, op.get());
+    }
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const Node& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
@@ -275,6 +352,11 @@ void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
     m_nan_check_enabled = enable;
 }
 
+void runtime::interpreter::INTExecutable::set_parallel_execution(bool enable)
+{
+    m_parallel_execution_enabled = enable;
+}
+
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTExecutable::get_performance_data() const
 {
@@ -137,6 +137,11 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Enables running the ops independent from each other in parallel, the ops are
+    ///        executed in the order of the function when disabled or when the performance
+    ///        counters are collected
+    void set_parallel_execution(bool enable);
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -158,6 +163,7 @@ protected:
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
+    bool m_parallel_execution_enabled = true;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<std::shared_ptr<Node>> m_nodes;
@@ -166,6 +172,15 @@ protected:
 
     static OP_TYPEID get_typeid(const Node& node);
 
+    struct OpCall
+    {
+        std::shared_ptr<Node> op;
+        std::vector<std::shared_ptr<HostTensor>> inputs;
+        std::vector<std::shared_ptr<HostTensor>> outputs;
+    };
+
+    void call_op(const OpCall& call);
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
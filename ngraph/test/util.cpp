@@ -248,6 +248,20 @@ TEST_F(CloneTest, clone_function_full)
     ASSERT_TRUE(CompareNodeVector(func->get_ops(), cloned_func->get_ops(), node_map));
 }
 
+TEST(graph_util, clone_function_shares_constant_data)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto C = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, C), ParameterVector{A});
+
+    NodeMap node_map;
+    auto cloned_f = clone_function(*f, node_map);
+    auto cloned_C = as_type_ptr<op::Constant>(node_map.at(C.get()));
+    ASSERT_NE(cloned_C, nullptr);
+    EXPECT_NE(cloned_C, C);
+    EXPECT_EQ(cloned_C->get_data_ptr(), C->get_data_ptr());
+}
+
 TEST(graph_util, clone_multiple_results)
 {
     Shape shape{2, 2};
@@ -732,3 +746,25 @@ TEST(util, double_to_int)
     EXPECT_TRUE(double_to_int<int32_t>(x, floor_func) == 1);
     EXPECT_TRUE(double_to_int<int32_t>(x, round_func) == 2);
 }
+
+TEST(util, validate_nodes_and_infer_types_changed_parameters)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto relu_a = make_shared<op::Relu>(a);
+    auto shape_of = make_shared<op::v0::ShapeOf>(relu_a);
+    auto relu_b = make_shared<op::Relu>(b);
+    auto f = make_shared<Function>(NodeVector{relu_a, shape_of, relu_b}, ParameterVector{a, b});
+
+    auto new_a = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    f->replace_parameter(0, new_a);
+    f->validate_nodes_and_infer_types(ParameterVector{new_a});
+
+    EXPECT_EQ(relu_a->get_output_shape(0), (Shape{5, 3}));
+    EXPECT_EQ(shape_of->get_output_shape(0), (Shape{2}));
+    EXPECT_EQ(relu_b->get_output_shape(0), (Shape{4}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{5, 3}));
+
+    auto undeclared = make_shared<op::Parameter>(element::f32, Shape{1});
+    EXPECT_THROW(f->validate_nodes_and_infer_types(ParameterVector{undeclared}), ngraph_error);
+}